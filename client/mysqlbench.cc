@@ -0,0 +1,717 @@
+/*
+   Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
+*/
+
+/*
+  MySQL Bench
+
+  A fixed-rate (open-loop) load generator with latency percentile
+  reporting.
+
+  mysqlslap runs a closed loop: each client thread issues its next query
+  only after the previous one has returned, so when the server stalls the
+  offered load drops with it and the stall never shows up in the timings
+  (coordinated omission). This tool instead derives a fixed schedule of
+  intended send times from --rate and measures every query from its
+  *scheduled* start, so time spent queueing behind a stall is charged to
+  the queries that suffered it.
+
+  Latencies are captured per statement class (one class per delimited
+  statement in --query) in a log-linear histogram with ~1.6% value
+  resolution, and reported as percentiles.
+
+  --host accepts a comma-separated list; worker threads are spread
+  round-robin over the listed hosts so one invocation can drive a replica
+  set or an NDB/InnoDB cluster fan-out. All hosts share --port.
+
+  Example: 32 clients, 10000 queries/second in total for 60 seconds:
+
+    mysqlbench --query="SELECT c FROM sbtest1 WHERE id=42" \
+               --create-schema=sbtest \
+               --concurrency=32 --rate=10000 --duration=60
+*/
+
+#include "my_config.h"
+
+#include <ctype.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <mysqld_error.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <time.h>
+
+#include <string>
+#include <vector>
+
+#include "caching_sha2_passwordopt-vars.h"
+#include "my_dir.h"
+#include "sslopt-vars.h"
+
+#include "client/client_priv.h"
+#include "compression.h"
+#include "my_alloc.h"
+#include "my_dbug.h"
+#include "my_default.h"
+#include "my_inttypes.h"
+#include "my_io.h"
+#include "my_systime.h"
+#include "my_thread.h"
+#include "mysql/service_mysql_alloc.h"
+#include "print_version.h"
+#include "thr_mutex.h"
+#include "typelib.h"
+#include "welcome_copyright_notice.h" /* ORACLE_WELCOME_COPYRIGHT_NOTICE */
+
+static char *opt_host_list = nullptr, *opt_password = nullptr,
+            *user_supplied_query = nullptr, *opt_mysql_unix_port = nullptr,
+            *opt_db = nullptr;
+static const char *user = nullptr;
+static char *opt_plugin_dir = nullptr, *opt_default_auth = nullptr;
+static uint opt_enable_cleartext_plugin = 0;
+static bool using_opt_enable_cleartext_plugin = false;
+
+const char *delimiter = ";";
+
+static bool debug_info_flag = false, debug_check_flag = false;
+static bool opt_compress = false, tty_password = false, opt_silent = false;
+
+static uint opt_zstd_compress_level = default_zstd_compression_level;
+static char *opt_compress_algorithm = nullptr;
+
+static unsigned long connect_flags =
+    CLIENT_MULTI_RESULTS | CLIENT_REMEMBER_OPTIONS;
+
+static int verbose;
+static uint opt_concurrency = 1;
+static uint opt_rate = 0;
+static uint opt_duration = 60;
+static uint my_end_arg = 0;
+static const char *default_charset = MYSQL_DEFAULT_CHARSET_NAME;
+static uint opt_protocol = 0;
+static uint opt_mysql_port = 0;
+
+const char *default_dbug_option = "d:t:o,/tmp/mysqlbench.trace";
+
+static const char *load_default_groups[] = {"mysqlbench", "client", nullptr};
+
+/*
+  Log-linear latency histogram, in microseconds.
+
+  Values below 128 get their own bucket; above that each power of two is
+  split into 64 linear sub-buckets, so the quantization error is bounded
+  by ~1.6% of the recorded value at any magnitude. The fixed bucket count
+  covers the full 64-bit range, so recording never saturates or
+  reallocates and costs one shift loop plus one increment on the hot
+  path.
+*/
+#define LATENCY_BUCKETS (128 + 57 * 64)
+
+struct latency_histogram {
+  ulonglong counts[LATENCY_BUCKETS];
+  ulonglong total;
+  ulonglong errors;
+  ulonglong min;
+  ulonglong max;
+  ulonglong sum;
+};
+
+static uint latency_bucket(ulonglong value) {
+  if (value < 128) return (uint)value;
+  uint shift = 0;
+  while ((value >> shift) >= 128) shift++;
+  return shift * 64 + (uint)(value >> shift);
+}
+
+/* Representative (upper midpoint) value for a bucket, for reporting. */
+static ulonglong latency_bucket_value(uint bucket) {
+  if (bucket < 128) return bucket;
+  uint shift = bucket / 64 - 1;
+  ulonglong mantissa = 64 + bucket % 64;
+  return (mantissa << shift) + (1ULL << shift) / 2;
+}
+
+static void latency_histogram_init(latency_histogram *h) {
+  memset(h, 0, sizeof(*h));
+  h->min = ULLONG_MAX;
+}
+
+static void latency_histogram_record(latency_histogram *h, ulonglong value) {
+  h->counts[latency_bucket(value)]++;
+  h->total++;
+  h->sum += value;
+  if (value < h->min) h->min = value;
+  if (value > h->max) h->max = value;
+}
+
+static void latency_histogram_merge(latency_histogram *to,
+                                    const latency_histogram *from) {
+  for (uint i = 0; i < LATENCY_BUCKETS; i++) to->counts[i] += from->counts[i];
+  to->total += from->total;
+  to->errors += from->errors;
+  to->sum += from->sum;
+  if (from->min < to->min) to->min = from->min;
+  if (from->max > to->max) to->max = from->max;
+}
+
+static ulonglong latency_percentile(const latency_histogram *h,
+                                    double percentile) {
+  if (h->total == 0) return 0;
+  ulonglong rank = (ulonglong)(percentile / 100.0 * h->total + 0.5);
+  if (rank == 0) rank = 1;
+  ulonglong seen = 0;
+  for (uint i = 0; i < LATENCY_BUCKETS; i++) {
+    seen += h->counts[i];
+    if (seen >= rank) return latency_bucket_value(i);
+  }
+  return h->max;
+}
+
+/* One class per delimited statement in --query. */
+static std::vector<std::string> *statement_classes;
+static std::vector<std::string> *host_list;
+
+/* Merged results, written by workers at exit under results_mutex. */
+static std::vector<latency_histogram> *merged_histograms;
+static native_mutex_t results_mutex;
+
+struct thread_context {
+  uint index;        /* Worker index, 0..concurrency-1 */
+  const char *host;  /* Host this worker connects to */
+  ulonglong start;   /* Common schedule epoch, microseconds */
+  ulonglong deadline;
+  my_thread_handle handle;
+  bool failed; /* Set when the worker gave up on connecting */
+};
+
+static int get_options(int *argc, char ***argv);
+static int bench_connect(MYSQL *mysql, const char *host);
+extern "C" void *run_task(void *p);
+static void print_report(ulonglong wall_time_us);
+
+static struct my_option my_long_options[] = {
+    {"help", '?', "Display this help and exit.", nullptr, nullptr, nullptr,
+     GET_NO_ARG, NO_ARG, 0, 0, 0, nullptr, 0, nullptr},
+    {"compress", 'C', "Use compression in server/client protocol.",
+     &opt_compress, &opt_compress, nullptr, GET_BOOL, NO_ARG, 0, 0, 0, nullptr,
+     0, nullptr},
+    {"concurrency", 'c', "Number of client connections (worker threads).",
+     &opt_concurrency, &opt_concurrency, nullptr, GET_UINT, REQUIRED_ARG, 1, 1,
+     0, nullptr, 0, nullptr},
+    {"create-schema", OPT_CREATE_SLAP_SCHEMA, "Schema to run the queries in.",
+     &opt_db, &opt_db, nullptr, GET_STR, REQUIRED_ARG, 0, 0, 0, nullptr, 0,
+     nullptr},
+#ifdef DBUG_OFF
+    {"debug", '#', "This is a non-debug version. Catch this and exit.", 0, 0, 0,
+     GET_DISABLED, OPT_ARG, 0, 0, 0, 0, 0, 0},
+    {"debug-check", OPT_DEBUG_CHECK,
+     "This is a non-debug version. Catch this and exit.", 0, 0, 0, GET_DISABLED,
+     NO_ARG, 0, 0, 0, 0, 0, 0},
+    {"debug-info", 'T', "This is a non-debug version. Catch this and exit.", 0,
+     0, 0, GET_DISABLED, NO_ARG, 0, 0, 0, 0, 0, 0},
+#else
+    {"debug", '#', "Output debug log. Often this is 'd:t:o,filename'.",
+     &default_dbug_option, &default_dbug_option, nullptr, GET_STR, OPT_ARG, 0,
+     0, 0, nullptr, 0, nullptr},
+    {"debug-check", OPT_DEBUG_CHECK,
+     "Check memory and open file usage at exit.", &debug_check_flag,
+     &debug_check_flag, nullptr, GET_BOOL, NO_ARG, 0, 0, 0, nullptr, 0,
+     nullptr},
+    {"debug-info", 'T', "Print some debug info at exit.", &debug_info_flag,
+     &debug_info_flag, nullptr, GET_BOOL, NO_ARG, 0, 0, 0, nullptr, 0, nullptr},
+#endif
+    {"default_auth", OPT_DEFAULT_AUTH,
+     "Default authentication client-side plugin to use.", &opt_default_auth,
+     &opt_default_auth, nullptr, GET_STR, REQUIRED_ARG, 0, 0, 0, nullptr, 0,
+     nullptr},
+    {"delimiter", 'F',
+     "Delimiter to use in SQL statements supplied in file or command line.",
+     &delimiter, &delimiter, nullptr, GET_STR, REQUIRED_ARG, 0, 0, 0, nullptr,
+     0, nullptr},
+    {"duration", 0, "Length of the measured run in seconds.", &opt_duration,
+     &opt_duration, nullptr, GET_UINT, REQUIRED_ARG, 60, 1, 0, nullptr, 0,
+     nullptr},
+    {"enable_cleartext_plugin", OPT_ENABLE_CLEARTEXT_PLUGIN,
+     "Enable/disable the clear text authentication plugin.",
+     &opt_enable_cleartext_plugin, &opt_enable_cleartext_plugin, nullptr,
+     GET_BOOL, OPT_ARG, 0, 0, 0, nullptr, 0, nullptr},
+    {"host", 'h',
+     "Connect to host. A comma-separated list spreads the worker threads "
+     "round-robin over several hosts; all hosts share --port.",
+     &opt_host_list, &opt_host_list, nullptr, GET_STR, REQUIRED_ARG, 0, 0, 0,
+     nullptr, 0, nullptr},
+    {"password", 'p',
+     "Password to use when connecting to server. If password is not given it's "
+     "asked from the tty.",
+     nullptr, nullptr, nullptr, GET_PASSWORD, OPT_ARG, 0, 0, 0, nullptr, 0,
+     nullptr},
+#ifdef _WIN32
+    {"pipe", 'W', "Use named pipes to connect to server.", nullptr, nullptr,
+     nullptr, GET_NO_ARG, NO_ARG, 0, 0, 0, nullptr, 0, nullptr},
+#endif
+    {"plugin_dir", OPT_PLUGIN_DIR, "Directory for client-side plugins.",
+     &opt_plugin_dir, &opt_plugin_dir, nullptr, GET_STR, REQUIRED_ARG, 0, 0, 0,
+     nullptr, 0, nullptr},
+    {"port", 'P', "Port number to use for connection.", &opt_mysql_port,
+     &opt_mysql_port, nullptr, GET_UINT, REQUIRED_ARG, MYSQL_PORT, 0, 0,
+     nullptr, 0, nullptr},
+    {"protocol", OPT_MYSQL_PROTOCOL,
+     "The protocol to use for connection (tcp, socket, pipe, memory).", nullptr,
+     nullptr, nullptr, GET_STR, REQUIRED_ARG, 0, 0, 0, nullptr, 0, nullptr},
+    {"query", 'q', "Query to run or file containing query to run.",
+     &user_supplied_query, &user_supplied_query, nullptr, GET_STR, REQUIRED_ARG,
+     0, 0, 0, nullptr, 0, nullptr},
+    {"rate", 0,
+     "Total number of queries to issue per second, spread over all worker "
+     "threads. The schedule is open loop: when the server falls behind, "
+     "queries queue up and their wait is included in the reported latency.",
+     &opt_rate, &opt_rate, nullptr, GET_UINT, REQUIRED_ARG, 0, 1, 0, nullptr, 0,
+     nullptr},
+    {"silent", 's', "Run program in silent mode - no output.", &opt_silent,
+     &opt_silent, nullptr, GET_BOOL, NO_ARG, 0, 0, 0, nullptr, 0, nullptr},
+    {"socket", 'S', "The socket file to use for connection.",
+     &opt_mysql_unix_port, &opt_mysql_unix_port, nullptr, GET_STR, REQUIRED_ARG,
+     0, 0, 0, nullptr, 0, nullptr},
+#include "caching_sha2_passwordopt-longopts.h"
+#include "sslopt-longopts.h"
+
+    {"user", 'u', "User for login if not current user.", &user, &user, nullptr,
+     GET_STR, REQUIRED_ARG, 0, 0, 0, nullptr, 0, nullptr},
+    {"verbose", 'v',
+     "More verbose output; you can use this multiple times to get even more "
+     "verbose output.",
+     &verbose, &verbose, nullptr, GET_NO_ARG, NO_ARG, 0, 0, 0, nullptr, 0,
+     nullptr},
+    {"version", 'V', "Output version information and exit.", nullptr, nullptr,
+     nullptr, GET_NO_ARG, NO_ARG, 0, 0, 0, nullptr, 0, nullptr},
+    {"compression-algorithms", 0,
+     "Use compression algorithm in server/client protocol. Valid values "
+     "are any combination of 'zstd','zlib','uncompressed'.",
+     &opt_compress_algorithm, &opt_compress_algorithm, nullptr, GET_STR,
+     REQUIRED_ARG, 0, 0, 0, nullptr, 0, nullptr},
+    {"zstd-compression-level", 0,
+     "Use this compression level in the client/server protocol, in case "
+     "--compression-algorithms=zstd. Valid range is between 1 and 22, "
+     "inclusive. Default is 3.",
+     &opt_zstd_compress_level, &opt_zstd_compress_level, nullptr, GET_UINT,
+     REQUIRED_ARG, 3, 1, 22, nullptr, 0, nullptr},
+    {nullptr, 0, nullptr, nullptr, nullptr, nullptr, GET_NO_ARG, NO_ARG, 0, 0,
+     0, nullptr, 0, nullptr}};
+
+static void usage(void) {
+  print_version();
+  puts(ORACLE_WELCOME_COPYRIGHT_NOTICE("2020"));
+  puts(
+      "Drive the server with a fixed-rate open-loop load and report\n"
+      "latency percentiles per statement.\n");
+  printf("Usage: %s [OPTIONS]\n", my_progname);
+  print_defaults("my", load_default_groups);
+  my_print_help(my_long_options);
+}
+
+extern "C" {
+static bool get_one_option(int optid, const struct my_option *opt,
+                           char *argument) {
+  DBUG_TRACE;
+  switch (optid) {
+    case 'v':
+      verbose++;
+      break;
+    case 'p':
+      if (argument == disabled_my_option) {
+        // Don't require password
+        static char empty_password[] = {'\0'};
+        DBUG_ASSERT(empty_password[0] ==
+                    '\0');  // Check that it has not been overwritten
+        argument = empty_password;
+      }
+      if (argument) {
+        char *start = argument;
+        my_free(opt_password);
+        opt_password = my_strdup(PSI_NOT_INSTRUMENTED, argument, MYF(MY_FAE));
+        while (*argument) *argument++ = 'x'; /* Destroy argument */
+        if (*start) start[1] = 0;            /* Cut length of argument */
+        tty_password = false;
+      } else
+        tty_password = true;
+      break;
+    case 'W':
+#ifdef _WIN32
+      opt_protocol = MYSQL_PROTOCOL_PIPE;
+#endif
+      break;
+    case OPT_MYSQL_PROTOCOL:
+      opt_protocol =
+          find_type_or_exit(argument, &sql_protocol_typelib, opt->name);
+      break;
+    case '#':
+      DBUG_PUSH(argument ? argument : default_dbug_option);
+      debug_check_flag = true;
+      break;
+#include "sslopt-case.h"
+
+    case 'V':
+      print_version();
+      exit(0);
+      break;
+    case '?':
+    case 'I': /* Info */
+      usage();
+      exit(0);
+    case OPT_ENABLE_CLEARTEXT_PLUGIN:
+      using_opt_enable_cleartext_plugin = true;
+      break;
+  }
+  return false;
+}
+}
+
+/*
+  Split the query option (inline string or file contents) into statement
+  classes on the delimiter, skipping empty pieces.
+*/
+static void parse_statement_classes(const char *script) {
+  const char *ptr = script;
+  while (*ptr) {
+    const char *end = strchr(ptr, delimiter[0]);
+    size_t length = end ? (size_t)(end - ptr) : strlen(ptr);
+    while (length && isspace((uchar)*ptr)) {
+      ptr++;
+      length--;
+    }
+    while (length && isspace((uchar)ptr[length - 1])) length--;
+    if (length) statement_classes->push_back(std::string(ptr, length));
+    if (!end) break;
+    ptr = end + 1;
+  }
+}
+
+static int get_options(int *argc, char ***argv) {
+  int ho_error;
+  MY_STAT sbuf; /* Stat information for the data file */
+
+  DBUG_TRACE;
+  if ((ho_error = handle_options(argc, argv, my_long_options, get_one_option)))
+    exit(ho_error);
+  if (debug_info_flag) my_end_arg = MY_CHECK_ERROR | MY_GIVE_INFO;
+  if (debug_check_flag) my_end_arg = MY_CHECK_ERROR;
+
+  if (!user) user = "root";
+
+  if (!user_supplied_query) {
+    fprintf(stderr, "%s: No query supplied, use --query\n", my_progname);
+    exit(1);
+  }
+
+  if (!opt_rate) {
+    fprintf(stderr, "%s: No target rate supplied, use --rate\n", my_progname);
+    exit(1);
+  }
+
+  if (my_stat(user_supplied_query, &sbuf, MYF(0))) {
+    File data_file;
+    char *tmp_string;
+    if (!MY_S_ISREG(sbuf.st_mode)) {
+      fprintf(stderr, "%s: User query supplied file was not a regular file\n",
+              my_progname);
+      exit(1);
+    }
+    if ((data_file = my_open(user_supplied_query, O_RDWR, MYF(0))) == -1) {
+      fprintf(stderr, "%s: Could not open query supplied file\n", my_progname);
+      exit(1);
+    }
+    tmp_string =
+        (char *)my_malloc(PSI_NOT_INSTRUMENTED, (size_t)sbuf.st_size + 1,
+                          MYF(MY_ZEROFILL | MY_FAE | MY_WME));
+    my_read(data_file, (uchar *)tmp_string, (size_t)sbuf.st_size, MYF(0));
+    tmp_string[sbuf.st_size] = '\0';
+    my_close(data_file, MYF(0));
+    parse_statement_classes(tmp_string);
+    my_free(tmp_string);
+  } else {
+    parse_statement_classes(user_supplied_query);
+  }
+
+  if (statement_classes->empty()) {
+    fprintf(stderr, "%s: Query string contained no statements\n", my_progname);
+    exit(1);
+  }
+
+  /* Split the host option into the fan-out list. */
+  {
+    const char *hosts = opt_host_list ? opt_host_list : "localhost";
+    const char *ptr = hosts;
+    while (*ptr) {
+      const char *end = strchr(ptr, ',');
+      size_t length = end ? (size_t)(end - ptr) : strlen(ptr);
+      if (length) host_list->push_back(std::string(ptr, length));
+      if (!end) break;
+      ptr = end + 1;
+    }
+    if (host_list->empty()) host_list->push_back("localhost");
+  }
+
+  if (tty_password) opt_password = get_tty_password(NullS);
+
+  return 0;
+}
+
+static int bench_connect(MYSQL *mysql, const char *host) {
+  /* Connect to server, with the same retry policy as mysqlslap. */
+  static ulong connection_retry_sleep = 100000; /* Microseconds */
+  int x, connect_error = 1;
+
+  mysql_init(mysql);
+  if (opt_compress) mysql_options(mysql, MYSQL_OPT_COMPRESS, NullS);
+  if (opt_compress_algorithm)
+    mysql_options(mysql, MYSQL_OPT_COMPRESSION_ALGORITHMS,
+                  opt_compress_algorithm);
+  mysql_options(mysql, MYSQL_OPT_ZSTD_COMPRESSION_LEVEL,
+                &opt_zstd_compress_level);
+  if (SSL_SET_OPTIONS(mysql)) {
+    fprintf(stderr, "%s", SSL_SET_OPTIONS_ERROR);
+    return 1;
+  }
+  if (opt_protocol)
+    mysql_options(mysql, MYSQL_OPT_PROTOCOL, (char *)&opt_protocol);
+  mysql_options(mysql, MYSQL_SET_CHARSET_NAME, default_charset);
+  if (opt_plugin_dir && *opt_plugin_dir)
+    mysql_options(mysql, MYSQL_PLUGIN_DIR, opt_plugin_dir);
+  if (opt_default_auth && *opt_default_auth)
+    mysql_options(mysql, MYSQL_DEFAULT_AUTH, opt_default_auth);
+  mysql_options(mysql, MYSQL_OPT_CONNECT_ATTR_RESET, nullptr);
+  mysql_options4(mysql, MYSQL_OPT_CONNECT_ATTR_ADD, "program_name",
+                 "mysqlbench");
+  if (using_opt_enable_cleartext_plugin)
+    mysql_options(mysql, MYSQL_ENABLE_CLEARTEXT_PLUGIN,
+                  (char *)&opt_enable_cleartext_plugin);
+  set_server_public_key(mysql);
+  set_get_server_public_key_option(mysql);
+
+  for (x = 0; x < 10; x++) {
+    if (mysql_real_connect(mysql, host, user, opt_password, opt_db,
+                           opt_mysql_port, opt_mysql_unix_port,
+                           connect_flags)) {
+      connect_error = 0;
+      break;
+    }
+    my_sleep(connection_retry_sleep);
+  }
+  if (connect_error) {
+    fprintf(stderr, "%s: Error when connecting to server %s: %d %s\n",
+            my_progname, host, mysql_errno(mysql), mysql_error(mysql));
+    return 1;
+  }
+
+  return 0;
+}
+
+extern "C" void *run_task(void *p) {
+  thread_context *con = (thread_context *)p;
+  MYSQL mysql{};
+  MYSQL_RES *result;
+  const uint num_classes = (uint)statement_classes->size();
+  std::vector<latency_histogram> histograms(num_classes);
+  DBUG_TRACE;
+
+  for (uint i = 0; i < num_classes; i++) latency_histogram_init(&histograms[i]);
+
+  if (bench_connect(&mysql, con->host)) {
+    con->failed = true;
+    return nullptr;
+  }
+
+  /*
+    The k-th query of this worker is due at
+    start + (k * concurrency + index) / rate seconds. Recomputing the
+    absolute due time from k (instead of accumulating an interval) keeps
+    the schedule free of rounding drift at high rates.
+  */
+  for (ulonglong k = 0;; k++) {
+    const ulonglong scheduled =
+        con->start +
+        ((k * opt_concurrency + con->index) * 1000000ULL) / opt_rate;
+    if (scheduled >= con->deadline) break;
+
+    ulonglong now = my_micro_time();
+    if (now < scheduled) {
+      my_sleep(scheduled - now);
+    }
+    /* If we are behind schedule, send immediately: the queueing delay
+       stays part of this query's measured latency. */
+
+    const uint clas = (uint)((k * opt_concurrency + con->index) % num_classes);
+    const std::string &query = (*statement_classes)[clas];
+
+    if (mysql_real_query(&mysql, query.c_str(), (ulong)query.length())) {
+      histograms[clas].errors++;
+      if (verbose >= 2)
+        fprintf(stderr, "%s: Cannot run query %.*s ERROR : %s\n", my_progname,
+                (uint)query.length(), query.c_str(), mysql_error(&mysql));
+      continue;
+    }
+    do {
+      if (mysql_field_count(&mysql)) {
+        if (!(result = mysql_store_result(&mysql))) {
+          histograms[clas].errors++;
+          break;
+        }
+        mysql_free_result(result);
+      }
+    } while (mysql_next_result(&mysql) == 0);
+
+    latency_histogram_record(&histograms[clas], my_micro_time() - scheduled);
+  }
+
+  mysql_close(&mysql);
+
+  native_mutex_lock(&results_mutex);
+  for (uint i = 0; i < num_classes; i++)
+    latency_histogram_merge(&(*merged_histograms)[i], &histograms[i]);
+  native_mutex_unlock(&results_mutex);
+
+  return nullptr;
+}
+
+static void print_percentiles(const latency_histogram *h) {
+  printf(
+      "\tlatency (us): min %llu  avg %llu  p50 %llu  p90 %llu  p95 %llu  "
+      "p99 %llu  p99.9 %llu  max %llu\n",
+      h->total ? h->min : 0, h->total ? h->sum / h->total : 0,
+      latency_percentile(h, 50.0), latency_percentile(h, 90.0),
+      latency_percentile(h, 95.0), latency_percentile(h, 99.0),
+      latency_percentile(h, 99.9), h->total ? h->max : 0);
+}
+
+static void print_report(ulonglong wall_time_us) {
+  const uint num_classes = (uint)statement_classes->size();
+  latency_histogram combined;
+
+  latency_histogram_init(&combined);
+
+  printf("Benchmark: %u threads over %u host%s, target %u queries/s for %us\n",
+         opt_concurrency, (uint)host_list->size(),
+         host_list->size() > 1 ? "s" : "", opt_rate, opt_duration);
+
+  for (uint i = 0; i < num_classes; i++) {
+    const latency_histogram *h = &(*merged_histograms)[i];
+    const std::string &query = (*statement_classes)[i];
+
+    latency_histogram_merge(&combined, h);
+    if (num_classes > 1) {
+      printf("Statement %u: %.40s%s\n", i, query.c_str(),
+             query.length() > 40 ? "..." : "");
+      printf("\tqueries: %llu  errors: %llu  rate: %.1f/s\n", h->total,
+             h->errors,
+             wall_time_us ? h->total * 1000000.0 / wall_time_us : 0.0);
+      print_percentiles(h);
+    }
+  }
+
+  printf("Overall:\n");
+  printf("\tqueries: %llu  errors: %llu  rate: %.1f/s (of %u targeted)\n",
+         combined.total, combined.errors,
+         wall_time_us ? combined.total * 1000000.0 / wall_time_us : 0.0,
+         opt_rate);
+  print_percentiles(&combined);
+}
+
+int main(int argc, char **argv) {
+  std::vector<thread_context> threads;
+  ulonglong start, wall_end;
+  uint x;
+  bool failed = false;
+
+  MY_INIT(argv[0]);
+
+  my_getopt_use_args_separator = true;
+  MEM_ROOT alloc{PSI_NOT_INSTRUMENTED, 512};
+  if (load_defaults("my", load_default_groups, &argc, &argv, &alloc)) {
+    my_end(0);
+    return EXIT_FAILURE;
+  }
+  my_getopt_use_args_separator = false;
+
+  statement_classes = new std::vector<std::string>;
+  host_list = new std::vector<std::string>;
+
+  if (get_options(&argc, &argv)) {
+    my_end(0);
+    return EXIT_FAILURE;
+  }
+
+  if (argc > 0) {
+    fprintf(stderr, "%s: Too many arguments\n", my_progname);
+    my_end(0);
+    return EXIT_FAILURE;
+  }
+
+  merged_histograms = new std::vector<latency_histogram>(
+      statement_classes->size());
+  for (x = 0; x < statement_classes->size(); x++)
+    latency_histogram_init(&(*merged_histograms)[x]);
+
+  native_mutex_init(&results_mutex, nullptr);
+
+  /* Give the workers half a second to finish connecting before the
+     schedule epoch, so connect time is not charged to the first query. */
+  start = my_micro_time() + 500000;
+
+  threads.resize(opt_concurrency);
+  for (x = 0; x < opt_concurrency; x++) {
+    thread_context *con = &threads[x];
+    con->index = x;
+    con->host = (*host_list)[x % host_list->size()].c_str();
+    con->start = start;
+    con->deadline = start + (ulonglong)opt_duration * 1000000ULL;
+    con->failed = false;
+    if (my_thread_create(&con->handle, nullptr, run_task, (void *)con) != 0) {
+      fprintf(stderr, "%s: Could not create thread\n", my_progname);
+      exit(1);
+    }
+  }
+
+  for (x = 0; x < opt_concurrency; x++) {
+    my_thread_join(&threads[x].handle, nullptr);
+    if (threads[x].failed) failed = true;
+  }
+  wall_end = my_micro_time();
+
+  if (!opt_silent)
+    print_report(wall_end > start ? wall_end - start : 0);
+
+  native_mutex_destroy(&results_mutex);
+
+  delete merged_histograms;
+  delete statement_classes;
+  delete host_list;
+  my_free(opt_password);
+  mysql_server_end();
+  my_end(my_end_arg);
+
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
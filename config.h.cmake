@@ -38,6 +38,7 @@
 #cmakedefine HAVE_LIBWRAP_PROTOTYPES 1
 
 /* Header files */
+#cmakedefine HAVE_AIO_H 1
 #cmakedefine HAVE_ALLOCA_H 1
 #cmakedefine HAVE_ARPA_INET_H 1
 #cmakedefine HAVE_DLFCN_H 1
@@ -100,6 +101,7 @@
 #cmakedefine HAVE_MLOCKALL 1
 #cmakedefine HAVE_MMAP64 1
 #cmakedefine HAVE_POLL 1
+#cmakedefine HAVE_POSIX_FADVISE 1
 #cmakedefine HAVE_POSIX_FALLOCATE 1
 #cmakedefine HAVE_POSIX_MEMALIGN 1
 #cmakedefine HAVE_PTHREAD_CONDATTR_SETCLOCK 1
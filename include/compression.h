@@ -35,6 +35,7 @@
 
 #define COMPRESSION_ALGORITHM_ZLIB "zlib"
 #define COMPRESSION_ALGORITHM_ZSTD "zstd"
+#define COMPRESSION_ALGORITHM_ZSTD_STREAM "zstd_stream"
 #define COMPRESSION_ALGORITHM_UNCOMPRESSED "uncompressed"
 #define COMPRESSION_ALGORITHM_NAME_LENGTH_MAX 32
 #define COMPRESSION_ALGORITHM_COUNT_MAX 3
@@ -66,6 +66,16 @@ int decimal2ulonglong(const decimal_t *from, ulonglong *to);
 int ulonglong2decimal(ulonglong from, decimal_t *to);
 int decimal2longlong(const decimal_t *from, longlong *to);
 int longlong2decimal(longlong from, decimal_t *to);
+#ifdef __SIZEOF_INT128__
+/**
+  The largest number of decimal digits (integer plus fractional) that
+  decimal2int128() accepts; 38 nines is the largest repunit-bounded value
+  that is guaranteed to fit in the 127 bits of magnitude of an __int128.
+*/
+static constexpr int DECIMAL_INT128_DIGITS = 38;
+int decimal2int128(const decimal_t *from, int scale, __int128 *to);
+int int128todecimal(__int128 from, int scale, decimal_t *to);
+#endif
 int decimal2double(const decimal_t *from, double *to);
 int double2decimal(double from, decimal_t *to);
 int decimal_actual_fraction(const decimal_t *from);
@@ -126,6 +126,17 @@ struct KEY_CACHE {
 
   int blocks;   /* max number of blocks in the cache        */
   bool in_init; /* Set to 1 in MySQL during init/resize     */
+
+  /*
+    When the cache is partitioned, this is an array of n_partitions
+    child caches, each with its own cache_lock, hash table and LRU
+    chain; every block operation is routed to one of them by a hash of
+    (file, block number) and the structure above is only a dispatcher
+    shell. NULL (with n_partitions == 0) for child caches and for
+    unpartitioned caches. See init_key_cache().
+  */
+  KEY_CACHE *partitions;
+  uint n_partitions;
 };
 
 /* The default key cache */
@@ -163,4 +174,5 @@ extern bool multi_key_cache_set(const uchar *key, uint length,
                                 KEY_CACHE *key_cache);
 extern void multi_key_cache_change(KEY_CACHE *old_data, KEY_CACHE *new_data);
 extern int reset_key_cache_counters(const char *name, KEY_CACHE *key_cache);
+extern void key_cache_sum_partition_stats(KEY_CACHE *key_cache);
 #endif /* _keycache_h */
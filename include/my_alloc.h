@@ -78,6 +78,7 @@ struct MEM_ROOT {
  private:
   struct Block {
     Block *prev{nullptr}; /** Previous block; used for freeing. */
+    size_t size{0};       /** Usable bytes after the block header. */
   };
 
  public:
@@ -278,6 +279,13 @@ struct MEM_ROOT {
     m_block_size = m_orig_block_size = block_size;
   }
 
+  /**
+   * Free all blocks held in the calling thread's block cache
+   * (see PushCachedBlock()). Called automatically on thread exit;
+   * can also be called explicitly to release memory under pressure.
+   */
+  static void ClearBlockCache();
+
  private:
   /**
    * Something to point on that exists solely to never return nullptr
@@ -297,6 +305,21 @@ struct MEM_ROOT {
   /** Free all blocks in a linked list, starting at the given block. */
   static void FreeBlocks(Block *start);
 
+  /**
+    Pop a block from the calling thread's block cache, or return nullptr
+    if the cache holds no block of a suitable size class. As a side effect,
+    *length is rounded up to the nearest size class (also on a cache miss),
+    so that the block ultimately allocated can be recycled later.
+  */
+  static Block *PopCachedBlock(size_t *length);
+
+  /**
+    Offer a freed block to the calling thread's block cache. Returns true
+    if the cache took ownership of the block; if false, the caller must
+    free it as usual.
+  */
+  static bool PushCachedBlock(Block *block);
+
   /** The current block we are giving out memory from. nullptr if none. */
   Block *m_current_block = nullptr;
 
@@ -51,7 +51,14 @@ static inline uint my_bit_log2(ulong value) {
 }
 
 static inline uint my_count_bits(ulonglong v) {
-#if SIZEOF_LONG_LONG > 4
+#if defined(__GNUC__)
+  /*
+    GCC and Clang compile this to a single POPCNT instruction when the
+    target supports it, and to a short parallel-sum sequence otherwise;
+    both beat the eight table lookups of the portable fallback.
+  */
+  return (uint)__builtin_popcountll(v);
+#elif SIZEOF_LONG_LONG > 4
   /* The following code is a bit faster on 16 bit machines than if we would
      only shift v */
   ulong v2 = (ulong)(v >> 32);
@@ -68,9 +75,13 @@ static inline uint my_count_bits(ulonglong v) {
 }
 
 static inline uint my_count_bits_uint32(uint32 v) {
+#if defined(__GNUC__)
+  return (uint)__builtin_popcount(v);
+#else
   return (uint)(uchar)(
       _my_bits_nbits[(uchar)v] + _my_bits_nbits[(uchar)(v >> 8)] +
       _my_bits_nbits[(uchar)(v >> 16)] + _my_bits_nbits[(uchar)(v >> 24)]);
+#endif
 }
 
 /*
@@ -28,7 +28,14 @@ enum enum_compression_algorithm {
   MYSQL_UNCOMPRESSED = 1,
   MYSQL_ZLIB,
   MYSQL_ZSTD,
-  MYSQL_INVALID
+  MYSQL_INVALID,
+  /**
+    zstd with the server to client direction compressed as one continuous
+    stream, so that compression history carries over from one packet to the
+    next. Placed after MYSQL_INVALID to keep the values of the older
+    enumerators stable.
+  */
+  MYSQL_ZSTD_STREAM
 };
 
 /**
@@ -62,6 +69,18 @@ typedef struct mysql_zstd_compress_context {
     Compression level to use in zstd compression.
   */
   unsigned int compression_level;
+  /**
+    True if outgoing packets are compressed as one continuous zstd stream
+    instead of one independent frame per packet. Set by the endpoint which
+    sends the streamed direction after MYSQL_ZSTD_STREAM has been negotiated.
+  */
+  bool stream_compress;
+  /**
+    True if incoming packets are decoded as one continuous zstd stream.
+    Set by the endpoint which receives the streamed direction after
+    MYSQL_ZSTD_STREAM has been negotiated.
+  */
+  bool stream_decompress;
 } mysql_zstd_compress_context;
 
 /**
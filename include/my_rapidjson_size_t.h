@@ -24,6 +24,26 @@
 #ifndef MY_RAPIDJSON_SIZE_T
 #define MY_RAPIDJSON_SIZE_T
 
+/*
+  Enable rapidjson's vectorized parsing kernels (whitespace skipping and
+  unescaped string scanning) on platforms where the required instructions
+  are always available. The macros must be defined before any rapidjson
+  header is seen; this header is by convention included first wherever
+  rapidjson is used, so defining them here keeps all translation units
+  consistent.
+*/
+#if !defined(RAPIDJSON_SSE42) && !defined(RAPIDJSON_SSE2) && \
+    !defined(RAPIDJSON_NEON)
+#if defined(__SSE4_2__)
+#define RAPIDJSON_SSE42
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAPIDJSON_SSE2
+#elif defined(__ARM_NEON)
+#define RAPIDJSON_NEON
+#endif
+#endif
+
 /**
   @file include/my_rapidjson_size_t.h
   Define rapidjson::SizeType to be std::size_t. See
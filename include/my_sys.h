@@ -320,6 +320,13 @@ struct DYNAMIC_STRING {
 struct IO_CACHE;
 typedef int (*IO_CACHE_CALLBACK)(IO_CACHE *);
 
+/*
+  State for the asynchronous double-buffered read mode of IO_CACHE.
+  Defined in mf_iocache.cc; NULL whenever prefetching is disabled or
+  not available on the platform.
+*/
+struct IO_CACHE_ASYNC;
+
 struct IO_CACHE_SHARE {
   mysql_mutex_t mutex;      /* To sync on reads into buffer. */
   mysql_cond_t cond;        /* To wait for signals. */
@@ -456,6 +463,13 @@ struct IO_CACHE /* Used when cacheing files */
   Stream_cipher *m_encryptor = nullptr;
   // This is a decryptor for decrypting the temporary file of the IO cache.
   Stream_cipher *m_decryptor = nullptr;
+  /*
+    When init_io_cache() was called with use_async_io and the platform
+    supports it, the next block of the file is prefetched into a shadow
+    buffer while the caller consumes the current one; see
+    _my_b_async_read().
+  */
+  IO_CACHE_ASYNC *async_state{nullptr};
 };
 
 typedef int (*qsort2_cmp)(const void *, const void *, const void *);
@@ -737,6 +751,7 @@ extern bool reinit_io_cache(IO_CACHE *info, enum cache_type type,
 extern void setup_io_cache(IO_CACHE *info);
 extern int _my_b_read(IO_CACHE *info, uchar *Buffer, size_t Count);
 extern int _my_b_read_r(IO_CACHE *info, uchar *Buffer, size_t Count);
+extern int _my_b_async_read(IO_CACHE *info, uchar *Buffer, size_t Count);
 extern void init_io_cache_share(IO_CACHE *read_cache, IO_CACHE_SHARE *cshare,
                                 IO_CACHE *write_cache, uint num_threads);
 extern void remove_io_thread(IO_CACHE *info);
@@ -805,6 +820,7 @@ extern bool my_uncompress(mysql_compress_context *, uchar *, size_t, size_t *);
 extern uchar *my_compress_alloc(mysql_compress_context *comp_ctx,
                                 const uchar *packet, size_t *len,
                                 size_t *complen);
+extern size_t my_compress_bound(mysql_compress_context *comp_ctx, size_t len);
 extern ha_checksum my_checksum(ha_checksum crc, const uchar *mem, size_t count);
 
 extern uint my_set_max_open_files(uint files);
@@ -91,7 +91,8 @@ enum enum_compression_algorithm {
   MYSQL_UNCOMPRESSED = 1,
   MYSQL_ZLIB,
   MYSQL_ZSTD,
-  MYSQL_INVALID
+  MYSQL_INVALID,
+  MYSQL_ZSTD_STREAM
 };
 typedef struct mysql_zlib_compress_context {
   unsigned int compression_level;
@@ -102,6 +103,8 @@ typedef struct mysql_zstd_compress_context {
   ZSTD_CCtx *cctx;
   ZSTD_DCtx *dctx;
   unsigned int compression_level;
+  bool stream_compress;
+  bool stream_decompress;
 } mysql_zstd_compress_context;
 typedef struct mysql_compress_context {
   enum enum_compression_algorithm algorithm;
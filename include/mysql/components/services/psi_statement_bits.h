@@ -182,6 +182,14 @@ struct PSI_statement_locker_state_v1 {
   unsigned long m_sort_rows;
   /** Metric, number of sort scans. */
   unsigned long m_sort_scan;
+  /** Metric, buffer pool read requests (pages touched). */
+  unsigned long long m_buf_read_requests;
+  /** Metric, buffer pool misses (pages read from storage). */
+  unsigned long long m_buf_reads;
+  /** Metric, buffer pool pages first dirtied. */
+  unsigned long long m_buf_pages_dirtied;
+  /** Metric, bytes read from storage. */
+  unsigned long long m_data_read_bytes;
   /** Statement digest. */
   const struct sql_digest_storage *m_digest;
   /** Current schema name. */
@@ -393,6 +401,19 @@ typedef void (*inc_statement_sort_rows_t)(struct PSI_statement_locker *locker,
 typedef void (*inc_statement_sort_scan_t)(struct PSI_statement_locker *locker,
                                           unsigned long count);
 
+/**
+  Add storage I/O metrics to a statement event.
+  @param locker the statement locker
+  @param read_requests number of buffer pool page accesses
+  @param reads number of buffer pool misses (pages read from storage)
+  @param pages_dirtied number of pages first dirtied by the statement
+  @param bytes_read number of bytes read from storage
+*/
+typedef void (*inc_statement_storage_io_stats_t)(
+    struct PSI_statement_locker *locker, unsigned long long read_requests,
+    unsigned long long reads, unsigned long long pages_dirtied,
+    unsigned long long bytes_read);
+
 /**
   Set a statement event "no index used" metric.
   @param locker the statement locker
@@ -62,6 +62,10 @@ struct PSI_statement_locker_state_v1 {
   unsigned long m_sort_range;
   unsigned long m_sort_rows;
   unsigned long m_sort_scan;
+  unsigned long long m_buf_read_requests;
+  unsigned long long m_buf_reads;
+  unsigned long long m_buf_pages_dirtied;
+  unsigned long long m_data_read_bytes;
   const struct sql_digest_storage *m_digest;
   char m_schema_name[(64 * 3)];
   unsigned int m_schema_name_length;
@@ -126,6 +130,10 @@ typedef void (*inc_statement_sort_rows_t)(struct PSI_statement_locker *locker,
                                           unsigned long count);
 typedef void (*inc_statement_sort_scan_t)(struct PSI_statement_locker *locker,
                                           unsigned long count);
+typedef void (*inc_statement_storage_io_stats_t)(
+    struct PSI_statement_locker *locker, unsigned long long read_requests,
+    unsigned long long reads, unsigned long long pages_dirtied,
+    unsigned long long bytes_read);
 typedef void (*set_statement_no_index_used_t)(
     struct PSI_statement_locker *locker);
 typedef void (*set_statement_no_good_index_used_t)(
@@ -210,6 +218,7 @@ struct PSI_statement_service_v2 {
   start_sp_v1_t start_sp;
   end_sp_v1_t end_sp;
   drop_sp_v1_t drop_sp;
+  inc_statement_storage_io_stats_t inc_statement_storage_io_stats;
 };
 typedef struct PSI_statement_service_v2 PSI_statement_service_t;
 extern PSI_statement_service_t *psi_statement_service;
@@ -142,6 +142,9 @@ struct PSI_statement_service_v2 {
   end_sp_v1_t end_sp;
   /** @sa drop_sp_v1_t. */
   drop_sp_v1_t drop_sp;
+
+  /** @sa inc_statement_storage_io_stats. */
+  inc_statement_storage_io_stats_t inc_statement_storage_io_stats;
 };
 
 typedef struct PSI_statement_service_v2 PSI_statement_service_t;
@@ -703,6 +703,28 @@
 */
 #define CLIENT_ZSTD_COMPRESSION_ALGORITHM (1UL << 26)
 
+/**
+  The zstd compressed protocol can carry compression history across packets.
+
+  When both sides set this flag in addition to
+  ::CLIENT_ZSTD_COMPRESSION_ALGORITHM, the server to client direction is
+  compressed as one continuous zstd stream instead of one independent frame
+  per compressed packet, which greatly improves the compression ratio of
+  small row packets. The client to server direction keeps the per-packet
+  frames. Endpoints which only know plain zstd never see the streamed format.
+
+  Server
+  ------
+  Server sets this flag whenever it advertises
+  ::CLIENT_ZSTD_COMPRESSION_ALGORITHM.
+
+  Client
+  ------
+  Client sets this flag when it is configured to use zstd compression method
+  and is able to decode a continuous zstd stream.
+*/
+#define CLIENT_ZSTD_STREAM_COMPRESSION (1UL << 27)
+
 /**
   This flag will be reserved to extend the 32bit capabilities structure to
   64bits.
@@ -736,7 +758,7 @@
    CLIENT_PLUGIN_AUTH_LENENC_CLIENT_DATA |                                     \
    CLIENT_CAN_HANDLE_EXPIRED_PASSWORDS | CLIENT_SESSION_TRACK |                \
    CLIENT_DEPRECATE_EOF | CLIENT_OPTIONAL_RESULTSET_METADATA |                 \
-   CLIENT_ZSTD_COMPRESSION_ALGORITHM)
+   CLIENT_ZSTD_COMPRESSION_ALGORITHM | CLIENT_ZSTD_STREAM_COMPRESSION)
 
 /**
   Switch off from ::CLIENT_ALL_FLAGS the flags that are optional and
@@ -747,7 +769,7 @@
 #define CLIENT_BASIC_FLAGS                                          \
   (CLIENT_ALL_FLAGS &                                               \
    ~(CLIENT_SSL | CLIENT_COMPRESS | CLIENT_SSL_VERIFY_SERVER_CERT | \
-     CLIENT_ZSTD_COMPRESSION_ALGORITHM))
+     CLIENT_ZSTD_COMPRESSION_ALGORITHM | CLIENT_ZSTD_STREAM_COMPRESSION))
 
 /** The status flags are a bit-field */
 enum SERVER_STATUS_flags_enum {
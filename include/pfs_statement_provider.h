@@ -106,6 +106,12 @@ void pfs_inc_statement_sort_rows_v2(PSI_statement_locker *locker, ulong count);
 
 void pfs_inc_statement_sort_scan_v2(PSI_statement_locker *locker, ulong count);
 
+void pfs_inc_statement_storage_io_stats_v2(PSI_statement_locker *locker,
+                                           ulonglong read_requests,
+                                           ulonglong reads,
+                                           ulonglong pages_dirtied,
+                                           ulonglong bytes_read);
+
 void pfs_set_statement_no_index_used_v2(PSI_statement_locker *locker);
 
 void pfs_set_statement_no_good_index_used_v2(PSI_statement_locker *locker);
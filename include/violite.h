@@ -168,6 +168,11 @@ int vio_set_blocking_flag(Vio *vio, bool set_blocking_flag);
 size_t vio_read(MYSQL_VIO vio, uchar *buf, size_t size);
 size_t vio_read_buff(MYSQL_VIO vio, uchar *buf, size_t size);
 size_t vio_write(MYSQL_VIO vio, const uchar *buf, size_t size);
+#ifndef _WIN32
+/* Gathering write of several buffers, see vio_writev() in viosocket.cc. */
+struct iovec;
+size_t vio_writev(MYSQL_VIO vio, struct iovec *vec, int count);
+#endif
 /* setsockopt TCP_NODELAY at IPPROTO_TCP level, when possible */
 int vio_fastsend(MYSQL_VIO vio);
 /* setsockopt SO_KEEPALIVE at SOL_SOCKET level, when possible */
@@ -155,6 +155,21 @@ class Compressor : public Base_compressor_decompressor {
   */
   virtual void set_compression_level(unsigned int compression_level) = 0;
 
+  /**
+    Sets the expected total size of the data that will be compressed from
+    the moment this compressor is opened until it is closed again. It is a
+    hint that lets implementations tune themselves for the payload at hand
+    and it is only effective if set before opening the compressor. The
+    pledge is consumed when the compressor is opened, so it has to be set
+    again for every compression session. Implementations that cannot take
+    advantage of the hint shall ignore it. Pledging a size different from
+    the total number of bytes fed to the compressor may render the
+    compression session invalid.
+
+    @param input_size the total number of bytes that will be compressed.
+  */
+  virtual void set_pledged_input_size(std::size_t input_size);
+
   /**
     This member function SHALL compress the data provided with the given
     length. Note that the buffer to store the compressed data must have
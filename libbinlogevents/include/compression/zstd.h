@@ -70,6 +70,12 @@ class Zstd_comp : public Compressor {
    */
   unsigned int m_compression_level_next{DEFAULT_COMPRESSION_LEVEL};
 
+  /**
+    The total size of the data that will be compressed in the next
+    compression session. It is 0 when the size is not known.
+   */
+  std::size_t m_pledged_input_size{0};
+
  public:
   Zstd_comp();
   virtual ~Zstd_comp() override;
@@ -78,6 +84,15 @@ class Zstd_comp : public Compressor {
    */
   virtual void set_compression_level(unsigned int compression_level) override;
 
+  /**
+    Shall set the expected total size of the data that will be compressed
+    once this compressor is opened again. The pledge is consumed when the
+    compressor is opened.
+
+    @param input_size the total number of bytes that will be compressed.
+   */
+  virtual void set_pledged_input_size(std::size_t input_size) override;
+
   /**
     Shall get the compressor type code.
 
@@ -72,6 +72,10 @@ std::size_t Base_compressor_decompressor::capacity() {
   return m_buffer_capacity;
 }
 
+void Compressor::set_pledged_input_size(std::size_t) {
+  // ignored by default, implementations may use it as a tuning hint
+}
+
 bool Base_compressor_decompressor::reserve(std::size_t bytes) {
   if ((bytes + size()) >= m_buffer_capacity) {
     unsigned int needed_blocks = (bytes / BLOCK_BYTES) + 1;
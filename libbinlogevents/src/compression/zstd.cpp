@@ -60,6 +60,10 @@ void Zstd_comp::set_compression_level(unsigned int clevel) {
   }
 }
 
+void Zstd_comp::set_pledged_input_size(std::size_t input_size) {
+  m_pledged_input_size = input_size;
+}
+
 Zstd_comp::~Zstd_comp() {
   if (m_ctx != nullptr) {
     ZSTD_freeCStream(m_ctx);
@@ -73,8 +77,16 @@ type Zstd_comp::compression_type_code() { return ZSTD; }
 
 bool Zstd_comp::open() {
   size_t ret{0};
+  unsigned long long pledged_size{ZSTD_CONTENTSIZE_UNKNOWN};
   if (m_ctx == nullptr) goto err;
 
+  /*
+    The pledge is consumed by this session, whether it can be handed to
+    the library or not.
+  */
+  if (m_pledged_input_size != 0) pledged_size = m_pledged_input_size;
+  m_pledged_input_size = 0;
+
     /*
      The advanced compression API used below as declared stable in
      1.4.0 .
@@ -87,14 +99,19 @@ bool Zstd_comp::open() {
   if (m_compression_level_current == m_compression_level_next) {
     ret = ZSTD_CCtx_reset(m_ctx, ZSTD_reset_session_only);
     if (ZSTD_isError(ret)) goto err;
-
-    ret = ZSTD_CCtx_setPledgedSrcSize(m_ctx, ZSTD_CONTENTSIZE_UNKNOWN);
-    if (ZSTD_isError(ret)) goto err;
   } else {
     ret = ZSTD_initCStream(m_ctx, m_compression_level_next);
     if (ZSTD_isError(ret)) goto err;
     m_compression_level_current = m_compression_level_next;
   }
+
+  /*
+    Pledging the exact input size lets the library size its window to the
+    payload and record the content size in the frame header, which
+    improves the compression ratio of small transactions.
+  */
+  ret = ZSTD_CCtx_setPledgedSrcSize(m_ctx, pledged_size);
+  if (ZSTD_isError(ret)) goto err;
 #else
   ret = ZSTD_initCStream(m_ctx, m_compression_level_next);
   if (ZSTD_isError(ret)) goto err;
@@ -88,6 +88,10 @@ TODO:
 #include "mysys/mysys_priv.h"
 #include "thr_mutex.h"
 
+#ifdef HAVE_AIO_H
+#include <aio.h>
+#endif
+
 PSI_file_key key_file_io_cache;
 #ifndef DBUG_OFF
 bool binlog_cache_temporary_file_is_encrypted = false;
@@ -100,6 +104,113 @@ bool binlog_cache_temporary_file_is_encrypted = false;
 #define IO_ROUND_UP(X) (((X) + IO_SIZE - 1) & ~(IO_SIZE - 1))
 #define IO_ROUND_DN(X) ((X) & ~(IO_SIZE - 1))
 
+#ifdef HAVE_AIO_H
+
+/*
+  State for the asynchronous double-buffered read mode.
+
+  While the caller consumes the current read buffer, the following block
+  of the file is read into a shadow buffer of the same size by the POSIX
+  AIO implementation (worker threads or kernel driven, depending on the
+  platform). When the cache runs dry on the expected position, the
+  prefetched data is installed without waiting for the disk, so compute
+  and I/O overlap for every sequential IO_CACHE consumer: filesort spill,
+  binlog dump thread file reads, LOAD DATA and friends.
+
+  The shadow buffer is aligned to IO_SIZE so that it remains a valid read
+  target if the file was opened with O_DIRECT. The block size simply
+  follows the cache size the caller asked for, so multi-MB buffers work
+  the same way as the default 64K ones.
+*/
+struct IO_CACHE_ASYNC {
+  uchar *buffer;        /* IO_SIZE-aligned shadow buffer. */
+  uchar *allocation;    /* Underlying allocation of the shadow buffer. */
+  my_off_t pos_in_file; /* File offset of the submitted request. */
+  bool inflight;        /* true while a request is submitted. */
+  struct aiocb cb;
+};
+
+/*
+  Set up prefetching state for a READ_CACHE. Failure is not an error;
+  the cache simply stays synchronous.
+*/
+static void init_io_cache_async(IO_CACHE *info) {
+  IO_CACHE_ASYNC *async = (IO_CACHE_ASYNC *)my_malloc(
+      key_memory_IO_CACHE, sizeof(IO_CACHE_ASYNC), MYF(0));
+  if (async == nullptr) return;
+  /* Over-allocate so that the shadow buffer can be IO_SIZE-aligned. */
+  async->allocation = (uchar *)my_malloc(key_memory_IO_CACHE,
+                                         info->buffer_length + IO_SIZE, MYF(0));
+  if (async->allocation == nullptr) {
+    my_free(async);
+    return;
+  }
+  async->buffer = (uchar *)IO_ROUND_UP((intptr)async->allocation);
+  async->pos_in_file = 0;
+  async->inflight = false;
+  info->async_state = async;
+}
+
+/*
+  Submit a prefetch of the block following the current buffer contents,
+  if none is in flight and there is anything left to read. Encrypted
+  caches are skipped; the stream cipher has to see reads in file order
+  through mysql_encryption_file_read().
+*/
+static void my_b_async_submit(IO_CACHE *info) {
+  IO_CACHE_ASYNC *async = info->async_state;
+  if (async->inflight || info->type != READ_CACHE || info->file < 0 ||
+      info->m_decryptor != nullptr)
+    return;
+  const my_off_t pos =
+      info->pos_in_file + (size_t)(info->read_end - info->buffer);
+  if (pos >= info->end_of_file) return;
+  /* Read up to a full buffer, ending on an IO_SIZE boundary. */
+  size_t length = info->read_length - (size_t)(pos & (IO_SIZE - 1));
+  if (length > info->end_of_file - pos)
+    length = (size_t)(info->end_of_file - pos);
+
+  memset(&async->cb, 0, sizeof(async->cb));
+  async->cb.aio_fildes = info->file;
+  async->cb.aio_buf = async->buffer;
+  async->cb.aio_nbytes = length;
+  async->cb.aio_offset = (off_t)pos;
+  if (aio_read(&async->cb) == 0) {
+    async->pos_in_file = pos;
+    async->inflight = true;
+  }
+}
+
+/* Wait for the submitted prefetch; returns bytes read, or -1 on error. */
+static ssize_t my_b_async_wait(IO_CACHE *info) {
+  IO_CACHE_ASYNC *async = info->async_state;
+  DBUG_ASSERT(async->inflight);
+  while (aio_error(&async->cb) == EINPROGRESS) {
+    const struct aiocb *list[1] = {&async->cb};
+    aio_suspend(list, 1, nullptr);
+  }
+  async->inflight = false;
+  return aio_return(&async->cb);
+}
+
+/* Cancel (or wait out) a submitted prefetch and drop its result. */
+static void my_b_async_discard(IO_CACHE *info) {
+  IO_CACHE_ASYNC *async = info->async_state;
+  if (!async->inflight) return;
+  (void)aio_cancel(info->file, &async->cb);
+  (void)my_b_async_wait(info);
+}
+
+/* Free the prefetching state. The cache itself remains usable. */
+static void end_io_cache_async(IO_CACHE *info) {
+  my_b_async_discard(info);
+  my_free(info->async_state->allocation);
+  my_free(info->async_state);
+  info->async_state = nullptr;
+}
+
+#endif /* HAVE_AIO_H */
+
 /*
   Setup internal pointers inside IO_CACHE
 
@@ -141,7 +252,11 @@ static void init_functions(IO_CACHE *info) {
       info->write_function = nullptr; /* Force a core if used */
       break;
     default:
-      info->read_function = info->share ? _my_b_read_r : _my_b_read;
+      if (info->share)
+        info->read_function = _my_b_read_r;
+      else
+        info->read_function =
+            info->async_state != nullptr ? _my_b_async_read : _my_b_read;
       info->write_function = _my_b_write;
   }
 
@@ -193,6 +308,7 @@ int init_io_cache_ext(IO_CACHE *info, File file, size_t cachesize,
   info->arg = nullptr;
   info->alloced_buffer = false;
   info->buffer = nullptr;
+  info->async_state = nullptr;
   info->seek_not_done = false;
 
   if (file >= 0) {
@@ -292,6 +408,11 @@ int init_io_cache_ext(IO_CACHE *info, File file, size_t cachesize,
   info->end_of_file = end_of_file;
   info->error = 0;
   info->type = type;
+#ifdef HAVE_AIO_H
+  /* Best effort; on failure the cache simply stays synchronous. */
+  if (use_async_io && type == READ_CACHE && file >= 0 && info->alloced_buffer)
+    init_io_cache_async(info);
+#endif
   init_functions(info);
   return 0;
 } /* init_io_cache_ext */
@@ -336,6 +457,11 @@ bool reinit_io_cache(IO_CACHE *info, enum cache_type type, my_off_t seek_offset,
               info->type != WRITE_NET && type != SEQ_READ_APPEND &&
               info->type != SEQ_READ_APPEND);
 
+#ifdef HAVE_AIO_H
+  /* A pending prefetch may not match the new position or cache type. */
+  if (info->async_state != nullptr) my_b_async_discard(info);
+#endif
+
   /* If the whole file is in memory, avoid flushing to disk */
   if (!clear_cache && seek_offset >= info->pos_in_file &&
       seek_offset <= my_b_tell(info)) {
@@ -549,6 +675,76 @@ int _my_b_read(IO_CACHE *info, uchar *Buffer, size_t Count) {
   return 0;
 }
 
+#ifdef HAVE_AIO_H
+
+/*
+  Read buffered, overlapping disk reads with the caller's work.
+
+  SYNOPSIS
+    _my_b_async_read()
+      info                      IO_CACHE pointer
+      Buffer                    Buffer to retrieve count bytes from file
+      Count                     Number of bytes to read into Buffer
+
+  NOTE
+    Used as read_function instead of _my_b_read() when the cache was
+    initialized with use_async_io and prefetching is available. When a
+    refill is needed and the prefetched block is the one wanted, it is
+    copied in without waiting on the disk and the next block is submitted
+    right away. In all other cases (seeks, reads larger than the
+    prefetched block, encrypted files, errors) we fall back to
+    _my_b_read(), which re-reads synchronously; the prefetch is then
+    restarted from the new position.
+
+  RETURN
+    As for _my_b_read().
+*/
+
+int _my_b_async_read(IO_CACHE *info, uchar *Buffer, size_t Count) {
+  IO_CACHE_ASYNC *async = info->async_state;
+  DBUG_TRACE;
+
+  if (async->inflight) {
+    const my_off_t next_pos =
+        info->pos_in_file + (size_t)(info->read_end - info->buffer);
+    if (!info->seek_not_done && info->m_decryptor == nullptr &&
+        async->pos_in_file == next_pos) {
+      const size_t left_length = (size_t)(info->read_end - info->read_pos);
+      const ssize_t got = my_b_async_wait(info);
+      if (got > 0 && left_length + (size_t)got >= Count) {
+        DBUG_ASSERT(Count >= left_length); /* User is not using my_b_read() */
+        memcpy(Buffer, info->read_pos, left_length);
+        memcpy(info->buffer, async->buffer, got);
+        info->read_pos = info->buffer + (Count - left_length);
+        info->read_end = info->buffer + got;
+        info->pos_in_file = next_pos;
+        memcpy(Buffer + left_length, info->buffer, Count - left_length);
+        /* Overlap the read of the following block with the caller's work. */
+        my_b_async_submit(info);
+        return 0;
+      }
+      /*
+        Read error, end of file, or a request larger than the prefetched
+        block. Let the synchronous path redo the read; POSIX leaves the
+        file position unspecified after asynchronous I/O, so force a
+        seek first.
+      */
+      info->seek_not_done = true;
+    } else {
+      /* The position moved under us (seek/reinit); the prefetch is stale. */
+      my_b_async_discard(info);
+      info->seek_not_done = true;
+    }
+  }
+
+  const int res = _my_b_read(info, Buffer, Count);
+  /* Start prefetching the block after the one just read. */
+  if (res == 0) my_b_async_submit(info);
+  return res;
+}
+
+#endif /* HAVE_AIO_H */
+
 /*
   Prepare IO_CACHE for shared use.
 
@@ -628,6 +824,14 @@ void init_io_cache_share(IO_CACHE *read_cache, IO_CACHE_SHARE *cshare,
   DBUG_ASSERT(read_cache->type == READ_CACHE);
   DBUG_ASSERT(!write_cache || (write_cache->type == WRITE_CACHE));
 
+#ifdef HAVE_AIO_H
+  /*
+    Prefetching is not supported together with cache sharing. Drop the
+    state before the IO_CACHE object is copied for each thread.
+  */
+  if (read_cache->async_state != nullptr) end_io_cache_async(read_cache);
+#endif
+
   mysql_mutex_init(key_IO_CACHE_SHARE_mutex, &cshare->mutex,
                    MY_MUTEX_INIT_FAST);
   mysql_cond_init(key_IO_CACHE_SHARE_cond, &cshare->cond);
@@ -1525,6 +1729,9 @@ int end_io_cache(IO_CACHE *info) {
     (*pre_close)(info);
     info->pre_close = nullptr;
   }
+#ifdef HAVE_AIO_H
+  if (info->async_state != nullptr) end_io_cache_async(info);
+#endif
   if (info->alloced_buffer) {
     info->alloced_buffer = false;
     if (info->file != -1) /* File doesn't exist */
@@ -226,6 +226,26 @@ static void free_block(KEY_CACHE *keycache, st_keycache_thread_var *thread_var,
    (keycache->hash_entries - 1))
 #define FILE_HASH(f) ((uint)(f) & (CHANGED_BLOCKS_HASH - 1))
 
+/*
+  Caches of at least twice this size are split into up to
+  KEY_CACHE_PARTITIONS independent partitions, so that concurrent
+  readers of different index blocks do not all serialize on one global
+  cache_lock. Each partition needs a reasonable number of blocks, or
+  its LRU chain becomes too short to be useful; hence the minimum
+  partition size.
+*/
+#define KEY_CACHE_PARTITIONS 8
+#define KEY_CACHE_MIN_PARTITION_SIZE (1024 * 1024UL)
+
+/* The partition responsible for the cache block at (file, filepos). */
+static inline KEY_CACHE *key_cache_partition(KEY_CACHE *keycache, File file,
+                                             my_off_t filepos) {
+  return &keycache->partitions[((ulong)(filepos /
+                                        keycache->key_cache_block_size) +
+                                (ulong)file) %
+                               keycache->n_partitions];
+}
+
 #define BLOCK_NUMBER(b) \
   ((uint)(((char *)(b) - (char *)keycache->block_root) / sizeof(BLOCK_LINK)))
 #ifdef KEYCACHE_TIMEOUT
@@ -268,9 +288,11 @@ static inline uint next_power(uint value) {
 
 */
 
-int init_key_cache(KEY_CACHE *keycache, ulonglong key_cache_block_size,
-                   size_t use_mem, ulonglong division_limit,
-                   ulonglong age_threshold) {
+static int init_key_cache_internal(KEY_CACHE *keycache,
+                                   ulonglong key_cache_block_size,
+                                   size_t use_mem, ulonglong division_limit,
+                                   ulonglong age_threshold,
+                                   bool partitioning_allowed) {
   ulong blocks, hash_links;
   size_t length;
   int error;
@@ -282,6 +304,59 @@ int init_key_cache(KEY_CACHE *keycache, ulonglong key_cache_block_size,
     return 0;
   }
 
+  /*
+    Split a sufficiently large cache into partitions. This is decided
+    once, at the first initialization; a resize later re-initializes
+    every partition in place but keeps the layout.
+  */
+  if (partitioning_allowed && !keycache->key_cache_inited &&
+      use_mem >= 2 * KEY_CACHE_MIN_PARTITION_SIZE) {
+    const uint partitions = std::min<size_t>(
+        KEY_CACHE_PARTITIONS, use_mem / KEY_CACHE_MIN_PARTITION_SIZE);
+    KEY_CACHE *children =
+        (KEY_CACHE *)my_malloc(key_memory_KEY_CACHE,
+                               partitions * sizeof(KEY_CACHE), MYF(MY_ZEROFILL));
+    if (children) {
+      int total_blocks = 0;
+      uint i;
+      for (i = 0; i < partitions; i++) {
+        const int child_blocks = init_key_cache_internal(
+            &children[i], key_cache_block_size, use_mem / partitions,
+            division_limit, age_threshold, false);
+        if (child_blocks == 0) break;
+        total_blocks += child_blocks;
+      }
+      if (i == partitions) {
+        keycache->partitions = children;
+        keycache->n_partitions = partitions;
+        /*
+          Make the shell look like a usable cache to its callers; all
+          block operations are routed to the partitions.
+        */
+        keycache->key_cache_inited = true;
+        keycache->can_be_used = true;
+        keycache->in_resize = false;
+        keycache->resize_in_flush = false;
+        keycache->in_init = false;
+        keycache->cnt_for_resize_op = 0;
+        keycache->resize_queue.last_thread = nullptr;
+        keycache->waiting_for_resize_cnt.last_thread = nullptr;
+        mysql_mutex_init(key_KEY_CACHE_cache_lock, &keycache->cache_lock,
+                         MY_MUTEX_INIT_FAST);
+        keycache->key_cache_mem_size = use_mem;
+        keycache->key_cache_block_size = (uint)key_cache_block_size;
+        keycache->disk_blocks = total_blocks;
+        keycache->blocks = total_blocks;
+        return total_blocks;
+      }
+      /* Could not set up all partitions; fall back to a single cache. */
+      while (i-- > 0) end_key_cache(&children[i], true);
+      my_free(children);
+    }
+  }
+  keycache->partitions = nullptr;
+  keycache->n_partitions = 0;
+
   keycache->global_cache_w_requests = keycache->global_cache_r_requests = 0;
   keycache->global_cache_read = keycache->global_cache_write = 0;
   keycache->disk_blocks = -1;
@@ -415,6 +490,13 @@ err:
   return 0;
 }
 
+int init_key_cache(KEY_CACHE *keycache, ulonglong key_cache_block_size,
+                   size_t use_mem, ulonglong division_limit,
+                   ulonglong age_threshold) {
+  return init_key_cache_internal(keycache, key_cache_block_size, use_mem,
+                                 division_limit, age_threshold, true);
+}
+
 /*
   Resize a key cache
 
@@ -453,6 +535,30 @@ int resize_key_cache(KEY_CACHE *keycache, st_keycache_thread_var *thread_var,
 
   if (!keycache->key_cache_inited) return keycache->disk_blocks;
 
+  if (keycache->partitions != nullptr) {
+    /*
+      Resize every partition with its share of the memory. The
+      partition layout itself was decided at the first initialization
+      and is kept across resizes.
+    */
+    int total_blocks = 0;
+    for (uint i = 0; i < keycache->n_partitions; i++) {
+      const int part_blocks = resize_key_cache(
+          &keycache->partitions[i], thread_var, key_cache_block_size,
+          use_mem / keycache->n_partitions, division_limit, age_threshold);
+      if (part_blocks == 0) {
+        total_blocks = 0;
+        break;
+      }
+      total_blocks += part_blocks;
+    }
+    keycache->key_cache_mem_size = use_mem;
+    keycache->key_cache_block_size = (uint)key_cache_block_size;
+    keycache->disk_blocks = keycache->blocks = total_blocks;
+    keycache->can_be_used = (total_blocks != 0);
+    return total_blocks;
+  }
+
   if (key_cache_block_size == keycache->key_cache_block_size &&
       use_mem == keycache->key_cache_mem_size) {
     change_key_cache_param(keycache, division_limit, age_threshold);
@@ -521,8 +627,8 @@ int resize_key_cache(KEY_CACHE *keycache, st_keycache_thread_var *thread_var,
   */
   end_key_cache(keycache, false); /* Don't free mutex */
   /* The following will work even if use_mem is 0 */
-  blocks = init_key_cache(keycache, key_cache_block_size, use_mem,
-                          division_limit, age_threshold);
+  blocks = init_key_cache_internal(keycache, key_cache_block_size, use_mem,
+                                   division_limit, age_threshold, false);
 
 finish:
   /*
@@ -604,6 +710,21 @@ void end_key_cache(KEY_CACHE *keycache, bool cleanup) {
 
   if (!keycache->key_cache_inited) return;
 
+  if (keycache->partitions != nullptr) {
+    for (uint i = 0; i < keycache->n_partitions; i++)
+      end_key_cache(&keycache->partitions[i], cleanup);
+    keycache->blocks_used = 0;
+    keycache->blocks_unused = 0;
+    if (cleanup) {
+      my_free(keycache->partitions);
+      keycache->partitions = nullptr;
+      keycache->n_partitions = 0;
+      mysql_mutex_destroy(&keycache->cache_lock);
+      keycache->key_cache_inited = keycache->can_be_used = false;
+    }
+    return;
+  }
+
   if (keycache->disk_blocks > 0) {
     if (keycache->block_mem) {
       my_free((uchar *)keycache->block_mem);
@@ -2121,6 +2242,24 @@ uchar *key_cache_read(KEY_CACHE *keycache, st_keycache_thread_var *thread_var,
   DBUG_PRINT("enter", ("fd: %u  pos: %lu  length: %u", (uint)file,
                        (ulong)filepos, length));
 
+  if (keycache->partitions != nullptr) {
+    /* Route each cache-block-sized chunk of the request to its partition. */
+    while (length > 0) {
+      const uint chunk_offset =
+          (uint)(filepos % keycache->key_cache_block_size);
+      const uint chunk =
+          std::min(length, keycache->key_cache_block_size - chunk_offset);
+      if (key_cache_read(key_cache_partition(keycache, file, filepos),
+                         thread_var, file, filepos, level, buff, chunk,
+                         block_length, 0) == nullptr)
+        return (uchar *)0;
+      filepos += chunk;
+      buff += chunk;
+      length -= chunk;
+    }
+    return start;
+  }
+
   if (keycache->key_cache_inited) {
     /* Key cache is used */
     BLOCK_LINK *block;
@@ -2305,6 +2444,23 @@ int key_cache_insert(KEY_CACHE *keycache, st_keycache_thread_var *thread_var,
   DBUG_PRINT("enter", ("fd: %u  pos: %lu  length: %u", (uint)file,
                        (ulong)filepos, length));
 
+  if (keycache->partitions != nullptr) {
+    /* Route each cache-block-sized chunk to its partition. */
+    while (length > 0) {
+      const uint chunk_offset =
+          (uint)(filepos % keycache->key_cache_block_size);
+      const uint chunk =
+          std::min(length, keycache->key_cache_block_size - chunk_offset);
+      if (key_cache_insert(key_cache_partition(keycache, file, filepos),
+                           thread_var, file, filepos, level, buff, chunk))
+        return 1;
+      filepos += chunk;
+      buff += chunk;
+      length -= chunk;
+    }
+    return 0;
+  }
+
   if (keycache->key_cache_inited) {
     /* Key cache is used */
     BLOCK_LINK *block;
@@ -2536,6 +2692,24 @@ int key_cache_write(KEY_CACHE *keycache, st_keycache_thread_var *thread_var,
                        (uint)file, (ulong)filepos, length, block_length,
                        keycache ? keycache->key_cache_block_size : 0));
 
+  if (keycache->partitions != nullptr) {
+    /* Route each cache-block-sized chunk to its partition. */
+    while (length > 0) {
+      const uint chunk_offset =
+          (uint)(filepos % keycache->key_cache_block_size);
+      const uint chunk =
+          std::min(length, keycache->key_cache_block_size - chunk_offset);
+      if (key_cache_write(key_cache_partition(keycache, file, filepos),
+                          thread_var, file, filepos, level, buff, chunk,
+                          block_length, dont_write))
+        return 1;
+      filepos += chunk;
+      buff += chunk;
+      length -= chunk;
+    }
+    return 0;
+  }
+
   if (!dont_write) {
     /* purecov: begin inspected */
     /* Not used in the server. */
@@ -3451,6 +3625,16 @@ int flush_key_blocks(KEY_CACHE *keycache, st_keycache_thread_var *thread_var,
 
   if (!keycache->key_cache_inited) return 0;
 
+  if (keycache->partitions != nullptr) {
+    int last_err = 0;
+    for (uint i = 0; i < keycache->n_partitions; i++) {
+      const int err =
+          flush_key_blocks(&keycache->partitions[i], thread_var, file, type);
+      if (err) last_err = err;
+    }
+    return last_err;
+  }
+
   mysql_mutex_lock(&keycache->cache_lock);
   /* While waiting for lock, keycache could have been ended. */
   if (keycache->disk_blocks > 0) {
@@ -3613,6 +3797,11 @@ int reset_key_cache_counters(const char *name MY_ATTRIBUTE((unused)),
   }
   DBUG_PRINT("info", ("Resetting counters for key cache %s.", name));
 
+  if (key_cache->partitions != nullptr) {
+    for (uint i = 0; i < key_cache->n_partitions; i++)
+      reset_key_cache_counters(name, &key_cache->partitions[i]);
+  }
+
   key_cache->global_blocks_changed = 0;   /* Key_blocks_not_flushed */
   key_cache->global_cache_r_requests = 0; /* Key_read_requests */
   key_cache->global_cache_read = 0;       /* Key_reads */
@@ -3621,6 +3810,38 @@ int reset_key_cache_counters(const char *name MY_ATTRIBUTE((unused)),
   return 0;
 }
 
+/*
+  Refresh the statistics fields of a partitioned cache by summing over
+  its partitions. Call before exposing the fields (SHOW STATUS); an
+  unpartitioned cache maintains them directly and needs no refresh.
+  The reads are intentionally unlocked, as for all key cache statistics.
+*/
+
+void key_cache_sum_partition_stats(KEY_CACHE *key_cache) {
+  if (key_cache->partitions == nullptr) return;
+
+  ulong blocks_used = 0, blocks_unused = 0, global_blocks_changed = 0;
+  ulonglong cache_w_requests = 0, cache_write = 0;
+  ulonglong cache_r_requests = 0, cache_read = 0;
+  for (uint i = 0; i < key_cache->n_partitions; i++) {
+    const KEY_CACHE *partition = &key_cache->partitions[i];
+    blocks_used += partition->blocks_used;
+    blocks_unused += partition->blocks_unused;
+    global_blocks_changed += partition->global_blocks_changed;
+    cache_w_requests += partition->global_cache_w_requests;
+    cache_write += partition->global_cache_write;
+    cache_r_requests += partition->global_cache_r_requests;
+    cache_read += partition->global_cache_read;
+  }
+  key_cache->blocks_used = blocks_used;
+  key_cache->blocks_unused = blocks_unused;
+  key_cache->global_blocks_changed = global_blocks_changed;
+  key_cache->global_cache_w_requests = cache_w_requests;
+  key_cache->global_cache_write = cache_write;
+  key_cache->global_cache_r_requests = cache_r_requests;
+  key_cache->global_cache_read = cache_read;
+}
+
 #if !defined(DBUG_OFF)
 #define F_B_PRT(_f_, _v_) DBUG_PRINT("assert_fail", (_f_, _v_))
 
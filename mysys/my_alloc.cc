@@ -53,6 +53,73 @@
 #define MEM_ROOT_SINGLE_CHUNKS 0
 #endif
 
+namespace {
+
+/**
+  A small per-thread cache of freed MEM_ROOT blocks, so that the typical
+  statement arena can be set up and torn down without calling malloc() or
+  free() at all in steady state. Each thread keeps a few blocks in a handful
+  of size classes; block allocations that fit a size class are rounded up
+  to it, so that the block can be recycled on free. Blocks that are larger
+  than the largest size class (or arrive when the bin is already full) are
+  freed to the system as before.
+
+  The cache is keyed on the thread, which in the server means per-THD for
+  regular one-thread-per-connection threads. While a block sits in the
+  cache, it stays attributed in the performance schema to the memory key
+  it was originally allocated with.
+*/
+constexpr int kNumCacheBins = 4;
+constexpr size_t kCacheBinSize[kNumCacheBins] = {1024, 8192, 32768, 131072};
+constexpr int kMaxBlocksPerBin = 8;
+
+struct BlockCache {
+  void *blocks[kNumCacheBins][kMaxBlocksPerBin];
+  int num_blocks[kNumCacheBins];
+};
+thread_local BlockCache block_cache{};
+
+/// Return the smallest size class that fits “length”, or -1 if none does.
+int CacheBinForLength(size_t length) {
+  for (int bin = 0; bin < kNumCacheBins; ++bin) {
+    if (length <= kCacheBinSize[bin]) return bin;
+  }
+  return -1;
+}
+
+}  // namespace
+
+MEM_ROOT::Block *MEM_ROOT::PopCachedBlock(size_t *length) {
+  if (MEM_ROOT_SINGLE_CHUNKS) return nullptr;
+  const int bin = CacheBinForLength(*length);
+  if (bin == -1) return nullptr;
+
+  // Round up to the size class even on a cache miss, so that the block we
+  // allocate instead can be recycled through the cache when it is freed.
+  *length = kCacheBinSize[bin];
+  if (block_cache.num_blocks[bin] == 0) return nullptr;
+  return static_cast<Block *>(
+      block_cache.blocks[bin][--block_cache.num_blocks[bin]]);
+}
+
+bool MEM_ROOT::PushCachedBlock(Block *block) {
+  if (MEM_ROOT_SINGLE_CHUNKS) return false;
+  const int bin = CacheBinForLength(block->size);
+  if (bin == -1 || block->size != kCacheBinSize[bin] ||
+      block_cache.num_blocks[bin] == kMaxBlocksPerBin)
+    return false;
+  block_cache.blocks[bin][block_cache.num_blocks[bin]++] = block;
+  return true;
+}
+
+void MEM_ROOT::ClearBlockCache() {
+  for (int bin = 0; bin < kNumCacheBins; ++bin) {
+    while (block_cache.num_blocks[bin] > 0) {
+      my_free(block_cache.blocks[bin][--block_cache.num_blocks[bin]]);
+    }
+  }
+}
+
 MEM_ROOT::Block *MEM_ROOT::AllocBlock(size_t length) {
   DBUG_TRACE;
 
@@ -67,12 +134,16 @@ MEM_ROOT::Block *MEM_ROOT::AllocBlock(size_t length) {
     }
   }
 
-  Block *new_block = static_cast<Block *>(
-      my_malloc(m_psi_key, length + ALIGN_SIZE(sizeof(Block)),
-                MYF(MY_WME | ME_FATALERROR)));
+  Block *new_block = PopCachedBlock(&length);  // May round up “length”.
   if (new_block == nullptr) {
-    if (m_error_handler) (m_error_handler)();
-    return nullptr;
+    new_block = static_cast<Block *>(
+        my_malloc(m_psi_key, length + ALIGN_SIZE(sizeof(Block)),
+                  MYF(MY_WME | ME_FATALERROR)));
+    if (new_block == nullptr) {
+      if (m_error_handler) (m_error_handler)();
+      return nullptr;
+    }
+    new_block->size = length;
   }
 
   m_allocated_size += length;
@@ -119,8 +190,7 @@ void *MEM_ROOT::AllocSlow(size_t length) {
   } else {
     // The normal case: Throw away the current block, allocate a new block,
     // and use that to satisfy the new allocation.
-    const size_t new_block_size = m_block_size;
-    Block *new_block = AllocBlock(new_block_size);  // Will modify block_size.
+    Block *new_block = AllocBlock(m_block_size);  // Will modify m_block_size.
     if (new_block == nullptr) return nullptr;
 
     new_block->prev = m_current_block;
@@ -129,7 +199,9 @@ void *MEM_ROOT::AllocSlow(size_t length) {
     char *new_mem =
         pointer_cast<char *>(new_block) + ALIGN_SIZE(sizeof(*new_block));
     m_current_free_start = new_mem + length;
-    m_current_free_end = new_mem + new_block_size;
+    // Use the actual block size, which may have been rounded up to a size
+    // class in AllocBlock(), rather than the size we asked for.
+    m_current_free_end = new_mem + new_block->size;
     return new_mem;
   }
 }
@@ -178,7 +250,7 @@ void MEM_ROOT::FreeBlocks(Block *start) {
   // touch it after we've started freeing.
   for (Block *block = start; block != nullptr;) {
     Block *prev = block->prev;
-    my_free(block);
+    if (!PushCachedBlock(block)) my_free(block);
     block = prev;
   }
 }
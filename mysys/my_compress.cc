@@ -61,11 +61,18 @@ void mysql_compress_context_init(mysql_compress_context *cmp_ctx,
   cmp_ctx->algorithm = algorithm;
   if (algorithm == enum_compression_algorithm::MYSQL_ZLIB)
     cmp_ctx->u.zlib_ctx.compression_level = compression_level;
-  else if (algorithm == enum_compression_algorithm::MYSQL_ZSTD) {
+  else if (algorithm == enum_compression_algorithm::MYSQL_ZSTD ||
+           algorithm == enum_compression_algorithm::MYSQL_ZSTD_STREAM) {
     cmp_ctx->u.zstd_ctx.compression_level = compression_level;
     // This is set after connect phase during first network i/o.
     cmp_ctx->u.zstd_ctx.cctx = nullptr;
     cmp_ctx->u.zstd_ctx.dctx = nullptr;
+    /*
+      Streaming is directional: each endpoint enables it only for the
+      direction it negotiated, after this call.
+    */
+    cmp_ctx->u.zstd_ctx.stream_compress = false;
+    cmp_ctx->u.zstd_ctx.stream_decompress = false;
   }
 }
 
@@ -76,7 +83,9 @@ void mysql_compress_context_init(mysql_compress_context *cmp_ctx,
 */
 
 void mysql_compress_context_deinit(mysql_compress_context *mysql_compress_ctx) {
-  if (mysql_compress_ctx->algorithm == enum_compression_algorithm::MYSQL_ZSTD) {
+  if (mysql_compress_ctx->algorithm == enum_compression_algorithm::MYSQL_ZSTD ||
+      mysql_compress_ctx->algorithm ==
+          enum_compression_algorithm::MYSQL_ZSTD_STREAM) {
     if (mysql_compress_ctx->u.zstd_ctx.cctx != nullptr) {
       ZSTD_freeCCtx(mysql_compress_ctx->u.zstd_ctx.cctx);
       mysql_compress_ctx->u.zstd_ctx.cctx = nullptr;
@@ -184,6 +193,154 @@ static bool zstd_uncompress(mysql_zstd_compress_context *comp_ctx,
   return false;
 }
 
+/**
+  Compress a packet as the next chunk of one continuous zstd stream, so that
+  the compressor history carries over from earlier packets on the connection.
+  The stream is flushed after every packet so that the peer can always decode
+  a complete packet without waiting for more data.
+
+  Unlike the per-packet compressors there is no fall back to sending the
+  packet uncompressed when the output is not smaller: once the data has been
+  fed to the stream the peer must see the produced bytes, or the two stream
+  states diverge. The caller must therefore size the destination buffer with
+  my_compress_bound().
+
+  @param comp_ctx Compression context info relating to zstd.
+  @param packet   Data to compress. This is is replaced with the compressed
+  data.
+  @param len      Length of data to compress at 'packet'
+  @param complen  out: 0 if packet was not compressed
+
+  @return nullptr if error (len is not changed) else pointer to buffer.
+  size of compressed packet).
+*/
+
+static uchar *zstd_stream_compress_alloc(mysql_zstd_compress_context *comp_ctx,
+                                         const uchar *packet, size_t *len,
+                                         size_t *complen) {
+  if (comp_ctx->cctx == nullptr) {
+    if (!(comp_ctx->cctx = ZSTD_createCCtx())) {
+      return nullptr;
+    }
+#if ZSTD_VERSION_NUMBER < 10400
+    ZSTD_initCStream(comp_ctx->cctx, comp_ctx->compression_level);
+#else
+    ZSTD_CCtx_setParameter(comp_ctx->cctx, ZSTD_c_compressionLevel,
+                           comp_ctx->compression_level);
+#endif
+  }
+
+  size_t zstd_len = ZSTD_compressBound(*len);
+  void *compbuf;
+  size_t zstd_res = 0;
+
+  /*
+    Nothing has been fed to the stream yet, so failing here and letting the
+    caller send the packet uncompressed is still safe.
+  */
+  if (!(compbuf = my_malloc(key_memory_my_compress_alloc, zstd_len,
+                            MYF(MY_WME)))) {
+    return nullptr;
+  }
+
+  ZSTD_inBuffer in_buf = {packet, *len, 0};
+  ZSTD_outBuffer out_buf = {compbuf, zstd_len, 0};
+
+#if ZSTD_VERSION_NUMBER < 10400
+  while (in_buf.pos < in_buf.size) {
+    zstd_res = ZSTD_compressStream(comp_ctx->cctx, &out_buf, &in_buf);
+    if (ZSTD_isError(zstd_res)) goto error;
+  }
+  do {
+    zstd_res = ZSTD_flushStream(comp_ctx->cctx, &out_buf);
+    if (ZSTD_isError(zstd_res)) goto error;
+  } while (zstd_res > 0);
+#else
+  do {
+    zstd_res =
+        ZSTD_compressStream2(comp_ctx->cctx, &out_buf, &in_buf, ZSTD_e_flush);
+    if (ZSTD_isError(zstd_res)) goto error;
+  } while (in_buf.pos < in_buf.size || zstd_res > 0);
+#endif
+
+  *complen = *len;
+  *len = out_buf.pos;
+  return (uchar *)compbuf;
+
+error:
+  /*
+    Cannot happen with an output buffer of ZSTD_compressBound() bytes. If it
+    ever does, the compressor history no longer matches what the peer has
+    decoded and the connection is beyond repair; the resulting uncompressed
+    fall back will make the peer fail the stream and drop the connection.
+  */
+  DBUG_PRINT("error", ("Can't stream compress zstd packet, error: %zd, %s",
+                       zstd_res, ZSTD_getErrorName(zstd_res)));
+  my_free(compbuf);
+  return nullptr; /* purecov: inspected */
+}
+
+/**
+  Uncompress the next chunk of a continuous zstd stream. The decompressor
+  history is kept in the context and carries over from earlier packets on the
+  connection.
+
+  @param comp_ctx         Pointer to compression context.
+  @param packet           Packet with zstd compressed data.
+  @param len              Length of zstd compressed packet.
+  @param complen [out]    Length of uncompressed packet.
+
+  @return true on error else false.
+*/
+
+static bool zstd_stream_uncompress(mysql_zstd_compress_context *comp_ctx,
+                                   uchar *packet, size_t len, size_t *complen) {
+  DBUG_ASSERT(comp_ctx != nullptr);
+  void *compbuf;
+
+  if (comp_ctx->dctx == nullptr) {
+    if (!(comp_ctx->dctx = ZSTD_createDCtx())) {
+      return true;
+    }
+#if ZSTD_VERSION_NUMBER < 10400
+    ZSTD_initDStream(comp_ctx->dctx);
+#endif
+  }
+
+  if (!(compbuf = my_malloc(key_memory_my_compress_alloc, *complen,
+                            MYF(MY_WME)))) {
+    return true;
+  }
+
+  ZSTD_inBuffer in_buf = {packet, len, 0};
+  ZSTD_outBuffer out_buf = {compbuf, *complen, 0};
+
+  while (in_buf.pos < in_buf.size) {
+    size_t last_in_pos = in_buf.pos;
+    size_t last_out_pos = out_buf.pos;
+    size_t zstd_res = ZSTD_decompressStream(comp_ctx->dctx, &out_buf, &in_buf);
+    if (ZSTD_isError(zstd_res) ||
+        (in_buf.pos == last_in_pos && out_buf.pos == last_out_pos)) {
+      DBUG_PRINT("error", ("Can't uncompress zstd stream packet, error: %zd, %s",
+                           zstd_res, ZSTD_getErrorName(zstd_res)));
+      my_free(compbuf);
+      return true;
+    }
+  }
+
+  /* The sender flushes after every packet, so the packet must be complete. */
+  if (out_buf.pos != *complen) {
+    DBUG_PRINT("error", ("Truncated zstd stream packet: %zu of %zu bytes",
+                         out_buf.pos, *complen));
+    my_free(compbuf);
+    return true;
+  }
+
+  memcpy(packet, compbuf, *complen);
+  my_free(compbuf);
+  return false;
+}
+
 /**
   Allocate zlib compression contexts if necessary and compress using zlib the
   buffer.
@@ -280,7 +437,15 @@ static bool zlib_uncompress(uchar *packet, size_t len, size_t *complen) {
 bool my_compress(mysql_compress_context *comp_ctx, uchar *packet, size_t *len,
                  size_t *complen) {
   DBUG_ENTER("my_compress");
-  if (*len < MIN_COMPRESS_LENGTH) {
+  /*
+    When compressing as a continuous stream, short packets are fed to the
+    compressor as well: they are the packets which gain the most from the
+    history of earlier packets, and skipping them would starve that history.
+  */
+  bool stream_compress =
+      comp_ctx->algorithm == enum_compression_algorithm::MYSQL_ZSTD_STREAM &&
+      comp_ctx->u.zstd_ctx.stream_compress;
+  if (*len < MIN_COMPRESS_LENGTH && !stream_compress) {
     *complen = 0;
     DBUG_PRINT("note", ("Packet too short: Not compressed"));
   } else {
@@ -297,6 +462,17 @@ uchar *my_compress_alloc(mysql_compress_context *comp_ctx, const uchar *packet,
   if (comp_ctx->algorithm == enum_compression_algorithm::MYSQL_ZSTD)
     return zstd_compress_alloc(&comp_ctx->u.zstd_ctx, packet, len, complen);
 
+  if (comp_ctx->algorithm == enum_compression_algorithm::MYSQL_ZSTD_STREAM) {
+    /*
+      Only the direction which negotiated streaming carries history; the
+      other direction keeps the per-packet zstd frames.
+    */
+    if (comp_ctx->u.zstd_ctx.stream_compress)
+      return zstd_stream_compress_alloc(&comp_ctx->u.zstd_ctx, packet, len,
+                                        complen);
+    return zstd_compress_alloc(&comp_ctx->u.zstd_ctx, packet, len, complen);
+  }
+
   if (comp_ctx->algorithm == enum_compression_algorithm::MYSQL_UNCOMPRESSED) {
     // If compression algorithm is set to none do not compress, even if compress
     // flag was set.
@@ -308,6 +484,29 @@ uchar *my_compress_alloc(mysql_compress_context *comp_ctx, const uchar *packet,
   return zlib_compress_alloc(&comp_ctx->u.zlib_ctx, packet, len, complen);
 }
 
+/**
+  Worst case size of a packet of 'len' bytes after my_compress().
+
+  The per-packet algorithms fall back to sending the packet uncompressed
+  whenever compression does not shrink it, so their output never exceeds the
+  input and 0 is returned. Stream compression cannot fall back (the peer must
+  see every byte fed to the stream) and may expand incompressible data by the
+  zstd block and flush overhead.
+
+  @param comp_ctx  Pointer to compression context.
+  @param len       Length of the uncompressed packet.
+
+  @return 0 if the compressed packet never exceeds 'len', otherwise the
+          worst case compressed size.
+*/
+
+size_t my_compress_bound(mysql_compress_context *comp_ctx, size_t len) {
+  if (comp_ctx->algorithm == enum_compression_algorithm::MYSQL_ZSTD_STREAM &&
+      comp_ctx->u.zstd_ctx.stream_compress)
+    return ZSTD_compressBound(len);
+  return 0;
+}
+
 /**
   Uncompress packet
 
@@ -330,7 +529,13 @@ bool my_uncompress(mysql_compress_context *comp_ctx, uchar *packet, size_t len,
   {
     if (comp_ctx->algorithm == enum_compression_algorithm::MYSQL_ZSTD)
       DBUG_RETURN(zstd_uncompress(&comp_ctx->u.zstd_ctx, packet, len, complen));
-    else if (comp_ctx->algorithm == enum_compression_algorithm::MYSQL_ZLIB)
+    else if (comp_ctx->algorithm ==
+             enum_compression_algorithm::MYSQL_ZSTD_STREAM) {
+      if (comp_ctx->u.zstd_ctx.stream_decompress)
+        DBUG_RETURN(zstd_stream_uncompress(&comp_ctx->u.zstd_ctx, packet, len,
+                                           complen));
+      DBUG_RETURN(zstd_uncompress(&comp_ctx->u.zstd_ctx, packet, len, complen));
+    } else if (comp_ctx->algorithm == enum_compression_algorithm::MYSQL_ZLIB)
       DBUG_RETURN(zlib_uncompress(packet, len, complen));
   }
 
@@ -354,6 +559,7 @@ unsigned int mysql_default_compression_level(
     case MYSQL_ZLIB:
       return 6;
     case MYSQL_ZSTD:
+    case MYSQL_ZSTD_STREAM:
       return 3;
     default:
       DBUG_ASSERT(0);  // should not reach here.
@@ -33,17 +33,46 @@
 
 #include "sha2.h"
 
+namespace {
+
+/**
+  Reusable per-thread digest context.
+
+  EVP_MD_CTX_create() allocates the context from the heap, and for short
+  inputs (e.g. the statement digests hashed for every query) creating and
+  destroying a context costs more than the hashing itself. Each thread
+  therefore keeps one lazily created context which is reset with
+  EVP_DigestInit_ex() on every use, and destroyed at thread exit.
+*/
+class Evp_md_ctx_holder {
+ public:
+  ~Evp_md_ctx_holder() {
+    if (m_ctx != nullptr) EVP_MD_CTX_destroy(m_ctx);
+  }
+
+  EVP_MD_CTX *get() {
+    if (m_ctx == nullptr) m_ctx = EVP_MD_CTX_create();
+    return m_ctx;
+  }
+
+ private:
+  EVP_MD_CTX *m_ctx{nullptr};
+};
+
+thread_local Evp_md_ctx_holder evp_md_ctx_holder;
+
+}  // namespace
+
 /*  Low level digest API's are not allowed to access when FIPS mode is ON. This
  * wrapper will allow to call different sha256 methods directly.*/
 #define GEN_OPENSSL_EVP_SHA2_BRIDGE(size)                          \
   unsigned char *SHA_EVP##size(const unsigned char *input_ptr,     \
                                size_t input_length,                \
                                char unsigned *output_ptr) {        \
-    EVP_MD_CTX *md_ctx = EVP_MD_CTX_create();                      \
+    EVP_MD_CTX *md_ctx = evp_md_ctx_holder.get();                  \
     EVP_DigestInit_ex(md_ctx, EVP_sha##size(), NULL);              \
     EVP_DigestUpdate(md_ctx, input_ptr, input_length);             \
     EVP_DigestFinal_ex(md_ctx, (unsigned char *)output_ptr, NULL); \
-    EVP_MD_CTX_destroy(md_ctx);                                    \
     return (output_ptr);                                           \
   }
 
@@ -38,6 +38,7 @@
 #endif
 #include <time.h>
 
+#include "my_alloc.h"
 #include "my_dbug.h"
 #include "my_inttypes.h"
 #include "my_loglevel.h"
@@ -305,6 +306,9 @@ extern "C" void my_thread_end() {
   struct st_my_thread_var *tmp = mysys_thread_var();
 #endif
 
+  /* Release any MEM_ROOT blocks cached for reuse by this thread. */
+  MEM_ROOT::ClearBlockCache();
+
 #ifdef HAVE_PSI_THREAD_INTERFACE
   /*
     Remove the instrumentation for this thread.
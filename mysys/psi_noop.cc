@@ -753,6 +753,14 @@ static void drop_sp_noop(uint, const char *, uint, const char *, uint) {
   return;
 }
 
+static void inc_statement_storage_io_stats_noop(PSI_statement_locker *,
+                                                unsigned long long,
+                                                unsigned long long,
+                                                unsigned long long,
+                                                unsigned long long) {
+  return;
+}
+
 static PSI_statement_service_t psi_statement_noop = {
     register_statement_noop,
     get_thread_statement_locker_noop,
@@ -788,7 +796,8 @@ static PSI_statement_service_t psi_statement_noop = {
     release_sp_share_noop,
     start_sp_noop,
     end_sp_noop,
-    drop_sp_noop};
+    drop_sp_noop,
+    inc_statement_storage_io_stats_noop};
 
 struct PSI_statement_bootstrap *psi_statement_hook = nullptr;
 PSI_statement_service_t *psi_statement_service = &psi_statement_noop;
@@ -709,6 +709,16 @@ int Client::clone() {
   do {
     ++restart_count;
 
+    /* Pause before re-attempting after a network failure. Re-connect
+    failures already sleep within connect_remote() but a flaky link can
+    accept the connection and drop it again during data transfer. Without
+    a delay here such errors would burn through the restart budget
+    back-to-back instead of riding out the outage. */
+    if (restart) {
+      DBUG_ASSERT(is_master());
+      my_sleep(CLONE_CONN_REATTEMPT_INTERVAL);
+    }
+
     err = connect_remote(restart, false);
     log_error(get_thd(), true, err, "Task Connect");
 
@@ -1894,6 +1894,12 @@ static int proposer_task(task_arg arg) {
         IFDBG(D_NONE, FN; PTREXP(ep->client_msg->p->a); STRLIT("extracted ");
               SYCEXP(ep->client_msg->p->a->app_key));
       }
+      /* Track batching effectiveness */
+      prop_batch_count++;
+      prop_batch_payloads += ep->nr_batched_app_data;
+      prop_batch_bytes += ep->size;
+      if (ep->nr_batched_app_data > prop_max_batch_payload)
+        prop_max_batch_payload = ep->nr_batched_app_data;
     }
 
     ep->start_propose = task_now();
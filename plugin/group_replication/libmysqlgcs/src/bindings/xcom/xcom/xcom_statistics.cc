@@ -46,6 +46,11 @@ uint64_t receive_count[LAST_OP];
 uint64_t send_bytes[LAST_OP];
 uint64_t receive_bytes[LAST_OP];
 
+uint64_t prop_batch_count;
+uint64_t prop_batch_payloads;
+uint64_t prop_batch_bytes;
+uint64_t prop_max_batch_payload;
+
 static double median_filter[M_F_SZ];
 static int filter_index = 0;
 
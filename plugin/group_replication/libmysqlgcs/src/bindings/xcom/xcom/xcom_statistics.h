@@ -33,6 +33,12 @@ extern uint64_t receive_count[LAST_OP];
 extern uint64_t send_bytes[LAST_OP];
 extern uint64_t receive_bytes[LAST_OP];
 
+/* Proposal batching counters, updated by the proposer task */
+extern uint64_t prop_batch_count;       /* Number of batched proposals */
+extern uint64_t prop_batch_payloads;    /* Payloads sent in batches */
+extern uint64_t prop_batch_bytes;       /* Bytes sent in batches */
+extern uint64_t prop_max_batch_payload; /* Largest batch, in payloads */
+
 double median_time();
 void add_to_filter(double t);
 void median_filter_init();
@@ -1121,11 +1121,30 @@ void Certifier::garbage_collect() {
     precedes them), then "t" is stable and can be removed from
     the certification info.
   */
+  /*
+    All write set items of a transaction share one snapshot version
+    object, so evaluate each distinct snapshot version against the
+    stable set only once and reuse the verdict for the remaining items.
+    This bounds the expensive GTID set comparisons by the number of
+    still referenced transactions instead of the number of items,
+    shortening the time the certification info is kept locked.
+  */
+  std::unordered_map<Gtid_set_ref *, bool> stable_snapshot_versions;
   Certification_info::iterator it = certification_info.begin();
   stable_gtid_set_lock->wrlock();
   while (it != certification_info.end()) {
-    if (it->second->is_subset_not_equals(stable_gtid_set)) {
-      if (it->second->unlink() == 0) delete it->second;
+    Gtid_set_ref *snapshot_version = it->second;
+    bool is_stable;
+    auto cached = stable_snapshot_versions.find(snapshot_version);
+    if (cached != stable_snapshot_versions.end())
+      is_stable = cached->second;
+    else {
+      is_stable = snapshot_version->is_subset_not_equals(stable_gtid_set);
+      stable_snapshot_versions.insert(
+          std::make_pair(snapshot_version, is_stable));
+    }
+    if (is_stable) {
+      if (snapshot_version->unlink() == 0) delete snapshot_version;
       certification_info.erase(it++);
     } else
       ++it;
@@ -247,13 +247,30 @@ TranxNode *ActiveTranx::find_active_tranx_node(const char *log_file_name,
   const char *kWho = "ActiveTranx::find_active_tranx_node";
   function_enter(kWho);
 
-  TranxNode *entry = trx_front_;
+  TranxNode *entry;
 
-  while (entry) {
-    if (ActiveTranx::compare(log_file_name, log_file_pos, entry->log_name_,
-                             entry->log_pos_) <= 0)
-      break;
-    entry = entry->next_;
+  /* The committing session looks up the node of its own transaction, so
+   * probe the hash table for an exact match first to avoid scanning the
+   * whole list of active transactions.
+   */
+  unsigned int hash_val = get_hash_value(log_file_name, log_file_pos);
+  entry = trx_htb_[hash_val];
+  while (entry != nullptr) {
+    if (compare(entry, log_file_name, log_file_pos) == 0) break;
+    entry = entry->hash_next_;
+  }
+
+  if (entry == nullptr) {
+    /* Not an active transaction's ending position: fall back to scanning
+     * for the first node at or after the given position.
+     */
+    entry = trx_front_;
+    while (entry) {
+      if (ActiveTranx::compare(log_file_name, log_file_pos, entry->log_name_,
+                               entry->log_pos_) <= 0)
+        break;
+      entry = entry->next_;
+    }
   }
   function_exit(kWho, 0);
   return entry;
@@ -647,6 +664,26 @@ int ReplSemiSyncMaster::commitTrx(const char *trx_wait_binlog_name,
   /* Acquire the mutex. */
   lock();
 
+  /* Fast path: if the slave already acknowledged a position at or beyond
+   * this transaction, there is nothing to wait for.  Skip the transaction
+   * node lookup and the enter/exit of the wait stage, and only remove the
+   * acknowledged, waiter-free nodes from the active transaction list.
+   */
+  if (getMasterEnabled() && trx_wait_binlog_name && is_on() &&
+      reply_file_name_inited_ &&
+      ActiveTranx::compare(reply_file_name_, reply_file_pos_,
+                           trx_wait_binlog_name, trx_wait_binlog_pos) >= 0) {
+    if (trace_level_ & kTraceDetail)
+      LogErr(INFORMATION_LEVEL, ER_SEMISYNC_BINLOG_REPLY_IS_AHEAD, kWho,
+             reply_file_name_, (unsigned long)reply_file_pos_);
+    rpl_semi_sync_master_yes_transactions++;
+    if (active_tranxs_ != nullptr)
+      active_tranxs_->clear_active_tranx_nodes(trx_wait_binlog_name,
+                                               trx_wait_binlog_pos);
+    unlock();
+    return function_exit(kWho, 0);
+  }
+
   TranxNode *entry = nullptr;
   mysql_cond_t *thd_cond = nullptr;
   bool is_semi_sync_trans = true;
@@ -306,7 +306,8 @@ void Ack_receiver::run() {
         server_extension->compress_ctx = slave_obj.compress_ctx;
         net.compress =
             (server_extension->compress_ctx.algorithm == MYSQL_ZLIB) ||
-            (server_extension->compress_ctx.algorithm == MYSQL_ZSTD);
+            (server_extension->compress_ctx.algorithm == MYSQL_ZSTD) ||
+            (server_extension->compress_ctx.algorithm == MYSQL_ZSTD_STREAM);
 
         do {
           net_clear(&net, false);
@@ -0,0 +1,552 @@
+/* Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+#include "plugin/thread_pool/thread_pool.h"
+
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <new>
+
+#include "my_dbug.h"
+#include "my_psi_config.h"
+#include "my_sys.h"
+#include "my_thread.h"
+#include "mysql/psi/mysql_cond.h"
+#include "mysql/psi/mysql_mutex.h"
+#include "mysql/psi/mysql_socket.h"
+#include "mysql/psi/mysql_thread.h"
+#include "mysql/thread_pool_priv.h"
+#include "mysqld_error.h"  // ER_*
+#include "pfs_thread_provider.h"
+#include "sql/mysqld.h"              // key_thread_one_connection
+#include "sql/mysqld_thd_manager.h"  // Global_THD_manager
+#include "sql/protocol_classic.h"
+#include "sql/sql_class.h"             // THD
+#include "sql/sql_thd_internal_api.h"  // thd_set_thread_stack
+
+Thread_pool *Thread_pool::m_instance = nullptr;
+
+/** True in threads running Thread_pool::worker_main(). */
+static thread_local bool tp_worker_thread = false;
+/** Base of the worker's stack, for the stack overrun checks of the THD. */
+static thread_local char *tp_worker_stack_base = nullptr;
+/** Nesting depth of thd_wait_begin()/thd_wait_end() on this worker. */
+static thread_local int tp_worker_wait_depth = 0;
+
+#ifdef HAVE_PSI_INTERFACE
+static PSI_mutex_key key_LOCK_thread_pool;
+
+static PSI_mutex_info all_thread_pool_mutexes[] = {
+    {&key_LOCK_thread_pool, "LOCK_thread_pool", PSI_FLAG_SINGLETON, 0,
+     PSI_DOCUMENT_ME}};
+
+static PSI_cond_key key_COND_thread_pool;
+
+static PSI_cond_info all_thread_pool_conds[] = {
+    {&key_COND_thread_pool, "COND_thread_pool", PSI_FLAG_SINGLETON, 0,
+     PSI_DOCUMENT_ME}};
+
+static PSI_thread_key key_thread_pool_worker;
+
+static PSI_thread_info all_thread_pool_threads[] = {
+    {&key_thread_pool_worker, "thread_pool_worker", 0, 0, PSI_DOCUMENT_ME}};
+
+static void init_thread_pool_psi_keys() {
+  const char *category = "thread_pool";
+  int count;
+
+  count = static_cast<int>(array_elements(all_thread_pool_mutexes));
+  mysql_mutex_register(category, all_thread_pool_mutexes, count);
+
+  count = static_cast<int>(array_elements(all_thread_pool_conds));
+  mysql_cond_register(category, all_thread_pool_conds, count);
+
+  count = static_cast<int>(array_elements(all_thread_pool_threads));
+  mysql_thread_register(category, all_thread_pool_threads, count);
+}
+#endif /* HAVE_PSI_INTERFACE */
+
+extern "C" {
+static void *tp_worker_start(void *arg) {
+  static_cast<Thread_pool *>(arg)->worker_main();
+  return nullptr;
+}
+}  // extern "C"
+
+Thread_pool::Thread_pool(uint num_workers, uint max_threads)
+    : m_epoll_fd(-1),
+      m_wakeup_fd(-1),
+      m_num_workers(num_workers),
+      m_max_threads(max_threads),
+      m_worker_count(0),
+      m_blocked_worker_count(0),
+      m_idle_worker_count(0),
+      m_listener_active(false),
+      m_draining(false),
+      m_shutdown(false) {}
+
+Thread_pool::~Thread_pool() {
+  if (m_epoll_fd != -1) close(m_epoll_fd);
+  if (m_wakeup_fd != -1) close(m_wakeup_fd);
+  mysql_mutex_destroy(&LOCK_pool);
+  mysql_cond_destroy(&COND_pool);
+}
+
+bool Thread_pool::init() {
+#ifdef HAVE_PSI_INTERFACE
+  init_thread_pool_psi_keys();
+#endif
+  mysql_mutex_init(key_LOCK_thread_pool, &LOCK_pool, MY_MUTEX_INIT_FAST);
+  mysql_cond_init(key_COND_thread_pool, &COND_pool);
+
+  m_epoll_fd = epoll_create1(0);
+  if (m_epoll_fd == -1) return true;
+
+  m_wakeup_fd = eventfd(0, EFD_NONBLOCK);
+  if (m_wakeup_fd == -1) return true;
+
+  /*
+    The eventfd is registered level triggered with a null event pointer,
+    which identifies it to the listener as a wakeup and not a connection.
+  */
+  struct epoll_event wakeup_event;
+  wakeup_event.events = EPOLLIN;
+  wakeup_event.data.ptr = nullptr;
+  if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_wakeup_fd, &wakeup_event))
+    return true;
+
+  mysql_mutex_lock(&LOCK_pool);
+  for (uint i = 0; i < m_num_workers; i++) {
+    if (spawn_worker()) break;
+  }
+  bool error = (m_worker_count == 0);
+  mysql_mutex_unlock(&LOCK_pool);
+  return error;
+}
+
+bool Thread_pool::start(uint num_workers, uint max_threads) {
+  DBUG_ASSERT(m_instance == nullptr);
+  Thread_pool *pool = new (std::nothrow) Thread_pool(num_workers, max_threads);
+  if (pool == nullptr) return true;
+  if (pool->init()) {
+    mysql_mutex_lock(&pool->LOCK_pool);
+    pool->m_shutdown = true;
+    mysql_cond_broadcast(&pool->COND_pool);
+    pool->wake_listener();
+    while (pool->m_worker_count > 0)
+      mysql_cond_wait(&pool->COND_pool, &pool->LOCK_pool);
+    mysql_mutex_unlock(&pool->LOCK_pool);
+    delete pool;
+    return true;
+  }
+  m_instance = pool;
+  return false;
+}
+
+/**
+  Kill and disconnect the session of a connection owned by the thread
+  pool. Passed to do_for_all_thd(), so it must leave sessions of other
+  connection handlers alone; pool sessions are recognized by their
+  scheduler data.
+*/
+static void tp_kill_connection(THD *thd, uint64) {
+  if (thd_get_scheduler_data(thd) == nullptr) return;
+  thd_lock_data(thd);
+  thd_set_killed(thd);
+  thd_close_connection(thd);
+  thd_unlock_data(thd);
+}
+
+void Thread_pool::stop() {
+  Thread_pool *pool = m_instance;
+  if (pool == nullptr) return;
+
+  /*
+    Phase one: drain. Workers keep serving events but refuse new logins
+    and do not park connections again. Killing the pool's sessions
+    closes their sockets, so every parked connection produces an epoll
+    event and gets cleaned up by a worker.
+  */
+  mysql_mutex_lock(&pool->LOCK_pool);
+  pool->m_draining = true;
+  mysql_mutex_unlock(&pool->LOCK_pool);
+
+  do_for_all_thd(tp_kill_connection, 0);
+
+  mysql_mutex_lock(&pool->LOCK_pool);
+  while (!pool->m_connections.empty())
+    mysql_cond_wait(&pool->COND_pool, &pool->LOCK_pool);
+
+  /* Phase two: terminate the workers. */
+  pool->m_shutdown = true;
+  mysql_cond_broadcast(&pool->COND_pool);
+  pool->wake_listener();
+  while (pool->m_worker_count > 0)
+    mysql_cond_wait(&pool->COND_pool, &pool->LOCK_pool);
+  mysql_mutex_unlock(&pool->LOCK_pool);
+
+  m_instance = nullptr;
+  delete pool;
+}
+
+bool Thread_pool::spawn_worker() {
+  mysql_mutex_assert_owner(&LOCK_pool);
+  my_thread_handle id;
+  if (mysql_thread_create(key_thread_pool_worker, &id, get_connection_attrib(),
+                          tp_worker_start, this))
+    return true;
+  m_worker_count++;
+  inc_thread_created();
+  return false;
+}
+
+void Thread_pool::wake_listener() {
+  if (m_wakeup_fd == -1) return;
+  uint64_t one = 1;
+  if (write(m_wakeup_fd, &one, sizeof(one)) < 0) {
+    DBUG_ASSERT(errno == EAGAIN);
+  }
+}
+
+bool Thread_pool::add_new_connection(Channel_info *channel_info) {
+  auto *connection = new (std::nothrow) Thread_pool_connection(channel_info);
+  if (connection == nullptr) {
+    dec_connection_count();
+    return true;
+  }
+
+  mysql_mutex_lock(&LOCK_pool);
+  if (m_draining || m_shutdown) {
+    mysql_mutex_unlock(&LOCK_pool);
+    delete connection;
+    dec_connection_count();
+    return true;
+  }
+  m_connections.insert(connection);
+  m_low_priority_queue.push_back(connection);
+  if (m_idle_worker_count > 0)
+    mysql_cond_signal(&COND_pool);
+  else if (m_listener_active)
+    wake_listener();
+  mysql_mutex_unlock(&LOCK_pool);
+  return false;
+}
+
+void Thread_pool::wait_begin() {
+  if (!tp_worker_thread || tp_worker_wait_depth++ != 0) return;
+  mysql_mutex_lock(&LOCK_pool);
+  m_blocked_worker_count++;
+  /*
+    If this was the last worker able to run connections, the queued and
+    parked connections could be the ones holding whatever the blocked
+    sessions wait for. Start an extra worker so the pool keeps making
+    progress; it retires again once there is nothing left to do.
+  */
+  if (!m_shutdown && m_idle_worker_count == 0 && !m_listener_active &&
+      m_worker_count == m_blocked_worker_count &&
+      m_worker_count < m_max_threads)
+    (void)spawn_worker();
+  mysql_mutex_unlock(&LOCK_pool);
+}
+
+void Thread_pool::wait_end() {
+  if (!tp_worker_thread || --tp_worker_wait_depth != 0) return;
+  mysql_mutex_lock(&LOCK_pool);
+  m_blocked_worker_count--;
+  mysql_mutex_unlock(&LOCK_pool);
+}
+
+Thread_pool_connection *Thread_pool::get_connection() {
+  static const int max_events = 64;
+  struct epoll_event events[max_events];
+
+  mysql_mutex_lock(&LOCK_pool);
+  while (!m_shutdown) {
+    Thread_pool_connection *connection = nullptr;
+    if (!m_high_priority_queue.empty()) {
+      connection = m_high_priority_queue.front();
+      m_high_priority_queue.pop_front();
+    } else if (!m_low_priority_queue.empty()) {
+      connection = m_low_priority_queue.front();
+      m_low_priority_queue.pop_front();
+    }
+    if (connection != nullptr) {
+      mysql_mutex_unlock(&LOCK_pool);
+      return connection;
+    }
+
+    if (!m_listener_active) {
+      m_listener_active = true;
+      mysql_mutex_unlock(&LOCK_pool);
+      int num_events = epoll_wait(m_epoll_fd, events, max_events, -1);
+      mysql_mutex_lock(&LOCK_pool);
+      m_listener_active = false;
+      int queued = 0;
+      for (int i = 0; i < num_events; i++) {
+        auto *ready =
+            static_cast<Thread_pool_connection *>(events[i].data.ptr);
+        if (ready == nullptr) {
+          /* The wakeup eventfd; drain it. */
+          uint64_t value;
+          while (read(m_wakeup_fd, &value, sizeof(value)) > 0) {
+          }
+          continue;
+        }
+        /*
+          Sessions inside a transaction go first: they hold locks and
+          MVCC snapshots that other sessions may be waiting for.
+        */
+        if (ready->m_logged_in && thd_is_transaction_active(ready->m_thd))
+          m_high_priority_queue.push_back(ready);
+        else
+          m_low_priority_queue.push_back(ready);
+        queued++;
+      }
+      /* This worker takes one connection; wake one worker per extra. */
+      for (int i = 1; i < queued; i++) mysql_cond_signal(&COND_pool);
+      continue;
+    }
+
+    /*
+      Nothing queued and another worker is listening: a surplus worker
+      (started while others were blocked) retires here.
+    */
+    if (m_worker_count > m_num_workers + m_blocked_worker_count) break;
+
+    m_idle_worker_count++;
+    mysql_cond_wait(&COND_pool, &LOCK_pool);
+    m_idle_worker_count--;
+  }
+  mysql_mutex_unlock(&LOCK_pool);
+  return nullptr;
+}
+
+bool Thread_pool::login_connection(Thread_pool_connection *connection) {
+  Channel_info *channel_info = connection->m_channel_info;
+  connection->m_channel_info = nullptr;
+
+  if (m_draining) {
+    channel_info->send_error_and_close_channel(ER_SERVER_SHUTDOWN, 0, false);
+    delete channel_info;
+    dec_connection_count();
+    return true;
+  }
+
+  THD *thd = channel_info->create_thd();
+  if (thd == nullptr) {
+    channel_info->send_error_and_close_channel(ER_OUT_OF_RESOURCES, 0, false);
+    connection_errors_internal++;
+    increment_aborted_connects();
+    dec_connection_count();
+    delete channel_info;
+    return true;
+  }
+  delete channel_info;
+
+  connection->m_thd = thd;
+  thd->set_new_thread_id();
+  thd_set_thread_stack(thd, tp_worker_stack_base);
+  thd_store_globals(thd);
+  /* Mark the session as owned by the pool, see tp_kill_connection(). */
+  thd_set_scheduler_data(thd, connection);
+
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  /*
+    Create new instrumentation for the THD job and attach it to this
+    worker, the same way a reused pthread of the per-thread handler
+    does.
+  */
+  PSI_thread *psi = PSI_THREAD_CALL(new_thread)(key_thread_one_connection, thd,
+                                                thd->thread_id());
+  PSI_THREAD_CALL(set_thread_os_id)(psi);
+  PSI_THREAD_CALL(set_thread)(psi);
+  thd_set_psi(thd, psi);
+#endif /* HAVE_PSI_THREAD_INTERFACE */
+  mysql_thread_set_psi_id(thd->thread_id());
+  mysql_thread_set_psi_THD(thd);
+  mysql_socket_set_thread_owner(
+      thd->get_protocol_classic()->get_vio()->mysql_socket);
+
+  Global_THD_manager::get_instance()->add_thd(thd);
+
+  if (thd_prepare_connection(thd)) {
+    increment_aborted_connects();
+    return true;
+  }
+
+  connection->m_logged_in = true;
+  return false;
+}
+
+void Thread_pool::attach_connection(Thread_pool_connection *connection) {
+  THD *thd = connection->m_thd;
+  thd_set_thread_stack(thd, tp_worker_stack_base);
+  thd_store_globals(thd);
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  PSI_THREAD_CALL(set_thread)(thd_get_psi(thd));
+#endif
+  mysql_thread_set_psi_id(thd->thread_id());
+  mysql_thread_set_psi_THD(thd);
+}
+
+void Thread_pool::detach_connection(Thread_pool_connection *) {
+  mysql_thread_set_psi_THD(nullptr);
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  PSI_THREAD_CALL(set_thread)(nullptr);
+#endif
+}
+
+bool Thread_pool::arm_connection(Thread_pool_connection *connection) {
+  struct epoll_event event;
+  /*
+    One shot delivery guarantees the connection is handed to a single
+    worker; it is re-armed here after each batch of commands.
+  */
+  event.events = EPOLLIN | EPOLLONESHOT;
+  event.data.ptr = connection;
+  int op =
+      connection->m_registered_in_epoll ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+  if (epoll_ctl(m_epoll_fd, op, thd_get_fd(connection->m_thd), &event))
+    return true;
+  connection->m_registered_in_epoll = true;
+  return false;
+}
+
+void Thread_pool::destroy_connection(Thread_pool_connection *connection) {
+  THD *thd = connection->m_thd;
+
+  close_connection(thd, 0, false, false);
+
+  thd->get_stmt_da()->reset_diagnostics_area();
+  thd->release_resources();
+  Global_THD_manager::get_instance()->remove_thd(thd);
+  dec_connection_count();
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  thd_set_psi(thd, nullptr);
+  PSI_THREAD_CALL(delete_current_thread)();
+#endif
+  delete thd;
+
+  mysql_mutex_lock(&LOCK_pool);
+  m_connections.erase(connection);
+  if (m_draining && m_connections.empty()) mysql_cond_broadcast(&COND_pool);
+  mysql_mutex_unlock(&LOCK_pool);
+  delete connection;
+}
+
+void Thread_pool::process_connection(Thread_pool_connection *connection) {
+  THD *thd;
+
+  if (!connection->m_logged_in) {
+    if (login_connection(connection)) {
+      if (connection->m_thd != nullptr) {
+        /* The handshake failed; take the session down. */
+        destroy_connection(connection);
+      } else {
+        mysql_mutex_lock(&LOCK_pool);
+        m_connections.erase(connection);
+        if (m_draining && m_connections.empty())
+          mysql_cond_broadcast(&COND_pool);
+        mysql_mutex_unlock(&LOCK_pool);
+        delete connection;
+      }
+      return;
+    }
+    thd = connection->m_thd;
+    /* The client sends the first command later; park the connection. */
+    if (!thd_connection_has_data(thd)) goto park;
+  } else {
+    attach_connection(connection);
+    thd = connection->m_thd;
+  }
+
+  /*
+    The connection was scheduled because its socket is readable:
+    execute at least one command, and keep going while the vio has
+    buffered data that epoll cannot see.
+  */
+  do {
+    if (!thd_connection_alive(thd)) goto close;
+    if (do_command(thd)) goto close;
+  } while (thd_connection_has_data(thd));
+
+park:
+  if (m_draining) goto close;
+  detach_connection(connection);
+  if (!arm_connection(connection)) return;
+  /* Arming failed; finish the connection on this thread. */
+  attach_connection(connection);
+
+close:
+  end_connection(thd);
+  destroy_connection(connection);
+}
+
+void Thread_pool::worker_main() {
+  char stack_top;
+
+  if (my_thread_init()) {
+    mysql_mutex_lock(&LOCK_pool);
+    m_worker_count--;
+    mysql_cond_broadcast(&COND_pool);
+    mysql_mutex_unlock(&LOCK_pool);
+    return;
+  }
+
+  tp_worker_thread = true;
+  tp_worker_stack_base = &stack_top;
+
+  for (;;) {
+    Thread_pool_connection *connection = get_connection();
+    if (connection == nullptr) break;
+    process_connection(connection);
+  }
+
+  mysql_mutex_lock(&LOCK_pool);
+  m_worker_count--;
+  mysql_cond_broadcast(&COND_pool);
+  mysql_mutex_unlock(&LOCK_pool);
+  my_thread_end();
+}
+
+ulong Thread_pool::num_worker_threads() {
+  Thread_pool *pool = m_instance;
+  return pool != nullptr ? pool->m_worker_count : 0;
+}
+
+ulong Thread_pool::num_blocked_worker_threads() {
+  Thread_pool *pool = m_instance;
+  return pool != nullptr ? pool->m_blocked_worker_count : 0;
+}
+
+ulong Thread_pool::num_queued_connections() {
+  Thread_pool *pool = m_instance;
+  if (pool == nullptr) return 0;
+  mysql_mutex_lock(&pool->LOCK_pool);
+  ulong queued = pool->m_high_priority_queue.size() +
+                 pool->m_low_priority_queue.size();
+  mysql_mutex_unlock(&pool->LOCK_pool);
+  return queued;
+}
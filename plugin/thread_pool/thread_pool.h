@@ -0,0 +1,200 @@
+/* Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+#ifndef PLUGIN_THREAD_POOL_THREAD_POOL_H
+#define PLUGIN_THREAD_POOL_THREAD_POOL_H
+
+#include <deque>
+#include <set>
+
+#include "my_inttypes.h"
+#include "mysql/psi/mysql_cond.h"
+#include "mysql/psi/mysql_mutex.h"
+
+class Channel_info;
+class THD;
+
+/**
+  A client connection handled by the thread pool.
+
+  Until the login has been performed, the object only carries the
+  Channel_info of the freshly accepted connection; afterwards it owns
+  the session THD. While the connection waits for its next command it
+  is registered in the pool's epoll instance, with a pointer to this
+  object as event data, and is not attached to any thread.
+*/
+class Thread_pool_connection {
+ public:
+  explicit Thread_pool_connection(Channel_info *channel_info)
+      : m_channel_info(channel_info),
+        m_thd(nullptr),
+        m_logged_in(false),
+        m_registered_in_epoll(false) {}
+
+  /** Connection channel, owned until the login is done. */
+  Channel_info *m_channel_info;
+  /** The session, created at login. */
+  THD *m_thd;
+  /** True once the handshake has completed successfully. */
+  bool m_logged_in;
+  /** True once the socket has been added to the epoll instance. */
+  bool m_registered_in_epoll;
+};
+
+/**
+  A pool of worker threads serving all client connections.
+
+  Connections waiting for their next command are parked in an epoll
+  instance instead of each occupying an OS thread. One worker at a time
+  acts as listener and collects ready connections into two queues:
+  connections with an open transaction are queued with high priority so
+  that they release their locks and MVCC snapshots as soon as possible,
+  all other connections and logins with low priority. Workers pick
+  queued connections, attach the session to themselves for the duration
+  of the commands and park the connection again when the client goes
+  idle.
+
+  The pool normally runs thread_pool_size workers. When every worker is
+  blocked inside the server (row lock, disk I/O, ...) an extra worker
+  is started, up to thread_pool_max_threads, so that queued connections
+  cannot deadlock against the blocked ones. Surplus workers retire once
+  they find nothing to do.
+*/
+class Thread_pool {
+ public:
+  /**
+    Create and start the pool singleton.
+
+    @param num_workers  number of permanent worker threads.
+    @param max_threads  upper limit for workers including the extra
+                        workers started while others are blocked.
+
+    @retval false success
+    @retval true  failure
+  */
+  static bool start(uint num_workers, uint max_threads);
+
+  /**
+    Drain all connections, stop all workers and destroy the pool
+    singleton. Must be called after the connection handler has been
+    reset, so that no new connections arrive.
+  */
+  static void stop();
+
+  static Thread_pool *instance() { return m_instance; }
+
+  /**
+    Queue a new connection for a worker to log in and serve.
+
+    @note Called from the acceptor thread; must not block.
+
+    @retval false success, ownership of channel_info was taken.
+    @retval true  failure, the caller keeps ownership.
+  */
+  bool add_new_connection(Channel_info *channel_info);
+
+  /**
+    Called when a session is about to block inside the server. Starts
+    an extra worker when the pool would otherwise be unable to serve
+    queued connections.
+  */
+  void wait_begin();
+  /** Called when a session is done blocking inside the server. */
+  void wait_end();
+
+  /** Main loop of a worker thread. */
+  void worker_main();
+
+  /* Status counters for SHOW STATUS. */
+  static ulong num_worker_threads();
+  static ulong num_blocked_worker_threads();
+  static ulong num_queued_connections();
+
+ private:
+  Thread_pool(uint num_workers, uint max_threads);
+  ~Thread_pool();
+
+  /* Make this class non-copyable */
+  Thread_pool(const Thread_pool &) = delete;
+  Thread_pool &operator=(const Thread_pool &) = delete;
+
+  bool init();
+  /** Start one worker thread. Requires LOCK_pool. */
+  bool spawn_worker();
+  /** Make a blocked epoll listener re-check the queues. */
+  void wake_listener();
+
+  /**
+    Get the next connection to work on: pop the queues, or become the
+    epoll listener when no other worker is, or wait.
+
+    @return the connection to serve, or nullptr when the worker shall
+    terminate (shutdown or surplus worker retiring).
+  */
+  Thread_pool_connection *get_connection();
+
+  /** Serve one scheduled connection: login or execute commands. */
+  void process_connection(Thread_pool_connection *connection);
+  /** Create the THD and authenticate. @return true on failure. */
+  bool login_connection(Thread_pool_connection *connection);
+  /** Make the session current for this worker thread. */
+  void attach_connection(Thread_pool_connection *connection);
+  /** Detach the session before parking the connection in epoll. */
+  void detach_connection(Thread_pool_connection *connection);
+  /** (Re-)register the connection in epoll. @return true on failure. */
+  bool arm_connection(Thread_pool_connection *connection);
+  /** Close the session and free the connection object. */
+  void destroy_connection(Thread_pool_connection *connection);
+
+  static Thread_pool *m_instance;
+
+  mysql_mutex_t LOCK_pool;
+  mysql_cond_t COND_pool;
+
+  /** Connections with an open transaction, served first. */
+  std::deque<Thread_pool_connection *> m_high_priority_queue;
+  /** All other ready connections and logins. */
+  std::deque<Thread_pool_connection *> m_low_priority_queue;
+  /** All live connections, needed to drain the pool on shutdown. */
+  std::set<Thread_pool_connection *> m_connections;
+
+  int m_epoll_fd;
+  /** eventfd used to wake the epoll listener. */
+  int m_wakeup_fd;
+
+  /** Configured number of permanent workers. */
+  uint m_num_workers;
+  /** Hard limit on workers, including temporary ones. */
+  uint m_max_threads;
+
+  /* The counters below are protected by LOCK_pool. */
+  uint m_worker_count;
+  uint m_blocked_worker_count;
+  uint m_idle_worker_count;
+  bool m_listener_active;
+  /** Shutdown phase one: refuse new logins, do not park connections. */
+  bool m_draining;
+  /** Shutdown phase two: workers terminate. */
+  bool m_shutdown;
+};
+
+#endif  // PLUGIN_THREAD_POOL_THREAD_POOL_H
@@ -0,0 +1,168 @@
+/* Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+#include <mysql/plugin.h>
+#include <mysql/service_thread_scheduler.h>
+#include <mysql/thread_pool_priv.h>
+#include <mysql_version.h>
+
+#include <algorithm>
+#include <thread>
+
+#include "my_inttypes.h"
+#include "plugin/thread_pool/thread_pool.h"
+
+static uint thread_pool_size = 0;
+static uint thread_pool_max_threads = 1000;
+
+static MYSQL_SYSVAR_UINT(
+    size, thread_pool_size, PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+    "Number of permanent worker threads (0 means one per CPU)", nullptr,
+    nullptr, 0, 0, 100000, 0);
+
+static MYSQL_SYSVAR_UINT(
+    max_threads, thread_pool_max_threads,
+    PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+    "Maximum number of worker threads, including the extra workers "
+    "started while other workers are blocked inside the server",
+    nullptr, nullptr, 1000, 1, 100000, 0);
+
+static SYS_VAR *thread_pool_system_vars[] = {
+    MYSQL_SYSVAR(size),
+    MYSQL_SYSVAR(max_threads),
+    nullptr,
+};
+
+static int show_thread_pool_threads(MYSQL_THD, SHOW_VAR *var, char *buff) {
+  var->type = SHOW_LONG;
+  var->value = buff;
+  *(reinterpret_cast<ulong *>(buff)) = Thread_pool::num_worker_threads();
+  return 0;
+}
+
+static int show_thread_pool_blocked_threads(MYSQL_THD, SHOW_VAR *var,
+                                            char *buff) {
+  var->type = SHOW_LONG;
+  var->value = buff;
+  *(reinterpret_cast<ulong *>(buff)) =
+      Thread_pool::num_blocked_worker_threads();
+  return 0;
+}
+
+static int show_thread_pool_queued_connections(MYSQL_THD, SHOW_VAR *var,
+                                               char *buff) {
+  var->type = SHOW_LONG;
+  var->value = buff;
+  *(reinterpret_cast<ulong *>(buff)) = Thread_pool::num_queued_connections();
+  return 0;
+}
+
+static SHOW_VAR thread_pool_status_vars[] = {
+    {"Thread_pool_threads", (char *)&show_thread_pool_threads, SHOW_FUNC,
+     SHOW_SCOPE_GLOBAL},
+    {"Thread_pool_blocked_threads", (char *)&show_thread_pool_blocked_threads,
+     SHOW_FUNC, SHOW_SCOPE_GLOBAL},
+    {"Thread_pool_queued_connections",
+     (char *)&show_thread_pool_queued_connections, SHOW_FUNC,
+     SHOW_SCOPE_GLOBAL},
+    {nullptr, nullptr, SHOW_LONG, SHOW_SCOPE_GLOBAL},
+};
+
+static bool thread_pool_add_connection(Channel_info *channel_info) {
+  return Thread_pool::instance()->add_new_connection(channel_info);
+}
+
+/**
+  Called when the connection handler is reset. The pool itself is
+  stopped in the plugin deinit function, after the per-thread handler
+  has taken over accepting connections.
+*/
+static void thread_pool_end() {}
+
+static void thread_pool_thd_wait_begin(THD *, int) {
+  Thread_pool *pool = Thread_pool::instance();
+  if (pool != nullptr) pool->wait_begin();
+}
+
+static void thread_pool_thd_wait_end(THD *) {
+  Thread_pool *pool = Thread_pool::instance();
+  if (pool != nullptr) pool->wait_end();
+}
+
+/**
+  A killed pool session is woken up through its closed socket, so no
+  extra notification is needed here.
+*/
+static void thread_pool_post_kill_notification(THD *) {}
+
+static Connection_handler_functions thread_pool_handler_functions = {
+    0,  // max_threads, set in init
+    thread_pool_add_connection, thread_pool_end};
+
+static THD_event_functions thread_pool_event_functions = {
+    thread_pool_thd_wait_begin, thread_pool_thd_wait_end,
+    thread_pool_post_kill_notification};
+
+static int thread_pool_plugin_init(void *) {
+  uint num_workers = thread_pool_size;
+  if (num_workers == 0) {
+    num_workers = std::thread::hardware_concurrency();
+    if (num_workers == 0) num_workers = 1;
+  }
+  uint max_threads = std::max(thread_pool_max_threads, num_workers);
+
+  if (Thread_pool::start(num_workers, max_threads)) return 1;
+
+  thread_pool_handler_functions.max_threads = max_threads;
+  if (my_connection_handler_set(&thread_pool_handler_functions,
+                                &thread_pool_event_functions)) {
+    Thread_pool::stop();
+    return 1;
+  }
+  return 0;
+}
+
+static int thread_pool_plugin_deinit(void *) {
+  my_connection_handler_reset();
+  Thread_pool::stop();
+  return 0;
+}
+
+struct st_mysql_daemon thread_pool_plugin = {MYSQL_DAEMON_INTERFACE_VERSION};
+
+mysql_declare_plugin(thread_pool){
+    MYSQL_DAEMON_PLUGIN,
+    &thread_pool_plugin,
+    "thread_pool",
+    PLUGIN_AUTHOR_ORACLE,
+    "Connection handler multiplexing all connections over a pool of "
+    "worker threads",
+    PLUGIN_LICENSE_GPL,
+    thread_pool_plugin_init,   /* Plugin Init */
+    nullptr,                   /* Plugin Check uninstall */
+    thread_pool_plugin_deinit, /* Plugin Deinit */
+    0x0100 /* 1.0 */,
+    thread_pool_status_vars, /* status variables */
+    thread_pool_system_vars, /* system variables */
+    nullptr,                 /* config options */
+    0,                       /* flags */
+} mysql_declare_plugin_end;
@@ -237,7 +237,7 @@ void MySQLRoutingConnection::run() {
       }
 
       connection_is_ok = false;
-    } else {
+    } else if (copy_res.value() > 0) {
       last_received_from_server_ = std::chrono::system_clock::now();
       bytes_up_ += copy_res.value();
     }
@@ -262,7 +262,7 @@ void MySQLRoutingConnection::run() {
       }
       // client close on us.
       connection_is_ok = false;
-    } else {
+    } else if (copy_res.value() > 0) {
       last_sent_to_server_ = std::chrono::system_clock::now();
       bytes_down_ += copy_res.value();
     }
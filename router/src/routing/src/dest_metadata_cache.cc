@@ -239,6 +239,10 @@ DestMetadataCacheGroup::get_available(
     primary_fallback = true;
   }
 
+  // this runs for every new connection; avoid vector reallocations
+  result.address.reserve(managed_servers_vec.size());
+  result.id.reserve(managed_servers_vec.size());
+
   for (const auto &it : managed_servers_vec) {
     if (for_new_connections) {
       // for new connections skip (do not include) the node if it is hidden - it
@@ -287,6 +291,9 @@ DestMetadataCacheGroup::get_available_primaries(
   DestMetadataCacheGroup::AvailableDestinations result;
   const auto &managed_servers_vec = managed_servers.instance_vector;
 
+  result.address.reserve(managed_servers_vec.size());
+  result.id.reserve(managed_servers_vec.size());
+
   for (const auto &it : managed_servers_vec) {
     auto port = (protocol_ == Protocol::Type::kXProtocol) ? it.xport : it.port;
 
@@ -4129,6 +4129,8 @@ static int cli_establish_ssl(MYSQL *mysql) {
     /* check if server supports compression else turn off client capability */
     if (!(mysql->server_capabilities & CLIENT_ZSTD_COMPRESSION_ALGORITHM))
       mysql->client_flag &= ~CLIENT_ZSTD_COMPRESSION_ALGORITHM;
+    if (!(mysql->server_capabilities & CLIENT_ZSTD_STREAM_COMPRESSION))
+      mysql->client_flag &= ~CLIENT_ZSTD_STREAM_COMPRESSION;
     if (!(mysql->server_capabilities & CLIENT_COMPRESS))
       mysql->client_flag &= ~CLIENT_COMPRESS;
 
@@ -4692,6 +4694,8 @@ static bool prep_client_reply_packet(MCPVIO_EXT *mpvio, const uchar *data,
     mysql->client_flag &= ~CLIENT_COMPRESS;
   if (!(mysql->server_capabilities & CLIENT_ZSTD_COMPRESSION_ALGORITHM))
     mysql->client_flag &= ~CLIENT_ZSTD_COMPRESSION_ALGORITHM;
+  if (!(mysql->server_capabilities & CLIENT_ZSTD_STREAM_COMPRESSION))
+    mysql->client_flag &= ~CLIENT_ZSTD_STREAM_COMPRESSION;
   /*
    If server and client have no compression algorithms in common, we must
    fall back to uncompressed. In that case, check that uncompressed is
@@ -6427,8 +6431,13 @@ static mysql_state_machine_status csm_prep_select_database(
       (mysql->client_flag & CLIENT_ZSTD_COMPRESSION_ALGORITHM)) {
     net->compress = true;
     uint compress_level;
-    enum enum_compression_algorithm algorithm =
-        mysql->client_flag & CLIENT_COMPRESS ? MYSQL_ZLIB : MYSQL_ZSTD;
+    enum enum_compression_algorithm algorithm;
+    if (mysql->client_flag & CLIENT_COMPRESS)
+      algorithm = MYSQL_ZLIB;
+    else if (mysql->client_flag & CLIENT_ZSTD_STREAM_COMPRESSION)
+      algorithm = MYSQL_ZSTD_STREAM;
+    else
+      algorithm = MYSQL_ZSTD;
     if (mysql->options.extension &&
         mysql->options.extension->zstd_compression_level)
       compress_level = mysql->options.extension->zstd_compression_level;
@@ -6438,6 +6447,12 @@ static mysql_state_machine_status csm_prep_select_database(
     NET_EXTENSION *ext = NET_EXTENSION_PTR(net);
     DBUG_ASSERT(ext != nullptr);
     mysql_compress_context_init(&ext->compress_ctx, algorithm, compress_level);
+    /*
+      The client is the receiving end of the streamed direction; packets it
+      sends to the server stay in per-packet zstd frames.
+    */
+    if (algorithm == MYSQL_ZSTD_STREAM)
+      ext->compress_ctx.u.zstd_ctx.stream_decompress = true;
 #else
     NET_SERVER *server_ext = static_cast<NET_SERVER *>(net->extension);
     if (server_ext == nullptr) {
@@ -6448,6 +6463,8 @@ static mysql_state_machine_status csm_prep_select_database(
     DBUG_ASSERT(server_ext != nullptr);
     mysql_compress_context_init(&server_ext->compress_ctx, algorithm,
                                 compress_level);
+    if (algorithm == MYSQL_ZSTD_STREAM)
+      server_ext->compress_ctx.u.zstd_ctx.stream_decompress = true;
 #endif
   }
 #ifdef CHECK_LICENSE
@@ -7867,7 +7884,8 @@ int STDCALL mysql_options(MYSQL *mysql, enum mysql_option option,
       ENSURE_EXTENSIONS_PRESENT(&mysql->options);
       mysql->options.extension->connection_compressed = true;
       mysql->options.client_flag &=
-          ~(CLIENT_COMPRESS | CLIENT_ZSTD_COMPRESSION_ALGORITHM);
+          ~(CLIENT_COMPRESS | CLIENT_ZSTD_COMPRESSION_ALGORITHM |
+            CLIENT_ZSTD_STREAM_COMPRESSION);
       mysql->options.compress = false;
       auto it = list.begin();
       unsigned int cnt = 0;
@@ -7879,7 +7897,14 @@ int STDCALL mysql_options(MYSQL *mysql, enum mysql_option option,
             mysql->options.compress = true;
             break;
           case enum_compression_algorithm::MYSQL_ZSTD:
-            mysql->options.client_flag |= CLIENT_ZSTD_COMPRESSION_ALGORITHM;
+          case enum_compression_algorithm::MYSQL_ZSTD_STREAM:
+            /*
+              This client can decode a continuous zstd stream, so always
+              offer the streamed variant alongside plain zstd; the server
+              picks the streamed one only when it supports it too.
+            */
+            mysql->options.client_flag |= CLIENT_ZSTD_COMPRESSION_ALGORITHM |
+                                          CLIENT_ZSTD_STREAM_COMPRESSION;
             mysql->options.compress = true;
             break;
           case enum_compression_algorithm::MYSQL_UNCOMPRESSED:
@@ -30,8 +30,8 @@
   This function is used to validate compression algorithm specified as part
   of change master to statement.
 
-  @param name   compression algorithm name. Name can be either zlib,zstd or
-                empty string.
+  @param name   compression algorithm name. Name can be either zlib, zstd,
+                zstd_stream or empty string.
 
   @retval  an enum to represents what algorithm is specified in case it is
            a valid algorithm else return INVALID.
@@ -45,6 +45,9 @@ enum_compression_algorithm get_compression_algorithm(std::string name) {
   else if (!my_strcasecmp(&my_charset_latin1, name.c_str(),
                           COMPRESSION_ALGORITHM_ZSTD))
     return enum_compression_algorithm::MYSQL_ZSTD;
+  else if (!my_strcasecmp(&my_charset_latin1, name.c_str(),
+                          COMPRESSION_ALGORITHM_ZSTD_STREAM))
+    return enum_compression_algorithm::MYSQL_ZSTD_STREAM;
   else if (!my_strcasecmp(&my_charset_latin1, name.c_str(),
                           COMPRESSION_ALGORITHM_UNCOMPRESSED))
     return enum_compression_algorithm::MYSQL_UNCOMPRESSED;
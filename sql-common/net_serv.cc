@@ -40,6 +40,9 @@
 
 #include <string.h>
 #include <sys/types.h>
+#ifndef _WIN32
+#include <sys/uio.h>
+#endif
 #include <algorithm>
 
 #include <mysql/components/services/log_builtins.h>
@@ -90,6 +93,9 @@ extern void thd_increment_bytes_received(size_t length);
 #endif
 
 static bool net_write_buff(NET *, const uchar *, size_t);
+#ifndef _WIN32
+static bool net_write_packet_vector(NET *, struct iovec *, int);
+#endif
 static uchar *compress_packet(NET *net, const uchar *packet, size_t *length);
 
 NET_EXTENSION *net_extension_init() {
@@ -934,6 +940,25 @@ static bool net_write_buff(NET *net, const uchar *packet, size_t len) {
   DBUG_DUMP("data", packet, len);
 #endif
   if (len > left_length) {
+#ifndef _WIN32
+    if (!net->compress && net->write_pos != net->buff) {
+      /*
+        Send the already buffered packets and this packet with a single
+        gathering write. This avoids copying the packet piecewise
+        through the buffer as well as the extra write(2) for the part
+        that does not fit. Not used with the compressed protocol, which
+        has to frame and compress each on-wire packet individually.
+      */
+      struct iovec vec[2];
+      vec[0].iov_base = net->buff;
+      vec[0].iov_len = (size_t)(net->write_pos - net->buff);
+      vec[1].iov_base = const_cast<uchar *>(packet);
+      vec[1].iov_len = len;
+      if (net_write_packet_vector(net, vec, 2)) return true;
+      net->write_pos = net->buff;
+      return false;
+    }
+#endif
     if (net->write_pos != net->buff) {
       /* Fill up already used packet and write it */
       memcpy(net->write_pos, packet, left_length);
@@ -1015,6 +1040,101 @@ static bool net_write_raw_loop(NET *net, const uchar *buf, size_t count) {
   return count != 0;
 }
 
+#ifndef _WIN32
+
+/**
+  Write a vector of buffers to a network handler.
+
+  Equivalent to calling net_write_raw_loop() on the concatenation of
+  the buffers, without requiring them to be contiguous in memory:
+  plain socket transports send the whole vector with one gathering
+  write, see vio_writev().
+
+  @param  net     NET handler.
+  @param  vec     Buffers to write; consumed while sending.
+  @param  count   Number of buffers.
+
+  @return true on error, false on success.
+*/
+
+static bool net_write_vector_loop(NET *net, struct iovec *vec, int count) {
+  unsigned int retry_count = 0;
+  int current = 0;
+
+  while (current != count) {
+    size_t sentcnt = vio_writev(net->vio, vec + current, count - current);
+
+    /* VIO_SOCKET_ERROR (-1) indicates an error. */
+    if (sentcnt == VIO_SOCKET_ERROR) {
+      /* A recoverable I/O error occurred? */
+      if (net_should_retry(net, &retry_count))
+        continue;
+      else
+        break;
+    }
+#ifdef MYSQL_SERVER
+    thd_increment_bytes_sent(sentcnt);
+#endif
+    /* Advance the vector past what was sent. */
+    while (sentcnt > 0) {
+      size_t chunk = min(sentcnt, vec[current].iov_len);
+      vec[current].iov_base = (char *)vec[current].iov_base + chunk;
+      vec[current].iov_len -= chunk;
+      sentcnt -= chunk;
+      if (vec[current].iov_len == 0) current++;
+    }
+  }
+
+  /* On failure, propagate the error code. */
+  if (current != count) {
+    /* Socket should be closed. */
+    net->error = 2;
+
+    /* Interrupted by a timeout? */
+    if (vio_was_timeout(net->vio))
+      net->last_errno = ER_NET_WRITE_INTERRUPTED;
+    else
+      net->last_errno = ER_NET_ERROR_ON_WRITE;
+
+#ifdef MYSQL_SERVER
+    my_error(net->last_errno, MYF(0));
+#endif
+  }
+
+  return current != count;
+}
+
+/**
+  Write several MySQL protocol packets to the network handler with a
+  gathering write, see net_write_buff().
+
+  @param  net     NET handler.
+  @param  vec     Buffers holding the packets; consumed while sending.
+  @param  count   Number of buffers.
+
+  @return true on error, false on success.
+*/
+
+static bool net_write_packet_vector(NET *net, struct iovec *vec, int count) {
+  DBUG_TRACE;
+
+  /* The compressed protocol frames each on-wire packet individually. */
+  DBUG_ASSERT(!net->compress);
+
+  /* Socket can't be used */
+  if (net->error == 2) return true;
+
+  net->reading_or_writing = 2;
+
+  bool res = net_write_vector_loop(net, vec, count);
+
+  net->reading_or_writing = 0;
+
+  return res;
+}
+
+#endif /* !_WIN32 */
+
 /* clang-format off */
 /**
   @page page_protocol_basic_compression Compression
@@ -1226,15 +1346,24 @@ static uchar *compress_packet(NET *net, const uchar *packet, size_t *length) {
   size_t compr_length = 0;
   const uint header_length = NET_HEADER_SIZE + COMP_HEADER_SIZE;
 
+  mysql_compress_context *compress_ctx = compress_context(net);
+
+  /*
+    Stream compression may expand incompressible data slightly; reserve the
+    worst case size. For the per-packet algorithms my_compress_bound()
+    returns 0 as the compressed packet never exceeds the original.
+  */
+  size_t buffer_length = *length;
+  const size_t compress_bound = my_compress_bound(compress_ctx, *length);
+  if (compress_bound > buffer_length) buffer_length = compress_bound;
+
   compr_packet = (uchar *)my_malloc(key_memory_NET_compress_packet,
-                                    *length + header_length, MYF(MY_WME));
+                                    buffer_length + header_length, MYF(MY_WME));
 
   if (compr_packet == nullptr) return nullptr;
 
   memcpy(compr_packet + header_length, packet, *length);
 
-  mysql_compress_context *compress_ctx = compress_context(net);
-
   /* Compress the encapsulated packet. */
   if (my_compress(compress_ctx, compr_packet + header_length, length,
                   &compr_length)) {
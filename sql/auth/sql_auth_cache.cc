@@ -145,6 +145,18 @@ malloc_unordered_map<std::string, unique_ptr_my_free<acl_entry>> db_cache{
 collation_unordered_map<std::string, ACL_USER *> *acl_check_hosts = nullptr;
 unique_ptr<Acl_restrictions> acl_restrictions = nullptr;
 
+/**
+  The currently published host check snapshot. Read with atomic_load by
+  acl_check_host(), replaced with atomic_store by init_check_host() while
+  holding an exclusive lock on the ACL caches. May be empty before the
+  ACL caches have been loaded and after they have been freed.
+*/
+static std::shared_ptr<Acl_host_check_snapshot> host_check_snapshot;
+
+std::shared_ptr<Acl_host_check_snapshot> acl_get_host_check_snapshot() {
+  return std::atomic_load(&host_check_snapshot);
+}
+
 /**
   A hashmap on user part of account name for quick lookup.
 */
@@ -1361,6 +1373,30 @@ static void init_check_host(void) {
     }
   }
   acl_wild_hosts->shrink_to_fit();
+
+  /*
+    Publish a new host check snapshot reflecting the structures built
+    above, so that acl_check_host() can run without locking the ACL
+    caches. The host names are copied: the entries of acl_wild_hosts and
+    the keys of acl_check_hosts point into the acl_users array, which may
+    be freed while an older snapshot is still referenced by a reader.
+  */
+  std::shared_ptr<Acl_host_check_snapshot> snapshot(
+      new Acl_host_check_snapshot);
+  snapshot->allow_all = allow_all_hosts;
+  for (const auto &key_and_value : *acl_check_hosts)
+    snapshot->check_hosts.insert(key_and_value.first);
+  snapshot->wild_host_names.reserve(acl_wild_hosts->size());
+  for (ACL_HOST_AND_IP *acl = acl_wild_hosts->begin();
+       acl != acl_wild_hosts->end(); ++acl)
+    snapshot->wild_host_names.push_back(acl->get_host());
+  snapshot->wild_hosts.reserve(snapshot->wild_host_names.size());
+  for (const std::string &wild_host : snapshot->wild_host_names) {
+    ACL_HOST_AND_IP host_and_ip;
+    host_and_ip.update_hostname(wild_host.c_str());
+    snapshot->wild_hosts.push_back(host_and_ip);
+  }
+  std::atomic_store(&host_check_snapshot, std::move(snapshot));
 }
 
 /*
@@ -1878,6 +1914,13 @@ void acl_free(bool end /*= false*/) {
   acl_proxy_users = nullptr;
   delete acl_check_hosts;
   acl_check_hosts = nullptr;
+  /*
+    Drop our reference to the published host check snapshot. Readers still
+    holding a reference keep their version alive; new readers fall back to
+    locking the ACL caches.
+  */
+  std::atomic_store(&host_check_snapshot,
+                    std::shared_ptr<Acl_host_check_snapshot>());
   if (!end)
     clear_and_init_db_cache();
   else {
@@ -34,6 +34,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "lex_string.h"
 #include "lf.h"
@@ -416,6 +417,40 @@ extern collation_unordered_map<std::string, ACL_USER *> *acl_check_hosts;
 extern bool allow_all_hosts;
 extern uint grant_version; /* Version of priv tables */
 extern std::unique_ptr<Acl_restrictions> acl_restrictions;
+
+/**
+  Immutable snapshot of the structures consulted by acl_check_host().
+
+  Connection establishment must not stall behind an exclusive lock on the
+  ACL caches taken by an account management statement. Instead of acquiring
+  Acl_cache_lock_guard, acl_check_host() fetches the current snapshot with
+  acl_get_host_check_snapshot() and performs all host matching against it.
+  A new version is built and published by init_check_host() whenever the
+  host check structures are rebuilt, which always happens under an
+  exclusive lock on the ACL caches. Readers keep their version alive
+  through the returned shared pointer, so publishing a new version never
+  invalidates data that is being read.
+
+  The snapshot owns copies of the host name patterns; it never points into
+  the acl_users array, whose elements may be freed once a newer version
+  has been published.
+*/
+class Acl_host_check_snapshot {
+ public:
+  Acl_host_check_snapshot()
+      : check_hosts(system_charset_info, key_memory_acl_mem),
+        allow_all(false) {}
+  /** Host names without wildcards, for hash lookup. */
+  collation_unordered_set<std::string> check_hosts;
+  /** Host name patterns with wildcards, parsed for matching. */
+  std::vector<ACL_HOST_AND_IP> wild_hosts;
+  /** Backing store for the host names wild_hosts point into. */
+  std::vector<std::string> wild_host_names;
+  /** Value of allow_all_hosts when the snapshot was created. */
+  bool allow_all;
+};
+
+std::shared_ptr<Acl_host_check_snapshot> acl_get_host_check_snapshot();
 // Search for a matching grant. Prefer exact grants before non-exact ones.
 
 extern MYSQL_PLUGIN_IMPORT CHARSET_INFO *files_charset_info;
@@ -1369,6 +1369,7 @@ static bool send_server_handshake_packet(MPVIO_EXT *mpvio, const char *data,
     /* turn off the capability flag as the global variable might have changed */
     protocol->remove_client_capability(CLIENT_COMPRESS);
     protocol->remove_client_capability(CLIENT_ZSTD_COMPRESSION_ALGORITHM);
+    protocol->remove_client_capability(CLIENT_ZSTD_STREAM_COMPRESSION);
     std::vector<std::string> list;
     parse_compression_algorithms_list(opt_protocol_compression_algorithms,
                                       list);
@@ -1380,7 +1381,14 @@ static bool send_server_handshake_packet(MPVIO_EXT *mpvio, const char *data,
       std::string value = *it;
       switch (get_compression_algorithm(value)) {
         case enum_compression_algorithm::MYSQL_ZSTD:
+        case enum_compression_algorithm::MYSQL_ZSTD_STREAM:
           protocol->add_client_capability(CLIENT_ZSTD_COMPRESSION_ALGORITHM);
+          /*
+            Advertise that the server can also carry compression history
+            across packets. Clients unaware of the capability keep the
+            per-packet zstd frames.
+          */
+          protocol->add_client_capability(CLIENT_ZSTD_STREAM_COMPRESSION);
           break;
         case enum_compression_algorithm::MYSQL_ZLIB:
           protocol->add_client_capability(CLIENT_COMPRESS);
@@ -1677,21 +1685,46 @@ static bool send_plugin_request_packet(MPVIO_EXT *mpvio, const uchar *data,
       data_len);
 }
 
-/* Return true if there is no users that can match the given host */
+/*
+  Return true if there is no users that can match the given host
+
+  The check normally runs against the host check snapshot published by
+  init_check_host(), without locking the ACL caches, so that incoming
+  connections never stall behind account management statements holding
+  the caches exclusively.
+*/
 
 bool acl_check_host(THD *thd, const char *host, const char *ip) {
-  Acl_cache_lock_guard acl_cache_lock(thd, Acl_cache_lock_mode::READ_MODE);
-  if (!acl_cache_lock.lock(false)) return true;
+  std::shared_ptr<Acl_host_check_snapshot> snapshot =
+      acl_get_host_check_snapshot();
+  if (snapshot != nullptr) {
+    if (snapshot->allow_all) return false;
+
+    if ((host && snapshot->check_hosts.count(host) != 0) ||
+        (ip && snapshot->check_hosts.count(ip) != 0))
+      return false;  // Found host
+
+    for (ACL_HOST_AND_IP &acl : snapshot->wild_hosts) {
+      if (acl.compare_hostname(host, ip)) return false;  // Host ok
+    }
+  } else {
+    /*
+      No snapshot has been published yet (the ACL caches are not loaded).
+      Fall back to reading the structures under a lock on the caches.
+    */
+    Acl_cache_lock_guard acl_cache_lock(thd, Acl_cache_lock_mode::READ_MODE);
+    if (!acl_cache_lock.lock(false)) return true;
 
-  if (allow_all_hosts) return false;
+    if (allow_all_hosts) return false;
 
-  if ((host && acl_check_hosts->count(host) != 0) ||
-      (ip && acl_check_hosts->count(ip) != 0))
-    return false;  // Found host
+    if ((host && acl_check_hosts->count(host) != 0) ||
+        (ip && acl_check_hosts->count(ip) != 0))
+      return false;  // Found host
 
-  for (ACL_HOST_AND_IP *acl = acl_wild_hosts->begin();
-       acl != acl_wild_hosts->end(); ++acl) {
-    if (acl->compare_hostname(host, ip)) return false;  // Host ok
+    for (ACL_HOST_AND_IP *acl = acl_wild_hosts->begin();
+         acl != acl_wild_hosts->end(); ++acl) {
+      if (acl->compare_hostname(host, ip)) return false;  // Host ok
+    }
   }
 
   if (ip != nullptr) {
@@ -2430,6 +2463,8 @@ static size_t parse_client_handshake_packet(THD *thd, MPVIO_EXT *mpvio,
       protocol->has_client_capability(CLIENT_COMPRESS);
   bool is_server_supports_zstd =
       protocol->has_client_capability(CLIENT_ZSTD_COMPRESSION_ALGORITHM);
+  bool is_server_supports_zstd_stream =
+      protocol->has_client_capability(CLIENT_ZSTD_STREAM_COMPRESSION);
   DBUG_ASSERT(mpvio->status == MPVIO_EXT::FAILURE);
 
   uint charset_code = 0;
@@ -2706,6 +2741,8 @@ skip_to_ssl:
       protocol->has_client_capability(CLIENT_COMPRESS);
   bool is_client_supports_zstd =
       protocol->has_client_capability(CLIENT_ZSTD_COMPRESSION_ALGORITHM);
+  bool is_client_supports_zstd_stream =
+      protocol->has_client_capability(CLIENT_ZSTD_STREAM_COMPRESSION);
 
   if (is_client_supports_zlib && is_server_supports_zlib) {
     strcpy(compression->compress_algorithm, COMPRESSION_ALGORITHM_ZLIB);
@@ -2715,7 +2752,16 @@ skip_to_ssl:
     */
     compression->compress_level = 6;
   } else if (is_client_supports_zstd && is_server_supports_zstd) {
-    strcpy(compression->compress_algorithm, COMPRESSION_ALGORITHM_ZSTD);
+    /*
+      When both ends can carry zstd compression history across packets,
+      upgrade to the streamed variant; the compression level byte below is
+      shared with plain zstd.
+    */
+    if (is_client_supports_zstd_stream && is_server_supports_zstd_stream)
+      strcpy(compression->compress_algorithm,
+             COMPRESSION_ALGORITHM_ZSTD_STREAM);
+    else
+      strcpy(compression->compress_algorithm, COMPRESSION_ALGORITHM_ZSTD);
     compression->compress_level = (uint) * (end);
     end += 1;
     bytes_remaining_in_packet -= 1;
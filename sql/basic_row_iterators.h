@@ -44,6 +44,7 @@ class Filesort_info;
 class Item;
 class QEP_TAB;
 class QUICK_SELECT_I;
+class Record_buffer;
 class Sort_result;
 class THD;
 class handler;
@@ -77,6 +78,18 @@ class TableScanIterator final : public TableRowIterator {
   uchar *const m_record;
   QEP_TAB *const m_qep_tab;
   ha_rows *const m_examined_rows;
+
+  /**
+    If non-nullptr, rows are fetched in batches through
+    handler::ha_fetch_batch() into this buffer and served from it,
+    instead of one handler call per row. Set up by Init() when the
+    scan is eligible for a record buffer.
+  */
+  Record_buffer *m_record_buffer{nullptr};
+  /// The position of the next row to serve from m_record_buffer.
+  ha_rows m_record_buffer_pos{0};
+  /// Error that ended the last batch, to report once the buffer is drained.
+  int m_pending_error{0};
 };
 
 /** Perform a full index scan along an index. */
@@ -29,6 +29,7 @@
 #include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <zlib.h>  // crc32_combine
 
 #include "lex_string.h"
 #include "map_helpers.h"
@@ -51,6 +52,7 @@
 #include <queue>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "dur_prop.h"
 #include "libbinlogevents/include/compression/base.h"
@@ -576,6 +578,40 @@ class binlog_cache_data {
   }
 
   Binlog_cache_storage *get_cache() { return &m_cache; }
+
+  /**
+    Checksum of one event's bytes, computed while the event was being
+    serialized into the cache.
+
+    The common event header is rewritten when the cache is flushed to the
+    binary log (end_log_pos is only known at that point, and the event
+    length grows by the checksum field), but the bytes following the
+    header are final once the event is in the cache. Checksumming them
+    here, in the session, leaves only the 19 header bytes per event to be
+    checksummed during the flush stage, under LOCK_log.
+
+    @see Binlog_event_writer
+  */
+  struct Event_checksum {
+    /// Cache offset just past the event's last byte.
+    my_off_t end_pos;
+    /// Number of event bytes following the common header.
+    uint32 body_len;
+    /// CRC-32 of those bytes, seeded with my_checksum(0L, nullptr, 0).
+    ha_checksum body_crc;
+  };
+
+  /**
+    Body checksums for the events in the cache, in cache order. An event
+    may lack an entry (e.g. it was cached while binlog_checksum was OFF),
+    so consumers must match entries against the event stream by end_pos
+    and body_len, and checksum the body themselves when an event has no
+    matching entry.
+  */
+  const std::vector<Event_checksum> &event_checksums() const {
+    return m_event_checksums;
+  }
+
   int finalize(THD *thd, Log_event *end_event);
   int finalize(THD *thd, Log_event *end_event, XID_STATE *xs);
   int flush(THD *thd, my_off_t *bytes, bool *wrote_xid);
@@ -695,6 +731,7 @@ class binlog_cache_data {
     */
     cache_state_map.clear();
     event_counter = 0;
+    m_event_checksums.clear();
     m_compressed_size = 0;
     m_decompressed_size = 0;
     m_compression_type = binary_log::transaction::compression::NONE;
@@ -802,6 +839,11 @@ class binlog_cache_data {
 
     // TODO: check the return value.
     (void)m_cache.truncate(pos);
+
+    // Drop the checksums of events that were (even partially) cut off.
+    while (!m_event_checksums.empty() &&
+           m_event_checksums.back().end_pos > pos)
+      m_event_checksums.pop_back();
   }
 
   /**
@@ -902,6 +944,13 @@ class binlog_cache_data {
    */
   Rows_log_event *m_pending;
 
+  /*
+    Body checksums of the events in m_cache, @see event_checksums().
+    Maintained by write_event(); any code path that modifies m_cache
+    behind write_event's back must drop the affected entries.
+  */
+  std::vector<Event_checksum> m_event_checksums;
+
   /**
     This function computes binlog cache and disk usage.
   */
@@ -1232,6 +1281,12 @@ static int binlog_dummy_recover(handlerton *, XA_recover_txn *, uint,
   - end_log_pos is set
   - the checksum is computed if checksums are enabled
   - the length is incremented by the checksum size if checksums are enabled
+
+  The event body does not change here, so when the cache being flushed
+  carries body checksums that were computed while the events were
+  serialized into it (@see binlog_cache_data::Event_checksum), only the
+  rewritten header is checksummed under LOCK_log and the two CRCs are
+  combined.
 */
 class Binlog_event_writer : public Basic_ostream {
   MYSQL_BIN_LOG::Binlog_ofile *m_binlog_file;
@@ -1242,6 +1297,21 @@ class Binlog_event_writer : public Basic_ostream {
   uchar header[LOG_EVENT_HEADER_LEN];
   my_off_t header_len = 0;
   uint32 event_len = 0;
+  /*
+    Body checksums recorded when the events entered the cache that is
+    being flushed. The range is empty until set_event_checksums() is
+    called, so the events written before the cache contents (the
+    Gtid_log_event) are checksummed the usual way.
+  */
+  const binlog_cache_data::Event_checksum *m_next_body_checksum = nullptr;
+  const binlog_cache_data::Event_checksum *m_body_checksums_end = nullptr;
+  /// Number of cache bytes consumed since set_event_checksums().
+  my_off_t m_cache_offset = 0;
+  /// True while the current event's body checksum was precomputed.
+  bool m_body_checksum_valid = false;
+  /// The precomputed checksum and the number of body bytes it covers.
+  ha_checksum m_body_checksum = 0;
+  uint32 m_body_checksum_len = 0;
 
  public:
   /**
@@ -1262,6 +1332,26 @@ class Binlog_event_writer : public Basic_ostream {
     if (DBUG_EVALUATE_IF("fault_injection_crc_value", 1, 0)) checksum--;
   }
 
+  /**
+    Makes the writer reuse the body checksums that were computed when the
+    events entered the given cache, so that only the rewritten event
+    headers are checksummed here, under LOCK_log. Must be called right
+    before the cache contents are streamed into the writer. Events whose
+    recorded entry does not match the byte stream (e.g. checksums were
+    switched on after the event was cached) are checksummed the usual
+    way.
+
+    @param checksums The checksums of the cache about to be written,
+                     @see binlog_cache_data::event_checksums().
+  */
+  void set_event_checksums(
+      const std::vector<binlog_cache_data::Event_checksum> &checksums) {
+    m_next_body_checksum = checksums.data();
+    m_body_checksums_end = checksums.data() + checksums.size();
+    m_cache_offset = 0;
+    m_body_checksum_valid = false;
+  }
+
   void update_header() {
     event_len = uint4korr(header + EVENT_LEN_OFFSET);
 
@@ -1277,7 +1367,28 @@ class Binlog_event_writer : public Basic_ostream {
     // Store end_log_pos
     int4store(header + LOG_POS_OFFSET, end_log_pos);
     // update the checksum
-    if (have_checksum) checksum = my_checksum(checksum, header, header_len);
+    if (have_checksum) {
+      checksum = my_checksum(checksum, header, header_len);
+
+      /*
+        Pick the body checksum recorded when this event entered the
+        cache, if it covers exactly the body bytes that will follow.
+      */
+      const uint32 body_len = event_len - LOG_EVENT_HEADER_LEN;
+      const my_off_t body_end = m_cache_offset + body_len;
+      m_body_checksum_valid = false;
+      while (m_next_body_checksum != m_body_checksums_end &&
+             m_next_body_checksum->end_pos < body_end)
+        ++m_next_body_checksum;
+      if (m_next_body_checksum != m_body_checksums_end &&
+          m_next_body_checksum->end_pos == body_end &&
+          m_next_body_checksum->body_len == body_len) {
+        m_body_checksum = m_next_body_checksum->body_crc;
+        m_body_checksum_len = body_len;
+        m_body_checksum_valid = true;
+        ++m_next_body_checksum;
+      }
+    }
   }
 
   bool write(const unsigned char *buffer, my_off_t length) {
@@ -1294,6 +1405,7 @@ class Binlog_event_writer : public Basic_ostream {
         header_len += header_incr;
         buffer += header_incr;
         length -= header_incr;
+        m_cache_offset += header_incr;
 
         if (header_len == LOG_EVENT_HEADER_LEN) {
           update_header();
@@ -1307,18 +1419,31 @@ class Binlog_event_writer : public Basic_ostream {
 
         if (m_binlog_file->write(buffer, write_bytes)) return true;
 
-        // update the checksum
-        if (have_checksum)
+        // update the checksum, unless the body was checksummed already
+        // when it entered the cache
+        if (have_checksum && !m_body_checksum_valid)
           checksum = my_checksum(checksum, buffer, write_bytes);
 
         event_len -= write_bytes;
         length -= write_bytes;
         buffer += write_bytes;
+        m_cache_offset += write_bytes;
 
         // The whole event is copied, now add the checksum
         if (have_checksum && event_len == 0) {
           uchar checksum_buf[BINLOG_CHECKSUM_LEN];
 
+          /*
+            The accumulated checksum covers the rewritten header only;
+            fold in the checksum of the body bytes that was computed
+            when the event entered the cache.
+          */
+          if (m_body_checksum_valid) {
+            checksum = static_cast<ha_checksum>(
+                crc32_combine(checksum, m_body_checksum, m_body_checksum_len));
+            m_body_checksum_valid = false;
+          }
+
           int4store(checksum_buf, checksum);
           if (m_binlog_file->write(checksum_buf, BINLOG_CHECKSUM_LEN))
             return true;
@@ -1379,6 +1504,61 @@ static int binlog_close_connection(handlerton *, THD *thd) {
   return 0;
 }
 
+/**
+  Basic_ostream that forwards everything to a binlog cache and computes a
+  CRC-32 over the part of the stream following the common event header.
+
+  binlog_cache_data::write_event() serializes exactly one event through
+  it, so the first LOG_EVENT_HEADER_LEN bytes are the event header (which
+  is rewritten at flush time and therefore cannot be checksummed here)
+  and everything after them is the event body.
+*/
+class Event_checksum_ostream : public Basic_ostream {
+ public:
+  /**
+    @param sink     The binlog cache the event is serialized into.
+    @param collect  Whether to compute the body checksum. When false the
+                    stream only counts bytes.
+  */
+  Event_checksum_ostream(Basic_ostream *sink, bool collect)
+      : m_sink(sink),
+        m_collect(collect),
+        m_length(0),
+        m_crc(my_checksum(0L, nullptr, 0)) {}
+
+  bool write(const unsigned char *buffer, my_off_t length) override {
+    if (m_sink->write(buffer, length)) return true;
+    if (!m_collect) {
+      m_length += length;
+      return false;
+    }
+    if (m_length < LOG_EVENT_HEADER_LEN) {
+      my_off_t header_part =
+          std::min<my_off_t>(LOG_EVENT_HEADER_LEN - m_length, length);
+      m_length += header_part;
+      buffer += header_part;
+      length -= header_part;
+    }
+    if (length > 0) {
+      m_crc = my_checksum(m_crc, buffer, length);
+      m_length += length;
+    }
+    return false;
+  }
+
+  bool is_collecting() const { return m_collect; }
+  /// Returns the number of bytes serialized so far, header included.
+  my_off_t length() const { return m_length; }
+  /// Returns the CRC-32 of the bytes following the header.
+  ha_checksum crc() const { return m_crc; }
+
+ private:
+  Basic_ostream *m_sink;
+  bool m_collect;
+  my_off_t m_length;
+  ha_checksum m_crc;
+};
+
 int binlog_cache_data::write_event(Log_event *ev) {
   DBUG_TRACE;
 
@@ -1386,7 +1566,19 @@ int binlog_cache_data::write_event(Log_event *ev) {
     DBUG_EXECUTE_IF("simulate_disk_full_at_flush_pending",
                     { DBUG_SET("+d,simulate_file_write_error"); });
 
-    if (binary_event_serialize(ev, &m_cache)) {
+    /*
+      Compute the body checksum while serializing, so that flushing the
+      cache to the binary log does not have to re-read the body bytes
+      under LOCK_log, @see Binlog_event_writer. If binlog_checksum is
+      switched between now and the flush, the recorded entry simply
+      fails to match there and the flush falls back to checksumming the
+      body itself.
+    */
+    Event_checksum_ostream checksum_ostream(
+        &m_cache,
+        binlog_checksum_options != binary_log::BINLOG_CHECKSUM_ALG_OFF);
+
+    if (binary_event_serialize(ev, &checksum_ostream)) {
       DBUG_EXECUTE_IF("simulate_disk_full_at_flush_pending", {
         DBUG_SET("-d,simulate_file_write_error");
         DBUG_SET("-d,simulate_disk_full_at_flush_pending");
@@ -1401,6 +1593,13 @@ int binlog_cache_data::write_event(Log_event *ev) {
       });
       return 1;
     }
+    if (checksum_ostream.is_collecting() &&
+        checksum_ostream.length() > LOG_EVENT_HEADER_LEN)
+      m_event_checksums.push_back(
+          {m_cache.length(),
+           static_cast<uint32>(checksum_ostream.length() -
+                               LOG_EVENT_HEADER_LEN),
+           checksum_ostream.crc()});
     if (ev->get_type_code() == binary_log::XID_EVENT) flags.with_xid = true;
     if (ev->is_using_immediate_logging()) flags.immediate = true;
     /* DDL gets marked as xid-requiring at its caching. */
@@ -1925,6 +2124,8 @@ bool binlog_cache_data::compress(THD *thd) {
 
     ctype = compressor->compression_type_code();
 
+    // the whole cache is fed to the compressor before it is closed
+    compressor->set_pledged_input_size(size);
     compressor->open();
 
     // inject the compressor in the output stream
@@ -1943,8 +2144,9 @@ bool binlog_cache_data::compress(THD *thd) {
 
     if ((error = m_cache.truncate(0))) goto compression_end;
     // Since we deleted all events from the cache, we also need to
-    // reset event_counter.
+    // reset event_counter and drop the checksums computed for them.
     event_counter = 0;
+    m_event_checksums.clear();
 
     // fill in the new transport event
     std::tie(buffer, size, std::ignore) = compressor->get_buffer();
@@ -4368,6 +4570,7 @@ bool MYSQL_BIN_LOG::find_first_log_not_in_gtid_set(char *binlog_file_name,
   int error = log_index.first;
   list<string>::reverse_iterator rit;
   Gtid_set binlog_previous_gtid_set{gtid_set->get_sid_map()};
+  ulonglong cache_generation = 0;
 
   if (error != LOG_INFO_EOF) {
     *errmsg =
@@ -4404,40 +4607,98 @@ bool MYSQL_BIN_LOG::find_first_log_not_in_gtid_set(char *binlog_file_name,
   while (rit != filename_list.rend()) {
     binlog_previous_gtid_set.clear();
     const char *filename = rit->c_str();
-    DBUG_PRINT("info",
-               ("Read Previous_gtids_log_event from filename='%s'", filename));
-    switch (read_gtids_from_binlog(filename, nullptr, &binlog_previous_gtid_set,
-                                   first_gtid,
-                                   binlog_previous_gtid_set.get_sid_map(),
-                                   opt_master_verify_checksum, is_relay_log)) {
-      case ERROR:
+    bool cache_hit = false;
+    bool truncated = false;
+
+    /*
+      The Previous_gtids_log_event of every scanned file is cached, so
+      repeated lookups (e.g. many replicas reconnecting after a restart)
+      do not open and scan old binary logs again.
+    */
+    mysql_mutex_lock(&LOCK_index);
+    cache_generation = m_previous_gtid_cache_generation;
+    {
+      const auto cache_it = m_previous_gtid_set_cache.find(*rit);
+      if (cache_it != m_previous_gtid_set_cache.end()) {
+        if (binlog_previous_gtid_set.add_gtid_encoding(
+                pointer_cast<const uchar *>(cache_it->second.data()),
+                cache_it->second.length()) == RETURN_STATUS_OK)
+          cache_hit = true;
+        else
+          binlog_previous_gtid_set.clear(); /* purecov: inspected */
+      }
+    }
+    mysql_mutex_unlock(&LOCK_index);
+
+    if (!cache_hit) {
+      DBUG_PRINT("info", ("Read Previous_gtids_log_event from filename='%s'",
+                          filename));
+      switch (read_gtids_from_binlog(
+          filename, nullptr, &binlog_previous_gtid_set, first_gtid,
+          binlog_previous_gtid_set.get_sid_map(), opt_master_verify_checksum,
+          is_relay_log)) {
+        case ERROR:
+          *errmsg =
+              "Error reading header of binary log while looking for "
+              "the oldest binary log that contains any GTID that is not in "
+              "the given gtid set";
+          error = -3;
+          goto end;
+        case NO_GTIDS:
+          *errmsg =
+              "Found old binary log without GTIDs while looking for "
+              "the oldest binary log that contains any GTID that is not in "
+              "the given gtid set";
+          error = -4;
+          goto end;
+        case GOT_GTIDS:
+        case GOT_PREVIOUS_GTIDS: {
+          std::string encoded_gtid_set;
+          encoded_gtid_set.resize(binlog_previous_gtid_set.get_encoded_length());
+          binlog_previous_gtid_set.encode(
+              pointer_cast<uchar *>(&encoded_gtid_set.front()));
+          mysql_mutex_lock(&LOCK_index);
+          /*
+            Do not insert if a RESET MASTER happened meanwhile: the file
+            just read is deleted and its name will be reused.
+          */
+          if (cache_generation == m_previous_gtid_cache_generation)
+            m_previous_gtid_set_cache.emplace(*rit,
+                                              std::move(encoded_gtid_set));
+          mysql_mutex_unlock(&LOCK_index);
+          break;
+        }
+        case TRUNCATED:
+          truncated = true;
+          break;
+      }
+    }
+
+    if (!truncated && binlog_previous_gtid_set.is_subset(gtid_set)) {
+      strcpy(binlog_file_name, filename);
+      /*
+        On a cache hit the file was not opened above, so read the first
+        GTID from the selected file only.
+      */
+      if (cache_hit && first_gtid != nullptr &&
+          read_gtids_from_binlog(filename, nullptr, nullptr, first_gtid,
+                                 binlog_previous_gtid_set.get_sid_map(),
+                                 opt_master_verify_checksum,
+                                 is_relay_log) == ERROR) {
         *errmsg =
             "Error reading header of binary log while looking for "
             "the oldest binary log that contains any GTID that is not in "
             "the given gtid set";
         error = -3;
         goto end;
-      case NO_GTIDS:
-        *errmsg =
-            "Found old binary log without GTIDs while looking for "
-            "the oldest binary log that contains any GTID that is not in "
-            "the given gtid set";
-        error = -4;
-        goto end;
-      case GOT_GTIDS:
-      case GOT_PREVIOUS_GTIDS:
-        if (binlog_previous_gtid_set.is_subset(gtid_set)) {
-          strcpy(binlog_file_name, filename);
-          /*
-            Verify that the selected binlog is not the first binlog,
-          */
-          DBUG_EXECUTE_IF("slave_reconnect_with_gtid_set_executed",
-                          DBUG_ASSERT(strcmp(filename_list.begin()->c_str(),
-                                             binlog_file_name) != 0););
-          goto end;
-        }
-      case TRUNCATED:
-        break;
+      }
+      /*
+        Verify that the selected binlog is not the first binlog,
+      */
+      DBUG_EXECUTE_IF("slave_reconnect_with_gtid_set_executed",
+                      DBUG_ASSERT(strcmp(filename_list.begin()->c_str(),
+                                         binlog_file_name) != 0););
+      goto end;
     }
 
     rit++;
@@ -5557,6 +5818,15 @@ bool MYSQL_BIN_LOG::reset_logs(THD *thd, bool delete_only) {
   mysql_mutex_lock(&LOCK_log);
   mysql_mutex_lock(&LOCK_index);
 
+  /*
+    All log files are deleted and their names reused, so the cached
+    Previous_gtids_log_events are invalid. Bumping the generation also
+    invalidates cache insertions computed from files read before this
+    point by threads that do not hold LOCK_index.
+  */
+  m_previous_gtid_set_cache.clear();
+  m_previous_gtid_cache_generation++;
+
   if (is_relay_log)
     sid_lock = previous_gtid_set_relaylog->get_sid_map()->get_sid_lock();
   else
@@ -5923,6 +6193,15 @@ int MYSQL_BIN_LOG::purge_logs(const char *to_log, bool included,
     goto err;
   }
 
+  /*
+    Drop the cached Previous_gtids_log_events of the purged files. The
+    names of purged files are never reused, so an entry that is left
+    behind here only wastes a little memory.
+  */
+  m_previous_gtid_set_cache.erase(
+      m_previous_gtid_set_cache.begin(),
+      m_previous_gtid_set_cache.lower_bound(log_info.log_file_name));
+
   // Update gtid_state->lost_gtids
   if (!is_relay_log) {
     global_sid_lock->wrlock();
@@ -7494,6 +7773,12 @@ bool MYSQL_BIN_LOG::write_cache(THD *thd, binlog_cache_data *cache_data,
       function). Check if we can replace this by an assertion. /Sven
     */
     if (!cache->is_empty()) {
+      /*
+        Reuse the body checksums computed when the events entered the
+        cache; only the rewritten event headers are checksummed under
+        LOCK_log. @see Binlog_event_writer::set_event_checksums.
+      */
+      writer->set_event_checksums(cache_data->event_checksums());
       DBUG_EXECUTE_IF("crash_before_writing_xid", {
         if (do_write_cache(cache, writer))
           DBUG_PRINT("info", ("error writing binlog cache: %d", write_error));
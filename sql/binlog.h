@@ -27,6 +27,8 @@
 #include <sys/types.h>
 #include <time.h>
 #include <atomic>
+#include <map>
+#include <string>
 #include <utility>
 
 #include "libbinlogevents/include/binlog_event.h"  // enum_binlog_checksum_alg
@@ -210,6 +212,22 @@ class MYSQL_BIN_LOG : public TC_LOG {
   */
   IO_CACHE purge_index_file;
   char purge_index_file_name[FN_REFLEN];
+  /*
+    Cache of the Previous_gtids_log_event of binary log files, keyed by
+    file name and holding the encoded Gtid_set read from the file's
+    header. The header of a binary log never changes once written, so an
+    entry stays valid for as long as its file is listed in the index
+    file. It saves dump threads from opening and scanning old binary
+    logs when looking up the start file for a GTID set. Protected by
+    LOCK_index.
+  */
+  std::map<std::string, std::string> m_previous_gtid_set_cache;
+  /*
+    Incremented by reset_logs() under LOCK_index. Cache insertions
+    computed from a file that was read before a RESET MASTER are
+    discarded, since the file names are reused afterwards.
+  */
+  ulonglong m_previous_gtid_cache_generation = 0;
   /*
      The max size before rotation (usable only if log_type == LOG_BIN: binary
      logs and relay logs).
@@ -68,6 +68,15 @@ bool Binlog_event_data_istream::read_event_header() {
       m_header, LOG_EVENT_MINIMAL_HEADER_LEN);
 }
 
+bool Binlog_event_data_istream::read_event_header(unsigned char *header,
+                                                  unsigned int *length) {
+  DBUG_TRACE;
+  if (read_event_header() || check_event_header()) return true;
+  memcpy(header, m_header, LOG_EVENT_MINIMAL_HEADER_LEN);
+  *length = m_event_length;
+  return false;
+}
+
 bool Binlog_event_data_istream::fill_event_data(
     unsigned char *event_data, bool verify_checksum,
     enum_binlog_checksum_alg checksum_alg) {
@@ -97,6 +97,22 @@ class Binlog_event_data_istream {
     return false;
   }
 
+  /**
+     Read only the header of the next event, leaving its data in the stream.
+     After the call the stream is positioned between the header and the
+     event data, so the caller has to seek either back to the beginning of
+     the event to read it as a whole or forward past the event data. It
+     allows callers which filter events by type to skip the event data
+     without copying it anywhere.
+
+     @param[out] header Buffer where the event header is stored. It must be
+                        at least LOG_EVENT_MINIMAL_HEADER_LEN bytes long.
+     @param[out] length The length of the full event, including header.
+     @retval false Succeed
+     @retval true Error
+  */
+  bool read_event_header(unsigned char *header, unsigned int *length);
+
  protected:
   unsigned char m_header[LOG_EVENT_MINIMAL_HEADER_LEN];
   /**
@@ -312,6 +328,13 @@ class Basic_binlog_file_reader {
                                           m_verify_checksum,
                                           m_fde.footer()->checksum_alg);
   }
+  /**
+     Wrapper of EVENT_DATA_ISTREAM::read_event_header.
+  */
+  bool read_event_header(unsigned char *header, unsigned int *length) {
+    m_event_start_pos = position();
+    return m_data_istream.read_event_header(header, length);
+  }
   /**
      wrapper of EVENT_OBJECT_ISTREAM::read_event_object.
   */
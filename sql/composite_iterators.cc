@@ -24,11 +24,13 @@
 
 #include <string.h>
 
+#include <algorithm>
 #include <atomic>
 #include <string>
 #include <vector>
 
 #include "my_inttypes.h"
+#include "mysqld_error.h"
 #include "scope_guard.h"
 #include "sql/basic_row_iterators.h"
 #include "sql/debug_sync.h"
@@ -38,11 +40,14 @@
 #include "sql/filesort.h"
 #include "sql/handler.h"
 #include "sql/item.h"
+#include "sql/item_cmpfunc.h"
 #include "sql/item_sum.h"
 #include "sql/key.h"
+#include "sql/mysqld.h"
 #include "sql/opt_explain.h"
 #include "sql/opt_trace.h"
 #include "sql/pfs_batch_mode.h"
+#include "sql/psi_memory_key.h"
 #include "sql/sql_base.h"
 #include "sql/sql_class.h"
 #include "sql/sql_executor.h"
@@ -74,12 +79,50 @@ void SwitchSlice(JOIN *join, int slice_num) {
 
 }  // namespace
 
+bool FilterIterator::Init() {
+  /*
+    A WHERE clause with several conjuncts is evaluated through a virtual call
+    on the AND item plus a walk of its linked argument list for every row.
+    The plan is final by now, so flatten the conjunction into a contiguous
+    array once and let Read() evaluate the conjuncts directly instead. For
+    filtering, the two are equivalent: a row passes if and only if every
+    conjunct evaluates to true (UNKNOWN rejects the row in both cases).
+  */
+  if (m_condition_parts == nullptr && m_condition->type() == Item::COND_ITEM &&
+      down_cast<Item_cond *>(m_condition)->functype() ==
+          Item_func::COND_AND_FUNC) {
+    List<Item> *args = down_cast<Item_cond *>(m_condition)->argument_list();
+    DBUG_ASSERT(args->elements >= 2);
+    Item **parts = thd()->mem_root->ArrayAlloc<Item *>(args->elements);
+    if (parts == nullptr) return true;
+    uint i = 0;
+    List_iterator_fast<Item> li(*args);
+    for (Item *item = li++; item != nullptr; item = li++) {
+      parts[i++] = item;
+    }
+    m_num_condition_parts = args->elements;
+    m_condition_parts = parts;
+  }
+  return m_source->Init();
+}
+
 int FilterIterator::Read() {
   for (;;) {
     int err = m_source->Read();
     if (err != 0) return err;
 
-    bool matched = m_condition->val_int();
+    bool matched;
+    if (m_condition_parts != nullptr) {
+      matched = true;
+      for (uint i = 0; i < m_num_condition_parts; ++i) {
+        if (!m_condition_parts[i]->val_bool()) {
+          matched = false;
+          break;
+        }
+      }
+    } else {
+      matched = m_condition->val_int();
+    }
 
     if (thd()->killed) {
       thd()->send_kill_message();
@@ -1316,18 +1359,126 @@ int StreamingIterator::Read() {
   return 0;
 }
 
+// The number of partition files input rows are spilled to if the in-memory
+// temporary table becomes full during aggregation. With a group key hash that
+// distributes the groups evenly, each partition needs roughly
+// 1/kAggregateSpillChunks of the memory the full set of groups would have
+// needed, so this lets us aggregate inputs with about sixteen times more
+// groups than what fits in memory without falling back to on-disk updates.
+static constexpr size_t kAggregateSpillChunks = 16;
+
 TemptableAggregateIterator::TemptableAggregateIterator(
     THD *thd, unique_ptr_destroy_only<RowIterator> subquery_iterator,
     Temp_table_param *temp_table_param, TABLE *table,
     unique_ptr_destroy_only<RowIterator> table_iterator, SELECT_LEX *select_lex,
-    JOIN *join, int ref_slice)
+    JOIN *join, int ref_slice, qep_tab_map input_tables_map,
+    QEP_TAB *output_qep_tab)
     : TableRowIterator(thd, table),
       m_subquery_iterator(move(subquery_iterator)),
       m_table_iterator(move(table_iterator)),
       m_temp_table_param(temp_table_param),
       m_select_lex(select_lex),
       m_join(join),
-      m_ref_slice(ref_slice) {}
+      m_ref_slice(ref_slice),
+      m_input_tables_map(input_tables_map),
+      m_output_qep_tab(output_qep_tab),
+      m_spill_chunks(thd->mem_root) {}
+
+bool TemptableAggregateIterator::CanSpill() const {
+  // We need to know which tables the input rows come from in order to write
+  // them to chunk files, and we need a group key to partition them by.
+  if (m_input_tables_map == 0) return false;
+  if (!using_hash_key() && table()->group == nullptr) return false;
+
+  // Spill in exactly the situations where create_ondisk_from_heap() would
+  // otherwise convert the table to an on-disk table; for other engines (or
+  // when TempTable takes care of overflow itself by memory-mapped files),
+  // a full table is a hard error.
+  const handlerton *hton = table()->s->db_type();
+  return hton == heap_hton ||
+         (hton == temptable_hton && !temptable_use_mmap);
+}
+
+bool TemptableAggregateIterator::InitializeSpill() {
+  m_spill_input_tables =
+      hash_join_buffer::TableCollection(m_join, m_input_tables_map);
+
+  m_spill_chunks.clear();
+  for (size_t i = 0; i < kAggregateSpillChunks; ++i) {
+    HashJoinChunk chunk;
+    if (chunk.Init(m_spill_input_tables, /*uses_match_flags=*/false) ||
+        m_spill_chunks.push_back(move(chunk))) {
+      my_error(ER_TEMP_FILE_WRITE_FAILURE, MYF(0));
+      return true;
+    }
+  }
+
+  if (!m_spill_input_tables.has_blob_column()) {
+    // StoreFromTableBuffers() expects the buffer to be pre-allocated if there
+    // are no blob columns.
+    const size_t upper_row_size =
+        hash_join_buffer::ComputeRowSizeUpperBound(m_spill_input_tables);
+    if (m_spill_row_buffer.reserve(upper_row_size)) {
+      my_error(ER_OUTOFMEMORY, MYF(0), upper_row_size);
+      return true;
+    }
+  }
+
+  m_spill_active = true;
+  return false;
+}
+
+bool TemptableAggregateIterator::SpillRowToChunk() {
+  ulonglong hash;
+  if (using_hash_key()) {
+    // check_unique_constraint() has just computed the group hash and stored
+    // it in the hash field.
+    hash = static_cast<ulonglong>(table()->hash_field->val_int());
+  } else {
+    // The group fields were just filled in for the index lookup.
+    hash = unique_hash_group(table()->group);
+  }
+
+  HashJoinChunk &chunk = m_spill_chunks[hash % m_spill_chunks.size()];
+  return chunk.WriteRowToChunk(&m_spill_row_buffer, /*matched=*/false);
+}
+
+bool TemptableAggregateIterator::FlushGroupsToChunk(HashJoinChunk *chunk,
+                                                    String *buffer) {
+  table()->file->ha_index_end();
+  int error = table()->file->ha_rnd_init(true);
+  if (error != 0) {
+    PrintError(error);
+    return true;
+  }
+  for (;;) {
+    error = table()->file->ha_rnd_next(table()->record[0]);
+    if (error == HA_ERR_END_OF_FILE) break;
+    if (error == HA_ERR_RECORD_DELETED) continue;
+    if (error != 0) {
+      PrintError(error);
+      table()->file->ha_rnd_end();
+      return true;
+    }
+    if (chunk->WriteRowToChunk(buffer, /*matched=*/false)) {
+      table()->file->ha_rnd_end();
+      return true;
+    }
+  }
+  table()->file->ha_rnd_end();
+
+  error = table()->file->ha_delete_all_rows();
+  if (error != 0) {
+    PrintError(error);
+    return true;
+  }
+  error = table()->file->ha_index_init(0, false);
+  if (error != 0) {
+    PrintError(error);
+    return true;
+  }
+  return false;
+}
 
 bool TemptableAggregateIterator::Init() {
   // NOTE: We never scan these tables more than once, so we don't need to
@@ -1358,6 +1509,11 @@ bool TemptableAggregateIterator::Init() {
     table()->file->ha_delete_all_rows();
   }
 
+  // Reset the spill state, in case we are re-materialized (e.g. as part of a
+  // LATERAL join).
+  m_spill_active = false;
+  m_spill_chunks.clear();
+
   // Initialize the index used for finding the groups.
   if (table()->file->ha_index_init(0, false)) {
     return true;
@@ -1365,19 +1521,13 @@ bool TemptableAggregateIterator::Init() {
   auto end_unique_index =
       create_scope_guard([&] { table()->file->ha_index_end(); });
 
-  PFSBatchMode pfs_batch_mode(m_subquery_iterator.get());
-  for (;;) {
-    int read_error = m_subquery_iterator->Read();
-    if (read_error > 0 || thd()->is_error())  // Fatal error
-      return true;
-    else if (read_error < 0)
-      break;
-    else if (thd()->killed)  // Aborted by user
-    {
-      thd()->send_kill_message();
-      return true;
-    }
-
+  // Process the row that lies in the record buffers of the input tables:
+  // find its group in the temporary table and update the running aggregates,
+  // or insert a new group. If 'allow_spill' is true and the table is full,
+  // the row may instead be written out to a spill chunk file, to be replayed
+  // later; during replay itself, a full table falls back to converting the
+  // table to disk. Returns true on error.
+  const auto process_row = [&](bool allow_spill) -> bool {
     // See comment below.
     DBUG_ASSERT(m_temp_table_param->grouped_expressions.size() == 0);
 
@@ -1424,7 +1574,15 @@ bool TemptableAggregateIterator::Init() {
         PrintError(error);
         return true;
       }
-      continue;
+      return false;
+    }
+
+    // The group is not in the table. If the table has already overflowed
+    // main memory, do not try to grow it further; write the input row to
+    // its spill partition instead, and aggregate it when the partition is
+    // replayed.
+    if (m_spill_active && allow_spill) {
+      return SpillRowToChunk();
     }
 
     // OK, we need to insert a new row; we need to materialize any items
@@ -1485,6 +1643,17 @@ bool TemptableAggregateIterator::Init() {
           }
         }
       }
+
+      // The table is full. Switch to grace hash aggregation if we can: the
+      // input row whose group did not fit (and every later row belonging to
+      // a group we have not already seen) is partitioned out to a chunk file
+      // by a hash of its group key, and each partition is aggregated in
+      // memory in turn once the input is exhausted.
+      if (allow_spill && error == HA_ERR_RECORD_FILE_FULL && CanSpill()) {
+        if (InitializeSpill()) return true;
+        return SpillRowToChunk();
+      }
+
       if (create_ondisk_from_heap(thd(), table(), error, false, nullptr)) {
         end_unique_index.commit();
         return true;  // Not a table_is_full error.
@@ -1497,6 +1666,114 @@ bool TemptableAggregateIterator::Init() {
         return true;
       }
     }
+    return false;
+  };
+
+  {
+    PFSBatchMode pfs_batch_mode(m_subquery_iterator.get());
+    for (;;) {
+      int read_error = m_subquery_iterator->Read();
+      if (read_error > 0 || thd()->is_error())  // Fatal error
+        return true;
+      else if (read_error < 0)
+        break;
+      else if (thd()->killed)  // Aborted by user
+      {
+        thd()->send_kill_message();
+        return true;
+      }
+
+      if (process_row(/*allow_spill=*/true)) return true;
+    }
+  }
+
+  if (m_spill_active) {
+    // Finish the grace hash aggregation. The temporary table is full of
+    // finished groups, and the spill chunk files hold the input rows for all
+    // groups we have not seen yet. Aggregate one partition at a time: first
+    // move the groups already in the table out of the way by writing them to
+    // a chunk file of their own and emptying the table, then replay the
+    // partition's input rows through the regular aggregation path above.
+    // Since a row is only spilled when its group is not in the table, the
+    // groups produced by different partitions (and by the initial read
+    // phase) are all disjoint, so at the end, the saved groups can simply be
+    // re-inserted. The first insert that does not fit converts the table to
+    // an on-disk table through create_ondisk_from_heap() as usual; the same
+    // happens if a single partition does not fit in memory, in which case
+    // the remaining partitions are aggregated directly into the on-disk
+    // table.
+    hash_join_buffer::TableCollection output_table(m_output_qep_tab);
+    HashJoinChunk finished_groups;
+    if (finished_groups.Init(output_table, /*uses_match_flags=*/false)) {
+      my_error(ER_TEMP_FILE_WRITE_FAILURE, MYF(0));
+      return true;
+    }
+    String output_row_buffer;
+    if (!output_table.has_blob_column()) {
+      const size_t upper_row_size =
+          hash_join_buffer::ComputeRowSizeUpperBound(output_table);
+      if (output_row_buffer.reserve(upper_row_size)) {
+        my_error(ER_OUTOFMEMORY, MYF(0), upper_row_size);
+        return true;
+      }
+    }
+
+    for (HashJoinChunk &chunk : m_spill_chunks) {
+      if (table()->s->db_type() != innodb_hton) {
+        if (FlushGroupsToChunk(&finished_groups, &output_row_buffer)) {
+          end_unique_index.commit();  // The index is already closed.
+          return true;
+        }
+      }
+
+      if (chunk.Rewind()) return true;
+      for (ha_rows row_idx = chunk.num_rows(); row_idx > 0; --row_idx) {
+        if (thd()->killed) {
+          thd()->send_kill_message();
+          return true;
+        }
+        bool matched_dummy;
+        if (chunk.LoadRowFromChunk(&m_spill_row_buffer, &matched_dummy)) {
+          return true;
+        }
+        if (process_row(/*allow_spill=*/false)) return true;
+      }
+
+      // Close the partition file as soon as we are done with it.
+      chunk = HashJoinChunk();
+    }
+    m_spill_chunks.clear();
+
+    // Put the groups we moved out of the way back into the table. They are
+    // all distinct from each other and from what is in the table, so any
+    // write error is a full table, handled as in the regular path.
+    if (finished_groups.Rewind()) return true;
+    for (ha_rows row_idx = finished_groups.num_rows(); row_idx > 0;
+         --row_idx) {
+      if (thd()->killed) {
+        thd()->send_kill_message();
+        return true;
+      }
+      bool matched_dummy;
+      if (finished_groups.LoadRowFromChunk(&output_row_buffer,
+                                           &matched_dummy)) {
+        return true;
+      }
+      int error = table()->file->ha_write_row(table()->record[0]);
+      if (error != 0) {
+        if (create_ondisk_from_heap(thd(), table(), error, false, nullptr)) {
+          end_unique_index.commit();
+          return true;
+        }
+        // Table's engine changed, index is not initialized anymore
+        error = table()->file->ha_index_init(0, false);
+        if (error != 0) {
+          end_unique_index.commit();
+          PrintError(error);
+          return true;
+        }
+      }
+    }
   }
 
   table()->file->ha_index_end();
@@ -1763,6 +2040,105 @@ vector<string> NestedLoopSemiJoinWithDuplicateRemovalIterator::DebugString()
           m_key->name};
 }
 
+/// Arbitrary xxHash64 seed for SemiJoinResultCacheIterator's verdict cache.
+static constexpr uint32_t kSemiJoinResultCacheSeed{881171};
+
+SemiJoinResultCacheIterator::SemiJoinResultCacheIterator(
+    THD *thd, unique_ptr_destroy_only<RowIterator> source, TABLE *table,
+    TABLE_REF *ref, const rowid_statuses *rowid_status,
+    size_t max_memory_available)
+    : RowIterator(thd),
+      m_source(move(source)),
+      m_table(table),
+      m_ref(ref),
+      m_rowid_status(rowid_status),
+      m_mem_root(key_memory_hash_join, 16384 /* 16 kB */),
+      m_cache(/*bucket_count=*/10,
+              hash_join_buffer::KeyHasher(kSemiJoinResultCacheSeed),
+              std::equal_to<hash_join_buffer::Key>(),
+              Mem_root_allocator<std::pair<const hash_join_buffer::Key, bool>>(
+                  &m_mem_root)),
+      m_max_memory_available(
+          std::max<size_t>(max_memory_available, 16384 /* 16 kB */)) {
+  DBUG_ASSERT(m_source != nullptr);
+  DBUG_ASSERT(m_ref->key_parts > 0);
+}
+
+bool SemiJoinResultCacheIterator::Init() {
+  m_current_result = CachedResult::kUnknown;
+  m_store_verdict = false;
+
+  if (*m_rowid_status != NO_ROWID_NEEDED) {
+    // A weedout above us may ask for the row ID of the last row read from the
+    // inner table; serving a match without actually reading a row would leave
+    // a stale row ID behind. Act as a passthrough.
+    return m_source->Init();
+  }
+
+  // Build the lookup key for the current outer row up front, so that the
+  // cache can be consulted before the inner side is started. (The index
+  // lookup below us will build the same key again from the same outer row;
+  // that copy is cheap compared to the index dive it saves on a hit.)
+  if (construct_lookup_ref(thd(), m_table, m_ref)) {
+    // The key value cannot be represented in the index's format, so the
+    // lookup cannot match anything; the index lookup iterator would come to
+    // the same conclusion. Don't bother starting the inner side, but don't
+    // remember the verdict either, since key_buff does not hold a usable key.
+    m_current_result = CachedResult::kNoMatch;
+    return false;
+  }
+
+  const auto it = m_cache.find(
+      hash_join_buffer::Key(m_ref->key_buff, m_ref->key_length));
+  if (it != m_cache.end()) {
+    m_current_result =
+        it->second ? CachedResult::kMatch : CachedResult::kNoMatch;
+    return false;  // No need to start the inner side.
+  }
+
+  m_store_verdict = m_mem_root.allocated_size() <= m_max_memory_available;
+  return m_source->Init();
+}
+
+int SemiJoinResultCacheIterator::Read() {
+  switch (m_current_result) {
+    case CachedResult::kMatch:
+      // Serve the match without reading a row; nothing above a semijoin may
+      // look at the inner table's fields. The nested loop reads at most one
+      // row from the inner side, but should it ever come back, report EOF.
+      m_current_result = CachedResult::kNoMatch;
+      return 0;
+    case CachedResult::kNoMatch:
+      return -1;
+    case CachedResult::kUnknown:
+      break;
+  }
+
+  const int err = m_source->Read();
+  if (err == 1) {
+    return 1;  // Error.
+  }
+
+  if (m_store_verdict) {
+    m_store_verdict = false;
+    // The inner side has rebuilt the same key from the same outer row, so
+    // key_buff still holds the key we looked up in Init().
+    uchar *key_bytes = m_mem_root.ArrayAlloc<uchar>(m_ref->key_length);
+    if (key_bytes != nullptr) {
+      memcpy(key_bytes, m_ref->key_buff, m_ref->key_length);
+      m_cache.emplace(hash_join_buffer::Key(key_bytes, m_ref->key_length),
+                      err == 0);
+    }
+  }
+
+  return err;
+}
+
+vector<string> SemiJoinResultCacheIterator::DebugString() const {
+  return {string("Reuse semijoin results for duplicate keys on ") +
+          m_table->alias + " using " + m_table->key_info[m_ref->key].name};
+}
+
 WindowingIterator::WindowingIterator(
     THD *thd, unique_ptr_destroy_only<RowIterator> source,
     Temp_table_param *temp_table_param, JOIN *join, int output_slice)
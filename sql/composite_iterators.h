@@ -42,6 +42,7 @@
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "my_alloc.h"
@@ -49,7 +50,9 @@
 #include "my_dbug.h"
 #include "my_table_map.h"
 #include "prealloced_array.h"
+#include "sql/hash_join_chunk.h"
 #include "sql/item.h"
+#include "sql/mem_root_array.h"
 #include "sql/row_iterator.h"
 #include "sql/table.h"
 
@@ -57,8 +60,10 @@ class FollowTailIterator;
 template <class T>
 class List;
 class JOIN;
+class QEP_TAB;
 class SELECT_LEX;
 class SJ_TMP_TABLE;
+struct TABLE_REF;
 class THD;
 class Temp_table_param;
 class Window;
@@ -74,7 +79,7 @@ class FilterIterator final : public RowIterator {
                  Item *condition)
       : RowIterator(thd), m_source(move(source)), m_condition(condition) {}
 
-  bool Init() override { return m_source->Init(); }
+  bool Init() override;
 
   int Read() override;
 
@@ -97,6 +102,16 @@ class FilterIterator final : public RowIterator {
  private:
   unique_ptr_destroy_only<RowIterator> m_source;
   Item *m_condition;
+
+  /**
+    If the condition is a conjunction (AND), its conjuncts laid out in a
+    contiguous array by Init(), so that Read() can evaluate them without
+    going through the AND item and its linked argument list for every row.
+    nullptr if the condition is not a conjunction.
+  */
+  Item **m_condition_parts{nullptr};
+  /// Number of items in m_condition_parts.
+  uint m_num_condition_parts{0};
 };
 
 /**
@@ -790,6 +805,13 @@ class StreamingIterator final : public TableRowIterator {
   Aggregates unsorted data into a temporary table, using update operations
   to keep running aggregates. After that, works as a MaterializeIterator
   in that it allows the temporary table to be scanned.
+
+  If the temporary table overflows main memory and we know which tables the
+  input rows come from, we switch to grace hash aggregation instead of
+  converting the table to disk and updating it row by row: input rows whose
+  group is not already in memory are partitioned out to chunk files by a hash
+  of the group key (reusing HashJoinChunk from hash join), and each partition
+  is then aggregated in memory in turn. See Init() for details.
  */
 class TemptableAggregateIterator final : public TableRowIterator {
  public:
@@ -797,7 +819,8 @@ class TemptableAggregateIterator final : public TableRowIterator {
       THD *thd, unique_ptr_destroy_only<RowIterator> subquery_iterator,
       Temp_table_param *temp_table_param, TABLE *table,
       unique_ptr_destroy_only<RowIterator> table_iterator,
-      SELECT_LEX *select_lex, JOIN *join, int ref_slice);
+      SELECT_LEX *select_lex, JOIN *join, int ref_slice,
+      qep_tab_map input_tables_map, QEP_TAB *output_qep_tab);
 
   bool Init() override;
   int Read() override;
@@ -825,8 +848,59 @@ class TemptableAggregateIterator final : public TableRowIterator {
   JOIN *const m_join;
   const int m_ref_slice;
 
+  /// The QEP_TABs the subquery iterator reads its rows from, used for
+  /// serializing input rows to spill chunk files. Zero if unknown, in which
+  /// case we never spill and fall back to converting the temporary table to
+  /// disk when it becomes full.
+  const qep_tab_map m_input_tables_map;
+
+  /// The QEP_TAB for the temporary table we aggregate into, used for
+  /// serializing finished group rows when moving them out of the way between
+  /// spill partitions.
+  QEP_TAB *const m_output_qep_tab;
+
+  /// The input tables, set up from m_input_tables_map when the first spill
+  /// happens.
+  hash_join_buffer::TableCollection m_spill_input_tables;
+
+  /// Partition files holding input rows whose group did not fit in the
+  /// in-memory temporary table.
+  Mem_root_array<HashJoinChunk> m_spill_chunks;
+
+  /// Buffer used when writing input rows to, and reading them back from,
+  /// the spill chunk files.
+  String m_spill_row_buffer;
+
+  /// True after the temporary table has overflowed and we have started
+  /// writing input rows to spill chunk files.
+  bool m_spill_active{false};
+
   // See MaterializeIterator::doing_hash_deduplication().
   bool using_hash_key() const { return table()->hash_field; }
+
+  /// Whether we can switch to grace hash aggregation if the temporary table
+  /// becomes full, instead of converting it to an on-disk table.
+  bool CanSpill() const;
+
+  /// Set up the spill chunk files. Called when the in-memory temporary table
+  /// becomes full for the first time.
+  ///
+  /// @retval true on error.
+  bool InitializeSpill();
+
+  /// Write the input row that lies in the record buffers of the input tables
+  /// to the spill chunk file its group key hashes to.
+  ///
+  /// @retval true on error.
+  bool SpillRowToChunk();
+
+  /// Move all rows in the temporary table out of the way of the next spill
+  /// partition: write them to 'chunk', then empty the table. The unique index
+  /// on the table is closed and reopened around the row scan.
+  ///
+  /// @retval true on error. The index is left closed, so the caller must not
+  ///   try to close it again.
+  bool FlushGroupsToChunk(HashJoinChunk *chunk, String *buffer);
 };
 
 /**
@@ -1038,6 +1112,104 @@ class NestedLoopSemiJoinWithDuplicateRemovalIterator final
   bool m_deduplicate_against_previous_row;
 };
 
+/**
+  An iterator that remembers, per lookup key, whether the inner side of a
+  nested-loop semijoin produced at least one row. It sits directly on top of
+  the inner side when that side is a single table driven by an index lookup
+  whose only dependency on the outer side goes through the lookup key, e.g.:
+
+    -> Nested loop semijoin
+       -> Table scan on t1
+       -> Reuse semijoin results for duplicate keys  <--- this iterator
+          -> Filter: (t2.b > 3)
+              -> Index lookup on t2 using t2_x (x=t1.x)
+
+  A semijoin only cares whether the inner side matched, and since the inner
+  side here is a pure function of the key, outer rows repeating a key can
+  reuse the verdict from the first time that key was seen, instead of diving
+  into the index (and re-running any attached filters) again. This bounds the
+  damage when the optimizer picks FirstMatch based on a row estimate for the
+  outer side that turns out to be far too low: once each distinct key has
+  been seen, the plan behaves as if the distinct keys of the inner side had
+  been materialized up-front, without paying that cost for small outer sides.
+
+  Memory for remembered keys is bounded by join_buff_size. When the budget is
+  spent, verdicts already remembered are still served from the cache, while
+  new keys simply fall through to the inner side.
+
+  When a match is served from the cache, no row is brought into the inner
+  table's record buffer. That is fine for a semijoin, since no expression
+  above it may refer to the inner table's fields. The iterator is made
+  inoperative when row IDs of the inner table may be requested (weedout), and
+  is not created at all when the inner side must be rematerialized per outer
+  row (LATERAL), or when the lookup key or any attached condition is
+  non-deterministic or refers to outer fields not part of the key; see the
+  checks at the creation site in ConnectJoins().
+ */
+class SemiJoinResultCacheIterator final : public RowIterator {
+ public:
+  SemiJoinResultCacheIterator(THD *thd,
+                              unique_ptr_destroy_only<RowIterator> source,
+                              TABLE *table, TABLE_REF *ref,
+                              const rowid_statuses *rowid_status,
+                              size_t max_memory_available);
+
+  bool Init() override;
+
+  int Read() override;
+
+  std::vector<std::string> DebugString() const override;
+
+  std::vector<Child> children() const override {
+    return std::vector<Child>{{m_source.get(), ""}};
+  }
+
+  void SetNullRowFlag(bool is_null_row) override {
+    m_source->SetNullRowFlag(is_null_row);
+  }
+
+  void EndPSIBatchModeIfStarted() override {
+    m_source->EndPSIBatchModeIfStarted();
+  }
+
+  void UnlockRow() override { m_source->UnlockRow(); }
+
+ private:
+  enum class CachedResult : char { kUnknown, kMatch, kNoMatch };
+
+  unique_ptr_destroy_only<RowIterator> const m_source;
+  TABLE *const m_table;
+  TABLE_REF *const m_ref;
+
+  /// Where the executor wants row IDs of the inner table to come from. This
+  /// may still change after the iterator is created (later weedouts), so it
+  /// is inspected on every Init(); anything but NO_ROWID_NEEDED turns the
+  /// iterator into a passthrough.
+  const rowid_statuses *const m_rowid_status;
+
+  /// Backing store for remembered key bytes and the hash map nodes.
+  MEM_ROOT m_mem_root;
+
+  /// Remembered verdicts (true = the key matched at least one row), keyed on
+  /// the bytes of the lookup key as built into TABLE_REF::key_buff.
+  std::unordered_map<
+      hash_join_buffer::Key, bool, hash_join_buffer::KeyHasher,
+      std::equal_to<hash_join_buffer::Key>,
+      Mem_root_allocator<std::pair<const hash_join_buffer::Key, bool>>>
+      m_cache;
+
+  const size_t m_max_memory_available;
+
+  /// The verdict for the current outer row, if it is known without reading
+  /// the inner side.
+  CachedResult m_current_result{CachedResult::kUnknown};
+
+  /// Whether the verdict for the current key should be remembered once it is
+  /// known. False on cache hits, when the key could not be built, and once
+  /// the memory budget is exhausted.
+  bool m_store_verdict{false};
+};
+
 /**
   WindowingIterator is similar to AggregateIterator, but deals with windowed
   aggregates (i.e., OVER expressions). It deals specifically with aggregates
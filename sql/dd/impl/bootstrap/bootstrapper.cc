@@ -933,6 +933,14 @@ bool restart(THD *thd) {
   bootstrap::DD_bootstrap_ctx::instance().set_stage(bootstrap::Stage::FINISHED);
   LogErr(INFORMATION_LEVEL, ER_DD_VERSION_FOUND, d->get_actual_dd_version(thd));
 
+  /*
+    Warm the shared dictionary cache with the table objects which were
+    cached at the previous shutdown, so that the first access to each
+    table after restart doesn't pay a synchronous DD lookup. Failure to
+    preload must not prevent server startup, so the result is ignored.
+  */
+  cache::Shared_dictionary_cache::preload_from_file(thd);
+
   return false;
 }
 
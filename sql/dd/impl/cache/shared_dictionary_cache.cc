@@ -22,11 +22,16 @@
 
 #include "sql/dd/impl/cache/shared_dictionary_cache.h"
 
+#include <fcntl.h>
+#include <stdlib.h>
 #include <atomic>
+#include <vector>
 
 #include "my_dbug.h"
+#include "my_sys.h"  // my_fopen(), fn_format()
 #include "sql/dd/impl/cache/shared_multi_map.h"
 #include "sql/dd/impl/cache/storage_adapter.h"  // Storage_adapter
+#include "sql/dd/object_id.h"                   // Object_id
 #include "sql/mysqld.h"
 #include "sql/sql_class.h"  // THD::is_error()
 
@@ -36,6 +41,18 @@ namespace cache {
 template <typename T>
 class Cache_element;
 
+/**
+  Name of the file in the data directory holding the ids of the table
+  objects which were cached at the time of the previous shutdown.
+*/
+static const char *dd_cache_preload_file = "dictionary_cache.dump";
+
+/** Get the full path of the dictionary cache preload file. */
+static char *preload_file_path(char *buff) {
+  return fn_format(buff, dd_cache_preload_file, mysql_real_data_home, "",
+                   MY_UNPACK_FILENAME);
+}
+
 Shared_dictionary_cache *Shared_dictionary_cache::instance() {
   static Shared_dictionary_cache s_cache;
   return &s_cache;
@@ -86,6 +103,57 @@ bool Shared_dictionary_cache::reset_tables_and_tablespaces(THD *thd) {
           instance()->m_map<Tablespace>()->reset(thd));
 }
 
+// Dump the ids of the cached table objects to the preload file.
+bool Shared_dictionary_cache::dump_preload_file() {
+  std::vector<Object_id> ids;
+  instance()->m_map<Abstract_table>()->get_cached_ids(&ids);
+
+  char path[FN_REFLEN + 1];
+  FILE *file = my_fopen(preload_file_path(path), O_WRONLY, MYF(0));
+  if (file == nullptr) return true;
+
+  bool error = false;
+  for (Object_id id : ids) {
+    if (fprintf(file, "%llu\n", static_cast<unsigned long long>(id)) < 0) {
+      error = true;
+      break;
+    }
+  }
+
+  return (my_fclose(file, MYF(0)) != 0) || error;
+}
+
+// Warm the cache with the table objects listed in the preload file.
+bool Shared_dictionary_cache::preload_from_file(THD *thd) {
+  char path[FN_REFLEN + 1];
+  FILE *file = my_fopen(preload_file_path(path), O_RDONLY, MYF(0));
+
+  // A missing preload file is not an error, there is just nothing to do.
+  if (file == nullptr) return false;
+
+  char line[32];
+  while (fgets(line, sizeof(line), file) != nullptr) {
+    const Object_id id =
+        static_cast<Object_id>(strtoull(line, nullptr, 10));
+    if (id == INVALID_OBJECT_ID || id == 0) continue;
+
+    Abstract_table::Id_key key(id);
+    Cache_element<Abstract_table> *element = nullptr;
+    if (instance()->get(thd, key, &element)) {
+      // Failure to warm the cache must not prevent server startup.
+      thd->clear_error();
+      break;
+    }
+    // Objects dropped since the file was written are not found, and are
+    // silently skipped. Loaded objects are released right away, leaving
+    // them in the free list for the first client acquisition.
+    if (element != nullptr) instance()->release(element);
+  }
+
+  my_fclose(file, MYF(0));
+  return false;
+}
+
 // Get an element from the cache, given the key.
 template <typename K, typename T>
 bool Shared_dictionary_cache::get(THD *thd, const K &key,
@@ -24,6 +24,7 @@
 #define DD_CACHE__SHARED_DICTIONARY_CACHE_INCLUDED
 
 #include <stdio.h>
+#include <vector>
 
 #include "sql/dd/impl/cache/shared_multi_map.h"  // Shared_multi_map
 #include "sql/dd/types/abstract_table.h"
@@ -197,6 +198,37 @@ class Shared_dictionary_cache {
   // Reset the table and tablespace partitions.
   static bool reset_tables_and_tablespaces(THD *thd);
 
+  /**
+    Dump the ids of the cached table objects to the dictionary cache
+    preload file in the data directory.
+
+    Intended to be called at shutdown, so that the next startup can warm
+    the cache with the same set of objects instead of paying a synchronous
+    DD lookup for the first access to each table.
+
+    @retval  false  No error.
+    @retval  true   Error (could not write the preload file).
+  */
+
+  static bool dump_preload_file();
+
+  /**
+    Warm the cache by bulk-loading the table objects listed in the
+    dictionary cache preload file, if it exists.
+
+    Each listed object is loaded through the ordinary cache miss path and
+    released immediately, leaving it in the free list ready for the first
+    client acquisition. Objects which have been dropped since the file was
+    written are silently skipped. Errors are swallowed, since failure to
+    warm the cache must not prevent server startup.
+
+    @param  thd  Thread context.
+
+    @retval  false  Always (failures only cut the preloading short).
+  */
+
+  static bool preload_from_file(THD *thd);
+
   /**
     Check if an element with the given key is available.
 
@@ -294,6 +326,21 @@ class Shared_dictionary_cache {
     m_map<T>()->release(e);
   }
 
+  /**
+    Release a batch of elements used by a client.
+
+    The whole batch is released under a single lock acquisition on the
+    map handling the object type.
+
+    @tparam  T         Dictionary object type.
+    @param   elements  Elements to release.
+  */
+
+  template <typename T>
+  void release(const std::vector<Cache_element<T> *> &elements) {
+    m_map<T>()->release(elements);
+  }
+
   /**
     Delete an element from the cache.
 
@@ -244,6 +244,16 @@ bool Shared_multi_map<T>::reset(THD *thd) {
   return false;
 }
 
+// Get the object ids of all objects present in the shared map.
+template <typename T>
+void Shared_multi_map<T>::get_cached_ids(std::vector<Object_id> *ids) {
+  Autolocker lock(this);
+  typename Element_map<const T *, Cache_element<T>>::Const_iterator it =
+      m_map<const T *>()->begin();
+  for (; it != m_map<const T *>()->end(); it++)
+    ids->push_back(it->second->object()->id());
+}
+
 // Get a wrapper element from the map handling the given key type.
 template <typename T>
 template <typename K>
@@ -389,6 +399,21 @@ void Shared_multi_map<T>::put(const K *key, const T *object,
 template <typename T>
 void Shared_multi_map<T>::release(Cache_element<T> *element) {
   Autolocker lock(this);
+  release(element, &lock);
+}
+
+// Release a batch of elements under a single lock acquisition.
+template <typename T>
+void Shared_multi_map<T>::release(
+    const std::vector<Cache_element<T> *> &elements) {
+  Autolocker lock(this);
+  for (Cache_element<T> *element : elements) release(element, &lock);
+}
+
+// Release one element, assuming the lock is already held.
+template <typename T>
+void Shared_multi_map<T>::release(Cache_element<T> *element, Autolocker *lock) {
+  mysql_mutex_assert_owner(&m_lock);
 
 #ifndef DBUG_OFF
   // The object must be present, and its usage must be > 0.
@@ -415,7 +440,7 @@ void Shared_multi_map<T>::release(Cache_element<T> *element) {
   // If the element is not used, add it to the free list.
   if (element->usage() == 0) {
     m_free_list.add_last(element);
-    rectify_free_list(&lock);
+    rectify_free_list(lock);
   }
 }
 
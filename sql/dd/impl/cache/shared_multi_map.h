@@ -39,6 +39,7 @@
 #include "sql/dd/cache/multi_map_base.h"      // Multi_map_base
 #include "sql/dd/impl/cache/cache_element.h"  // Cache_element
 #include "sql/dd/impl/cache/free_list.h"      // Free_list
+#include "sql/dd/object_id.h"                 // Object_id
 #include "sql/dd/types/abstract_table.h"
 #include "sql/dd/types/charset.h"
 #include "sql/dd/types/collation.h"
@@ -241,6 +242,19 @@ class Shared_multi_map : public Multi_map_base<T> {
 
   void remove(Cache_element<T> *element, Autolocker *lock);
 
+  /**
+    Release one element, assuming the lock is already held.
+
+    The element must be present and in use. If the element becomes
+    unused, it is added to the free list, which is then rectified to
+    enforce its capacity constraints.
+
+    @param  element   Element pointer.
+    @param  lock      Autolocker already holding the map lock.
+  */
+
+  void release(Cache_element<T> *element, Autolocker *lock);
+
   /**
     Check if the current map capacity is exceeded.
 
@@ -325,6 +339,17 @@ class Shared_multi_map : public Multi_map_base<T> {
 
   bool reset(THD *thd);
 
+  /**
+    Get the object ids of all objects present in the shared map.
+
+    Used for dumping the list of cached objects at shutdown so that the
+    cache can be warmed at the next startup.
+
+    @param [out] ids   Vector to which the object ids are appended.
+  */
+
+  void get_cached_ids(std::vector<Object_id> *ids);
+
   /**
     Set capacity of the shared map.
   */
@@ -433,6 +458,18 @@ class Shared_multi_map : public Multi_map_base<T> {
 
   void release(Cache_element<T> *element);
 
+  /**
+    Release a batch of elements.
+
+    The whole batch is released under a single lock acquisition, saving
+    one mutex round trip per element compared to releasing the elements
+    one by one. Each element must be present and in use.
+
+    @param   elements   Elements to release.
+  */
+
+  void release(const std::vector<Cache_element<T> *> &elements);
+
   /**
     Delete an element from the map.
 
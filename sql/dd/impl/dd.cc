@@ -68,6 +68,11 @@ bool init(enum_dd_init_type dd_init) {
 ///////////////////////////////////////////////////////////////////////////
 
 bool shutdown() {
+  /*
+    Dump the ids of the cached table objects before the cache is emptied,
+    so that the next startup can warm the cache with the same objects.
+  */
+  cache::Shared_dictionary_cache::dump_preload_file();
   cache::Shared_dictionary_cache::shutdown();
   return Dictionary_impl::shutdown();
 }
@@ -7196,6 +7196,17 @@ static void lo_inc_statement_sort_scan_v2(PSI_statement_locker *locker,
   }
 }
 
+static void lo_inc_statement_storage_io_stats_v2(PSI_statement_locker *locker,
+                                                 ulonglong read_requests,
+                                                 ulonglong reads,
+                                                 ulonglong pages_dirtied,
+                                                 ulonglong bytes_read) {
+  if (g_statement_chain != nullptr) {
+    g_statement_chain->inc_statement_storage_io_stats(
+        locker, read_requests, reads, pages_dirtied, bytes_read);
+  }
+}
+
 static void lo_set_statement_no_index_used_v2(PSI_statement_locker *locker) {
   if (g_statement_chain != nullptr) {
     g_statement_chain->set_statement_no_index_used(locker);
@@ -7778,7 +7789,8 @@ PSI_statement_service_v2 LO_statement_v2 = {
     lo_release_sp_share_v2,
     lo_start_sp_v2,
     lo_end_sp_v2,
-    lo_drop_sp_v2};
+    lo_drop_sp_v2,
+    lo_inc_statement_storage_io_stats_v2};
 
 static void *lo_get_statement_interface(int version) {
   switch (version) {
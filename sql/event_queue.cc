@@ -568,9 +568,17 @@ bool Event_queue::get_top_for_execution_if_time(
       /*
         Not yet time for top event, wait on condition with
         time or until signaled. Release LOCK_queue while waiting.
+
+        Activation times have whole-second resolution but the current
+        time does not, so a seconds-based timeout would oversleep the
+        activation point by up to a second. Wait with nanosecond
+        resolution up to the exact second boundary instead.
       */
       struct timespec top_time;
-      set_timespec(&top_time, next_activation_at - thd->query_start_in_secs());
+      set_timespec_nsec(
+          &top_time,
+          (next_activation_at - thd->query_start_in_secs()) * 1000000000ULL -
+              static_cast<ulonglong>(thd->start_time.tv_usec) * 1000ULL);
 
       /* Release any held audit resources before waiting */
       mysql_audit_release(thd);
@@ -36,6 +36,7 @@
 
 #include "sql/filesort.h"
 
+#include <fcntl.h>
 #include <limits.h>
 #include <math.h>
 #include <stddef.h>
@@ -217,6 +218,8 @@ void Sort_param::init_for_filesort(Filesort *file_sort,
 
   local_sortorder = sf_array;
 
+  weight_cache.reset();
+
   decide_addon_fields(file_sort, table, file_sort->m_force_sort_positions);
   if (using_addon_fields()) {
     fixed_res_length = m_addon_length;
@@ -628,6 +631,14 @@ err:
       outfile->end_of_file = save_pos;
     }
   }
+  if (param->weight_cache.hits() > 0 || param->weight_cache.misses() > 0) {
+    thd->status_var.filesort_key_cache_hits += param->weight_cache.hits();
+    thd->status_var.filesort_key_cache_misses += param->weight_cache.misses();
+    // Also releases the cached weight strings; a subsequent invocation
+    // starts over, since its data may well have different cardinality.
+    param->weight_cache.reset();
+  }
+
   if (error) {
     DBUG_ASSERT(thd->is_error() || thd->killed);
   } else
@@ -1223,11 +1234,18 @@ static inline longlong get_int_sort_key_for_item_inline(Item *item) {
   varlength prefix (if varlen and not NULL), and then the actual sort key.
   Returns the length of the key, sans NULL indicator byte and varlength prefix,
   or UINT_MAX if the value would not provably fit within the given bounds.
+
+  For non-JSON string values, <weight_cache> (if non-nullptr) is consulted
+  before computing the weight string, and updated afterwards; <field_idx> is
+  the index of the sort field, used to keep entries for different sort fields
+  apart in the cache.
 */
 size_t make_sortkey_from_item(Item *item, Item_result result_type,
                               Nullable<size_t> dst_length, String *tmp_buffer,
                               uchar *to, uchar *to_end, bool *maybe_null,
-                              ulonglong *hash) {
+                              ulonglong *hash,
+                              Sort_key_weight_cache *weight_cache,
+                              uint field_idx) {
   bool is_varlen = !dst_length.has_value();
 
   uchar *null_indicator = nullptr;
@@ -1275,6 +1293,32 @@ size_t make_sortkey_from_item(Item *item, Item_result result_type,
       uint src_length = static_cast<uint>(res->length());
       const char *from = res->ptr();
 
+      /*
+        See if we already computed the weights for this exact value. The
+        collation, maximum length and flags are fixed per sort field, so the
+        source bytes determine the result of the strnxfrm() calls below.
+      */
+      const bool use_weight_cache =
+          weight_cache != nullptr && weight_cache->applicable(src_length);
+      if (use_weight_cache) {
+        const std::string *weights =
+            weight_cache->lookup(field_idx, from, src_length);
+        if (weights != nullptr) {
+          if (is_varlen) {
+            size_t max_length = to_end - to;
+            if (max_length % 2 != 0) --max_length;
+            // Mirror the overflow contract of the cache-miss path below:
+            // a full-length result cannot be told apart from a truncated one.
+            if (weights->size() >= max_length) return UINT_MAX;
+            memcpy(to, weights->data(), weights->size());
+            return weights->size();
+          }
+          DBUG_ASSERT(weights->size() == dst_length.value());
+          memcpy(to, weights->data(), weights->size());
+          return weights->size();
+        }
+      }
+
       size_t actual_length;
       if (is_varlen) {
         size_t max_length = to_end - to;
@@ -1300,6 +1344,9 @@ size_t make_sortkey_from_item(Item *item, Item_result result_type,
         DBUG_ASSERT(actual_length == dst_length.value());
       }
       DBUG_ASSERT(to + actual_length <= to_end);
+      // Only complete (untruncated) results reach this point, so the weights
+      // are valid for any destination buffer and safe to remember.
+      if (use_weight_cache) weight_cache->insert(to, actual_length);
       return actual_length;
     }
     case INT_RESULT: {
@@ -1406,9 +1453,10 @@ uint Sort_param::make_sortkey(Bounds_checked_array<uchar> dst,
     Item *item = sort_field->item;
     DBUG_ASSERT(sort_field->field_type == item->data_type());
 
-    actual_length =
-        make_sortkey_from_item(item, sort_field->result_type, dst_length,
-                               &tmp_buffer, to, to_end, &maybe_null, &hash);
+    actual_length = make_sortkey_from_item(
+        item, sort_field->result_type, dst_length, &tmp_buffer, to, to_end,
+        &maybe_null, &hash, &weight_cache,
+        static_cast<uint>(sort_field - local_sortorder.begin()));
 
     if (actual_length == UINT_MAX) {
       // Overflow.
@@ -1754,6 +1802,25 @@ static uint read_to_buffer(IO_CACHE *fromfile, Merge_chunk *merge_chunk,
     merge_chunk->advance_file_position(num_bytes_read);
     merge_chunk->decrement_rowcount(count);
     merge_chunk->set_mem_count(count);
+
+#ifdef HAVE_POSIX_FADVISE
+    // We will come back for the rest of this chunk's rows once the buffer we
+    // just filled has been consumed. Tell the kernel to start reading the
+    // next piece into the page cache in the background, so that the next
+    // refill does not stall on disk while the merge has plenty of CPU work
+    // to overlap it with.
+    if (merge_chunk->rowcount() > 0) {
+      const size_t bytes_ahead =
+          min(merge_chunk->buffer_size(),
+              static_cast<size_t>(fromfile->end_of_file -
+                                  merge_chunk->file_position()));
+      if (bytes_ahead > 0) {
+        posix_fadvise(fromfile->file, merge_chunk->file_position(),
+                      bytes_ahead, POSIX_FADV_WILLNEED);
+      }
+    }
+#endif
+
     return num_bytes_read;
   }
 
@@ -1794,6 +1861,127 @@ struct Merge_chunk_greater {
   }
 };
 
+/**
+  A tournament tree (loser tree) over the merge chunks, replacing the binary
+  heap previously used by merge_buffers(). Advancing the winner only replays
+  the matches along its leaf-to-root path against the losers stored in the
+  inner nodes, i.e. exactly ceil(log2(k)) comparisons per row, where the heap
+  needs up to two comparisons per level to sift down. For wide merges this
+  roughly halves the number of key comparisons, which is where most of the
+  merge CPU time goes.
+
+  Exhausted chunks are not removed from the tree; they simply lose every
+  match, so they fall out of the way after one replay.
+ */
+class Merge_tournament_tree {
+ public:
+  explicit Merge_tournament_tree(const Merge_chunk_greater &greater)
+      : m_greater(greater),
+        m_chunks(Malloc_allocator<Merge_chunk *>(key_memory_Filesort_info_merge)),
+        m_losers(Malloc_allocator<size_t>(key_memory_Filesort_info_merge)),
+        m_exhausted(Malloc_allocator<char>(key_memory_Filesort_info_merge)) {}
+
+  /**
+    Set up the tree over the given chunks. Chunks that have no rows in their
+    buffer are marked as exhausted up front. Call after the chunk buffers
+    have been filled for the first time.
+
+    @returns true on out of memory.
+   */
+  bool init(Merge_chunk_array chunk_array) {
+    const size_t k = chunk_array.size();
+    try {
+      m_chunks.resize(k);
+      m_losers.resize(k);
+      m_exhausted.resize(k);
+      // Scratch space for the winners while building bottom-up.
+      std::vector<size_t, Malloc_allocator<size_t>> winners(
+          2 * k, Malloc_allocator<size_t>(key_memory_Filesort_info_merge));
+
+      for (size_t i = 0; i < k; ++i) {
+        m_chunks[i] = &chunk_array[i];
+        m_exhausted[i] = (chunk_array[i].mem_count() == 0);
+        if (!m_exhausted[i]) ++m_num_active;
+        winners[k + i] = i;  // Leaf i lives at node k + i.
+      }
+      if (k == 1) {
+        m_winner = 0;
+        return false;
+      }
+      for (size_t node = k - 1; node >= 1; --node) {
+        const size_t left = winners[2 * node];
+        const size_t right = winners[2 * node + 1];
+        winners[node] = play(left, right);
+        m_losers[node] = (winners[node] == left) ? right : left;
+      }
+      m_winner = winners[1];
+    } catch (std::bad_alloc &) {
+      return true;
+    }
+    return false;
+  }
+
+  /// Number of chunks that still have rows left.
+  size_t num_active() const { return m_num_active; }
+
+  /// The chunk holding the smallest current key.
+  Merge_chunk *top() const { return m_chunks[m_winner]; }
+
+  /**
+    Re-run the matches on the winner's path to the root, after its current
+    key has been advanced (or the chunk has been exhausted).
+   */
+  void replay_top() {
+    const size_t k = m_chunks.size();
+    size_t candidate = m_winner;
+    for (size_t node = (k + m_winner) / 2; node >= 1; node /= 2) {
+      const size_t other = m_losers[node];
+      if (play(candidate, other) == other) {
+        m_losers[node] = candidate;
+        candidate = other;
+      }
+    }
+    m_winner = candidate;
+  }
+
+  /// Mark the winning chunk as having no more rows, and find the new winner.
+  void remove_top() {
+    DBUG_ASSERT(!m_exhausted[m_winner]);
+    m_exhausted[m_winner] = true;
+    --m_num_active;
+    if (m_num_active > 0) replay_top();
+  }
+
+  /**
+    Give the buffer of a newly exhausted chunk to an adjacent chunk that is
+    still in play. Replaces reuse_freed_buff(), which walked the heap's
+    underlying container.
+   */
+  void reuse_freed_buff(Merge_chunk *old_top) const {
+    for (size_t i = 0; i < m_chunks.size(); ++i) {
+      if (m_exhausted[i]) continue;
+      if (old_top->merge_freed_buff(m_chunks[i])) return;
+    }
+    DBUG_ASSERT(false);  // Should never happen.
+  }
+
+ private:
+  /// Play a match between two leaves; exhausted chunks always lose.
+  size_t play(size_t a, size_t b) const {
+    if (m_exhausted[a]) return b;
+    if (m_exhausted[b]) return a;
+    return m_greater(m_chunks[a], m_chunks[b]) ? b : a;
+  }
+
+  Merge_chunk_greater m_greater;
+  std::vector<Merge_chunk *, Malloc_allocator<Merge_chunk *>> m_chunks;
+  /// m_losers[i] is the loser of the match at inner node i; the root is 1.
+  std::vector<size_t, Malloc_allocator<size_t>> m_losers;
+  std::vector<char, Malloc_allocator<char>> m_exhausted;
+  size_t m_winner{0};
+  size_t m_num_active{0};
+};
+
 }  // namespace
 
 /**
@@ -1847,13 +2035,6 @@ static int merge_buffers(THD *thd, Sort_param *param, IO_CACHE *from_file,
   Merge_chunk_greater mcl = param->using_varlen_keys()
                                 ? Merge_chunk_greater(param)
                                 : Merge_chunk_greater(key_len);
-  Priority_queue<Merge_chunk *,
-                 std::vector<Merge_chunk *, Malloc_allocator<Merge_chunk *>>,
-                 Merge_chunk_greater>
-      queue(mcl,
-            Malloc_allocator<Merge_chunk *>(key_memory_Filesort_info_merge));
-
-  if (queue.reserve(chunk_array.size())) return 1;
 
   for (merge_chunk = chunk_array.begin(); merge_chunk != chunk_array.end();
        merge_chunk++) {
@@ -1867,16 +2048,18 @@ static int merge_buffers(THD *thd, Sort_param *param, IO_CACHE *from_file,
     if (error == -1) return error; /* purecov: inspected */
     // If less data in buffers than expected
     merge_chunk->set_max_keys(merge_chunk->mem_count());
-    (void)queue.push(merge_chunk);
   }
 
+  Merge_tournament_tree tree(mcl);
+  if (tree.init(chunk_array)) return 1;
+
   bool seen_any_records = false;  // Used for deduplication only.
-  while (queue.size() > 1) {
+  while (tree.num_active() > 1) {
     if (thd->killed) {
       return 1; /* purecov: inspected */
     }
     for (;;) {
-      merge_chunk = queue.top();
+      merge_chunk = tree.top();
       unsigned row_length, payload_length;
       {
         param->get_rec_and_res_len(merge_chunk->current_key(), &row_length,
@@ -1913,24 +2096,24 @@ static int merge_buffers(THD *thd, Sort_param *param, IO_CACHE *from_file,
       merge_chunk->decrement_mem_count();
       if (0 == merge_chunk->mem_count()) {
         // No more records in memory for this chunk. Read more, and if there's
-        // none, take it out of the queue.
+        // none, take it out of the tournament.
         if (!(error = (int)read_to_buffer(from_file, merge_chunk, param))) {
-          queue.pop();
-          reuse_freed_buff(merge_chunk, &queue);
+          tree.remove_top();
+          tree.reuse_freed_buff(merge_chunk);
           break; /* One buffer have been removed */
         } else if (error == -1)
           return error; /* purecov: inspected */
       }
       /*
-        The Merge_chunk at the queue's top had one of its keys consumed, thus
-        it may now rank differently in the comparison order of the queue, so:
+        The Merge_chunk at the tree's top had one of its keys consumed, thus
+        it may now rank differently in the comparison order of the tree, so:
       */
-      queue.update_top();
+      tree.replay_top();
     }
   }
 
   // Only one chunk left; read all of its records.
-  merge_chunk = queue.top();
+  merge_chunk = tree.top();
   merge_chunk->set_buffer(sort_buffer.array(),
                           sort_buffer.array() + sort_buffer.size());
   merge_chunk->set_max_keys(param->max_rows_per_buffer);
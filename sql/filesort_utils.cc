@@ -23,8 +23,11 @@
 #include "sql/filesort_utils.h"
 
 #include <string.h>
+#include <string.h>
+
 #include <algorithm>
 #include <cmath>
+#include <memory>
 
 #include "add_with_saturate.h"
 #include "my_dbug.h"
@@ -120,6 +123,65 @@ class Mem_compare_varlen_key {
   bool use_hash;
 };
 
+// The longest fixed-size sort key we attempt to radix sort. Each key position
+// needs its own 256-entry histogram, and for keys much longer than this, the
+// many scatter passes lose out against the comparison-based sorts, which
+// usually decide the order within the first few bytes.
+constexpr size_t kMaxRadixSortKeyLength = 16;
+
+/*
+  A stable LSD (least-significant-digit-first) radix sort of fixed-size,
+  mem-comparable keys. All histograms are collected in a single counting pass
+  over the keys, and byte positions where all keys hold the same value are
+  skipped, so a typical 8-byte integer key (whose high bytes rarely differ) is
+  sorted in a handful of linear scatter passes instead of n log n comparisons.
+
+  'temp' must point to an array of at least 'count' elements; it is used to
+  scatter the key pointers back and forth.
+*/
+void radix_sort_keys(uchar **keys, uchar **temp, uint count, size_t key_len) {
+  DBUG_ASSERT(key_len <= kMaxRadixSortKeyLength);
+
+  uint32 counts[kMaxRadixSortKeyLength][256];
+  memset(counts, 0, sizeof(counts[0]) * key_len);
+  for (uint i = 0; i < count; ++i) {
+    const uchar *key = keys[i];
+    for (size_t pos = 0; pos < key_len; ++pos) {
+      ++counts[pos][key[pos]];
+    }
+  }
+
+  uchar **src = keys;
+  uchar **dst = temp;
+  for (size_t pos = key_len; pos-- > 0;) {
+    uint32 *histogram = counts[pos];
+
+    // If all keys hold the same value in this position, the scatter pass
+    // would only copy the array, so skip it.
+    uint first_used_value = 0;
+    while (histogram[first_used_value] == 0) ++first_used_value;
+    if (histogram[first_used_value] == count) continue;
+
+    // Turn the histogram into bucket start offsets, then scatter the keys
+    // into their buckets. Keys that are equal in this position keep their
+    // relative order, which is what makes the sort stable.
+    uint32 offset = 0;
+    for (uint value = first_used_value; value < 256; ++value) {
+      const uint32 bucket_count = histogram[value];
+      histogram[value] = offset;
+      offset += bucket_count;
+    }
+    for (uint i = 0; i < count; ++i) {
+      dst[histogram[src[i][pos]]++] = src[i];
+    }
+    std::swap(src, dst);
+  }
+
+  if (src != keys) {
+    memcpy(keys, src, count * sizeof(keys[0]));
+  }
+}
+
 template <class Comp>
 class Equality_from_less {
  public:
@@ -202,6 +264,28 @@ unsigned Filesort_buffer::sort_buffer(Sort_param *param, uint count) {
     return count;
   }
 
+  /*
+    For larger buffers with short fixed-size keys, a byte-wise radix sort
+    beats the comparison-based sorts. It is stable, so it preserves forced
+    stable sort semantics, and equal keys end up adjacent, so duplicate
+    removal works as before. The temporary pointer array is no bigger than
+    what std::stable_sort would have allocated behind our back; if we cannot
+    get it, fall through to the comparison-based sorts.
+  */
+  if (key_len > 0 && key_len <= kMaxRadixSortKeyLength) {
+    std::unique_ptr<uchar *[]> temp(new (std::nothrow) uchar *[count]);
+    if (temp != nullptr) {
+      param->m_sort_algorithm = Sort_param::FILESORT_ALG_RADIX;
+      radix_sort_keys(m_record_pointers.data(), temp.get(), count, key_len);
+      if (param->m_remove_duplicates) {
+        return unique(it_begin, it_end,
+                      Equality_from_less<Mem_compare>(Mem_compare(key_len))) -
+               it_begin;
+      }
+      return count;
+    }
+  }
+
   param->m_sort_algorithm = Sort_param::FILESORT_ALG_STD_STABLE;
   // Heuristics here: avoid function overhead call for short keys.
   if (key_len < 10) {
@@ -2966,7 +2966,7 @@ int handler::ha_rnd_next(uchar *buf) {
   DBUG_ASSERT(inited == RND);
 
   // Set status for the need to update generated fields
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   MYSQL_TABLE_IO_WAIT(PSI_TABLE_FETCH_ROW, MAX_KEY, result,
                       { result = rnd_next(buf); })
@@ -2978,6 +2978,54 @@ int handler::ha_rnd_next(uchar *buf) {
   return result;
 }
 
+/**
+  Read a batch of rows via random scan into a record buffer.
+
+  Fills @a buffer with up to Record_buffer::max_records() rows by calling
+  rnd_next() repeatedly under a single instrumentation wrapper. This
+  amortizes the per-row cost of the PSI table I/O instrumentation and the
+  handler call checks over the whole batch, which is measurable on wide
+  scans of narrow rows.
+
+  The caller owns the buffer and is responsible for copying each record
+  to TABLE::record[0] before evaluating items against it. The buffer
+  records are sized for the record prefix covering the read set only, so
+  this must not be used together with an engine-side record buffer or on
+  tables with generated columns, which have to be evaluated per row in
+  record[0].
+
+  @param[in,out] buffer  the record buffer to fill; filling starts at the
+                         current end of the buffer
+
+  @return Operation status
+    @retval 0     Success; the buffer was filled to capacity
+    @retval != 0  Error returned by the rnd_next() call that ended the
+                  batch; rows fetched before the error are in the buffer
+*/
+
+int handler::ha_fetch_batch(Record_buffer *buffer) {
+  int result = 0;
+  DBUG_TRACE;
+  DBUG_ASSERT(table_share->tmp_table != NO_TMP_TABLE || m_lock_type != F_UNLCK);
+  DBUG_ASSERT(inited == RND);
+  /* The batch buffer is driven by the caller, not the storage engine. */
+  DBUG_ASSERT(m_record_buffer == nullptr);
+  /* Virtual generated columns must be evaluated per row in
+  TABLE::record[0]. */
+  DBUG_ASSERT(!table->has_virtual_gcol());
+
+  MYSQL_TABLE_IO_WAIT(PSI_TABLE_FETCH_ROW, MAX_KEY, result, {
+    while (buffer->records() < buffer->max_records()) {
+      result = rnd_next(buffer->add_record());
+      if (result != 0) {
+        buffer->remove_last();
+        break;
+      }
+    }
+  })
+  return result;
+}
+
 /**
   Read row via random scan from position.
 
@@ -2997,7 +3045,7 @@ int handler::ha_rnd_pos(uchar *buf, uchar *pos) {
   /* DBUG_ASSERT(inited == RND); */
 
   // Set status for the need to update generated fields
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   MYSQL_TABLE_IO_WAIT(PSI_TABLE_FETCH_ROW, MAX_KEY, result,
                       { result = rnd_pos(buf, pos); })
@@ -3014,7 +3062,7 @@ int handler::ha_ft_read(uchar *buf) {
   DBUG_TRACE;
 
   // Set status for the need to update generated fields
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   result = ft_read(buf);
   if (!result && m_update_generated_read_fields) {
@@ -3057,7 +3105,7 @@ int handler::ha_sample_next(void *scan_ctx, uchar *buf) {
 
   if (m_sampling_percentage == 0.0) return HA_ERR_END_OF_FILE;
 
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   int result;
   MYSQL_TABLE_IO_WAIT(PSI_TABLE_FETCH_ROW, MAX_KEY, result,
@@ -3230,7 +3278,7 @@ int handler::ha_index_read_map(uchar *buf, const uchar *key,
   DBUG_ASSERT(!pushed_idx_cond || buf == table->record[0]);
 
   // Set status for the need to update generated fields
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   MYSQL_TABLE_IO_WAIT(PSI_TABLE_FETCH_ROW, active_index, result, {
     result = index_read_map(buf, key, keypart_map, find_flag);
@@ -3252,7 +3300,7 @@ int handler::ha_index_read_last_map(uchar *buf, const uchar *key,
   DBUG_ASSERT(!pushed_idx_cond || buf == table->record[0]);
 
   // Set status for the need to update generated fields
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   MYSQL_TABLE_IO_WAIT(PSI_TABLE_FETCH_ROW, active_index, result,
                       { result = index_read_last_map(buf, key, keypart_map); })
@@ -3280,7 +3328,7 @@ int handler::ha_index_read_idx_map(uchar *buf, uint index, const uchar *key,
   DBUG_ASSERT(!pushed_idx_cond || buf == table->record[0]);
 
   // Set status for the need to update generated fields
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   MYSQL_TABLE_IO_WAIT(PSI_TABLE_FETCH_ROW, index, result, {
     result = index_read_idx_map(buf, index, key, keypart_map, find_flag);
@@ -3312,7 +3360,7 @@ int handler::ha_index_next(uchar *buf) {
   DBUG_ASSERT(!pushed_idx_cond || buf == table->record[0]);
 
   // Set status for the need to update generated fields
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   MYSQL_TABLE_IO_WAIT(PSI_TABLE_FETCH_ROW, active_index, result,
                       { result = index_next(buf); })
@@ -3343,7 +3391,7 @@ int handler::ha_index_prev(uchar *buf) {
   DBUG_ASSERT(!pushed_idx_cond || buf == table->record[0]);
 
   // Set status for the need to update generated fields
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   MYSQL_TABLE_IO_WAIT(PSI_TABLE_FETCH_ROW, active_index, result,
                       { result = index_prev(buf); })
@@ -3374,7 +3422,7 @@ int handler::ha_index_first(uchar *buf) {
   DBUG_ASSERT(!pushed_idx_cond || buf == table->record[0]);
 
   // Set status for the need to update generated fields
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   MYSQL_TABLE_IO_WAIT(PSI_TABLE_FETCH_ROW, active_index, result,
                       { result = index_first(buf); })
@@ -3405,7 +3453,7 @@ int handler::ha_index_last(uchar *buf) {
   DBUG_ASSERT(!pushed_idx_cond || buf == table->record[0]);
 
   // Set status for the need to update generated fields
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   MYSQL_TABLE_IO_WAIT(PSI_TABLE_FETCH_ROW, active_index, result,
                       { result = index_last(buf); })
@@ -3438,7 +3486,7 @@ int handler::ha_index_next_same(uchar *buf, const uchar *key, uint keylen) {
   DBUG_ASSERT(!pushed_idx_cond || buf == table->record[0]);
 
   // Set status for the need to update generated fields
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   MYSQL_TABLE_IO_WAIT(PSI_TABLE_FETCH_ROW, active_index, result,
                       { result = index_next_same(buf, key, keylen); })
@@ -3498,7 +3546,7 @@ int handler::ha_index_read_pushed(uchar *buf, const uchar *key,
   DBUG_TRACE;
 
   // Set status for the need to update generated fields
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   int result = index_read_pushed(buf, key, keypart_map);
   if (!result && m_update_generated_read_fields) {
@@ -3513,7 +3561,7 @@ int handler::ha_index_next_pushed(uchar *buf) {
   DBUG_TRACE;
 
   // Set status for the need to update generated fields
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   int result = index_next_pushed(buf);
   if (!result && m_update_generated_read_fields) {
@@ -6326,7 +6374,7 @@ int handler::ha_multi_range_read_next(char **range_info) {
   DBUG_TRACE;
 
   // Set status for the need to update generated fields
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   result = multi_range_read_next(range_info);
   if (!result && m_update_generated_read_fields) {
@@ -6717,6 +6765,10 @@ int DsMrr_impl::dsmrr_fill_buffer() {
   if (res && res != HA_ERR_END_OF_FILE) return res;
   dsmrr_eof = (res == HA_ERR_END_OF_FILE);
 
+  /* The buffer is about to be overwritten, so the saved rowid position of
+  the last fetched row is no longer valid. */
+  rowids_buf_prev_fetched = nullptr;
+
   /* Sort the buffer contents by rowid */
   uint elem_size = h->ref_length + (int)is_mrr_assoc * sizeof(void *);
   DBUG_ASSERT((rowids_buf_cur - rowids_buf) % elem_size == 0);
@@ -6765,7 +6817,19 @@ int DsMrr_impl::dsmrr_next(char **range_info) {
     if (h2->mrr_funcs.skip_record &&
         h2->mrr_funcs.skip_record(h2->mrr_iter, (char *)cur_range_info, rowid))
       continue;
+    if (rowids_buf_prev_fetched != nullptr &&
+        h->cmp_ref(rowid, rowids_buf_prev_fetched) == 0) {
+      /*
+        Same rowid as the row fetched by the previous call; the buffer is
+        sorted, so duplicates come back to back. The row is still in
+        record[0] and the clustered index lookup can be skipped.
+      */
+      table->set_found_row();
+      res = 0;
+      break;
+    }
     res = h->ha_rnd_pos(table->record[0], rowid);
+    rowids_buf_prev_fetched = (res == 0) ? rowid : nullptr;
     break;
   } while (true);
 
@@ -7257,7 +7321,7 @@ int handler::ha_read_range_first(const key_range *start_key,
   DBUG_TRACE;
 
   // Set status for the need to update generated fields
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   result = read_range_first(start_key, end_key, eq_range, sorted);
   if (!result && m_update_generated_read_fields) {
@@ -7274,7 +7338,7 @@ int handler::ha_read_range_next() {
   DBUG_TRACE;
 
   // Set status for the need to update generated fields
-  m_update_generated_read_fields = table->has_gcol();
+  m_update_generated_read_fields = table->has_virtual_gcol();
 
   result = read_range_next();
   if (!result && m_update_generated_read_fields) {
@@ -891,7 +891,9 @@ enum enum_schema_tables : int {
   SCH_COLUMN_PRIVILEGES = SCH_FIRST,
   SCH_ENGINES,
   SCH_OPEN_TABLES,
+  SCH_OPTIMIZER_PLAN_OUTLINES,
   SCH_OPTIMIZER_TRACE,
+  SCH_OPTIMIZER_TRACE_SAMPLES,
   SCH_PLUGINS,
   SCH_PROCESSLIST,
   SCH_PROFILES,
@@ -4344,6 +4346,7 @@ class handler {
   int ha_rnd_init(bool scan);
   int ha_rnd_end();
   int ha_rnd_next(uchar *buf);
+  int ha_fetch_batch(Record_buffer *buffer);
   // See the comment on m_update_generated_read_fields.
   int ha_rnd_pos(uchar *buf, uchar *pos);
   int ha_index_read_map(uchar *buf, const uchar *key, key_part_map keypart_map,
@@ -6632,6 +6635,17 @@ class DsMrr_impl {
 
   bool dsmrr_eof; /* true <=> We have reached EOF when reading index tuples */
 
+  /*
+    Rowid of the last row successfully fetched by dsmrr_next(), or nullptr
+    if no row has been fetched from the current buffer. Points into
+    rowids_buf, so it is only valid until the buffer is refilled. Since the
+    buffer is sorted by rowid, duplicate rowids (typically from BKA joins
+    with duplicate join keys) are adjacent, and a lookup whose rowid equals
+    the previous one can reuse the row already in record[0] instead of
+    doing another clustered index dive.
+  */
+  uchar *rowids_buf_prev_fetched = nullptr;
+
   /* true <=> need range association, buffer holds {rowid, range_id} pairs */
   bool is_mrr_assoc;
 
@@ -22,6 +22,7 @@
 
 #include "sql/hash_join_buffer.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <iterator>
@@ -79,7 +80,13 @@ TableCollection::TableCollection(const JOIN *join, qep_tab_map tables) {
 }
 
 void TableCollection::AddTable(QEP_TAB *qep_tab) {
-  m_tables_bitmap |= qep_tab->table_ref->map();
+  // Internal temporary tables are not part of the name resolution context, so
+  // they do not have a TABLE_LIST. That is fine; the bitmap is only used for
+  // determining which side of a hash join an Item belongs to, and Items never
+  // refer to such tables directly.
+  if (qep_tab->table_ref != nullptr) {
+    m_tables_bitmap |= qep_tab->table_ref->map();
+  }
 
   // When constructing the iterator tree, we might end up adding a
   // WeedoutIterator _after_ a HashJoinIterator has been constructed.
@@ -428,7 +435,9 @@ StoreRowResult HashJoinRowBuffer::StoreRow(
   m_last_row_stored = m_hash_map->emplace(Key(join_key_data, join_key_size),
                                           BufferRow(row, row_size));
 
-  if (m_mem_root.allocated_size() > m_max_mem_available) {
+  const size_t bytes_used = m_mem_root.allocated_size();
+  m_peak_memory_used = std::max(m_peak_memory_used, bytes_used);
+  if (bytes_used > m_max_mem_available) {
     return StoreRowResult::BUFFER_FULL;
   }
   return StoreRowResult::ROW_STORED;
@@ -165,6 +165,29 @@ bool HashJoinIterator::InitProbeIterator() {
   if (m_probe_input_batch_mode) {
     m_probe_input->StartPSIBatchMode();
   }
+
+  // Decide whether to read probe rows in batches for this pass over the probe
+  // input (see FillProbeRowBatch()). Without join conditions there is nothing
+  // to look up, and for small hash tables the lookups are cache-resident
+  // anyways.
+  m_probe_batch_enabled = !m_join_conditions.empty() &&
+                          m_row_buffer.size() >= kProbeBatchMinHashTableRows;
+  m_probe_batch_rows = 0;
+  m_probe_batch_current_row = 0;
+  m_probe_batch_saw_eof = false;
+
+  if (m_probe_batch_enabled && !m_probe_input_tables.has_blob_column()) {
+    // StoreFromTableBuffers() expects the caller to have reserved room for
+    // the row up-front when there are no blob columns.
+    const size_t upper_row_size =
+        hash_join_buffer::ComputeRowSizeUpperBound(m_probe_input_tables);
+    for (BatchedProbeRow &probe_row : m_probe_batch) {
+      if (probe_row.row.reserve(upper_row_size)) {
+        my_error(ER_OUTOFMEMORY, MYF(0), upper_row_size);
+        return true;  // oom
+      }
+    }
+  }
   return false;
 }
 
@@ -625,6 +648,24 @@ bool HashJoinIterator::ReadNextHashJoinChunk() {
       // Since the last row read was actually stored in the buffer, increment
       // the row counter manually before breaking out of the loop.
       ++m_build_chunk_current_row;
+
+      // The build chunk does not fit in the hash table. If we still can,
+      // split the chunk pair into smaller chunk pairs with a different
+      // partitioning hash, instead of probing the hash table once per refill
+      // and re-reading the entire probe chunk each time.
+      if (m_build_chunk_current_row < build_chunk.num_rows() &&
+          m_chunk_files_on_disk[m_current_chunk].generation <
+              kMaxChunkGenerations &&
+          m_chunk_files_on_disk.size() + 2 <= kMaxChunks) {
+        if (RepartitionCurrentChunk()) {
+          DBUG_ASSERT(thd()->is_error());  // my_error should have been called.
+          return true;
+        }
+
+        // The current chunk pair has been emptied out into the new chunk
+        // pairs, so move on to the next pair.
+        return ReadNextHashJoinChunk();
+      }
       break;
     } else if (store_row_result ==
                hash_join_buffer::StoreRowResult::FATAL_ERROR) {
@@ -669,24 +710,266 @@ bool HashJoinIterator::ReadNextHashJoinChunk() {
   return false;
 }
 
-bool HashJoinIterator::ReadRowFromProbeIterator() {
-  DBUG_ASSERT(m_current_chunk == -1);
+bool HashJoinIterator::RepartitionCurrentChunk() {
+  ChunkPair &chunk_pair = m_chunk_files_on_disk[m_current_chunk];
+  HashJoinChunk &build_chunk = chunk_pair.build_chunk;
+  HashJoinChunk &probe_chunk = chunk_pair.probe_chunk;
+
+  // Estimate how many chunk pairs are needed for each new build chunk to fit
+  // in the hash table, based on how many of the build rows we managed to
+  // buffer before it went full. The count must be a power of two (see
+  // WriteRowToChunk()), and we keep the total number of chunk pairs below
+  // kMaxChunks so that we do not run out of file descriptors.
+  DBUG_ASSERT(build_chunk.num_rows() > m_row_buffer.size());
+  const size_t sub_chunks_needed = std::min(
+      kMaxRepartitionFanout, static_cast<size_t>((build_chunk.num_rows() +
+                                                  m_row_buffer.size() - 1) /
+                                                 m_row_buffer.size()));
+  size_t num_sub_chunks =
+      my_round_up_to_next_power(static_cast<uint32>(sub_chunks_needed));
+  num_sub_chunks = std::max<size_t>(num_sub_chunks, 2);
+  while (num_sub_chunks > kMaxChunks - m_chunk_files_on_disk.size()) {
+    num_sub_chunks /= 2;
+  }
+  DBUG_ASSERT(num_sub_chunks >= 2);
+
+  // Partition with a hash seed that differs between the generations. Reusing
+  // the seed the parent chunk was partitioned with would send every row to
+  // the same sub-chunk, since all rows in the parent share the hash bits that
+  // selected the parent.
+  const int generation = chunk_pair.generation + 1;
+  const uint32_t partitioning_seed =
+      kChunkPartitioningHashSeed + static_cast<uint32_t>(generation);
+
+  Mem_root_array<ChunkPair> sub_chunks(thd()->mem_root);
+  sub_chunks.resize(num_sub_chunks);
+  for (ChunkPair &sub_chunk : sub_chunks) {
+    sub_chunk.generation = generation;
+    if (sub_chunk.build_chunk.Init(m_build_input_tables,
+                                   /*uses_match_flags=*/false) ||
+        sub_chunk.probe_chunk.Init(
+            m_probe_input_tables,
+            /*uses_match_flags=*/m_join_type == JoinType::OUTER)) {
+      my_error(ER_TEMP_FILE_WRITE_FAILURE, MYF(0));
+      return true;
+    }
+  }
+
+  // Distribute the build rows over the new chunk pairs. The rows that were
+  // already copied into the hash table are re-read from the chunk as well;
+  // the hash table is rebuilt from one of the sub-chunks later. Build chunks
+  // never contain rows with SQL NULL in the join key, so nothing is lost by
+  // not writing such rows (see BuildHashTable()).
+  if (build_chunk.Rewind()) {
+    DBUG_ASSERT(thd()->is_error());  // my_error should have been called.
+    return true;
+  }
 
-  int result = m_probe_input->Read();
-  if (result == 1) {
+  for (ha_rows row_idx = 0; row_idx < build_chunk.num_rows(); ++row_idx) {
+    bool matched = false;
+    if (build_chunk.LoadRowFromChunk(&m_temporary_row_and_join_key_buffer,
+                                     &matched) ||
+        WriteRowToChunk(thd(), &sub_chunks, /*write_to_build_chunk=*/true,
+                        m_build_input_tables, m_join_conditions,
+                        partitioning_seed, /*row_has_match=*/false,
+                        /*store_row_with_null_in_join_key=*/false,
+                        &m_temporary_row_and_join_key_buffer)) {
+      DBUG_ASSERT(thd()->is_error());  // my_error should have been called.
+      return true;
+    }
+  }
+
+  // Distribute the probe rows the same way. Match flags (outer join) survive
+  // the rewrite, and rows with SQL NULL in the join key are kept for outer
+  // joins, mirroring WriteProbeRowToDiskIfApplicable().
+  if (probe_chunk.Rewind()) {
     DBUG_ASSERT(thd()->is_error());  // my_error should have been called.
     return true;
   }
 
-  if (result == 0) {
+  for (ha_rows row_idx = 0; row_idx < probe_chunk.num_rows(); ++row_idx) {
+    bool matched = false;
+    if (probe_chunk.LoadRowFromChunk(&m_temporary_row_and_join_key_buffer,
+                                     &matched) ||
+        WriteRowToChunk(thd(), &sub_chunks, /*write_to_build_chunk=*/false,
+                        m_probe_input_tables, m_join_conditions,
+                        partitioning_seed, matched,
+                        /*store_row_with_null_in_join_key=*/m_join_type ==
+                            JoinType::OUTER,
+                        &m_temporary_row_and_join_key_buffer)) {
+      DBUG_ASSERT(thd()->is_error());  // my_error should have been called.
+      return true;
+    }
+  }
+
+  // Flush the new build chunks and position them at the beginning, just like
+  // BuildHashTable() does for the initial chunk files. The probe chunks are
+  // rewound when their pair is processed.
+  for (ChunkPair &sub_chunk : sub_chunks) {
+    if (sub_chunk.build_chunk.Rewind()) {
+      DBUG_ASSERT(thd()->is_error());  // my_error should have been called.
+      return true;
+    }
+  }
+
+  // Replace the repartitioned pair with empty chunks, so that its files are
+  // closed right away and the pair is skipped by ReadNextHashJoinChunk(),
+  // and hand the new pairs over to the chunk list.
+  chunk_pair.build_chunk = HashJoinChunk();
+  chunk_pair.probe_chunk = HashJoinChunk();
+  for (ChunkPair &sub_chunk : sub_chunks) {
+    m_chunk_files_on_disk.push_back(std::move(sub_chunk));
+  }
+
+  return false;
+}
+
+bool HashJoinIterator::FillProbeRowBatch() {
+  DBUG_ASSERT(!m_probe_batch_saw_eof);
+  m_probe_batch_rows = 0;
+  m_probe_batch_current_row = 0;
+
+  // Read the rows and construct their join keys. The key must be constructed
+  // while the row is in the tables' record buffers, so the row is moved aside
+  // into the batch right after.
+  while (m_probe_batch_rows < kProbeBatchSize) {
+    int result = m_probe_input->Read();
+    if (result == 1) {
+      DBUG_ASSERT(thd()->is_error());  // my_error should have been called.
+      return true;
+    }
+
+    if (result == -1) {
+      m_probe_batch_saw_eof = true;
+      break;
+    }
+
+    DBUG_ASSERT(result == 0);
     RequestRowId(m_probe_input_tables.tables());
 
-    // A row from the probe iterator is ready.
-    LookupProbeRowInHashTable();
-    return false;
+    BatchedProbeRow &probe_row = m_probe_batch[m_probe_batch_rows];
+    probe_row.null_in_join_key = ConstructJoinKey(
+        thd(), m_join_conditions, m_probe_input_tables.tables_bitmap(),
+        &probe_row.join_key);
+
+    if (hash_join_buffer::StoreFromTableBuffers(m_probe_input_tables,
+                                                &probe_row.row)) {
+      DBUG_ASSERT(thd()->is_error());  // my_error should have been called.
+      return true;
+    }
+
+    ++m_probe_batch_rows;
+  }
+
+  // Hash each join key and touch the hash table bucket it belongs to. The
+  // iterations are independent, so the CPU can keep the cache misses of
+  // several buckets in flight at once.
+  for (size_t i = 0; i < m_probe_batch_rows; ++i) {
+    const BatchedProbeRow &probe_row = m_probe_batch[i];
+    if (probe_row.null_in_join_key) {
+      continue;
+    }
+
+    m_row_buffer.Prefetch(hash_join_buffer::Key(
+        pointer_cast<const uchar *>(probe_row.join_key.ptr()),
+        probe_row.join_key.length()));
+  }
+
+  // Do the lookups against the (now cache-warm) buckets. The iterators stay
+  // valid until the batch is drained, as the hash table is not modified
+  // before the probe input is fully consumed.
+  const bool use_find =
+      (m_join_type == JoinType::SEMI || m_join_type == JoinType::ANTI) &&
+      m_extra_condition == nullptr;
+  for (size_t i = 0; i < m_probe_batch_rows; ++i) {
+    BatchedProbeRow &probe_row = m_probe_batch[i];
+    if (probe_row.null_in_join_key) {
+      continue;
+    }
+
+    hash_join_buffer::Key key(
+        pointer_cast<const uchar *>(probe_row.join_key.ptr()),
+        probe_row.join_key.length());
+    if (use_find) {
+      // See LookupProbeRowInHashTable() for why find() is preferred for
+      // semijoin and antijoin.
+      probe_row.first = m_row_buffer.find(key);
+      probe_row.last = m_row_buffer.end();
+    } else {
+      auto range = m_row_buffer.equal_range(key);
+      probe_row.first = range.first;
+      probe_row.last = range.second;
+    }
+  }
+
+  return false;
+}
+
+void HashJoinIterator::LoadNextBatchedProbeRow() {
+  DBUG_ASSERT(m_probe_batch_current_row < m_probe_batch_rows);
+  const BatchedProbeRow &probe_row = m_probe_batch[m_probe_batch_current_row++];
+
+  hash_join_buffer::LoadIntoTableBuffers(
+      m_probe_input_tables,
+      hash_join_buffer::Key(pointer_cast<const uchar *>(probe_row.row.ptr()),
+                            probe_row.row.length()));
+
+  // Mirror the state transitions of LookupProbeRowInHashTable().
+  if (probe_row.null_in_join_key) {
+    if (m_join_type == JoinType::ANTI || m_join_type == JoinType::OUTER) {
+      // SQL NULL was found, and we will never find a matching row in the hash
+      // table. Let us indicate that, so that a null-complemented row is
+      // returned.
+      m_hash_map_iterator = m_row_buffer.end();
+      m_hash_map_end = m_row_buffer.end();
+      m_state = State::READING_FIRST_ROW_FROM_HASH_TABLE;
+    } else {
+      SetReadingProbeRowState();
+    }
+    return;
+  }
+
+  m_hash_map_iterator = probe_row.first;
+  m_hash_map_end = probe_row.last;
+  m_state = State::READING_FIRST_ROW_FROM_HASH_TABLE;
+}
+
+bool HashJoinIterator::ReadRowFromProbeIterator() {
+  DBUG_ASSERT(m_current_chunk == -1);
+
+  if (m_probe_batch_enabled) {
+    if (m_probe_batch_current_row == m_probe_batch_rows &&
+        !m_probe_batch_saw_eof && FillProbeRowBatch()) {
+      return true;
+    }
+
+    if (m_probe_batch_current_row < m_probe_batch_rows) {
+      // A row from the batch is ready in the tables' record buffers.
+      LoadNextBatchedProbeRow();
+      return false;
+    }
+
+    // The batch is drained and the probe iterator is out of rows; fall
+    // through to the end-of-rows handling below.
+    DBUG_ASSERT(m_probe_batch_saw_eof);
+  } else {
+    int result = m_probe_input->Read();
+    if (result == 1) {
+      DBUG_ASSERT(thd()->is_error());  // my_error should have been called.
+      return true;
+    }
+
+    if (result == 0) {
+      RequestRowId(m_probe_input_tables.tables());
+
+      // A row from the probe iterator is ready.
+      LookupProbeRowInHashTable();
+      return false;
+    }
+
+    DBUG_ASSERT(result == -1);
   }
 
-  DBUG_ASSERT(result == -1);
   m_probe_input->EndPSIBatchModeIfStarted();
 
   // The probe iterator is out of rows. We may be in three different situations
@@ -1157,6 +1440,23 @@ std::vector<std::string> HashJoinIterator::DebugString() const {
   return {ret};
 }
 
+std::string HashJoinIterator::ExtraStatsString() const {
+  const size_t peak_memory = m_row_buffer.peak_memory_used();
+  if (peak_memory == 0) {
+    // Never executed.
+    return "";
+  }
+  char buf[128];
+  if (on_disk_hash_join()) {
+    snprintf(buf, sizeof(buf),
+             "(hash_table_peak_memory=%zu spilled_to_disk_chunks=%zu)",
+             peak_memory, m_chunk_files_on_disk.size());
+  } else {
+    snprintf(buf, sizeof(buf), "(hash_table_peak_memory=%zu)", peak_memory);
+  }
+  return buf;
+}
+
 bool HashJoinIterator::InitWritingToProbeRowSavingFile() {
   m_write_to_probe_row_saving = true;
   return m_probe_row_saving_write_file.Init(m_probe_input_tables,
@@ -24,6 +24,7 @@
    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
 
 #include <stdio.h>
+#include <array>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -45,6 +46,12 @@ class QEP_TAB;
 struct ChunkPair {
   HashJoinChunk probe_chunk;
   HashJoinChunk build_chunk;
+
+  // How many times this chunk pair has been repartitioned. The initial chunk
+  // files are generation 0; when a build chunk turns out not to fit in the
+  // hash table, the pair may be split into a new set of chunk pairs of the
+  // next generation (see HashJoinIterator::RepartitionCurrentChunk()).
+  int generation{0};
 };
 
 /// @file
@@ -313,6 +320,8 @@ class HashJoinIterator final : public RowIterator {
 
   std::vector<std::string> DebugString() const override;
 
+  std::string ExtraStatsString() const override;
+
   std::vector<Child> children() const override {
     return std::vector<Child>{{m_probe_input.get(), ""},
                               {m_build_input.get(), "Hash"}};
@@ -332,6 +341,20 @@ class HashJoinIterator final : public RowIterator {
   /// @retval true in case of error
   bool ReadNextHashJoinChunk();
 
+  /// Split the current pair of chunk files into a new set of smaller chunk
+  /// pairs, using a partitioning hash seed that differs from the one the
+  /// current pair was created with (grace hash join with recursive
+  /// repartitioning). This is done when a build chunk turns out not to fit in
+  /// the hash table; the alternative is to probe the hash table once per
+  /// refill, re-reading the entire probe chunk each time. The new chunk pairs
+  /// are appended to m_chunk_files_on_disk and processed like any other chunk
+  /// pair, so they may in turn be repartitioned, up to kMaxChunkGenerations
+  /// levels (which guards against data sets where repartitioning cannot help,
+  /// e.g. a single join key value that dominates the input).
+  ///
+  /// @retval true in case of error. my_error has been called.
+  bool RepartitionCurrentChunk();
+
   /// Read a single row from the probe iterator input into the tables' record
   /// buffers. If we have started spilling to disk, the row is written out to a
   /// chunk file on disk as well.
@@ -444,6 +467,25 @@ class HashJoinIterator final : public RowIterator {
   /// (in-memory, on-disk or in-memory with hash table refill).
   void SetReadingProbeRowState();
 
+  /// Read up to kProbeBatchSize rows ahead from the probe iterator, and look
+  /// all of them up in the hash table in a pipelined fashion: construct all
+  /// the join keys first, then hash each key and touch the hash table bucket
+  /// it belongs to, and finally do the lookups. Doing the lookups back-to-back
+  /// lets the CPU overlap the cache misses of independent buckets, which can
+  /// roughly double probe throughput when the hash table is too big for the
+  /// CPU caches. The rows themselves are moved out of the tables' record
+  /// buffers while they wait to be processed, and are moved back one at a
+  /// time by LoadNextBatchedProbeRow().
+  ///
+  /// @retval true in case of error. my_error has been called.
+  bool FillProbeRowBatch();
+
+  /// Put the next row read ahead by FillProbeRowBatch() back into the tables'
+  /// record buffers, and position the hash table iterators on the matching
+  /// rows that were found during the batched lookup. The iterator state is set
+  /// exactly as LookupProbeRowInHashTable() would have set it.
+  void LoadNextBatchedProbeRow();
+
   /// Read a joined row from the hash table, and see if it passes any extra
   /// conditions. The last probe row read will also be written do disk if needed
   /// (see WriteProbeRowToDiskIfApplicable).
@@ -531,6 +573,16 @@ class HashJoinIterator final : public RowIterator {
   // should be placed in.
   static constexpr size_t kMaxChunks = 128;
 
+  // The maximum number of chunk generations, i.e. how many times a chunk pair
+  // may be recursively repartitioned. Chunks of this generation that do not
+  // fit in the hash table fall back to refilling the hash table and re-reading
+  // the probe chunk once per refill.
+  static constexpr int kMaxChunkGenerations = 2;
+
+  // The maximum number of chunk pairs a single chunk pair may be split into
+  // when it is repartitioned. Always a power of two.
+  static constexpr size_t kMaxRepartitionFanout = 16;
+
   // A buffer that is used during two phases:
   // 1) when constructing a join key from join conditions.
   // 2) when moving a row between tables' record buffers and the hash table.
@@ -551,6 +603,49 @@ class HashJoinIterator final : public RowIterator {
   // QEP_TAB::pfs_batch_update() returns true for this table.
   bool m_probe_input_batch_mode{false};
 
+  // A probe row that has been read ahead by FillProbeRowBatch(), together
+  // with its join key and the result of the hash table lookup.
+  struct BatchedProbeRow {
+    // The row image, as stored by hash_join_buffer::StoreFromTableBuffers().
+    String row;
+
+    // The join key, extracted while the row was in the record buffers.
+    String join_key;
+
+    // Whether the join key contains SQL NULL.
+    bool null_in_join_key{false};
+
+    // The range of matching rows in the hash table. Only valid if the join
+    // key does not contain SQL NULL.
+    hash_join_buffer::HashJoinRowBuffer::hash_map_iterator first;
+    hash_join_buffer::HashJoinRowBuffer::hash_map_iterator last;
+  };
+
+  // The number of probe rows FillProbeRowBatch() reads ahead. Large enough to
+  // keep several independent cache misses in flight, small enough that the
+  // read-ahead buffers stay cheap.
+  static constexpr size_t kProbeBatchSize = 16;
+
+  // Only do batched probing when the hash table holds at least this many
+  // rows. With fewer rows, the lookups mostly hit in the CPU caches, and the
+  // extra copy of each probe row would not pay off.
+  static constexpr size_t kProbeBatchMinHashTableRows = 1024;
+
+  // Probe rows read ahead by FillProbeRowBatch(). Only the first
+  // m_probe_batch_rows entries hold rows; m_probe_batch_current_row is the
+  // next entry to hand out. The String buffers are reused between batches.
+  std::array<BatchedProbeRow, kProbeBatchSize> m_probe_batch;
+  size_t m_probe_batch_rows{0};
+  size_t m_probe_batch_current_row{0};
+
+  // Whether ReadRowFromProbeIterator() should read probe rows in batches.
+  // Decided in InitProbeIterator() for each pass over the probe input.
+  bool m_probe_batch_enabled{false};
+
+  // Whether FillProbeRowBatch() has seen EOF from the probe iterator. The
+  // EOF is acted upon first when the current batch is drained.
+  bool m_probe_batch_saw_eof{false};
+
   // Whether we are allowed to spill to disk.
   bool m_allow_spill_to_disk{true};
 
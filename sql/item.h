@@ -2375,6 +2375,10 @@ class Item : public Parse_tree_node {
       /// Where did we find item above? Used when m_location == L_JOIN_COND,
       /// nullptr for other locations.
       Item *m_join_condition{nullptr};
+      /// True if the subquery is correlated to the query block being
+      /// transformed, and thus needs to be decorrelated first, cf.
+      /// SELECT_LEX::decorrelate_derived_scalar_subquery.
+      bool m_correlated{false};
     };
 
     /// accumulated all scalar subqueries found
@@ -2382,6 +2386,9 @@ class Item : public Parse_tree_node {
     /// we are currently looking at this kind of clause, cf. enum Location
     int8 m_location;
     Item *m_join_condition_context{nullptr};
+    /// whether correlated subqueries may be collected, cf. Css_info::
+    /// m_correlated
+    bool m_collect_correlated{false};
     Collect_scalar_subquery_info() {}
     friend class Item_sum;
     friend class Item_singlerow_subselect;
@@ -257,6 +257,55 @@ static bool get_histogram_selectivity(THD *thd, const Field *field, Item **args,
   return true;
 }
 
+/**
+  Estimate the selectivity of the equi-join predicate
+  "field = other_field" from the histograms of the two join columns.
+
+  A histogram cannot answer a comparison against a value that is unknown
+  until execution time, but it gives a reliable estimate of the number of
+  distinct values on each side of the join. Under the standard assumption
+  that the value domain of the side with fewer distinct values is
+  contained in the domain of the other side, a non-NULL row in the table
+  being filtered matches a fraction
+
+    1 / max(NDV(field), NDV(other_field))
+
+  of the rows already read, while NULL rows match nothing.
+
+  @param      thd          thread handler
+  @param      field        the join column in the table being filtered
+  @param      other_field  a join column in an already read table
+  @param      item_func    the predicate, for optimizer trace output
+  @param[out] selectivity  the estimated selectivity if both columns have
+                           usable histograms
+
+  @retval true if one of the columns has no histogram (no estimate made)
+  @return false if success
+*/
+static bool get_join_selectivity_from_histograms(THD *thd, const Field *field,
+                                                 const Field *other_field,
+                                                 Item_func *item_func,
+                                                 double *selectivity) {
+  if (field->orig_table == nullptr || other_field->orig_table == nullptr)
+    return true;
+
+  const histograms::Histogram *histogram =
+      field->orig_table->s->find_histogram(field->field_index());
+  const histograms::Histogram *other_histogram =
+      other_field->orig_table->s->find_histogram(other_field->field_index());
+  if (histogram == nullptr || other_histogram == nullptr) return true;
+
+  const size_t distinct_values =
+      std::max(histogram->get_num_distinct_values(),
+               other_histogram->get_num_distinct_values());
+  if (distinct_values == 0) return true;
+
+  *selectivity = histogram->get_non_null_values_frequency() / distinct_values;
+  if (unlikely(thd->opt_trace.is_started()))
+    write_histogram_to_trace(thd, item_func, *selectivity);
+  return false;
+}
+
 /**
   This implementation of the factory method also implements flattening of
   row constructors. Examples of flattening are:
@@ -5875,6 +5924,97 @@ bool Item_func_like::itemize(Parse_context *pc, Item **res) {
   return escape_item == nullptr;
 }
 
+/**
+  Byte-wise substring search, for precompiled '%needle%' patterns. Candidate
+  positions of the first needle byte are located with memchr(), which libc
+  implementations vectorize, and verified with memcmp().
+*/
+static bool contains_substring(const char *text, size_t text_len,
+                               const char *needle, size_t needle_len) {
+  if (needle_len == 0) return true;
+  if (needle_len > text_len) return false;
+  const char *last_start = text + text_len - needle_len + 1;
+  for (const char *p = text;
+       (p = static_cast<const char *>(
+            memchr(p, needle[0], last_start - p))) != nullptr;
+       ++p) {
+    if (memcmp(p + 1, needle + 1, needle_len - 1) == 0) return true;
+  }
+  return false;
+}
+
+/**
+  Checks whether LIKE in this collation compares plain bytes, which makes
+  the specialized matchers in Item_func_like::val_int() equivalent to
+  my_wildcmp(). This holds for binary collations of single-byte character
+  sets and of UTF-8, where the encoding is self-synchronizing, so a
+  byte-level substring match can never start or end in the middle of a
+  multi-byte character. Other multi-byte character sets (gbk, sjis, ...)
+  do not have that property and must use the generic character-wise loop.
+*/
+static bool like_comparison_is_bytewise(const CHARSET_INFO *cs) {
+  if (cs == &my_charset_bin) return true;
+  if (!(cs->state & MY_CS_BINSORT)) return false;
+  if (cs->mbmaxlen == 1) return true;
+  return cs->cset == my_charset_utf8mb4_bin.cset ||
+         cs->cset == my_charset_utf8_bin.cset;
+}
+
+/**
+  Precompiles the pattern into a specialized matcher, when it is constant
+  during execution and consists of a literal string with at most a leading
+  and a trailing '%' wildcard. Such patterns ('needle%', '%needle',
+  '%needle%' and plain equality) are by far the most common ones, and can
+  be matched with memcmp()/memchr() instead of the generic wildcard loop.
+  On any reason not to specialize, the shape is left as NONE and val_int()
+  keeps using my_wildcmp().
+
+  @param pattern  the evaluated pattern string
+*/
+void Item_func_like::compile_matcher(const String *pattern) {
+  DBUG_ASSERT(escape_evaluated);
+  m_matcher_compiled = true;
+  m_shape = Pattern_shape::NONE;
+
+  // Patterns that may vary per row cannot be precompiled.
+  if (!args[1]->const_for_execution()) return;
+  if (!like_comparison_is_bytewise(cmp.cmp_collation.collation)) return;
+
+  /*
+    Escaped wildcards are rare; keep the compiler simple by not specializing
+    patterns that contain the escape character (or where the escape
+    character disables one of the wildcards, or is not a single byte).
+  */
+  if (escape > 255 || escape == wild_many || escape == wild_one) return;
+  const char *begin = pattern->ptr();
+  const char *end = begin + pattern->length();
+  if (pattern->length() > 0 &&
+      memchr(begin, escape, pattern->length()) != nullptr)
+    return;
+
+  bool leading = false, trailing = false;
+  while (begin < end && *begin == wild_many) {
+    leading = true;
+    ++begin;
+  }
+  while (end > begin && end[-1] == wild_many) {
+    trailing = true;
+    --end;
+  }
+  // Wildcards in the middle of the pattern are not handled.
+  for (const char *p = begin; p < end; ++p)
+    if (*p == wild_many || *p == wild_one) return;
+
+  m_needle.length(0);
+  if (end > begin && m_needle.copy(begin, end - begin, &my_charset_bin))
+    return; /* purecov: inspected */
+
+  m_shape = leading ? (trailing ? Pattern_shape::CONTAINS
+                                : Pattern_shape::SUFFIX)
+                    : (trailing ? Pattern_shape::PREFIX
+                                : Pattern_shape::EQUALS);
+}
+
 longlong Item_func_like::val_int() {
   DBUG_ASSERT(fixed == 1);
 
@@ -5893,6 +6033,26 @@ longlong Item_func_like::val_int() {
   null_value = false;
   if (current_thd->is_error()) return 0;
 
+  if (!m_matcher_compiled) compile_matcher(res2);
+
+  switch (m_shape) {
+    case Pattern_shape::EQUALS:
+      return res->length() == m_needle.length() &&
+             memcmp(res->ptr(), m_needle.ptr(), m_needle.length()) == 0;
+    case Pattern_shape::PREFIX:
+      return res->length() >= m_needle.length() &&
+             memcmp(res->ptr(), m_needle.ptr(), m_needle.length()) == 0;
+    case Pattern_shape::SUFFIX:
+      return res->length() >= m_needle.length() &&
+             memcmp(res->ptr() + res->length() - m_needle.length(),
+                    m_needle.ptr(), m_needle.length()) == 0;
+    case Pattern_shape::CONTAINS:
+      return contains_substring(res->ptr(), res->length(), m_needle.ptr(),
+                                m_needle.length());
+    case Pattern_shape::NONE:
+      break;
+  }
+
   return my_wildcmp(cmp.cmp_collation.collation, res->ptr(),
                     res->ptr() + res->length(), res2->ptr(),
                     res2->ptr() + res2->length(), escape,
@@ -5996,6 +6156,9 @@ bool Item_func_like::fix_fields(THD *thd, Item **ref) {
 
 void Item_func_like::cleanup() {
   escape_evaluated = false;
+  // The pattern may be bound to a new value on the next execution.
+  m_matcher_compiled = false;
+  m_shape = Pattern_shape::NONE;
   Item_bool_func2::cleanup();
 }
 
@@ -6513,6 +6676,33 @@ float Item_equal::get_filtering_effect(THD *thd, table_map filter_for_table,
   // Is there a constant that this multiple equality is equal to?
   if (const_item) found_comparable = true;
 
+  /*
+    If there is no constant, fields from 'filter_for_table' are compared
+    with fields from tables earlier in the join sequence, and histograms
+    on the join columns can be used for the estimate. Find the read-side
+    join column with the largest histogram-estimated number of distinct
+    values; it gives the most restrictive (and safest) join selectivity.
+  */
+  size_t read_side_distinct_values = 0;
+  Item_field *read_side_field = nullptr;
+  if (const_item == nullptr) {
+    List_iterator<Item_field> read_it(fields);
+    Item_field *read_field;
+    while ((read_field = read_it++)) {
+      if (!(read_field->used_tables() & read_tables) ||
+          read_field->field->orig_table == nullptr)
+        continue;
+      const histograms::Histogram *histogram =
+          read_field->field->orig_table->s->find_histogram(
+              read_field->field->field_index());
+      if (histogram != nullptr &&
+          histogram->get_num_distinct_values() > read_side_distinct_values) {
+        read_side_distinct_values = histogram->get_num_distinct_values();
+        read_side_field = read_field;
+      }
+    }
+  }
+
   List_iterator<Item_field> it(fields);
 
   Item_field *cur_field;
@@ -6585,6 +6775,29 @@ float Item_equal::get_filtering_effect(THD *thd, table_map filter_for_table,
               cur_filter = static_cast<float>(selectivity);
             }
           }
+        } else if (read_side_distinct_values > 0 &&
+                   cur_field->field->orig_table != nullptr) {
+          /*
+            This field is joined with fields from already read tables. If
+            it also has a histogram, estimate the join selectivity from
+            the two columns' distinct value counts instead of using the
+            default guess; see get_join_selectivity_from_histograms().
+          */
+          const histograms::Histogram *histogram =
+              cur_field->field->orig_table->s->find_histogram(
+                  cur_field->field->field_index());
+          if (histogram != nullptr) {
+            const size_t distinct_values = std::max(
+                histogram->get_num_distinct_values(), read_side_distinct_values);
+            const double selectivity =
+                histogram->get_non_null_values_frequency() / distinct_values;
+            if (unlikely(thd->opt_trace.is_started())) {
+              Item_func_eq *eq_func =
+                  new (thd->mem_root) Item_func_eq(cur_field, read_side_field);
+              write_histogram_to_trace(thd, eq_func, selectivity);
+            }
+            cur_filter = static_cast<float>(selectivity);
+          }
         }
 
         filter *= cur_filter;
@@ -6949,6 +7162,22 @@ float Item_func_eq::get_filtering_effect(THD *thd, table_map filter_for_table,
                                  fld->field->orig_table->s, &selectivity))
     return static_cast<float>(selectivity);
 
+  /*
+    Not a comparison against a constant. If this is an equi-join predicate,
+    the histograms of the two join columns can still provide an estimate,
+    which is often far better than the default guess for skewed or
+    low-cardinality join keys.
+  */
+  const Item *left = args[0]->real_item();
+  const Item *right = args[1]->real_item();
+  if (left->type() == FIELD_ITEM && right->type() == FIELD_ITEM) {
+    const Field *other_field =
+        down_cast<const Item_field *>(left == fld ? right : left)->field;
+    if (!get_join_selectivity_from_histograms(thd, fld->field, other_field,
+                                              this, &selectivity))
+      return static_cast<float>(selectivity);
+  }
+
   return fld->get_cond_filter_default_probability(rows_in_table,
                                                   COND_FILTER_EQUALITY);
 }
@@ -2215,6 +2215,27 @@ class Item_func_isnotnull final : public Item_bool_func {
 class Item_func_like final : public Item_bool_func2 {
   typedef Item_bool_func2 super;
 
+  /**
+    Shape of a constant pattern that has been precompiled into one of the
+    specialized byte-wise matchers, see compile_matcher().
+  */
+  enum class Pattern_shape {
+    NONE,     ///< Not precompiled; match with the generic my_wildcmp().
+    EQUALS,   ///< No wildcards: 'needle'
+    PREFIX,   ///< 'needle%'
+    SUFFIX,   ///< '%needle'
+    CONTAINS  ///< '%needle%'
+  };
+
+  /// How to match the pattern, when it has been precompiled.
+  Pattern_shape m_shape{Pattern_shape::NONE};
+  /// Whether an attempt has been made to precompile the pattern.
+  bool m_matcher_compiled{false};
+  /// The literal part of a precompiled pattern, without the wildcards.
+  String m_needle;
+
+  void compile_matcher(const String *pattern);
+
   Item *escape_item;
 
   bool escape_used_in_parsing;
@@ -227,7 +227,8 @@ class Item_func : public Item_result_field {
     JSON_OVERLAPS,
     MEMBER_OF_FUNC,
     STRCMP_FUNC,
-    TRUE_FUNC
+    TRUE_FUNC,
+    CONCAT_FUNC
   };
   enum optimize_type {
     OPTIMIZE_NONE,
@@ -5284,20 +5284,71 @@ double Item_func_distance::val_real() {
   std::unique_ptr<dd::cache::Dictionary_client::Auto_releaser> releaser(
       new dd::cache::Dictionary_client::Auto_releaser(
           current_thd->dd_client()));
-  if (gis::parse_geometry(current_thd, func_name(), res1, &srs1, &g1) ||
-      gis::parse_geometry(current_thd, func_name(), res2, &srs2, &g2)) {
-    return error_real();
+
+  /*
+    Parse each geometry argument, or reuse the geometry parsed on a
+    previous row if the argument is constant. The SRS is reacquired every
+    row regardless, since it is released together with the releaser
+    above.
+  */
+  gis::srid_t srid1;
+  gis::srid_t srid2;
+  const gis::Geometry *geom1;
+  const gis::Geometry *geom2;
+
+  if (m_cached_geometry[0] != nullptr) {
+    geom1 = m_cached_geometry[0].get();
+    srid1 = m_cached_srid[0];
+    if (srid1 != 0) {
+      Srs_fetcher fetcher(current_thd);
+      if (fetcher.acquire(srid1, &srs1)) return error_real();
+      if (srs1 == nullptr) {
+        my_error(ER_SRS_NOT_FOUND, MYF(0), srid1);
+        return error_real();
+      }
+    }
+  } else {
+    if (gis::parse_geometry(current_thd, func_name(), res1, &srs1, &g1)) {
+      return error_real();
+    }
+    srid1 = srs1 == nullptr ? 0 : srs1->id();
+    geom1 = g1.get();
+    if (args[0]->const_item()) {
+      m_cached_geometry[0] = std::move(g1);
+      m_cached_srid[0] = srid1;
+    }
+  }
+
+  if (m_cached_geometry[1] != nullptr) {
+    geom2 = m_cached_geometry[1].get();
+    srid2 = m_cached_srid[1];
+    if (srid2 != 0) {
+      Srs_fetcher fetcher(current_thd);
+      if (fetcher.acquire(srid2, &srs2)) return error_real();
+      if (srs2 == nullptr) {
+        my_error(ER_SRS_NOT_FOUND, MYF(0), srid2);
+        return error_real();
+      }
+    }
+  } else {
+    if (gis::parse_geometry(current_thd, func_name(), res2, &srs2, &g2)) {
+      return error_real();
+    }
+    srid2 = srs2 == nullptr ? 0 : srs2->id();
+    geom2 = g2.get();
+    if (args[1]->const_item()) {
+      m_cached_geometry[1] = std::move(g2);
+      m_cached_srid[1] = srid2;
+    }
   }
 
-  gis::srid_t srid1 = srs1 == nullptr ? 0 : srs1->id();
-  gis::srid_t srid2 = srs2 == nullptr ? 0 : srs2->id();
   if (srid1 != srid2) {
     my_error(ER_GIS_DIFFERENT_SRIDS, MYF(0), func_name(), srid1, srid2);
     return error_real();
   }
 
   double distance;
-  if (gis::distance(srs1, g1.get(), g2.get(), &distance, &null_value)) {
+  if (gis::distance(srs1, geom1, geom2, &distance, &null_value)) {
     return error_real();
   }
   if (null_value) {
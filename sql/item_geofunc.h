@@ -25,6 +25,7 @@
 
 #include <stddef.h>
 #include <sys/types.h>
+#include <memory>
 #include <vector>
 
 #include "my_dbug.h"
@@ -1698,6 +1699,15 @@ class Item_func_st_srid_observer : public Item_int_func {
 };
 
 class Item_func_distance : public Item_real_func {
+  /// Parsed geometry of each geometry argument that is constant for the
+  /// duration of one execution, so its WKB is parsed once instead of per
+  /// row. Reset by cleanup(), since the value of a constant argument may
+  /// change between executions of a prepared statement.
+  std::unique_ptr<gis::Geometry> m_cached_geometry[2];
+
+  /// SRIDs of the cached geometries.
+  gis::srid_t m_cached_srid[2]{0, 0};
+
   double geometry_collection_distance(const Geometry *g1, const Geometry *g2);
 
   template <typename Coordsys, typename BG_geometry>
@@ -1724,6 +1734,13 @@ class Item_func_distance : public Item_real_func {
   }
 
   double val_real() override;
+
+  void cleanup() override {
+    Item_real_func::cleanup();
+    m_cached_geometry[0].reset();
+    m_cached_geometry[1].reset();
+  }
+
   const char *func_name() const override { return "st_distance"; }
 };
 
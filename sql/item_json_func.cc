@@ -1936,7 +1936,19 @@ bool Item_func_json_extract::val_json(Json_wrapper *wr) {
 
       could_return_multiple_matches |= path->can_match_many();
 
-      if (w.seek(*path, path->leg_count(), &v, true, false))
+      /*
+        Remember, per path, where the member legs matched in the
+        previous row. Consecutive rows usually share document shape, so
+        the seek can probe those positions first instead of doing a full
+        binary search over the key directory for every row.
+      */
+      if (m_seek_hints.size() < arg_count - 1)
+        m_seek_hints.resize(arg_count - 1);
+      Json_seek_hints *hints = &m_seek_hints[i - 1];
+      if (hints->size() != path->leg_count())
+        hints->assign(path->leg_count(), size_t(-1));
+
+      if (w.seek(*path, path->leg_count(), &v, true, false, hints))
         return error_json(); /* purecov: inspected */
     }
 
@@ -28,6 +28,7 @@
 #include <sys/types.h>
 #include <memory>
 #include <utility>  // std::forward
+#include <vector>
 
 #include "m_ctype.h"
 #include "my_alloc.h"
@@ -532,6 +533,14 @@ class Item_func_json_keys : public Item_json_func {
 class Item_func_json_extract final : public Item_json_func {
   String m_doc_value;
 
+  /**
+    Per-path memo of where the member legs matched in the previous row,
+    passed to Json_wrapper::seek() so that rows sharing document shape
+    skip the binary search over the key directory. One vector per path
+    argument.
+  */
+  std::vector<std::vector<size_t>> m_seek_hints;
+
  public:
   Item_func_json_extract(THD *thd, const POS &pos, PT_item_list *a)
       : Item_json_func(thd, pos, a) {}
@@ -977,6 +977,57 @@ String *Item_func_statement_digest_text::val_str(String *buf) {
   return buf;
 }
 
+/**
+  Appends the values of the arguments of @p item to tmp_value. An argument
+  that is itself a CONCAT call with the same collation is flattened: we
+  recurse directly into its arguments instead of materializing the nested
+  result in a buffer of its own and copying it here. A whole tree of nested
+  CONCAT calls is thus evaluated in a single pass into the top-level buffer,
+  avoiding the repeated copying of the inner prefixes at every nesting
+  level.
+
+  @param thd  the session
+  @param item the CONCAT item whose arguments to append
+  @param str  scratch buffer for argument evaluation
+
+  @retval false on success
+  @retval true on error or NULL result; null_value has been set, and on
+          error my_error() has been called.
+*/
+bool Item_func_concat::append_args(THD *thd, Item_func_concat *item,
+                                   String *str) {
+  for (uint i = 0; i < item->arg_count; ++i) {
+    Item *arg = item->args[i];
+    if (arg->type() == FUNC_ITEM &&
+        down_cast<Item_func *>(arg)->functype() == CONCAT_FUNC &&
+        arg->collation.collation == collation.collation) {
+      if (append_args(thd, down_cast<Item_func_concat *>(arg), str))
+        return true;
+      continue;
+    }
+    String *res = arg->val_str(str);
+    if (res == nullptr) {
+      if (thd->is_error()) {
+        error_str();
+        return true;
+      }
+      DBUG_ASSERT(maybe_null);
+      null_value = true;
+      return true;
+    }
+    if (res->length() + tmp_value.length() >
+        thd->variables.max_allowed_packet) {
+      push_packet_overflow_warning(thd, func_name());
+      return true;
+    }
+    if (tmp_value.append(*res)) {
+      error_str();
+      return true;
+    }
+  }
+  return false;
+}
+
 /**
   Concatenate args with the following premises:
   If only one arg (which is ok), return value of arg;
@@ -984,26 +1035,12 @@ String *Item_func_statement_digest_text::val_str(String *buf) {
 
 String *Item_func_concat::val_str(String *str) {
   DBUG_ASSERT(fixed == 1);
-  String *res;
 
   THD *thd = current_thd;
   null_value = false;
   tmp_value.length(0);
-  for (uint i = 0; i < arg_count; ++i) {
-    if (!(res = args[i]->val_str(str))) {
-      if (thd->is_error()) return error_str();
-
-      DBUG_ASSERT(maybe_null);
-      null_value = true;
-      return nullptr;
-    }
-    if (res->length() + tmp_value.length() >
-        thd->variables.max_allowed_packet) {
-      return push_packet_overflow_warning(thd, func_name());
-    }
-    if (tmp_value.append(*res)) return error_str();
-  }
-  res = &tmp_value;
+  if (append_args(thd, this, str)) return nullptr;
+  String *res = &tmp_value;
   res->set_charset(collation.collation);
   return res;
 }
@@ -334,6 +334,9 @@ class Item_func_random_bytes : public Item_str_func {
 
 class Item_func_concat : public Item_str_func {
   String tmp_value{"", 0, collation.collation};  // Initialize to empty
+
+  bool append_args(THD *thd, Item_func_concat *item, String *str);
+
  public:
   Item_func_concat(const POS &pos, PT_item_list *opt_list)
       : Item_str_func(pos, opt_list) {}
@@ -344,6 +347,7 @@ class Item_func_concat : public Item_str_func {
   String *val_str(String *) override;
   bool resolve_type(THD *thd) override;
   const char *func_name() const override { return "concat"; }
+  enum Functype functype() const override { return CONCAT_FUNC; }
 };
 
 class Item_func_concat_ws : public Item_str_func {
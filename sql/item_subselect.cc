@@ -2696,14 +2696,22 @@ void Item_allany_subselect::print(const THD *thd, String *str,
 bool Item_singlerow_subselect::collect_scalar_subqueries(uchar *arg) {
   auto *info = pointer_cast<Collect_scalar_subquery_info *>(arg);
   const table_map map = used_tables();
+  const bool correlated = (map & ~PSEUDO_TABLE_BITS) != 0;
 
   // Skip transformation if more than one column is selected or column contains
   // a non-deterministic function.
-  // Also exclude scalar subqueries with references to outer query blocks
+  // Also exclude scalar subqueries with references to query blocks outside the
+  // immediately enclosing one, and subqueries correlated to the enclosing
+  // block unless the caller can decorrelate them and the subquery sits in a
+  // location where decorrelation is possible, cf.
+  // SELECT_LEX::decorrelate_derived_scalar_subquery.
   if (info->is_stopped(this) ||
       unit->first_select()->fields_list.elements != 1 ||
-      (map & ~PSEUDO_TABLE_BITS) != 0 || (map & OUTER_REF_TABLE_BIT) != 0 ||
-      (map & RAND_TABLE_BIT)) {
+      (map & OUTER_REF_TABLE_BIT) != 0 || (map & RAND_TABLE_BIT) ||
+      (correlated &&
+       (!info->m_collect_correlated ||
+        (info->m_location & ~(Collect_scalar_subquery_info::L_SELECT |
+                              Collect_scalar_subquery_info::L_WHERE)) != 0))) {
     return false;
   }
 
@@ -2732,7 +2740,7 @@ bool Item_singlerow_subselect::collect_scalar_subqueries(uchar *arg) {
       }
     }
     info->list.emplace_back(Collect_scalar_subquery_info::Css_info{
-        info->m_location, this, info->m_join_condition_context});
+        info->m_location, this, info->m_join_condition_context, correlated});
   }
   return false;
 }
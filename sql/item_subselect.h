@@ -274,6 +274,15 @@ class Item_singlerow_subselect : public Item_subselect {
   bool no_rows;  ///< @c no_rows_in_result
  public:
   TABLE_LIST *m_derived_replacement{nullptr};  ///< when subquery is transformed
+  /**
+    When a correlated subquery has been decorrelated as part of conversion
+    to a derived table, this holds the outer side of each lifted equality,
+    in the order of the grouping columns that were added to the subquery's
+    select list. It is used to (re)build the join condition between the
+    derived table and the transformed query block, cf.
+    SELECT_LEX::attach_decorrelated_derived_join_cond.
+  */
+  List<Item> *m_decorrelated_outer_exprs{nullptr};
 
   Item_singlerow_subselect(SELECT_LEX *select_lex);
   Item_singlerow_subselect()
@@ -1838,6 +1838,10 @@ Item_sum_sum::Item_sum_sum(THD *thd, Item_sum_sum *item)
   if (hybrid_type == DECIMAL_RESULT) {
     my_decimal2decimal(item->dec_buffs, dec_buffs);
     my_decimal2decimal(item->dec_buffs + 1, dec_buffs + 1);
+#ifdef __SIZEOF_INT128__
+    m_int128_sum = item->m_int128_sum;
+    m_int128_sum_active = item->m_int128_sum_active;
+#endif
   } else
     sum = item->sum;
 }
@@ -1855,12 +1859,32 @@ void Item_sum_sum::clear() {
     curr_dec_buff = 0;
     my_decimal_set_zero(&dec_buffs[0]);
     my_decimal_set_zero(&dec_buffs[1]);
+#ifdef __SIZEOF_INT128__
+    // Window functions update dec_buffs directly, bypassing add().
+    m_int128_sum = 0;
+    m_int128_sum_active = !m_is_window_function;
+#endif
   } else
     sum = 0.0;
   m_count = 0;
   m_frame_null_count = 0;
 }
 
+void Item_sum_sum::materialize_int128_sum() {
+#ifdef __SIZEOF_INT128__
+  if (!m_int128_sum_active) return;
+  m_int128_sum_active = false;
+  /*
+    All rows seen since clear() went into m_int128_sum, so the current
+    dec_buffs slot still holds zero and can simply be overwritten. The
+    conversion cannot fail: dec_buffs has room for far more digits than a
+    128-bit value can hold.
+  */
+  int128_to_my_decimal(E_DEC_FATAL_ERROR, m_int128_sum, decimals,
+                       dec_buffs + curr_dec_buff);
+#endif
+}
+
 bool Item_sum_sum::resolve_type(THD *) {
   DBUG_TRACE;
   maybe_null = true;
@@ -1935,6 +1959,28 @@ bool Item_sum_sum::add() {
     my_decimal value;
     const my_decimal *val = aggr->arg_val_decimal(&value);
     if (!aggr->arg_is_null(true)) {
+#ifdef __SIZEOF_INT128__
+      if (m_int128_sum_active) {
+        /*
+          Fast path: accumulate in a 128-bit integer scaled by 10^decimals,
+          which replaces the word-by-word my_decimal addition with a single
+          integer addition per row.
+        */
+        __int128 v, new_sum;
+        if (my_decimal2int128(0, val, decimals, &v) == E_DEC_OK &&
+            !__builtin_add_overflow(m_int128_sum, v, &new_sum)) {
+          m_int128_sum = new_sum;
+          null_value = false;
+          return false;
+        }
+        /*
+          The value does not fit the fast representation, or the sum would
+          overflow it. Fold what has been accumulated so far into dec_buffs
+          and continue on the legacy path for this and all further rows.
+        */
+        materialize_int128_sum();
+      }
+#endif
       my_decimal_add(E_DEC_FATAL_ERROR, dec_buffs + (curr_dec_buff ^ 1), val,
                      dec_buffs + curr_dec_buff);
       curr_dec_buff ^= 1;
@@ -1963,6 +2009,7 @@ longlong Item_sum_sum::val_int() {
 
   if (aggr) aggr->endup();
   if (hybrid_type == DECIMAL_RESULT) {
+    materialize_int128_sum();
     longlong result;
     my_decimal2int(E_DEC_FATAL_ERROR, dec_buffs + curr_dec_buff, unsigned_flag,
                    &result);
@@ -2009,8 +2056,10 @@ double Item_sum_sum::val_real() {
     return sum;
   } else {
     if (aggr) aggr->endup();
-    if (hybrid_type == DECIMAL_RESULT)
+    if (hybrid_type == DECIMAL_RESULT) {
+      materialize_int128_sum();
       my_decimal2double(E_DEC_FATAL_ERROR, dec_buffs + curr_dec_buff, &sum);
+    }
     return sum;
   }
 }
@@ -2061,7 +2110,10 @@ my_decimal *Item_sum_sum::val_decimal(my_decimal *val) {
   }
 
   if (aggr) aggr->endup();
-  if (hybrid_type == DECIMAL_RESULT) return (dec_buffs + curr_dec_buff);
+  if (hybrid_type == DECIMAL_RESULT) {
+    materialize_int128_sum();
+    return (dec_buffs + curr_dec_buff);
+  }
   return val_decimal_from_real(val);
 }
 
@@ -2370,6 +2422,7 @@ my_decimal *Item_sum_avg::val_decimal(my_decimal *val) {
       return result;
     }
 
+    materialize_int128_sum();
     sum_dec = dec_buffs + curr_dec_buff;
     int2my_decimal(E_DEC_FATAL_ERROR, m_count, false, &cnt);
     my_decimal_div(E_DEC_FATAL_ERROR, val, sum_dec, &cnt, prec_increment);
@@ -999,6 +999,27 @@ class Item_sum_sum : public Item_sum_num {
   double sum;
   my_decimal dec_buffs[2];
   uint curr_dec_buff;
+#ifdef __SIZEOF_INT128__
+  /**
+    Fast-path accumulator for SUM over DECIMAL values: the running sum,
+    scaled by 10^decimals so that it is an integer. Used instead of
+    dec_buffs for as long as m_int128_sum_active is true; see add().
+  */
+  __int128 m_int128_sum{0};
+  /**
+    True while m_int128_sum holds the running sum. Cleared when a value
+    does not fit the 128-bit representation, when adding a value would
+    overflow it, or when the sum has been copied into dec_buffs by
+    materialize_int128_sum().
+  */
+  bool m_int128_sum_active{false};
+#endif
+  /**
+    Copy the fast-path 128-bit sum, if active, into the dec_buffs slot that
+    val_int(), val_real() and val_decimal() read, and deactivate the fast
+    path. Must be called before reading the accumulated decimal sum.
+  */
+  void materialize_int128_sum();
   bool resolve_type(THD *thd) override;
   /**
     Execution state: this is for counting rows entering and leaving the window
@@ -45,6 +45,7 @@
 #include <sys/time.h>
 #endif
 #include "decimal.h"
+#include "integer_digits.h"  // write_two_digits
 #include "lex_string.h"
 #include "m_string.h"
 #include "my_compiler.h"
@@ -497,18 +498,229 @@ err : {
 }
 
 /**
-  Create a formated date/time value in a string.
-*/
+  Append one '%' specifier of a date/time format string to the result.
 
-bool make_date_time(Date_time_format *format, MYSQL_TIME *l_time,
-                    enum_mysql_timestamp_type type, String *str) {
+  @param spec         The specifier character (the one following '%').
+  @param l_time       The time value to format.
+  @param type         The time value's temporal type.
+  @param locale       The locale to use for textual month and day names.
+  @param [out] str    The string to append to.
+
+  @retval false on success
+  @retval true  if the specifier cannot be applied to this value; the
+                result should be NULL
+*/
+static bool append_date_time_field(char spec, MYSQL_TIME *l_time,
+                                   enum_mysql_timestamp_type type,
+                                   MY_LOCALE *locale, String *str) {
   char intbuff[15];
   uint hours_i;
   uint weekday;
   ulong length;
+
+  switch (spec) {
+    case 'M':
+      if (!l_time->month) return true;
+      str->append(
+          locale->month_names->type_names[l_time->month - 1],
+          strlen(locale->month_names->type_names[l_time->month - 1]),
+          system_charset_info);
+      break;
+    case 'b':
+      if (!l_time->month) return true;
+      str->append(
+          locale->ab_month_names->type_names[l_time->month - 1],
+          strlen(locale->ab_month_names->type_names[l_time->month - 1]),
+          system_charset_info);
+      break;
+    case 'W':
+      if (type == MYSQL_TIMESTAMP_TIME || !(l_time->month || l_time->year))
+        return true;
+      weekday = calc_weekday(
+          calc_daynr(l_time->year, l_time->month, l_time->day), false);
+      str->append(locale->day_names->type_names[weekday],
+                  strlen(locale->day_names->type_names[weekday]),
+                  system_charset_info);
+      break;
+    case 'a':
+      if (type == MYSQL_TIMESTAMP_TIME || !(l_time->month || l_time->year))
+        return true;
+      weekday = calc_weekday(
+          calc_daynr(l_time->year, l_time->month, l_time->day), false);
+      str->append(locale->ab_day_names->type_names[weekday],
+                  strlen(locale->ab_day_names->type_names[weekday]),
+                  system_charset_info);
+      break;
+    case 'D':
+      if (type == MYSQL_TIMESTAMP_TIME) return true;
+      length = longlong10_to_str(l_time->day, intbuff, 10) - intbuff;
+      str->append_with_prefill(intbuff, length, 1, '0');
+      if (l_time->day >= 10 && l_time->day <= 19)
+        str->append(STRING_WITH_LEN("th"));
+      else {
+        switch (l_time->day % 10) {
+          case 1:
+            str->append(STRING_WITH_LEN("st"));
+            break;
+          case 2:
+            str->append(STRING_WITH_LEN("nd"));
+            break;
+          case 3:
+            str->append(STRING_WITH_LEN("rd"));
+            break;
+          default:
+            str->append(STRING_WITH_LEN("th"));
+            break;
+        }
+      }
+      break;
+    case 'Y':
+      length = longlong10_to_str(l_time->year, intbuff, 10) - intbuff;
+      str->append_with_prefill(intbuff, length, 4, '0');
+      break;
+    case 'y':
+      length = longlong10_to_str(l_time->year % 100, intbuff, 10) - intbuff;
+      str->append_with_prefill(intbuff, length, 2, '0');
+      break;
+    case 'm':
+      length = longlong10_to_str(l_time->month, intbuff, 10) - intbuff;
+      str->append_with_prefill(intbuff, length, 2, '0');
+      break;
+    case 'c':
+      length = longlong10_to_str(l_time->month, intbuff, 10) - intbuff;
+      str->append_with_prefill(intbuff, length, 1, '0');
+      break;
+    case 'd':
+      length = longlong10_to_str(l_time->day, intbuff, 10) - intbuff;
+      str->append_with_prefill(intbuff, length, 2, '0');
+      break;
+    case 'e':
+      length = longlong10_to_str(l_time->day, intbuff, 10) - intbuff;
+      str->append_with_prefill(intbuff, length, 1, '0');
+      break;
+    case 'f':
+      length =
+          longlong10_to_str(l_time->second_part, intbuff, 10) - intbuff;
+      str->append_with_prefill(intbuff, length, 6, '0');
+      break;
+    case 'H':
+      length = longlong10_to_str(l_time->hour, intbuff, 10) - intbuff;
+      str->append_with_prefill(intbuff, length, 2, '0');
+      break;
+    case 'h':
+    case 'I':
+      hours_i = (l_time->hour % 24 + 11) % 12 + 1;
+      length = longlong10_to_str(hours_i, intbuff, 10) - intbuff;
+      str->append_with_prefill(intbuff, length, 2, '0');
+      break;
+    case 'i': /* minutes */
+      length = longlong10_to_str(l_time->minute, intbuff, 10) - intbuff;
+      str->append_with_prefill(intbuff, length, 2, '0');
+      break;
+    case 'j': {
+      if (type == MYSQL_TIMESTAMP_TIME) return true;
+
+      int radix = 10;
+      int diff = calc_daynr(l_time->year, l_time->month, l_time->day) -
+                 calc_daynr(l_time->year, 1, 1) + 1;
+      if (diff < 0) radix = -10;
+
+      length = longlong10_to_str(diff, intbuff, radix) - intbuff;
+      str->append_with_prefill(intbuff, length, 3, '0');
+    } break;
+    case 'k':
+      length = longlong10_to_str(l_time->hour, intbuff, 10) - intbuff;
+      str->append_with_prefill(intbuff, length, 1, '0');
+      break;
+    case 'l':
+      hours_i = (l_time->hour % 24 + 11) % 12 + 1;
+      length = longlong10_to_str(hours_i, intbuff, 10) - intbuff;
+      str->append_with_prefill(intbuff, length, 1, '0');
+      break;
+    case 'p':
+      hours_i = l_time->hour % 24;
+      str->append(hours_i < 12 ? "AM" : "PM", 2);
+      break;
+    case 'r':
+      length = sprintf(intbuff,
+                       ((l_time->hour % 24) < 12) ? "%02d:%02d:%02d AM"
+                                                  : "%02d:%02d:%02d PM",
+                       (l_time->hour + 11) % 12 + 1, l_time->minute,
+                       l_time->second);
+      str->append(intbuff, length);
+      break;
+    case 'S':
+    case 's':
+      length = longlong10_to_str(l_time->second, intbuff, 10) - intbuff;
+      str->append_with_prefill(intbuff, length, 2, '0');
+      break;
+    case 'T':
+      length = sprintf(intbuff, "%02d:%02d:%02d", l_time->hour,
+                       l_time->minute, l_time->second);
+      str->append(intbuff, length);
+      break;
+    case 'U':
+    case 'u': {
+      uint year;
+      if (type == MYSQL_TIMESTAMP_TIME) return true;
+      length =
+          longlong10_to_str(calc_week(*l_time,
+                                      spec == 'U' ? WEEK_FIRST_WEEKDAY
+                                                    : WEEK_MONDAY_FIRST,
+                                      &year),
+                            intbuff, 10) -
+          intbuff;
+      str->append_with_prefill(intbuff, length, 2, '0');
+    } break;
+    case 'v':
+    case 'V': {
+      uint year;
+      if (type == MYSQL_TIMESTAMP_TIME) return true;
+      length =
+          longlong10_to_str(
+              calc_week(*l_time,
+                        (spec == 'V' ? (WEEK_YEAR | WEEK_FIRST_WEEKDAY)
+                                       : (WEEK_YEAR | WEEK_MONDAY_FIRST)),
+                        &year),
+              intbuff, 10) -
+          intbuff;
+      str->append_with_prefill(intbuff, length, 2, '0');
+    } break;
+    case 'x':
+    case 'X': {
+      uint year;
+      if (type == MYSQL_TIMESTAMP_TIME) return true;
+      (void)calc_week(*l_time,
+                      (spec == 'X' ? WEEK_YEAR | WEEK_FIRST_WEEKDAY
+                                     : WEEK_YEAR | WEEK_MONDAY_FIRST),
+                      &year);
+      length = longlong10_to_str(year, intbuff, 10) - intbuff;
+      str->append_with_prefill(intbuff, length, 4, '0');
+    } break;
+    case 'w':
+      if (type == MYSQL_TIMESTAMP_TIME || !(l_time->month || l_time->year))
+        return true;
+      weekday = calc_weekday(
+          calc_daynr(l_time->year, l_time->month, l_time->day), true);
+      length = longlong10_to_str(weekday, intbuff, 10) - intbuff;
+      str->append_with_prefill(intbuff, length, 1, '0');
+      break;
+
+    default:
+      str->append(spec);
+      break;
+  }
+  return false;
+}
+
+/**
+  Create a formated date/time value in a string.
+*/
+
+bool make_date_time(Date_time_format *format, MYSQL_TIME *l_time,
+                    enum_mysql_timestamp_type type, String *str) {
   const char *ptr, *end;
-  THD *thd = current_thd;
-  MY_LOCALE *locale = thd->variables.lc_time_names;
+  MY_LOCALE *locale = current_thd->variables.lc_time_names;
 
   str->length(0);
 
@@ -518,200 +730,8 @@ bool make_date_time(Date_time_format *format, MYSQL_TIME *l_time,
   for (; ptr != end; ptr++) {
     if (*ptr != '%' || ptr + 1 == end)
       str->append(*ptr);
-    else {
-      switch (*++ptr) {
-        case 'M':
-          if (!l_time->month) return true;
-          str->append(
-              locale->month_names->type_names[l_time->month - 1],
-              strlen(locale->month_names->type_names[l_time->month - 1]),
-              system_charset_info);
-          break;
-        case 'b':
-          if (!l_time->month) return true;
-          str->append(
-              locale->ab_month_names->type_names[l_time->month - 1],
-              strlen(locale->ab_month_names->type_names[l_time->month - 1]),
-              system_charset_info);
-          break;
-        case 'W':
-          if (type == MYSQL_TIMESTAMP_TIME || !(l_time->month || l_time->year))
-            return true;
-          weekday = calc_weekday(
-              calc_daynr(l_time->year, l_time->month, l_time->day), false);
-          str->append(locale->day_names->type_names[weekday],
-                      strlen(locale->day_names->type_names[weekday]),
-                      system_charset_info);
-          break;
-        case 'a':
-          if (type == MYSQL_TIMESTAMP_TIME || !(l_time->month || l_time->year))
-            return true;
-          weekday = calc_weekday(
-              calc_daynr(l_time->year, l_time->month, l_time->day), false);
-          str->append(locale->ab_day_names->type_names[weekday],
-                      strlen(locale->ab_day_names->type_names[weekday]),
-                      system_charset_info);
-          break;
-        case 'D':
-          if (type == MYSQL_TIMESTAMP_TIME) return true;
-          length = longlong10_to_str(l_time->day, intbuff, 10) - intbuff;
-          str->append_with_prefill(intbuff, length, 1, '0');
-          if (l_time->day >= 10 && l_time->day <= 19)
-            str->append(STRING_WITH_LEN("th"));
-          else {
-            switch (l_time->day % 10) {
-              case 1:
-                str->append(STRING_WITH_LEN("st"));
-                break;
-              case 2:
-                str->append(STRING_WITH_LEN("nd"));
-                break;
-              case 3:
-                str->append(STRING_WITH_LEN("rd"));
-                break;
-              default:
-                str->append(STRING_WITH_LEN("th"));
-                break;
-            }
-          }
-          break;
-        case 'Y':
-          length = longlong10_to_str(l_time->year, intbuff, 10) - intbuff;
-          str->append_with_prefill(intbuff, length, 4, '0');
-          break;
-        case 'y':
-          length = longlong10_to_str(l_time->year % 100, intbuff, 10) - intbuff;
-          str->append_with_prefill(intbuff, length, 2, '0');
-          break;
-        case 'm':
-          length = longlong10_to_str(l_time->month, intbuff, 10) - intbuff;
-          str->append_with_prefill(intbuff, length, 2, '0');
-          break;
-        case 'c':
-          length = longlong10_to_str(l_time->month, intbuff, 10) - intbuff;
-          str->append_with_prefill(intbuff, length, 1, '0');
-          break;
-        case 'd':
-          length = longlong10_to_str(l_time->day, intbuff, 10) - intbuff;
-          str->append_with_prefill(intbuff, length, 2, '0');
-          break;
-        case 'e':
-          length = longlong10_to_str(l_time->day, intbuff, 10) - intbuff;
-          str->append_with_prefill(intbuff, length, 1, '0');
-          break;
-        case 'f':
-          length =
-              longlong10_to_str(l_time->second_part, intbuff, 10) - intbuff;
-          str->append_with_prefill(intbuff, length, 6, '0');
-          break;
-        case 'H':
-          length = longlong10_to_str(l_time->hour, intbuff, 10) - intbuff;
-          str->append_with_prefill(intbuff, length, 2, '0');
-          break;
-        case 'h':
-        case 'I':
-          hours_i = (l_time->hour % 24 + 11) % 12 + 1;
-          length = longlong10_to_str(hours_i, intbuff, 10) - intbuff;
-          str->append_with_prefill(intbuff, length, 2, '0');
-          break;
-        case 'i': /* minutes */
-          length = longlong10_to_str(l_time->minute, intbuff, 10) - intbuff;
-          str->append_with_prefill(intbuff, length, 2, '0');
-          break;
-        case 'j': {
-          if (type == MYSQL_TIMESTAMP_TIME) return true;
-
-          int radix = 10;
-          int diff = calc_daynr(l_time->year, l_time->month, l_time->day) -
-                     calc_daynr(l_time->year, 1, 1) + 1;
-          if (diff < 0) radix = -10;
-
-          length = longlong10_to_str(diff, intbuff, radix) - intbuff;
-          str->append_with_prefill(intbuff, length, 3, '0');
-        } break;
-        case 'k':
-          length = longlong10_to_str(l_time->hour, intbuff, 10) - intbuff;
-          str->append_with_prefill(intbuff, length, 1, '0');
-          break;
-        case 'l':
-          hours_i = (l_time->hour % 24 + 11) % 12 + 1;
-          length = longlong10_to_str(hours_i, intbuff, 10) - intbuff;
-          str->append_with_prefill(intbuff, length, 1, '0');
-          break;
-        case 'p':
-          hours_i = l_time->hour % 24;
-          str->append(hours_i < 12 ? "AM" : "PM", 2);
-          break;
-        case 'r':
-          length = sprintf(intbuff,
-                           ((l_time->hour % 24) < 12) ? "%02d:%02d:%02d AM"
-                                                      : "%02d:%02d:%02d PM",
-                           (l_time->hour + 11) % 12 + 1, l_time->minute,
-                           l_time->second);
-          str->append(intbuff, length);
-          break;
-        case 'S':
-        case 's':
-          length = longlong10_to_str(l_time->second, intbuff, 10) - intbuff;
-          str->append_with_prefill(intbuff, length, 2, '0');
-          break;
-        case 'T':
-          length = sprintf(intbuff, "%02d:%02d:%02d", l_time->hour,
-                           l_time->minute, l_time->second);
-          str->append(intbuff, length);
-          break;
-        case 'U':
-        case 'u': {
-          uint year;
-          if (type == MYSQL_TIMESTAMP_TIME) return true;
-          length =
-              longlong10_to_str(calc_week(*l_time,
-                                          (*ptr) == 'U' ? WEEK_FIRST_WEEKDAY
-                                                        : WEEK_MONDAY_FIRST,
-                                          &year),
-                                intbuff, 10) -
-              intbuff;
-          str->append_with_prefill(intbuff, length, 2, '0');
-        } break;
-        case 'v':
-        case 'V': {
-          uint year;
-          if (type == MYSQL_TIMESTAMP_TIME) return true;
-          length =
-              longlong10_to_str(
-                  calc_week(*l_time,
-                            ((*ptr) == 'V' ? (WEEK_YEAR | WEEK_FIRST_WEEKDAY)
-                                           : (WEEK_YEAR | WEEK_MONDAY_FIRST)),
-                            &year),
-                  intbuff, 10) -
-              intbuff;
-          str->append_with_prefill(intbuff, length, 2, '0');
-        } break;
-        case 'x':
-        case 'X': {
-          uint year;
-          if (type == MYSQL_TIMESTAMP_TIME) return true;
-          (void)calc_week(*l_time,
-                          ((*ptr) == 'X' ? WEEK_YEAR | WEEK_FIRST_WEEKDAY
-                                         : WEEK_YEAR | WEEK_MONDAY_FIRST),
-                          &year);
-          length = longlong10_to_str(year, intbuff, 10) - intbuff;
-          str->append_with_prefill(intbuff, length, 4, '0');
-        } break;
-        case 'w':
-          if (type == MYSQL_TIMESTAMP_TIME || !(l_time->month || l_time->year))
-            return true;
-          weekday = calc_weekday(
-              calc_daynr(l_time->year, l_time->month, l_time->day), true);
-          length = longlong10_to_str(weekday, intbuff, 10) - intbuff;
-          str->append_with_prefill(intbuff, length, 1, '0');
-          break;
-
-        default:
-          str->append(*ptr);
-          break;
-      }
-    }
+    else if (append_date_time_field(*++ptr, l_time, type, locale, str))
+      return true;
   }
   return false;
 }
@@ -1932,6 +1952,113 @@ uint Item_func_date_format::format_length(const String *format) {
   return size;
 }
 
+/**
+  Compiles a constant format string into a program of Format_op steps.
+
+  Runs of literal characters become single literal steps, emitted with one
+  append per run instead of one per character, and each '%' specifier becomes
+  one specifier step, so the format string is not re-parsed for every row.
+  The ops point into m_compiled_format, a private copy of the format string.
+*/
+void Item_func_date_format::compile_format(const String *format) {
+  m_format_compiled = true;
+  m_use_compiled = false;
+  m_format_ops.clear();
+  if (m_compiled_format.copy(*format)) return; /* purecov: inspected */
+  const char *const start = m_compiled_format.ptr();
+  const char *ptr = start;
+  const char *const end = start + m_compiled_format.length();
+  while (ptr != end) {
+    Format_op op;
+    if (*ptr != '%' || ptr + 1 == end) {
+      // A literal run; a '%' that ends the string is literal as well.
+      const char *literal_start = ptr;
+      while (ptr != end && (*ptr != '%' || ptr + 1 == end)) ptr++;
+      op.spec = 0;
+      op.offset = literal_start - start;
+      op.length = ptr - literal_start;
+    } else {
+      op.spec = ptr[1];
+      op.offset = 0;
+      op.length = 0;
+      ptr += 2;
+    }
+    m_format_ops.push_back(op);
+  }
+  m_use_compiled = true;
+}
+
+/**
+  Formats a date/time value by executing the program built by
+  compile_format(). Produces the same result as make_date_time(), but emits
+  literal segments with a single append and the common fixed-width numeric
+  specifiers with a two-digit lookup table instead of division/append per
+  digit. Everything else falls back to append_date_time_field().
+
+  @retval false on success
+  @retval true  if a specifier cannot be applied to this value; the result
+                should be NULL
+*/
+bool Item_func_date_format::eval_compiled_format(
+    MYSQL_TIME *l_time, enum_mysql_timestamp_type type, String *str) {
+  MY_LOCALE *locale = current_thd->variables.lc_time_names;
+
+  str->length(0);
+
+  if (l_time->neg) str->append('-');
+
+  for (const Format_op &op : m_format_ops) {
+    if (op.spec == 0) {
+      str->append(m_compiled_format.ptr() + op.offset, op.length);
+      continue;
+    }
+    uint value = UINT_MAX;
+    switch (op.spec) {
+      case 'y':
+        value = l_time->year % 100;
+        break;
+      case 'm':
+        value = l_time->month;
+        break;
+      case 'd':
+        value = l_time->day;
+        break;
+      case 'H':
+        value = l_time->hour;  // Falls back below if >= 100.
+        break;
+      case 'h':
+      case 'I':
+        value = (l_time->hour % 24 + 11) % 12 + 1;
+        break;
+      case 'i':
+        value = l_time->minute;
+        break;
+      case 'S':
+      case 's':
+        value = l_time->second;
+        break;
+      default:
+        break;
+    }
+    if (value < 100) {
+      char buff[2];
+      write_two_digits(value, buff);
+      str->append(buff, 2);
+      continue;
+    }
+    if (op.spec == 'Y' && l_time->year < 10000) {
+      char buff[4];
+      write_two_digits(l_time->year / 100, buff);
+      write_two_digits(l_time->year % 100, buff + 2);
+      str->append(buff, 4);
+      continue;
+    }
+    if (append_date_time_field(op.spec, l_time, type, locale, str))
+      return true;
+  }
+  return false;
+}
+
 String *Item_func_date_format::val_str(String *str) {
   String *format;
   MYSQL_TIME l_time;
@@ -1947,6 +2074,9 @@ String *Item_func_date_format::val_str(String *str) {
 
   if (!(format = args[1]->val_str(str)) || !format->length()) goto null_date;
 
+  if (!m_format_compiled && args[1]->const_for_execution())
+    compile_format(format);
+
   if (fixed_length)
     size = max_length;
   else
@@ -1958,16 +2088,22 @@ String *Item_func_date_format::val_str(String *str) {
   if (format == str || format->uses_buffer_owned_by(str)) str = &value;
   if (str->alloc(size)) goto null_date;
 
-  Date_time_format date_time_format;
-  date_time_format.format.str = format->ptr();
-  date_time_format.format.length = format->length();
-
   /* Create the result string */
   str->set_charset(collation.collation);
-  if (!make_date_time(
-          &date_time_format, &l_time,
-          is_time_format ? MYSQL_TIMESTAMP_TIME : MYSQL_TIMESTAMP_DATE, str))
-    return str;
+  if (m_use_compiled) {
+    if (!eval_compiled_format(
+            &l_time, is_time_format ? MYSQL_TIMESTAMP_TIME : MYSQL_TIMESTAMP_DATE,
+            str))
+      return str;
+  } else {
+    Date_time_format date_time_format;
+    date_time_format.format.str = format->ptr();
+    date_time_format.format.length = format->length();
+    if (!make_date_time(
+            &date_time_format, &l_time,
+            is_time_format ? MYSQL_TIMESTAMP_TIME : MYSQL_TIMESTAMP_DATE, str))
+      return str;
+  }
 
 null_date:
   null_value = true;
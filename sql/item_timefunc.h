@@ -28,6 +28,7 @@
 #include <stddef.h>
 #include <sys/types.h>
 #include <algorithm>
+#include <vector>
 
 #include "m_ctype.h"
 #include "my_dbug.h"
@@ -1247,6 +1248,30 @@ class Item_func_date_format final : public Item_str_func {
   const bool is_time_format;
   String value;
 
+  /**
+    One step of a precompiled format string, see compile_format(). A literal
+    segment of the format string (spec == 0) is emitted with a single append,
+    a '\%' specifier (spec == the specifier character) with a fixed-width
+    emitter where possible.
+  */
+  struct Format_op {
+    char spec;    ///< Specifier character, or 0 for a literal segment.
+    uint offset;  ///< Literal segment: offset into m_compiled_format.
+    uint length;  ///< Literal segment: length in bytes.
+  };
+  /// Whether compile_format() has run for the current execution.
+  bool m_format_compiled{false};
+  /// Whether m_format_ops holds a usable program for the format string.
+  bool m_use_compiled{false};
+  /// Copy of the compiled format string; literal ops point into it.
+  String m_compiled_format;
+  /// The compiled program, executed by eval_compiled_format().
+  std::vector<Format_op> m_format_ops;
+
+  void compile_format(const String *format);
+  bool eval_compiled_format(MYSQL_TIME *l_time,
+                            enum_mysql_timestamp_type type, String *str);
+
  public:
   Item_func_date_format(const POS &pos, Item *a, Item *b,
                         bool is_time_format_arg = false)
@@ -1256,6 +1281,11 @@ class Item_func_date_format final : public Item_str_func {
     return is_time_format ? "time_format" : "date_format";
   }
   bool resolve_type(THD *thd) override;
+  void cleanup() override {
+    Item_str_func::cleanup();
+    m_format_compiled = false;
+    m_use_compiled = false;
+  }
   uint format_length(const String *format);
   bool eq(const Item *item, bool binary_cmp) const override;
 };
@@ -540,6 +540,18 @@ static enum_serialization_result serialize_json_array(const THD *thd,
     entry_pos += entry_size;
   }
 
+  /*
+    Reserve slack space at the end of the array, if requested, so that
+    later partial updates that grow an element can be performed in place.
+    The slack is included in the size of the array and found by
+    Value::has_space().
+  */
+  const size_t array_slack = (dest->length() - start_pos) *
+                             thd->variables.json_serialization_slack_percent /
+                             100;
+  if (array_slack > 0 && dest->fill(dest->length() + array_slack, 0))
+    return FAILURE; /* purecov: inspected */
+
   // Finally, write the size of the object in bytes.
   size_t bytes = dest->length() - start_pos;
   if (is_too_big_for_json(bytes, large))
@@ -624,6 +636,18 @@ static enum_serialization_result serialize_json_object(
     entry_pos += value_entry_size;
   }
 
+  /*
+    Reserve slack space at the end of the object, if requested, so that
+    later partial updates that grow a member can be performed in place.
+    The slack is included in the size of the object and found by
+    Value::has_space().
+  */
+  const size_t object_slack = (dest->length() - start_pos) *
+                              thd->variables.json_serialization_slack_percent /
+                              100;
+  if (object_slack > 0 && dest->fill(dest->length() + object_slack, 0))
+    return FAILURE; /* purecov: inspected */
+
   // Finally, write the size of the object in bytes.
   size_t bytes = dest->length() - start_pos;
   if (is_too_big_for_json(bytes, large)) return VALUE_TOO_BIG;
@@ -1217,6 +1241,39 @@ size_t Value::lookup_index(const char *key, size_t length) const {
   return m_element_count;  // not found
 }
 
+/**
+  Get the index of the element with the specified key in a JSON object,
+  probing a caller-provided position before falling back to binary search.
+
+  When the same path is extracted from a stream of documents with
+  identical shape, the key is found at the same position in the key
+  directory every time. Callers that remember the position of the
+  previous match can pass it as a hint: if the entry at the hinted
+  position has the given key, the binary search is skipped entirely.
+
+  @param[in] key  the key to look up
+  @param[in] length  the length of the key
+  @param[in] hint  the position to probe first; ignored if out of bounds
+  @return the index if the key is found, or `element_count()` if the
+  key is not found
+*/
+size_t Value::lookup_index(const char *key, size_t length, size_t hint) const {
+  DBUG_ASSERT(m_type == OBJECT);
+
+  if (hint < m_element_count) {
+    const auto offset_size = json_binary::offset_size(m_large);
+    const size_t entry_offset = key_entry_offset(hint);
+    const size_t key_len = uint2korr(m_data + entry_offset + offset_size);
+    if (key_len == length) {
+      const size_t key_offset =
+          read_offset_or_size(m_data + entry_offset, m_large);
+      if (memcmp(key, m_data + key_offset, key_len) == 0) return hint;
+    }
+  }
+
+  return lookup_index(key, length);
+}
+
 /**
   Is this binary value pointing to data that is contained in the specified
   string.
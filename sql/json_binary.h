@@ -268,6 +268,10 @@ class Value {
   size_t lookup_index(const std::string &key) const {
     return lookup_index(key.c_str(), key.length());
   }
+  size_t lookup_index(const char *key, size_t length, size_t hint) const;
+  size_t lookup_index(const std::string &key, size_t hint) const {
+    return lookup_index(key.c_str(), key.length(), hint);
+  }
   bool is_backed_by(const String *str) const;
   bool raw_binary(const THD *thd, String *buf) const;
   bool get_free_space(const THD *thd, size_t *space) const;
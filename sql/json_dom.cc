@@ -35,6 +35,7 @@
 
 #include "my_rapidjson_size_t.h"  // IWYU pragma: keep
 
+#include <rapidjson/encodedstream.h>
 #include <rapidjson/error/en.h>
 #include <rapidjson/error/error.h>
 #include <rapidjson/memorystream.h>
@@ -587,7 +588,23 @@ Json_dom_ptr Json_dom::parse(const char *text, size_t length,
   Rapid_json_handler handler;
   rapidjson::MemoryStream ss(text, length);
   rapidjson::Reader reader;
-  bool success = reader.Parse<rapidjson::kParseDefaultFlags>(ss, handler);
+  bool success;
+  if (length > 0 && static_cast<uchar>(text[0]) == 0xEF) {
+    /*
+      Possibly a byte order mark. EncodedInputStream would strip it, but
+      a BOM is a JSON syntax error and must stay one, so parse the raw
+      stream.
+    */
+    success = reader.Parse<rapidjson::kParseDefaultFlags>(ss, handler);
+  } else {
+    /*
+      Wrap the stream so that rapidjson's vectorized whitespace skipping
+      is used; the plain MemoryStream has no SIMD fast path.
+    */
+    rapidjson::EncodedInputStream<rapidjson::UTF8<>, rapidjson::MemoryStream>
+        es(ss);
+    success = reader.Parse<rapidjson::kParseDefaultFlags>(es, handler);
+  }
 
   if (success) {
     Json_dom_ptr dom = handler.get_built_doc();
@@ -2042,15 +2059,20 @@ namespace {
   constant in recursive calls.
 */
 struct Json_seek_params {
-  Json_seek_params(const Json_path_iterator &last_leg,
+  Json_seek_params(const Json_path_iterator &first_leg,
+                   const Json_path_iterator &last_leg,
                    Json_wrapper_vector *hits, bool auto_wrap,
-                   bool only_need_one)
-      : m_last_leg(last_leg),
+                   bool only_need_one, Json_seek_hints *hints)
+      : m_first_leg(first_leg),
+        m_last_leg(last_leg),
         m_hits(hits),
         m_auto_wrap(auto_wrap),
         m_only_need_one(only_need_one),
+        m_hints(hints),
         m_is_done(false) {}
 
+  /// Iterator pointing at the first path leg, for computing leg numbers.
+  Json_path_iterator m_first_leg;
   /// Iterator pointing just after the last path leg to search for.
   Json_path_iterator m_last_leg;
   /// Pointer to the result vector.
@@ -2059,6 +2081,8 @@ struct Json_seek_params {
   bool m_auto_wrap;
   /// Should the search stop as soon as a match is found?
   bool m_only_need_one;
+  /// Positions where the member legs matched previously, or nullptr.
+  Json_seek_hints *m_hints;
   /// Should the search stop now?
   mutable bool m_is_done;
 };
@@ -2083,7 +2107,19 @@ static bool seek_member(const json_binary::Value &value,
 
   if (!value.is_object() || value.element_count() == 0) return false;
 
-  size_t pos = value.lookup_index((*current_leg)->get_member_name());
+  size_t pos;
+  if (params.m_hints != nullptr) {
+    /*
+      Probe the position where this leg matched in the previous
+      document first; documents in the same column usually share shape,
+      so the probe typically hits and the binary search is skipped.
+    */
+    size_t &hint = (*params.m_hints)[current_leg - params.m_first_leg];
+    pos = value.lookup_index((*current_leg)->get_member_name(), hint);
+    if (pos != value.element_count()) hint = pos;
+  } else {
+    pos = value.lookup_index((*current_leg)->get_member_name());
+  }
   if (pos == value.element_count()) return false;
 
   return seek_no_dup_elimination(value.element(pos), current_leg + 1, params);
@@ -2253,7 +2289,7 @@ get_seek_func(const Json_path_iterator &it, const Json_seek_params &params) {
 
 bool Json_wrapper::seek(const Json_seekable_path &path, size_t legs,
                         Json_wrapper_vector *hits, bool auto_wrap,
-                        bool only_need_one) {
+                        bool only_need_one, Json_seek_hints *hints) {
   DBUG_ASSERT(!empty());
 
   const auto begin = path.begin();
@@ -2283,8 +2319,10 @@ bool Json_wrapper::seek(const Json_seekable_path &path, size_t legs,
     return false;
   }
 
+  DBUG_ASSERT(hints == nullptr || hints->size() == legs);
   return seek_no_dup_elimination(
-      m_value, begin, Json_seek_params(end, hits, auto_wrap, only_need_one));
+      m_value, begin,
+      Json_seek_params(begin, end, hits, auto_wrap, only_need_one, hints));
 }
 #endif  // ifdef MYSQL_SERVER
 
@@ -3575,7 +3613,8 @@ bool Json_wrapper::attempt_binary_update(const Field_json *field,
   Json_wrapper_vector hits(key_memory_JSON);
   if (seek_no_dup_elimination(
           m_value, path.begin(),
-          Json_seek_params(path.end() - 1, &hits, false, true)))
+          Json_seek_params(path.begin(), path.end() - 1, &hits, false, true,
+                           nullptr)))
     return true; /* purecov: inspected */
 
   if (hits.empty()) {
@@ -3708,7 +3747,8 @@ bool Json_wrapper::binary_remove(const Field_json *field,
   Json_wrapper_vector hits(key_memory_JSON);
   if (seek_no_dup_elimination(
           m_value, path.begin(),
-          Json_seek_params(path.end() - 1, &hits, false, true)))
+          Json_seek_params(path.begin(), path.end() - 1, &hits, false, true,
+                           nullptr)))
     return true; /* purecov: inspected */
 
   DBUG_ASSERT(hits.size() <= 1);
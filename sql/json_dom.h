@@ -63,6 +63,16 @@ using Json_dom_ptr = std::unique_ptr<Json_dom>;
 using Json_array_ptr = std::unique_ptr<Json_array>;
 using Json_object_ptr = std::unique_ptr<Json_object>;
 
+/**
+  Memo of the key directory positions at which the member legs of a path
+  matched in a previously seeked document. One entry per path leg;
+  entries for non-member legs are unused. Callers that seek the same
+  path in a stream of documents with identical shape can pass the memo
+  to Json_wrapper::seek() to skip the binary search over the key
+  directory for legs whose position has not changed.
+*/
+using Json_seek_hints = std::vector<size_t>;
+
 /**
   @file sql/json_dom.h
   JSON DOM.
@@ -1537,12 +1547,17 @@ class Json_wrapper {
     @param[out] hits  the result of the search
     @param[in] auto_wrap true of we match a final scalar with search for [0]
     @param[in]  only_need_one True if we can stop after finding one match
+    @param[in,out] hints  positions where the member legs matched in a
+                          previously seeked document, or nullptr; must have
+                          one entry per leg if given. Only used when the
+                          wrapper holds a binary value.
 
     @retval false on success
     @retval true on error
   */
   bool seek(const Json_seekable_path &path, size_t legs,
-            Json_wrapper_vector *hits, bool auto_wrap, bool only_need_one);
+            Json_wrapper_vector *hits, bool auto_wrap, bool only_need_one,
+            Json_seek_hints *hints = nullptr);
 
   /**
     Compute the length of a document. This is the value which would be
@@ -24,6 +24,7 @@
 
 #include "my_rapidjson_size_t.h"  // IWYU pragma: keep
 
+#include <rapidjson/encodedstream.h>
 #include <rapidjson/error/en.h>
 #include <rapidjson/error/error.h>
 #include <rapidjson/memorystream.h>
@@ -60,7 +61,23 @@ bool is_valid_json_syntax(const char *text, size_t length, size_t *error_offset,
   Syntax_check_handler handler;
   rapidjson::Reader reader;
   rapidjson::MemoryStream ms(text, length);
-  const bool valid = reader.Parse<rapidjson::kParseDefaultFlags>(ms, handler);
+  bool valid;
+  if (length > 0 && static_cast<uchar>(text[0]) == 0xEF) {
+    /*
+      Possibly a byte order mark. EncodedInputStream would strip it, but
+      a BOM is a JSON syntax error and must stay one, so parse the raw
+      stream.
+    */
+    valid = reader.Parse<rapidjson::kParseDefaultFlags>(ms, handler);
+  } else {
+    /*
+      Wrap the stream so that rapidjson's vectorized whitespace skipping
+      is used; the plain MemoryStream has no SIMD fast path.
+    */
+    rapidjson::EncodedInputStream<rapidjson::UTF8<>, rapidjson::MemoryStream>
+        es(ms);
+    valid = reader.Parse<rapidjson::kParseDefaultFlags>(es, handler);
+  }
 
   if (!valid && (error_offset != nullptr || error_message != nullptr)) {
     const std::pair<std::string, size_t> error = get_error_from_reader(reader);
@@ -636,22 +636,26 @@ bool File_query_log::write_general(ulonglong event_utime,
   char buff[32];
   size_t length = 0;
 
-  mysql_mutex_lock(&LOCK_log);
-  DBUG_ASSERT(is_open());
-
-  /* Note that my_b_write() assumes it knows the length for this */
+  /*
+    Format the timestamp and thread id before taking LOCK_log, so that
+    concurrent sessions serialize only on writing the event.
+  */
   char local_time_buff[iso8601_size];
   int time_buff_len =
       make_iso8601_timestamp(local_time_buff, event_utime, opt_log_timestamps);
 
+  length = snprintf(buff, 32, "%5u ", thread_id);
+
+  mysql_mutex_lock(&LOCK_log);
+  DBUG_ASSERT(is_open());
+
+  /* Note that my_b_write() assumes it knows the length for this */
   if (my_b_write(&log_file, pointer_cast<uchar *>(local_time_buff),
                  time_buff_len))
     goto err;
 
   if (my_b_write(&log_file, pointer_cast<const uchar *>("\t"), 1)) goto err;
 
-  length = snprintf(buff, 32, "%5u ", thread_id);
-
   if (my_b_write(&log_file, pointer_cast<uchar *>(buff), length)) goto err;
 
   if (my_b_write(&log_file, pointer_cast<const uchar *>(command_type),
@@ -690,23 +694,27 @@ bool File_query_log::write_slow(THD *thd, ulonglong current_utime,
   size_t buff_len;
   end = buff;
 
-  mysql_mutex_lock(&LOCK_log);
-  DBUG_ASSERT(is_open());
+  /*
+    Format the event header into a local buffer before taking LOCK_log,
+    so that concurrent sessions serialize only on writing the formatted
+    bytes. The buffer is sized to hold the timestamp and user lines plus
+    the longest statistics line; all of the components are bounded.
+  */
+  char header_buff[MAX_USER_HOST_SIZE + 1024];
+  size_t header_len = 0;
 
   if (!(specialflag & SPECIAL_SHORT_LOG_FORMAT)) {
     char my_timestamp[iso8601_size];
 
     make_iso8601_timestamp(my_timestamp, current_utime, opt_log_timestamps);
 
-    buff_len = snprintf(buff, sizeof buff, "# Time: %s\n", my_timestamp);
+    header_len +=
+        snprintf(header_buff + header_len, sizeof(header_buff) - header_len,
+                 "# Time: %s\n", my_timestamp);
 
-    /* Note that my_b_write() assumes it knows the length for this */
-    if (my_b_write(&log_file, (uchar *)buff, buff_len)) goto err;
-
-    buff_len = snprintf(buff, 32, "%5u", thd->thread_id());
-    if (my_b_printf(&log_file, "# User@Host: %s  Id: %s\n", user_host, buff) ==
-        (uint)-1)
-      goto err;
+    header_len +=
+        snprintf(header_buff + header_len, sizeof(header_buff) - header_len,
+                 "# User@Host: %s  Id: %5u\n", user_host, thd->thread_id());
   }
 
   /* For slow query log */
@@ -724,13 +732,13 @@ bool File_query_log::write_slow(THD *thd, ulonglong current_utime,
     available, we generate the now, "long" line (with "extra" information).
   */
   if (!query_start) {
-    if (my_b_printf(&log_file,
-                    "# Query_time: %s  Lock_time: %s"
-                    " Rows_sent: %lu  Rows_examined: %lu\n",
-                    query_time_buff, lock_time_buff,
-                    (ulong)thd->get_sent_row_count(),
-                    (ulong)thd->get_examined_row_count()) == (uint)-1)
-      goto err; /* purecov: inspected */
+    header_len +=
+        snprintf(header_buff + header_len, sizeof(header_buff) - header_len,
+                 "# Query_time: %s  Lock_time: %s"
+                 " Rows_sent: %lu  Rows_examined: %lu\n",
+                 query_time_buff, lock_time_buff,
+                 (ulong)thd->get_sent_row_count(),
+                 (ulong)thd->get_examined_row_count());
   } else {
     char start_time_buff[iso8601_size];
     char end_time_buff[iso8601_size];
@@ -745,8 +753,9 @@ bool File_query_log::write_slow(THD *thd, ulonglong current_utime,
       make_iso8601_timestamp(end_time_buff, current_utime, opt_log_timestamps);
     }
 
-    if (my_b_printf(
-            &log_file,
+    header_len +=
+        snprintf(
+            header_buff + header_len, sizeof(header_buff) - header_len,
             "# Query_time: %s  Lock_time: %s"
             " Rows_sent: %lu  Rows_examined: %lu"
             " Thread_id: %lu Errno: %lu Killed: %lu"
@@ -793,10 +802,21 @@ bool File_query_log::write_slow(THD *thd, ulonglong current_utime,
                     query_start->created_tmp_disk_tables),
             (ulong)(thd->status_var.created_tmp_tables -
                     query_start->created_tmp_tables),
-            start_time_buff, end_time_buff) == (uint)-1)
-      goto err; /* purecov: inspected */
+            start_time_buff, end_time_buff);
   }
 
+  /* All components are bounded, so the header cannot be truncated. */
+  DBUG_ASSERT(header_len < sizeof(header_buff));
+  if (header_len >= sizeof(header_buff))
+    header_len = sizeof(header_buff) - 1; /* purecov: inspected */
+
+  mysql_mutex_lock(&LOCK_log);
+  DBUG_ASSERT(is_open());
+
+  if (my_b_write(&log_file, pointer_cast<const uchar *>(header_buff),
+                 header_len))
+    goto err;
+
   if (thd->db().str && strcmp(thd->db().str, db)) {  // Database changed
     if (my_b_printf(&log_file, "use %s;\n", thd->db().str) == (uint)-1)
       goto err;
@@ -3698,6 +3698,98 @@ bool MDL_context::upgrade_shared_lock(MDL_ticket *mdl_ticket,
   */
   if (mdl_ticket->has_stronger_or_equal_type(new_type)) return false;
 
+  lock = mdl_ticket->m_lock;
+
+  /*
+    First try to upgrade the ticket in place. When there are no conflicting
+    granted locks from other contexts and no higher priority waiters, the
+    upgrade can be granted immediately by changing the type of the existing
+    ticket, which avoids constructing, acquiring and then merging/destroying
+    a second ticket and the second pass over MDL_lock lists this requires.
+    Upgrades to X locks in namespaces with SE notification take the usual
+    route below so that all hton notification logic stays in acquire_lock().
+  */
+  if (!(new_type == MDL_EXCLUSIVE &&
+        MDL_lock::needs_hton_notification(lock->key.mdl_namespace()))) {
+    /* The counter manipulation below relies on this invariant. */
+    DBUG_ASSERT(lock->is_obtrusive_lock(new_type));
+
+    /*
+      MDL_lock::can_grant_lock() assumes that all granted "fast path" locks
+      belong to contexts other than the requestor, so our own tickets have
+      to be materialized first (same as for any "obtrusive" acquisition).
+    */
+    materialize_fast_path_locks();
+
+    DBUG_ASSERT(!mdl_ticket->m_is_fast_path);
+
+    mysql_prlock_wrlock(&lock->m_rwlock);
+
+    /*
+      The HAS_OBTRUSIVE flag needs to be set before the call to
+      MDL_lock::can_grant_lock(), exactly as in the slow path of
+      MDL_context::try_acquire_lock_impl(), to prevent concurrent "fast
+      path" acquisitions from invalidating its result.
+    */
+    bool first_obtrusive_lock =
+        ((lock->m_obtrusive_locks_granted_waiting_count++) == 0);
+
+    if (first_obtrusive_lock) {
+      MDL_lock::fast_path_state_t old_state = lock->m_fast_path_state;
+      while (!lock->fast_path_state_cas(
+          &old_state, old_state | MDL_lock::HAS_SLOW_PATH |
+                          MDL_lock::HAS_OBTRUSIVE)) {
+      }
+    }
+
+    /*
+      Conflicting granted locks belonging to this context (including the
+      ticket being upgraded) do not prevent the grant, can_grant_lock()
+      skips them.
+    */
+    if (lock->can_grant_lock(new_type, this)) {
+      /*
+        Temporarily exclude the ticket from the granted queue so that the
+        bitmaps and counters are updated correctly for the type change.
+        The pre-incremented "obtrusive" counter now accounts for the
+        upgraded ticket.
+      */
+      lock->m_granted.remove_ticket(mdl_ticket);
+      if (lock->is_obtrusive_lock(mdl_ticket->m_type))
+        --lock->m_obtrusive_locks_granted_waiting_count;
+
+      mdl_ticket->m_type = new_type;
+      lock->m_granted.add_ticket(mdl_ticket);
+
+      /*
+        Just like after a slow path grant we might have acquired a "piglet"
+        or "hog" lock while there are pending lower priority locks.
+      */
+      if (lock->is_affected_by_max_write_lock_count()) {
+        if (lock->count_piglets_and_hogs(new_type))
+          lock->reschedule_waiters();
+      }
+
+      mysql_prlock_unlock(&lock->m_rwlock);
+      return false;
+    }
+
+    /*
+      Somebody obstructs the upgrade. Undo the "obtrusive" pre-increment
+      and take the normal acquire-and-merge route which can wait.
+      The HAS_SLOW_PATH flag stays set correctly in any case since the
+      materialized ticket is present in the granted queue.
+    */
+    if (--lock->m_obtrusive_locks_granted_waiting_count == 0) {
+      MDL_lock::fast_path_state_t old_state = lock->m_fast_path_state;
+      while (!lock->fast_path_state_cas(
+          &old_state, old_state & ~MDL_lock::HAS_OBTRUSIVE)) {
+      }
+    }
+
+    mysql_prlock_unlock(&lock->m_rwlock);
+  }
+
   MDL_REQUEST_INIT_BY_KEY(&mdl_new_lock_request, &mdl_ticket->m_lock->key,
                           new_type, MDL_TRANSACTION);
 
@@ -331,6 +331,24 @@ inline int my_decimal2double(uint, const my_decimal *d, double *result) {
   return decimal2double(d, result);
 }
 
+#ifdef __SIZEOF_INT128__
+/**
+  Convert a my_decimal to a 128-bit integer scaled by 10^scale.
+  Fails (without raising any error when mask is 0) if the value does not
+  fit the representation; see decimal2int128().
+*/
+inline int my_decimal2int128(uint mask, const my_decimal *d, int scale,
+                             __int128 *l) {
+  return d->check_result(mask, decimal2int128(d, scale, l));
+}
+
+/// Convert a 128-bit integer scaled by 10^scale to a my_decimal.
+inline int int128_to_my_decimal(uint mask, __int128 l, int scale,
+                                my_decimal *d) {
+  return d->check_result(mask, int128todecimal(l, scale, d));
+}
+#endif
+
 inline int my_decimal2lldiv_t(uint mask, const my_decimal *d, lldiv_t *to) {
   return d->check_result(mask, decimal2lldiv_t(d, to));
 }
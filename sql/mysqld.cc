@@ -892,6 +892,7 @@ The documentation is based on the source files such as:
 #ifdef _WIN32
 #include "sql/restart_monitor_win.h"
 #endif
+#include "sql/rpl_commit_stage_manager.h"  // binlog_stage_trx_count
 #include "sql/rpl_filter.h"
 #include "sql/rpl_gtid.h"
 #include "sql/rpl_gtid_persist.h"  // Gtid_table_persistor
@@ -1157,6 +1158,7 @@ PSI_rwlock_key key_rwlock_gtid_mode_lock;
 static PSI_rwlock_key key_rwlock_LOCK_system_variables_hash;
 static PSI_rwlock_key key_rwlock_LOCK_sys_init_connect;
 static PSI_rwlock_key key_rwlock_LOCK_sys_init_slave;
+static PSI_rwlock_key key_rwlock_LOCK_global_variables_snapshot;
 static PSI_cond_key key_BINLOG_COND_done;
 static PSI_cond_key key_BINLOG_update_cond;
 static PSI_cond_key key_BINLOG_prep_xids_cond;
@@ -1384,6 +1386,10 @@ ulong table_def_size;
 ulong tablespace_def_size;
 ulong what_to_log;
 ulong slow_launch_time;
+ulong optimizer_trace_sample_rate;
+bool optimizer_capture_plan_outlines = false;
+bool optimizer_use_plan_outlines = false;
+bool optimizer_flush_plan_outlines = false;
 std::atomic<int32> atomic_slave_open_temp_tables{0};
 ulong open_files_limit, max_binlog_size, max_relay_log_size;
 ulong slave_trans_retries;
@@ -1605,6 +1611,7 @@ mysql_mutex_t LOCK_slave_trans_dep_tracker;
 mysql_mutex_t LOCK_log_throttle_qni;
 mysql_rwlock_t LOCK_sys_init_connect, LOCK_sys_init_slave;
 mysql_rwlock_t LOCK_system_variables_hash;
+mysql_rwlock_t LOCK_global_variables_snapshot;
 my_thread_handle signal_thread_id;
 sigset_t mysqld_signal_mask;
 my_thread_attr_t connection_attrib;
@@ -2643,6 +2650,7 @@ static void clean_up_mutexes() {
   mysql_mutex_destroy(&LOCK_user_conn);
   mysql_rwlock_destroy(&LOCK_sys_init_connect);
   mysql_rwlock_destroy(&LOCK_sys_init_slave);
+  mysql_rwlock_destroy(&LOCK_global_variables_snapshot);
   mysql_mutex_destroy(&LOCK_global_system_variables);
   mysql_rwlock_destroy(&LOCK_system_variables_hash);
   mysql_mutex_destroy(&LOCK_uuid_generator);
@@ -5059,6 +5067,8 @@ static int init_thread_environment() {
                    &LOCK_password_reuse_interval, MY_MUTEX_INIT_FAST);
   mysql_rwlock_init(key_rwlock_LOCK_sys_init_connect, &LOCK_sys_init_connect);
   mysql_rwlock_init(key_rwlock_LOCK_sys_init_slave, &LOCK_sys_init_slave);
+  mysql_rwlock_init(key_rwlock_LOCK_global_variables_snapshot,
+                    &LOCK_global_variables_snapshot);
   mysql_cond_init(key_COND_manager, &COND_manager);
   mysql_mutex_init(key_LOCK_server_started, &LOCK_server_started,
                    MY_MUTEX_INIT_FAST);
@@ -8777,6 +8787,13 @@ static int show_open_tables(THD *, SHOW_VAR *var, char *buff) {
   return 0;
 }
 
+static int show_table_open_cache_instances(THD *, SHOW_VAR *var, char *) {
+  var->type = SHOW_ARRAY;
+  var->value = (char *)table_cache_manager.status_vars();
+  var->scope = SHOW_SCOPE_GLOBAL;
+  return 0;
+}
+
 static int show_prepared_stmt_count(THD *, SHOW_VAR *var, char *buff) {
   var->type = SHOW_LONG;
   var->value = buff;
@@ -8916,10 +8933,46 @@ SHOW_VAR status_vars[] = {
      SHOW_SCOPE_GLOBAL},
     {"Binlog_cache_use", (char *)&binlog_cache_use, SHOW_LONG,
      SHOW_SCOPE_GLOBAL},
+    {"Binlog_stage_commit_group_count",
+     (char *)&binlog_stage_group_count[Commit_stage_manager::COMMIT_STAGE],
+     SHOW_LONGLONG, SHOW_SCOPE_GLOBAL},
+    {"Binlog_stage_commit_max_queue_depth",
+     (char *)&binlog_stage_max_queue_depth[Commit_stage_manager::COMMIT_STAGE],
+     SHOW_LONGLONG, SHOW_SCOPE_GLOBAL},
+    {"Binlog_stage_commit_trx_count",
+     (char *)&binlog_stage_trx_count[Commit_stage_manager::COMMIT_STAGE],
+     SHOW_LONGLONG, SHOW_SCOPE_GLOBAL},
+    {"Binlog_stage_flush_group_count",
+     (char *)&binlog_stage_group_count
+         [Commit_stage_manager::BINLOG_FLUSH_STAGE],
+     SHOW_LONGLONG, SHOW_SCOPE_GLOBAL},
+    {"Binlog_stage_flush_max_queue_depth",
+     (char *)&binlog_stage_max_queue_depth
+         [Commit_stage_manager::BINLOG_FLUSH_STAGE],
+     SHOW_LONGLONG, SHOW_SCOPE_GLOBAL},
+    {"Binlog_stage_flush_trx_count",
+     (char *)&binlog_stage_trx_count[Commit_stage_manager::BINLOG_FLUSH_STAGE],
+     SHOW_LONGLONG, SHOW_SCOPE_GLOBAL},
+    {"Binlog_stage_sync_group_count",
+     (char *)&binlog_stage_group_count[Commit_stage_manager::SYNC_STAGE],
+     SHOW_LONGLONG, SHOW_SCOPE_GLOBAL},
+    {"Binlog_stage_sync_max_queue_depth",
+     (char *)&binlog_stage_max_queue_depth[Commit_stage_manager::SYNC_STAGE],
+     SHOW_LONGLONG, SHOW_SCOPE_GLOBAL},
+    {"Binlog_stage_sync_trx_count",
+     (char *)&binlog_stage_trx_count[Commit_stage_manager::SYNC_STAGE],
+     SHOW_LONGLONG, SHOW_SCOPE_GLOBAL},
     {"Binlog_stmt_cache_disk_use", (char *)&binlog_stmt_cache_disk_use,
      SHOW_LONG, SHOW_SCOPE_GLOBAL},
     {"Binlog_stmt_cache_use", (char *)&binlog_stmt_cache_use, SHOW_LONG,
      SHOW_SCOPE_GLOBAL},
+    {"Binlog_writeset_history_evictions",
+     (char *)&binlog_writeset_history_evictions, SHOW_LONGLONG,
+     SHOW_SCOPE_GLOBAL},
+    {"Binlog_writeset_history_hits", (char *)&binlog_writeset_history_hits,
+     SHOW_LONGLONG, SHOW_SCOPE_GLOBAL},
+    {"Binlog_writeset_history_misses", (char *)&binlog_writeset_history_misses,
+     SHOW_LONGLONG, SHOW_SCOPE_GLOBAL},
     {"Bytes_received", (char *)offsetof(System_status_var, bytes_received),
      SHOW_LONGLONG_STATUS, SHOW_SCOPE_ALL},
     {"Bytes_sent", (char *)offsetof(System_status_var, bytes_sent),
@@ -9106,6 +9159,12 @@ SHOW_VAR status_vars[] = {
      SHOW_SCOPE_ALL},
     {"Slow_queries", (char *)offsetof(System_status_var, long_query_count),
      SHOW_LONGLONG_STATUS, SHOW_SCOPE_ALL},
+    {"Sort_key_cache_hits",
+     (char *)offsetof(System_status_var, filesort_key_cache_hits),
+     SHOW_LONGLONG_STATUS, SHOW_SCOPE_ALL},
+    {"Sort_key_cache_misses",
+     (char *)offsetof(System_status_var, filesort_key_cache_misses),
+     SHOW_LONGLONG_STATUS, SHOW_SCOPE_ALL},
     {"Sort_merge_passes",
      (char *)offsetof(System_status_var, filesort_merge_passes),
      SHOW_LONGLONG_STATUS, SHOW_SCOPE_ALL},
@@ -9211,6 +9270,8 @@ SHOW_VAR status_vars[] = {
     {"Table_open_cache_hits",
      (char *)offsetof(System_status_var, table_open_cache_hits),
      SHOW_LONGLONG_STATUS, SHOW_SCOPE_ALL},
+    {"Table_open_cache_instance", (char *)&show_table_open_cache_instances,
+     SHOW_FUNC, SHOW_SCOPE_GLOBAL},
     {"Table_open_cache_misses",
      (char *)offsetof(System_status_var, table_open_cache_misses),
      SHOW_LONGLONG_STATUS, SHOW_SCOPE_ALL},
@@ -11004,6 +11065,7 @@ static PSI_rwlock_info all_server_rwlocks[]=
   { &key_rwlock_LOCK_logger, "LOGGER::LOCK_logger", 0, 0, PSI_DOCUMENT_ME},
   { &key_rwlock_LOCK_sys_init_connect, "LOCK_sys_init_connect", PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
   { &key_rwlock_LOCK_sys_init_slave, "LOCK_sys_init_slave", PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
+  { &key_rwlock_LOCK_global_variables_snapshot, "LOCK_global_variables_snapshot", PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
   { &key_rwlock_LOCK_system_variables_hash, "LOCK_system_variables_hash", PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
   { &key_rwlock_global_sid_lock, "gtid_commit_rollback", PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
   { &key_rwlock_gtid_mode_lock, "gtid_mode_lock", PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
@@ -288,6 +288,10 @@ extern ulong delayed_insert_timeout;
 extern ulong delayed_insert_limit, delayed_queue_size;
 extern std::atomic<int32> atomic_slave_open_temp_tables;
 extern ulong slow_launch_time;
+extern ulong optimizer_trace_sample_rate;
+extern bool optimizer_capture_plan_outlines;
+extern bool optimizer_use_plan_outlines;
+extern bool optimizer_flush_plan_outlines;
 extern ulong table_cache_size;
 extern ulong schema_def_size;
 extern ulong stored_program_def_size;
@@ -687,6 +691,7 @@ extern mysql_cond_t COND_manager;
 extern mysql_rwlock_t LOCK_sys_init_connect;
 extern mysql_rwlock_t LOCK_sys_init_slave;
 extern mysql_rwlock_t LOCK_system_variables_hash;
+extern mysql_rwlock_t LOCK_global_variables_snapshot;
 
 extern ulong opt_ssl_fips_mode;
 
@@ -2011,6 +2011,11 @@ vector<string> FullDebugString(const THD *thd, const RowIterator &iterator) {
     }
     ret.back().push_back(' ');
     ret.back() += iterator.TimingString();
+    const std::string extra_stats = iterator.ExtraStatsString();
+    if (!extra_stats.empty()) {
+      ret.back().push_back(' ');
+      ret.back() += extra_stats;
+    }
   }
   return ret;
 }
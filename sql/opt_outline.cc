@@ -0,0 +1,312 @@
+/* Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+/**
+  @file
+  Implementation of plan outlines, cf. opt_outline.h.
+
+  The registry maps a statement digest (its printable SHA-256 form, as shown
+  in performance_schema) to the list of (table alias, index name) pins that
+  were captured for the statement. It is persisted to the text file
+  "plan_outlines.dump" in the data directory, one pin per line, and loaded
+  lazily on first use, so that outlines survive a server restart without
+  needing a hook in server startup.
+*/
+
+#include "sql/opt_outline.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "m_ctype.h"
+#include "my_dbug.h"
+#include "my_inttypes.h"
+#include "my_io.h"
+#include "my_sys.h"
+#include "mysql/psi/mysql_mutex.h"
+#include "sql/auth/auth_acls.h"  // PROCESS_ACL
+#include "sql/auth/sql_security_ctx.h"
+#include "sql/field.h"
+#include "sql/key.h"     // KEY
+#include "sql/mysqld.h"     // mysql_real_data_home
+#include "sql/opt_range.h"  // QUICK_SELECT_I
+#include "sql/sql_class.h"
+#include "sql/sql_digest.h"  // DIGEST_HASH_TO_STRING
+#include "sql/sql_executor.h"
+#include "sql/sql_lex.h"
+#include "sql/sql_optimizer.h"  // JOIN
+#include "sql/sql_select.h"     // Key_use
+#include "sql/sql_show.h"       // schema_table_store_record
+#include "sql/table.h"
+
+namespace {
+
+/// One pinned access path: this table should be read through this index.
+struct Outline_pin {
+  std::string table_alias;
+  std::string index_name;
+};
+
+/// All pins captured for one statement digest.
+using Plan_outline = std::vector<Outline_pin>;
+
+std::unordered_map<std::string, Plan_outline> outline_registry;
+bool outlines_loaded = false;
+mysql_mutex_t LOCK_plan_outlines;
+
+/**
+  The registry can be touched from the optimizer before any plugin or P_S
+  instrumentation cares about it, so its lock is a plain uninstrumented
+  mutex, initialized on load.
+*/
+struct Outline_registry_lock {
+  Outline_registry_lock() {
+    mysql_mutex_init(PSI_NOT_INSTRUMENTED, &LOCK_plan_outlines,
+                     MY_MUTEX_INIT_FAST);
+  }
+  ~Outline_registry_lock() { mysql_mutex_destroy(&LOCK_plan_outlines); }
+} outline_registry_lock;
+
+const char OUTLINE_FILE_NAME[] = "plan_outlines.dump";
+
+void outline_file_path(char *buff) {
+  fn_format(buff, OUTLINE_FILE_NAME, mysql_real_data_home, "",
+            MY_UNPACK_FILENAME);
+}
+
+/**
+  Loads the dump file into the registry, once per server life.
+  Call with LOCK_plan_outlines held.
+*/
+void load_outlines_if_needed() {
+  mysql_mutex_assert_owner(&LOCK_plan_outlines);
+  if (outlines_loaded) return;
+  // Even if reading fails, don't retry on every statement.
+  outlines_loaded = true;
+
+  char path[FN_REFLEN];
+  outline_file_path(path);
+  FILE *file = my_fopen(path, O_RDONLY, MYF(0));
+  if (file == nullptr) return;  // no outlines captured yet
+
+  char line[FN_REFLEN + 2 * NAME_LEN + DIGEST_HASH_TO_STRING_LENGTH];
+  while (fgets(line, sizeof(line), file) != nullptr) {
+    char *const nl = strchr(line, '\n');
+    if (nl != nullptr) *nl = '\0';
+    // Line format: digest<TAB>table_alias<TAB>index_name
+    char *const alias = strchr(line, '\t');
+    if (alias == nullptr) continue;
+    *alias = '\0';
+    char *const index = strchr(alias + 1, '\t');
+    if (index == nullptr) continue;
+    *index = '\0';
+    if (strlen(line) != DIGEST_HASH_TO_STRING_LENGTH || alias[1] == '\0' ||
+        index[1] == '\0')
+      continue;  // not written by us; ignore
+    outline_registry[line].push_back(Outline_pin{alias + 1, index + 1});
+  }
+  my_fclose(file, MYF(0));
+}
+
+/**
+  Rewrites the dump file from the registry.
+  Call with LOCK_plan_outlines held.
+*/
+void save_outlines() {
+  mysql_mutex_assert_owner(&LOCK_plan_outlines);
+  char path[FN_REFLEN];
+  outline_file_path(path);
+  FILE *file = my_fopen(path, O_CREAT | O_WRONLY, MYF(MY_WME));
+  if (file == nullptr) return;
+  for (const auto &outline : outline_registry)
+    for (const Outline_pin &pin : outline.second)
+      fprintf(file, "%s\t%s\t%s\n", outline.first.c_str(),
+              pin.table_alias.c_str(), pin.index_name.c_str());
+  my_fclose(file, MYF(0));
+}
+
+/**
+  Renders the statement digest in its printable form, as shown in
+  performance_schema.events_statements_summary_by_digest.
+
+  @param      thd  the connection
+  @param[out] buf  receives the digest,
+                   DIGEST_HASH_TO_STRING_LENGTH + 1 bytes
+
+  @returns true if the statement has a digest, false otherwise (then 'buf'
+  is untouched)
+*/
+bool statement_digest_string(THD *thd, char *buf) {
+  if (thd->m_digest == nullptr ||
+      thd->m_digest->m_digest_storage.m_byte_count == 0)
+    return false;
+  uchar hash[DIGEST_HASH_SIZE];
+  compute_digest_hash(&thd->m_digest->m_digest_storage, hash);
+  DIGEST_HASH_TO_STRING(hash, buf);
+  buf[DIGEST_HASH_TO_STRING_LENGTH] = '\0';
+  return true;
+}
+
+/**
+  @returns the number of the index the final plan reads 'tab' through, or
+  MAX_KEY if the access path is not pinnable (table scan, index merge, ...).
+*/
+uint plan_index_of(QEP_TAB *tab) {
+  if (tab->position()->key != nullptr) return tab->position()->key->key;
+  if (tab->quick() != nullptr) return tab->quick()->index;
+  if (tab->type() == JT_INDEX_SCAN) return tab->index();
+  return MAX_KEY;
+}
+
+}  // namespace
+
+void opt_outline_capture_plan(THD *thd, JOIN *join) {
+  if (likely(!optimizer_capture_plan_outlines)) return;
+  if (join->select_lex != thd->lex->select_lex) return;
+
+  char digest[DIGEST_HASH_TO_STRING_LENGTH + 1];
+  if (!statement_digest_string(thd, digest)) return;
+
+  Plan_outline outline;
+  for (uint i = 0; i < join->primary_tables; i++) {
+    QEP_TAB *const tab = &join->qep_tab[i];
+    if (tab->position() == nullptr) continue;
+    const TABLE *const table = tab->table();
+    const uint keynr = plan_index_of(tab);
+    if (keynr >= table->s->keys) continue;
+    const char *const index_name = table->key_info[keynr].name;
+    // The dump file is line- and tab-separated; don't capture the rare
+    // aliases which cannot be stored in it faithfully.
+    if (strpbrk(table->alias, "\t\n") != nullptr ||
+        strpbrk(index_name, "\t\n") != nullptr)
+      continue;
+    outline.push_back(Outline_pin{table->alias, index_name});
+  }
+  if (outline.empty()) return;  // nothing pinnable in this plan
+
+  mysql_mutex_lock(&LOCK_plan_outlines);
+  load_outlines_if_needed();
+  outline_registry[digest] = std::move(outline);
+  save_outlines();
+  mysql_mutex_unlock(&LOCK_plan_outlines);
+}
+
+void opt_outline_apply(THD *thd, JOIN *join) {
+  if (likely(!optimizer_use_plan_outlines)) return;
+  if (join->select_lex != thd->lex->select_lex) return;
+
+  char digest[DIGEST_HASH_TO_STRING_LENGTH + 1];
+  if (!statement_digest_string(thd, digest)) return;
+
+  mysql_mutex_lock(&LOCK_plan_outlines);
+  load_outlines_if_needed();
+  const auto it = outline_registry.find(digest);
+  // Copy under the mutex; the registry may be flushed concurrently.
+  const Plan_outline outline =
+      (it == outline_registry.end()) ? Plan_outline() : it->second;
+  mysql_mutex_unlock(&LOCK_plan_outlines);
+
+  for (const Outline_pin &pin : outline) {
+    for (TABLE_LIST *tl = join->select_lex->leaf_tables; tl != nullptr;
+         tl = tl->next_leaf) {
+      if (tl->table == nullptr ||
+          my_strcasecmp(table_alias_charset, tl->alias,
+                        pin.table_alias.c_str()) != 0)
+        continue;
+      // An explicit index hint in the statement wins over the outline.
+      if (tl->index_hints != nullptr) break;
+      TABLE *const table = tl->table;
+      uint keynr;
+      for (keynr = 0; keynr < table->s->keys; keynr++)
+        if (my_strcasecmp(system_charset_info, table->key_info[keynr].name,
+                          pin.index_name.c_str()) == 0)
+          break;
+      /*
+        The index may have been dropped, or be disabled for this statement;
+        then the outline is stale for this table and must not be enforced,
+        or we would force a plan the index set cannot deliver.
+      */
+      if (keynr == table->s->keys ||
+          !table->keys_in_use_for_query.is_set(keynr))
+        break;
+      // Enforce the pin exactly like FORCE INDEX(index_name) would.
+      table->keys_in_use_for_query.clear_all();
+      table->keys_in_use_for_query.set_bit(keynr);
+      table->keys_in_use_for_group_by = table->keys_in_use_for_query;
+      table->keys_in_use_for_order_by = table->keys_in_use_for_query;
+      table->force_index = true;
+      break;
+    }
+  }
+}
+
+void opt_outline_flush() {
+  mysql_mutex_lock(&LOCK_plan_outlines);
+  outline_registry.clear();
+  outlines_loaded = true;  // the registry now overrides the file
+  save_outlines();
+  mysql_mutex_unlock(&LOCK_plan_outlines);
+}
+
+int fill_optimizer_plan_outlines(THD *thd, TABLE_LIST *tables, Item *) {
+  TABLE *table = tables->table;
+
+  /*
+    Outlines describe other users' statements; require PROCESS, like the
+    processlist does, and degrade to an empty table without it.
+  */
+  if (!thd->security_context()->check_access(PROCESS_ACL)) return 0;
+
+  mysql_mutex_lock(&LOCK_plan_outlines);
+  load_outlines_if_needed();
+  for (const auto &outline : outline_registry) {
+    for (const Outline_pin &pin : outline.second) {
+      restore_record(table, s->default_values);
+      table->field[0]->store(outline.first.c_str(), outline.first.length(),
+                             system_charset_info);
+      table->field[1]->store(pin.table_alias.c_str(), pin.table_alias.length(),
+                             system_charset_info);
+      table->field[2]->store(pin.index_name.c_str(), pin.index_name.length(),
+                             system_charset_info);
+      if (schema_table_store_record(thd, table)) {
+        mysql_mutex_unlock(&LOCK_plan_outlines);
+        return 1;
+      }
+    }
+  }
+  mysql_mutex_unlock(&LOCK_plan_outlines);
+
+  return 0;
+}
+
+ST_FIELD_INFO optimizer_plan_outlines_info[] = {
+    /* name, length, type, value, maybe_null, old_name, open_method */
+    {"DIGEST", DIGEST_HASH_TO_STRING_LENGTH, MYSQL_TYPE_STRING, 0, false,
+     nullptr, 0},
+    {"TABLE_ALIAS", NAME_CHAR_LEN, MYSQL_TYPE_STRING, 0, false, nullptr, 0},
+    {"INDEX_NAME", NAME_CHAR_LEN, MYSQL_TYPE_STRING, 0, false, nullptr, 0},
+    {nullptr, 0, MYSQL_TYPE_STRING, 0, true, nullptr, 0}};
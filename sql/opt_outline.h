@@ -0,0 +1,85 @@
+#ifndef OPT_OUTLINE_INCLUDED
+#define OPT_OUTLINE_INCLUDED
+
+/* Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+/**
+  @file
+  Plan outlines: plan pinning by statement digest.
+
+  A plan outline records, per statement digest, which index the optimizer
+  chose for each table of the statement. When outlines are applied
+  (@@optimizer_use_plan_outlines), the recorded index choice is enforced the
+  same way FORCE INDEX is, before join planning starts, so that statistics
+  drift cannot silently flip a tuned query from an index access to a table
+  scan. Outlines are captured from live statements
+  (@@optimizer_capture_plan_outlines), kept in a global registry, persisted
+  to a dump file in the data directory, and visible in
+  information_schema.OPTIMIZER_PLAN_OUTLINES.
+*/
+
+class Item;
+class JOIN;
+class THD;
+struct TABLE_LIST;
+
+/**
+  If outline capture is enabled (@@optimizer_capture_plan_outlines),
+  records the access-path choices of this statement's top-level JOIN as a
+  plan outline keyed by the statement digest, replacing any previous
+  outline for the digest. Must be called when the plan is final, i.e. at
+  the end of JOIN::optimize().
+
+  @param thd   the connection
+  @param join  the optimized top-level JOIN
+*/
+void opt_outline_capture_plan(THD *thd, JOIN *join);
+
+/**
+  If outline application is enabled (@@optimizer_use_plan_outlines) and the
+  registry holds an outline for this statement's digest, enforces the
+  outline's index choices on the tables of the top-level query block, like
+  FORCE INDEX does. Tables carrying explicit index hints in the statement
+  are left alone. Must be called before join planning, i.e. before
+  JOIN::make_join_plan().
+
+  @param thd   the connection
+  @param join  the to-be-optimized top-level JOIN
+*/
+void opt_outline_apply(THD *thd, JOIN *join);
+
+/**
+  Empties the plan outline registry and its dump file, cf.
+  @@optimizer_flush_plan_outlines.
+*/
+void opt_outline_flush();
+
+/**
+   Fills information_schema.OPTIMIZER_PLAN_OUTLINES with one row per pinned
+   table of each registered outline.
+   @retval 0 ok
+   @retval 1 error
+*/
+int fill_optimizer_plan_outlines(THD *thd, TABLE_LIST *tables, Item *);
+
+#endif /* OPT_OUTLINE_INCLUDED */
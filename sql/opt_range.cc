@@ -3708,18 +3708,18 @@ bool prune_partitions(THD *thd, TABLE *table, Item *pprune_cond) {
   partition_info *part_info = table->part_info;
   DBUG_TRACE;
 
+  if (!part_info) return false; /* not a partitioned table */
+
   /*
     If the prepare stage already have completed pruning successfully,
     it is no use of running prune_partitions() again on the same condition.
     Since it will not be able to prune anything more than the previous call
     from the prepare step.
   */
-  if (part_info && part_info->is_pruning_completed) return false;
+  if (part_info->is_pruning_completed) return false;
 
   table->all_partitions_pruned_away = false;
 
-  if (!part_info) return false; /* not a partitioned table */
-
   if (table->s->db_type()->partition_flags() & HA_USE_AUTO_PARTITION &&
       part_info->is_auto_partitioned)
     return false; /* Should not prune auto partitioned table */
@@ -6238,6 +6238,103 @@ static SEL_TREE *get_ne_mm_tree(RANGE_OPT_PARAM *param, Item_func *cond_func,
   return tree;
 }
 
+/**
+  Build a SEL_TREE for "t.field IN (c1, c2, ...)" from the predicate's
+  sorted value array.
+
+  The generic code path below builds one single-point SEL_TREE per list
+  element and merges it into the accumulated tree with tree_or(). Since
+  tree_or() walks both trees, a list of N constants costs O(N^2) work and
+  produces a similar amount of discarded SEL_ARG nodes, which is noticeable
+  for the multi-thousand element IN lists generated by ORM tools.
+
+  When the values are available in Item_func_in::array, they are already
+  sorted in ascending order and can be appended to the right end of each
+  index's interval tree directly, which makes the construction O(N log N).
+  The element is appended only when it provably extends the tree: the new
+  interval must be a single SEL_ARG without next keypart that starts after
+  the current rightmost interval ends. Anything irregular — descending key
+  parts, values truncated by a partial index so that intervals touch, MAYBE
+  flags — falls back to a regular tree_or() merge for that element.
+
+  @param param  Information on 'just about everything'.
+  @param op     The 'in' operator itself. op->array must be non-NULL and
+                hold non-row values.
+  @param field  The field on the left-hand side of the predicate.
+
+  @return The SEL_TREE built, or NULL if the values cannot be used for any
+          index (the caller may then try the generic per-argument path,
+          which will come to the same conclusion cheaply).
+*/
+static SEL_TREE *get_func_mm_tree_from_sorted_in_array(RANGE_OPT_PARAM *param,
+                                                       Item_func_in *op,
+                                                       Field *field) {
+  in_vector *array = op->array;
+
+  // An all-NULL list leaves nothing to build intervals from.
+  if (array->used_count == 0) return nullptr;
+
+  /*
+    Create one constant object, reused for every element. It must live on
+    param->old_root, which points to the per-statement mem_root (while
+    thd->mem_root currently points to the mem_root local to the range
+    optimizer); see the NOT IN handling in
+    get_func_mm_tree_from_in_predicate().
+  */
+  Item_basic_constant *value_item = array->create_item(param->old_root);
+  if (value_item == nullptr) return nullptr;
+
+  // Find the first element that yields a usable interval.
+  uint i = 0;
+  SEL_TREE *tree = nullptr;
+  do {
+    array->value_to_item(i, value_item);
+    tree = get_mm_parts(param, op, field, Item_func::EQ_FUNC, value_item);
+    if (tree == nullptr) return nullptr;
+    i++;
+  } while (i < array->used_count && tree->type == SEL_TREE::IMPOSSIBLE);
+
+  // We get here in cases like "t.unsigned IN (-1,-2,-3)".
+  if (tree->type == SEL_TREE::IMPOSSIBLE) return tree;
+
+  for (; i < array->used_count; i++) {
+    if (!array->compare_elems(i, i - 1)) continue;  // Skip duplicates.
+
+    array->value_to_item(i, value_item);
+    SEL_TREE *tree2 =
+        get_mm_parts(param, op, field, Item_func::EQ_FUNC, value_item);
+    if (tree2 == nullptr) return nullptr;
+    if (tree2->type == SEL_TREE::IMPOSSIBLE) continue;
+
+    // First check, without modifying anything, that the new element can be
+    // appended at the right end of every index's tree.
+    bool can_append =
+        tree->type == SEL_TREE::KEY && tree2->type == SEL_TREE::KEY;
+    for (uint idx = 0; can_append && idx < param->keys; idx++) {
+      SEL_ROOT *key = tree->keys[idx];
+      SEL_ROOT *key2 = tree2->keys[idx];
+      if (key == nullptr && key2 == nullptr) continue;
+      if (key == nullptr || key2 == nullptr ||
+          key->type != SEL_ROOT::Type::KEY_RANGE ||
+          key2->type != SEL_ROOT::Type::KEY_RANGE || key2->elements != 1 ||
+          key2->root->next_key_part != nullptr || key2->root->maybe_flag ||
+          key->root->last()->cmp_max_to_min(key2->root) >= 0)
+        can_append = false;
+    }
+
+    if (can_append) {
+      for (uint idx = 0; idx < param->keys; idx++) {
+        if (tree->keys[idx] == nullptr) continue;
+        tree->keys[idx]->insert(tree2->keys[idx]->root);
+      }
+    } else {
+      tree = tree_or(param, tree, tree2);
+      if (tree == nullptr || tree->type == SEL_TREE::ALWAYS) return tree;
+    }
+  }
+  return tree;
+}
+
 /**
   Factory function to build a SEL_TREE from an @<in predicate@>
 
@@ -6407,6 +6504,13 @@ static SEL_TREE *get_func_mm_tree_from_in_predicate(RANGE_OPT_PARAM *param,
   if (predicand->type() == Item::FIELD_ITEM) {
     // The expression is (<column>) IN (...)
     Field *field = static_cast<Item_field *>(predicand)->field;
+    if (op->array && !op->array->is_row_result()) {
+      // The values are constants, sorted in ascending order, so the tree can
+      // be built by appending intervals instead of a tree_or() per element.
+      SEL_TREE *tree = get_func_mm_tree_from_sorted_in_array(param, op, field);
+      if (tree != nullptr) return tree;
+      // Fall through to the generic per-argument path.
+    }
     SEL_TREE *tree =
         get_mm_parts(param, op, field, Item_func::EQ_FUNC, op->arguments()[1]);
     if (tree) {
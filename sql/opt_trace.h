@@ -37,6 +37,7 @@
 
 class Cost_estimate;
 class Item;
+class JOIN;
 class THD;
 class set_var_base;
 class sp_head;
@@ -1062,6 +1063,32 @@ void opt_trace_disable_if_no_stored_proc_func_access(THD *thd, sp_head *sp);
 */
 int fill_optimizer_trace_info(THD *thd, TABLE_LIST *tables, Item *);
 
+/**
+   If plan sampling is enabled (@@optimizer_trace_sample_rate > 0) and this
+   statement is selected for sampling, records a compact fingerprint of the
+   chosen execution plan (join order, access methods, bucketed row estimates)
+   into a global ring buffer. Unlike the full optimizer trace, this is cheap
+   enough to leave enabled on a production server: unsampled statements pay
+   one atomic counter increment, nothing is JSON-serialized, and a sampled
+   statement costs one walk over its QEP array.
+
+   Must be called when the plan is final, i.e. at the end of
+   JOIN::optimize(). Only the top-level query block of a statement is
+   sampled, so that the sampling rate is per statement, not per query block.
+
+   @param thd   the connection
+   @param join  the optimized top-level JOIN
+*/
+void opt_trace_sample_plan(THD *thd, JOIN *join);
+
+/**
+   Fills information_schema.OPTIMIZER_TRACE_SAMPLES with the content of the
+   plan-sample ring buffer, oldest sample first.
+   @retval 0 ok
+   @retval 1 error
+*/
+int fill_optimizer_trace_samples(THD *thd, TABLE_LIST *tables, Item *);
+
 //@}
 
 /**
@@ -32,33 +32,45 @@
 
 #include "my_config.h"
 
+#include <stdio.h>
 #include <string.h>
 #include <sys/types.h>
 
+#include <atomic>
+
 #include "lex_string.h"
 #include "m_ctype.h"
 #include "my_compiler.h"
 #include "my_dbug.h"
 #include "my_inttypes.h"
+#include "my_murmur3.h"
 #include "my_sqlcommand.h"
+#include "my_systime.h"  // my_micro_time
+#include "mysql/psi/mysql_mutex.h"
 #include "sql/auth/auth_acls.h"
 #include "sql/auth/auth_common.h"  // check_table_access
 #include "sql/auth/sql_security_ctx.h"
 #include "sql/enum_query_type.h"
 #include "sql/field.h"
+#include "sql/mysqld.h"       // optimizer_trace_sample_rate
+#include "sql/opt_explain.h"  // join_type_str
 #include "sql/opt_trace.h"
 #include "sql/opt_trace_context.h"
 #include "sql/set_var.h"
 #include "sql/sp_head.h"   // sp_head
 #include "sql/sp_instr.h"  // sp_printable
 #include "sql/sql_class.h"
+#include "sql/sql_executor.h"  // QEP_TAB
 #include "sql/sql_lex.h"
 #include "sql/sql_list.h"
-#include "sql/sql_parse.h"  // sql_command_flags
-#include "sql/sql_show.h"   // schema_table_stored_record
+#include "sql/sql_optimizer.h"  // JOIN
+#include "sql/sql_parse.h"      // sql_command_flags
+#include "sql/sql_show.h"       // schema_table_stored_record
 #include "sql/system_variables.h"
 #include "sql/table.h"
+#include "sql/tztime.h"  // my_tz_SYSTEM
 #include "sql_string.h"
+#include "template_utils.h"
 
 class Item;
 
@@ -568,3 +580,187 @@ ST_FIELD_INFO optimizer_trace_info[] = {
   there would be no problem ('0', 'x', 'E', and 'D' are identical in latin1
   and utf8: they would be preserved during conversion).
 */
+
+/*
+  Plan sampling (@@optimizer_trace_sample_rate).
+
+  The full optimizer trace is far too expensive to leave enabled on a
+  production server, so plan regressions after statistics changes or
+  upgrades are usually noticed only when a query is already slow. Plan
+  sampling is the cheap alternative: for one in N traceable statements we
+  record a compact fingerprint of the plan the optimizer chose, into a
+  fixed-size global ring buffer which can be read back from
+  information_schema.OPTIMIZER_TRACE_SAMPLES. Comparing the distribution of
+  PLAN_HASH per QUERY_HASH before and after a change shows which statements
+  switched plans, without ever serializing a JSON trace.
+*/
+
+namespace {
+
+/// One sampled plan, as stored in the ring buffer.
+struct Opt_trace_sample {
+  ulonglong sample_time_us;  ///< when the plan was chosen, µs since epoch
+  ulonglong query_hash;      ///< hash of the statement text
+  ulonglong plan_hash;       ///< hash of the binary plan fingerprint
+  double cost;               ///< the optimizer's cost estimate for the plan
+  uint plan_length;          ///< used length of 'plan'
+  /**
+    Readable rendering of the fingerprint:
+    "table:access_method:2^rows,..." in join order. Truncated if the plan
+    does not fit; the hash is always computed over the full plan.
+  */
+  char plan[512];
+};
+
+constexpr size_t SAMPLE_BUFFER_SIZE = 512;
+
+Opt_trace_sample sample_buffer[SAMPLE_BUFFER_SIZE];
+size_t sample_buffer_next = 0;   ///< next slot to (over)write
+size_t sample_buffer_count = 0;  ///< number of valid entries
+mysql_mutex_t LOCK_sample_buffer;
+
+/**
+  Counts traceable statements, so that one in
+  @@optimizer_trace_sample_rate of them can be picked. This counter is the
+  only cost sampling adds to unsampled statements, hence relaxed ordering.
+*/
+std::atomic<ulonglong> sample_statement_counter{0};
+
+/**
+  The ring buffer is written from the optimizer, long before any plugin or
+  P_S instrumentation is interested in it, so its lock is a plain
+  uninstrumented mutex, initialized on load.
+*/
+struct Sample_buffer_lock {
+  Sample_buffer_lock() {
+    mysql_mutex_init(PSI_NOT_INSTRUMENTED, &LOCK_sample_buffer,
+                     MY_MUTEX_INIT_FAST);
+  }
+  ~Sample_buffer_lock() { mysql_mutex_destroy(&LOCK_sample_buffer); }
+} sample_buffer_lock;
+
+/// 64-bit FNV-1a, used to fold the binary plan fingerprint into a hash.
+constexpr ulonglong FNV1A64_INIT = 0xcbf29ce484222325ULL;
+
+ulonglong fnv1a64(ulonglong hash, const uchar *data, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    hash ^= data[i];
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+}  // namespace
+
+void opt_trace_sample_plan(THD *thd, JOIN *join) {
+  const ulong rate = optimizer_trace_sample_rate;
+  if (likely(rate == 0)) return;
+
+  /*
+    Sample per statement, not per query block: subqueries and derived
+    tables optimize their own JOINs, but only the statement's first query
+    block takes part in the count.
+  */
+  if (join->select_lex != thd->lex->select_lex ||
+      thd->query().str == nullptr)
+    return;
+
+  if (sample_statement_counter.fetch_add(1, std::memory_order_relaxed) %
+          rate !=
+      0)
+    return;
+
+  Opt_trace_sample sample;
+  sample.sample_time_us = my_micro_time();
+  sample.query_hash =
+      murmur3_32(pointer_cast<const uchar *>(thd->query().str),
+                 thd->query().length, 0);
+  sample.cost = join->best_read;
+
+  ulonglong hash = FNV1A64_INIT;
+  char *pos = sample.plan;
+  char *const end = sample.plan + sizeof(sample.plan);
+  for (uint i = 0; i < join->primary_tables; i++) {
+    QEP_TAB *const tab = &join->qep_tab[i];
+    if (tab->position() == nullptr) continue;
+    const TABLE *const table = tab->table();
+    /*
+      Bucket the row estimate to its binary order of magnitude, so that
+      ordinary day-to-day statistics drift does not manufacture a new
+      fingerprint for what is in essence the same plan.
+    */
+    uint rows_log2 = 0;
+    for (double rows = tab->position()->rows_fetched; rows >= 2.0; rows /= 2)
+      rows_log2++;
+
+    hash = fnv1a64(hash, pointer_cast<const uchar *>(table->alias),
+                   strlen(table->alias));
+    const uchar access[2] = {static_cast<uchar>(tab->type()),
+                             static_cast<uchar>(rows_log2)};
+    hash = fnv1a64(hash, access, sizeof(access));
+
+    if (pos < end) {
+      const int written = snprintf(
+          pos, end - pos, "%s%s:%s:2^%u", (pos == sample.plan) ? "" : ",",
+          table->alias, join_type_str[tab->type()], rows_log2);
+      pos = (written < 0 || written >= end - pos) ? end : pos + written;
+    }
+  }
+  sample.plan_hash = hash;
+  sample.plan_length = static_cast<uint>(pos - sample.plan);
+
+  mysql_mutex_lock(&LOCK_sample_buffer);
+  sample_buffer[sample_buffer_next] = sample;
+  sample_buffer_next = (sample_buffer_next + 1) % SAMPLE_BUFFER_SIZE;
+  if (sample_buffer_count < SAMPLE_BUFFER_SIZE) sample_buffer_count++;
+  mysql_mutex_unlock(&LOCK_sample_buffer);
+}
+
+int fill_optimizer_trace_samples(THD *thd, TABLE_LIST *tables, Item *) {
+  TABLE *table = tables->table;
+
+  /*
+    The ring buffer is global and thus contains fingerprints of other
+    users' statements; require PROCESS, like the processlist does. Show
+    an empty table rather than an error, so that a plain
+    "SELECT * FROM information_schema.OPTIMIZER_TRACE_SAMPLES" in a tool
+    which lacks the privilege degrades gracefully.
+  */
+  if (!thd->security_context()->check_access(PROCESS_ACL)) return 0;
+
+  mysql_mutex_lock(&LOCK_sample_buffer);
+  const size_t count = sample_buffer_count;
+  // When the buffer has wrapped, the oldest sample is at the write cursor.
+  size_t idx = (count == SAMPLE_BUFFER_SIZE) ? sample_buffer_next : 0;
+  for (size_t n = 0; n < count; n++) {
+    const Opt_trace_sample &sample = sample_buffer[idx];
+    idx = (idx + 1) % SAMPLE_BUFFER_SIZE;
+    restore_record(table, s->default_values);
+    MYSQL_TIME sample_time;
+    my_tz_SYSTEM->gmt_sec_to_TIME(
+        &sample_time,
+        static_cast<my_time_t>(sample.sample_time_us / 1000000));
+    table->field[0]->store_time(&sample_time);
+    table->field[1]->store(static_cast<longlong>(sample.query_hash), true);
+    table->field[2]->store(static_cast<longlong>(sample.plan_hash), true);
+    table->field[3]->store(sample.cost);
+    table->field[4]->store(sample.plan, sample.plan_length,
+                           system_charset_info);
+    if (schema_table_store_record(thd, table)) {
+      mysql_mutex_unlock(&LOCK_sample_buffer);
+      return 1;
+    }
+  }
+  mysql_mutex_unlock(&LOCK_sample_buffer);
+
+  return 0;
+}
+
+ST_FIELD_INFO optimizer_trace_samples_info[] = {
+    /* name, length, type, value, maybe_null, old_name, open_method */
+    {"SAMPLE_TIME", 0, MYSQL_TYPE_DATETIME, 0, false, nullptr, 0},
+    {"QUERY_HASH", 21, MYSQL_TYPE_LONGLONG, 0, MY_I_S_UNSIGNED, nullptr, 0},
+    {"PLAN_HASH", 21, MYSQL_TYPE_LONGLONG, 0, MY_I_S_UNSIGNED, nullptr, 0},
+    {"ESTIMATED_COST", 0, MYSQL_TYPE_DOUBLE, 0, false, nullptr, 0},
+    {"PLAN", 512, MYSQL_TYPE_STRING, 0, false, nullptr, 0},
+    {nullptr, 0, MYSQL_TYPE_STRING, 0, true, nullptr, 0}};
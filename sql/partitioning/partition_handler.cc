@@ -1311,7 +1311,7 @@ int Partition_helper::check_misplaced_rows(uint read_part_id, bool repair) {
 int Partition_helper::ph_rnd_next_in_part(uint part_id, uchar *buf) {
   int result = rnd_next_in_part(part_id, buf);
 
-  if (!result && m_table->has_gcol())
+  if (!result && m_table->has_virtual_gcol())
     result = update_generated_read_fields(buf, m_table);
 
   return result;
@@ -2791,9 +2791,20 @@ int Partition_helper::handle_ordered_next(uchar *buf, bool is_next_same) {
   /* Assert that buffer for fetch is not NULL */
   DBUG_ASSERT(rec_buf);
 
+  /*
+    If this is the only partition left in the queue, there is nothing to
+    merge against, so read the next row directly into the caller's buffer
+    instead of taking the round trip through the queue's record buffer.
+    This is the steady state both when pruning left a single partition and
+    when all other partitions have reached the end of the range.
+  */
+  const bool single_part = (m_queue->size() == 1);
+
   /* ICP relies on Item evaluation, which expects the row in record[0]. */
   if (m_handler->pushed_idx_cond)
     read_buf = m_table->record[0];
+  else if (single_part)
+    read_buf = buf;
   else
     read_buf = rec_buf;
 
@@ -2827,6 +2838,20 @@ int Partition_helper::handle_ordered_next(uchar *buf, bool is_next_same) {
     }
     return error;
   }
+  if (single_part) {
+    /* The row is already in the caller's buffer (record[0] with ICP). */
+    if (read_buf != buf) copy_cached_row(buf, read_buf);
+    if (m_ref_usage != REF_NOT_USED) {
+      /* position_in_last_part needs m_last_part set. */
+      m_last_part = part_id;
+      position_in_last_part(rec_buf - m_rec_offset + PARTITION_BYTES_IN_POS,
+                            read_buf);
+    }
+    m_last_part = part_id;
+    m_top_entry = part_id;
+    DBUG_PRINT("info", ("Record returned from partition %u", part_id));
+    return 0;
+  }
   /* When using ICP, copy record[0] to the priority queue for sorting. */
   if (m_handler->pushed_idx_cond) memcpy(rec_buf, read_buf, m_rec_length);
   if (m_ref_usage != REF_NOT_USED) {
@@ -2897,9 +2922,18 @@ int Partition_helper::handle_ordered_prev(uchar *buf) {
   /* Assert that buffer for fetch is not NULL */
   DBUG_ASSERT(rec_buf);
 
+  /*
+    As in handle_ordered_next(): with a single partition left in the queue
+    there is nothing to merge against, so read straight into the caller's
+    buffer.
+  */
+  const bool single_part = (m_queue->size() == 1);
+
   /* ICP relies on Item evaluation, which expects the row in record[0]. */
   if (m_handler->pushed_idx_cond)
     read_buf = m_table->record[0];
+  else if (single_part)
+    read_buf = buf;
   else
     read_buf = rec_buf;
 
@@ -2922,6 +2956,20 @@ int Partition_helper::handle_ordered_prev(uchar *buf) {
     }
     return error;
   }
+  if (single_part) {
+    /* The row is already in the caller's buffer (record[0] with ICP). */
+    if (read_buf != buf) copy_cached_row(buf, read_buf);
+    if (m_ref_usage != REF_NOT_USED) {
+      /* position_in_last_part needs m_last_part set. */
+      m_last_part = part_id;
+      position_in_last_part(rec_buf - m_rec_offset + PARTITION_BYTES_IN_POS,
+                            read_buf);
+    }
+    m_last_part = part_id;
+    m_top_entry = part_id;
+    DBUG_PRINT("info", ("Record returned from partition %u", part_id));
+    return 0;
+  }
   /* When using ICP, copy record[0] to the priority queue for sorting. */
   if (m_handler->pushed_idx_cond) memcpy(rec_buf, read_buf, m_rec_length);
 
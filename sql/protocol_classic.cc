@@ -837,6 +837,43 @@ bool net_send_error(NET *net, uint sql_errno, const char *err) {
 */
 /* clang-format on */
 
+/**
+  Check whether the client has already sent its next command, i.e. it
+  is pipelining statements without waiting for the individual
+  responses.
+
+  Used to defer the per-response net flush: when the next command is
+  already waiting on the connection the client cannot be blocked
+  reading this response, so it is safe to leave it in the NET buffer
+  and send it together with the following response(s) in one network
+  write. The deferred responses are flushed at the latest by
+  Protocol_classic::flush_deferred_output() before the connection goes
+  back to waiting for input.
+
+  @param net  NET of the connection.
+
+  @retval true   more commands are waiting, the flush can be deferred.
+  @retval false  the client has nothing more in flight (or the
+                 transport cannot be polled), flush now.
+*/
+
+static bool client_is_pipelining(NET *net) {
+  Vio *vio = net->vio;
+  if (vio == nullptr) return false;
+  switch (vio->type) {
+    case VIO_TYPE_TCPIP:
+    case VIO_TYPE_SOCKET:
+    case VIO_TYPE_SSL:
+      break;
+    default:
+      /* Named pipes and shared memory cannot be polled. */
+      return false;
+  }
+  /* TLS may have decrypted bytes buffered beyond the kernel socket. */
+  if (vio->has_data(vio)) return true;
+  return vio_io_wait(vio, VIO_IO_EVENT_READ, 0) == 1;
+}
+
 /**
   Return OK to the client.
 
@@ -961,7 +998,7 @@ static bool net_send_ok(THD *thd, uint server_status, uint statement_warn_count,
     return true;
   }
   error = my_net_write(net, start, (size_t)(pos - start));
-  if (!error) error = net_flush(net);
+  if (!error && !client_is_pipelining(net)) error = net_flush(net);
 
   thd->get_stmt_da()->set_overwrite_status(false);
   DBUG_PRINT("info", ("OK sent, so no more error sending allowed"));
@@ -1057,7 +1094,7 @@ static bool net_send_eof(THD *thd, uint server_status,
   if (net->vio != nullptr) {
     thd->get_stmt_da()->set_overwrite_status(true);
     error = write_eof_packet(thd, net, server_status, statement_warn_count);
-    if (!error) error = net_flush(net);
+    if (!error && !client_is_pipelining(net)) error = net_flush(net);
     thd->get_stmt_da()->set_overwrite_status(false);
     DBUG_PRINT("info", ("EOF sent, so no more error sending allowed"));
   }
@@ -2862,6 +2899,19 @@ void Protocol_classic::end_partial_result_set() {
 
 bool Protocol_classic::flush() { return net_flush(&m_thd->net); }
 
+bool Protocol_classic::flush_deferred_output() {
+  NET *net = &m_thd->net;
+  /*
+    Responses that were left in the NET buffer because the client was
+    pipelining, see client_is_pipelining(): as long as another command
+    is already waiting they keep getting coalesced, but before the
+    connection blocks waiting for input they must go out, since at
+    that point the client may well be blocked reading them.
+  */
+  if (net->write_pos == net->buff || client_is_pipelining(net)) return false;
+  return net_flush(net);
+}
+
 bool Protocol_classic::store_ps_status(ulong stmt_id, uint column_count,
                                        uint param_count, ulong cond_count) {
   DBUG_TRACE;
@@ -114,6 +114,16 @@ class Protocol_classic : public Protocol {
   bool create_command(COM_DATA *com_data, enum_server_command cmd, uchar *pkt,
                       size_t length);
   bool flush() override;
+  /**
+    Flush responses deferred while the client was pipelining commands.
+    Must be called before the connection blocks waiting for the next
+    command; a no-op when nothing was deferred or the client still has
+    commands in flight.
+
+    @retval false   ok
+    @retval true    error
+  */
+  bool flush_deferred_output();
   void end_partial_result_set() override;
 
   bool end_row() override;
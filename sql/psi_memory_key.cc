@@ -76,6 +76,7 @@ PSI_memory_key key_memory_SLAVE_INFO;
 PSI_memory_key key_memory_ST_SCHEMA_TABLE;
 PSI_memory_key key_memory_Slave_applier_json_diff_vector;
 PSI_memory_key key_memory_Slave_job_group_group_relay_log_name;
+PSI_memory_key key_memory_Sort_key_weight_cache;
 PSI_memory_key key_memory_Sys_var_charptr_value;
 PSI_memory_key key_memory_TABLE;
 PSI_memory_key key_memory_TABLE_RULE_ENT;
@@ -204,6 +205,8 @@ static PSI_memory_info all_server_memory[] = {
 
     {&key_memory_NAMED_ILINK_name, "NAMED_ILINK::name", 0, 0, PSI_DOCUMENT_ME},
     {&key_memory_String_value, "String::value", 0, 0, PSI_DOCUMENT_ME},
+    {&key_memory_Sort_key_weight_cache, "Sort_key_weight_cache", 0, 0,
+     PSI_DOCUMENT_ME},
     {&key_memory_Sys_var_charptr_value, "Sys_var_charptr::value", 0, 0,
      PSI_DOCUMENT_ME},
     {&key_memory_queue_item, "Queue::queue_item", 0, 0, PSI_DOCUMENT_ME},
@@ -99,6 +99,7 @@ extern PSI_memory_key key_memory_SLAVE_INFO;
 extern PSI_memory_key key_memory_ST_SCHEMA_TABLE;
 extern PSI_memory_key key_memory_Slave_applier_json_diff_vector;
 extern PSI_memory_key key_memory_Slave_job_group_group_relay_log_name;
+extern PSI_memory_key key_memory_Sort_key_weight_cache;
 extern PSI_memory_key key_memory_Sys_var_charptr_value;
 extern PSI_memory_key key_memory_TABLE;
 extern PSI_memory_key key_memory_TABLE_RULE_ENT;
@@ -229,7 +229,13 @@ static File create_file(THD *thd, char *path, sql_exchange *exchange,
 #else
   (void)chmod(path, S_IRUSR | S_IWUSR | S_IRGRP);
 #endif
-  if (init_io_cache(cache, file, 0L, WRITE_CACHE, 0L, true, MYF(MY_WME))) {
+  /*
+    Use a 1MB write cache so that rows are flushed to disk in large
+    sequential chunks; exports are typically throughput bound on this
+    cache.
+  */
+  if (init_io_cache(cache, file, 1024 * 1024, WRITE_CACHE, 0L, true,
+                    MYF(MY_WME))) {
     mysql_file_close(file, MYF(0));
     /* Delete file on error, it was just created */
     mysql_file_delete(key_select_to_file, path, MYF(0));
@@ -339,6 +345,37 @@ bool Query_result_export::start_execution(THD *thd) {
              : (int)(uchar)(x) == field_term_char) || \
    (int)(uchar)(x) == line_sep_char || !(x))
 
+/**
+  Find the first byte in [pos, end) that may need escaping, i.e. any byte
+  NEED_ESCAPING() could match, or a possible multi-byte head (>= 0x80)
+  when the result character set is multi-byte. Everything before the
+  returned position is plain data that can be emitted as-is. Relies on
+  memchr(), which the C library vectorizes, instead of testing one byte
+  at a time.
+*/
+static const char *first_escapable_byte(const char *pos, const char *end,
+                                        int escape_chr, int term_chr,
+                                        int line_sep_chr, bool check_mb) {
+  const char *stop = end;
+  const auto clamp = [pos, &stop](int chr) {
+    const char *hit;
+    if (chr >= 0 && chr <= 255 &&
+        (hit = static_cast<const char *>(memchr(pos, chr, stop - pos))) !=
+            nullptr)
+      stop = hit;
+  };
+  clamp(escape_chr);
+  clamp(term_chr);
+  clamp(line_sep_chr);
+  clamp(0); /* NUL is dumped as \0 */
+  if (check_mb) {
+    const char *q = pos;
+    while (q < stop && static_cast<uchar>(*q) < 0x80) ++q;
+    stop = q;
+  }
+  return stop;
+}
+
 bool Query_result_export::send_data(THD *thd, List<Item> &items) {
   DBUG_TRACE;
   char buff[MAX_FIELD_WIDTH], null_buff[2], space[MAX_FIELD_WIDTH];
@@ -457,6 +494,20 @@ bool Query_result_export::send_data(THD *thd, List<Item> &items) {
         for (start = pos = res->ptr(), end = pos + used_length; pos != end;
              pos++) {
           bool need_escape = false;
+          /*
+            Skip ahead to the next byte that could possibly need escaping;
+            the run in between is written in one piece further down. Not
+            done while a gb18030 4-byte sequence is being tracked, nor in
+            the dangerous-charset BINARY case, where the byte following a
+            multi-byte head must be inspected as well.
+          */
+          if (in_escapable_4_bytes == 0 && !check_following_byte) {
+            pos = first_escapable_byte(
+                pos, end, escape_char,
+                enclosed ? field_sep_char : field_term_char, line_sep_char,
+                use_mb(res_charset));
+            if (pos == end) break;
+          }
           if (use_mb(res_charset)) {
             int l;
             if ((l = my_ismbchar(res_charset, pos, end))) {
@@ -43,8 +43,9 @@
 #include "sql/item.h"
 #include "sql/key.h"
 #include "sql/opt_explain.h"
-#include "sql/opt_range.h"  // QUICK_SELECT_I
-#include "sql/sql_class.h"  // THD
+#include "sql/opt_range.h"      // QUICK_SELECT_I
+#include "sql/record_buffer.h"  // Record_buffer
+#include "sql/sql_class.h"      // THD
 #include "sql/sql_const.h"
 #include "sql/sql_executor.h"
 #include "sql/sql_optimizer.h"
@@ -145,6 +146,7 @@ int IndexScanIterator<false>::Read() {  // Forward read.
     error = table()->file->ha_index_next(m_record);
   }
   if (error) return HandleError(error);
+  if (PeriodicKillCheck()) return 1;
   if (m_examined_rows != nullptr) {
     ++*m_examined_rows;
   }
@@ -161,6 +163,7 @@ int IndexScanIterator<true>::Read() {  // Backward read.
     error = table()->file->ha_index_prev(m_record);
   }
   if (error) return HandleError(error);
+  if (PeriodicKillCheck()) return 1;
   if (m_examined_rows != nullptr) {
     ++*m_examined_rows;
   }
@@ -308,6 +311,14 @@ int TableRowIterator::HandleError(int error) {
   }
 }
 
+int TableRowIterator::CheckKilled() {
+  if (thd()->killed) {
+    thd()->send_kill_message();
+    return 1;
+  }
+  return 0;
+}
+
 void TableRowIterator::PrintError(int error) {
   m_table->file->print_error(error, MYF(0));
 }
@@ -452,19 +463,71 @@ bool TableScanIterator::Init() {
   if (first_init && set_record_buffer(m_qep_tab))
     return true; /* purecov: inspected */
 
+  /*
+    If a record buffer was allocated for the scan, drive it from the
+    iterator instead of from the storage engine: Read() fetches a full
+    batch of rows through a single handler call and serves them from the
+    buffer, which amortizes the per-row handler and instrumentation
+    overhead. Tables with virtual generated columns stay on the
+    row-at-a-time path, since the generated fields must be evaluated for
+    each row while it is in record[0].
+  */
+  if (m_record_buffer == nullptr) {
+    Record_buffer *buffer = table()->file->ha_get_record_buffer();
+    if (buffer != nullptr && !table()->has_virtual_gcol()) {
+      table()->file->ha_set_record_buffer(nullptr);
+      m_record_buffer = buffer;
+    }
+  }
+  if (m_record_buffer != nullptr) m_record_buffer->reset();
+  m_record_buffer_pos = 0;
+  m_pending_error = 0;
+
   return false;
 }
 
 int TableScanIterator::Read() {
   int tmp;
-  while ((tmp = table()->file->ha_rnd_next(m_record))) {
-    /*
-      ha_rnd_next can return RECORD_DELETED for MyISAM when one thread is
-      reading and another deleting without locks.
-    */
-    if (tmp == HA_ERR_RECORD_DELETED && !thd()->killed) continue;
-    return HandleError(tmp);
+  if (m_record_buffer != nullptr) {
+    while (m_record_buffer_pos == m_record_buffer->records()) {
+      if (m_pending_error != 0) {
+        tmp = m_pending_error;
+        m_pending_error = 0;
+        if (!(tmp == HA_ERR_RECORD_DELETED && !thd()->killed))
+          return HandleError(tmp);
+      }
+      m_record_buffer->clear();
+      m_record_buffer_pos = 0;
+      tmp = table()->file->ha_fetch_batch(m_record_buffer);
+      if (m_record_buffer->records() == 0) {
+        if (tmp == HA_ERR_RECORD_DELETED && !thd()->killed) continue;
+        return HandleError(tmp);
+      }
+      /*
+        An error that cut the batch short is reported once the rows
+        fetched before it have been served.
+      */
+      m_pending_error = tmp;
+    }
+    memcpy(m_record, m_record_buffer->record(m_record_buffer_pos++),
+           m_record_buffer->record_size());
+    table()->set_row_status_from_handler(0);
+  } else {
+    while ((tmp = table()->file->ha_rnd_next(m_record))) {
+      /*
+        ha_rnd_next can return RECORD_DELETED for MyISAM when one thread is
+        reading and another deleting without locks.
+      */
+      if (tmp == HA_ERR_RECORD_DELETED && !thd()->killed) continue;
+      return HandleError(tmp);
+    }
   }
+  /*
+    The engine is not guaranteed to check for interrupts while producing
+    rows (and is never consulted while rows are served from the record
+    buffer), so bound the kill latency of long scans ourselves.
+  */
+  if (PeriodicKillCheck()) return 1;
   if (m_examined_rows != nullptr) {
     ++*m_examined_rows;
   }
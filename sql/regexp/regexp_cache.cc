@@ -0,0 +1,136 @@
+/* Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+#include "sql/regexp/regexp_cache.h"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "template_utils.h"
+
+namespace regexp {
+
+namespace {
+
+/// Upper bound on the number of compiled patterns kept in the cache.
+constexpr size_t kCacheMaxEntries = 256;
+
+struct Cache_key {
+  std::u16string pattern;
+  uint32_t flags;
+
+  bool operator==(const Cache_key &other) const {
+    return flags == other.flags && pattern == other.pattern;
+  }
+};
+
+struct Cache_key_hash {
+  size_t operator()(const Cache_key &key) const {
+    return std::hash<std::u16string>()(key.pattern) ^ key.flags;
+  }
+};
+
+/**
+  The process-wide cache of compiled regular expressions. Entries are kept
+  in a list in least-recently-used order; a map indexes the list by pattern
+  and flags. All operations take the mutex, including handing out clones,
+  so the masters themselves are never used concurrently.
+*/
+class Regexp_cache {
+ public:
+  URegularExpression *Get(const std::u16string &pattern, uint32_t flags,
+                          UParseError *error, UErrorCode *status);
+
+ private:
+  struct Entry {
+    Cache_key key;
+    URegularExpression *master;
+  };
+
+  using Entry_list = std::list<Entry>;
+
+  std::mutex m_mutex;
+  Entry_list m_entries;  ///< Front is most recently used.
+  std::unordered_map<Cache_key, Entry_list::iterator, Cache_key_hash> m_map;
+};
+
+URegularExpression *Regexp_cache::Get(const std::u16string &pattern,
+                                      uint32_t flags, UParseError *error,
+                                      UErrorCode *status) {
+  Cache_key key{pattern, flags};
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_map.find(key);
+    if (it != m_map.end()) {
+      m_entries.splice(m_entries.begin(), m_entries, it->second);
+      UErrorCode clone_status = U_ZERO_ERROR;
+      URegularExpression *clone =
+          uregex_clone(it->second->master, &clone_status);
+      // On the (out of memory) failure to clone, fall through and compile.
+      if (clone != nullptr && U_SUCCESS(clone_status)) return clone;
+    }
+  }
+
+  // Compile outside the lock; patterns can be arbitrarily expensive.
+  URegularExpression *re =
+      uregex_open(pointer_cast<const UChar *>(pattern.data()), pattern.size(),
+                  flags, error, status);
+  if (re == nullptr || U_FAILURE(*status)) return re;
+
+  // Keep a master of our own in the cache; the caller owns and will
+  // eventually close the instance we return.
+  UErrorCode clone_status = U_ZERO_ERROR;
+  URegularExpression *master = uregex_clone(re, &clone_status);
+  if (master == nullptr || U_FAILURE(clone_status)) return re;
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_map.count(key) != 0) {
+      // Another thread compiled the same pattern in the meantime.
+      uregex_close(master);
+      return re;
+    }
+    m_entries.push_front(Entry{std::move(key), master});
+    m_map.emplace(m_entries.front().key, m_entries.begin());
+    if (m_entries.size() > kCacheMaxEntries) {
+      uregex_close(m_entries.back().master);
+      m_map.erase(m_entries.back().key);
+      m_entries.pop_back();
+    }
+  }
+  return re;
+}
+
+Regexp_cache cache;
+
+}  // namespace
+
+URegularExpression *OpenRegexCached(const std::u16string &pattern,
+                                    uint32_t flags, UParseError *error,
+                                    UErrorCode *status) {
+  return cache.Get(pattern, flags, error, status);
+}
+
+}  // namespace regexp
@@ -0,0 +1,63 @@
+#ifndef SQL_REGEXP_REGEXP_CACHE_H_
+#define SQL_REGEXP_REGEXP_CACHE_H_
+
+/* Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+#include <unicode/uregex.h>
+
+#include <stdint.h>
+#include <string>
+
+namespace regexp {
+
+/**
+  Opens a compiled regular expression, like uregex_open(), but backed by a
+  process-wide LRU cache of compiled patterns that is shared by all
+  connections.
+
+  The cache is keyed by the pattern string (in ICU's character set) and the
+  ICU compile flags; the collation of the original pattern expression is
+  subsumed by these two, since conversion to UTF-16 and the case-sensitivity
+  flag both happen before compilation. On a hit, a clone of the cached
+  instance is handed out via uregex_clone(), which shares the expensive
+  compiled representation through ICU's internal reference counting while
+  giving the caller an independent matcher. The cache keeps master instances
+  of its own, so evicting an entry is safe while clones are still in use.
+
+  The caller owns the returned object and must dispose of it with
+  uregex_close(), exactly as for uregex_open().
+
+  @param pattern      the pattern string in ICU's character set
+  @param flags        ICU compile flags
+  @param[out] error   parse error info, filled in on compilation failure
+  @param[out] status  ICU error code
+
+  @returns the compiled regular expression, or nullptr on error.
+*/
+URegularExpression *OpenRegexCached(const std::u16string &pattern,
+                                    uint32_t flags, UParseError *error,
+                                    UErrorCode *status);
+
+}  // namespace regexp
+
+#endif  // SQL_REGEXP_REGEXP_CACHE_H_
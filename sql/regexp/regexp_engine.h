@@ -34,6 +34,7 @@
 #include "my_config.h"  // WORDS_BIGENDIAN
 #include "sql/current_thd.h"
 #include "sql/regexp/errors.h"
+#include "sql/regexp/regexp_cache.h"
 #include "sql/sql_class.h"  // THD
 #include "template_utils.h"
 
@@ -80,10 +81,12 @@ UBool QueryNotKilled(const void *context, int32_t steps);
 class Regexp_engine {
  public:
   /**
-    Compiles the URegularExpression object. If compilation fails, my_error()
-    is called and the IsError() returns true. In this case, all subsequent
-    operations will be no-ops, reporting failure. This follows ICU's chaining
-    conventions, see http://icu-project.org/apiref/icu4c/utypes_8h.html.
+    Compiles the URegularExpression object, or fetches a precompiled clone
+    from the server-wide pattern cache, see OpenRegexCached(). If compilation
+    fails, my_error() is called and the IsError() returns true. In this case,
+    all subsequent operations will be no-ops, reporting failure. This follows
+    ICU's chaining conventions, see
+    http://icu-project.org/apiref/icu4c/utypes_8h.html.
 
     @param pattern The pattern string in ICU's character set.
 
@@ -98,10 +101,7 @@ class Regexp_engine {
   Regexp_engine(const std::u16string &pattern, uint flags, int stack_limit,
                 int time_limit) {
     UParseError error;
-    auto upattern = pattern.data();
-    int length = pattern.size();
-    m_re = uregex_open(pointer_cast<const UChar *>(upattern), length, flags,
-                       &error, &m_error_code);
+    m_re = OpenRegexCached(pattern, flags, &error, &m_error_code);
     uregex_setStackLimit(m_re, stack_limit, &m_error_code);
     uregex_setTimeLimit(m_re, time_limit, &m_error_code);
     uregex_setMatchCallback(m_re, QueryNotKilled, current_thd, &m_error_code);
@@ -131,7 +131,13 @@ bool set_thread_priority(int priority) {
 
 bool set_thread_priority(int priority, my_thread_os_id_t thread_id) {
   DBUG_TRACE;
-  if (!can_thread_priority_be_set()) return false;
+  /*
+    Process credentials and capabilities do not change while the server
+    runs, so do the capget(2) check only once instead of on every
+    resource group switch.
+  */
+  static const bool priority_settable = can_thread_priority_be_set();
+  if (!priority_settable) return false;
 
   if (setpriority(PRIO_PROCESS, thread_id, priority) < 0) {
     char errbuf[MYSQL_ERRMSG_SIZE];
@@ -75,13 +75,8 @@ bool Thread_resource_control::apply_control() {
   DBUG_TRACE;
 
   bool ret = false;
-  std::vector<resourcegroups::platform::cpu_id_t> cpu_ids;
-  if (!m_vcpu_vector.empty()) {
-    for (const auto &cpu_range : m_vcpu_vector) {
-      for (auto id = cpu_range.m_start; id <= cpu_range.m_end; ++id)
-        cpu_ids.push_back(id);
-    }
-    ret = resourcegroups::platform::bind_to_cpus(cpu_ids) ||
+  if (!m_cpu_ids.empty()) {
+    ret = resourcegroups::platform::bind_to_cpus(m_cpu_ids) ||
           resourcegroups::platform::set_thread_priority(m_priority);
   } else {
     ret = resourcegroups::platform::unbind_thread() ||
@@ -94,14 +89,9 @@ bool Thread_resource_control::apply_control(my_thread_os_id_t thread_os_id) {
   DBUG_TRACE;
 
   bool ret = false;
-  std::vector<resourcegroups::platform::cpu_id_t> cpu_ids;
-  if (!m_vcpu_vector.empty()) {
-    for (auto cpu_range : m_vcpu_vector) {
-      for (auto id = cpu_range.m_start; id <= cpu_range.m_end; ++id)
-        cpu_ids.push_back(id);
-    }
+  if (!m_cpu_ids.empty()) {
     ret =
-        resourcegroups::platform::bind_to_cpus(cpu_ids, thread_os_id) ||
+        resourcegroups::platform::bind_to_cpus(m_cpu_ids, thread_os_id) ||
         resourcegroups::platform::set_thread_priority(m_priority, thread_os_id);
   } else {
     ret =
@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "my_thread_os_id.h"
+#include "sql/resourcegroups/platform/thread_attrs_api.h"   // cpu_id_t
 #include "sql/resourcegroups/resource_group_basic_types.h"  // Range, Type
 
 namespace resourcegroups {
@@ -72,8 +73,12 @@ class Thread_resource_control {
 
   void set_vcpu_vector(const std::vector<Range> &vcpu_vector) {
     m_vcpu_vector.clear();
-    for (const auto &cpu_range : vcpu_vector)
+    m_cpu_ids.clear();
+    for (const auto &cpu_range : vcpu_vector) {
       m_vcpu_vector.emplace_back(cpu_range);
+      for (auto id = cpu_range.m_start; id <= cpu_range.m_end; ++id)
+        m_cpu_ids.push_back(id);
+    }
   }
 
   /**
@@ -111,6 +116,13 @@ class Thread_resource_control {
   */
   std::vector<Range> m_vcpu_vector;
 
+  /**
+    CPU IDs from m_vcpu_vector expanded into a flat list. Precomputed so
+    that apply_control(), which runs on every resource group switch,
+    does not rebuild the list each time.
+  */
+  std::vector<platform::cpu_id_t> m_cpu_ids;
+
   /**
     Thread priority value
   */
@@ -27,6 +27,7 @@
 #include <vector>
 
 #include "my_dbug.h"
+#include "my_inttypes.h"
 
 class Item;
 class JOIN;
@@ -162,6 +163,12 @@ class RowIterator {
     return "";
   }
 
+  /// Extra runtime statistics for this iterator beyond timing and row counts,
+  /// e.g. peak memory usage, formatted for EXPLAIN ANALYZE. Iterators that
+  /// have nothing to report (the common case) return the empty string.
+  /// Callers should use FullDebugString() below.
+  virtual std::string ExtraStatsString() const { return std::string(); }
+
   // If this is the root iterator of a join, points back to the join object.
   // This has one single purpose: EXPLAIN uses it to be able to get the SELECT
   // list and print out any subselects in it; they are not children of
@@ -275,7 +282,34 @@ class TableRowIterator : public RowIterator {
   void PrintError(int error);
   TABLE *table() const { return m_table; }
 
+  /**
+    Check the THD kill flag at a fixed row interval, so that scan
+    iterators notice KILL and max_execution_time expiry with bounded
+    latency even when the storage engine serves rows without checking
+    for interrupts. Meant to be called once per successfully read row;
+    all but every 128th call is a single counter increment.
+
+    @retval 0 not killed, continue reading
+    @retval 1 killed; the error has been sent to the client
+  */
+  int PeriodicKillCheck() {
+    if (++m_rows_since_kill_check >= kRowsBetweenKillChecks) {
+      m_rows_since_kill_check = 0;
+      return CheckKilled();
+    }
+    return 0;
+  }
+
  private:
+  /// Out-of-line slow path of PeriodicKillCheck().
+  int CheckKilled();
+
+  /// Row interval between kill flag checks in PeriodicKillCheck().
+  static constexpr uint kRowsBetweenKillChecks = 128;
+
+  /// Rows read since PeriodicKillCheck() last checked the kill flag.
+  uint m_rows_since_kill_check{0};
+
   TABLE *const m_table;
 
   friend class AlternativeIterator;
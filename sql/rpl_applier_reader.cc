@@ -227,7 +227,18 @@ Log_event *Rpl_applier_reader::read_next_event() {
   }
 
   m_rli->set_event_start_pos(m_relaylog_file_reader.position());
+  /*
+    Release data_lock while reading and deserializing the event. The file
+    reader is used by the applier thread only, and the portion of the relay
+    log below the end position read above cannot be truncated or purged, so
+    no state protected by data_lock is accessed until the event is decoded.
+    Holding the lock here would stall the receiver thread and monitoring
+    commands for the whole read, which can be up to a max allowed packet
+    sized row event.
+  */
+  mysql_mutex_unlock(&m_rli->data_lock);
   ev = m_relaylog_file_reader.read_event_object();
+  mysql_mutex_lock(&m_rli->data_lock);
   if (ev != nullptr) {
     m_rli->set_future_event_relay_log_pos(m_relaylog_file_reader.position());
     ev->future_event_relay_log_pos = m_rli->get_future_event_relay_log_pos();
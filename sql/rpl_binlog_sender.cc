@@ -456,25 +456,46 @@ int Binlog_sender::send_events(File_reader *reader, my_off_t end_pos) {
   while (likely(log_pos < end_pos) || end_pos == 0) {
     uchar *event_ptr = nullptr;
     uint32 event_len = 0;
+    Log_event_type event_type = binary_log::UNKNOWN_EVENT;
+    bool event_data_skipped = false;
 
     if (unlikely(thd->killed)) return 1;
 
-    if (unlikely(read_event(reader, &event_ptr, &event_len))) return 1;
+    /*
+      Inside an excluded group only a Gtid_log_event needs its event data to
+      tell where the group ends (@see skip_event), so the data of any other
+      event is skipped over without being copied into the packet buffer. The
+      fast path is not taken when a transmission observer is registered,
+      since the hooks must see every event in the packet buffer, nor when the
+      master verifies event checksums, since verification needs the data.
+    */
+    if (in_exclude_group &&
+        likely(!m_observe_transmission && !opt_master_verify_checksum)) {
+      if (unlikely(skip_event_data(reader, end_pos, &event_data_skipped,
+                                   &event_type)))
+        return 1;
+    }
 
-    if (event_ptr == nullptr) {
-      if (end_pos == 0) return 0;  // Arrive the end of inactive file
+    if (!event_data_skipped) {
+      if (unlikely(read_event(reader, &event_ptr, &event_len))) return 1;
 
-      /*
-        It is reading events before end_pos of active binlog file. In theory,
-        it should never return nullptr. But RESET MASTER doesn't check if there
-        is any dump thread working. So it is possible that the active binlog
-        file is reopened and truncated to 0 after RESET MASTER.
-      */
-      set_fatal_error(log_read_error_msg(Binlog_read_error::SYSTEM_IO));
-      return 1;
+      if (event_ptr == nullptr) {
+        if (end_pos == 0) return 0;  // Arrive the end of inactive file
+
+        /*
+          It is reading events before end_pos of active binlog file. In
+          theory, it should never return nullptr. But RESET MASTER doesn't
+          check if there is any dump thread working. So it is possible that
+          the active binlog file is reopened and truncated to 0 after RESET
+          MASTER.
+        */
+        set_fatal_error(log_read_error_msg(Binlog_read_error::SYSTEM_IO));
+        return 1;
+      }
+
+      event_type = (Log_event_type)event_ptr[EVENT_TYPE_OFFSET];
     }
 
-    Log_event_type event_type = (Log_event_type)event_ptr[EVENT_TYPE_OFFSET];
     if (unlikely(check_event_type(event_type, log_file, log_pos))) return 1;
 
     DBUG_EXECUTE_IF("dump_thread_wait_before_send_xid", {
@@ -496,8 +517,9 @@ int Binlog_sender::send_events(File_reader *reader, my_off_t end_pos) {
       be skipped. and maybe removing the gtid from m_exclude_gtid will make
       skip_event has better performance.
     */
-    if (m_exclude_gtid &&
-        (in_exclude_group = skip_event(event_ptr, in_exclude_group))) {
+    if (event_data_skipped ||
+        (m_exclude_gtid &&
+         (in_exclude_group = skip_event(event_ptr, in_exclude_group)))) {
       /*
         If we have not send any event from past 'heartbeat_period' time
         period, then it is time to send a packet before skipping this group.
@@ -523,17 +545,15 @@ int Binlog_sender::send_events(File_reader *reader, my_off_t end_pos) {
         excluded events.
       */
       if (exclude_group_end_pos) {
-        /* Save a copy of the buffer content. */
-        String tmp;
-        tmp.copy(m_packet);
-        tmp.length(m_packet.length());
-
-        if (unlikely(send_heartbeat_event(exclude_group_end_pos))) return 1;
+        /*
+          m_packet already holds the event to be sent, so the heartbeat is
+          formatted in and sent from a buffer of its own instead of copying
+          the whole packet aside and restoring it afterwards.
+        */
+        if (unlikely(
+                send_heartbeat_event_preserving_packet(exclude_group_end_pos)))
+          return 1;
         exclude_group_end_pos = 0;
-
-        /* Restore the copy back. */
-        m_packet.copy(tmp);
-        m_packet.length(tmp.length());
       }
 
       if (unlikely(send_packet())) return 1;
@@ -633,6 +653,67 @@ inline bool Binlog_sender::skip_event(const uchar *event_ptr,
   return in_exclude_group;
 }
 
+inline int Binlog_sender::skip_event_data(File_reader *reader,
+                                          my_off_t end_pos, bool *skipped,
+                                          Log_event_type *event_type) {
+  DBUG_TRACE;
+
+  uchar header[LOG_EVENT_MINIMAL_HEADER_LEN];
+  uint32 event_len = 0;
+  my_off_t event_pos = reader->position();
+
+  *skipped = false;
+
+  if (!reader->read_event_header(header, &event_len)) {
+    *event_type = (Log_event_type)header[EVENT_TYPE_OFFSET];
+    switch (*event_type) {
+      case binary_log::GTID_LOG_EVENT:
+      case binary_log::ANONYMOUS_GTID_LOG_EVENT:
+      case binary_log::ROTATE_EVENT:
+      case binary_log::FORMAT_DESCRIPTION_EVENT:
+        /* These events affect the skipping decision, read them as a whole. */
+        break;
+      default: {
+        my_off_t event_end_pos = event_pos + event_len;
+        /*
+          Seek past the event data only if the whole event is known to be in
+          the binlog file. Otherwise the event is read as a whole, so the
+          truncation is detected and reported as usual.
+        */
+        my_off_t log_end_pos =
+            end_pos != 0 ? end_pos : reader->ifile()->length();
+        if (likely(event_end_pos <= log_end_pos)) {
+          if (unlikely(reader->seek(event_end_pos))) {
+            set_fatal_error(log_read_error_msg(reader->get_error_type()));
+            return 1;
+          }
+          set_last_pos(event_end_pos);
+          DBUG_PRINT("info",
+                     ("Skipped event %s without reading its data",
+                      Log_event::get_type_str(Log_event_type(*event_type))));
+#ifndef DBUG_OFF
+          if (check_event_count()) return 1;
+#endif
+          *skipped = true;
+          return 0;
+        }
+        break;
+      }
+    }
+  }
+
+  /*
+    Rewind to the beginning of the event, so that read_event() either reads
+    the event as a whole or reports the failure with the proper error
+    message.
+  */
+  if (unlikely(reader->seek(event_pos))) {
+    set_fatal_error(log_read_error_msg(reader->get_error_type()));
+    return 1;
+  }
+  return 0;
+}
+
 int Binlog_sender::wait_new_events(my_off_t log_pos) {
   int ret = 0;
   PSI_stage_info old_stage;
@@ -1139,6 +1220,60 @@ int Binlog_sender::send_heartbeat_event(my_off_t log_pos) {
   return send_packet_and_flush();
 }
 
+int Binlog_sender::send_heartbeat_event_preserving_packet(my_off_t log_pos) {
+  DBUG_TRACE;
+  const char *filename = m_linfo.log_file_name;
+  const char *p = filename + dirname_length(filename);
+  size_t ident_len = strlen(p);
+  size_t event_len = ident_len + LOG_EVENT_HEADER_LEN +
+                     (event_checksum_on() ? BINLOG_CHECKSUM_LEN : 0);
+
+  DBUG_PRINT("info", ("log_file_name %s, log_pos %llu", p, log_pos));
+
+  /*
+    m_packet holds an event which still has to be sent, so the heartbeat is
+    formatted in a buffer of its own instead of going through
+    reset_transmit_packet().
+  */
+  StringBuffer<FN_REFLEN + LOG_EVENT_HEADER_LEN + BINLOG_CHECKSUM_LEN + 1>
+      packet;
+  qs_append('\0', &packet);  // Set this as an OK packet
+
+  /* reserve and set default header */
+  if (m_observe_transmission &&
+      RUN_HOOK(binlog_transmit, reserve_header, (m_thd, 0, &packet))) {
+    set_unknown_error("Failed to run hook 'reserve_header'");
+    return 1;
+  }
+
+  size_t event_offset = packet.length();
+  if (packet.reserve(event_len)) return 1;
+  packet.length(event_offset + event_len);
+  uchar *header = pointer_cast<uchar *>(packet.ptr()) + event_offset;
+
+  /* Timestamp field */
+  int4store(header, 0);
+  header[EVENT_TYPE_OFFSET] = binary_log::HEARTBEAT_LOG_EVENT;
+  int4store(header + SERVER_ID_OFFSET, server_id);
+  int4store(header + EVENT_LEN_OFFSET, event_len);
+  int4store(header + LOG_POS_OFFSET, static_cast<uint32>(log_pos));
+  int2store(header + FLAGS_OFFSET, 0);
+  memcpy(header + LOG_EVENT_HEADER_LEN, p, ident_len);
+
+  if (event_checksum_on()) calc_event_checksum(header, event_len);
+
+  if (DBUG_EVALUATE_IF("simulate_send_error", true,
+                       my_net_write(m_thd->get_protocol_classic()->get_net(),
+                                    pointer_cast<const uchar *>(packet.ptr()),
+                                    packet.length()))) {
+    set_unknown_error("Failed on my_net_write()");
+    return 1;
+  }
+
+  m_last_event_sent_ts = now_in_nanosecs();
+  return flush_net();
+}
+
 inline int Binlog_sender::flush_net() {
   if (DBUG_EVALUATE_IF("simulate_flush_error", 1,
                        m_thd->get_protocol()->flush())) {
@@ -281,6 +281,17 @@ class Binlog_sender {
      @return It returns 0 if succeeds, otherwise 1 is returned.
   */
   int send_heartbeat_event(my_off_t log_pos);
+  /**
+     It sends a heartbeat to the client without touching the packet buffer
+     (m_packet), so an event which is already read into the packet buffer
+     and still has to be sent stays intact. The heartbeat is formatted in a
+     separate buffer and written to the net directly.
+
+     @param[in] log_pos  The log position that events before it are sent.
+
+     @return It returns 0 if succeeds, otherwise 1 is returned.
+  */
+  int send_heartbeat_event_preserving_packet(my_off_t log_pos);
 
   /**
      It reads an event from binlog file. this function can set event_ptr either
@@ -335,6 +346,29 @@ class Binlog_sender {
   */
   inline bool skip_event(const uchar *event_ptr, bool in_exclude_group);
 
+  /**
+    It reads the header of the next event and seeks over the event data if
+    the header alone shows that the event stays in the GTID group being
+    excluded. Only a Gtid_log_event needs its event data to decide whether
+    a group is excluded and a Rotate_event ends a group (@see skip_event),
+    so the data of any other event inside an excluded group is never
+    materialized into the packet buffer.
+
+    @param[in] reader      File_reader of the binlog file.
+    @param[in] end_pos     Only the events before end_pos are sent, it is 0
+                           if the binlog file is not active.
+    @param[out] skipped    It is set to true if the event data was skipped.
+                           The reader is then positioned at the next event.
+    @param[out] event_type The type of the event, it is valid only when
+                           skipped is set to true.
+
+    @retval 0 Succeed
+    @retval 1 Fail
+  */
+  inline int skip_event_data(File_reader *reader, my_off_t end_pos,
+                             bool *skipped,
+                             binary_log::Log_event_type *event_type);
+
   inline void calc_event_checksum(uchar *event_ptr, size_t event_len);
   inline int flush_net();
   inline int send_packet();
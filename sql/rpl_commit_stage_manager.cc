@@ -33,6 +33,11 @@ class Commit_order_manager;
 
 #define YESNO(X) ((X) ? "yes" : "no")
 
+ulonglong binlog_stage_trx_count[Commit_stage_manager::STAGE_COUNTER] = {0};
+ulonglong binlog_stage_group_count[Commit_stage_manager::STAGE_COUNTER] = {0};
+ulonglong binlog_stage_max_queue_depth[Commit_stage_manager::STAGE_COUNTER] = {
+    0};
+
 bool Commit_stage_manager::Mutex_queue::append(THD *first) {
   DBUG_TRACE;
   DBUG_PRINT("enter", ("first: 0x%llx", (ulonglong)first));
@@ -152,7 +157,10 @@ bool Commit_stage_manager::enroll_for(StageID stage, THD *thd,
              ("Enqueue 0x%llx to queue for stage %d", (ulonglong)thd, stage));
 
   lock_queue(stage);
+  const int32 size_before = m_queue[stage].get_size();
   bool leader = m_queue[stage].append(thd);
+  const int32 size_after = m_queue[stage].get_size();
+  update_queue_metrics(stage, size_after - size_before, size_after, leader);
 
   /*
    if its FLUSH stage queue (BINLOG_FLUSH_STAGE or COMMIT_ORDER_FLUSH_STAGE)
@@ -327,6 +335,29 @@ bool Commit_stage_manager::enroll_for(StageID stage, THD *thd,
   return leader;
 }
 
+void Commit_stage_manager::update_queue_metrics(StageID stage, int32 count,
+                                                int32 queue_size,
+                                                bool new_group) {
+  /*
+    The binlog flush and commit order flush queues are drained together,
+    by a single leader; account for both in the flush stage slot, and
+    count a new group only when both queues were empty.
+  */
+  if (stage == COMMIT_ORDER_FLUSH_STAGE || stage == BINLOG_FLUSH_STAGE) {
+    const StageID other = (stage == COMMIT_ORDER_FLUSH_STAGE)
+                              ? BINLOG_FLUSH_STAGE
+                              : COMMIT_ORDER_FLUSH_STAGE;
+    queue_size += m_queue[other].get_size();
+    new_group = new_group && m_queue[other].is_empty();
+    stage = BINLOG_FLUSH_STAGE;
+  }
+  m_queue[stage].assert_owner();
+  binlog_stage_trx_count[stage] += count;
+  if (new_group) binlog_stage_group_count[stage]++;
+  if (static_cast<ulonglong>(queue_size) > binlog_stage_max_queue_depth[stage])
+    binlog_stage_max_queue_depth[stage] = queue_size;
+}
+
 THD *Commit_stage_manager::Mutex_queue::fetch_and_empty_acquire_lock() {
   lock();
   THD *ret = fetch_and_empty();
@@ -36,6 +36,20 @@ class THD;
 
 /**
   Class for maintaining the commit stages for binary log group commit.
+
+  The flush, sync and commit stage queues are protected by separate
+  mutexes, and a group leader releases the previous stage's mutex (e.g.
+  LOCK_log) once it holds the next stage's (e.g. LOCK_sync), in
+  enroll_for(). Consecutive commit groups therefore overlap: while one
+  group's leader is fsyncing the binary log, the next group's leader is
+  already flushing, so an fsync-bound primary keeps filling the log
+  instead of idling behind the sync.
+
+  To make the behavior of this pipeline observable, every queue keeps
+  per-stage counters of enqueued transactions, formed groups and the
+  largest queue depth seen, exposed as the Binlog_stage_* status
+  variables; 'trx count / group count' is the average group size per
+  stage, and a max depth far above it points at a stall in that stage.
  */
 class Commit_stage_manager {
  public:
@@ -377,6 +391,21 @@ class Commit_stage_manager {
   /** Mutex used for the stage level locks */
   mysql_mutex_t m_queue_lock[STAGE_COUNTER - 1];
 
+  /**
+    Updates the counters behind the Binlog_stage_* status variables when a
+    chain of 'count' sessions has been appended to a stage queue which now
+    holds 'queue_size' sessions, 'new_group' telling whether the append
+    found the queue empty and thus started a new group. Must be called
+    with the stage queue lock held.
+
+    @param stage       Stage identifier for the queue appended to.
+    @param count       Number of sessions just appended.
+    @param queue_size  Queue size after the append.
+    @param new_group   True if the queue was empty before the append.
+  */
+  void update_queue_metrics(StageID stage, int32 count, int32 queue_size,
+                            bool new_group);
+
 #ifndef DBUG_OFF
   /** Save pointer to leader thread which is used later to awake leader */
   THD *leader_thd;
@@ -389,4 +418,16 @@ class Commit_stage_manager {
 #endif
 };
 
+/**
+  Counters behind the Binlog_stage_* status variables, indexed by
+  Commit_stage_manager::StageID (the COMMIT_ORDER_FLUSH_STAGE shares the
+  flush stage slot, as it shares its queue lock and group leader). They
+  are updated under the stage queue lock; SHOW STATUS reads them without
+  it and tolerates slightly stale values.
+*/
+extern ulonglong binlog_stage_trx_count[Commit_stage_manager::STAGE_COUNTER];
+extern ulonglong binlog_stage_group_count[Commit_stage_manager::STAGE_COUNTER];
+extern ulonglong
+    binlog_stage_max_queue_depth[Commit_stage_manager::STAGE_COUNTER];
+
 #endif /*RPL_COMMIT_STAGE_MANAGER*/
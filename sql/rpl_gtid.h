@@ -2073,8 +2073,16 @@ class Gtid_set {
     Interval_chunk *next;
     Interval intervals[1];
   };
-  /// The default number of intervals in an Interval_chunk.
+  /// The number of intervals in the first allocated Interval_chunk.
   static const int CHUNK_GROW_SIZE = 8;
+  /**
+    The maximal number of intervals in an allocated Interval_chunk.
+    Chunk sizes double up to this bound, so that Gtid_sets with
+    millions of intervals are built with a logarithmic number of
+    allocations and their intervals are laid out in large contiguous
+    blocks, without over-allocating small sets.
+  */
+  static const int MAX_CHUNK_GROW_SIZE = 8192;
 
   /**
     Return true if the given sidno of this Gtid_set contains the same
@@ -2285,6 +2293,12 @@ class Gtid_set {
   Interval *free_intervals;
   /// Linked list of chunks.
   Interval_chunk *chunks;
+  /**
+    The number of intervals in the next chunk allocated by
+    get_free_interval.  It doubles after each allocation, up to
+    MAX_CHUNK_GROW_SIZE.
+  */
+  int next_chunk_size;
   /// If the string is cached.
   mutable bool has_cached_string_length;
   /// The string length.
@@ -336,6 +336,75 @@ end:
     return 0;
 }
 
+int Gtid_table_persistor::try_extend_row(TABLE *table, const char *sid,
+                                         rpl_gno gno_start, rpl_gno gno_end) {
+  DBUG_TRACE;
+  int error = 0;
+  Field **fields = nullptr;
+  uchar user_key[MAX_KEY_LENGTH];
+
+  fields = table->field;
+  empty_record(table);
+
+  /* Store SID */
+  fields[0]->set_notnull();
+  if (fields[0]->store(sid, binary_log::Uuid::TEXT_LENGTH, &my_charset_bin)) {
+    my_error(ER_RPL_INFO_DATA_TOO_LONG, MYF(0), fields[0]->field_name);
+    return -1;
+  }
+
+  key_copy(user_key, table->record[0], table->key_info,
+           table->key_info->key_part[0].store_length);
+
+  if ((error = table->file->ha_index_init(0, true))) {
+    table->file->print_error(error, MYF(0));
+    DBUG_PRINT("info", ("ha_index_init error"));
+    return -1;
+  }
+
+  /*
+    Read the interval with the greatest gno_start stored for the sid,
+    i.e. the last row with the sid prefix in the PK(sid, gno_start).
+  */
+  if ((error = table->file->ha_index_read_map(table->record[0], user_key,
+                                              make_prev_keypart_map(1),
+                                              HA_READ_PREFIX_LAST))) {
+    table->file->ha_index_end();
+    if (error == HA_ERR_KEY_NOT_FOUND || error == HA_ERR_END_OF_FILE) {
+      /* No interval is stored for the sid yet, nothing to extend. */
+      return 0;
+    }
+    table->file->print_error(error, MYF(0));
+    return -1;
+  }
+
+  if (fields[2]->val_int() + 1 != gno_start) {
+    /* The stored interval is not adjacent to the given interval. */
+    table->file->ha_index_end();
+    return 0;
+  }
+
+  store_record(table, record[1]);
+
+  /* Store gno_end */
+  fields[2]->set_notnull();
+  if (fields[2]->store(gno_end, true /* unsigned = true*/)) {
+    my_error(ER_RPL_INFO_DATA_TOO_LONG, MYF(0), fields[2]->field_name);
+    table->file->ha_index_end();
+    return -1;
+  }
+
+  /* Extend the gtid interval in the gtid_executed table. */
+  error = table->file->ha_update_row(table->record[1], table->record[0]);
+  table->file->ha_index_end();
+  if (error) {
+    table->file->print_error(error, MYF(0));
+    return -1;
+  }
+
+  return 1;
+}
+
 int Gtid_table_persistor::save(THD *thd, const Gtid *gtid) {
   DBUG_TRACE;
   int error = 0;
@@ -428,6 +497,22 @@ int Gtid_table_persistor::save(TABLE *table, const Gtid_set *gtid_set) {
     rpl_sid sid = gtid_set->get_sid_map()->sidno_to_sid(iter->sidno);
     sid.to_string(buf);
 
+    /*
+      This path is mostly used to flush batches of GTIDs accumulated in
+      memory (by the storage engine persister, or for the last binary
+      log), so the common case is that the interval to save starts right
+      after the last interval stored for the sid. Extend that interval
+      in place then, instead of inserting a new row per flush and
+      leaving the merge to the compression thread, which compresses by
+      scanning the whole table.
+    */
+    int extended = try_extend_row(table, buf, iter->gno_start, iter->gno_end);
+    if (extended == -1) {
+      error = -1;
+      break;
+    }
+    if (extended == 1) continue;
+
     /* Save the gtid interval into table. */
     if ((error = write_row(table, buf, iter->gno_start, iter->gno_end))) break;
   }
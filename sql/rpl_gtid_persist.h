@@ -318,6 +318,28 @@ class Gtid_table_persistor {
   */
   int update_row(TABLE *table, const char *sid, rpl_gno gno_start,
                  rpl_gno new_gno_end);
+  /**
+    Extend the last gtid interval stored for a source id in place, if
+    the given interval starts right after it.
+    - locate the stored interval with the greatest gno_start for the
+      sid by reading the last row with the sid prefix on the primary
+      key (sid, gno_start).
+    - if that interval ends at gno_start - 1, update its gno_end to
+      gno_end, merging the two intervals into a single row.
+
+    @param  table     Reference to a table object.
+    @param  sid       The source id of the gtid interval.
+    @param  gno_start The first GNO of the gtid interval.
+    @param  gno_end   The last GNO of the gtid interval.
+
+    @retval 1    The stored interval was extended to cover the
+                 given interval, no row needs to be inserted.
+    @retval 0    No adjacent interval exists, the caller has to
+                 insert a new row.
+    @retval -1   Error.
+  */
+  int try_extend_row(TABLE *table, const char *sid, rpl_gno gno_start,
+                     rpl_gno gno_end);
   /**
     Delete all rows in the gtid_executed table.
 
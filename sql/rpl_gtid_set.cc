@@ -105,6 +105,7 @@ void Gtid_set::init() {
   cached_string_format = nullptr;
   chunks = nullptr;
   free_intervals = nullptr;
+  next_chunk_size = CHUNK_GROW_SIZE;
   if (sid_lock)
     mysql_mutex_init(key_gtid_executed_free_intervals_mutex,
                      &free_intervals_mutex, nullptr);
@@ -246,8 +247,15 @@ void Gtid_set::get_free_interval(Interval **out) {
   bool simulate_failure = DBUG_EVALUATE_IF(
       "rpl_gtid_get_free_interval_simulate_out_of_memory", true, false);
   if (simulate_failure) DBUG_SET("+d,rpl_simulate_new_chunk_allocate_failure");
-  if (ivit.get() == nullptr || simulate_failure)
-    create_new_chunk(CHUNK_GROW_SIZE);
+  if (ivit.get() == nullptr || simulate_failure) {
+    create_new_chunk(next_chunk_size);
+    /*
+      Double the size of the next chunk, so that building a set with
+      many intervals needs a logarithmic number of allocations, while
+      small sets never over-allocate by more than a factor of two.
+    */
+    if (next_chunk_size < MAX_CHUNK_GROW_SIZE) next_chunk_size *= 2;
+  }
   *out = ivit.get();
   ivit.set((*out)->next);
 }
@@ -267,6 +275,10 @@ void Gtid_set::clear() {
   rpl_sidno max_sidno = get_max_sidno();
   if (max_sidno == 0) return;
   Interval_iterator free_ivit(this);
+  // find the end of the list of free intervals; the per-sidno lists are
+  // appended there one after the other, so every interval is visited
+  // only once
+  while (free_ivit.get() != nullptr) free_ivit.next();
   for (rpl_sidno sidno = 1; sidno <= max_sidno; sidno++) {
     /*
       Link in this list of intervals at the end of the list of
@@ -275,10 +287,10 @@ void Gtid_set::clear() {
     Interval_iterator ivit(this, sidno);
     Interval *iv = ivit.get();
     if (iv != nullptr) {
-      // find the end of the list of free intervals
-      while (free_ivit.get() != nullptr) free_ivit.next();
       // append the present list
       free_ivit.set(iv);
+      // advance to the new end of the list of free intervals
+      while (free_ivit.get() != nullptr) free_ivit.next();
       // clear the pointer to the head of this list
       ivit.set(nullptr);
     }
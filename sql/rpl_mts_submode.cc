@@ -408,10 +408,24 @@ Slave_worker *Mts_submode_database::get_least_occupied_worker(
   }
 #endif
 
+  /*
+    Pick the Worker with the shortest jobs queue; the partition count
+    only breaks ties. Distributing by partition count alone leaves
+    Workers idle when a few hot partitions receive most of the events,
+    since a Worker owning one busy partition counts as least occupied.
+    A freed partition must go to the Worker with the least pending work.
+    jobs.len is read without the jobs lock, as a hint only; the Workers
+    drain their queues concurrently.
+  */
+  ulong min_jobs = ULONG_MAX;
   for (Slave_worker **it = ws->begin(); it != ws->end(); ++it) {
     ptr_current_worker = it;
-    if ((*ptr_current_worker)->usage_partition <= usage) {
+    ulong jobs_len = (*ptr_current_worker)->jobs.len;
+    if (jobs_len < min_jobs ||
+        (jobs_len == min_jobs &&
+         (*ptr_current_worker)->usage_partition <= usage)) {
       worker = *ptr_current_worker;
+      min_jobs = jobs_len;
       usage = (*ptr_current_worker)->usage_partition;
     }
   }
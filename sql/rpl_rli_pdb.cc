@@ -339,6 +339,7 @@ int Slave_worker::init_worker(Relay_log_info *rli, ulong i) {
   wq_empty_waits = wq_size_waits_cnt = groups_done = events_done = curr_jobs =
       0;
   usage_partition = 0;
+  partitions_stolen = 0;
   end_group_sets_max_dbs = false;
   gaq_index = last_group_done_index = c_rli->gaq->size;  // out of range
   last_groups_assigned_index = 0;
@@ -1002,9 +1003,16 @@ Slave_worker *map_db_to_worker(const char *dbname, Relay_log_info *rli,
     DBUG_PRINT("debug", ("ENTRY found for: %s!", entry->db));
     /* There is a record. Either  */
     if (entry->usage == 0) {
+      Slave_worker *prev_worker = entry->worker;
       entry->worker = (!last_worker)
                           ? get_least_occupied_worker(rli, workers, nullptr)
                           : last_worker;
+      /*
+        The partition was free and got re-mapped by load; when it moves,
+        the new Worker effectively stole it from the Worker that had
+        accumulated more pending work than others.
+      */
+      if (entry->worker != prev_worker) entry->worker->partitions_stolen++;
       entry->worker->usage_partition++;
       entry->usage++;
       DBUG_PRINT(
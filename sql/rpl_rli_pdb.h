@@ -556,6 +556,14 @@ class Slave_worker : public Relay_log_info {
   volatile int curr_jobs;          // number of active  assignments
   // number of partitions allocated to the worker at point in time
   long usage_partition;
+  /*
+    Number of free partitions this Worker took over from another Worker
+    because it had the least pending work when the partition was
+    re-mapped. Shown as PARTITIONS_STOLEN_COUNT in
+    performance_schema.replication_applier_status_by_worker; a counter
+    that keeps growing on few Workers only indicates partition skew.
+  */
+  ulong partitions_stolen;
   // symmetric to rli->mts_end_group_sets_max_dbs
   bool end_group_sets_max_dbs;
 
@@ -41,6 +41,17 @@
 #include "sql/system_variables.h"
 #include "sql/transaction_info.h"
 
+ulonglong binlog_writeset_history_hits = 0;
+ulonglong binlog_writeset_history_misses = 0;
+ulonglong binlog_writeset_history_evictions = 0;
+
+/*
+  Number of slots inspected per row hash in the writeset history. Lookups
+  and insertions never touch more than this many slots, which bounds the
+  cost of aging out old rows to a handful of comparisons per row.
+*/
+static const size_t WRITESET_HISTORY_PROBE_DEPTH = 16;
+
 Logical_clock::Logical_clock() : state(SEQ_UNINIT), offset(0) {}
 
 /**
@@ -192,13 +203,89 @@ void Commit_order_trx_dependency_tracker::update_max_committed(
   m_max_committed_transaction.set_if_greater(sequence_number);
 }
 
+void Writeset_trx_dependency_tracker::history_resize_if_needed(
+    int64 sequence_number) {
+  mysql_mutex_assert_owner(&LOCK_slave_trans_dep_tracker);
+
+  /*
+    Round the option up to a power of two so that a row hash can be mapped
+    to its home slot with a mask, and never size the table smaller than one
+    probe window.
+  */
+  size_t capacity = WRITESET_HISTORY_PROBE_DEPTH;
+  while (capacity < m_opt_max_history_size) capacity <<= 1;
+
+  if (m_writeset_history.size() == capacity) return;
+
+  /*
+    The remembered rows are dropped with the old table, so transactions
+    touching them must not be scheduled before the current transaction.
+    The very first allocation drops nothing and keeps the start untouched.
+  */
+  if (!m_writeset_history.empty()) m_writeset_history_start = sequence_number;
+
+  m_writeset_history.assign(capacity, {0, SEQ_UNINIT});
+}
+
+void Writeset_trx_dependency_tracker::history_clear() {
+  for (Writeset_history_entry &entry : m_writeset_history)
+    entry.seqno = SEQ_UNINIT;
+}
+
+int64 Writeset_trx_dependency_tracker::history_update(uint64 row_hash,
+                                                      int64 sequence_number) {
+  mysql_mutex_assert_owner(&LOCK_slave_trans_dep_tracker);
+
+  const size_t mask = m_writeset_history.size() - 1;
+  Writeset_history_entry *reusable = nullptr;
+  Writeset_history_entry *oldest = nullptr;
+
+  for (size_t probe = 0; probe < WRITESET_HISTORY_PROBE_DEPTH; probe++) {
+    Writeset_history_entry &entry = m_writeset_history[(row_hash + probe) &
+                                                       mask];
+    if (entry.seqno != SEQ_UNINIT && entry.row_hash == row_hash) {
+      int64 last_seqno = entry.seqno;
+      entry.seqno = sequence_number;
+      binlog_writeset_history_hits++;
+      return last_seqno;
+    }
+    /*
+      Slots that are free, or whose transaction is already covered by
+      m_writeset_history_start, can be taken over without losing any
+      dependency information.
+    */
+    if (entry.seqno <= m_writeset_history_start) {
+      if (reusable == nullptr) reusable = &entry;
+    } else if (oldest == nullptr || entry.seqno < oldest->seqno)
+      oldest = &entry;
+  }
+
+  binlog_writeset_history_misses++;
+
+  Writeset_history_entry *slot = reusable;
+  if (slot == nullptr) {
+    /*
+      The probe window is full of live rows: age out the oldest one. Its
+      transaction becomes the minimal commit parent for any transaction
+      touching a row the history does not remember.
+    */
+    slot = oldest;
+    m_writeset_history_start = std::max(m_writeset_history_start, slot->seqno);
+    binlog_writeset_history_evictions++;
+  }
+  slot->row_hash = row_hash;
+  slot->seqno = sequence_number;
+  return SEQ_UNINIT;
+}
+
 /**
   Get the writeset dependencies of a transaction.
   This takes the commit_parent that must be previously set using
   Commit_order_trx_dependency_tracker and tries to make the commit_parent as
   low as possible, using the writesets of each transaction.
-  The commit_parent returned depends on how many row hashes are stored in the
-  writeset_history, which is cleared once it reaches the user-defined maximum.
+  The commit_parent returned depends on how many row hashes are remembered
+  by the writeset history; old rows are aged out of the history one at a
+  time once it is full.
 
   @param[in]     thd             Current THD from which to extract trx context.
   @param[in,out] sequence_number Sequence number of current transaction.
@@ -241,37 +328,28 @@ void Writeset_trx_dependency_tracker::get_dependency(THD *thd,
        thd->variables.transaction_write_set_extraction) &&
       // must not use foreign keys
       !write_set_ctx->get_has_related_foreign_keys();
-  bool exceeds_capacity = false;
 
   mysql_mutex_lock(&LOCK_slave_trans_dep_tracker);
   if (can_use_writesets) {
     /*
-     Check if adding this transaction exceeds the capacity of the writeset
-     history. If that happens, m_writeset_history will be cleared only after
-     using its information for current transaction.
+      (Re)allocate the history if binlog_transaction_dependency_history_size
+      was changed since the last transaction.
     */
-    exceeds_capacity =
-        m_writeset_history.size() + writeset->size() > m_opt_max_history_size;
+    history_resize_if_needed(sequence_number);
 
     /*
      Compute the greatest sequence_number among all conflicts and add the
-     transaction's row hashes to the history.
+     transaction's row hashes to the history. Rows are aged out of the
+     history individually, so a full history never forces the whole window
+     to be dropped.
     */
     DEBUG_SYNC(thd, "wait_in_get_dependency");
     int64 last_parent = m_writeset_history_start;
     for (std::vector<uint64>::iterator it = writeset->begin();
          it != writeset->end(); ++it) {
-      Writeset_history::iterator hst = m_writeset_history.find(*it);
-      if (hst != m_writeset_history.end()) {
-        if (hst->second > last_parent && hst->second < sequence_number)
-          last_parent = hst->second;
-
-        hst->second = sequence_number;
-      } else {
-        if (!exceeds_capacity)
-          m_writeset_history.insert(
-              std::pair<uint64, int64>(*it, sequence_number));
-      }
+      int64 last_seqno = history_update(*it, sequence_number);
+      if (last_seqno > last_parent && last_seqno < sequence_number)
+        last_parent = last_seqno;
     }
 
     /*
@@ -287,18 +365,16 @@ void Writeset_trx_dependency_tracker::get_dependency(THD *thd,
       */
       commit_parent = std::min(last_parent, commit_parent);
     }
-  }
-
-  if (exceeds_capacity || !can_use_writesets) {
+  } else {
     m_writeset_history_start = sequence_number;
-    m_writeset_history.clear();
+    history_clear();
   }
   mysql_mutex_unlock(&LOCK_slave_trans_dep_tracker);
 }
 
 void Writeset_trx_dependency_tracker::rotate(int64 start) {
   m_writeset_history_start = start;
-  m_writeset_history.clear();
+  history_clear();
 }
 
 /**
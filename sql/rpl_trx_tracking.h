@@ -25,7 +25,7 @@
 
 #include <sys/types.h>
 #include <atomic>
-#include <map>
+#include <vector>
 
 #include "libbinlogevents/include/binlog_event.h"
 #include "my_dbug.h"
@@ -147,18 +147,75 @@ class Writeset_trx_dependency_tracker {
     The m_writeset_history_start must to be set to 0 initially and whenever the
     binlog_transaction_dependency_tracking variable is changed or the history
     is cleared, so that it is updated to the first transaction for which the
-    dependencies are checked.
+    dependencies are checked. Additionally, whenever a row is aged out of the
+    history it must be raised to at least the aged-out row's sequence number,
+    since a transaction touching that row again must not be scheduled before
+    the transaction the history no longer remembers.
   */
   int64 m_writeset_history_start;
 
   /*
-    Track the last transaction sequence number that changed each row
-    in the database, using row hashes from the writeset as the index.
+    One slot of the writeset history. A free slot is marked by seqno ==
+    SEQ_UNINIT; valid sequence numbers are always greater than zero.
   */
-  typedef std::map<uint64, int64> Writeset_history;
-  Writeset_history m_writeset_history;
+  struct Writeset_history_entry {
+    uint64 row_hash;
+    int64 seqno;
+  };
+
+  /*
+    Track the last transaction sequence number that changed each row in the
+    database, using row hashes from the writeset as the index.
+
+    The history is a bounded open-addressing hash table with a fixed probe
+    window: rows are aged out one slot at a time, by evicting the oldest
+    entry in a full probe window and raising m_writeset_history_start to the
+    evicted sequence number. A plain map capped at
+    m_opt_max_history_size had to be cleared completely whenever it filled
+    up, which made every transaction after the clear depend on the clearing
+    transaction and periodically collapsed applier parallelism back to
+    commit order.
+  */
+  std::vector<Writeset_history_entry> m_writeset_history;
+
+  /**
+    (Re)allocates the history whenever its capacity does not correspond to
+    m_opt_max_history_size anymore. Any remembered rows are dropped, so
+    m_writeset_history_start is raised to the current transaction.
+
+    @param sequence_number The current transaction's sequence number.
+  */
+  void history_resize_if_needed(int64 sequence_number);
+
+  /// Marks all slots of the history as free.
+  void history_clear();
+
+  /**
+    Looks up one row hash in the history and records that the current
+    transaction changed the row.
+
+    @param row_hash        Hash of the row, from the transaction's writeset.
+    @param sequence_number The current transaction's sequence number.
+
+    @return the sequence number of the last transaction that changed the
+    row, or SEQ_UNINIT if the row is not in the history.
+  */
+  int64 history_update(uint64 row_hash, int64 sequence_number);
 };
 
+/**
+  Statistics of the writeset history hash table, shown as the
+  Binlog_writeset_history_* status variables: how often a row hash from a
+  transaction's writeset was found in the history (raising the potential
+  commit parent), how often it was not, and how many fresh rows were aged
+  out to make room for new ones. A growing eviction rate means the history
+  window (binlog_transaction_dependency_history_size) is too small for the
+  write rate. Updated under LOCK_slave_trans_dep_tracker.
+*/
+extern ulonglong binlog_writeset_history_hits;
+extern ulonglong binlog_writeset_history_misses;
+extern ulonglong binlog_writeset_history_evictions;
+
 /**
   Generate logical timestamps for MTS using WRITESET_SESSION
   in the binlog-transaction-dependency-tracking option.
@@ -74,6 +74,7 @@ static collation_unordered_map<string, sys_var *> *system_variable_hash;
 static PolyLock_mutex PLock_global_system_variables(
     &LOCK_global_system_variables);
 ulonglong system_variable_hash_version = 0;
+std::atomic<ulonglong> global_system_variables_generation{1};
 
 collation_unordered_map<string, sys_var *> *get_system_variable_hash(void) {
   return system_variable_hash;
@@ -293,8 +294,14 @@ bool sys_var::update(THD *thd, set_var *var) {
     */
     AutoWLock lock1(&PLock_global_system_variables);
     AutoWLock lock2(guard);
-    return global_update(thd, var) ||
-           (on_update && on_update(this, thd, OPT_GLOBAL));
+    bool ret = global_update(thd, var) ||
+               (on_update && on_update(this, thd, OPT_GLOBAL));
+    /*
+      Invalidate the snapshot of the global system variables that
+      seeds new sessions, see plugin_thdvar_init().
+    */
+    global_system_variables_generation.fetch_add(1, std::memory_order_release);
+    return ret;
   } else {
     /* Block reads from other threads. */
     mysql_mutex_lock(&thd->LOCK_thd_sysvar);
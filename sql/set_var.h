@@ -32,6 +32,7 @@
 #include <stddef.h>
 #include <string.h>
 #include <sys/types.h>
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -489,6 +490,15 @@ class set_var_collation_client : public set_var_base {
   void print(const THD *thd, String *str); /* To self-print */
 };
 
+/**
+  Generation counter of the global system variables. It is incremented
+  whenever a global system variable is updated, and is used by
+  plugin_thdvar_init() to decide whether its snapshot of
+  global_system_variables, from which new sessions are seeded without
+  taking LOCK_global_system_variables, is still current.
+*/
+extern std::atomic<ulonglong> global_system_variables_generation;
+
 /* optional things, have_* variables */
 extern SHOW_COMP_OPTION have_profiling;
 
@@ -23,18 +23,23 @@
 #ifndef SORT_PARAM_INCLUDED
 #define SORT_PARAM_INCLUDED
 
+#include <string>
+
 #include "field_types.h"   // enum_field_types
+#include "map_helpers.h"   // malloc_unordered_map
 #include "my_base.h"       // ha_rows
 #include "my_byteorder.h"  // uint4korr
 #include "my_dbug.h"
 #include "my_inttypes.h"
-#include "my_io.h"          // mysql_com.h needs my_socket
-#include "mysql_com.h"      // Item_result
-#include "sql/sql_array.h"  // Bounds_checked_array
+#include "my_io.h"               // mysql_com.h needs my_socket
+#include "mysql_com.h"           // Item_result
+#include "sql/psi_memory_key.h"  // key_memory_Sort_key_weight_cache
+#include "sql/sql_array.h"       // Bounds_checked_array
 #include "sql/sql_const.h"
 #include "sql/sql_sort.h"  // Filesort_info
 #include "sql/thr_malloc.h"
 #include "sql_string.h"
+#include "template_utils.h"  // pointer_cast
 
 class Field;
 class Filesort;
@@ -91,6 +96,107 @@ struct st_sort_field {
   bool maybe_null;              ///< If key part is nullable
 };
 
+/**
+  A small, bounded memo of computed sort keys (strnxfrm() weight strings),
+  keyed by the source bytes of a sort field. Repeated sorting of the same
+  short strings (country codes, status columns and the like) otherwise
+  recomputes the same weight string for every row, which can dominate
+  sortkey generation cost for the more expensive collations.
+
+  The cache is consulted by Sort_param::make_sortkey() for non-JSON string
+  sort fields only. Since the collation, the maximum length and the padding
+  flags are all fixed per sort field, the source bytes together with the
+  index of the sort field uniquely determine the produced weights.
+
+  It is strictly an optimization for low-cardinality data: once a sample
+  window of lookups has been seen, the cache turns itself off for the
+  remainder of the sort if too few of them were hits, so high-cardinality
+  sorts pay for the sample window only. Hits and misses are exposed through
+  the Sort_key_cache_hits and Sort_key_cache_misses status variables.
+*/
+class Sort_key_weight_cache {
+ public:
+  /// Longest source value (in bytes) that will be cached.
+  static constexpr size_t kMaxSourceLength = 64;
+  /// Upper bound on the number of cached entries.
+  static constexpr size_t kMaxEntries = 1024;
+  /// Number of lookups after which the hit rate is evaluated.
+  static constexpr ulonglong kSampleWindow = 1024;
+  /// Required number of hits within the sample window to stay enabled.
+  static constexpr ulonglong kMinHitsPerWindow = kSampleWindow / 8;
+
+  Sort_key_weight_cache() : m_entries(key_memory_Sort_key_weight_cache) {}
+
+  /// Forget all entries and counters, making the cache ready for a new sort.
+  void reset() {
+    m_entries.clear();
+    m_hits = 0;
+    m_misses = 0;
+    m_enabled = true;
+  }
+
+  /// Is a source value of the given length worth looking up at all?
+  bool applicable(size_t src_length) const {
+    return m_enabled && src_length <= kMaxSourceLength;
+  }
+
+  /**
+    Look up previously computed weights for a source value.
+    Updates the hit/miss statistics, and may disable the cache if the
+    hit rate over the sample window turned out to be too low.
+
+    @param field_idx   index of the sort field within the sort order
+    @param src         source bytes, in the sort field's character set
+    @param src_length  length of src in bytes
+
+    @returns the cached weight string, or nullptr on a miss.
+  */
+  const std::string *lookup(uint field_idx, const char *src,
+                            size_t src_length) {
+    make_key(field_idx, src, src_length);
+    const auto it = m_entries.find(m_key_buffer);
+    if (it != m_entries.end()) {
+      ++m_hits;
+      return &it->second;
+    }
+    ++m_misses;
+    if (m_hits + m_misses == kSampleWindow && m_hits < kMinHitsPerWindow)
+      m_enabled = false;
+    return nullptr;
+  }
+
+  /**
+    Remember the weights produced for the source value given to the last
+    (missing) lookup() call. Does nothing once the cache is full.
+  */
+  void insert(const uchar *weights, size_t weight_length) {
+    if (m_entries.size() >= kMaxEntries) return;
+    m_entries.emplace(
+        m_key_buffer,
+        std::string(pointer_cast<const char *>(weights), weight_length));
+  }
+
+  ulonglong hits() const { return m_hits; }
+  ulonglong misses() const { return m_misses; }
+
+ private:
+  /// Build the map key for a source value into m_key_buffer.
+  void make_key(uint field_idx, const char *src, size_t src_length) {
+    uchar idx[4];
+    int4store(idx, field_idx);
+    m_key_buffer.assign(pointer_cast<const char *>(idx), sizeof(idx));
+    m_key_buffer.append(src, src_length);
+  }
+
+  /// Cached weight strings, keyed by sort field index and source bytes.
+  malloc_unordered_map<std::string, std::string> m_entries;
+  /// Reusable buffer for map keys, to avoid a fresh allocation per row.
+  std::string m_key_buffer;
+  ulonglong m_hits{0};
+  ulonglong m_misses{0};
+  bool m_enabled{true};
+};
+
 /**
   The structure Sort_addon_field describes the layout
   for field values appended to sorted values in records to be sorted
@@ -287,6 +393,9 @@ class Sort_param {
   bool using_pq{false};
   StringBuffer<STRING_BUFFER_USUAL_SIZE> tmp_buffer;
 
+  /// Memo of computed weight strings for low-cardinality string sort fields.
+  Sort_key_weight_cache weight_cache;
+
   /// Decide whether we are to use addon fields (sort rows instead of sorting
   /// row IDs or not). See using_addon_fields().
   ///
@@ -401,7 +510,8 @@ class Sort_param {
   enum enum_sort_algorithm {
     FILESORT_ALG_NONE,
     FILESORT_ALG_STD_SORT,
-    FILESORT_ALG_STD_STABLE
+    FILESORT_ALG_STD_STABLE,
+    FILESORT_ALG_RADIX
   };
   enum_sort_algorithm m_sort_algorithm{FILESORT_ALG_NONE};
 
@@ -603,6 +603,8 @@ int SortingIterator::DoSort() {
   ha_rows found_rows;
   bool error = filesort(thd(), m_filesort, m_source_iterator.get(), &m_fs_info,
                         &m_sort_result, &found_rows);
+  m_peak_memory_used =
+      std::max(m_peak_memory_used, m_fs_info.peak_memory_used());
   if (m_qep_tab != nullptr) {
     m_qep_tab->set_records(found_rows);  // For SQL_CALC_FOUND_ROWS
   }
@@ -666,3 +668,13 @@ vector<string> SortingIterator::DebugString() const {
 
   return {ret};
 }
+
+string SortingIterator::ExtraStatsString() const {
+  if (m_peak_memory_used == 0) {
+    // Never executed.
+    return "";
+  }
+  char buf[64];
+  snprintf(buf, sizeof(buf), "(sort_peak_memory=%zu)", m_peak_memory_used);
+  return buf;
+}
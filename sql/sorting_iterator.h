@@ -102,6 +102,8 @@ class SortingIterator final : public RowIterator {
 
   std::vector<std::string> DebugString() const override;
 
+  std::string ExtraStatsString() const override;
+
   /// Optional (when JOIN::destroy() runs, the iterator and its buffers
   /// will be cleaned up anyway); used to clean up the buffers a little
   /// bit earlier.
@@ -135,6 +137,11 @@ class SortingIterator final : public RowIterator {
 
   Sort_result m_sort_result;
 
+  // The largest amount of memory the sort buffers have held at any point,
+  // across re-sorts (a dependent subquery may sort many times). Reported by
+  // EXPLAIN ANALYZE.
+  size_t m_peak_memory_used{0};
+
   ha_rows *m_examined_rows;
 
   // Holds one out of all RowIterator implementations we need so that it is
@@ -1711,6 +1711,10 @@ sp_head::sp_head(MEM_ROOT &&mem_root, enum_sp_type type)
       m_sroutines(key_memory_sp_head_main_root),
       m_trg_list(nullptr),
       main_mem_root(std::move(mem_root)),
+      m_trigger_rcontext(nullptr),
+      m_trigger_rcontext_arena(nullptr),
+      m_trigger_priv_query_id(0),
+      m_trigger_priv_switched_ctx(false),
       m_root_parsing_ctx(nullptr),
       m_instructions(&main_mem_root),
       m_sptabs(system_charset_info, key_memory_sp_head_main_root),
@@ -1899,6 +1903,12 @@ sp_head::~sp_head() {
   // Parsing of SP-body must have been already finished.
   DBUG_ASSERT(!m_parser_data.is_parsing_sp_body());
 
+  if (m_trigger_rcontext != nullptr) ::destroy(m_trigger_rcontext);
+  if (m_trigger_rcontext_arena != nullptr) {
+    m_trigger_rcontext_arena->free_items();
+    free_root(&m_trigger_rcontext_mem_root, MYF(0));
+  }
+
   for (uint ip = 0; (i = get_instr(ip)); ip++) ::destroy(i);
 
   ::destroy(m_root_parsing_ctx);
@@ -2238,10 +2248,14 @@ bool sp_head::execute(THD *thd, bool merge_da_on_success) {
       thd->user_var_events_alloc = nullptr;  // DEBUG
     }
 
-    /* we should cleanup free_list and memroot, used by instruction */
-
+    /*
+      We should cleanup free_list and memroot, used by instruction.
+      Keep the last mem-root block for reuse by the next instruction
+      instead of returning it to the allocator; the root is fully freed
+      when the routine returns.
+    */
     thd->cleanup_after_query();
-    free_root(&execute_mem_root, MYF(0));
+    free_root(&execute_mem_root, MYF(MY_KEEP_PREALLOC));
 
     /*
       Find and process SQL handlers unless it is a fatal error (fatal
@@ -2278,6 +2292,9 @@ bool sp_head::execute(THD *thd, bool merge_da_on_success) {
 
   thd->swap_query_arena(backup_arena, &execute_arena);
 
+  /* Free the block kept by the per-instruction cleanup above. */
+  free_root(&execute_mem_root, MYF(0));
+
   thd->sp_runtime_ctx
       ->pop_all_cursors();  // To avoid memory leaks after an error
 
@@ -2421,31 +2438,51 @@ bool sp_head::execute_trigger(THD *thd, const LEX_CSTRING &db_name,
     It means, that trigger can't never be NOT-SUID.
   */
   DBUG_ASSERT(m_chistics->suid != SP_IS_NOT_SUID);
-  if (m_security_ctx.change_security_context(thd, definer_user, definer_host,
-                                             m_db.str, &save_ctx))
-    return true;
 
-  /*
-    Fetch information about table-level privileges for subject table into
-    GRANT_INFO instance. The access check itself will happen in
-    Item_trigger_field, where this information will be used along with
-    information about column-level privileges.
-  */
+  if (m_trigger_priv_query_id == thd->query_id) {
+    /*
+      The trigger already fired for an earlier row of this statement.
+      The definer's credentials in m_security_ctx, the subject table
+      privileges in *grant_info and the outcome of the TRIGGER privilege
+      check cannot have changed since then (privilege changes take
+      effect at the next statement at the earliest), so just repeat the
+      security context switch and skip the ACL cache lookups.
+    */
+    if (m_trigger_priv_switched_ctx) {
+      save_ctx = thd->security_context();
+      thd->set_security_context(&m_security_ctx);
+    }
+  } else {
+    if (m_security_ctx.change_security_context(
+            thd, definer_user, definer_host, m_db.str, &save_ctx))
+      return true;
 
-  fill_effective_table_privileges(thd, grant_info, db_name.str, table_name.str);
+    /*
+      Fetch information about table-level privileges for subject table into
+      GRANT_INFO instance. The access check itself will happen in
+      Item_trigger_field, where this information will be used along with
+      information about column-level privileges.
+    */
 
-  /* Check that the definer has TRIGGER privilege on the subject table. */
+    fill_effective_table_privileges(thd, grant_info, db_name.str,
+                                    table_name.str);
 
-  if (!(grant_info->privilege & TRIGGER_ACL)) {
-    char priv_desc[128];
-    get_privilege_desc(priv_desc, sizeof(priv_desc), TRIGGER_ACL);
+    /* Check that the definer has TRIGGER privilege on the subject table. */
 
-    my_error(ER_TABLEACCESS_DENIED_ERROR, MYF(0), priv_desc,
-             thd->security_context()->priv_user().str,
-             thd->security_context()->host_or_ip().str, table_name.str);
+    if (!(grant_info->privilege & TRIGGER_ACL)) {
+      char priv_desc[128];
+      get_privilege_desc(priv_desc, sizeof(priv_desc), TRIGGER_ACL);
 
-    m_security_ctx.restore_security_context(thd, save_ctx);
-    return true;
+      my_error(ER_TABLEACCESS_DENIED_ERROR, MYF(0), priv_desc,
+               thd->security_context()->priv_user().str,
+               thd->security_context()->host_or_ip().str, table_name.str);
+
+      m_security_ctx.restore_security_context(thd, save_ctx);
+      return true;
+    }
+
+    m_trigger_priv_query_id = thd->query_id;
+    m_trigger_priv_switched_ctx = (save_ctx != nullptr);
   }
   /*
     Optimizer trace note: we needn't explicitly test here that the connected
@@ -2457,28 +2494,53 @@ bool sp_head::execute_trigger(THD *thd, const LEX_CSTRING &db_name,
 
   /*
     Prepare arena and memroot for objects which lifetime is whole
-    duration of trigger call (sp_rcontext, it's tables and items,
-    sp_cursor and Item_cache holders for case expressions).  We can't
-    use caller's arena/memroot for those objects because in this case
-    some fixed amount of memory will be consumed for each trigger
-    invocation and so statements which involve lot of them will hog
-    memory.
-
-    TODO: we should create sp_rcontext once per command and reuse it
-    on subsequent executions of a trigger.
+    duration of trigger call (sp_cursor and Item_cache holders for
+    case expressions).  We can't use caller's arena/memroot for those
+    objects because in this case some fixed amount of memory will be
+    consumed for each trigger invocation and so statements which
+    involve lot of them will hog memory.
   */
   init_sql_alloc(key_memory_sp_head_call_root, &call_mem_root,
                  MEM_ROOT_BLOCK_SIZE, 0);
   thd->swap_query_arena(call_arena, &backup_arena);
 
-  sp_rcontext *trigger_runtime_ctx =
-      sp_rcontext::create(thd, m_root_parsing_ctx, nullptr);
+  sp_rcontext *trigger_runtime_ctx = m_trigger_rcontext;
 
-  if (!trigger_runtime_ctx) {
-    err_status = true;
-    goto err_with_cleanup;
+  if (trigger_runtime_ctx == nullptr) {
+    /*
+      The trigger fires for the first time: create the runtime context
+      (variable table and items) on a mem-root owned by this sp_head so
+      that it can be reused when the trigger fires for subsequent rows.
+      This is safe since an sp_head instance is never executed
+      reentrantly (see IS_INVOKED); per-invocation state is released in
+      sp_rcontext::cleanup_after_invocation() below.
+    */
+    Query_arena create_backup_arena;
+
+    init_sql_alloc(key_memory_sp_head_call_root, &m_trigger_rcontext_mem_root,
+                   MEM_ROOT_BLOCK_SIZE, 0);
+    m_trigger_rcontext_arena = new (&m_trigger_rcontext_mem_root)
+        Query_arena(&m_trigger_rcontext_mem_root,
+                    Query_arena::STMT_INITIALIZED_FOR_SP);
+
+    if (m_trigger_rcontext_arena == nullptr) {
+      err_status = true;
+      goto err_with_cleanup;
+    }
+
+    thd->swap_query_arena(*m_trigger_rcontext_arena, &create_backup_arena);
+    trigger_runtime_ctx = sp_rcontext::create(thd, m_root_parsing_ctx, nullptr);
+    thd->swap_query_arena(create_backup_arena, m_trigger_rcontext_arena);
+
+    if (!trigger_runtime_ctx) {
+      err_status = true;
+      goto err_with_cleanup;
+    }
+
+    m_trigger_rcontext = trigger_runtime_ctx;
   }
 
+  trigger_runtime_ctx->attach_to_thd(thd);
   trigger_runtime_ctx->sp = this;
   thd->sp_runtime_ctx = trigger_runtime_ctx;
 
@@ -2498,7 +2560,12 @@ err_with_cleanup:
 
   m_security_ctx.restore_security_context(thd, save_ctx);
 
-  ::destroy(trigger_runtime_ctx);
+  /*
+    Release per-invocation state (cursors, handler frames), but keep
+    the runtime context itself for the next row this trigger fires for.
+  */
+  if (trigger_runtime_ctx != nullptr)
+    trigger_runtime_ctx->cleanup_after_invocation();
   call_arena.free_items();
   free_root(&call_mem_root, MYF(0));
   thd->sp_runtime_ctx = parent_sp_runtime_ctx;
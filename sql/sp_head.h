@@ -49,10 +49,12 @@
 class Field;
 class Item;
 class Item_trigger_field;
+class Query_arena;
 class Sroutine_hash_entry;
 class Table_trigger_field_support;
 class THD;
 class sp_head;
+class sp_rcontext;
 struct CHARSET_INFO;
 struct MY_BITMAP;
 
@@ -898,6 +900,40 @@ class sp_head {
   /// SP-persistent memory root (for instructions and expressions).
   MEM_ROOT main_mem_root;
 
+  /**
+    Runtime context reused across invocations of a trigger body.
+
+    A trigger fires once per affected row, and an sp_head instance is never
+    executed reentrantly (see the IS_INVOKED flag), so the sp_rcontext with
+    its variable table can be created when the trigger fires for the first
+    time and reused for subsequent rows. Only per-invocation state (open
+    cursors, handler frames) is released between rows; variable values are
+    re-initialized by the DECLARE instructions at the start of the body.
+    NULL until the trigger fires for the first time; destroyed together
+    with this sp_head.
+  */
+  sp_rcontext *m_trigger_rcontext;
+
+  /// Mem-root holding m_trigger_rcontext and its items.
+  MEM_ROOT m_trigger_rcontext_mem_root;
+
+  /// Arena collecting items created for m_trigger_rcontext.
+  Query_arena *m_trigger_rcontext_arena;
+
+  /**
+    Query id of the statement for which the definer's security context
+    and the effective privileges on the subject table were last resolved,
+    when this sp_head is a trigger body. Resolving them requires ACL
+    cache lookups under the ACL lock, and their outcome cannot change in
+    the middle of a statement, so when the trigger fires for further rows
+    of the same statement the result of the first resolution is reused.
+    0 when no resolution has been done yet.
+  */
+  query_id_t m_trigger_priv_query_id;
+
+  /// Whether the resolution above switched THD's security context.
+  bool m_trigger_priv_switched_ctx;
+
   /// Root parsing context (topmost BEGIN..END block) of this SP.
   sp_pcontext *m_root_parsing_ctx;
 
@@ -703,11 +703,17 @@ bool sp_lex_instr::validate_lex_and_execute_core(THD *thd, uint *nextp,
       are marked by CF_REEXECUTION_FRAGILE (@sa CF_REEXECUTION_FRAGILE) or if
       the SQL-command is SQLCOM_END, which means that the LEX-object is
       representing an expression, so the exact SQL-command does not matter.
+
+      Statements that reference no tables, views or stored routines are
+      exempt: all version checks that may report ER_NEED_REPREPARE are
+      done per referenced table or routine (or for a broken LEX), so for
+      such statements the observer could never be triggered.
     */
 
     if (!m_first_execution &&
         (sql_command_flags[m_lex->sql_command] & CF_REEXECUTION_FRAGILE ||
-         m_lex->sql_command == SQLCOM_END)) {
+         m_lex->sql_command == SQLCOM_END) &&
+        (m_lex->is_metadata_used() || m_lex->is_broken())) {
       reprepare_observer.reset_reprepare_observer();
       stmt_reprepare_observer = &reprepare_observer;
     }
@@ -69,12 +69,23 @@ sp_rcontext::~sp_rcontext() {
     destroy(m_var_table);
   }
 
+  cleanup_after_invocation();
+
+  // Leave m_var_items and m_case_expr_holders untouched.
+  // They are allocated in mem roots and will be freed accordingly.
+}
+
+void sp_rcontext::attach_to_thd(THD *thd) {
+  if (m_var_table != nullptr) m_var_table->in_use = thd;
+}
+
+void sp_rcontext::cleanup_after_invocation() {
   delete_container_pointers(m_activated_handlers);
   delete_container_pointers(m_visible_handlers);
   pop_all_cursors();
 
-  // Leave m_var_items and m_case_expr_holders untouched.
-  // They are allocated in mem roots and will be freed accordingly.
+  end_partial_result_set = false;
+  m_return_value_set = false;
 }
 
 sp_rcontext *sp_rcontext::create(THD *thd, const sp_pcontext *root_parsing_ctx,
@@ -90,6 +90,18 @@ class sp_rcontext {
 
   ~sp_rcontext();
 
+  /// Release state accumulated during one invocation of the routine
+  /// (open cursors, handler frames), so that this instance can be reused
+  /// for the next invocation. Used for triggers, which are re-executed
+  /// for every affected row. Also called from the destructor.
+  void cleanup_after_invocation();
+
+  /// Re-attach the variable table to the THD executing the routine.
+  /// Must be called when a cached instance is reused: trigger sp_heads
+  /// live with the TABLE object and may be picked up from the table
+  /// cache by another connection.
+  void attach_to_thd(THD *thd);
+
  private:
   sp_rcontext(const sp_pcontext *root_parsing_ctx, Field *return_value_fld,
               bool in_sub_stmt);
@@ -1292,8 +1292,24 @@ static bool mysql_admin_table(
         if (open_for_modify && !open_error)
           table->table->file->info(HA_STATUS_CONST);
       } else if (open_for_modify || fatal_error) {
-        tdc_remove_table(thd, TDC_RT_REMOVE_UNUSED, table->db,
-                         table->table_name, false);
+        if (!fatal_error && strcmp(operator_name, "analyze") == 0) {
+          /*
+            ANALYZE TABLE changes only statistics, not the table
+            definition, so the share can stay in the cache. Removing it
+            would make every new opener of the table wait until all
+            running statements have released the old share, which piles
+            up on hot tables. Refresh the statistics for this handler;
+            other cached handlers pick up new row estimates through
+            info(HA_STATUS_VARIABLE) on their next statement and re-read
+            index statistics when they are naturally reopened.
+            (Histogram updates still flush the share, since histograms
+            are cached in the TABLE_SHARE itself.)
+          */
+          table->table->file->info(HA_STATUS_CONST);
+        } else {
+          tdc_remove_table(thd, TDC_RT_REMOVE_UNUSED, table->db,
+                           table->table_name, false);
+        }
       } else {
         /*
           Reset which partitions that should be processed
@@ -1683,7 +1683,8 @@ void close_thread_tables(THD *thd) {
   table is marked as needing re-open.
 */
 static void release_or_close_table(THD *thd, TABLE *table) {
-  Table_cache *tc = table_cache_manager.get_cache(thd);
+  Table_cache *tc = table_cache_manager.get_cache(
+      table->s->table_cache_key.str, table->s->table_cache_key.length);
 
   tc->lock();
 
@@ -3072,7 +3073,7 @@ bool open_table(THD *thd, TABLE_LIST *table_list, Open_table_context *ot_ctx) {
     return false;
 
 retry_share : {
-  Table_cache *tc = table_cache_manager.get_cache(thd);
+  Table_cache *tc = table_cache_manager.get_cache(key, key_length);
 
   tc->lock();
 
@@ -3374,8 +3375,9 @@ share_found:
     }
   }
   {
-    /* Add new TABLE object to table cache for this connection. */
-    Table_cache *tc = table_cache_manager.get_cache(thd);
+    /* Add new TABLE object to table cache instance serving this table. */
+    Table_cache *tc = table_cache_manager.get_cache(
+        table->s->table_cache_key.str, table->s->table_cache_key.length);
 
     tc->lock();
 
@@ -4690,7 +4692,8 @@ static bool open_and_process_routine(
           TODO: Perhaps we should give it a try as it can be more
                 scalability friendly.
         */
-        Table_cache *tc = table_cache_manager.get_cache(thd);
+        Table_cache *tc = table_cache_manager.get_cache(
+            rt->part_mdl_key(), rt->part_mdl_key_length());
         TABLE *table;
         TABLE_SHARE *share;
 
@@ -1835,10 +1835,52 @@ void Prepared_statement_map::erase(Prepared_statement *statement) {
   mysql_mutex_unlock(&LOCK_prepared_stmt_count);
 }
 
+void Prepared_statement_map::stash_for_reuse(Prepared_statement *statement) {
+  /*
+    Keep the bin small; the point is to serve connections that close and
+    re-prepare the same handful of statements on every request, not to be
+    a general cache.
+  */
+  static constexpr size_t RECYCLE_BIN_CAPACITY = 16;
+
+  if (statement == m_last_found_statement) m_last_found_statement = nullptr;
+  DBUG_ASSERT(statement->name().str == nullptr);
+
+  // Take the statement out of the map without destroying it.
+  auto it = st_hash.find(statement->id);
+  DBUG_ASSERT(it != st_hash.end());
+  it->second.release();
+  st_hash.erase(it);
+  mysql_mutex_lock(&LOCK_prepared_stmt_count);
+  DBUG_ASSERT(prepared_stmt_count > 0);
+  prepared_stmt_count--;
+  mysql_mutex_unlock(&LOCK_prepared_stmt_count);
+
+  if (m_recycle_bin.size() >= RECYCLE_BIN_CAPACITY)
+    m_recycle_bin.erase(m_recycle_bin.begin());
+  m_recycle_bin.emplace_back(statement);
+}
+
+Prepared_statement *Prepared_statement_map::claim_recycled(THD *thd,
+                                                           const char *query,
+                                                           size_t length) {
+  for (auto it = m_recycle_bin.begin(); it != m_recycle_bin.end(); ++it) {
+    if ((*it)->is_reusable_for(thd, query, length)) {
+      Prepared_statement *statement = it->release();
+      m_recycle_bin.erase(it);
+      return statement;
+    }
+  }
+  return nullptr;
+}
+
 void Prepared_statement_map::claim_memory_ownership() {
   for (const auto &key_and_value : st_hash) {
     my_claim(key_and_value.second.get());
   }
+  for (const auto &stmt : m_recycle_bin) {
+    my_claim(stmt.get());
+  }
 }
 
 void Prepared_statement_map::reset() {
@@ -1856,6 +1898,7 @@ void Prepared_statement_map::reset() {
   }
   names_hash.clear();
   st_hash.clear();
+  m_recycle_bin.clear();
   m_last_found_statement = nullptr;
 }
 
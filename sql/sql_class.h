@@ -46,6 +46,7 @@
 #include <memory>
 #include <new>
 #include <string>
+#include <vector>
 
 #include "dur_prop.h"  // durability_properties
 #include "lex_string.h"
@@ -381,6 +382,29 @@ class Prepared_statement_map {
   /** Erase all prepared statements (calls Prepared_statement destructor). */
   void erase(Prepared_statement *statement);
 
+  /**
+    Move a statement that is being closed into the recycle bin instead of
+    destroying it, so that a later COM_STMT_PREPARE of the identical
+    statement text on this connection can reuse it without re-parsing.
+    The statement is removed from the map and no longer counts against
+    max_prepared_stmt_count. The oldest recycled statement is destroyed
+    when the bin is full.
+
+    The caller is responsible for checking that the statement is safe
+    to reuse; see Prepared_statement::is_recyclable().
+  */
+  void stash_for_reuse(Prepared_statement *statement);
+
+  /**
+    Find and remove a recycled statement that was prepared from the given
+    query text under session state matching the current one. The statement
+    is not re-inserted into the map; the caller must do that.
+
+    @return the statement, or nullptr if no recycled statement matches.
+  */
+  Prepared_statement *claim_recycled(THD *thd, const char *query,
+                                     size_t length);
+
   void claim_memory_ownership();
 
   void reset();
@@ -391,6 +415,11 @@ class Prepared_statement_map {
   malloc_unordered_map<ulong, std::unique_ptr<Prepared_statement>> st_hash;
   collation_unordered_map<std::string, Prepared_statement *> names_hash;
   Prepared_statement *m_last_found_statement;
+  /**
+    Closed statements kept around for reuse by an identical re-prepare,
+    oldest first. Not part of st_hash and not visible to the client.
+  */
+  std::vector<std::unique_ptr<Prepared_statement>> m_recycle_bin;
 };
 
 /**
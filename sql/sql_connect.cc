@@ -777,9 +777,16 @@ static void prepare_new_connection_state(THD *thd) {
     enum enum_compression_algorithm algorithm = get_compression_algorithm(
         thd->get_protocol()->get_compression_algorithm());
     NET_SERVER *server_extn = static_cast<NET_SERVER *>(net->extension);
-    if (server_extn != nullptr)
+    if (server_extn != nullptr) {
       mysql_compress_context_init(&server_extn->compress_ctx, algorithm,
                                   thd->get_protocol()->get_compression_level());
+      /*
+        The server is the sending end of the streamed direction; packets
+        received from the client stay in per-packet zstd frames.
+      */
+      if (algorithm == enum_compression_algorithm::MYSQL_ZSTD_STREAM)
+        server_extn->compress_ctx.u.zstd_ctx.stream_compress = true;
+    }
     if (net->extension == nullptr) {
       LEX_CSTRING sctx_user = sctx->user();
       Host_errors errors;
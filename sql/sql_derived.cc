@@ -601,6 +601,26 @@ bool TABLE_LIST::setup_materialized_derived_tmp_table(THD *thd)
       return true; /* purecov: inspected */
   }
 
+  /*
+    The materialized table stores all columns of the derived table, but the
+    query using it rarely reads all of them. Give the table a private read
+    set, cleared here and filled in as references to its columns are
+    resolved, so that access paths over the materialized rows can skip
+    converting the columns the query never looks at. The set must remain
+    complete when rows are read back for hash-based deduplication
+    (check_unique_constraint() compares whole rows), and a common table
+    expression can be read through several references with different
+    column usage; both keep the default all-columns set.
+  */
+  if (m_common_table_expr == nullptr && table->hash_field == nullptr) {
+    uint fields = table->s->fields;
+    my_bitmap_map *bitmap_buf = static_cast<my_bitmap_map *>(
+        table->mem_root.Alloc(bitmap_buffer_size(fields)));
+    if (bitmap_buf == nullptr) return true; /* purecov: inspected */
+    bitmap_init(&table->def_read_set, bitmap_buf, fields);
+    table->default_column_bitmaps();
+  }
+
   // Make table's name same as the underlying materialized table
   set_name_temporary();
 
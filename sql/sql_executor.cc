@@ -755,16 +755,19 @@ bool set_record_buffer(const QEP_TAB *tab) {
 
   /*
     If this is the outer table of a join and there is a limit defined
-    on the query block, adjust the buffer size accordingly.
+    on the query block, adjust the buffer size accordingly. The outer
+    table is the first non-const one; const tables are read before the
+    join and don't get a record buffer.
   */
   const JOIN *const join = tab->join();
-  if (tab->idx() == 0 && join->m_select_limit != HA_POS_ERROR) {
+  if (tab == join->qep_tab + join->const_tables &&
+      join->m_select_limit != HA_POS_ERROR) {
     /*
       Estimated number of rows returned by the join per qualifying row
       in the outer table.
     */
     double fanout = 1.0;
-    for (uint i = 1; i < join->primary_tables; i++) {
+    for (uint i = tab->idx() + 1; i < join->primary_tables; i++) {
       const auto p = join->qep_tab[i].position();
       fanout *= p->rows_fetched * p->filter_effect;
     }
@@ -2526,6 +2529,48 @@ static unique_ptr_destroy_only<RowIterator> ConnectJoins(
             move(subtree_iterator), join_conditions, thd,
             conditions_depend_on_outer_tables);
 
+        // If the inner side of this semijoin is a single table driven by an
+        // index lookup, and everything it computes is a function of the
+        // lookup key, remember the verdict per key so that outer rows
+        // repeating a key do not dive into the index (and re-run any
+        // filters) again. This bounds the cost of FirstMatch plans when the
+        // outer side turns out to be much larger, or much more duplicated,
+        // than the optimizer estimated.
+        if (join_type == JoinType::SEMI && i + 1 == substructure_end &&
+            (qep_tab->type() == JT_REF || qep_tab->type() == JT_EQ_REF) &&
+            qep_tab->ref().key_parts > 0 && !qep_tab->ref().disable_cache &&
+            !qep_tab->rematerialize &&
+            !qep_tab->table()->file->member_of_pushed_join() &&
+            (conditions_depend_on_outer_tables_subtree &
+             ~qep_tab->table_ref->map()) == 0) {
+          bool cacheable = true;
+          for (uint part = 0; part < qep_tab->ref().key_parts; ++part) {
+            Item *item = qep_tab->ref().items[part];
+            if ((item->used_tables() & RAND_TABLE_BIT) != 0 ||
+                item->is_expensive()) {
+              cacheable = false;
+            }
+          }
+          // Join conditions attached above, and conditions pushed down to
+          // the index, may refer to outer fields that are not part of the
+          // lookup key, making the verdict depend on more than the key.
+          for (const Item *cond : join_conditions) {
+            if ((cond->used_tables() & ~qep_tab->table_ref->map()) != 0) {
+              cacheable = false;
+            }
+          }
+          const Item *idx_cond = qep_tab->table()->file->pushed_idx_cond;
+          if (idx_cond != nullptr &&
+              (idx_cond->used_tables() & ~qep_tab->table_ref->map()) != 0) {
+            cacheable = false;
+          }
+          if (cacheable) {
+            subtree_iterator = NewIterator<SemiJoinResultCacheIterator>(
+                thd, move(subtree_iterator), qep_tab->table(), &qep_tab->ref(),
+                &qep_tab->rowid_status, thd->variables.join_buff_size);
+          }
+        }
+
         iterator = NewIterator<NestedLoopIterator>(thd, move(iterator),
                                                    move(subtree_iterator),
                                                    join_type, pfs_batch_mode);
@@ -3063,9 +3108,19 @@ unique_ptr_destroy_only<RowIterator> JOIN::create_root_iterator_for_join() {
             /*rematerialize=*/true, tmp_table_param.end_write_records);
       }
     } else if (qep_tab->op_type == QEP_TAB::OT_AGGREGATE_INTO_TMP_TABLE) {
+      // Tell the iterator which tables the input rows live in, so that it can
+      // spill them to chunk files if the temporary table overflows main
+      // memory. If the input is the join output, the rows lie in the record
+      // buffers of the non-const primary tables; otherwise, they come out of
+      // the previous temporary table.
+      const qep_tab_map input_map =
+          table_idx == primary_tables
+              ? TablesBetween(const_tables, primary_tables)
+              : TablesBetween(table_idx - 1, table_idx);
       iterator = NewIterator<TemptableAggregateIterator>(
           thd, move(iterator), qep_tab->tmp_table_param, qep_tab->table(),
-          move(qep_tab->iterator), select_lex, this, qep_tab->ref_item_slice);
+          move(qep_tab->iterator), select_lex, this, qep_tab->ref_item_slice,
+          input_map, qep_tab);
       if (qep_tab->having != nullptr) {
         iterator =
             NewIterator<FilterIterator>(thd, move(iterator), qep_tab->having);
@@ -4614,7 +4669,7 @@ finish:
   been called.
 */
 
-static ulonglong unique_hash_group(ORDER *group) {
+ulonglong unique_hash_group(ORDER *group) {
   DBUG_TRACE;
   ulonglong crc = 0;
 
@@ -4808,9 +4863,13 @@ static bool buffer_record_somewhere(THD *thd, Window *w, int64 rowno) {
         w->m_frame_buffer_positions[first_in_partition].m_position,
         t->file->ref_length, w->frame_buffer_partition_offset());
 
+    if (!is_duplicate) w->save_frame_row_to_cache(rowno, record);
+
     return is_duplicate ? true : false;
   }
 
+  w->save_frame_row_to_cache(rowno, record);
+
   /* Save position in frame buffer file of first row in a partition */
   if (rowno == 1) {
     if (w->m_frame_buffer_positions.empty()) {
@@ -4831,12 +4890,21 @@ static bool buffer_record_somewhere(THD *thd, Window *w, int64 rowno) {
         return true;
     }
 
-    // Do a read to establish scan position, then get it
-    error = t->file->ha_rnd_next(record);
-    t->file->position(record);
-    std::memcpy(w->m_frame_buffer_positions[first_in_partition].m_position,
-                t->file->ref, t->file->ref_length);
-    w->m_frame_buffer_positions[first_in_partition].m_rowno = 1;
+    if (!w->frame_row_cache_active()) {
+      /*
+        Do a read to establish scan position, then get it. This relies on
+        the read cursor being left on the previous partition's last row by
+        the reads which processed that partition. With the frame row cache
+        active, those reads never touch the file, so the read below would
+        not land on the just-written row; the position hints are neither
+        maintained nor used in that case, cf. read_frame_buffer_row_no_hints.
+      */
+      error = t->file->ha_rnd_next(record);
+      t->file->position(record);
+      std::memcpy(w->m_frame_buffer_positions[first_in_partition].m_position,
+                  t->file->ref, t->file->ref_length);
+      w->m_frame_buffer_positions[first_in_partition].m_rowno = 1;
+    }
     w->set_frame_buffer_partition_offset(w->frame_buffer_total_rows());
   }
 
@@ -4977,6 +5045,43 @@ static bool read_frame_buffer_row(int64 rowno, Window *w,
   return false;
 }
 
+/**
+  Read row rowno (1-based, relative to start of partition) from the frame
+  buffer tmp file by rewinding the scan and skipping forward to the row,
+  without consulting the file position hints.
+
+  Used when the window's frame row cache is active: the cache then serves
+  all reads a bounded ROWS frame performs, so the position hints are not
+  maintained, and the rare read the cache cannot serve must not rely on
+  them. Such reads are not expected on any hot path, so the linear skip is
+  acceptable.
+*/
+static bool read_frame_buffer_row_no_hints(int64 rowno, Window *w) {
+  TABLE *t = w->frame_buffer();
+
+  int error = t->file->ha_rnd_end();
+  if (error == 0) error = t->file->ha_rnd_init(true);
+  if (error != 0) {
+    t->file->print_error(error, MYF(0));
+    return true;
+  }
+
+  /*
+    The frame buffer file is not truncated between partitions, so skip the
+    earlier partitions' rows as well, cf. Window::m_frame_buffer_partition_offset.
+  */
+  const int64 count = w->frame_buffer_partition_offset() - 1 + rowno;
+  for (int64 i = 0; i < count; i++) {
+    error = t->file->ha_rnd_next(t->record[0]);
+    if (error != 0) {
+      t->file->print_error(error, MYF(0));
+      return true;
+    }
+  }
+
+  return false;
+}
+
 #if !defined(DBUG_OFF)
 inline static void dbug_allow_write_all_columns(
     Temp_table_param *param, std::map<TABLE *, my_bitmap_map *> &map) {
@@ -5061,19 +5166,34 @@ bool bring_back_frame_row(THD *thd, Window *w, Temp_table_param *out_param,
     DBUG_ASSERT(reason != Window_retrieve_cached_row_reason::WONT_UPDATE_HINT);
     do_fetch = w->row_has_fields_in_out_table() != rowno;
 
-    if (do_fetch &&
-        read_frame_buffer_row(
-            rowno, w,
-            reason == Window_retrieve_cached_row_reason::MISC_POSITIONS))
-      return true;
+    /*
+      The frame row cache, when set up for this window, holds all rows the
+      frame can read, so going to the frame buffer file is the exception.
+    */
+    const bool from_cache =
+        do_fetch && w->restore_frame_row_from_cache(rowno, fb_rec);
+
+    if (do_fetch && !from_cache) {
+      if (w->frame_row_cache_active()
+              ? read_frame_buffer_row_no_hints(rowno, w)
+              : read_frame_buffer_row(
+                    rowno, w,
+                    reason ==
+                        Window_retrieve_cached_row_reason::MISC_POSITIONS))
+        return true;
+    }
 
-    /* Got row rowno in record[0], remember position */
-    const TABLE *const t = w->frame_buffer();
-    t->file->position(fb_rec);
-    std::memcpy(
-        w->m_frame_buffer_positions[static_cast<int>(reason) + fno].m_position,
-        t->file->ref, t->file->ref_length);
-    w->m_frame_buffer_positions[static_cast<int>(reason) + fno].m_rowno = rowno;
+    if (!w->frame_row_cache_active()) {
+      /* Got row rowno in record[0], remember position */
+      const TABLE *const t = w->frame_buffer();
+      t->file->position(fb_rec);
+      std::memcpy(
+          w->m_frame_buffer_positions[static_cast<int>(reason) + fno]
+              .m_position,
+          t->file->ref, t->file->ref_length);
+      w->m_frame_buffer_positions[static_cast<int>(reason) + fno].m_rowno =
+          rowno;
+    }
   }
 
   if (!do_fetch) return false;
@@ -1370,6 +1370,13 @@ static int lex_one_token(Lexer_yystype *yylval, THD *thd) {
               lip->skip_binary(l - 1);
           }
           while (ident_map[c = lip->yyGet()]) {
+            /*
+              Bytes below 0x80 are single-byte characters in all supported
+              parser character sets (they must have mbminlen == 1, see
+              is_supported_parser_charset()), so the character-length
+              dispatch below can be skipped for plain ASCII runs.
+            */
+            if (c < 0x80) continue;
             switch (my_mbcharlen(cs, c)) {
               case 1:
                 break;
@@ -1518,6 +1525,8 @@ static int lex_one_token(Lexer_yystype *yylval, THD *thd) {
         if (use_mb(cs)) {
           result_state = IDENT_QUOTED;
           while (ident_map[c = lip->yyGet()]) {
+            /* ASCII bytes are single-byte characters, see MY_LEX_IDENT. */
+            if (c < 0x80) continue;
             switch (my_mbcharlen(cs, c)) {
               case 1:
                 break;
@@ -2000,6 +2000,12 @@ class SELECT_LEX {
                                      SELECT_LEX_UNIT *subs_unit,
                                      Item_subselect *subq, bool use_inner_join,
                                      Item *join_condition);
+  bool decorrelate_derived_scalar_subquery(THD *thd,
+                                           Item_singlerow_subselect *subq,
+                                           bool *eligible);
+  bool attach_decorrelated_derived_join_cond(THD *thd,
+                                             TABLE_LIST *derived_table,
+                                             Item_singlerow_subselect *subq);
   bool transform_table_subquery_to_join_with_derived(
       THD *thd, Item_exists_subselect *subq_pred);
   void remap_tables(THD *thd);
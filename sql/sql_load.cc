@@ -1445,6 +1445,38 @@ inline bool READ_INFO::terminator(const uchar *ptr, size_t length) {
   return false;
 }
 
+/**
+  Length of the prefix of [p, p+len) that consists only of ordinary data
+  bytes, i.e. bytes that the state machine in read_field() would copy
+  verbatim. Escape, terminator and enclosure bytes stop the run, as does
+  any non-ASCII byte when the character set is multi-byte (those have to
+  go through GET_MBCHARLEN). memchr() is typically SIMD-accelerated by
+  the C library, so this is where the bulk of an ordinary file is
+  scanned.
+*/
+static size_t clean_run_length(const uchar *p, size_t len, int escape_chr,
+                               int line_term_chr, int field_term_chr,
+                               int enclosed_chr, bool check_mb) {
+  const uchar *stop = p + len;
+  const auto clamp = [p, &stop](int chr) {
+    const uchar *hit;
+    if (chr >= 0 && chr <= 255 &&
+        (hit = static_cast<const uchar *>(
+             memchr(p, chr, stop - p))) != nullptr)
+      stop = hit;
+  };
+  clamp(escape_chr);
+  clamp(line_term_chr);
+  clamp(field_term_chr);
+  clamp(enclosed_chr);
+  if (check_mb) {
+    const uchar *q = p;
+    while (q < stop && *q < 0x80) ++q;
+    stop = q;
+  }
+  return stop - p;
+}
+
 /**
   @returns true if error. If READ_INFO::error is true, then error is fatal (OOM
            or charset error). Otherwise see READ_INFO::found_end_of_line for
@@ -1479,6 +1511,26 @@ bool READ_INFO::read_field() {
   for (;;) {
     bool escaped_mb = false;
     while (to < end_of_buff) {
+      /*
+        Fast path: copy the run of ordinary data bytes straight from the
+        IO_CACHE buffer instead of pulling them one at a time through
+        GET. Only possible when no characters have been pushed back; the
+        first special byte (or the end of the cached data) drops us back
+        into the one-byte state machine below.
+      */
+      if (stack_pos == stack && cache.read_pos < cache.read_end) {
+        size_t run = min<size_t>(cache.read_end - cache.read_pos,
+                                 end_of_buff - to);
+        run = clean_run_length(cache.read_pos, run, escape_char,
+                               line_term_char, field_term_char,
+                               found_enclosed_char, use_mb(read_charset));
+        if (run > 0) {
+          memcpy(to, cache.read_pos, run);
+          to += run;
+          cache.read_pos += run;
+          continue;
+        }
+      }
       chr = GET;
       if (chr == my_b_EOF) goto found_eof;
       if (chr == escape_char) {
@@ -79,6 +79,7 @@
 #include "sql/opt_costmodel.h"
 #include "sql/opt_explain.h"  // join_type_str
 #include "sql/opt_hints.h"    // hint_table_state
+#include "sql/opt_outline.h"  // opt_outline_apply
 #include "sql/opt_range.h"    // QUICK_SELECT_I
 #include "sql/opt_trace.h"    // Opt_trace_object
 #include "sql/opt_trace_context.h"
@@ -226,6 +227,237 @@ bool JOIN::alloc_indirection_slices() {
   return false;
 }
 
+/**
+  Try to push a copy of one conjunct of the enclosing query block's WHERE
+  clause down into the (derived table) query block that is currently being
+  optimized.
+
+  Only comparisons between a column of the derived table and a value that
+  is constant during execution are considered. The original predicate is
+  always kept in the enclosing query block, so a pushed copy only has to
+  guarantee that it never removes a row the enclosing predicate would
+  keep; removing no rows at all (e.g. because the copy was pushed into
+  only some members of a UNION) is always correct. To ensure that the
+  copied comparison has the same semantics as the original, it is only
+  pushed when the underlying select list expression has the same result
+  type and collation as the column of the derived table.
+
+  @param thd      session context
+  @param join     join object of the derived table's query block
+  @param derived  the table reference the query block is materialized for
+  @param pred     one conjunct of the enclosing query block's WHERE clause
+
+  @returns false if success, true if error
+*/
+static bool push_outer_conjunct_into_derived(THD *thd, JOIN *join,
+                                             TABLE_LIST *derived, Item *pred) {
+  if (pred->type() != Item::FUNC_ITEM) return false;
+
+  Item_func *const func = down_cast<Item_func *>(pred);
+  switch (func->functype()) {
+    case Item_func::EQ_FUNC:
+    case Item_func::NE_FUNC:
+    case Item_func::LT_FUNC:
+    case Item_func::LE_FUNC:
+    case Item_func::GE_FUNC:
+    case Item_func::GT_FUNC:
+      break;
+    default:
+      return false;
+  }
+
+  /*
+    One argument must be a column of the derived table, the other one a
+    value that is fixed during execution. Deterministic functions of
+    literals and dynamic parameters qualify; subqueries are excluded
+    because evaluating them again per member query block could be more
+    expensive than the filtering saves.
+  */
+  Item *const left = func->arguments()[0]->real_item();
+  Item *const right = func->arguments()[1]->real_item();
+
+  Item_field *column = nullptr;
+  Item *value = nullptr;
+  if (left->type() == Item::FIELD_ITEM &&
+      down_cast<Item_field *>(left)->table_ref == derived) {
+    column = down_cast<Item_field *>(left);
+    value = right;
+  } else if (right->type() == Item::FIELD_ITEM &&
+             down_cast<Item_field *>(right)->table_ref == derived) {
+    column = down_cast<Item_field *>(right);
+    value = left;
+  } else {
+    return false;
+  }
+  if (!value->const_for_execution() || value->has_subquery() ||
+      value->is_expensive())
+    return false;
+
+  // Map the column to the select list expression of this query block.
+  const uint column_index = column->field->field_index();
+  List<Item> *const fields = join->select_lex->get_fields_list();
+  if (column_index >= fields->elements) return false;
+  Item *expr = nullptr;
+  {
+    List_iterator<Item> it(*fields);
+    for (uint i = 0; i <= column_index; i++) expr = it++;
+  }
+
+  if (expr->has_aggregation() || expr->has_wf() || expr->has_subquery() ||
+      expr->is_expensive() ||
+      (expr->used_tables() & (OUTER_REF_TABLE_BIT | RAND_TABLE_BIT)) != 0)
+    return false;
+
+  // The pushed comparison must evaluate like the one on the column.
+  if (expr->result_type() != column->result_type()) return false;
+  if (expr->result_type() == STRING_RESULT &&
+      expr->collation.collation != column->collation.collation)
+    return false;
+
+  /*
+    With grouping, a row of the derived table summarizes a group of rows
+    of this query block, so a filter may only be pushed below the
+    grouping when it applies uniformly to all rows of a group, i.e. when
+    the expression is one of the grouping columns. Implicit grouping
+    produces one row from all rows and nothing can be pushed.
+  */
+  if (join->select_lex->is_implicitly_grouped()) return false;
+  if (join->select_lex->is_explicitly_grouped()) {
+    bool found = false;
+    for (ORDER *group = join->select_lex->group_list.first; group != nullptr;
+         group = group->next) {
+      if ((*group->item)->real_item()->eq(expr->real_item(), false)) {
+        found = true;
+        break;
+      }
+    }
+    if (!found) return false;
+  }
+
+  /*
+    Similarly, window function results may only be computed over complete
+    partitions, so the filter must remove whole partitions: the expression
+    must be among the PARTITION BY columns of every window. A window
+    without PARTITION BY has a single partition covering all rows.
+  */
+  List_iterator<Window> wit(join->select_lex->m_windows);
+  for (Window *window = wit++; window != nullptr; window = wit++) {
+    bool found = false;
+    for (ORDER *part = window->first_partition_by(); part != nullptr;
+         part = part->next) {
+      if ((*part->item)->real_item()->eq(expr->real_item(), false)) {
+        found = true;
+        break;
+      }
+    }
+    if (!found) return false;
+  }
+
+  // Clone the comparison, with the arguments in their original order.
+  Item *const first = (value == right) ? expr : value;
+  Item *const second = (value == right) ? value : expr;
+  Item *cond;
+  switch (func->functype()) {
+    case Item_func::EQ_FUNC:
+      cond = new Item_func_eq(first, second);
+      break;
+    case Item_func::NE_FUNC:
+      cond = new Item_func_ne(first, second);
+      break;
+    case Item_func::LT_FUNC:
+      cond = new Item_func_lt(first, second);
+      break;
+    case Item_func::LE_FUNC:
+      cond = new Item_func_le(first, second);
+      break;
+    case Item_func::GE_FUNC:
+      cond = new Item_func_ge(first, second);
+      break;
+    default:
+      cond = new Item_func_gt(first, second);
+      break;
+  }
+  if (cond == nullptr) return true; /* purecov: inspected */
+  if (cond->fix_fields(thd, &cond)) return true;
+
+  Opt_trace_object(&thd->opt_trace)
+      .add("condition_pushed_into_derived_table", cond);
+
+  join->where_cond = and_conds(join->where_cond, cond);
+  if (join->where_cond == nullptr) return true; /* purecov: inspected */
+  if (!join->where_cond->fixed &&
+      join->where_cond->fix_fields(thd, &join->where_cond))
+    return true;
+
+  return false;
+}
+
+/**
+  If the query block being optimized is a member of a materialized derived
+  table's query expression, add copies of those conjuncts of the enclosing
+  query block's WHERE clause that can be evaluated inside this member, so
+  that rows are filtered out before they are written to the materialized
+  temporary table. See push_outer_conjunct_into_derived() for which
+  conjuncts qualify.
+
+  Working on the members from within their own optimization keeps prepared
+  statements safe: only the per-execution JOIN::where_cond is extended,
+  never the permanent condition of the query block, and each member of a
+  UNION is handled independently so the pushdown also applies past UNION
+  and past window functions.
+
+  Common table expressions are excluded since their materialized result
+  may be shared by several references with different enclosing conditions.
+  Query blocks or query expressions with LIMIT must not lose rows before
+  the limit is applied, and for ROLLUP the restrictions on grouping above
+  do not cover the super-aggregate rows.
+
+  @param thd   session context
+  @param join  join object of the derived table's query block
+
+  @returns false if success, true if error
+*/
+static bool push_outer_conditions_into_derived(THD *thd, JOIN *join) {
+  SELECT_LEX_UNIT *const unit = join->unit;
+  TABLE_LIST *const derived = unit->derived_table;
+
+  if (derived == nullptr ||                         // not a derived table
+      join->select_lex == unit->fake_select_lex ||  // the UNION result block
+      !derived->uses_materialization() ||           // merged: nothing to push
+      derived->common_table_expr() != nullptr ||    // shared materialization
+      unit->global_parameters()->has_limit() ||     // LIMIT on the union
+      join->select_lex->has_limit() ||              // LIMIT on this member
+      join->select_lex->olap != UNSPECIFIED_OLAP_TYPE)  // ROLLUP
+    return false;
+
+  /*
+    The enclosing query block is already past condition determination when
+    it optimizes its derived tables; otherwise (e.g. when the derived
+    table is resolved directly from open_tables_for_query()) fall back to
+    its permanent WHERE condition.
+  */
+  SELECT_LEX *const outer = unit->outer_select();
+  if (outer == nullptr) return false;
+  Item *const outer_cond =
+      (outer->join != nullptr && outer->join->is_optimized())
+          ? outer->join->where_cond
+          : outer->where_cond();
+  if (outer_cond == nullptr) return false;
+
+  if (outer_cond->type() == Item::COND_ITEM &&
+      down_cast<Item_cond *>(outer_cond)->functype() ==
+          Item_func::COND_AND_FUNC) {
+    List_iterator<Item> li(
+        *down_cast<Item_cond *>(outer_cond)->argument_list());
+    for (Item *pred = li++; pred != nullptr; pred = li++) {
+      if (push_outer_conjunct_into_derived(thd, join, derived, pred))
+        return true;
+    }
+    return false;
+  }
+  return push_outer_conjunct_into_derived(thd, join, derived, outer_cond);
+}
+
 /**
   Optimizes one query block into a query execution plan (QEP.)
 
@@ -314,6 +546,8 @@ bool JOIN::optimize() {
   if (select_lex->get_optimizable_conditions(thd, &where_cond, &having_cond))
     return true;
 
+  if (push_outer_conditions_into_derived(thd, this)) return true;
+
   set_optimized();
 
   tables_list = select_lex->leaf_tables;
@@ -500,6 +734,10 @@ bool JOIN::optimize() {
   // Ensure there are no errors prior making query plan
   if (thd->is_error()) return true;
 
+  // Possibly enforce a previously captured plan outline, cf.
+  // @@optimizer_use_plan_outlines.
+  opt_outline_apply(thd, this);
+
   // Set up join order and initial access paths
   THD_STAGE_INFO(thd, stage_statistics);
   if (make_join_plan()) {
@@ -849,6 +1087,14 @@ bool JOIN::optimize() {
   // Make plan visible for EXPLAIN
   set_plan_state(PLAN_READY);
 
+  // Possibly record a compact sample of the chosen plan, cf.
+  // @@optimizer_trace_sample_rate.
+  opt_trace_sample_plan(thd, this);
+
+  // Possibly capture the chosen plan as an outline, cf.
+  // @@optimizer_capture_plan_outlines.
+  opt_outline_capture_plan(thd, this);
+
   DEBUG_SYNC(thd, "after_join_optimize");
 
   error = 0;
@@ -1209,6 +1209,12 @@ bool do_command(THD *thd) {
   my_net_set_read_timeout(net, thd->variables.net_wait_timeout);
   net_new_transaction(net);
 
+  /*
+    Send out responses that were deferred while the client was
+    pipelining commands, unless yet another command is already waiting.
+  */
+  thd->get_protocol_classic()->flush_deferred_output();
+
   /*
     Synchronization point for testing of KILL_CONNECTION.
     This sync point can wait here, to simulate slow code execution
@@ -2008,8 +2014,14 @@ bool dispatch_command(THD *thd, const COM_DATA *com_data,
       query_logger.general_log_print(thd, command, NullS);
       // Don't give 'abort' message
       // TODO: access of protocol_classic should be removed
-      if (thd->is_classic_protocol())
+      if (thd->is_classic_protocol()) {
+        /*
+          Responses deferred because the client pipelined commands up
+          to and including this COM_QUIT must still reach it.
+        */
+        thd->get_protocol_classic()->flush();
         thd->get_protocol_classic()->get_net()->error = 0;
+      }
       thd->get_stmt_da()->disable_status();  // Don't send anything back
       error = true;                          // End server
       break;
@@ -299,6 +299,7 @@
 #include <new>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "sql/srv_session.h"  // Srv_session::check_for_stale_threads()
 
@@ -486,6 +487,9 @@ static void restore_pluginvar_names(sys_var *first);
 static plugin_ref intern_plugin_lock(LEX *lex, plugin_ref plugin);
 static void intern_plugin_unlock(LEX *lex, plugin_ref plugin);
 static void reap_plugins(void);
+static void release_global_variables_snapshot();
+static bool thdvar_seed_dynamic_from_snapshot(THD *thd);
+static void thdvar_refresh_dynamic_snapshot();
 
 // mysql.plugin table definition.
 static const int MYSQL_PLUGIN_TABLE_FIELD_COUNT = 2;
@@ -2047,6 +2051,7 @@ void plugin_shutdown(void) {
         */
         unlock_variables(&global_system_variables);
         unlock_variables(&max_system_variables);
+        release_global_variables_snapshot();
       }
     }
 
@@ -2100,6 +2105,7 @@ void plugin_shutdown(void) {
       Now we can deallocate all memory.
     */
 
+    release_global_variables_snapshot();
     cleanup_variables(nullptr, &global_system_variables);
     cleanup_variables(nullptr, &max_system_variables);
     mysql_mutex_unlock(&LOCK_plugin);
@@ -2928,6 +2934,28 @@ static void restore_pluginvar_names(sys_var *first) {
                           variables copy.
 */
 void alloc_and_copy_thd_dynamic_variables(THD *thd, bool global_lock) {
+  /*
+    Fast path for fresh sessions: copy the defaults from the deep copy
+    kept next to the global variables snapshot, under its read lock, so
+    that concurrent connects do not serialize on
+    LOCK_global_system_variables. Only taken when the caller does not
+    already hold LOCK_global_system_variables, to keep the lock order
+    snapshot -> hash -> global, and only for sessions without a dynamic
+    variables array yet; resyncing an existing array is incremental and
+    stays on the slow path below.
+  */
+  if (global_lock && thd->variables.dynamic_variables_ptr == nullptr) {
+    if (thdvar_seed_dynamic_from_snapshot(thd)) return;
+
+    /* The snapshot is stale: refresh it, then retry seeding. */
+    mysql_rwlock_wrlock(&LOCK_global_variables_snapshot);
+    thdvar_refresh_dynamic_snapshot();
+    mysql_rwlock_unlock(&LOCK_global_variables_snapshot);
+    if (thdvar_seed_dynamic_from_snapshot(thd)) return;
+
+    /* A global change raced with the refresh; fall through. */
+  }
+
   mysql_rwlock_rdlock(&LOCK_system_variables_hash);
 
   if (global_lock) mysql_mutex_lock(&LOCK_global_system_variables);
@@ -3031,17 +3059,210 @@ static double *mysql_sys_var_double(THD *thd, int offset) {
   return (double *)intern_sys_var_ptr(thd, offset, true);
 }
 
-void plugin_thdvar_init(THD *thd, bool enable_plugins) {
-  plugin_ref old_table_plugin = thd->variables.table_plugin;
-  plugin_ref old_temp_table_plugin = thd->variables.temp_table_plugin;
-  DBUG_TRACE;
+/**
+  Snapshot of global_system_variables used to seed THD::variables of
+  new sessions, see plugin_thdvar_init().
+
+  Copying the global variables used to serialize every new session on
+  LOCK_global_system_variables, which is measurable during reconnect
+  storms. The snapshot is copied under LOCK_global_variables_snapshot
+  taken in read mode, so concurrent sessions initialize in parallel;
+  it is refreshed only when a global system variable has changed since
+  it was taken, detected through global_system_variables_generation.
+
+  The snapshot owns references to its table_plugin/temp_table_plugin
+  and a copy of the session_track_system_variables string, so its
+  contents stay valid independently of later SET GLOBAL statements
+  until the next refresh, which cannot happen while a reader holds the
+  lock.
+*/
+static struct System_variables global_variables_snapshot;
+static std::string global_variables_snapshot_track_sysvars;
+static ulonglong global_variables_snapshot_generation = 0;
 
-  thd->variables.table_plugin = nullptr;
-  thd->variables.temp_table_plugin = nullptr;
-  cleanup_variables(thd, &thd->variables);
+/**
+  Release the plugin references held by the seeding snapshot; called
+  during plugin shutdown with LOCK_plugin held.
+*/
+/**
+  Deep copy of the dynamic (plugin) session variable defaults, used to
+  seed the per-session dynamic variables array of new connections, see
+  alloc_and_copy_thd_dynamic_variables(). Guarded by
+  LOCK_global_variables_snapshot, like global_variables_snapshot.
+
+  The values of string variables with PLUGIN_VAR_MEMALLOC are owned
+  copies listed in global_variables_snapshot_dynamic_strings, so a
+  concurrent SET GLOBAL freeing the global value cannot invalidate a
+  seeding session; such a SET bumps the generation and the next refresh
+  replaces the copies. The version is compared against
+  dynamic_variables_version so that installing a plugin (which extends
+  the array without going through sys_var::update) also invalidates the
+  copy.
+*/
+static char *global_variables_snapshot_dynamic_ptr = nullptr;
+static std::vector<char *> global_variables_snapshot_dynamic_strings;
+static ulonglong global_variables_snapshot_dynamic_generation = 0;
+static ulong global_variables_snapshot_dynamic_version = 0;
+static uint global_variables_snapshot_dynamic_size = 0;
+static uint global_variables_snapshot_dynamic_head = 0;
+
+static void release_global_variables_snapshot() {
+  unlock_variables(&global_variables_snapshot);
+
+  for (char *str : global_variables_snapshot_dynamic_strings) my_free(str);
+  global_variables_snapshot_dynamic_strings.clear();
+  my_free(global_variables_snapshot_dynamic_ptr);
+  global_variables_snapshot_dynamic_ptr = nullptr;
+  global_variables_snapshot_dynamic_generation = 0;
+  global_variables_snapshot_dynamic_version = 0;
+  global_variables_snapshot_dynamic_size = 0;
+  global_variables_snapshot_dynamic_head = 0;
+}
+
+/**
+  Seed the session's dynamic variables array from the snapshot, if the
+  snapshot is up to date. The caller must not hold any of the system
+  variable locks.
+
+  @param thd  session to seed; must not have a dynamic variables array
 
+  @retval true   the session was seeded
+  @retval false  the snapshot is stale, the caller must fall back to
+                 copying from global_system_variables
+*/
+static bool thdvar_seed_dynamic_from_snapshot(THD *thd) {
+  bool seeded = false;
+
+  mysql_rwlock_rdlock(&LOCK_global_variables_snapshot);
+  mysql_rwlock_rdlock(&LOCK_system_variables_hash);
+
+  if (global_variables_snapshot_dynamic_ptr != nullptr &&
+      global_variables_snapshot_dynamic_generation ==
+          global_system_variables_generation.load(std::memory_order_acquire) &&
+      global_variables_snapshot_dynamic_version ==
+          global_system_variables.dynamic_variables_version) {
+    thd->variables.dynamic_variables_ptr = (char *)my_realloc(
+        key_memory_THD_variables, thd->variables.dynamic_variables_ptr,
+        global_variables_dynamic_size, MYF(MY_WME | MY_FAE | MY_ALLOW_ZERO_PTR));
+
+    memcpy(thd->variables.dynamic_variables_ptr,
+           global_variables_snapshot_dynamic_ptr,
+           global_variables_snapshot_dynamic_size);
+
+    /*
+      Duplicate vars of string type with MEMALLOC flag, like
+      alloc_and_copy_thd_dynamic_variables() does, but reading the
+      snapshot's owned copies instead of the global values.
+    */
+    for (const auto &key_and_value :
+         *malloced_string_type_sysvars_bookmark_hash) {
+      sys_var_pluginvar *pi;
+      sys_var *var;
+      int varoff;
+      char **thdvar, **snapvar;
+      st_bookmark *v = key_and_value.second;
+
+      if (!(var = intern_find_sys_var(v->key + 1, v->name_len)) ||
+          !(pi = var->cast_pluginvar()) ||
+          v->key[0] != (pi->plugin_var->flags & PLUGIN_VAR_TYPEMASK))
+        continue;
+
+      varoff = *(int *)(pi->plugin_var + 1);
+      thdvar = (char **)(thd->variables.dynamic_variables_ptr + varoff);
+      snapvar = (char **)(global_variables_snapshot_dynamic_ptr + varoff);
+      *thdvar = nullptr;
+      plugin_var_memalloc_session_update(thd, nullptr, thdvar, *snapvar);
+    }
+
+    thd->variables.dynamic_variables_version =
+        global_variables_snapshot_dynamic_version;
+    thd->variables.dynamic_variables_head =
+        global_variables_snapshot_dynamic_head;
+    thd->variables.dynamic_variables_size =
+        global_variables_snapshot_dynamic_size;
+
+    seeded = true;
+  }
+
+  mysql_rwlock_unlock(&LOCK_system_variables_hash);
+  mysql_rwlock_unlock(&LOCK_global_variables_snapshot);
+
+  return seeded;
+}
+
+/**
+  Refresh the dynamic variables snapshot from global_system_variables.
+  Requires LOCK_global_variables_snapshot in write mode; does nothing
+  if the snapshot is already up to date.
+*/
+static void thdvar_refresh_dynamic_snapshot() {
+  mysql_rwlock_rdlock(&LOCK_system_variables_hash);
   mysql_mutex_lock(&LOCK_global_system_variables);
-  thd->variables = global_system_variables;
+
+  const ulonglong generation =
+      global_system_variables_generation.load(std::memory_order_acquire);
+
+  if (global_variables_snapshot_dynamic_ptr == nullptr ||
+      global_variables_snapshot_dynamic_generation != generation ||
+      global_variables_snapshot_dynamic_version !=
+          global_system_variables.dynamic_variables_version) {
+    /* Free the string copies owned by the previous snapshot. */
+    for (char *str : global_variables_snapshot_dynamic_strings) my_free(str);
+    global_variables_snapshot_dynamic_strings.clear();
+
+    global_variables_snapshot_dynamic_ptr = (char *)my_realloc(
+        key_memory_global_system_variables,
+        global_variables_snapshot_dynamic_ptr, global_variables_dynamic_size,
+        MYF(MY_WME | MY_FAE | MY_ALLOW_ZERO_PTR));
+
+    memcpy(global_variables_snapshot_dynamic_ptr,
+           global_system_variables.dynamic_variables_ptr,
+           global_system_variables.dynamic_variables_size);
+
+    /* Take owned copies of the MEMALLOC string values. */
+    for (const auto &key_and_value :
+         *malloced_string_type_sysvars_bookmark_hash) {
+      sys_var_pluginvar *pi;
+      sys_var *var;
+      int varoff;
+      char **snapvar;
+      st_bookmark *v = key_and_value.second;
+
+      if (!(var = intern_find_sys_var(v->key + 1, v->name_len)) ||
+          !(pi = var->cast_pluginvar()) ||
+          v->key[0] != (pi->plugin_var->flags & PLUGIN_VAR_TYPEMASK))
+        continue;
+
+      varoff = *(int *)(pi->plugin_var + 1);
+      snapvar = (char **)(global_variables_snapshot_dynamic_ptr + varoff);
+      if (*snapvar != nullptr) {
+        *snapvar = my_strdup(key_memory_global_system_variables, *snapvar,
+                             MYF(MY_WME | MY_FAE));
+        global_variables_snapshot_dynamic_strings.push_back(*snapvar);
+      }
+    }
+
+    global_variables_snapshot_dynamic_version =
+        global_system_variables.dynamic_variables_version;
+    global_variables_snapshot_dynamic_size =
+        global_system_variables.dynamic_variables_size;
+    global_variables_snapshot_dynamic_head =
+        global_system_variables.dynamic_variables_head;
+    global_variables_snapshot_dynamic_generation = generation;
+  }
+
+  mysql_mutex_unlock(&LOCK_global_system_variables);
+  mysql_rwlock_unlock(&LOCK_system_variables_hash);
+}
+
+/**
+  Seed thd->variables from the snapshot. Requires
+  LOCK_global_variables_snapshot (any mode) and an up to date snapshot.
+*/
+static void thdvar_init_from_snapshot(THD *thd, bool enable_plugins,
+                                      plugin_ref old_table_plugin,
+                                      plugin_ref old_temp_table_plugin) {
+  thd->variables = global_variables_snapshot;
   thd->variables.table_plugin = nullptr;
   thd->variables.temp_table_plugin = nullptr;
 
@@ -3052,21 +3273,92 @@ void plugin_thdvar_init(THD *thd, bool enable_plugins) {
   if (enable_plugins) {
     mysql_mutex_lock(&LOCK_plugin);
     thd->variables.table_plugin =
-        my_intern_plugin_lock(nullptr, global_system_variables.table_plugin);
+        my_intern_plugin_lock(nullptr, global_variables_snapshot.table_plugin);
     intern_plugin_unlock(nullptr, old_table_plugin);
     thd->variables.temp_table_plugin = my_intern_plugin_lock(
-        nullptr, global_system_variables.temp_table_plugin);
+        nullptr, global_variables_snapshot.temp_table_plugin);
     intern_plugin_unlock(nullptr, old_temp_table_plugin);
     mysql_mutex_unlock(&LOCK_plugin);
   }
-  mysql_mutex_unlock(&LOCK_global_system_variables);
 
   /* Initialize all Sys_var_charptr variables here. */
 
-  // @@session.session_track_system_variables
+  /*
+    @@session.session_track_system_variables; duplicated before the
+    snapshot lock is released, while the snapshot string is pinned.
+  */
   thd->session_sysvar_res_mgr.init(&thd->variables.track_sysvars_ptr);
 }
 
+/**
+  Refresh the snapshot from global_system_variables. Requires
+  LOCK_global_variables_snapshot in write mode.
+*/
+static void thdvar_refresh_snapshot() {
+  mysql_mutex_lock(&LOCK_global_system_variables);
+  mysql_mutex_lock(&LOCK_plugin);
+  /* Release the references held by the previous snapshot. */
+  intern_plugin_unlock(nullptr, global_variables_snapshot.table_plugin);
+  intern_plugin_unlock(nullptr, global_variables_snapshot.temp_table_plugin);
+
+  global_variables_snapshot = global_system_variables;
+  global_variables_snapshot.table_plugin =
+      my_intern_plugin_lock(nullptr, global_system_variables.table_plugin);
+  global_variables_snapshot.temp_table_plugin =
+      my_intern_plugin_lock(nullptr, global_system_variables.temp_table_plugin);
+  mysql_mutex_unlock(&LOCK_plugin);
+
+  if (global_system_variables.track_sysvars_ptr != nullptr) {
+    global_variables_snapshot_track_sysvars =
+        global_system_variables.track_sysvars_ptr;
+    global_variables_snapshot.track_sysvars_ptr =
+        &global_variables_snapshot_track_sysvars[0];
+  }
+
+  /*
+    No global update can be in flight here, they all hold
+    LOCK_global_system_variables, so the loaded generation is exactly
+    the one the copied values belong to.
+  */
+  global_variables_snapshot_generation =
+      global_system_variables_generation.load(std::memory_order_acquire);
+  mysql_mutex_unlock(&LOCK_global_system_variables);
+}
+
+void plugin_thdvar_init(THD *thd, bool enable_plugins) {
+  plugin_ref old_table_plugin = thd->variables.table_plugin;
+  plugin_ref old_temp_table_plugin = thd->variables.temp_table_plugin;
+  DBUG_TRACE;
+
+  thd->variables.table_plugin = nullptr;
+  thd->variables.temp_table_plugin = nullptr;
+  cleanup_variables(thd, &thd->variables);
+
+  /*
+    Fast path: seed the session from the snapshot under the read lock,
+    so that concurrent session initializations run in parallel instead
+    of serializing on LOCK_global_system_variables.
+  */
+  mysql_rwlock_rdlock(&LOCK_global_variables_snapshot);
+  if (global_variables_snapshot_generation ==
+      global_system_variables_generation.load(std::memory_order_acquire)) {
+    thdvar_init_from_snapshot(thd, enable_plugins, old_table_plugin,
+                              old_temp_table_plugin);
+    mysql_rwlock_unlock(&LOCK_global_variables_snapshot);
+    return;
+  }
+  mysql_rwlock_unlock(&LOCK_global_variables_snapshot);
+
+  /* A global system variable has changed: refresh the snapshot. */
+  mysql_rwlock_wrlock(&LOCK_global_variables_snapshot);
+  if (global_variables_snapshot_generation !=
+      global_system_variables_generation.load(std::memory_order_acquire))
+    thdvar_refresh_snapshot();
+  thdvar_init_from_snapshot(thd, enable_plugins, old_table_plugin,
+                            old_temp_table_plugin);
+  mysql_rwlock_unlock(&LOCK_global_variables_snapshot);
+}
+
 /*
   Unlocks all system variables which hold a reference
 */
@@ -1450,6 +1450,32 @@ static bool init_param_array(Prepared_statement *stmt) {
   return false;
 }
 
+/**
+  Re-send the prepare-time response (statement id, parameter metadata and
+  result set metadata) for a statement that mysqld_stmt_prepare() reused
+  from the recycle bin instead of preparing from scratch. This replicates
+  what check_prepared_statement() does at the end of a regular prepare.
+*/
+
+static bool send_recycled_statement(THD *thd, Prepared_statement *stmt) {
+  LEX *lex = stmt->lex;
+  List<Item> *types = nullptr;
+  Query_result *result = nullptr;
+  uint no_columns = 0;
+
+  if ((sql_command_flags[lex->sql_command] & CF_HAS_RESULT_SET) &&
+      !lex->is_explain()) {
+    SELECT_LEX_UNIT *unit = lex->unit;
+    result = unit->query_result();
+    if (result == nullptr) result = unit->first_select()->query_result();
+    if (result == nullptr) result = lex->result;
+    types = unit->get_unit_column_types();
+    no_columns = result->field_count(*types);
+  }
+
+  return send_statement(thd, stmt, no_columns, result, types);
+}
+
 /**
   COM_STMT_PREPARE handler.
 
@@ -1497,16 +1523,51 @@ void mysqld_stmt_prepare(THD *thd, const char *query, uint length,
   const auto saved_secondary_engine = thd->secondary_engine_optimization();
   thd->set_secondary_engine_optimization(
       Secondary_engine_optimization::PRIMARY_TENTATIVELY);
-  /* Create PS table entry, set query text after rewrite. */
-  stmt->m_prepared_stmt =
-      MYSQL_CREATE_PS(stmt, stmt->id, thd->m_statement_psi, stmt->name().str,
-                      stmt->name().length, nullptr, 0);
 
-  if (stmt->prepare(query, length)) {
-    /* Delete this stmt stats from PS table. */
-    MYSQL_DESTROY_PS(stmt->m_prepared_stmt);
-    /* Statement map deletes statement on erase */
+  /*
+    A statement with identical text may have been closed earlier in this
+    session and kept for reuse; if so, hand it back instead of parsing and
+    resolving the query again. To the client this is indistinguishable
+    from a fresh prepare, and execution revalidates the statement against
+    metadata changes the same way as for a statement that was kept open.
+  */
+  Prepared_statement *recycled =
+      thd->stmt_map.claim_recycled(thd, query, length);
+  if (recycled != nullptr) {
+    /* Drop the empty statement created by mysql_stmt_precheck(). */
     thd->stmt_map.erase(stmt);
+    stmt = recycled;
+    if (thd->stmt_map.insert(stmt)) {
+      /* Error is sent and the statement deleted by insert(). */
+      stmt = nullptr;
+    } else {
+      thd->status_var.com_stmt_prepare++;
+      stmt->m_prepared_stmt =
+          MYSQL_CREATE_PS(stmt, stmt->id, thd->m_statement_psi,
+                          stmt->name().str, stmt->name().length, nullptr, 0);
+      MYSQL_SET_PS_TEXT(stmt->m_prepared_stmt, stmt->m_query_string.str,
+                        stmt->m_query_string.length);
+      if (send_recycled_statement(thd, stmt)) {
+        MYSQL_DESTROY_PS(stmt->m_prepared_stmt);
+        thd->stmt_map.erase(stmt);
+      } else if (thd->sp_runtime_ctx == nullptr) {
+        query_logger.general_log_write(thd, COM_STMT_PREPARE,
+                                       stmt->m_query_string.str,
+                                       stmt->m_query_string.length);
+      }
+    }
+  } else {
+    /* Create PS table entry, set query text after rewrite. */
+    stmt->m_prepared_stmt =
+        MYSQL_CREATE_PS(stmt, stmt->id, thd->m_statement_psi, stmt->name().str,
+                        stmt->name().length, nullptr, 0);
+
+    if (stmt->prepare(query, length)) {
+      /* Delete this stmt stats from PS table. */
+      MYSQL_DESTROY_PS(stmt->m_prepared_stmt);
+      /* Statement map deletes statement on erase */
+      thd->stmt_map.erase(stmt);
+    }
   }
 
   thd->set_secondary_engine_optimization(saved_secondary_engine);
@@ -2103,7 +2164,21 @@ void mysqld_stmt_close(THD *thd, Prepared_statement *stmt) {
   */
   DBUG_ASSERT(!stmt->is_in_use());
   MYSQL_DESTROY_PS(stmt->m_prepared_stmt);
-  stmt->deallocate();
+  if (stmt->is_recyclable()) {
+    /*
+      Keep the parsed and resolved statement around instead of destroying
+      it: connection pools commonly close and re-prepare the same small set
+      of statements on every request, and a re-prepare of identical text
+      can then skip parsing and resolution entirely.
+    */
+    stmt->m_prepared_stmt = nullptr;
+    reset_stmt_params(stmt);
+    /* We account a recycled close in the same manner as deallocate(). */
+    thd->status_var.com_stmt_close++;
+    thd->stmt_map.stash_for_reuse(stmt);
+  } else {
+    stmt->deallocate();
+  }
   query_logger.general_log_print(thd, thd->get_command(), NullS);
 }
 
@@ -2488,6 +2563,15 @@ bool Prepared_statement::prepare(const char *query_str, size_t query_length) {
 
   if (set_db(thd->db())) return true;
 
+  /*
+    Remember the session state the statement text is interpreted under, so
+    that mysqld_stmt_prepare() can tell whether a later re-prepare of the
+    same text in the same state may reuse this statement.
+  */
+  m_sql_mode_at_prepare = thd->variables.sql_mode;
+  m_character_set_client = thd->variables.character_set_client;
+  m_collation_connection = thd->variables.collation_connection;
+
   /*
     alloc_query() uses thd->memroot && thd->query, so we should call
     both of backup_statement() and backup_query_arena() here.
@@ -2508,6 +2592,14 @@ bool Prepared_statement::prepare(const char *query_str, size_t query_length) {
     token_array = (unsigned char *)thd->alloc(max_digest_length);
   }
 
+  /*
+    If a pre-parse rewrite plugin replaces the query text below, preparing
+    the same input again may yield a different statement, so the statement
+    must not be recycled on close. Detect this by remembering the text
+    alloc_query() produced.
+  */
+  const char *query_before_rewrite = thd->query().str;
+
   old_stmt_arena = thd->stmt_arena;
   thd->stmt_arena = &m_arena;
 
@@ -2649,6 +2741,7 @@ bool Prepared_statement::prepare(const char *query_str, size_t query_length) {
     lex->context_analysis_only &= ~CONTEXT_ANALYSIS_ONLY_PREPARE;
     m_arena.set_state(Query_arena::STMT_PREPARED);
     flags &= ~(uint)IS_IN_USE;
+    m_reusable_on_reprepare = (m_query_string.str == query_before_rewrite);
 
     /*
       Log COM_STMT_PREPARE to the general log. Note, that in case of SQL
@@ -2700,6 +2793,45 @@ bool Prepared_statement::prepare(const char *query_str, size_t query_length) {
   return error;
 }
 
+bool Prepared_statement::is_recyclable() const {
+  return m_reusable_on_reprepare && !is_in_use() && !is_sql_prepare() &&
+         m_name.str == nullptr && cursor == nullptr &&
+         (m_arena.get_state() == Query_arena::STMT_PREPARED ||
+          m_arena.get_state() == Query_arena::STMT_EXECUTED);
+}
+
+bool Prepared_statement::is_reusable_for(THD *thd_arg, const char *query_str,
+                                         size_t query_length) const {
+  // Trim the incoming text the way alloc_query() would before comparing it
+  // with the stored (trimmed) statement text.
+  while (query_length > 0 && my_isspace(thd_arg->charset(), query_str[0])) {
+    query_str++;
+    query_length--;
+  }
+  while (query_length > 0 && (query_str[query_length - 1] == ';' ||
+                              query_str[query_length - 1] == '\0' ||
+                              my_isspace(thd_arg->charset(),
+                                         query_str[query_length - 1]))) {
+    query_length--;
+  }
+  if (query_length != m_query_string.length ||
+      memcmp(query_str, m_query_string.str, query_length) != 0)
+    return false;
+
+  // The same text must still parse and resolve the same way.
+  if (m_sql_mode_at_prepare != thd_arg->variables.sql_mode ||
+      m_character_set_client != thd_arg->variables.character_set_client ||
+      m_collation_connection != thd_arg->variables.collation_connection)
+    return false;
+
+  const LEX_CSTRING &db = thd_arg->db();
+  if (db.length != m_db.length ||
+      (db.length > 0 && memcmp(db.str, m_db.str, db.length) != 0))
+    return false;
+
+  return true;
+}
+
 /**
   Assign parameter values either from variables, in case of SQL PS
   or from the execute packet.
@@ -2832,7 +2964,16 @@ reexecute:
   */
   Reprepare_observer *stmt_reprepare_observer = nullptr;
 
-  if (sql_command_flags[lex->sql_command] & CF_REEXECUTION_FRAGILE) {
+  /*
+    Statements that reference no tables, views or stored routines cannot
+    be invalidated by metadata changes: all version checks that may
+    report ER_NEED_REPREPARE are done per referenced table or routine
+    (or for a broken LEX). Skip installing the observer for such
+    statements so that execute-heavy workloads on them avoid the
+    repreparation bookkeeping entirely.
+  */
+  if ((sql_command_flags[lex->sql_command] & CF_REEXECUTION_FRAGILE) &&
+      (lex->is_metadata_used() || lex->is_broken())) {
     reprepare_observer.reset_reprepare_observer();
     stmt_reprepare_observer = &reprepare_observer;
   }
@@ -372,6 +372,23 @@ class Prepared_statement final {
   */
   MEM_ROOT main_mem_root;
 
+  /**
+    Session state captured when the statement was prepared. The statement
+    may be reused by a later re-prepare of the identical query text only
+    if this state still matches; otherwise the text could parse or resolve
+    differently.
+  */
+  sql_mode_t m_sql_mode_at_prepare{0};
+  const CHARSET_INFO *m_character_set_client{nullptr};
+  const CHARSET_INFO *m_collation_connection{nullptr};
+  /**
+    True if re-preparing the same query text is guaranteed to produce this
+    statement again, so the statement may be recycled when closed instead
+    of destroyed. Cleared when the prepared text differs from the client's
+    input (a pre-parse rewrite plugin is active).
+  */
+  bool m_reusable_on_reprepare{false};
+
  public:
   Prepared_statement(THD *thd_arg);
   virtual ~Prepared_statement();
@@ -389,6 +406,18 @@ class Prepared_statement final {
 #endif
   /* Destroy this statement */
   void deallocate();
+  /**
+    @return true if this statement may be kept for reuse when the client
+    closes it, instead of being destroyed.
+  */
+  bool is_recyclable() const;
+  /**
+    @return true if this recycled statement is what preparing the given
+    query text in the current session state would produce, so it can be
+    handed back to the client instead of preparing from scratch.
+  */
+  bool is_reusable_for(THD *thd, const char *query_str,
+                       size_t query_length) const;
   bool set_parameters(String *expanded_query, bool has_new_types,
                       PS_PARAM *parameters);
   bool set_parameters(String *expanded_query);
@@ -6705,6 +6705,299 @@ bool SELECT_LEX::transform_subquery_to_derived(THD *thd, TABLE_LIST **out_tl,
   return false;
 }
 
+/**
+  A minion of decorrelate_derived_scalar_subquery.
+
+  Check whether any join condition in the list (recursively) references a
+  query block outside the one it belongs to. Such correlation cannot be
+  lifted out of the subquery.
+
+  @param join_list  the join list to inspect
+  @returns true if an outer reference was found in a join condition
+*/
+static bool join_conds_have_outer_references(
+    mem_root_deque<TABLE_LIST *> &join_list) {
+  for (TABLE_LIST *tl : join_list) {
+    if (tl->join_cond() != nullptr &&
+        (tl->join_cond()->used_tables() & OUTER_REF_TABLE_BIT) != 0)
+      return true;
+    if (tl->nested_join != nullptr &&
+        join_conds_have_outer_references(tl->nested_join->join_list))
+      return true;
+  }
+  return false;
+}
+
+/**
+  A minion of transform_scalar_subqueries_to_join_with_derived.
+
+  Rewrite a scalar subquery which is correlated to this query block via
+  equalities in its WHERE clause, so that it can be converted to a derived
+  table. For example (with t1 in this query block):
+
+      (SELECT MAX(t2.x) FROM t2 WHERE t2.k = t1.k)
+
+  is rewritten to the self-contained
+
+      (SELECT MAX(t2.x), t2.k FROM t2 GROUP BY t2.k)
+
+  i.e. the correlated equalities are removed from the subquery's WHERE
+  clause and their inner fields are added to its select list and to a new
+  GROUP BY clause. The outer side of each equality is recorded in
+  Item_singlerow_subselect::m_decorrelated_outer_exprs; once the derived
+  table exists, attach_decorrelated_derived_join_cond() turns them into the
+  equivalent join condition
+
+      LEFT JOIN (...) derived ON t1.k = derived.k
+
+  The rewrite is only correct when at most one derived table row can match
+  an outer row (guaranteed by grouping on the lifted columns, provided the
+  join equality compares the same way as the grouping, hence the type and
+  collation restrictions below), and when a non-matching outer row computes
+  the same value as the original subquery over an empty set of rows (hence
+  only aggregates that return NULL over no rows are accepted, which
+  excludes e.g. COUNT).
+
+  The subquery is left untouched (*eligible = false) when these conditions
+  do not hold; it then simply remains an executable subquery.
+
+  @param      thd       session context
+  @param      subq      the correlated scalar subquery
+  @param[out] eligible  true if the subquery was decorrelated
+  @returns true on error
+*/
+bool SELECT_LEX::decorrelate_derived_scalar_subquery(
+    THD *thd, Item_singlerow_subselect *subq, bool *eligible) {
+  *eligible = false;
+  SELECT_LEX *const inner = subq->unit->first_select();
+
+  if (inner->m_windows.elements != 0 || inner->has_limit() ||
+      inner->order_list.elements != 0 || inner->m_having_cond != nullptr ||
+      inner->m_where_cond == nullptr)
+    return false;
+
+  // The subquery is implicitly grouped, cf. collect_scalar_subqueries
+  DBUG_ASSERT(inner->group_list.elements == 0 &&
+              inner->olap == UNSPECIFIED_OLAP_TYPE);
+
+  /*
+    The single select expression must be an aggregate which evaluates to
+    NULL over an empty set of rows, so that a NULL-complemented row from
+    the outer join gives the same value as the subquery does when no rows
+    match the correlated equalities.
+  */
+  Item *const select_expr = inner->fields_list.head();
+  if (select_expr->type() != Item::SUM_FUNC_ITEM ||
+      select_expr->m_is_window_function)
+    return false;
+  Item_sum *const aggregate = down_cast<Item_sum *>(select_expr);
+  if (aggregate->aggr_select != inner) return false;
+  switch (aggregate->sum_func()) {
+    case Item_sum::MIN_FUNC:
+    case Item_sum::MAX_FUNC:
+    case Item_sum::SUM_FUNC:
+    case Item_sum::SUM_DISTINCT_FUNC:
+    case Item_sum::AVG_FUNC:
+    case Item_sum::AVG_DISTINCT_FUNC:
+    case Item_sum::STD_FUNC:
+    case Item_sum::VARIANCE_FUNC:
+      break;
+    default:
+      return false;
+  }
+  if ((select_expr->used_tables() &
+       (OUTER_REF_TABLE_BIT | RAND_TABLE_BIT)) != 0)
+    return false;
+
+  // All correlation must sit in the WHERE clause, where we can remove it.
+  if (join_conds_have_outer_references(inner->top_join_list)) return false;
+
+  // Split WHERE into correlated equalities and residual conjuncts.
+  Mem_root_array<Item *> conjuncts(thd->mem_root);
+  if (inner->m_where_cond->type() == Item::COND_ITEM &&
+      down_cast<Item_cond *>(inner->m_where_cond)->functype() ==
+          Item_func::COND_AND_FUNC) {
+    List_iterator<Item> li(
+        *down_cast<Item_cond *>(inner->m_where_cond)->argument_list());
+    for (Item *conjunct = li++; conjunct != nullptr; conjunct = li++) {
+      if (conjuncts.push_back(conjunct)) return true;
+    }
+  } else {
+    if (conjuncts.push_back(inner->m_where_cond)) return true;
+  }
+
+  Mem_root_array<Item *> residual(thd->mem_root);
+  Mem_root_array<Item_field *> inner_fields(thd->mem_root);
+  Mem_root_array<Item_field *> outer_fields(thd->mem_root);
+
+  for (Item *conjunct : conjuncts) {
+    if ((conjunct->used_tables() & OUTER_REF_TABLE_BIT) == 0) {
+      if (residual.push_back(conjunct)) return true;
+      continue;
+    }
+    if (conjunct->type() != Item::FUNC_ITEM ||
+        down_cast<Item_func *>(conjunct)->functype() != Item_func::EQ_FUNC)
+      return false;
+    Item_func *const eq = down_cast<Item_func *>(conjunct);
+    Item *const left = eq->arguments()[0]->real_item();
+    Item *const right = eq->arguments()[1]->real_item();
+    if (left->type() != Item::FIELD_ITEM || right->type() != Item::FIELD_ITEM)
+      return false;
+    Item_field *inner_field = down_cast<Item_field *>(left);
+    Item_field *outer_field = down_cast<Item_field *>(right);
+    if (inner_field->depended_from != nullptr)
+      std::swap(inner_field, outer_field);
+    if (inner_field->depended_from != nullptr ||
+        outer_field->depended_from != this)
+      return false;
+    /*
+      Grouping on the inner field must not separate values that the
+      equality considers equal, or an outer row could match more than one
+      group. Requiring both sides to compare exactly as the inner field
+      groups ensures that.
+    */
+    if (inner_field->result_type() != outer_field->result_type()) return false;
+    if (inner_field->result_type() == STRING_RESULT &&
+        inner_field->collation.collation != outer_field->collation.collation)
+      return false;
+    if (inner_field->field->type() == MYSQL_TYPE_JSON ||
+        inner_field->field->type() == MYSQL_TYPE_GEOMETRY ||
+        outer_field->field->type() == MYSQL_TYPE_JSON ||
+        outer_field->field->type() == MYSQL_TYPE_GEOMETRY)
+      return false;
+    if (inner_fields.push_back(inner_field) ||
+        outer_fields.push_back(outer_field))
+      return true;
+  }
+
+  if (inner_fields.empty()) return false;
+
+  // The subquery is eligible: now rewrite it. We want permanent changes.
+  {
+    Prepared_stmt_arena_holder ps_arena_holder(thd);
+
+    // Rebuild the subquery's WHERE clause from the residual conjuncts.
+    if (residual.empty()) {
+      inner->m_where_cond = nullptr;
+    } else if (residual.size() == 1) {
+      inner->m_where_cond = residual[0];
+    } else {
+      Item_cond_and *new_where =
+          new (thd->mem_root) Item_cond_and(residual[0], residual[1]);
+      if (new_where == nullptr) return true;
+      for (size_t i = 2; i < residual.size(); i++) {
+        new_where->add(residual[i]);
+      }
+      inner->m_where_cond = new_where;
+      if (!new_where->fixed &&
+          new_where->fix_fields(thd, &inner->m_where_cond))
+        return true;
+    }
+    if (inner->m_where_cond != nullptr)
+      inner->m_where_cond->update_used_tables();
+
+    List<Item> *outer_exprs = new (thd->mem_root) List<Item>;
+    if (outer_exprs == nullptr) return true;
+
+    int field_no = 1;
+    for (size_t i = 0; i < inner_fields.size(); i++) {
+      Item_field *const inner_field = inner_fields[i];
+      if (baptize_item(thd, inner_field, &field_no)) return true;
+
+      // Add the inner field to the select list and group on it
+      const uint slot = inner->all_fields.elements;
+      inner->base_ref_items[slot] = inner_field;
+      if (inner->fields_list.push_back(inner_field) ||
+          inner->all_fields.push_back(inner_field))
+        return true;
+
+      ORDER *const ord = new (thd->mem_root) ORDER;
+      if (ord == nullptr) return true;
+      ord->item_ptr = inner_field;
+      ord->item = &inner->base_ref_items[slot];
+      ord->in_field_list = true;
+      ord->direction = ORDER_NOT_RELEVANT;
+      inner->group_list.link_in_list(ord, &ord->next);
+
+      // The outer side now belongs to this query block's join condition
+      Item_field *const outer_field = outer_fields[i];
+      outer_field->depended_from = nullptr;
+      outer_field->context = &this->context;
+      if (outer_exprs->push_back(outer_field)) return true;
+    }
+
+    // Mark so that the subquery is still collected on re-resolution, when
+    // it is no longer implicitly grouped nor correlated.
+    inner->m_was_implicitly_grouped = true;
+    inner->uncacheable &= ~UNCACHEABLE_DEPENDENT;
+    subq->unit->uncacheable &= ~UNCACHEABLE_DEPENDENT;
+
+    // The select list grew, so refresh the unit's column type list
+    subq->unit->types = inner->fields_list;
+
+    subq->m_decorrelated_outer_exprs = outer_exprs;
+  }
+
+  *eligible = true;
+  return false;
+}
+
+/**
+  A minion of transform_scalar_subqueries_to_join_with_derived.
+
+  Replace the placeholder "ON TRUE" join condition of a derived table that
+  replaced a decorrelated scalar subquery with equalities between the
+  lifted outer expressions and the grouping columns of the derived table,
+  cf. decorrelate_derived_scalar_subquery(). The grouping columns are the
+  trailing columns of the derived table.
+
+  The replacement uses THD::change_item_tree and is thus rolled back at the
+  end of the statement: for a prepared statement the derived table's TABLE
+  object is recreated on each execution, so the condition must be rebuilt
+  against the new fields every time, just like the replacement of the
+  subquery item itself.
+
+  @param thd            session context
+  @param derived_table  the derived table replacing the subquery
+  @param subq           the decorrelated scalar subquery
+  @returns true on error
+*/
+bool SELECT_LEX::attach_decorrelated_derived_join_cond(
+    THD *thd, TABLE_LIST *derived_table, Item_singlerow_subselect *subq) {
+  List<Item> *const outer_exprs = subq->m_decorrelated_outer_exprs;
+  TABLE *const table = derived_table->table;
+  DBUG_ASSERT(table != nullptr &&
+              table->s->fields > outer_exprs->elements);
+
+  uint field_no = table->s->fields - outer_exprs->elements;
+  Item *cond = nullptr;
+  List_iterator<Item> li(*outer_exprs);
+  for (Item *outer_expr = li++; outer_expr != nullptr; outer_expr = li++) {
+    auto *const derived_field =
+        new (thd->mem_root) Item_field(table->field[field_no++]);
+    if (derived_field == nullptr) return true;
+    Item *const eq =
+        new (thd->mem_root) Item_func_eq(outer_expr, derived_field);
+    if (eq == nullptr) return true;
+    cond = (cond == nullptr)
+               ? eq
+               : new (thd->mem_root) Item_cond_and(cond, eq);
+    if (cond == nullptr) return true;
+  }
+
+  if (!cond->fixed) {
+    // The outer expressions are re-resolved here on re-execution; make sure
+    // their columns are marked as read.
+    const enum enum_mark_columns save_mark = thd->mark_used_columns;
+    thd->mark_used_columns = MARK_COLUMNS_READ;
+    const bool error = cond->fix_fields(thd, &cond);
+    thd->mark_used_columns = save_mark;
+    if (error) return true;
+  }
+  thd->change_item_tree(derived_table->join_cond_ref(), cond);
+  return false;
+}
+
 bool SELECT_LEX::transform_scalar_subqueries_to_join_with_derived(THD *thd) {
   // Need at least one FROM table. Also, we do not want to perform this
   // transformation if we have an assignment of a user variable in the query.
@@ -6724,6 +7017,15 @@ bool SELECT_LEX::transform_scalar_subqueries_to_join_with_derived(THD *thd) {
 
   Item_singlerow_subselect::Collect_scalar_subquery_info subqueries;
 
+  /*
+    Scalar subqueries correlated to this query block can be collected as
+    well: they are decorrelated into grouped derived tables, cf.
+    decorrelate_derived_scalar_subquery(). The correlated equalities become
+    a join condition which is evaluated before any grouping in this block,
+    so only accept them when this block is not grouped.
+  */
+  subqueries.m_collect_correlated = !is_grouped();
+
   // Collect from join conditions
   if (walk_join_conditions(
           top_join_list,
@@ -6858,6 +7160,25 @@ bool SELECT_LEX::transform_scalar_subqueries_to_join_with_derived(THD *thd) {
     TABLE_LIST *tl = locate_derived(*join_list, subs_unit);
     const bool first_prepare = (tl == nullptr);
 
+    /*
+      A correlated subquery must be decorrelated before it can become a
+      derived table. If that is not possible, leave it as an executable
+      subquery. On re-resolution of a prepared statement the subquery has
+      already been decorrelated and is collected as non-correlated.
+    */
+    if (subquery.m_correlated) {
+      if ((subquery.m_location &
+           ~(Item_singlerow_subselect::Collect_scalar_subquery_info::L_SELECT |
+             Item_singlerow_subselect::Collect_scalar_subquery_info::
+                 L_WHERE)) != 0)
+        continue;
+      DBUG_ASSERT(first_prepare);
+      bool eligible = false;
+      if (decorrelate_derived_scalar_subquery(thd, subq, &eligible))
+        return true;
+      if (!eligible) continue;
+    }
+
     // Create a derived table for the subquery and nest it. If we found the
     // subquery outside of a join condition, we simply nest it at the end
     // with a LEFT OUTER .. ON TRUE, e.g.
@@ -6896,6 +7217,12 @@ bool SELECT_LEX::transform_scalar_subqueries_to_join_with_derived(THD *thd) {
     }
     seen_derived.push_back(tl);
 
+    // A decorrelated subquery needs its join condition (re)built now that
+    // the derived table's fields exist.
+    if (subq->m_decorrelated_outer_exprs != nullptr &&
+        attach_decorrelated_derived_join_cond(thd, tl, subq))
+      return true; /* purecov: inspected */
+
     /*
       Replace the subquery with a field in the materialized tmp table
       in WHERE, JOIN conditions, HAVING clause or SELECT expressions (could be
@@ -93,6 +93,7 @@
 #include "sql/mem_root_array.h"
 #include "sql/mysqld.h"              // lower_case_table_names
 #include "sql/mysqld_thd_manager.h"  // Global_THD_manager
+#include "sql/opt_outline.h"         // fill_optimizer_plan_outlines
 #include "sql/opt_trace.h"           // fill_optimizer_trace_info
 #include "sql/partition_info.h"      // partition_info
 #include "sql/protocol.h"            // Protocol
@@ -2767,12 +2768,14 @@ const char *get_one_variable_ext(THD *running_thd, THD *target_thd,
     }
 
     case SHOW_KEY_CACHE_LONG:
+      key_cache_sum_partition_stats(dflt_key_cache);
       value = (char *)dflt_key_cache + reinterpret_cast<size_t>(value);
       end = longlong10_to_str(*pointer_cast<const ulong *>(value), buff, 10);
       value_charset = system_charset_info;
       break;
 
     case SHOW_KEY_CACHE_LONGLONG:
+      key_cache_sum_partition_stats(dflt_key_cache);
       value = (char *)dflt_key_cache + reinterpret_cast<size_t>(value);
       end = longlong10_to_str(*pointer_cast<const longlong *>(value), buff, 10);
       value_charset = system_charset_info;
@@ -4228,9 +4231,15 @@ ST_FIELD_INFO tmp_table_columns_fields_info[] = {
      MYSQL_TYPE_STRING, 0, 0, "Generation expression", 0},
     {nullptr, 0, MYSQL_TYPE_STRING, 0, 0, nullptr, 0}};
 
+/** For creating fields of information_schema.OPTIMIZER_PLAN_OUTLINES */
+extern ST_FIELD_INFO optimizer_plan_outlines_info[];
+
 /** For creating fields of information_schema.OPTIMIZER_TRACE */
 extern ST_FIELD_INFO optimizer_trace_info[];
 
+/** For creating fields of information_schema.OPTIMIZER_TRACE_SAMPLES */
+extern ST_FIELD_INFO optimizer_trace_samples_info[];
+
 /*
   Description of ST_FIELD_INFO in table.h
 
@@ -4245,8 +4254,12 @@ ST_SCHEMA_TABLE schema_tables[] = {
      nullptr, false},
     {"OPEN_TABLES", open_tables_fields_info, fill_open_tables, make_old_format,
      nullptr, true},
+    {"OPTIMIZER_PLAN_OUTLINES", optimizer_plan_outlines_info,
+     fill_optimizer_plan_outlines, nullptr, nullptr, false},
     {"OPTIMIZER_TRACE", optimizer_trace_info, fill_optimizer_trace_info,
      nullptr, nullptr, false},
+    {"OPTIMIZER_TRACE_SAMPLES", optimizer_trace_samples_info,
+     fill_optimizer_trace_samples, nullptr, nullptr, false},
     {"PLUGINS", plugin_fields_info, fill_plugins, make_old_format, nullptr,
      false},
     {"PROCESSLIST", processlist_fields_info, fill_schema_processlist,
@@ -18143,6 +18143,11 @@ bool mysql_checksum_table(THD *thd, TABLE_LIST *tables,
         /* calculating table's checksum */
         ha_checksum crc = 0;
         uchar null_mask = 256 - (1 << t->s->last_null_bit_pos);
+        /*
+          Conversion buffer for BLOB/VARCHAR fields, reused for all rows
+          so that its allocation survives the row loop.
+        */
+        String tmp;
 
         t->use_all_columns();
 
@@ -18188,7 +18193,6 @@ bool mysql_checksum_table(THD *thd, TABLE_LIST *tables,
                 case MYSQL_TYPE_GEOMETRY:
                 case MYSQL_TYPE_JSON:
                 case MYSQL_TYPE_BIT: {
-                  String tmp;
                   f->val_str(&tmp);
                   row_crc =
                       checksum_crc32(row_crc, (uchar *)tmp.ptr(), tmp.length());
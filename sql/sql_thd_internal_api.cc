@@ -46,6 +46,7 @@
 #include "mysql/psi/mysql_file.h"
 #include "mysql/psi/mysql_mutex.h"
 #include "mysql/psi/mysql_socket.h"
+#include "mysql/psi/psi_statement.h"
 #include "mysql/thread_type.h"
 #include "sql/binlog.h"       // mysql_bin_log
 #include "sql/current_thd.h"  // current_thd
@@ -301,3 +302,19 @@ bool thd_is_dd_update_stmt(const THD *thd) {
 }
 
 my_thread_id thd_thread_id(const THD *thd) { return (thd->thread_id()); }
+
+void thd_statement_storage_io_stats(THD *thd, unsigned long long read_requests,
+                                    unsigned long long reads,
+                                    unsigned long long pages_dirtied,
+                                    unsigned long long bytes_read) {
+#ifdef HAVE_PSI_STATEMENT_INTERFACE
+  PSI_STATEMENT_CALL(inc_statement_storage_io_stats)
+  (thd->m_statement_psi, read_requests, reads, pages_dirtied, bytes_read);
+#else
+  (void)thd;
+  (void)read_requests;
+  (void)reads;
+  (void)pages_dirtied;
+  (void)bytes_read;
+#endif
+}
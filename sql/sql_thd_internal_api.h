@@ -259,4 +259,21 @@ bool thd_is_bootstrap_thread(THD *thd);
 bool thd_is_dd_update_stmt(const THD *thd);
 
 my_thread_id thd_thread_id(const THD *thd);
+
+/**
+  Add storage engine I/O statistics to the statement currently
+  instrumented for this session, for the statement metrics exposed in
+  performance_schema (events_statements_current and the aggregation by
+  digest).
+
+  @param thd            the session
+  @param read_requests  number of buffer pool page accesses
+  @param reads          number of buffer pool misses (pages read from storage)
+  @param pages_dirtied  number of pages first dirtied by the statement
+  @param bytes_read     number of bytes read from storage
+*/
+void thd_statement_storage_io_stats(THD *thd, unsigned long long read_requests,
+                                    unsigned long long reads,
+                                    unsigned long long pages_dirtied,
+                                    unsigned long long bytes_read);
 #endif  // SQL_THD_INTERNAL_API_INCLUDED
@@ -60,6 +60,7 @@
 #include "sql/debug_sync.h"     // DEBUG_SYNC
 #include "sql/error_handler.h"  // Strict_error_handler
 #include "sql/field.h"
+#include "sql/filesort.h"  // Filesort
 #include "sql/handler.h"
 #include "sql/item.h"
 #include "sql/item_subselect.h"
@@ -75,6 +76,7 @@
 #include "sql/protocol.h"
 #include "sql/query_options.h"
 #include "sql/row_iterator.h"
+#include "sql/sorting_iterator.h"
 #include "sql/sql_base.h"  // fill_record
 #include "sql/sql_class.h"
 #include "sql/sql_cmd.h"
@@ -856,11 +858,24 @@ void SELECT_LEX_UNIT::create_iterators(THD *thd) {
   // see MaterializeIterator for details.
   bool streaming_allowed = true;
   if (global_parameters()->order_list.size() != 0) {
-    // If we're sorting, we currently put it in a real table no matter what.
-    // This is a legacy decision, because we used to not know whether filesort
-    // would want to refer to rows in the table after the sort (sort by row ID).
-    // We could probably be more intelligent here now.
-    streaming_allowed = false;
+    // If we're sorting, the rows have historically been put in a real table
+    // no matter what, because we used to not know whether filesort would want
+    // to refer back to rows in the table after the sort (sort by row ID).
+    // That decision is known up front now, so a pure UNION ALL whose sort
+    // keeps complete rows in the sort buffers (addon fields) can feed the
+    // sort directly from the streamed rows; the table is then never written
+    // to. Sorts by row ID, mixed ALL/DISTINCT unions and unions fed into
+    // INSERT/REPLACE (see below) still need the real table.
+    JOIN *fake_join =
+        fake_select_lex != nullptr ? fake_select_lex->join : nullptr;
+    if (union_distinct != nullptr || fake_join == nullptr ||
+        fake_join->tables != 1 || fake_join->qep_tab[0].filesort == nullptr ||
+        !fake_join->qep_tab[0].filesort->using_addon_fields() ||
+        ((thd->lex->sql_command == SQLCOM_INSERT_SELECT ||
+          thd->lex->sql_command == SQLCOM_REPLACE_SELECT) &&
+         thd->lex->unit == this)) {
+      streaming_allowed = false;
+    }
   } else if ((thd->lex->sql_command == SQLCOM_INSERT_SELECT ||
               thd->lex->sql_command == SQLCOM_REPLACE_SELECT) &&
              thd->lex->unit == this) {
@@ -942,6 +957,31 @@ void SELECT_LEX_UNIT::create_iterators(THD *thd) {
         NewIterator<AppendIterator>(thd, move(union_all_sub_iterators));
   }
 
+  if (streaming_allowed && global_parameters()->order_list.size() != 0) {
+    // A pure UNION ALL with ORDER BY where the sort uses addon fields
+    // (verified above): sort the streamed rows directly instead of the
+    // temporary table the fake query block would otherwise scan. The sort
+    // and the limit are taken over from the fake query block's plan; its
+    // own iterator (a sort over a scan of the never-filled table) is left
+    // unused.
+    JOIN *fake_join = fake_select_lex->join;
+    QEP_TAB *fake_qep_tab = &fake_join->qep_tab[0];
+    m_root_iterator = NewIterator<SortingIterator>(
+        thd, fake_qep_tab, fake_qep_tab->filesort, move(m_root_iterator),
+        &fake_join->examined_rows);
+    fake_qep_tab->table()->sorting_iterator =
+        down_cast<SortingIterator *>(m_root_iterator->real_iterator());
+    if (limit != HA_POS_ERROR || offset != 0) {
+      // ExecuteIteratorQuery() reads rows skipped by OFFSET out of the fake
+      // query block's send_records whenever there is a fake query block,
+      // so count them there.
+      m_root_iterator = NewIterator<LimitOffsetIterator>(
+          thd, move(m_root_iterator), limit, offset, calc_found_rows,
+          &fake_join->send_records);
+    }
+    return;
+  }
+
   // NOTE: If there's a fake_select_lex, its JOIN's iterator already handles
   // LIMIT/OFFSET, so we don't do it again here.
   if ((limit != HA_POS_ERROR || offset != 0) && fake_select_lex == nullptr) {
@@ -31,6 +31,7 @@
 #include <atomic>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "field_types.h"
 #include "lex_string.h"
@@ -681,6 +682,7 @@ bool Sql_cmd_update::update_single_table(THD *thd) {
         if (thd->killed && !error)  // Aborted
           error = 1;                /* purecov: inspected */
         limit = tmp_limit;
+        const my_off_t tempfile_size = my_b_tell(tempfile);
         end_semi_consistent_read.rollback();
         if (used_index < MAX_KEY && covering_keys_for_cond.is_set(used_index))
           table->set_keyread(false);
@@ -697,6 +699,68 @@ bool Sql_cmd_update::update_single_table(THD *thd) {
           return error > 0;
         }
 
+        /*
+          The collected rowids are in scan order, so applying the updates
+          in that order makes the write phase jump around the primary key.
+          When the application order is unobservable, sort the rowids so
+          the updates walk the table in physical order instead. The order
+          is observable - and therefore left alone - with ORDER BY (the
+          user may rely on it to dodge transient unique conflicts), with
+          triggers (row trigger firing order), and with IGNORE (the order
+          decides which conflicting rows get skipped). The sort is done in
+          memory and skipped when the rowids exceed sort_buffer_size.
+        */
+        if (order == nullptr && table->triggers == nullptr &&
+            !thd->lex->is_ignore() && tempfile_size > 0 &&
+            tempfile_size <= thd->variables.sortbuff_size) {
+          const uint ref_length = table->file->ref_length;
+          const size_t num_refs =
+              static_cast<size_t>(tempfile_size) / ref_length;
+          uchar *refs = static_cast<uchar *>(
+              my_malloc(key_memory_TABLE_sort_io_cache,
+                        static_cast<size_t>(tempfile_size), MYF(0)));
+          bool sort_failed = false;
+
+          if (refs != nullptr) {
+            if (my_b_read(tempfile, refs, static_cast<size_t>(tempfile_size))) {
+              /* Could not slurp the rowids; rewind and apply unsorted. */
+              if (reinit_io_cache(tempfile, READ_CACHE, 0L, false, false))
+                sort_failed = true;
+            } else {
+              std::vector<uchar *> sorted_refs;
+              sorted_refs.reserve(num_refs);
+              for (size_t i = 0; i < num_refs; ++i) {
+                sorted_refs.push_back(refs + i * ref_length);
+              }
+              const handler *file = table->file;
+              std::sort(sorted_refs.begin(), sorted_refs.end(),
+                        [file](const uchar *a, const uchar *b) {
+                          return file->cmp_ref(a, b) < 0;
+                        });
+
+              if (reinit_io_cache(tempfile, WRITE_CACHE, 0L, false, true)) {
+                sort_failed = true;
+              } else {
+                for (const uchar *ref : sorted_refs) {
+                  if (my_b_write(tempfile, ref, ref_length)) {
+                    sort_failed = true;
+                    break;
+                  }
+                }
+                if (reinit_io_cache(tempfile, READ_CACHE, 0L, false, false))
+                  sort_failed = true;
+              }
+            }
+            my_free(refs);
+          }
+
+          if (sort_failed) {
+            close_cached_file(tempfile);
+            my_free(tempfile);
+            return true;
+          }
+        }
+
         iterator = NewIterator<SortFileIndirectIterator>(
             thd, table, tempfile,
             /*request_cache=*/false,
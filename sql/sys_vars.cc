@@ -104,6 +104,7 @@
 #include "sql/log_event.h"  // MAX_MAX_ALLOWED_PACKET
 #include "sql/mdl.h"
 #include "sql/my_decimal.h"
+#include "sql/opt_outline.h"  // opt_outline_flush
 #include "sql/opt_trace_context.h"
 #include "sql/options_mysqld.h"
 #include "sql/protocol_classic.h"
@@ -880,6 +881,15 @@ static Sys_var_uint Sys_cte_max_recursion_depth(
     CMD_LINE(REQUIRED_ARG), VALID_RANGE(0, UINT_MAX32), DEFAULT(1000),
     BLOCK_SIZE(1));
 
+static Sys_var_ulong Sys_json_serialization_slack_percent(
+    "json_serialization_slack_percent",
+    "Percentage of extra space to reserve at the end of each array and "
+    "object when serializing a JSON value to the binary storage format. "
+    "The slack space allows subsequent partial updates that grow a value "
+    "to be applied in place instead of rewriting the whole document.",
+    HINT_UPDATEABLE SESSION_VAR(json_serialization_slack_percent),
+    CMD_LINE(REQUIRED_ARG), VALID_RANGE(0, 100), DEFAULT(0), BLOCK_SIZE(1));
+
 static Sys_var_bool Sys_automatic_sp_privileges(
     "automatic_sp_privileges",
     "Creating and dropping stored procedures alters ACLs",
@@ -3199,6 +3209,46 @@ static Sys_var_ulong Sys_optimizer_trace_max_mem_size(
     SESSION_VAR(optimizer_trace_max_mem_size), CMD_LINE(REQUIRED_ARG),
     VALID_RANGE(0, ULONG_MAX), DEFAULT(1024 * 1024), BLOCK_SIZE(1));
 
+static Sys_var_bool Sys_optimizer_capture_plan_outlines(
+    "optimizer_capture_plan_outlines",
+    "Capture the index choices of each optimized statement as a plan "
+    "outline keyed by the statement digest, to be enforced later with "
+    "optimizer_use_plan_outlines",
+    GLOBAL_VAR(optimizer_capture_plan_outlines), CMD_LINE(OPT_ARG),
+    DEFAULT(false));
+
+static Sys_var_bool Sys_optimizer_use_plan_outlines(
+    "optimizer_use_plan_outlines",
+    "Enforce captured plan outlines: a statement whose digest has an "
+    "outline reads each pinned table through the recorded index, as if "
+    "FORCE INDEX had been written in the statement",
+    GLOBAL_VAR(optimizer_use_plan_outlines), CMD_LINE(OPT_ARG),
+    DEFAULT(false));
+
+static bool fix_flush_plan_outlines(sys_var *, THD *, enum_var_type) {
+  if (optimizer_flush_plan_outlines) {
+    opt_outline_flush();
+    optimizer_flush_plan_outlines = false;
+  }
+  return false;
+}
+
+static Sys_var_bool Sys_optimizer_flush_plan_outlines(
+    "optimizer_flush_plan_outlines",
+    "Setting this variable to ON discards all captured plan outlines; it "
+    "reverts to OFF by itself",
+    GLOBAL_VAR(optimizer_flush_plan_outlines), CMD_LINE(OPT_ARG),
+    DEFAULT(false), NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(nullptr),
+    ON_UPDATE(fix_flush_plan_outlines));
+
+static Sys_var_ulong Sys_optimizer_trace_sample_rate(
+    "optimizer_trace_sample_rate",
+    "Record a compact fingerprint of the chosen execution plan for one in "
+    "N traceable statements, readable from "
+    "INFORMATION_SCHEMA.OPTIMIZER_TRACE_SAMPLES. 0 disables plan sampling",
+    GLOBAL_VAR(optimizer_trace_sample_rate), CMD_LINE(REQUIRED_ARG),
+    VALID_RANGE(0, ULONG_MAX), DEFAULT(0), BLOCK_SIZE(1));
+
 static Sys_var_charptr Sys_pid_file(
     "pid_file", "Pid file used by safe_mysqld",
     READ_ONLY NON_PERSIST GLOBAL_VAR(pidfile_name_ptr), CMD_LINE(REQUIRED_ARG),
@@ -3792,7 +3842,7 @@ static Sys_var_ulong Binlog_transaction_dependency_history_size(
     "Maximum number of rows to keep in the writeset history.",
     GLOBAL_VAR(mysql_bin_log.m_dependency_tracker.get_writeset()
                    ->m_opt_max_history_size),
-    CMD_LINE(REQUIRED_ARG, 0), VALID_RANGE(1, 1000000), DEFAULT(25000),
+    CMD_LINE(REQUIRED_ARG, 0), VALID_RANGE(1, 10000000), DEFAULT(25000),
     BLOCK_SIZE(1), &PLock_slave_trans_dep_tracker, NOT_IN_BINLOG,
     ON_CHECK(nullptr), ON_UPDATE(nullptr));
 
@@ -208,6 +208,7 @@ struct System_variables {
   uint eq_range_index_dive_limit;
   uint cte_max_recursion_depth;
   ulonglong histogram_generation_max_mem_size;
+  ulong json_serialization_slack_percent;
   ulong join_buff_size;
   ulong lock_wait_timeout;
   ulong max_allowed_packet;
@@ -452,6 +453,8 @@ struct System_status_var {
   ulonglong select_range_check_count;
   ulonglong select_scan_count;
   ulonglong long_query_count;
+  ulonglong filesort_key_cache_hits;
+  ulonglong filesort_key_cache_misses;
   ulonglong filesort_merge_passes;
   ulonglong filesort_range_count;
   ulonglong filesort_rows;
@@ -2893,7 +2893,16 @@ int open_table_from_share(THD *thd, TABLE_SHARE *share, const char *alias,
   MEM_ROOT *root;
   if (!internal_tmp) {
     root = &outparam->mem_root;
-    init_sql_alloc(key_memory_TABLE, root, TABLE_ALLOC_BLOCK_SIZE, 0);
+    /*
+      Size the first block after the footprint observed when this share
+      was last opened, if known. For wide tables this serves the Field
+      clones, record buffers and bitmaps below from one block allocation
+      instead of a chain of doubling blocks.
+    */
+    const size_t block_size = share->cached_open_alloc_size != 0
+                                  ? share->cached_open_alloc_size
+                                  : TABLE_ALLOC_BLOCK_SIZE;
+    init_sql_alloc(key_memory_TABLE, root, block_size, 0);
   } else
     root = &share->mem_root;
 
@@ -3080,6 +3089,8 @@ int open_table_from_share(THD *thd, TABLE_SHARE *share, const char *alias,
           bitmap_set_bit(&outparam->fields_for_functional_indexes,
                          (*field_ptr)->field_index());
         }
+        if ((*field_ptr)->is_virtual_gcol())
+          outparam->vfield_contains_virtual_gcol = true;
         *(vfield_ptr++) = *field_ptr;
       }
     }
@@ -3249,6 +3260,9 @@ int open_table_from_share(THD *thd, TABLE_SHARE *share, const char *alias,
   /* Increment the opened_tables counter, only when open flags set. */
   if (db_stat) thd->status_var.opened_tables++;
 
+  /* Remember the open footprint so the next open pre-sizes its MEM_ROOT. */
+  if (!internal_tmp) share->cached_open_alloc_size = root->allocated_size();
+
   return 0;
 
 err:
@@ -6917,6 +6931,29 @@ bool TABLE_LIST::generate_keys() {
       table->s->owner_of_possible_tmp_keys != select_lex)
     return false;
 
+  /*
+    Different references to this table often request keys over the same set
+    of fields, e.g. when they join on the same columns, or when the
+    catch-all entry (the one with referenced_by == 0, covering all
+    referenced fields) coincides with a per-reference entry. One key serves
+    them all, so fold such duplicates into the first entry having the same
+    field set; this avoids creating identical keys in every reference and
+    wasting some of the at most MAX_INDEXES key slots.
+  */
+  List_iterator<Derived_key> dup_it(derived_key_list);
+  Derived_key *dup_entry;
+  while ((dup_entry = dup_it++)) {
+    List_iterator<Derived_key> prev_it(derived_key_list);
+    Derived_key *prev_entry;
+    while ((prev_entry = prev_it++) != dup_entry) {
+      if (prev_entry->used_fields == dup_entry->used_fields) {
+        prev_entry->referenced_by |= dup_entry->referenced_by;
+        dup_it.remove();
+        break;
+      }
+    }
+  }
+
   // Extend the key array of every reference
 
   const int new_key_count =
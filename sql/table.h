@@ -859,6 +859,18 @@ struct TABLE_SHARE {
   */
   int cached_row_logging_check{0};
 
+  /*
+    Cache of the MEM_ROOT footprint observed when a TABLE was last opened
+    from this share, in bytes. Used as the block size for the TABLE
+    MEM_ROOT of subsequent opens, so that cloning the Field array, record
+    buffers and bitmaps for a wide table is served from a single block
+    allocation instead of a chain of doubling blocks. 0 until the first
+    open completes. Like cached_row_logging_check, this is an
+    opportunistic cache: concurrent opens may race to store it, but any
+    stored value is a valid hint.
+  */
+  size_t cached_open_alloc_size{0};
+
   /*
     Storage media to use for this table (unless another storage
     media has been specified on an individual column - in versions
@@ -1395,6 +1407,12 @@ struct TABLE {
   Field *found_next_number_field{nullptr}; /* Set on open */
   /// Pointer to generated columns
   Field **vfield{nullptr};
+  /**
+    True if vfield contains at least one virtual (not stored) generated
+    column. Stored generated columns are materialized in the row and do not
+    have to be re-evaluated when a row is read.
+  */
+  bool vfield_contains_virtual_gcol{false};
   /// Pointer to fields having the default value generated
   Field **gen_def_fields_ptr{nullptr};
   /// Field used by unique constraint
@@ -1766,6 +1784,12 @@ struct TABLE {
   /// @return true if table contains one or more generated columns
   bool has_gcol() const { return vfield; }
 
+  /**
+    @return true if table contains one or more virtual generated columns,
+    i.e. columns that have to be evaluated when a row is read
+  */
+  bool has_virtual_gcol() const { return vfield_contains_virtual_gcol; }
+
   /**
    Life cycle of the row buffer is as follows:
    - The initial state is "not started".
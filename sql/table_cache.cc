@@ -29,6 +29,7 @@
 #include "my_dbug.h"
 #include "my_macros.h"
 #include "mysql/psi/psi_base.h"
+#include "mysql/status_var.h"
 #include "sql/sql_test.h"  // lock_descriptions[]
 #include "thr_lock.h"
 #include "thr_mutex.h"
@@ -55,6 +56,9 @@ bool Table_cache::init() {
   mysql_mutex_init(m_lock_key, &m_lock, MY_MUTEX_INIT_FAST);
   m_unused_tables = nullptr;
   m_table_count = 0;
+  m_hits = 0;
+  m_misses = 0;
+  m_evictions = 0;
   return false;
 }
 
@@ -315,6 +319,57 @@ void Table_cache_manager::free_table(THD *thd MY_ATTRIBUTE((unused)),
   }
 }
 
+/**
+  Get array of status variables for per-instance hit/miss/eviction
+  counters of all table cache instances.
+
+  The array is expanded under the Table_open_cache_instance prefix,
+  producing status variables like Table_open_cache_instance_0_hits.
+  Counter values are read without acquiring locks on table cache
+  instances, similarly to how it is done for the Open_tables counter.
+
+  @note Returned array is valid until server shutdown.
+*/
+
+SHOW_VAR *Table_cache_manager::status_vars() {
+  /*
+    Both names and SHOW_VAR entries need to be around while the status
+    variable array is in use, so they are kept in static storage. The
+    addresses of the counters never change, so it is safe to re-fill
+    the array on each call.
+  */
+  static char names[MAX_TABLE_CACHES][3][16];
+  static SHOW_VAR vars[MAX_TABLE_CACHES * 3 + 1];
+
+  uint v = 0;
+  for (uint i = 0; i < table_cache_instances; i++) {
+    snprintf(names[i][0], sizeof(names[i][0]), "%u_hits", i);
+    vars[v].name = names[i][0];
+    vars[v].value = reinterpret_cast<char *>(&m_table_cache[i].m_hits);
+    vars[v].type = SHOW_LONGLONG;
+    vars[v].scope = SHOW_SCOPE_GLOBAL;
+    v++;
+    snprintf(names[i][1], sizeof(names[i][1]), "%u_misses", i);
+    vars[v].name = names[i][1];
+    vars[v].value = reinterpret_cast<char *>(&m_table_cache[i].m_misses);
+    vars[v].type = SHOW_LONGLONG;
+    vars[v].scope = SHOW_SCOPE_GLOBAL;
+    v++;
+    snprintf(names[i][2], sizeof(names[i][2]), "%u_evictions", i);
+    vars[v].name = names[i][2];
+    vars[v].value = reinterpret_cast<char *>(&m_table_cache[i].m_evictions);
+    vars[v].type = SHOW_LONGLONG;
+    vars[v].scope = SHOW_SCOPE_GLOBAL;
+    v++;
+  }
+  vars[v].name = nullptr;
+  vars[v].value = nullptr;
+  vars[v].type = SHOW_UNDEF;
+  vars[v].scope = SHOW_SCOPE_UNDEF;
+
+  return vars;
+}
+
 /** Free all unused TABLE objects in all table cache instances. */
 
 void Table_cache_manager::free_all_unused_tables() {
@@ -33,6 +33,7 @@
 #include "lex_string.h"
 #include "my_base.h"
 #include "my_dbug.h"
+#include "my_murmur3.h"
 #include "my_psi_config.h"
 #include "mysql/components/services/mysql_mutex_bits.h"
 #include "mysql/components/services/psi_mutex_bits.h"
@@ -43,8 +44,10 @@
 #include "sql/sql_plist.h"
 #include "sql/system_variables.h"
 #include "sql/table.h"
+#include "template_utils.h"
 
 class Table_cache_element;
+struct SHOW_VAR;
 
 extern ulong table_cache_size_per_instance, table_cache_instances;
 
@@ -55,8 +58,9 @@ extern ulong table_cache_size_per_instance, table_cache_instances;
   go to a central table definition cache to get a TABLE object and
   therefore don't need to lock LOCK_open mutex.
   Instead they only need to go to one Table_cache instance (the
-  specific instance is determined by thread id) and only lock the
-  mutex protecting this cache.
+  specific instance is determined by hashing the table cache key,
+  so all TABLE objects for one table live in the same instance) and
+  only lock the mutex protecting this cache.
   DDL statements that need to remove all TABLE objects from all caches
   need to lock mutexes for all Table_cache instances, but they are rare.
 
@@ -115,6 +119,25 @@ class Table_cache {
   */
   uint m_table_count;
 
+  /**
+    Number of times an unused TABLE instance was found in this cache
+    and reused. Exposed as per-instance part of Table_open_cache_instance
+    status counter set.
+  */
+  ulonglong m_hits;
+
+  /**
+    Number of times lookup in this cache didn't find an unused TABLE
+    instance, so the caller had to construct a new TABLE object.
+  */
+  ulonglong m_misses;
+
+  /**
+    Number of unused TABLE instances which were evicted from this cache
+    because the table cache as a whole has exceeded its size limit.
+  */
+  ulonglong m_evictions;
+
 #ifdef HAVE_PSI_INTERFACE
   static PSI_mutex_key m_lock_key;
   static PSI_mutex_info m_mutex_keys[];
@@ -154,11 +177,20 @@ class Table_cache {
   /** Get number of TABLE instances in the cache. */
   uint cached_tables() const { return m_table_count; }
 
+  /** Get number of unused TABLE instances reused from this cache. */
+  ulonglong hits() const { return m_hits; }
+  /** Get number of lookups which didn't find an unused TABLE instance. */
+  ulonglong misses() const { return m_misses; }
+  /** Get number of unused TABLE instances evicted from this cache. */
+  ulonglong evictions() const { return m_evictions; }
+
   void free_all_unused_tables();
 
 #ifndef DBUG_OFF
   void print_tables();
 #endif
+
+  friend class Table_cache_manager;
 };
 
 /**
@@ -176,9 +208,28 @@ class Table_cache_manager {
   bool init();
   void destroy();
 
-  /** Get instance of table cache to be used by particular connection. */
-  Table_cache *get_cache(THD *thd) {
-    return &m_table_cache[thd->thread_id() % table_cache_instances];
+  /**
+    Get instance of table cache responsible for particular table.
+
+    Tables are hashed to table cache instances by their table cache key,
+    so all TABLE objects for one table are always handled by the same
+    instance. This keeps all unused TABLE instances for a hot table in
+    one place instead of spreading them over instances belonging to
+    connections which happened to open it.
+
+    @param key         Key identifying table (db name\\0table name\\0).
+    @param key_length  Length of key for the table.
+  */
+  Table_cache *get_cache(const char *key, size_t key_length) {
+    return &m_table_cache[murmur3_32(pointer_cast<const uchar *>(key),
+                                     key_length, 0) %
+                          table_cache_instances];
+  }
+
+  /** Get instance of table cache by its index in the container. */
+  Table_cache *get_cache_by_index(uint index) {
+    DBUG_ASSERT(index < table_cache_instances);
+    return &m_table_cache[index];
   }
 
   /** Get index for the table cache in container. */
@@ -198,6 +249,8 @@ class Table_cache_manager {
 
   void free_all_unused_tables();
 
+  SHOW_VAR *status_vars();
+
 #ifndef DBUG_OFF
   void print_tables();
 #endif
@@ -299,9 +352,18 @@ void Table_cache::unlink_unused_table(TABLE *table) {
 }
 
 /**
-  Free unused TABLE instances if total number of TABLE objects
-  in table cache has exceeded table_cache_size_per_instance
-  limit.
+  Free unused TABLE instances if this table cache instance has exceeded
+  its table_cache_size_per_instance share of the table cache AND the
+  table cache as a whole has exceeded the total table_cache_size limit.
+
+  Since tables are hashed to table cache instances, load on instances
+  can be uneven. An instance which has exceeded its own share is allowed
+  to "steal" capacity which other, less loaded instances don't use, as
+  long as the total number of TABLE objects stays within the limit for
+  the whole cache. Thanks to this an instance serving hot tables is not
+  forced to evict their TABLE objects while other instances sit idle.
+  Counting TABLE objects in other instances is done without acquiring
+  their locks - an inexact total is acceptable for this heuristic.
 
   @note That we might need to free more than one instance during
         this call if table_cache_size was changed dynamically.
@@ -315,12 +377,18 @@ void Table_cache::free_unused_tables_if_necessary(THD *thd) {
     need the below loop, in case when table_cache_size is changed dynamically,
     at server run time.
   */
-  if (m_table_count > table_cache_size_per_instance && m_unused_tables) {
+  const ulonglong total_limit =
+      (ulonglong)table_cache_size_per_instance * table_cache_instances;
+
+  if (m_table_count > table_cache_size_per_instance && m_unused_tables &&
+      table_cache_manager.cached_tables() > total_limit) {
     mysql_mutex_lock(&LOCK_open);
-    while (m_table_count > table_cache_size_per_instance && m_unused_tables) {
+    while (m_table_count > table_cache_size_per_instance && m_unused_tables &&
+           table_cache_manager.cached_tables() > total_limit) {
       TABLE *table_to_free = m_unused_tables;
       remove_table(table_to_free);
       intern_close_table(table_to_free);
+      m_evictions++;
       thd->status_var.table_open_cache_overflows++;
     }
     mysql_mutex_unlock(&LOCK_open);
@@ -431,6 +499,7 @@ void Table_cache::remove_table(TABLE *table) {
 
   @note Caller should own lock on the table cache.
   @note Sets TABLE::in_use member as side effect.
+  @note Updates per-instance hit/miss counters as side effect.
 
   @retval non-NULL - pointer to unused TABLE object, "share" out-parameter
                      contains pointer to TABLE_SHARE for this table.
@@ -449,7 +518,10 @@ TABLE *Table_cache::get_table(THD *thd, const char *key, size_t key_length,
 
   std::string key_str(key, key_length);
   const auto el_it = m_cache.find(key_str);
-  if (el_it == m_cache.end()) return nullptr;
+  if (el_it == m_cache.end()) {
+    m_misses++;
+    return nullptr;
+  }
   Table_cache_element *el = el_it->second.get();
 
   *share = el->share;
@@ -477,7 +549,10 @@ TABLE *Table_cache::get_table(THD *thd, const char *key, size_t key_length,
     DBUG_ASSERT(table->db_stat && table->file);
     /* The children must be detached from the table. */
     DBUG_ASSERT(!table->file->ha_extra(HA_EXTRA_IS_ATTACHED_CHILDREN));
-  }
+
+    m_hits++;
+  } else
+    m_misses++;
 
   return table;
 }
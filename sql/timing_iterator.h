@@ -64,6 +64,10 @@ class TimingIterator final : public RowIterator {
 
   std::string TimingString() const override;
 
+  std::string ExtraStatsString() const override {
+    return m_iterator.ExtraStatsString();
+  }
+
   RowIterator *real_iterator() override { return &m_iterator; }
   const RowIterator *real_iterator() const override { return &m_iterator; }
 
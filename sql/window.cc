@@ -1292,6 +1292,84 @@ bool Window::make_special_rows_cache(THD *thd, TABLE *out_tbl) {
                (uchar *)thd->alloc((FBC_FIRST_KEY - FBC_LAST_KEY + 1) * l));
 }
 
+bool Window::make_frame_row_cache(THD *thd) {
+  DBUG_ASSERT(m_frame_row_cache == nullptr);
+  /*
+    Upper bound on the cache allocation. Bounded ROWS frames are typically
+    small (moving sums or averages over some tens of rows); if the frame does
+    not fit, we leave the cache disabled and read frame rows back from the
+    frame buffer file as before.
+  */
+  constexpr int64 cache_max_size = 262144;
+
+  if (m_frame->m_unit != WFU_ROWS) return false;
+
+  const enum_window_border_type from_t = m_frame->m_from->m_border_type;
+  const enum_window_border_type to_t = m_frame->m_to->m_border_type;
+  if (from_t == WBT_UNBOUNDED_PRECEDING || to_t == WBT_UNBOUNDED_FOLLOWING)
+    return false;
+
+  /*
+    Peer sets are delimited by the window ordering, not by the frame, so
+    finding the peers of the current row can read arbitrarily far away from
+    it.
+  */
+  if (needs_peerset() || needs_last_peer_in_frame()) return false;
+
+  /*
+    The record image of a row with blobs holds pointers into storage which is
+    not stable across subsequently buffered rows, so such rows cannot be
+    cached with a plain record copy.
+  */
+  if (m_frame_buffer->s->blob_fields > 0) return false;
+
+  const int64 from_border =
+      m_frame->m_from->border() != nullptr ? m_frame->m_from->border()->val_int()
+                                           : 0;
+  const int64 to_border =
+      m_frame->m_to->border() != nullptr ? m_frame->m_to->border()->val_int()
+                                         : 0;
+  if (from_border < 0 || from_border > cache_max_size || to_border < 0 ||
+      to_border > cache_max_size)
+    return false;
+
+  /*
+    Establish the reach of the frame relative to the current row, which is
+    itself always read. NTH_VALUE reads fall within the frame; LEAD and LAG
+    can read outside it, so widen the reach with their offsets.
+  */
+  const auto offset_of = [](enum_window_border_type type, int64 border) {
+    return type == WBT_VALUE_PRECEDING
+               ? -border
+               : (type == WBT_VALUE_FOLLOWING ? border : 0);
+  };
+  const int64 from_offset = offset_of(from_t, from_border);
+  const int64 to_offset = offset_of(to_t, to_border);
+  int64 lowest = std::min<int64>(0, std::min(from_offset, to_offset));
+  int64 highest = std::max<int64>(0, std::max(from_offset, to_offset));
+
+  for (const st_ll_offset &ll : m_opt_lead_lag.m_offsets) {
+    // LEAD/LAG visits current_row - m_rowno, cf. process_wfs_needing_card
+    lowest = std::min(lowest, -ll.m_rowno);
+    highest = std::max(highest, -ll.m_rowno);
+  }
+  if (-lowest > cache_max_size || highest > cache_max_size) return false;
+
+  /*
+    One row below the lowest frame row covers the reads of rows leaving the
+    frame under inverse aggregation; one more row on each side is margin for
+    the buffering running ahead of the row being processed.
+  */
+  const int64 rows = highest - lowest + 4;
+  const size_t reclength = m_frame_buffer->s->reclength;
+  if (rows > cache_max_size / static_cast<int64>(reclength)) return false;
+
+  m_frame_row_cache = (uchar *)thd->alloc(rows * reclength);
+  if (m_frame_row_cache == nullptr) return true;
+  m_frame_row_cache_rows = rows;
+  return false;
+}
+
 void Window::cleanup(THD *thd) {
   if (m_needs_frame_buffering && m_frame_buffer != nullptr) {
     (void)m_frame_buffer->file->ha_index_or_rnd_end();
@@ -1310,6 +1388,10 @@ void Window::cleanup(THD *thd) {
 
   m_frame_buffer_positions.clear();
   m_special_rows_cache_max_length = 0;
+  m_frame_row_cache = nullptr;
+  m_frame_row_cache_rows = 0;
+  m_frame_row_cache_last_rowno = 0;
+  m_frame_row_cache_count = 0;
 
   m_frame_buffer_param = nullptr;
   m_outtable_param = nullptr;
@@ -1355,6 +1437,8 @@ void Window::reset_execution_state(Reset_level level) {
       m_frame_buffer_total_rows = 0;
       m_frame_buffer_partition_offset = 0;
       m_part_row_number = 0;
+      m_frame_row_cache_last_rowno = 0;
+      m_frame_row_cache_count = 0;
     // fall-through
     case RL_PARTITION:
       /*
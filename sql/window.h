@@ -420,6 +420,25 @@ class Window {
   /// Maximum allocated size in #m_special_rows_cache
   size_t m_special_rows_cache_max_length;
 
+  /**
+    In-memory cache over the most recently buffered frame buffer rows, used
+    for ROWS frames with bounded extents. Row images are stored contiguously
+    in a ring: the row with partition-relative number R occupies slot
+    R % m_frame_row_cache_rows, so moving the cached row window forward by
+    one row is a single record copy. The cache is dimensioned so that all
+    rows such a frame can read lie within it, cf. make_frame_row_cache, so
+    frame rows are normally never re-read from the frame buffer file; the
+    file is kept only as backing store. nullptr if the cache is not in use
+    for this window.
+  */
+  uchar *m_frame_row_cache;
+  /// Number of row slots in #m_frame_row_cache
+  int64 m_frame_row_cache_rows;
+  /// Partition-relative number (1-based) of the newest row in the cache
+  int64 m_frame_row_cache_last_rowno;
+  /// Number of valid rows in the cache, at most #m_frame_row_cache_rows
+  int64 m_frame_row_cache_count;
+
   /**
     Execution state: used iff m_needs_frame_buffering. Holds the row
     number (in the partition) of the last row (hitherto) saved in the frame
@@ -624,6 +643,10 @@ class Window {
         m_frame_buffer_partition_offset(0),
         m_row_has_fields_in_out_table(0),
         m_special_rows_cache_max_length(0),
+        m_frame_row_cache(nullptr),
+        m_frame_row_cache_rows(0),
+        m_frame_row_cache_last_rowno(0),
+        m_frame_row_cache_count(0),
         m_last_rowno_in_cache(0),
         m_last_rowno_in_peerset(0),
         m_is_last_row_in_peerset_within_frame(false),
@@ -1089,6 +1112,62 @@ class Window {
   */
   bool make_special_rows_cache(THD *thd, TABLE *out_tbl);
 
+  /**
+    Set up the in-memory frame row cache, cf. #m_frame_row_cache, if this
+    window qualifies for it: a ROWS frame with bounded extents, small enough
+    to cache, over rows without blob fields, and no window function needing
+    the peer set of the current row. If the window does not qualify, the
+    cache is simply left disabled.
+
+    @param thd      thread handle
+    @returns true if error (allocation failure)
+  */
+  bool make_frame_row_cache(THD *thd);
+
+  /**
+    Returns true if the in-memory frame row cache is in use for this window,
+    cf. #m_frame_row_cache. Note that the file position hints,
+    cf. #m_frame_buffer_positions, are not maintained while it is.
+  */
+  bool frame_row_cache_active() const { return m_frame_row_cache != nullptr; }
+
+  /**
+    Keep a copy of the frame buffer record just written for row rowno
+    (1-based, relative to start of partition) in the frame row cache,
+    evicting the oldest cached row if the cache is full. A no-op if the
+    cache is not in use.
+  */
+  void save_frame_row_to_cache(int64 rowno, const uchar *record) {
+    if (m_frame_row_cache == nullptr) return;
+    DBUG_ASSERT(rowno == 1 || rowno == m_frame_row_cache_last_rowno + 1);
+    if (rowno == 1) m_frame_row_cache_count = 0;  // new partition
+    const size_t reclength = m_frame_buffer->s->reclength;
+    std::memcpy(
+        m_frame_row_cache + (rowno % m_frame_row_cache_rows) * reclength,
+        record, reclength);
+    m_frame_row_cache_last_rowno = rowno;
+    if (m_frame_row_cache_count < m_frame_row_cache_rows)
+      ++m_frame_row_cache_count;
+  }
+
+  /**
+    Copy row rowno (1-based, relative to start of partition) of the current
+    partition from the frame row cache into record.
+
+    @returns true if the row was in the cache and has been restored
+  */
+  bool restore_frame_row_from_cache(int64 rowno, uchar *record) const {
+    if (rowno > m_frame_row_cache_last_rowno ||
+        rowno <= m_frame_row_cache_last_rowno - m_frame_row_cache_count)
+      return false;
+    const size_t reclength = m_frame_buffer->s->reclength;
+    std::memcpy(
+        record,
+        m_frame_row_cache + (rowno % m_frame_row_cache_rows) * reclength,
+        reclength);
+    return true;
+  }
+
   /**
     See #m_last_row_output
   */
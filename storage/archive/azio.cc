@@ -718,14 +718,10 @@ my_off_t ZEXPORT aztell(azio_stream *file) {
   Outputs a long in LSB order to the given file
 */
 void putLong(File file, uLong x) {
-  int n;
-  uchar buffer[1];
+  uchar buffer[4];
 
-  for (n = 0; n < 4; n++) {
-    buffer[0] = (int)(x & 0xff);
-    mysql_file_write(file, buffer, 1, MYF(0));
-    x >>= 8;
-  }
+  int4store(buffer, (uint32)x);
+  mysql_file_write(file, buffer, 4, MYF(0));
 }
 
 /* ===========================================================================
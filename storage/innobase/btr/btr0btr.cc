@@ -1023,6 +1023,11 @@ void btr_free_if_exists(const page_id_t &page_id, const page_size_t &page_size,
   btr_free_but_not_root(root, mtr->get_log_mode());
   btr_free_root(root, mtr);
   btr_free_root_invalidate(root, mtr);
+
+  /* The pages of the tree are removed from the buffer pool with their
+  content ignored, so they are never accounted one by one; drop the
+  whole counter instead. */
+  buf_stat_per_index->drop(index_id_t(page_id.space(), index_id));
 }
 
 /** Free an index tree in a temporary tablespace.
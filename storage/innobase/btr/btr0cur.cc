@@ -58,6 +58,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #ifndef UNIV_HOTBACKUP
 #include <zlib.h>
 #include "btr0btr.h"
+#include "btr0defrag.h"
 #include "btr0sea.h"
 #include "buf0lru.h"
 #ifdef UNIV_DEBUG
@@ -1081,6 +1082,10 @@ retry_page_get:
     tree_blocks[n_blocks] = block;
   }
 
+  /* Stamp the admission priority of the index on the page, so that
+  the LRU heuristics can consult it on later accesses. */
+  block->page.admission = static_cast<buf_admission_t>(index->admission);
+
   page = buf_block_get_frame(block);
 
   if (height == ULINT_UNDEFINED && page_is_leaf(page) &&
@@ -4644,6 +4649,18 @@ ibool btr_cur_optimistic_delete_func(
         ibuf_update_free_bits_low(block, max_ins, mtr);
       }
     }
+
+    /* The deletion has left the page under-filled; flag the table
+    for the background defragmenter, which merges such pages into
+    their siblings once the load allows. */
+    if (srv_btr_defrag_enabled && !srv_read_only_mode &&
+        page_get_data_size(page) <
+            BTR_CUR_PAGE_COMPRESS_LIMIT(cursor->index) &&
+        !cursor->index->table->is_temporary() &&
+        !cursor->index->table->is_intrinsic() &&
+        !dict_index_is_ibuf(cursor->index)) {
+      btr_defrag_pool_add(cursor->index->table);
+    }
   } else {
     /* prefetch siblings of the leaf for the pessimistic
     operation. */
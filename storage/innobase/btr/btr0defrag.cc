@@ -0,0 +1,439 @@
+/*****************************************************************************
+
+Copyright (c) 2020, Oracle and/or its affiliates. All Rights Reserved.
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU General Public License, version 2.0, as published by the
+Free Software Foundation.
+
+This program is also distributed with certain software (including but not
+limited to OpenSSL) that is licensed under separate terms, as designated in a
+particular file or component or in included license documentation. The authors
+of MySQL hereby grant you an additional permission to link the program and
+your derivative works with the separately licensed software that they have
+included with MySQL.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU General Public License, version 2.0,
+for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
+
+*****************************************************************************/
+
+/** @file btr/btr0defrag.cc
+ Background B-tree defragmentation
+
+ After heavy delete churn the leaf pages of an index can remain half
+ empty, so scans read almost twice the pages they need to. This thread
+ walks the leaf level of the indexes of tables that purged deletes have
+ flagged, and merges under-filled pages into their siblings with
+ btr_compress(), one page at a time and with an I/O budget, so the work
+ never competes seriously with user load. */
+
+#include "sql_thd_internal_api.h"
+
+#include <stddef.h>
+#include <sys/types.h>
+#include <vector>
+
+#include "btr0btr.h"
+#include "btr0cur.h"
+#include "btr0defrag.h"
+#include "btr0pcur.h"
+#include "dict0dd.h"
+#include "dict0dict.h"
+
+#include "os0thread-create.h"
+#include "srv0mon.h"
+#include "srv0srv.h"
+#include "srv0start.h"
+#include "ut0new.h"
+
+#define SHUTTING_DOWN() \
+  (srv_shutdown_state.load() >= SRV_SHUTDOWN_PRE_DD_AND_SYSTEM_TRANSACTIONS)
+
+/** Whether the background defragmenter is enabled;
+corresponds to innodb_defragment */
+bool srv_btr_defrag_enabled = false;
+
+/** Number of leaf pages the defragmenter may process per second;
+corresponds to innodb_defragment_pages_per_second */
+ulong srv_btr_defrag_pages_per_sec = 64;
+
+/** Event to wake up btr_defrag_thread() */
+os_event_t btr_defrag_event = nullptr;
+
+#ifdef UNIV_PFS_THREAD
+mysql_pfs_key_t btr_defrag_thread_key;
+#endif /* UNIV_PFS_THREAD */
+
+/** This mutex protects the "defrag_pool" variable. */
+static ib_mutex_t defrag_pool_mutex;
+
+/** The number of tables that can be waiting in "defrag_pool"; a table
+that is flagged while the pool is full is simply flagged again later */
+static const ulint DEFRAG_POOL_MAX_SLOTS = 128;
+
+/** Allocator type, used by std::vector */
+typedef ut_allocator<table_id_t> defrag_pool_allocator_t;
+
+/** The multitude of tables whose indexes are to be defragmented */
+typedef std::vector<table_id_t, defrag_pool_allocator_t> defrag_pool_t;
+
+/** Pool where we store the ids of the tables whose indexes the
+background thread should defragment */
+static defrag_pool_t *defrag_pool;
+
+/** Initialize the defrag pool, called once during thread initialization. */
+static void btr_defrag_pool_init() {
+  ut_ad(!srv_read_only_mode);
+
+  defrag_pool = UT_NEW_NOKEY(
+      defrag_pool_t(defrag_pool_allocator_t(PSI_NOT_INSTRUMENTED)));
+
+  defrag_pool->reserve(DEFRAG_POOL_MAX_SLOTS);
+}
+
+/** Free the resources occupied by the defrag pool, called once during
+thread de-initialization. */
+static void btr_defrag_pool_deinit() {
+  ut_ad(!srv_read_only_mode);
+
+  defrag_pool->clear();
+
+  UT_DELETE(defrag_pool);
+  defrag_pool = nullptr;
+}
+
+void btr_defrag_pool_add(const dict_table_t *table) {
+  ut_ad(!srv_read_only_mode);
+
+  mutex_enter(&defrag_pool_mutex);
+
+  if (defrag_pool->size() >= DEFRAG_POOL_MAX_SLOTS) {
+    mutex_exit(&defrag_pool_mutex);
+    return;
+  }
+
+  /* quit if already in the pool */
+  for (const auto id : *defrag_pool) {
+    if (id == table->id) {
+      mutex_exit(&defrag_pool_mutex);
+      return;
+    }
+  }
+
+  defrag_pool->push_back(table->id);
+
+  mutex_exit(&defrag_pool_mutex);
+
+  os_event_set(btr_defrag_event);
+}
+
+/** Get the first table id from the defrag pool.
+@param[out]	id	table id, if the pool was not empty
+@return true if the pool was not empty and "id" was set, false otherwise */
+static bool btr_defrag_pool_get(table_id_t *id) {
+  ut_ad(!srv_read_only_mode);
+
+  mutex_enter(&defrag_pool_mutex);
+
+  if (defrag_pool->empty()) {
+    mutex_exit(&defrag_pool_mutex);
+    return (false);
+  }
+
+  *id = defrag_pool->at(0);
+
+  defrag_pool->erase(defrag_pool->begin());
+
+  mutex_exit(&defrag_pool_mutex);
+
+  return (true);
+}
+
+void btr_defrag_pool_del(table_id_t id) {
+  ut_ad(!srv_read_only_mode);
+
+  mutex_enter(&defrag_pool_mutex);
+
+  for (auto iter = defrag_pool->begin(); iter != defrag_pool->end(); ++iter) {
+    if (*iter == id) {
+      defrag_pool->erase(iter);
+      break;
+    }
+  }
+
+  mutex_exit(&defrag_pool_mutex);
+}
+
+void btr_defrag_thread_init() {
+  ut_a(!srv_read_only_mode);
+
+  btr_defrag_event = os_event_create();
+
+  /* The defrag_pool_mutex is acquired from the purge threads while
+  they hold a leaf page latch, and from the defragmentation thread
+  before any other latch; neither path latches anything else while
+  holding it. */
+  mutex_create(LATCH_ID_BTR_DEFRAG_POOL, &defrag_pool_mutex);
+
+  btr_defrag_pool_init();
+}
+
+void btr_defrag_thread_deinit() {
+  ut_a(!srv_read_only_mode);
+  ut_ad(!srv_thread_is_active(srv_threads.m_btr_defrag));
+
+  if (defrag_pool == nullptr) {
+    return;
+  }
+
+  btr_defrag_pool_deinit();
+
+  mutex_free(&defrag_pool_mutex);
+
+  os_event_destroy(btr_defrag_event);
+  btr_defrag_event = nullptr;
+}
+
+/** Check whether a leaf page is worth merging into a sibling.
+@param[in]	index	index the page belongs to
+@param[in]	page	leaf page
+@param[in]	mtr	mini-transaction holding the page latch
+@return true if the page is under-filled and has a sibling */
+static bool btr_defrag_page_is_candidate(const dict_index_t *index,
+                                         const page_t *page, mtr_t *mtr) {
+  if (page_get_data_size(page) >= BTR_CUR_PAGE_COMPRESS_LIMIT(index)) {
+    return (false);
+  }
+
+  /* The root of a one-page tree has nothing to merge with. */
+  return (btr_page_get_prev(page, mtr) != FIL_NULL ||
+          btr_page_get_next(page, mtr) != FIL_NULL);
+}
+
+/** Try to merge one under-filled leaf page, identified by the key of its
+first user record, into a sibling.
+@param[in,out]	index	index to defragment
+@param[in]	key	key of the first user record of the page
+@return true if the page was merged */
+static bool btr_defrag_merge_page(dict_index_t *index, const dtuple_t *key) {
+  mtr_t mtr;
+  btr_pcur_t pcur;
+  bool merged = false;
+
+  mtr_start(&mtr);
+
+  /* This latches the leaf page and both of its siblings, which is
+  what btr_compress() requires on the leaf level. */
+  btr_pcur_open(index, key, PAGE_CUR_GE, BTR_MODIFY_TREE, &pcur, &mtr);
+
+  const rec_t *rec = btr_pcur_get_rec(&pcur);
+  page_t *page = btr_pcur_get_page(&pcur);
+
+  /* The page may have been merged, split or emptied since it was
+  inspected; re-check under the new latches. */
+  if (page_rec_is_user_rec(rec) && page_is_leaf(page) &&
+      btr_defrag_page_is_candidate(index, page, &mtr)) {
+    merged = btr_compress(btr_pcur_get_btr_cur(&pcur), FALSE, &mtr) != FALSE;
+  }
+
+  mtr_commit(&mtr);
+
+  btr_pcur_close(&pcur);
+
+  return (merged);
+}
+
+/** Walk the leaf level of an index and merge under-filled pages into
+their siblings. Releases all latches between pages and throttles itself
+to srv_btr_defrag_pages_per_sec pages per second.
+@param[in,out]	index	index to defragment */
+static void btr_defrag_index(dict_index_t *index) {
+  mtr_t mtr;
+  btr_pcur_t pcur;
+  mem_heap_t *heap = nullptr;
+  dtuple_t *resume = nullptr;
+
+  for (;;) {
+    if (SHUTTING_DOWN() || !srv_btr_defrag_enabled ||
+        index->is_corrupted()) {
+      break;
+    }
+
+    mtr_start(&mtr);
+
+    if (resume == nullptr) {
+      btr_pcur_open_at_index_side(true, index, BTR_SEARCH_LEAF, &pcur, true, 0,
+                                  &mtr);
+    } else {
+      btr_pcur_open(index, resume, PAGE_CUR_G, BTR_SEARCH_LEAF, &pcur, &mtr);
+    }
+
+    buf_block_t *block = btr_pcur_get_block(&pcur);
+    const page_t *page = buf_block_get_frame(block);
+
+    if (page_rec_is_supremum(btr_pcur_get_rec(&pcur))) {
+      /* All records of this page precede the resume key;
+      continue on the next page, which may be latched while
+      the current page latch is still held. */
+      const page_no_t next_page_no = btr_page_get_next(page, &mtr);
+
+      if (next_page_no == FIL_NULL) {
+        mtr_commit(&mtr);
+        btr_pcur_close(&pcur);
+        break;
+      }
+
+      block = btr_block_get(
+          page_id_t(dict_index_get_space(index), next_page_no),
+          dict_table_page_size(index->table), RW_S_LATCH, index, &mtr);
+      page = buf_block_get_frame(block);
+    }
+
+    rec_t *last = const_cast<rec_t *>(
+        page_rec_get_prev_const(page_get_supremum_rec(page)));
+
+    if (page_rec_is_infimum(last)) {
+      /* An empty page can only be an empty root. */
+      mtr_commit(&mtr);
+      btr_pcur_close(&pcur);
+      break;
+    }
+
+    /* Remember where to continue after this page; the key survives
+    any merge of the page, because the records keep their order. */
+    mem_heap_t *new_heap = mem_heap_create(256);
+
+    dtuple_t *new_resume = dict_index_build_data_tuple(
+        index, last, dict_index_get_n_unique(index), new_heap);
+
+    const bool candidate = btr_defrag_page_is_candidate(index, page, &mtr);
+    dtuple_t *first_key = nullptr;
+
+    if (candidate) {
+      rec_t *first = const_cast<rec_t *>(
+          page_rec_get_next_const(page_get_infimum_rec(page)));
+
+      first_key = dict_index_build_data_tuple(
+          index, first, dict_index_get_n_unique(index), new_heap);
+    }
+
+    mtr_commit(&mtr);
+
+    btr_pcur_close(&pcur);
+
+    if (heap != nullptr) {
+      mem_heap_free(heap);
+    }
+
+    heap = new_heap;
+    resume = new_resume;
+
+    MONITOR_INC(MONITOR_INDEX_DEFRAG_PAGES_SCANNED);
+
+    if (candidate && btr_defrag_merge_page(index, first_key)) {
+      MONITOR_INC(MONITOR_INDEX_DEFRAG_MERGE_SUCCESSFUL);
+    }
+
+    /* The I/O budget: at most srv_btr_defrag_pages_per_sec leaf
+    pages are inspected per second, all latches released in between. */
+    os_thread_sleep(1000000 / ut_max(static_cast<ulong>(1),
+                                     srv_btr_defrag_pages_per_sec));
+  }
+
+  if (heap != nullptr) {
+    mem_heap_free(heap);
+  }
+}
+
+/** Check whether an index should be skipped by the defragmenter.
+@param[in]	index	index to check
+@return true if the index cannot or need not be defragmented */
+static bool btr_defrag_skip_index(const dict_index_t *index) {
+  return (!index->is_committed() || index->is_corrupted() ||
+          dict_index_is_online_ddl(index) || dict_index_is_spatial(index) ||
+          (index->type & DICT_FTS) != 0 || index->page == FIL_NULL);
+}
+
+/** Get the first table from the defrag pool and merge the under-filled
+leaf pages of its indexes.
+@param[in,out]	thd	background thread handle */
+static void btr_defrag_process_entry_from_pool(THD *thd) {
+  table_id_t table_id;
+
+  ut_ad(!srv_read_only_mode);
+
+  if (!btr_defrag_pool_get(&table_id)) {
+    /* no tables to defragment */
+    return;
+  }
+
+  dict_table_t *table;
+  MDL_ticket *mdl = nullptr;
+
+  mutex_enter(&dict_sys->mutex);
+  table = dd_table_open_on_id(table_id, thd, &mdl, true, true);
+
+  if (table == nullptr) {
+    /* table does not exist, must have been DROPped
+    after its id was enqueued */
+    mutex_exit(&dict_sys->mutex);
+    return;
+  }
+
+  if (table->is_corrupted() || table->is_temporary() ||
+      table->ibd_file_missing) {
+    dd_table_close(table, thd, &mdl, true);
+    mutex_exit(&dict_sys->mutex);
+    return;
+  }
+
+  mutex_exit(&dict_sys->mutex);
+
+  for (dict_index_t *index = table->first_index(); index != nullptr;
+       index = index->next()) {
+    if (SHUTTING_DOWN() || !srv_btr_defrag_enabled) {
+      break;
+    }
+
+    if (!btr_defrag_skip_index(index)) {
+      btr_defrag_index(index);
+    }
+  }
+
+  dd_table_close(table, thd, &mdl, false);
+}
+
+void btr_defrag_thread() {
+  ut_a(!srv_read_only_mode);
+  THD *thd = create_thd(false, true, true, 0);
+
+  while (!SHUTTING_DOWN()) {
+    /* Wake up periodically even if not signaled, in case the
+    defragmenter was enabled while tables were already queued. */
+    os_event_wait_time(btr_defrag_event, 10 * 1000000);
+
+    if (SHUTTING_DOWN()) {
+      break;
+    }
+
+    if (srv_btr_defrag_enabled) {
+      btr_defrag_process_entry_from_pool(thd);
+    }
+
+    os_event_reset(btr_defrag_event);
+  }
+
+  destroy_thd(thd);
+}
+
+void btr_defrag_shutdown() {
+  os_event_set(btr_defrag_event);
+  srv_threads.m_btr_defrag.join();
+}
@@ -34,6 +34,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 
 #include <stddef.h>
 
+#include "buf0rea.h"
 #include "rem0cmp.h"
 #include "trx0trx.h"
 #include "ut0byte.h"
@@ -332,6 +333,24 @@ void btr_pcur_t::move_to_next_page(mtr_t *mtr) {
   }
 #endif /* UNIV_BTR_DEBUG */
 
+  /* A cursor that keeps crossing leaf sibling pointers is a logically
+  sequential scan even when the leaves are not in physical page order,
+  so the linear read-ahead in the buffer pool cannot see it. Once the
+  traversal looks sequential, stay one sibling ahead of the cursor with
+  an asynchronous read. The next page is latched at this point, so
+  peeking at its successor is safe. */
+  if (++m_leaf_pages_crossed >= BTR_PCUR_SIBLING_PREFETCH_THRESHOLD &&
+      !table->is_intrinsic()) {
+    auto prefetch_page_no = btr_page_get_next(next_page, mtr);
+
+    if (prefetch_page_no != FIL_NULL &&
+        buf_read_page_background(
+            page_id_t(block->page.id.space(), prefetch_page_no),
+            block->page.size, false)) {
+      os_aio_simulated_wake_handler_threads();
+    }
+  }
+
   btr_leaf_page_release(get_block(), mode, mtr);
 
   page_cur_set_before_first(next_block, get_page_cur());
@@ -86,6 +86,10 @@ byte btr_sea_pad2[64];
 /** The adaptive hash index */
 btr_search_sys_t *btr_search_sys;
 
+/** Per-partition statistics of the adaptive hash index, an array of
+btr_ahi_parts elements */
+btr_search_part_stat_t *btr_search_part_stats;
+
 /** If the number of records on the page divided by this parameter
 would have been successfully accessed using a hash index, the index
 is then built on the page, assuming the global limit has been reached */
@@ -218,6 +222,10 @@ void btr_search_sys_create(ulint hash_size) {
     btr_search_sys->hash_tables[i]->adaptive = TRUE;
 #endif /* UNIV_AHI_DEBUG || UNIV_DEBUG */
   }
+
+  /* Step-3: Allocate the per-partition statistics (1 per part). */
+  btr_search_part_stats = reinterpret_cast<btr_search_part_stat_t *>(
+      ut_zalloc(sizeof(btr_search_part_stat_t) * btr_ahi_parts, mem_key_ahi));
 }
 
 /** Resize hash index hash table.
@@ -280,6 +288,10 @@ void btr_search_sys_free() {
 
   ut_free(btr_search_latches);
   btr_search_latches = nullptr;
+
+  /* Step-3: Release the per-partition statistics. */
+  ut_free(btr_search_part_stats);
+  btr_search_part_stats = nullptr;
 }
 
 /** Set index->ref_count = 0 on all indexes of a table.
@@ -378,6 +390,11 @@ btr_search_t *btr_search_info_create(mem_heap_t *heap) {
 
   info->last_hash_succ = FALSE;
 
+  info->n_hash_succ_window = 0;
+  info->n_hash_fail_window = 0;
+  info->hash_disabled_auto = FALSE;
+  info->n_hash_auto_skipped = 0;
+
 #ifdef UNIV_SEARCH_PERF_STAT
   info->n_hash_succ = 0;
   info->n_hash_fail = 0;
@@ -828,7 +845,8 @@ exit_func:
   return (success);
 }
 
-static void btr_search_failure(btr_search_t *info, btr_cur_t *cursor) {
+static void btr_search_failure(dict_index_t *index, btr_search_t *info,
+                               btr_cur_t *cursor) {
   cursor->flag = BTR_CUR_HASH_FAIL;
 
 #ifdef UNIV_SEARCH_PERF_STAT
@@ -839,6 +857,26 @@ static void btr_search_failure(btr_search_t *info, btr_cur_t *cursor) {
   }
 #endif /* UNIV_SEARCH_PERF_STAT */
 
+  ++btr_search_part_stats[btr_get_search_part(index)].n_misses;
+
+  ++info->n_hash_fail_window;
+
+  /* If the failed hash searches clearly dominate an evaluation window,
+  suspend the use and building of the hash index for this index. The
+  counters are not protected by any latch, as for the other fields of
+  info; the controller only needs approximate values. */
+  if (info->n_hash_fail_window + info->n_hash_succ_window >=
+      BTR_SEARCH_AUTO_WINDOW) {
+    if (info->n_hash_fail_window >
+        info->n_hash_succ_window * BTR_SEARCH_AUTO_FAIL_FACTOR) {
+      info->hash_disabled_auto = TRUE;
+      info->n_hash_auto_skipped = 0;
+    }
+
+    info->n_hash_fail_window = 0;
+    info->n_hash_succ_window = 0;
+  }
+
   info->last_hash_succ = FALSE;
 }
 
@@ -886,6 +924,21 @@ ibool btr_search_guess_on_hash(dict_index_t *index, btr_search_t *info,
   /* Note that, for efficiency, the struct info may not be protected by
   any latch here! */
 
+  if (info->hash_disabled_auto) {
+    /* The automatic controller has suspended hash searches on this
+    index because of a poor hit ratio. After enough searches have been
+    skipped, lift the suspension and give the hash index another
+    chance. */
+    if (++info->n_hash_auto_skipped < BTR_SEARCH_AUTO_RETRY) {
+      return (FALSE);
+    }
+
+    info->hash_disabled_auto = FALSE;
+    info->n_hash_auto_skipped = 0;
+    info->n_hash_succ_window = 0;
+    info->n_hash_fail_window = 0;
+  }
+
   if (info->n_hash_potential == 0) {
     return (FALSE);
   }
@@ -912,7 +965,7 @@ ibool btr_search_guess_on_hash(dict_index_t *index, btr_search_t *info,
     if (!btr_search_enabled) {
       btr_search_s_unlock(index);
 
-      btr_search_failure(info, cursor);
+      btr_search_failure(index, info, cursor);
 
       return (FALSE);
     }
@@ -928,7 +981,7 @@ ibool btr_search_guess_on_hash(dict_index_t *index, btr_search_t *info,
       btr_search_s_unlock(index);
     }
 
-    btr_search_failure(info, cursor);
+    btr_search_failure(index, info, cursor);
 
     return (FALSE);
   }
@@ -942,7 +995,7 @@ ibool btr_search_guess_on_hash(dict_index_t *index, btr_search_t *info,
         btr_search_s_unlock(index);
       }
 
-      btr_search_failure(info, cursor);
+      btr_search_failure(index, info, cursor);
 
       return (FALSE);
     }
@@ -959,7 +1012,7 @@ ibool btr_search_guess_on_hash(dict_index_t *index, btr_search_t *info,
       btr_leaf_page_release(block, latch_mode, mtr);
     }
 
-    btr_search_failure(info, cursor);
+    btr_search_failure(index, info, cursor);
 
     return (FALSE);
   }
@@ -982,7 +1035,7 @@ ibool btr_search_guess_on_hash(dict_index_t *index, btr_search_t *info,
       btr_leaf_page_release(block, latch_mode, mtr);
     }
 
-    btr_search_failure(info, cursor);
+    btr_search_failure(index, info, cursor);
 
     return (FALSE);
   }
@@ -1025,6 +1078,10 @@ ibool btr_search_guess_on_hash(dict_index_t *index, btr_search_t *info,
 #endif
   info->last_hash_succ = TRUE;
 
+  ++btr_search_part_stats[btr_get_search_part(index)].n_hits;
+
+  ++info->n_hash_succ_window;
+
 #ifdef UNIV_SEARCH_PERF_STAT
   btr_search_n_succ++;
 #endif
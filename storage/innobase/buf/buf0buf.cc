@@ -111,6 +111,21 @@ struct set_numa_interleave_t {
   }
 };
 
+/** Determine the NUMA node to which a buffer pool instance is bound
+when srv_numa_node_bind is enabled. The instances are distributed
+round-robin over the configured nodes.
+@param[in]	instance_no	buffer pool instance number
+@return NUMA node number, or -1 if binding is not possible */
+static int buf_pool_numa_node(ulint instance_no) {
+  const int n_nodes = numa_num_configured_nodes();
+
+  if (n_nodes <= 1) {
+    return (-1);
+  }
+
+  return (static_cast<int>(instance_no % n_nodes));
+}
+
 #define NUMA_MEMPOLICY_INTERLEAVE_IN_SCOPE set_numa_interleave_t scoped_numa
 #else
 #define NUMA_MEMPOLICY_INTERLEAVE_IN_SCOPE
@@ -292,6 +307,10 @@ static const ulint BUF_READ_AHEAD_PORTION = 32;
 /** The buffer pools of the database */
 buf_pool_t *buf_pool_ptr;
 
+/** Buffer pool and read I/O work done by the current thread, see
+buf_stat_per_thread_t. */
+thread_local buf_stat_per_thread_t buf_stat_per_thread{};
+
 /** true when resizing buffer pool is in the critical path. */
 volatile bool buf_pool_resizing;
 
@@ -851,6 +870,22 @@ bool buf_chunk_t::madvise_dont_dump() {
 #endif /* HAVE_MADV_DONTDUMP */
 }
 
+/** Advices the OS that this chunk is a candidate for transparent huge
+pages. Emits a warning to the log if could not succeed.
+@return true iff succeeded, false if no OS support or failed */
+bool buf_chunk_t::madvise_huge() {
+#if defined(UNIV_LINUX) && defined(MADV_HUGEPAGE)
+  if (madvise(mem, mem_size(), MADV_HUGEPAGE)) {
+    ib::warn(ER_IB_MSG_MADVISE_FAILED, mem, mem_size(), "MADV_HUGEPAGE",
+             strerror(errno));
+    return false;
+  }
+  return true;
+#else  /* UNIV_LINUX && MADV_HUGEPAGE */
+  return false;
+#endif /* UNIV_LINUX && MADV_HUGEPAGE */
+}
+
 /* End of implementation of buf_chunk_t's methods */
 
 //! @endcond
@@ -872,6 +907,14 @@ bool buf_pool_t::allocate_chunk(ulonglong mem_size, buf_chunk_t *chunk) {
   if (chunk->mem == nullptr) {
     return false;
   }
+  /* Ask for transparent huge pages before the chunk is faulted in, so
+  that the pages can be mapped huge from the start. When explicit
+  hugetlbfs pages are in use the chunk is huge-backed already. The
+  advice is best effort: chunks the kernel cannot back with huge pages
+  simply stay on regular pages. */
+  if (srv_buf_pool_madvise_huge && !os_use_large_pages) {
+    chunk->madvise_huge();
+  }
   /* Dump core without large memory buffers */
   if (buf_pool_should_madvise) {
     if (!chunk->madvise_dont_dump()) {
@@ -1008,6 +1051,25 @@ static buf_chunk_t *buf_chunk_init(
                                 " (error: "
                              << strerror(errno) << ").";
     }
+  } else if (srv_numa_node_bind) {
+    const int node = buf_pool_numa_node(buf_pool->instance_no);
+
+    if (node >= 0) {
+      struct bitmask *nodemask = numa_allocate_nodemask();
+
+      numa_bitmask_setbit(nodemask, node);
+
+      int st = mbind(chunk->mem, chunk->mem_size(), MPOL_BIND, nodemask->maskp,
+                     nodemask->size, MPOL_MF_MOVE);
+      if (st != 0) {
+        ib::warn(ER_IB_MSG_54) << "Failed to bind buffer pool instance "
+                               << buf_pool->instance_no
+                               << " page frames to NUMA node " << node
+                               << " (error: " << strerror(errno) << ").";
+      }
+
+      numa_free_nodemask(nodemask);
+    }
   }
 #endif /* HAVE_LIBNUMA */
 
@@ -1222,6 +1284,22 @@ static void buf_pool_create(buf_pool_t *buf_pool, ulint buf_pool_size,
 
   ut_ad(buf_pool_size % srv_buf_pool_chunk_unit == 0);
 
+  /* Set the instance number before any allocation so that the chunk
+  and auxiliary structure allocations below can be made node-local. */
+  buf_pool->instance_no = instance_no;
+
+#ifdef HAVE_LIBNUMA
+  if (srv_numa_node_bind) {
+    const int node = buf_pool_numa_node(instance_no);
+
+    if (node >= 0) {
+      /* Prefer the instance's node for the page hash, mutexes and
+      list headers allocated by this thread below. */
+      numa_set_preferred(node);
+    }
+  }
+#endif /* HAVE_LIBNUMA */
+
   /* 1. Initialize general fields
   ------------------------------- */
   mutex_create(LATCH_ID_BUF_POOL_CHUNKS, &buf_pool->chunks_mutex);
@@ -1286,7 +1364,6 @@ static void buf_pool_create(buf_pool_t *buf_pool, ulint buf_pool_size,
     } while (++chunk < buf_pool->chunks + buf_pool->n_chunks);
     mutex_exit(&buf_pool->chunks_mutex);
 
-    buf_pool->instance_no = instance_no;
     buf_pool->read_ahead_area = static_cast<page_no_t>(
         ut_min(BUF_READ_AHEAD_PAGES,
                ut_2_power_up(buf_pool->curr_size / BUF_READ_AHEAD_PORTION)));
@@ -1308,6 +1385,10 @@ static void buf_pool_create(buf_pool_t *buf_pool, ulint buf_pool_size,
 
     buf_pool->page_hash_old = nullptr;
 
+    buf_pool->page_hash_versions = static_cast<std::atomic<uint64_t> *>(
+        ut_zalloc_nokey(buf_pool->page_hash->n_sync_obj *
+                        sizeof(std::atomic<uint64_t>)));
+
     buf_pool->zip_hash = hash_create(2 * buf_pool->curr_size);
 
     buf_pool->last_printout_time = ut_time_monotonic();
@@ -1348,6 +1429,13 @@ static void buf_pool_create(buf_pool_t *buf_pool, ulint buf_pool_size,
   /* Initialize the iterator for single page scan search */
   new (&buf_pool->single_scan_itr) LRUItr(buf_pool, &buf_pool->LRU_list_mutex);
 
+#ifdef HAVE_LIBNUMA
+  if (srv_numa_node_bind) {
+    /* Restore the default allocation policy for this thread. */
+    numa_set_localalloc();
+  }
+#endif /* HAVE_LIBNUMA */
+
   err = DB_SUCCESS;
 }
 
@@ -1411,6 +1499,12 @@ static void buf_pool_free_instance(buf_pool_t *buf_pool) {
   mutex_free(&buf_pool->chunks_mutex);
   ha_clear(buf_pool->page_hash);
   hash_table_free(buf_pool->page_hash);
+  if (buf_pool->page_hash_old != nullptr) {
+    hash_table_free(buf_pool->page_hash_old);
+    buf_pool->page_hash_old = nullptr;
+  }
+  ut_free(buf_pool->page_hash_versions);
+  buf_pool->page_hash_versions = nullptr;
   hash_table_free(buf_pool->zip_hash);
 
   buf_pool->allocator.~ut_allocator();
@@ -1608,9 +1702,11 @@ static bool buf_page_realloc(buf_pool_t *buf_pool, buf_block_t *block) {
     ut_d(block->page.in_page_hash = FALSE);
     ulint fold = block->page.id.fold();
     ut_ad(fold == new_block->page.id.fold());
+    buf_page_hash_modify_enter(buf_pool, fold);
     HASH_DELETE(buf_page_t, hash, buf_pool->page_hash, fold, (&block->page));
     HASH_INSERT(buf_page_t, hash, buf_pool->page_hash, fold,
                 (&new_block->page));
+    buf_page_hash_modify_exit(buf_pool, fold);
 
     ut_ad(new_block->page.in_page_hash);
 
@@ -1914,7 +2010,15 @@ static void buf_pool_resize_hash(buf_pool_t *buf_pool) {
   hash_table_t *new_hash_table;
 
   ut_ad(mutex_own(&buf_pool->zip_hash_mutex));
-  ut_ad(buf_pool->page_hash_old == nullptr);
+
+  /* The old page_hash of the previous resize is kept around until here
+  so that a latch-free lookup that read the page_hash pointer just
+  before that resize never dereferences freed cells. Any such lookup
+  has long since retired. */
+  if (buf_pool->page_hash_old != nullptr) {
+    hash_table_free(buf_pool->page_hash_old);
+    buf_pool->page_hash_old = nullptr;
+  }
 
   /* recreate page_hash */
   new_hash_table = ib_recreate(buf_pool->page_hash, 2 * buf_pool->curr_size);
@@ -2430,10 +2534,9 @@ withdraw_retry:
     hash_unlock_x_all(buf_pool->page_hash);
     mutex_exit(&buf_pool->LRU_list_mutex);
 
-    if (buf_pool->page_hash_old != nullptr) {
-      hash_table_free(buf_pool->page_hash_old);
-      buf_pool->page_hash_old = nullptr;
-    }
+    /* buf_pool->page_hash_old is kept until the next resize (or
+    shutdown) for the benefit of latch-free lookups; see
+    buf_pool_resize_hash(). */
   }
 
   buf_pool_resizing = false;
@@ -2656,8 +2759,10 @@ static void buf_relocate(buf_page_t *bpage, buf_page_t *dpage) {
   /* relocate buf_pool->page_hash */
   ulint fold = bpage->id.fold();
   ut_ad(fold == dpage->id.fold());
+  buf_page_hash_modify_enter(buf_pool, fold);
   HASH_DELETE(buf_page_t, hash, buf_pool->page_hash, fold, bpage);
   HASH_INSERT(buf_page_t, hash, buf_pool->page_hash, fold, dpage);
+  buf_page_hash_modify_exit(buf_pool, fold);
 }
 
 /** Hazard Pointer implementation. */
@@ -2836,8 +2941,10 @@ static buf_page_t *buf_pool_watch_set(const page_id_t &page_id,
         bpage->buf_pool_index = buf_pool_index(buf_pool);
 
         ut_d(bpage->in_page_hash = TRUE);
+        buf_page_hash_modify_enter(buf_pool, page_id.fold());
         HASH_INSERT(buf_page_t, hash, buf_pool->page_hash, page_id.fold(),
                     bpage);
+        buf_page_hash_modify_exit(buf_pool, page_id.fold());
 
         mutex_exit(&buf_pool->LRU_list_mutex);
 
@@ -2878,7 +2985,9 @@ static void buf_pool_watch_remove(buf_pool_t *buf_pool, buf_page_t *watch) {
 
   ut_ad(buf_page_get_state(watch) == BUF_BLOCK_ZIP_PAGE);
 
+  buf_page_hash_modify_enter(buf_pool, watch->id.fold());
   HASH_DELETE(buf_page_t, hash, buf_pool->page_hash, watch->id.fold(), watch);
+  buf_page_hash_modify_exit(buf_pool, watch->id.fold());
   ut_d(watch->in_page_hash = FALSE);
   watch->buf_fix_count = 0;
   watch->state = BUF_BLOCK_POOL_WATCH;
@@ -2960,6 +3069,24 @@ static void buf_page_make_young_if_needed(buf_page_t *bpage) {
   ut_ad(bpage->buf_fix_count > 0);
   ut_a(buf_page_in_file(bpage));
 
+  switch (bpage->admission) {
+    case BUF_ADMISSION_COLD:
+      /* Pages of a cold-hinted index stay in the old sublist until
+      they are evicted. */
+      return;
+
+    case BUF_ADMISSION_HOT:
+      /* Pages of a hot-hinted index skip the midpoint probation and
+      are made young on the first access. */
+      if (bpage->old) {
+        buf_page_make_young(bpage);
+      }
+      return;
+
+    case BUF_ADMISSION_DEFAULT:
+      break;
+  }
+
   if (buf_page_peek_if_too_old(bpage)) {
     buf_page_make_young(bpage);
   }
@@ -3070,6 +3197,7 @@ buf_page_t *buf_page_get_zip(const page_id_t &page_id,
   buf_pool_t *buf_pool = buf_pool_get(page_id);
 
   Counter::inc(buf_pool->stat.m_n_page_gets, page_id.page_no());
+  ++buf_stat_per_thread.n_page_gets;
 
   for (;;) {
   lookup:
@@ -3408,6 +3536,8 @@ struct Buf_fetch {
 
   buf_block_t *lookup();
 
+  buf_block_t *lookup_nolatch();
+
   buf_block_t *is_on_watch();
 
   void read_page();
@@ -3451,6 +3581,15 @@ struct Buf_fetch_normal : public Buf_fetch<Buf_fetch_normal> {
 };
 
 dberr_t Buf_fetch_normal::get(buf_block_t *&block) {
+  /* Try to satisfy the common case, a page that is resident in the
+  pool, without touching the page_hash rw-lock at all. */
+  block = lookup_nolatch();
+
+  if (block != nullptr) {
+    /* The block has already been buf-fixed. */
+    return (DB_SUCCESS);
+  }
+
   /* Keep this path as simple as possible. */
   for (;;) {
     /* Lookup the page in the page hash. If it doesn't exist in the
@@ -3573,6 +3712,84 @@ buf_block_t *Buf_fetch<T>::lookup() {
   return (block);
 }
 
+/** Look up the page in the page hash without acquiring the page_hash
+rw-lock, validating the result against the shard's modification counter
+(seqlock protocol). The walk itself only dereferences the hash cell
+array and buf_page_t descriptors, both of which stay allocated while
+the fast path is enabled: the path is disabled while the buffer pool is
+being resized, and a replaced page_hash is kept around until the next
+resize. A candidate is confirmed under its block mutex, which
+serializes us against buf_page_can_relocate() checks, so the page
+cannot start being removed from the hash between the re-validation and
+the buf-fix. Any ambiguity (miss, sentinel, compressed-only page, shard
+being modified) falls back to the latched path.
+@return buf-fixed block, or nullptr if the latched lookup must be used */
+template <typename T>
+buf_block_t *Buf_fetch<T>::lookup_nolatch() {
+  /* Maximum number of chain nodes to follow; a stale walk could
+  otherwise chase a cycle created by concurrent modifications. */
+  constexpr ulint MAX_WALK = 128;
+
+  if (buf_pool_resizing) {
+    /* page_hash and the chunks are in flux; use the latched path. */
+    return (nullptr);
+  }
+
+  const ulint fold = m_page_id.fold();
+
+  hash_table_t *page_hash = m_buf_pool->page_hash;
+
+  auto &version = m_buf_pool
+                      ->page_hash_versions[hash_get_sync_obj_index(page_hash,
+                                                                   fold)];
+
+  const uint64_t begin_version = version.load(std::memory_order_acquire);
+
+  if (begin_version & 1) {
+    /* A modification of this shard is in progress. */
+    return (nullptr);
+  }
+
+  auto bpage = static_cast<buf_page_t *>(
+      HASH_GET_FIRST(page_hash, hash_calc_hash(fold, page_hash)));
+
+  for (ulint i = 0; bpage != nullptr && m_page_id != bpage->id; ++i) {
+    if (i >= MAX_WALK ||
+        version.load(std::memory_order_acquire) != begin_version) {
+      return (nullptr);
+    }
+
+    bpage = static_cast<buf_page_t *>(HASH_GET_NEXT(hash, bpage));
+  }
+
+  if (bpage == nullptr || buf_page_get_state(bpage) != BUF_BLOCK_FILE_PAGE) {
+    /* Treat misses, watch sentinels and compressed-only pages as
+    ambiguous; the latched path sorts them out. */
+    return (nullptr);
+  }
+
+  auto block = reinterpret_cast<buf_block_t *>(bpage);
+
+  mutex_enter(&block->mutex);
+
+  if (version.load(std::memory_order_acquire) != begin_version ||
+      buf_pool_resizing || m_page_id != block->page.id ||
+      buf_block_get_state(block) != BUF_BLOCK_FILE_PAGE) {
+    mutex_exit(&block->mutex);
+
+    return (nullptr);
+  }
+
+  buf_block_fix(block);
+
+  mutex_exit(&block->mutex);
+
+  /* For the debug latch-ownership assertions further down the fetch. */
+  m_hash_lock = buf_page_hash_lock_get(m_buf_pool, m_page_id);
+
+  return (block);
+}
+
 template <typename T>
 buf_block_t *Buf_fetch<T>::is_on_watch() {
   ut_ad(m_mode == Page_fetch::IF_IN_POOL_OR_WATCH);
@@ -4008,6 +4225,7 @@ buf_block_t *Buf_fetch<T>::single_page() {
   buf_block_t *block;
 
   Counter::inc(m_buf_pool->stat.m_n_page_gets, m_page_id.page_no());
+  ++buf_stat_per_thread.n_page_gets;
 
   for (;;) {
     if (static_cast<T *>(this)->get(block) == DB_NOT_FOUND) {
@@ -4309,6 +4527,7 @@ bool buf_page_optimistic_get(ulint rw_latch, buf_block_t *block,
   {
     auto buf_pool = buf_pool_from_block(block);
     Counter::inc(buf_pool->stat.m_n_page_gets, block->page.id.page_no());
+    ++buf_stat_per_thread.n_page_gets;
   }
 
   return (true);
@@ -4402,6 +4621,7 @@ bool buf_page_get_known_nowait(ulint rw_latch, buf_block_t *block,
 #endif /* UNIV_IBUF_COUNT_DEBUG */
 
   Counter::inc(buf_pool->stat.m_n_page_gets, block->page.id.page_no());
+  ++buf_stat_per_thread.n_page_gets;
 
   return (true);
 }
@@ -4473,6 +4693,7 @@ const buf_block_t *buf_page_try_get_func(const page_id_t &page_id,
   buf_block_dbg_add_level(block, SYNC_NO_ORDER_CHECK);
 
   Counter::inc(buf_pool->stat.m_n_page_gets, block->page.id.page_no());
+  ++buf_stat_per_thread.n_page_gets;
 
 #ifdef UNIV_IBUF_COUNT_DEBUG
   ut_a(ibuf_count_get(block->page.id) == 0);
@@ -4490,6 +4711,7 @@ void buf_page_init_low(buf_page_t *bpage) /*!< in: block to init */
   bpage->buf_fix_count = 0;
   bpage->freed_page_clock = 0;
   bpage->access_time = 0;
+  bpage->admission = BUF_ADMISSION_DEFAULT;
   bpage->newest_modification = 0;
   bpage->oldest_modification = 0;
   HASH_INVALIDATE(bpage, hash);
@@ -4566,8 +4788,10 @@ static void buf_page_init(buf_pool_t *buf_pool, const page_id_t &page_id,
   block->page.id = page_id;
   block->page.size.copy_from(page_size);
 
+  buf_page_hash_modify_enter(buf_pool, page_id.fold());
   HASH_INSERT(buf_page_t, hash, buf_pool->page_hash, page_id.fold(),
               &block->page);
+  buf_page_hash_modify_exit(buf_pool, page_id.fold());
 
   if (page_size.is_compressed()) {
     page_zip_set_size(&block->page.zip, page_size.physical());
@@ -4759,7 +4983,9 @@ buf_page_t *buf_page_init_for_read(dberr_t *err, ulint mode,
       buf_pool_watch_remove(buf_pool, watch_page);
     }
 
+    buf_page_hash_modify_enter(buf_pool, bpage->id.fold());
     HASH_INSERT(buf_page_t, hash, buf_pool->page_hash, bpage->id.fold(), bpage);
+    buf_page_hash_modify_exit(buf_pool, bpage->id.fold());
 
     rw_lock_x_unlock(hash_lock);
 
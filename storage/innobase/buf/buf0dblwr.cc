@@ -284,7 +284,7 @@ class Double_write {
     return s_instances->at(i);
   }
 
-  /** Wait for any pending batch to complete.
+  /** Wait if the batch pipeline is full.
   @return true if the thread had to wait for another batch. */
   bool wait_for_pending_batch() noexcept {
     ut_ad(mutex_own(&m_mutex));
@@ -293,7 +293,8 @@ class Double_write {
 
     std::atomic_thread_fence(std::memory_order_acquire);
 
-    if (m_batch_running.load(std::memory_order_acquire)) {
+    if (m_batches_running.load(std::memory_order_acquire) >=
+        MAX_PENDING_BATCHES) {
       mutex_exit(&m_mutex);
 
       MONITOR_INC(MONITOR_DBLWR_FLUSH_WAIT_EVENTS);
@@ -311,7 +312,9 @@ class Double_write {
   bool flush_to_disk(buf_flush_t flush_type) noexcept {
     ut_ad(mutex_own(&m_mutex));
 
-    /* Wait for any batch writes that are in progress. */
+    /* Batches write to distinct file segments and the data file writes
+    are asynchronous, so a bounded number of batches is allowed to be in
+    flight concurrently; wait only when the pipeline is full. */
     if (wait_for_pending_batch()) {
       ut_ad(!mutex_own(&m_mutex));
       return false;
@@ -385,12 +388,12 @@ class Double_write {
 
   /** Note that the IO batch has started. */
   void batch_started() noexcept {
-    m_batch_running.store(true, std::memory_order_release);
+    m_batches_running.fetch_add(1, std::memory_order_release);
   }
 
-  /** Wake up all the threads that were waiting for the batch to complete. */
+  /** Wake up all the threads that were waiting for a batch to complete. */
   void batch_completed() noexcept {
-    m_batch_running.store(false, std::memory_order_release);
+    m_batches_running.fetch_sub(1, std::memory_order_release);
     std::atomic_thread_fence(std::memory_order_release);
     os_event_set(m_event);
   }
@@ -592,8 +595,15 @@ class Double_write {
   /** Wait for IO batch to complete. */
   os_event_t m_event;
 
-  /** true if the the batch hasn't completed yet. */
-  std::atomic_bool m_batch_running{false};
+  /** Maximum number of batches that may be in flight for one instance
+  before a new flush request has to wait. Batches write to distinct file
+  segments and the data file writes are asynchronous, so pipelining them
+  is safe; the cap merely bounds how many segments one instance can
+  hold at a time. */
+  static constexpr uint32_t MAX_PENDING_BATCHES = 2;
+
+  /** Number of batches that haven't completed yet. */
+  std::atomic<uint32_t> m_batches_running{0};
 
   /** The copy of the page frame, the page must be in in m_buf_pages. */
   Buffer m_buffer;
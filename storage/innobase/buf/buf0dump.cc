@@ -34,6 +34,9 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <stdarg.h>
 #include <stdio.h>
 #include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 #include "buf0buf.h"
 #include "buf0dump.h"
@@ -422,9 +425,71 @@ void buf_load_throttle_if_needed(ib_time_monotonic_ms_t *last_check_time,
   *last_activity_count = srv_get_activity_count();
 }
 
+/** Load a contiguous range of the sorted dump array, issuing background
+reads. Executed by the buf_load() worker threads; because dump[] is
+sorted by (space, page), the pages of a tablespace are mostly read by a
+single worker and fil_space_acquire_silent() is only called on space
+boundaries. Each worker throttles its own IO against foreground
+activity, so together they respect N * srv_io_capacity.
+@param[in]	dump		sorted array of pages to load
+@param[in]	start		first index of the range to load
+@param[in]	end		one past the last index of the range
+@param[in,out]	n_loaded	shared count of dump entries processed */
+static void buf_load_range(const buf_dump_t *dump, ulint start, ulint end,
+                           std::atomic<ulint> *n_loaded) {
+  ib_time_monotonic_ms_t last_check_time = 0;
+  ulint last_activity_cnt = 0;
+
+  space_id_t cur_space_id = BUF_DUMP_SPACE(dump[start]);
+  fil_space_t *space = fil_space_acquire_silent(cur_space_id);
+  page_size_t page_size(space ? space->flags : 0);
+
+  for (ulint i = start; i < end && !SHUTTING_DOWN() && !buf_load_abort_flag;
+       i++) {
+    /* space_id for this iteration of the loop */
+    const space_id_t this_space_id = BUF_DUMP_SPACE(dump[i]);
+
+    if (this_space_id != cur_space_id) {
+      if (space != nullptr) {
+        fil_space_release(space);
+      }
+
+      cur_space_id = this_space_id;
+      space = fil_space_acquire_silent(cur_space_id);
+
+      if (space != nullptr) {
+        const page_size_t cur_page_size(space->flags);
+        page_size.copy_from(cur_page_size);
+      }
+    }
+
+    n_loaded->fetch_add(1, std::memory_order_relaxed);
+
+    if (space == nullptr) {
+      continue;
+    }
+
+    buf_read_page_background(page_id_t(this_space_id, BUF_DUMP_PAGE(dump[i])),
+                             page_size, true);
+
+    if (i % 64 == 63) {
+      os_aio_simulated_wake_handler_threads();
+    }
+
+    buf_load_throttle_if_needed(&last_check_time, &last_activity_cnt,
+                                i - start);
+  }
+
+  if (space != nullptr) {
+    fil_space_release(space);
+  }
+}
+
 /** Perform a buffer pool load from the file specified by
  innodb_buffer_pool_filename. If any errors occur then the value of
  innodb_buffer_pool_load_status will be set accordingly, see buf_load_status().
+ The load is performed by innodb_buffer_pool_load_threads worker threads,
+ each driving background reads for a contiguous range of the sorted dump.
  The dump filename can be specified by (relative to srv_data_home):
  SET GLOBAL innodb_buffer_pool_filename='filename'; */
 static void buf_load() {
@@ -562,16 +627,6 @@ static void buf_load() {
     std::sort(dump, dump + dump_n);
   }
 
-  ib_time_monotonic_ms_t last_check_time = 0;
-  ulint last_activity_cnt = 0;
-
-  /* Avoid calling the expensive fil_space_acquire_silent() for each
-  page within the same tablespace. dump[] is sorted by (space, page),
-  so all pages from a given tablespace are consecutive. */
-  space_id_t cur_space_id = BUF_DUMP_SPACE(dump[0]);
-  fil_space_t *space = fil_space_acquire_silent(cur_space_id);
-  page_size_t page_size(space ? space->flags : 0);
-
 #ifdef HAVE_PSI_STAGE_INTERFACE
   PSI_stage_progress *pfs_stage_progress =
       mysql_set_stage(srv_stage_buffer_pool_load.m_key);
@@ -580,69 +635,60 @@ static void buf_load() {
   mysql_stage_set_work_estimated(pfs_stage_progress, dump_n);
   mysql_stage_set_work_completed(pfs_stage_progress, 0);
 
-  for (i = 0; i < dump_n && !SHUTTING_DOWN(); i++) {
-    /* space_id for this iteration of the loop */
-    const space_id_t this_space_id = BUF_DUMP_SPACE(dump[i]);
+  /* Partition the sorted dump into contiguous ranges, one per worker,
+  so that each tablespace is read mostly by one thread. Do not spawn
+  more workers than there are reasonably sized ranges. */
+  ulint n_threads = static_cast<ulint>(srv_buf_pool_load_threads);
 
-    if (this_space_id != cur_space_id) {
-      if (space != nullptr) {
-        fil_space_release(space);
-      }
+  n_threads = ut_min(n_threads, dump_n / 1024 + 1);
 
-      cur_space_id = this_space_id;
-      space = fil_space_acquire_silent(cur_space_id);
+  std::atomic<ulint> n_loaded{0};
+  std::vector<std::thread> workers;
 
-      if (space != nullptr) {
-        const page_size_t cur_page_size(space->flags);
-        page_size.copy_from(cur_page_size);
-      }
-    }
+  const ulint per_thread = dump_n / n_threads + 1;
 
-    if (space == nullptr) {
-      continue;
-    }
+  for (ulint t = 0; t < n_threads; t++) {
+    const ulint start = t * per_thread;
+    const ulint end = ut_min(start + per_thread, dump_n);
 
-    buf_read_page_background(page_id_t(this_space_id, BUF_DUMP_PAGE(dump[i])),
-                             page_size, true);
-
-    if (i % 64 == 63) {
-      os_aio_simulated_wake_handler_threads();
+    if (start >= end) {
+      break;
     }
 
-    /* Update the progress every 32 MiB, which is every Nth page,
-    where N = 32*1024^2 / page_size. */
-    static const ulint update_status_every_n_mb = 32;
-    static const ulint update_status_every_n_pages =
-        update_status_every_n_mb * 1024 * 1024 / page_size.physical();
+    workers.emplace_back(buf_load_range, dump, start, end, &n_loaded);
+  }
 
-    if (i % update_status_every_n_pages == 0) {
-      buf_load_status(STATUS_VERBOSE, "Loaded " ULINTPF "/" ULINTPF " pages",
-                      i + 1, dump_n);
-      mysql_stage_set_work_completed(pfs_stage_progress, i);
-    }
+  /* Report the progress while the workers are running. */
+  while (n_loaded.load(std::memory_order_relaxed) < dump_n &&
+         !SHUTTING_DOWN() && !buf_load_abort_flag) {
+    os_thread_sleep(100000 /* 100 ms */);
 
-    if (buf_load_abort_flag) {
-      if (space != nullptr) {
-        fil_space_release(space);
-      }
-      buf_load_abort_flag = FALSE;
-      ut_free(dump);
-      buf_load_status(STATUS_INFO, "Buffer pool(s) load aborted on request");
-      /* Premature end, set estimated = completed = i and
-      end the current stage event. */
-      mysql_stage_set_work_estimated(pfs_stage_progress, i);
-      mysql_stage_set_work_completed(pfs_stage_progress, i);
-#ifdef HAVE_PSI_STAGE_INTERFACE
-      mysql_end_stage();
-#endif /* HAVE_PSI_STAGE_INTERFACE */
-      return;
-    }
+    const ulint cur = n_loaded.load(std::memory_order_relaxed);
 
-    buf_load_throttle_if_needed(&last_check_time, &last_activity_cnt, i);
+    buf_load_status(STATUS_VERBOSE, "Loaded " ULINTPF "/" ULINTPF " pages", cur,
+                    dump_n);
+    mysql_stage_set_work_completed(pfs_stage_progress, cur);
   }
 
-  if (space != nullptr) {
-    fil_space_release(space);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  if (buf_load_abort_flag) {
+    buf_load_abort_flag = FALSE;
+
+    const ulint cur = n_loaded.load(std::memory_order_relaxed);
+
+    ut_free(dump);
+    buf_load_status(STATUS_INFO, "Buffer pool(s) load aborted on request");
+    /* Premature end, set estimated = completed and end the current
+    stage event. */
+    mysql_stage_set_work_estimated(pfs_stage_progress, cur);
+    mysql_stage_set_work_completed(pfs_stage_progress, cur);
+#ifdef HAVE_PSI_STAGE_INTERFACE
+    mysql_end_stage();
+#endif /* HAVE_PSI_STAGE_INTERFACE */
+    return;
   }
 
   ut_free(dump);
@@ -35,6 +35,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <mysql/service_thd_wait.h>
 #include <sys/types.h>
 #include <time.h>
+#include <vector>
 
 #ifndef UNIV_HOTBACKUP
 #include "buf0buf.h"
@@ -504,6 +505,8 @@ void buf_flush_insert_into_flush_list(
   ut_ad(mutex_own(buf_page_get_mutex(&block->page)));
   ut_ad(log_sys != nullptr);
 
+  ++buf_stat_per_thread.n_pages_dirtied;
+
   buf_flush_list_mutex_enter(buf_pool);
 
   /* If we are in the recovery then we need to update the flush
@@ -1837,36 +1840,69 @@ static ulint buf_do_flush_list_batch(buf_pool_t *buf_pool, ulint min_n,
   ulint count = 0;
   ulint scanned = 0;
 
-  /* Start from the end of the list looking for a suitable
-  block to be flushed. */
+  /* Number of flush candidates collected per flush_list_mutex
+  acquisition; they are flushed with the mutex released, so the mutex
+  is taken once per chunk instead of being cycled for every page. */
+  constexpr ulint FLUSH_LIST_SCAN_CHUNK = 64;
+
+  std::vector<page_id_t> chunk;
+  chunk.reserve(FLUSH_LIST_SCAN_CHUNK);
+
+  /* Start from the end of the list looking for suitable blocks to
+  be flushed. */
   buf_flush_list_mutex_enter(buf_pool);
-  ulint len = UT_LIST_GET_LEN(buf_pool->flush_list);
-
-  /* In order not to degenerate this scan to O(n*n) we attempt
-  to preserve pointer of previous block in the flush list. To do
-  so we declare it a hazard pointer. Any thread working on the
-  flush list must check the hazard pointer and if it is removing
-  the same block then it must reset it. */
-  for (buf_page_t *bpage = UT_LIST_GET_LAST(buf_pool->flush_list);
-       count < min_n && bpage != nullptr && len > 0 &&
-       bpage->oldest_modification < lsn_limit;
-       bpage = buf_pool->flush_hp.get(), ++scanned) {
-    buf_page_t *prev;
-
-    ut_a(bpage->oldest_modification > 0);
-    ut_ad(bpage->in_flush_list);
 
-    prev = UT_LIST_GET_PREV(list, bpage);
-    buf_pool->flush_hp.set(prev);
+  buf_page_t *bpage = UT_LIST_GET_LAST(buf_pool->flush_list);
 
-#ifdef UNIV_DEBUG
-    bool flushed =
-#endif /* UNIV_DEBUG */
-        buf_flush_page_and_try_neighbors(bpage, BUF_FLUSH_LIST, min_n, &count);
+  while (count < min_n && bpage != nullptr &&
+         bpage->oldest_modification < lsn_limit) {
+    chunk.clear();
 
-    ut_ad(flushed || buf_pool->flush_hp.is_hp(prev));
+    /* Collect a chunk of flushable pages. The list cannot change
+    under us here, as we hold the flush list mutex throughout. */
+    while (bpage != nullptr && chunk.size() < FLUSH_LIST_SCAN_CHUNK &&
+           count + chunk.size() < min_n &&
+           bpage->oldest_modification < lsn_limit) {
+      ut_a(bpage->oldest_modification > 0);
+      ut_ad(bpage->in_flush_list);
 
-    --len;
+      ++scanned;
+
+      if (buf_flush_ready_for_flush(bpage, BUF_FLUSH_LIST)) {
+        chunk.push_back(bpage->id);
+      }
+
+      bpage = UT_LIST_GET_PREV(list, bpage);
+    }
+
+    if (chunk.empty()) {
+      break;
+    }
+
+    /* In order not to degenerate this scan to O(n*n) we preserve the
+    resume position in the flush list while the mutex is released by
+    declaring it a hazard pointer. Any thread working on the flush
+    list must check the hazard pointer and if it is removing the same
+    block then it must reset it. */
+    buf_pool->flush_hp.set(bpage);
+
+    /* Flush the collected pages (and their neighbors) without
+    holding the flush list mutex. Every page is re-checked under its
+    own latches by buf_flush_try_neighbors(); a page that was flushed
+    or removed by somebody else in the meantime is simply skipped. */
+    buf_flush_list_mutex_exit(buf_pool);
+
+    for (const page_id_t &page_id : chunk) {
+      if (count >= min_n) {
+        break;
+      }
+
+      count += buf_flush_try_neighbors(page_id, BUF_FLUSH_LIST, count, min_n);
+    }
+
+    buf_flush_list_mutex_enter(buf_pool);
+
+    bpage = buf_pool->flush_hp.get();
   }
 
   buf_pool->flush_hp.set(nullptr);
@@ -2288,6 +2324,15 @@ ulint prev_iter_pages_dirty = 0;
 /** Actual number of pages flushed by last iteration. */
 ulint prev_iter_pages_flushed = 0;
 
+/** LSN at previous iteration. */
+lsn_t prev_iter_lsn = 0;
+
+/** Redo generation rate (bytes of LSN per second) in previous iteration. */
+lsn_t prev_iter_lsn_rate = 0;
+
+/** Page flush target recommended by previous iteration. */
+ulint prev_iter_n_pages = 0;
+
 /** Average redo generation rate */
 lsn_t lsn_avg_rate = 0;
 
@@ -2318,6 +2363,7 @@ bool initialize(ulint n_pages_last) {
     prev_lsn = curr_lsn;
     prev_time = curr_time;
     prev_iter_time = curr_time;
+    prev_iter_lsn = curr_lsn;
 
     return (true);
   }
@@ -2687,6 +2733,81 @@ ulint set_flush_target_by_page(ulint n_pages_lsn) {
   return (n_pages);
 }
 
+/** Adjust the page flush target for changes in the redo generation rate
+between iterations. The averaged rates used by the LSN based target are
+re-computed only once every srv_flushing_avg_loops iterations, so on a
+bursty workload the controller reacts a full averaging window late: the
+checkpoint age first has to grow, then the age based term answers with a
+write burst, the age collapses, the disks go idle, and the cycle repeats
+as a flushing sawtooth. Use the per-iteration redo rate as a feed-forward
+signal instead: when redo generation accelerates, scale the target up
+immediately and in proportion, and when the estimate collapses after a
+burst, step the target down gradually rather than all at once.
+@param[in]	n_pages	page flush target computed from LSN and dirty pages
+@return adjusted page flush target */
+ulint set_flush_target_by_redo_rate(ulint n_pages) {
+  ut_ad(cur_iter_time >= prev_iter_time);
+
+  auto delta_time_ms = 1;
+  if (cur_iter_time > prev_iter_time) {
+    delta_time_ms = cur_iter_time - prev_iter_time;
+  }
+
+  /* Redo generated per second in the last iteration. */
+  auto cur_lsn_rate = static_cast<lsn_t>(
+      (static_cast<double>(cur_iter_lsn - prev_iter_lsn) * 1000) /
+      delta_time_ms);
+
+  auto prev_rate = prev_iter_lsn_rate;
+
+  prev_iter_lsn_rate = cur_lsn_rate;
+  MONITOR_SET(MONITOR_FLUSH_LSN_ITER_RATE, cur_lsn_rate);
+
+  ulint target = n_pages;
+
+  if (prev_rate > 0 && cur_lsn_rate > prev_rate) {
+    /* Redo generation is accelerating. Raise the target by the same
+    factor right away, capped at doubling per iteration to keep the
+    controller stable. */
+    double accel = static_cast<double>(cur_lsn_rate) / prev_rate;
+    if (accel > 2.0) {
+      accel = 2.0;
+    }
+    target = static_cast<ulint>(target * accel);
+  }
+
+  /* Avoid write cliffs on the way down: halve the target per iteration
+  instead of dropping to the new estimate at once, so that flushing does
+  not stop entirely until the age based term forces the next burst. */
+  if (target < prev_iter_n_pages / 2) {
+    target = prev_iter_n_pages / 2;
+  }
+
+  if (target > srv_max_io_capacity) {
+    target = srv_max_io_capacity;
+  }
+
+  prev_iter_n_pages = target;
+
+  MONITOR_SET(MONITOR_FLUSH_N_TO_FLUSH_BY_REDO_RATE, target);
+
+  if (target == n_pages) {
+    return (n_pages);
+  }
+
+  /* Rescale the per-instance requests to match the adjusted target. */
+  mutex_enter(&page_cleaner->mutex);
+  for (ulint i = 0; i < srv_buf_pool_instances; i++) {
+    page_cleaner->slots[i].n_pages_requested =
+        n_pages > 0
+            ? page_cleaner->slots[i].n_pages_requested * target / n_pages
+            : target / srv_buf_pool_instances;
+  }
+  mutex_exit(&page_cleaner->mutex);
+
+  return (target);
+}
+
 /** This function is called approximately once every second by the
 page_cleaner thread, unless it is sync flushing mode, in which case
 it is called every small round. Based on various factors it decides
@@ -2716,7 +2837,11 @@ ulint page_recommendation(ulint last_pages_in, bool is_sync_flush) {
   without redo logging - temp tables, bulk load and global redo off. */
   n_pages = set_flush_target_by_page(n_pages);
 
+  /* React to redo rate changes before the checkpoint age does. */
+  n_pages = set_flush_target_by_redo_rate(n_pages);
+
   prev_iter_time = cur_iter_time;
+  prev_iter_lsn = cur_iter_lsn;
   prev_iter_pages_dirty = cur_iter_pages_dirty;
 
   MONITOR_SET(MONITOR_FLUSH_N_TO_FLUSH_REQUESTED, n_pages);
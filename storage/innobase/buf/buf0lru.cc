@@ -1561,6 +1561,15 @@ void buf_LRU_add_block_low(buf_page_t *bpage, ibool old) {
   ut_a(buf_page_in_file(bpage));
   ut_ad(!bpage->in_LRU_list);
 
+  /* The admission priority of the index overrides the caller's
+  placement: hot-hinted pages go straight to the head of the new
+  sublist, cold-hinted pages are always inserted at the midpoint. */
+  if (bpage->admission == BUF_ADMISSION_HOT) {
+    old = FALSE;
+  } else if (bpage->admission == BUF_ADMISSION_COLD) {
+    old = TRUE;
+  }
+
   if (!old || (UT_LIST_GET_LEN(buf_pool->LRU) < BUF_LRU_OLD_MIN_LEN)) {
     UT_LIST_ADD_FIRST(buf_pool->LRU, bpage);
 
@@ -1778,7 +1787,9 @@ bool buf_LRU_free_page(buf_page_t *bpage, bool zip) {
     ut_ad(b->in_page_hash);
     ut_ad(b->in_LRU_list);
 
+    buf_page_hash_modify_enter(buf_pool, b->id.fold());
     HASH_INSERT(buf_page_t, hash, buf_pool->page_hash, b->id.fold(), b);
+    buf_page_hash_modify_exit(buf_pool, b->id.fold());
 
     /* Insert b where bpage was in the LRU list. */
     if (prev_b != nullptr) {
@@ -2117,7 +2128,9 @@ static bool buf_LRU_block_remove_hashed(buf_page_t *bpage, bool zip,
   ut_ad(bpage->in_page_hash);
   ut_d(bpage->in_page_hash = FALSE);
 
+  buf_page_hash_modify_enter(buf_pool, bpage->id.fold());
   HASH_DELETE(buf_page_t, hash, buf_pool->page_hash, bpage->id.fold(), bpage);
+  buf_page_hash_modify_exit(buf_pool, bpage->id.fold());
 
   switch (buf_page_get_state(bpage)) {
     case BUF_BLOCK_ZIP_PAGE:
@@ -2248,6 +2261,15 @@ void buf_LRU_free_one_page(buf_page_t *bpage, bool zip, bool ignore_content) {
   ut_ad(!mutex_own(block_mutex));
 }
 
+/** The innodb_old_blocks_pct value last set by the user (or the
+default), i.e. the upper bound that the adaptive logic drifts back to
+when no scan is in progress. */
+static uint buf_LRU_configured_old_pct = 100 * 3 / 8;
+
+/** The percentage currently applied by the adaptive logic, or 0 if the
+configured value is in effect. */
+static uint buf_LRU_adaptive_old_pct = 0;
+
 /** Updates buf_pool->LRU_old_ratio for one buffer pool instance.
 @param[in]	buf_pool	buffer pool instance
 @param[in]	old_pct		Reserve this percentage of
@@ -2306,9 +2328,82 @@ uint buf_LRU_old_ratio_update(
     new_ratio = buf_LRU_old_ratio_update_instance(buf_pool, old_pct, adjust);
   }
 
+  /* Remember the user-configured value; the adaptive logic treats it
+  as the upper bound and starts over from it. */
+  buf_LRU_configured_old_pct = new_ratio;
+  buf_LRU_adaptive_old_pct = 0;
+
   return (new_ratio);
 }
 
+/** Adapts the "old" sublist length to the current workload, so that a
+table scan does not evict the working set without innodb_old_blocks_pct
+having to be hand-tuned. Called once per second by buf_LRU_stat_update()
+when innodb_adaptive_old_blocks is enabled. A scan phase is recognized
+by many pages being read while few are made young; the old sublist is
+then shrunk stepwise towards its minimum, confining the scan churn to a
+small tail. When the young rate recovers, the sublist drifts back to the
+configured percentage. */
+static void buf_LRU_adapt_old_ratio(void) {
+  /** Step, in percentage points, by which the old sublist is grown or
+  shrunk per interval. */
+  constexpr uint BUF_LRU_ADAPT_STEP = 4;
+  /** Minimum reads per interval before we consider adapting at all. */
+  constexpr ulint BUF_LRU_ADAPT_MIN_READS = 256;
+
+  static ulint last_pages_read = 0;
+  static ulint last_made_young = 0;
+
+  ulint pages_read = 0;
+  ulint made_young = 0;
+
+  for (ulint i = 0; i < srv_buf_pool_instances; i++) {
+    const buf_pool_t *buf_pool = buf_pool_from_array(i);
+
+    pages_read += buf_pool->stat.n_pages_read;
+    made_young += buf_pool->stat.n_pages_made_young;
+  }
+
+  const ulint read_delta = pages_read - last_pages_read;
+  const ulint young_delta = made_young - last_made_young;
+
+  last_pages_read = pages_read;
+  last_made_young = made_young;
+
+  if (!srv_adaptive_old_blocks) {
+    if (buf_LRU_adaptive_old_pct != 0) {
+      /* Restore the configured value once. */
+      buf_LRU_old_ratio_update(buf_LRU_configured_old_pct, TRUE);
+    }
+
+    return;
+  }
+
+  uint cur_pct = buf_LRU_adaptive_old_pct != 0 ? buf_LRU_adaptive_old_pct
+                                               : buf_LRU_configured_old_pct;
+  uint new_pct;
+
+  if (read_delta >= BUF_LRU_ADAPT_MIN_READS &&
+      young_delta * 8 < read_delta) {
+    /* Scan phase: pages stream through the pool without being
+    accessed again. Shrink the old sublist. */
+    new_pct = cur_pct > 5 + BUF_LRU_ADAPT_STEP ? cur_pct - BUF_LRU_ADAPT_STEP
+                                               : 5;
+  } else {
+    /* Normal phase: drift back towards the configured value. */
+    new_pct = ut_min(cur_pct + BUF_LRU_ADAPT_STEP, buf_LRU_configured_old_pct);
+  }
+
+  if (new_pct != cur_pct) {
+    for (ulint i = 0; i < srv_buf_pool_instances; i++) {
+      buf_LRU_old_ratio_update_instance(buf_pool_from_array(i), new_pct, TRUE);
+    }
+
+    buf_LRU_adaptive_old_pct =
+        new_pct == buf_LRU_configured_old_pct ? 0 : new_pct;
+  }
+}
+
 /** Update the historical stats that we are collecting for LRU eviction
  policy at the end of each interval. */
 void buf_LRU_stat_update(void) {
@@ -2355,6 +2450,8 @@ func_exit:
   /* Clear the current entry. */
   memset(&buf_LRU_stat_cur, 0, sizeof buf_LRU_stat_cur);
   os_wmb;
+
+  buf_LRU_adapt_old_ratio();
 }
 
 #if defined UNIV_DEBUG || defined UNIV_BUF_DEBUG
@@ -236,6 +236,8 @@ read_ahead:
 
   count = 0;
 
+  os_aio_batch_begin();
+
   for (i = low; i < high; i++) {
     /* It is only sensible to do read-ahead in the non-sync aio
     mode: hence FALSE as the first parameter */
@@ -257,8 +259,11 @@ read_ahead:
     }
   }
 
-  /* In simulated aio we wake the aio handler threads only after
-  queuing all aio requests.  */
+  /* With native AIO the queued requests are handed to the kernel in
+  one io_submit() batch; in simulated aio we wake the aio handler
+  threads only after queuing all aio requests.  */
+
+  os_aio_batch_end();
 
   os_aio_simulated_wake_handler_threads();
 
@@ -285,6 +290,8 @@ bool buf_read_page(const page_id_t &page_id, const page_size_t &page_size) {
                             page_size, false);
 
   srv_stats.buf_pool_reads.add(count);
+  buf_stat_per_thread.n_pages_read += count;
+  buf_stat_per_thread.n_bytes_read += count * page_size.physical();
 
   if (err == DB_TABLESPACE_DELETED) {
     ib::error(ER_IB_MSG_141) << "trying to read page " << page_id
@@ -356,6 +363,8 @@ size_t buf_phy_read_ahead(const page_id_t &page_id,
 
   os_aio_simulated_put_read_threads_to_sleep();
 
+  os_aio_batch_begin();
+
   for (page_no_t i = low; i < high; ++i) {
     dberr_t err;
     const page_id_t cur_page_id(page_id.space(), i);
@@ -367,8 +376,11 @@ size_t buf_phy_read_ahead(const page_id_t &page_id,
     ut_a(err != DB_TABLESPACE_DELETED);
   }
 
-  /* In simulated AIO we wake the AIO handler threads only after
-  queuing all AIO requests. */
+  /* With native AIO the queued requests are handed to the kernel in
+  one io_submit() batch; in simulated AIO we wake the AIO handler
+  threads only after queuing all AIO requests. */
+
+  os_aio_batch_end();
 
   os_aio_simulated_wake_handler_threads();
 
@@ -592,6 +604,8 @@ ulint buf_read_ahead_linear(const page_id_t &page_id,
 
   os_aio_simulated_put_read_threads_to_sleep();
 
+  os_aio_batch_begin();
+
   for (i = low; i < high; i++) {
     /* It is only sensible to do read-ahead in the non-sync
     aio mode: hence FALSE as the first parameter */
@@ -612,8 +626,11 @@ ulint buf_read_ahead_linear(const page_id_t &page_id,
     }
   }
 
-  /* In simulated aio we wake the aio handler threads only after
-  queuing all aio requests. */
+  /* With native AIO the queued requests are handed to the kernel in
+  one io_submit() batch; in simulated aio we wake the aio handler
+  threads only after queuing all aio requests. */
+
+  os_aio_batch_end();
 
   os_aio_simulated_wake_handler_threads();
 
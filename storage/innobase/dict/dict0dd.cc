@@ -2408,6 +2408,31 @@ static ulint dd_parse_merge_threshold(THD *thd, const char *str) {
   return (DICT_INDEX_MERGE_THRESHOLD_DEFAULT);
 }
 
+/** Parse BUF_ADMISSION value from a comment string.
+@param[in]      thd     connection
+@param[in]      str     string which might include 'BUF_ADMISSION='
+@return value parsed
+@retval BUF_ADMISSION_DEFAULT for missing or invalid value. */
+static ulint dd_parse_buf_admission(THD *thd, const char *str) {
+  static constexpr char label[] = "BUF_ADMISSION=";
+  const char *pos = strstr(str, label);
+
+  if (pos != nullptr) {
+    pos += (sizeof label) - 1;
+
+    if (strncmp(pos, "HOT", 3) == 0) {
+      return (BUF_ADMISSION_HOT);
+    } else if (strncmp(pos, "COLD", 4) == 0) {
+      return (BUF_ADMISSION_COLD);
+    }
+
+    push_warning_printf(thd, Sql_condition::SL_WARNING, WARN_OPTION_IGNORED,
+                        ER_DEFAULT(WARN_OPTION_IGNORED), "BUF_ADMISSION");
+  }
+
+  return (BUF_ADMISSION_DEFAULT);
+}
+
 /** Copy attributes from MySQL TABLE_SHARE into an InnoDB table object.
 @param[in,out]	thd		thread context
 @param[in,out]	table		InnoDB table
@@ -2444,9 +2469,14 @@ inline void dd_copy_from_table_share(THD *thd, dict_table_t *table,
       table_share->comment.str
           ? dd_parse_merge_threshold(thd, table_share->comment.str)
           : DICT_INDEX_MERGE_THRESHOLD_DEFAULT;
+  const ulint admission_table =
+      table_share->comment.str
+          ? dd_parse_buf_admission(thd, table_share->comment.str)
+          : BUF_ADMISSION_DEFAULT;
   dict_index_t *index = table->first_index();
 
   index->merge_threshold = merge_threshold_table;
+  index->admission = admission_table;
 
   if (dict_index_is_auto_gen_clust(index)) {
     index = index->next();
@@ -2460,8 +2490,10 @@ inline void dd_copy_from_table_share(THD *thd, dict_table_t *table,
     if (key_info->flags & HA_USES_COMMENT && key_info->comment.str != nullptr) {
       index->merge_threshold =
           dd_parse_merge_threshold(thd, key_info->comment.str);
+      index->admission = dd_parse_buf_admission(thd, key_info->comment.str);
     } else {
       index->merge_threshold = merge_threshold_table;
+      index->admission = admission_table;
     }
 
     index = index->next();
@@ -72,6 +72,7 @@ extern uint ibuf_debug;
 #endif /* UNIV_DEBUG || UNIV_IBUF_DEBUG */
 
 #include <algorithm>
+#include <unordered_map>
 #include <vector>
 
 #include "btr0btr.h"
@@ -1013,6 +1014,127 @@ ibool dict_table_col_in_clustered_key(
 }
 #endif /* !UNIV_HOTBACKUP */
 
+#ifndef UNIV_HOTBACKUP
+
+/* Fast table lookup cache.
+
+dict_sys->mutex serializes every dict_table_open_on_name() call, and
+with very many tables the connection storms pile up on it even though
+the open of an already cached, already referenced table only needs a
+hash lookup and a reference count increment. The cache below shards
+the name lookup across DICT_TABLE_CACHE_SHARDS maps with per-shard
+mutexes, so concurrent opens of different tables no longer serialize.
+The safety argument replaces hazard pointers with the reference count:
+acquire_if_referenced() raises the count only from a positive value,
+and a table is only freed after the count has been seen as zero under
+the dict_sys mutex, so a fast-path handle can never point to a freed
+table. Any code that frees or renames a table erases its cache entry,
+under the shard mutex, before doing so. */
+
+/** Number of shards in the fast table lookup cache */
+static const ulint DICT_TABLE_CACHE_SHARDS = 64;
+
+/** One shard of the fast table lookup cache */
+struct dict_table_cache_shard_t {
+  /** Mutex protecting "tables" */
+  ib_mutex_t mutex;
+
+  /** Map from table name (in dictionary cache format) to the
+  table object */
+  std::unordered_map<std::string, dict_table_t *> tables;
+};
+
+/** The shards of the fast table lookup cache */
+static dict_table_cache_shard_t *dict_table_cache_shards = nullptr;
+
+/** Get the fast lookup cache shard for a table name.
+@param[in]	name	table name in dictionary cache format
+@return the shard the name maps to */
+static dict_table_cache_shard_t *dict_table_cache_shard_get(const char *name) {
+  return (&dict_table_cache_shards[ut_fold_string(name) %
+                                   DICT_TABLE_CACHE_SHARDS]);
+}
+
+/** Look up a table in the fast lookup cache and acquire a handle on it
+without the dict_sys mutex. Fails for tables that are not in the cache
+and for tables that are currently unreferenced; those must go through
+the regular open path.
+@param[in]	name	table name in dictionary cache format
+@return table with an acquired handle, or nullptr */
+static dict_table_t *dict_table_cache_lookup(const char *name) {
+  auto shard = dict_table_cache_shard_get(name);
+  dict_table_t *table = nullptr;
+
+  mutex_enter(&shard->mutex);
+
+  auto it = shard->tables.find(name);
+
+  /* The entry cannot dangle: the table is erased from the shard,
+  under the shard mutex, before it is freed. */
+  if (it != shard->tables.end() && it->second->acquire_if_referenced()) {
+    table = it->second;
+  }
+
+  mutex_exit(&shard->mutex);
+
+  return (table);
+}
+
+/** Add a table to the fast lookup cache. A no-op if it is already
+there.
+@param[in]	table	table in the dictionary cache */
+static void dict_table_cache_insert(dict_table_t *table) {
+  ut_ad(mutex_own(&dict_sys->mutex));
+  ut_ad(table->cached);
+
+  auto shard = dict_table_cache_shard_get(table->name.m_name);
+
+  mutex_enter(&shard->mutex);
+
+  shard->tables.emplace(table->name.m_name, table);
+
+  mutex_exit(&shard->mutex);
+}
+
+/** Erase a table from the fast lookup cache. Must be called, before
+the object is freed or renamed, by every path that removes a table
+from the dictionary cache hash tables.
+@param[in]	name	table name in dictionary cache format */
+static void dict_table_cache_erase(const char *name) {
+  ut_ad(mutex_own(&dict_sys->mutex));
+
+  auto shard = dict_table_cache_shard_get(name);
+
+  mutex_enter(&shard->mutex);
+
+  shard->tables.erase(name);
+
+  mutex_exit(&shard->mutex);
+}
+
+/** Create the fast table lookup cache. */
+static void dict_table_cache_init() {
+  dict_table_cache_shards =
+      UT_NEW_ARRAY_NOKEY(dict_table_cache_shard_t, DICT_TABLE_CACHE_SHARDS);
+
+  for (ulint i = 0; i < DICT_TABLE_CACHE_SHARDS; ++i) {
+    mutex_create(LATCH_ID_DICT_TABLE_CACHE,
+                 &dict_table_cache_shards[i].mutex);
+  }
+}
+
+/** Destroy the fast table lookup cache. */
+static void dict_table_cache_close() {
+  for (ulint i = 0; i < DICT_TABLE_CACHE_SHARDS; ++i) {
+    mutex_free(&dict_table_cache_shards[i].mutex);
+  }
+
+  UT_DELETE_ARRAY(dict_table_cache_shards);
+  dict_table_cache_shards = nullptr;
+}
+
+#endif /* !UNIV_HOTBACKUP */
+
 /** Inits the data dictionary module. */
 void dict_init(void) {
   dict_operation_lock =
@@ -1035,6 +1157,8 @@ void dict_init(void) {
                  SYNC_DICT_OPERATION);
 
 #ifndef UNIV_HOTBACKUP
+  dict_table_cache_init();
+
   if (!srv_read_only_mode) {
     dict_foreign_err_file = os_file_create_tmpfile(nullptr);
     ut_a(dict_foreign_err_file);
@@ -1079,12 +1203,7 @@ dict_table_t *dict_table_open_on_name(
   DBUG_TRACE;
   DBUG_PRINT("dict_table_open_on_name", ("table: '%s'", table_name));
 
-  if (!dict_locked) {
-    mutex_enter(&dict_sys->mutex);
-  }
-
   ut_ad(table_name);
-  ut_ad(mutex_own(&dict_sys->mutex));
 
   std::string table_str(table_name);
   /* Check and convert 5.7 table name. We always keep 8.0 format name in cache
@@ -1092,6 +1211,31 @@ dict_table_t *dict_table_open_on_name(
   if (dict_name::is_partition(table_name)) {
     dict_name::rebuild(table_str);
   }
+
+  if (!dict_locked && !try_drop) {
+    /* Fast path: a cached table that somebody else already has a
+    handle on can be opened without the dict_sys mutex. We skip the
+    MRU move; a referenced table cannot be evicted, and the next
+    open through the slow path restores its LRU position. */
+    table = dict_table_cache_lookup(table_str.c_str());
+
+    if (table != nullptr) {
+      if (ignore_err == DICT_ERR_IGNORE_NONE && table->is_corrupted()) {
+        /* Fall through to the slow path, which reports the
+        corruption and pins the table for a later drop. */
+        table->release();
+      } else {
+        return table;
+      }
+    }
+  }
+
+  if (!dict_locked) {
+    mutex_enter(&dict_sys->mutex);
+  }
+
+  ut_ad(mutex_own(&dict_sys->mutex));
+
   table = dict_table_check_if_in_cache_low(table_str.c_str());
 
   if (table == nullptr) {
@@ -1120,6 +1264,9 @@ dict_table_t *dict_table_open_on_name(
     }
 
     table->acquire();
+
+    /* Make the table visible to the lock-free fast path above. */
+    dict_table_cache_insert(table);
   }
 
   ut_ad(dict_lru_validate());
@@ -1617,7 +1764,12 @@ dberr_t dict_table_rename_in_cache(
     return (err);
   }
 
-  /* Remove table from the hash tables of tables */
+  /* Remove table from the hash tables of tables. The fast lookup
+  cache entry for the old name must go first; the new name is added
+  back by the next slow-path open. */
+#ifndef UNIV_HOTBACKUP
+  dict_table_cache_erase(old_name);
+#endif /* !UNIV_HOTBACKUP */
   HASH_DELETE(dict_table_t, name_hash, dict_sys->table_hash,
               ut_fold_string(old_name), table);
 
@@ -1933,6 +2085,11 @@ static void dict_table_remove_from_cache_low(
 
   /* Remove table from the hash tables of tables */
 
+#ifndef UNIV_HOTBACKUP
+  /* Close the lock-free fast path before the object can be freed. */
+  dict_table_cache_erase(table->name.m_name);
+#endif /* !UNIV_HOTBACKUP */
+
   HASH_DELETE(dict_table_t, name_hash, dict_sys->table_hash,
               ut_fold_string(table->name.m_name), table);
 
@@ -2330,6 +2487,67 @@ void dict_index_remove_from_v_col_list(dict_index_t *index) {
   }
 }
 
+/** Checks if the canonical comparison of a column is a plain byte
+comparison. These are exactly the types for which cmp_data_data() compares
+the raw bytes with no padding character.
+@param[in]	col	column
+@return true if values of the column compare with memcmp() */
+static bool dict_col_is_binary_comparable(const dict_col_t *col) {
+  switch (col->mtype) {
+    case DATA_INT:
+    case DATA_SYS:
+    case DATA_SYS_CHILD:
+      return (true);
+    case DATA_FIXBINARY:
+    case DATA_BINARY:
+      return (dtype_get_charset_coll(col->prtype) ==
+              DATA_MYSQL_BINARY_CHARSET_COLL);
+  }
+
+  return (false);
+}
+
+/** Selects a comparison function for the leading index fields that can
+be compared bytewise, and stores it in the index. A field qualifies if
+it is a full-column, ascending, NOT NULL, fixed-length field of a
+byte-comparable type; the first field that does not qualify ends the
+prefix. The function is used by cmp_dtuple_rec_with_match_low() to skip
+the per-field type dispatch in page searches.
+@param[in]	table	table the index belongs to
+@param[in,out]	index	index in the cache internal representation */
+static void dict_index_set_binary_cmp(const dict_table_t *table,
+                                      dict_index_t *index) {
+  ut_ad(index->cmp_binary_prefix == nullptr);
+  ut_ad(index->n_binary_cmp_fields == 0);
+
+  if (dict_index_is_spatial(index) || (index->type & DICT_FTS) ||
+      index->is_multi_value()) {
+    return;
+  }
+
+  const ulint comp = dict_table_is_comp(table);
+  ulint n = 0;
+
+  for (ulint i = 0; i < index->n_fields; i++) {
+    const dict_field_t *field = index->get_field(i);
+    const dict_col_t *col = field->col;
+
+    if (field->prefix_len != 0 || !field->is_ascending ||
+        col->is_nullable() || col->is_virtual() ||
+        col->get_fixed_size(comp) == 0 ||
+        !dict_col_is_binary_comparable(col)) {
+      break;
+    }
+
+    n = i + 1;
+  }
+
+  if (n > 0) {
+    index->cmp_binary_prefix = cmp_dtuple_rec_binary_prefix;
+    index->n_binary_cmp_fields = n;
+  }
+}
+
 /** Adds an index to the dictionary cache, with possible indexing newly
 added column.
 @param[in,out]	table	table on which the index is
@@ -2451,6 +2669,8 @@ dberr_t dict_index_add_to_cache_w_vcol(dict_table_t *table, dict_index_t *index,
   new_index->table_name = table->name.m_name;
   new_index->search_info = btr_search_info_create(new_index->heap);
 
+  dict_index_set_binary_cmp(table, new_index);
+
   new_index->page = page_no;
   rw_lock_create(index_tree_rw_lock_key, &new_index->lock, SYNC_INDEX_TREE);
 
@@ -4585,6 +4805,9 @@ void dict_close(void) {
   hash_table_free(dict_sys->table_id_hash);
 
 #ifndef UNIV_HOTBACKUP
+  /* All tables have been removed above, so the shards are empty. */
+  dict_table_cache_close();
+
   dict_ind_free();
 #endif /* !UNIV_HOTBACKUP */
 
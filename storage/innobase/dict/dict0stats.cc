@@ -1886,6 +1886,136 @@ static void dict_stats_analyze_index(
  is relatively slow and is used to calculate persistent statistics that
  will be saved on disk.
  @return DB_SUCCESS or error code */
+/** Number of consecutive incremental statistics refreshes after which a
+full persistent recalculation is forced, so that the scaling errors of
+the incremental updates cannot accumulate without bound. */
+static const unsigned DICT_STATS_INCREMENTAL_FULL_EVERY = 10;
+
+/** Refresh the persistent statistics of a table incrementally, without
+re-sampling the indexes. The index and leaf page counts are re-read from
+the index segment headers (a few page reads per index), the row count is
+scaled by the growth of the clustered index leaf level, and the existing
+cardinality estimates are scaled by the same factor; the sample sizes on
+disk are left as they were. This costs a tiny fraction of the I/O of
+dict_stats_analyze_index() on a large table.
+@param[in,out]	table	table whose stats to refresh
+@return DB_SUCCESS if the statistics were refreshed,
+DB_STATS_DO_NOT_EXIST if a full recalculation is required instead */
+static dberr_t dict_stats_update_incremental(dict_table_t *table) {
+  DEBUG_PRINTF("%s(table=%s)\n", __func__, table->name);
+
+  dict_table_stats_lock(table, RW_X_LATCH);
+
+  dict_index_t *index = table->first_index();
+
+  /* Scaling needs a usable previous estimate to start from. */
+  if (!table->stat_initialized ||
+      table->stat_incremental_recalcs >= DICT_STATS_INCREMENTAL_FULL_EVERY ||
+      table->stat_n_rows == 0 || index == nullptr || index->is_corrupted() ||
+      (index->type | DICT_UNIQUE) != (DICT_CLUSTERED | DICT_UNIQUE) ||
+      index->stat_n_leaf_pages == 0) {
+    dict_table_stats_unlock(table, RW_X_LATCH);
+
+    return (DB_STATS_DO_NOT_EXIST);
+  }
+
+  ut_ad(!dict_index_is_ibuf(index));
+
+  const ib_uint64_t n_rows_old = table->stat_n_rows;
+  const ulint clust_leaf_old = index->stat_n_leaf_pages;
+
+  ulint sum_of_other_index_sizes = 0;
+
+  /* Re-read the physical sizes of all indexes. */
+  for (index = table->first_index(); index != nullptr; index = index->next()) {
+    ut_ad(!dict_index_is_ibuf(index));
+
+    if (index->type & DICT_FTS || dict_index_is_spatial(index) ||
+        dict_stats_should_ignore_index(index)) {
+      continue;
+    }
+
+    mtr_t mtr;
+    ulint size;
+    ulint n_leaf = ULINT_UNDEFINED;
+
+    mtr_start(&mtr);
+
+    mtr_s_lock(dict_index_get_lock(index), &mtr);
+
+    size = btr_get_size(index, BTR_TOTAL_SIZE, &mtr);
+
+    if (size != ULINT_UNDEFINED) {
+      n_leaf = btr_get_size(index, BTR_N_LEAF_PAGES, &mtr);
+    }
+
+    mtr_commit(&mtr);
+
+    if (size == ULINT_UNDEFINED || n_leaf == ULINT_UNDEFINED) {
+      dict_table_stats_unlock(table, RW_X_LATCH);
+
+      return (DB_STATS_DO_NOT_EXIST);
+    }
+
+    if (n_leaf == 0) {
+      /* The root node of the tree is a leaf */
+      n_leaf = 1;
+    }
+
+    index->stat_index_size = size;
+    index->stat_n_leaf_pages = n_leaf;
+
+    if (!index->is_clustered()) {
+      sum_of_other_index_sizes += size;
+    }
+  }
+
+  index = table->first_index();
+
+  /* Estimate the new row count from the growth of the clustered
+  index leaf level and scale all cardinality estimates by the same
+  factor. */
+  const ib_uint64_t n_rows_new = std::max<ib_uint64_t>(
+      1, (n_rows_old * index->stat_n_leaf_pages) / clust_leaf_old);
+
+  for (index = table->first_index(); index != nullptr; index = index->next()) {
+    if (index->type & DICT_FTS || dict_index_is_spatial(index) ||
+        dict_stats_should_ignore_index(index)) {
+      continue;
+    }
+
+    for (ulint i = 0; i < dict_index_get_n_unique(index); ++i) {
+      const ib_uint64_t n_diff = index->stat_n_diff_key_vals[i];
+
+      if (n_diff > 0) {
+        index->stat_n_diff_key_vals[i] =
+            std::max<ib_uint64_t>(1, (n_diff * n_rows_new) / n_rows_old);
+      }
+    }
+  }
+
+  index = table->first_index();
+
+  table->stat_n_rows =
+      index->stat_n_diff_key_vals[dict_index_get_n_unique(index) - 1];
+
+  table->stat_clustered_index_size = index->stat_index_size;
+
+  table->stat_sum_of_other_index_sizes = sum_of_other_index_sizes;
+
+  table->stats_last_recalc = ut_time_monotonic();
+
+  table->stat_modified_counter = 0;
+
+  ++table->stat_incremental_recalcs;
+
+  dict_stats_assert_initialized(table);
+
+  dict_table_stats_unlock(table, RW_X_LATCH);
+
+  return (DB_SUCCESS);
+}
+
 static dberr_t dict_stats_update_persistent(
     dict_table_t *table) /*!< in/out: table */
 {
@@ -1946,6 +2076,8 @@ static dberr_t dict_stats_update_persistent(
 
   table->stat_modified_counter = 0;
 
+  table->stat_incremental_recalcs = 0;
+
   table->stat_initialized = TRUE;
 
   dict_stats_assert_initialized(table);
@@ -2751,6 +2883,26 @@ storage */
 
       return (dict_stats_save(table, nullptr));
 
+    case DICT_STATS_RECALC_PERSISTENT_INCREMENTAL:
+
+      if (srv_read_only_mode) {
+        break;
+      }
+
+      /* InnoDB internal tables (e.g. SYS_TABLES) cannot have
+      persistent stats enabled */
+      ut_a(strchr(table->name.m_name, '/') != nullptr);
+
+      err = dict_stats_update_incremental(table);
+
+      if (err == DB_SUCCESS) {
+        return (dict_stats_save(table, nullptr));
+      }
+
+      /* No usable statistics in memory or a full re-sampling is
+      due; do a regular persistent recalculation. */
+      return (dict_stats_update(table, DICT_STATS_RECALC_PERSISTENT));
+
     case DICT_STATS_RECALC_TRANSIENT:
       break;
 
@@ -311,7 +311,11 @@ static void dict_stats_process_entry_from_recalc_pool(THD *thd) {
     dict_stats_recalc_pool_add(table);
 
   } else {
-    dict_stats_update(table, DICT_STATS_RECALC_PERSISTENT);
+    /* Auto recalculation may refresh the stats incrementally; an
+    explicit ANALYZE TABLE always does a full re-sampling. */
+    dict_stats_update(table, srv_stats_incremental
+                                 ? DICT_STATS_RECALC_PERSISTENT_INCREMENTAL
+                                 : DICT_STATS_RECALC_PERSISTENT);
   }
 
   mutex_enter(&dict_sys->mutex);
@@ -332,17 +332,19 @@ fil_addr_t fil_addr_null = {FIL_NULL, 0};
 static const size_t MAX_PAGES_TO_READ = 1;
 
 #ifndef UNIV_HOTBACKUP
-/** Maximum number of shards supported. */
-static const size_t MAX_SHARDS = 64;
-
-/** The redo log is in its own shard. */
-static const size_t REDO_SHARD = MAX_SHARDS - 1;
-
 /** Number of undo shards to reserve. */
 static const size_t UNDO_SHARDS = 4;
 
-/** The UNDO logs have their own shards (4). */
-static const size_t UNDO_SHARDS_START = REDO_SHARD - (UNDO_SHARDS + 1);
+/** Maximum number of shards for tablespaces other than the undo and
+redo logs; see innodb_fil_shards. */
+static const size_t MAX_BASE_SHARDS = 256;
+
+/** The UNDO logs have their own shards (4), starting after the shards
+of the other tablespaces. Set from innodb_fil_shards in fil_init(). */
+static size_t UNDO_SHARDS_START = 0;
+
+/** The redo log is in its own shard, the last one. Set in fil_init(). */
+static size_t REDO_SHARD = 0;
 #else  /* !UNIV_HOTBACKUP */
 
 /** Maximum number of shards supported. */
@@ -1602,7 +1604,7 @@ class Fil_system {
       return (m_shards[UNDO_SHARDS_START + limit]);
     }
 
-    ut_ad(m_shards.size() == MAX_SHARDS);
+    ut_ad(m_shards.size() == REDO_SHARD + 1);
 
     return (m_shards[space_id % UNDO_SHARDS_START]);
 #else  /* !UNIV_HOTBACKUP */
@@ -3543,7 +3545,18 @@ void fil_init(ulint max_n_open) {
 
   ut_a(max_n_open > 0);
 
+#ifndef UNIV_HOTBACKUP
+  /* Lay out the shards: innodb_fil_shards shards for the ordinary
+  tablespaces, then the undo shards, then the redo shard. */
+  ut_a(srv_fil_shards > 0 && srv_fil_shards <= MAX_BASE_SHARDS);
+
+  UNDO_SHARDS_START = srv_fil_shards;
+  REDO_SHARD = UNDO_SHARDS_START + UNDO_SHARDS;
+
+  fil_system = UT_NEW_NOKEY(Fil_system(REDO_SHARD + 1, max_n_open));
+#else  /* !UNIV_HOTBACKUP */
   fil_system = UT_NEW_NOKEY(Fil_system(MAX_SHARDS, max_n_open));
+#endif /* !UNIV_HOTBACKUP */
 }
 
 /** Open all the system files.
@@ -6592,6 +6605,200 @@ bool fil_space_extend(fil_space_t *space, page_no_t size) {
   return (shard->space_extend(space, size));
 }
 
+#ifndef UNIV_HOTBACKUP
+
+/* Background tablespace extension.
+
+space_extend() grows a file synchronously in the caller's context, so
+at every autoextend some unlucky foreground thread pays for the
+fallocate() or zero-fill of a whole batch of extents while holding the
+tablespace x-latch. When enabled, the thread below preallocates the
+next srv_background_extend_extents extents as soon as the number of
+free extents in a tablespace falls below that same watermark, so that
+by the time the foreground autoextend runs the physical pages already
+exist and space_extend() returns without doing any I/O. */
+
+/** Whether the background tablespace extend thread preallocates
+physical space for tablespaces running low on free extents;
+corresponds to innodb_background_extend */
+bool srv_background_extend = false;
+
+/** Number of extents the background extend thread preallocates per
+tablespace, and the free extent watermark that triggers it;
+corresponds to innodb_background_extend_extents */
+ulong srv_background_extend_extents = 4;
+
+/** Event to wake up fil_extend_thread() */
+os_event_t fil_extend_event = nullptr;
+
+#ifdef UNIV_PFS_THREAD
+mysql_pfs_key_t fil_extend_thread_key;
+#endif /* UNIV_PFS_THREAD */
+
+/** This mutex protects the "fil_extend_pool" variable and the
+fil_space_t::prealloc_queued flags. */
+static ib_mutex_t fil_extend_pool_mutex;
+
+/** The number of tablespaces that can be waiting in "fil_extend_pool";
+a tablespace that runs low while the pool is full is simply queued
+again at the next reservation */
+static const ulint FIL_EXTEND_POOL_MAX_SLOTS = 128;
+
+/** Allocator type, used by std::vector */
+typedef ut_allocator<space_id_t> fil_extend_pool_allocator_t;
+
+/** The multitude of tablespaces to be preallocated */
+typedef std::vector<space_id_t, fil_extend_pool_allocator_t>
+    fil_extend_pool_t;
+
+/** Pool where we store the ids of the tablespaces that the background
+thread should extend */
+static fil_extend_pool_t *fil_extend_pool;
+
+void fil_extend_thread_init() {
+  ut_a(!srv_read_only_mode);
+
+  fil_extend_event = os_event_create();
+
+  /* The fil_extend_pool_mutex is acquired during extent reservation
+  while the fsp header x-latch is held, and by the extend thread
+  before it latches anything; neither path acquires further latches
+  while holding it. */
+  mutex_create(LATCH_ID_FIL_EXTEND_POOL, &fil_extend_pool_mutex);
+
+  fil_extend_pool = UT_NEW_NOKEY(
+      fil_extend_pool_t(fil_extend_pool_allocator_t(PSI_NOT_INSTRUMENTED)));
+
+  fil_extend_pool->reserve(FIL_EXTEND_POOL_MAX_SLOTS);
+}
+
+void fil_extend_thread_deinit() {
+  ut_a(!srv_read_only_mode);
+  ut_ad(!srv_thread_is_active(srv_threads.m_fil_extend));
+
+  if (fil_extend_pool == nullptr) {
+    return;
+  }
+
+  fil_extend_pool->clear();
+
+  UT_DELETE(fil_extend_pool);
+  fil_extend_pool = nullptr;
+
+  mutex_free(&fil_extend_pool_mutex);
+
+  os_event_destroy(fil_extend_event);
+  fil_extend_event = nullptr;
+}
+
+void fil_extend_pool_add(fil_space_t *space) {
+  ut_ad(!srv_read_only_mode);
+
+  mutex_enter(&fil_extend_pool_mutex);
+
+  if (space->prealloc_queued ||
+      fil_extend_pool->size() >= FIL_EXTEND_POOL_MAX_SLOTS) {
+    mutex_exit(&fil_extend_pool_mutex);
+    return;
+  }
+
+  space->prealloc_queued = true;
+
+  fil_extend_pool->push_back(space->id);
+
+  mutex_exit(&fil_extend_pool_mutex);
+
+  os_event_set(fil_extend_event);
+}
+
+/** Get the first tablespace id from the extend pool.
+@param[out]	space_id	tablespace id, if the pool was not empty
+@return true if the pool was not empty and "space_id" was set */
+static bool fil_extend_pool_get(space_id_t *space_id) {
+  ut_ad(!srv_read_only_mode);
+
+  mutex_enter(&fil_extend_pool_mutex);
+
+  if (fil_extend_pool->empty()) {
+    mutex_exit(&fil_extend_pool_mutex);
+    return (false);
+  }
+
+  *space_id = fil_extend_pool->at(0);
+
+  fil_extend_pool->erase(fil_extend_pool->begin());
+
+  mutex_exit(&fil_extend_pool_mutex);
+
+  return (true);
+}
+
+/** Preallocate physical space for one tablespace from the pool.
+@param[in]	space_id	tablespace to extend */
+static void fil_extend_process_entry(space_id_t space_id) {
+  fil_space_t *space = fil_space_acquire_silent(space_id);
+
+  if (space == nullptr) {
+    /* The tablespace was dropped; its queued flag went with it. */
+    return;
+  }
+
+  /* Physically growing the file ahead of the FSP_SIZE in the header
+  is always safe: a crash between an extension and the matching header
+  update leaves the file in exactly this state, and it is handled. */
+  page_no_t target =
+      space->size + srv_background_extend_extents * FSP_EXTENT_SIZE;
+
+  if (!fil_space_extend(space, target)) {
+    /* Out of disk space, most likely. The foreground autoextend
+    path will hit the same condition and report it. */
+  }
+
+  mutex_enter(&fil_extend_pool_mutex);
+  space->prealloc_queued = false;
+  mutex_exit(&fil_extend_pool_mutex);
+
+  fil_space_release(space);
+}
+
+void fil_extend_thread() {
+  ut_a(!srv_read_only_mode);
+
+  while (srv_shutdown_state.load() <
+         SRV_SHUTDOWN_PRE_DD_AND_SYSTEM_TRANSACTIONS) {
+    /* Wake up periodically even if not signaled, in case the
+    feature was enabled while tablespaces were already queued. */
+    os_event_wait_time(fil_extend_event, 5 * 1000000);
+
+    if (srv_shutdown_state.load() >=
+        SRV_SHUTDOWN_PRE_DD_AND_SYSTEM_TRANSACTIONS) {
+      break;
+    }
+
+    if (srv_background_extend) {
+      space_id_t space_id;
+
+      while (fil_extend_pool_get(&space_id)) {
+        fil_extend_process_entry(space_id);
+
+        if (srv_shutdown_state.load() >=
+            SRV_SHUTDOWN_PRE_DD_AND_SYSTEM_TRANSACTIONS) {
+          break;
+        }
+      }
+    }
+
+    os_event_reset(fil_extend_event);
+  }
+}
+
+void fil_extend_shutdown() {
+  os_event_set(fil_extend_event);
+  srv_threads.m_fil_extend.join();
+}
+
+#endif /* !UNIV_HOTBACKUP */
+
 #ifdef UNIV_HOTBACKUP
 /** Extends all tablespaces to the size stored in the space header. During the
 mysqlbackup --apply-log phase we extended the spaces on-demand so that log
@@ -3142,6 +3142,17 @@ try_again:
 
       reserve = 2 + ((size / FSP_EXTENT_SIZE) * 2) / 200;
 
+#ifndef UNIV_HOTBACKUP
+      if (srv_background_extend && !srv_read_only_mode &&
+          fsp_is_ibd_tablespace(space_id) &&
+          n_free <= reserve + n_ext + srv_background_extend_extents) {
+        /* Running low on free extents; ask the background thread
+        to grow the file before a foreground thread has to do it
+        synchronously below. */
+        fil_extend_pool_add(space);
+      }
+#endif /* !UNIV_HOTBACKUP */
+
       if (n_free <= reserve + n_ext) {
         goto try_to_extend;
       }
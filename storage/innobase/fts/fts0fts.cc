@@ -52,6 +52,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "row0mysql.h"
 #include "row0sel.h"
 #include "row0upd.h"
+#include "srv0mon.h"
 #include "sync0sync.h"
 #include "trx0roll.h"
 #include "ut0new.h"
@@ -76,6 +77,10 @@ ulong fts_max_cache_size;
 need a sync to free some memory */
 bool fts_need_sync = false;
 
+/** Whether to checkpoint the cache to the auxiliary index tables
+incrementally in the background instead of only syncing it wholesale */
+bool fts_enable_incremental_sync = false;
+
 /** Variable specifying the total memory allocated for FTS cache */
 ulong fts_max_total_cache_size;
 
@@ -185,9 +190,11 @@ FTS auxiliary INDEX table and clear the cache at the end.
 @param[in]	unlock_cache	whether unlock cache lock when write node
 @param[in]	wait		whether wait when a sync is in progress
 @param[in]      has_dict        whether has dict operation lock
+@param[in]	spill		whether this is an incremental spill that
+                                leaves the cache in place
 @return DB_SUCCESS if all OK */
 static dberr_t fts_sync(fts_sync_t *sync, bool unlock_cache, bool wait,
-                        bool has_dict);
+                        bool has_dict, bool spill);
 
 /** Release all resources help by the words rb tree e.g., the node ilist. */
 static void fts_words_free(ib_rbt_t *words); /*!< in: rb tree of words */
@@ -3536,7 +3543,7 @@ void fts_add_doc_from_tuple(fts_trx_table_t *ftt, doc_id_t doc_id,
       rw_lock_x_unlock(&table->fts->cache->lock);
 
       if (cache->total_size > fts_max_cache_size / 5 || fts_need_sync) {
-        fts_sync(cache->sync, true, false, false);
+        fts_sync(cache->sync, true, false, false, false);
       }
 
       mtr_start(&mtr);
@@ -3694,14 +3701,14 @@ static ulint fts_add_doc_by_id(fts_trx_table_t *ftt, doc_id_t doc_id,
         DBUG_EXECUTE_IF("fts_instrument_sync_cache_wait",
                         srv_fatal_semaphore_wait_threshold = 25;
                         fts_max_cache_size = 100;
-                        fts_sync(cache->sync, true, true, false););
+                        fts_sync(cache->sync, true, true, false, false););
 
         DBUG_EXECUTE_IF("fts_instrument_sync",
                         fts_optimize_request_sync_table(table);
                         os_event_wait(cache->sync->event););
 
         DBUG_EXECUTE_IF("fts_instrument_sync_debug",
-                        fts_sync(cache->sync, true, true, false););
+                        fts_sync(cache->sync, true, true, false, false););
 
         DEBUG_SYNC_C("fts_instrument_sync_request");
         DBUG_EXECUTE_IF("fts_instrument_sync_request",
@@ -4056,10 +4063,13 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t
 @param[in]	unlock_cache	whether unlock cache when write node
 @param[in]      sync_start_time Holds the timestamp of start of sync
                                 for deducing the length of sync time
+@param[in]	spill_doc_id	if non-zero, only write out nodes whose
+                                doc ids are all at or below this bound
 @return DB_SUCCESS if all went well else error code */
 static MY_ATTRIBUTE((nonnull, warn_unused_result)) dberr_t
     fts_sync_write_words(trx_t *trx, fts_index_cache_t *index_cache,
-                         bool unlock_cache, ib_time_t sync_start_time) {
+                         bool unlock_cache, ib_time_t sync_start_time,
+                         doc_id_t spill_doc_id) {
   fts_table_t fts_table;
   ulint n_nodes = 0;
   ulint n_words = 0;
@@ -4098,9 +4108,13 @@ static MY_ATTRIBUTE((nonnull, warn_unused_result)) dberr_t
       fts_node_t *fts_node =
           static_cast<fts_node_t *>(ib_vector_get(word->nodes, i));
 
-      if (fts_node->synced) {
+      if (fts_node->synced ||
+          (spill_doc_id != 0 && fts_node->last_doc_id > spill_doc_id)) {
         continue;
       } else {
+        /* Mark the node as synced before the cache lock is
+        released below; concurrent adds will then append to a
+        new node instead of this one. */
         fts_node->synced = true;
       }
 
@@ -4201,8 +4215,17 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t
 
   ut_ad(rbt_validate(index_cache->words));
 
-  return (fts_sync_write_words(trx, index_cache, sync->unlock_cache,
-                               sync->start_time));
+  uintmax_t counter_time = ut_time_monotonic_us();
+
+  dberr_t error =
+      fts_sync_write_words(trx, index_cache, sync->unlock_cache,
+                           sync->start_time,
+                           sync->spill ? sync->spill_doc_id : 0);
+
+  MONITOR_INC_TIME_IN_MICRO_SECS(MONITOR_FTS_SYNC_WRITE_MICROSECOND,
+                                 counter_time);
+
+  return (error);
 }
 
 /** Check if index cache has been synced completely
@@ -4231,6 +4254,7 @@ static bool fts_sync_index_check(fts_index_cache_t *index_cache) {
 @param[in,out]	index_cache	index cache */
 static void fts_sync_index_reset(fts_index_cache_t *index_cache) {
   const ib_rbt_node_t *rbt_node;
+  fts_cache_t *cache = index_cache->index->table->fts->cache;
 
   for (rbt_node = rbt_first(index_cache->words); rbt_node != nullptr;
        rbt_node = rbt_next(index_cache->words, rbt_node)) {
@@ -4240,10 +4264,49 @@ static void fts_sync_index_reset(fts_index_cache_t *index_cache) {
     fts_node_t *fts_node;
     fts_node = static_cast<fts_node_t *>(ib_vector_last(word->nodes));
 
+    /* Nodes covered by synced_doc_id were written by a committed
+    spill, see fts_spill_commit(); resetting them would make the
+    next sync write them a second time. */
+    if (fts_node->last_doc_id <= cache->synced_doc_id) {
+      continue;
+    }
+
     fts_node->synced = false;
   }
 }
 
+/** Reset synced flag on all nodes marked by a spill whose writes were
+rolled back. Nodes at or below synced_doc_id were committed by an earlier
+spill and must stay synced. Caller must hold the cache x-lock.
+@param[in,out]	cache	table cache */
+static void fts_spill_reset(fts_cache_t *cache) {
+  for (ulint i = 0; i < ib_vector_size(cache->indexes); ++i) {
+    fts_index_cache_t *index_cache;
+
+    index_cache =
+        static_cast<fts_index_cache_t *>(ib_vector_get(cache->indexes, i));
+
+    const ib_rbt_node_t *rbt_node;
+
+    for (rbt_node = rbt_first(index_cache->words); rbt_node != nullptr;
+         rbt_node = rbt_next(index_cache->words, rbt_node)) {
+      fts_tokenizer_word_t *word;
+
+      word = rbt_value(fts_tokenizer_word_t, rbt_node);
+
+      for (ulint j = 0; j < ib_vector_size(word->nodes); ++j) {
+        fts_node_t *fts_node =
+            static_cast<fts_node_t *>(ib_vector_get(word->nodes, j));
+
+        if (fts_node->synced &&
+            fts_node->last_doc_id > cache->synced_doc_id) {
+          fts_node->synced = false;
+        }
+      }
+    }
+  }
+}
+
 /** Commit the SYNC, change state of processed doc ids etc.
 @param[in,out]	sync	sync state
 @return DB_SUCCESS if all OK */
@@ -4253,6 +4316,7 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t
   trx_t *trx = sync->trx;
   fts_cache_t *cache = sync->table->fts->cache;
   doc_id_t last_doc_id;
+  uintmax_t counter_time = ut_time_monotonic_us();
 
   trx->op_info = "doing SYNC commit";
 
@@ -4296,6 +4360,55 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t
   trx->dict_operation_lock_mode = 0;
   trx_free_for_background(trx);
 
+  MONITOR_INC_TIME_IN_MICRO_SECS(MONITOR_FTS_SYNC_COMMIT_MICROSECOND,
+                                 counter_time);
+
+  return (error);
+}
+
+/** Commit an incremental spill. Record in the CONFIG table that all doc
+ids up to the spill bound are on disk, so that crash recovery does not
+re-tokenize them, and commit the node writes. The cache is left in place;
+the written nodes stay behind marked as synced and are skipped by the
+next sync, see fts_sync_write_words().
+@param[in,out]	sync	sync state
+@return DB_SUCCESS if all OK */
+static MY_ATTRIBUTE((warn_unused_result)) dberr_t
+    fts_spill_commit(fts_sync_t *sync) {
+  dberr_t error;
+  trx_t *trx = sync->trx;
+  fts_cache_t *cache = sync->table->fts->cache;
+  doc_id_t last_doc_id;
+  uintmax_t counter_time = ut_time_monotonic_us();
+
+  trx->op_info = "doing SPILL commit";
+
+  error = fts_cmp_set_sync_doc_id(sync->table, sync->spill_doc_id, FALSE,
+                                  &last_doc_id);
+
+  if (error != DB_SUCCESS) {
+    /* The node writes are about to be rolled back, unmark the
+    nodes so that the next sync writes them again. */
+    fts_spill_reset(cache);
+  }
+
+  rw_lock_x_unlock(&cache->lock);
+
+  if (error == DB_SUCCESS) {
+    fts_sql_commit(trx);
+  } else {
+    fts_sql_rollback(trx);
+
+    ib::error(ER_IB_MSG_476) << "(" << ut_strerr(error) << ") during SPILL.";
+  }
+
+  /* Avoid assertion in trx_free(). */
+  trx->dict_operation_lock_mode = 0;
+  trx_free_for_background(trx);
+
+  MONITOR_INC_TIME_IN_MICRO_SECS(MONITOR_FTS_SYNC_COMMIT_MICROSECOND,
+                                 counter_time);
+
   return (error);
 }
 
@@ -4346,9 +4459,11 @@ FTS auxiliary INDEX table and clear the cache at the end.
 @param[in]	unlock_cache	whether unlock cache lock when write node
 @param[in]	wait		whether wait when a sync is in progress
 @param[in]      has_dict        whether has dict operation lock
+@param[in]	spill		whether this is an incremental spill that
+                                leaves the cache in place
 @return DB_SUCCESS if all OK */
 static dberr_t fts_sync(fts_sync_t *sync, bool unlock_cache, bool wait,
-                        bool has_dict) {
+                        bool has_dict, bool spill) {
   ulint i;
   dberr_t error = DB_SUCCESS;
   fts_cache_t *cache = sync->table->fts->cache;
@@ -4371,6 +4486,12 @@ static dberr_t fts_sync(fts_sync_t *sync, bool unlock_cache, bool wait,
   }
   sync->unlock_cache = unlock_cache;
   sync->in_progress = true;
+  sync->spill = spill;
+
+  /* Only nodes whose doc ids are all at or below this bound are
+  spilled; docs added while the spill is running get larger doc ids
+  and are left for the next sync. */
+  sync->spill_doc_id = spill ? sync->max_doc_id : 0;
 
   DEBUG_SYNC_C("fts_sync_begin");
   fts_sync_begin(sync);
@@ -4382,7 +4503,7 @@ static dberr_t fts_sync(fts_sync_t *sync, bool unlock_cache, bool wait,
   }
 
 begin_sync:
-  if (cache->total_size > fts_max_cache_size) {
+  if (!sync->spill && cache->total_size > fts_max_cache_size) {
     /* Avoid the case: sync never finish when
     insert/update keeps comming. */
     ut_ad(sync->unlock_cache);
@@ -4406,8 +4527,10 @@ begin_sync:
   DBUG_EXECUTE_IF("fts_instrument_sync_interrupted", sync->interrupted = true;
                   error = DB_INTERRUPTED; goto end_sync;);
 
-  /* Make sure all the caches are synced. */
-  for (i = 0; i < ib_vector_size(cache->indexes); ++i) {
+  /* Make sure all the caches are synced. A spill does one bounded
+  pass only: nodes that show up meanwhile have doc ids above the
+  spill bound and are left for the next sync. */
+  for (i = 0; !sync->spill && i < ib_vector_size(cache->indexes); ++i) {
     fts_index_cache_t *index_cache;
 
     index_cache =
@@ -4423,7 +4546,25 @@ begin_sync:
 
 end_sync:
   if (error == DB_SUCCESS && !sync->interrupted) {
-    error = fts_sync_commit(sync);
+    if (sync->spill) {
+      error = fts_spill_commit(sync);
+      MONITOR_INC(MONITOR_FTS_SPILL_TOTAL);
+    } else {
+      error = fts_sync_commit(sync);
+      MONITOR_INC(MONITOR_FTS_SYNC_TOTAL);
+    }
+  } else if (sync->spill) {
+    /* Unmark the nodes precisely; fts_sync_rollback() would only
+    reset the last node of each word. */
+    fts_spill_reset(cache);
+
+    rw_lock_x_unlock(&cache->lock);
+
+    fts_sql_rollback(sync->trx);
+
+    /* Avoid assertion in trx_free(). */
+    sync->trx->dict_operation_lock_mode = 0;
+    trx_free_for_background(sync->trx);
   } else {
     fts_sync_rollback(sync);
   }
@@ -4431,6 +4572,7 @@ end_sync:
   rw_lock_x_lock(&cache->lock);
   sync->interrupted = false;
   sync->in_progress = false;
+  sync->spill = false;
   os_event_set(sync->event);
   rw_lock_x_unlock(&cache->lock);
 
@@ -4438,12 +4580,14 @@ end_sync:
   we make copies of the two variables that control the trigger. These
   variables can change behind our back and we don't want to hold the
   lock for longer than is needed. */
-  mutex_enter(&cache->deleted_lock);
+  if (!spill) {
+    mutex_enter(&cache->deleted_lock);
 
-  cache->added = 0;
-  cache->deleted = 0;
+    cache->added = 0;
+    cache->deleted = 0;
 
-  mutex_exit(&cache->deleted_lock);
+    mutex_exit(&cache->deleted_lock);
+  }
 
   return (error);
 }
@@ -4463,7 +4607,27 @@ dberr_t fts_sync_table(dict_table_t *table, bool unlock_cache, bool wait,
 
   if (!dict_table_is_discarded(table) && table->fts->cache &&
       !table->is_corrupted()) {
-    err = fts_sync(table->fts->cache->sync, unlock_cache, wait, has_dict);
+    err = fts_sync(table->fts->cache->sync, unlock_cache, wait, has_dict,
+                   false);
+  }
+
+  return (err);
+}
+
+/** Incrementally spill the cache of the table to the FTS auxiliary INDEX
+table. Unlike a full sync the cache is left in place, only nodes below the
+current max doc id are written out and marked as synced, so that the next
+full sync has little left to write.
+@param[in,out]	table		fts table
+@return DB_SUCCESS on success, error code on failure. */
+dberr_t fts_sync_spill(dict_table_t *table) {
+  dberr_t err = DB_SUCCESS;
+
+  ut_ad(table->fts);
+
+  if (!dict_table_is_discarded(table) && table->fts->cache &&
+      !table->is_corrupted()) {
+    err = fts_sync(table->fts->cache->sync, true, false, true, true);
   }
 
   return (err);
@@ -2784,7 +2784,14 @@ void fts_optimize_sync_table(table_id_t table_id) {
 
   if (table) {
     if (dict_table_has_fts_index(table) && table->fts->cache) {
-      fts_sync_table(table, true, false, true);
+      if (fts_enable_incremental_sync &&
+          table->fts->cache->total_size < fts_max_cache_size / 5) {
+        /* Checkpoint the cache in place; the eventual full
+        sync then has little left to write. */
+        fts_sync_spill(table);
+      } else {
+        fts_sync_table(table, true, false, true);
+      }
     }
 
     dd_table_close(table, thd, &mdl, false);
@@ -142,6 +142,20 @@ struct fts_query_t {
 
   doc_id_t upper_doc_id; /*!< Highest doc id in doc_ids */
 
+  /*!< Cursor into doc_ids used by
+  fts_query_intersect_doc_id() to
+  exploit the ascending doc id order
+  of decoded ilists; NULL when the
+  cursor must be (re)positioned with
+  a full rbt_search() */
+  const ib_rbt_node_t *intersect_cursor;
+
+  /*!< Doc id of the last lookup done
+  through intersect_cursor, used to
+  detect when the ascending doc id
+  order restarts */
+  doc_id_t intersect_last_doc_id;
+
   bool boolean_mode; /*!< TRUE if boolean mode query */
 
   ib_vector_t *matched; /*!< Array of matching documents
@@ -682,6 +696,70 @@ static fts_doc_freq_t *fts_query_add_doc_freq(
   return (rbt_value(fts_doc_freq_t, parent.last));
 }
 
+/** Invalidate the ascending-order cursor into fts_query_t::doc_ids. Must
+ be called whenever query->doc_ids is replaced or has nodes added to or
+ removed from it outside of the intersect path. */
+UNIV_INLINE
+void fts_query_intersect_cursor_reset(
+    fts_query_t *query) /*!< in: query instance */
+{
+  query->intersect_cursor = nullptr;
+  query->intersect_last_doc_id = 0;
+}
+
+/** Search for a doc id in fts_query_t::doc_ids. The doc ids decoded from
+ an ilist arrive in ascending order, so instead of doing a full tree search
+ for every doc id we keep a cursor into the tree and advance it
+ monotonically, which makes intersecting a posting list with the current
+ result set O(n + m) instead of O(n log m). The cursor is repositioned with
+ rbt_search() whenever the ascending order restarts, e.g. at the index
+ cache to disk boundary or between the words matching a wildcard search.
+ @return 0 if found, non-zero otherwise (see rbt_search()) */
+static int fts_query_intersect_search(
+    fts_query_t *query,     /*!< in: query instance */
+    ib_rbt_bound_t *parent, /*!< out: position found */
+    doc_id_t doc_id)        /*!< in: doc id to search for */
+{
+  const ib_rbt_node_t *node = query->intersect_cursor;
+
+  if (node == nullptr || doc_id < query->intersect_last_doc_id) {
+    int result;
+
+    /* First lookup, or the doc id order restarted: do a full
+    tree search and remember the position that was reached. On a
+    miss parent->last is adjacent to where doc_id would go, which
+    is still a valid starting point for the next lookup. */
+    result = rbt_search(query->doc_ids, parent, &doc_id);
+
+    query->intersect_cursor = parent->last;
+    query->intersect_last_doc_id = doc_id;
+
+    return (result);
+  }
+
+  query->intersect_last_doc_id = doc_id;
+
+  /* Skip past all entries smaller than doc_id. */
+  while (node != nullptr && rbt_value(fts_ranking_t, node)->doc_id < doc_id) {
+    node = rbt_next(query->doc_ids, node);
+  }
+
+  if (node == nullptr) {
+    /* Reached the end of the result set: every subsequent doc id
+    in ascending order is a guaranteed miss. Park the cursor on the
+    largest entry so that it stays valid. */
+    query->intersect_cursor = rbt_last(query->doc_ids);
+    parent->last = nullptr;
+
+    return (1);
+  }
+
+  query->intersect_cursor = node;
+  parent->last = node;
+
+  return (rbt_value(fts_ranking_t, node)->doc_id == doc_id ? 0 : 1);
+}
+
 /** Add the doc id to the query set only if it's not in the
  deleted array. */
 static void fts_query_union_doc_id(
@@ -705,6 +783,8 @@ static void fts_query_union_doc_id(
 
     rbt_add_node(query->doc_ids, &parent, &ranking);
 
+    fts_query_intersect_cursor_reset(query);
+
     query->total_size +=
         SIZEOF_RBT_NODE_ADD + sizeof(fts_ranking_t) + RANKING_WORDS_INIT_LEN;
   }
@@ -725,6 +805,8 @@ static void fts_query_remove_doc_id(
       rbt_search(query->doc_ids, &parent, &doc_id) == 0) {
     ut_free(rbt_remove_node(query->doc_ids, parent.last));
 
+    fts_query_intersect_cursor_reset(query);
+
     ut_ad(query->total_size >= SIZEOF_RBT_NODE_ADD + sizeof(fts_ranking_t));
     query->total_size -= SIZEOF_RBT_NODE_ADD + sizeof(fts_ranking_t);
   }
@@ -789,7 +871,7 @@ static void fts_query_intersect_doc_id(
   if (fts_bsearch(array, 0, static_cast<int>(size), doc_id) < 0) {
     fts_ranking_t new_ranking;
 
-    if (rbt_search(query->doc_ids, &parent, &doc_id) != 0) {
+    if (fts_query_intersect_search(query, &parent, doc_id) != 0) {
       if (query->multi_exist) {
         return;
       } else {
@@ -902,6 +984,14 @@ static void fts_query_check_node(
     const fts_string_t *token, /*!< in: the token to search */
     const fts_node_t *node)    /*!< in: node to check */
 {
+  /* A node checkpointed to disk by an incremental spill is read
+  again through the auxiliary index table; skip it here so that it
+  is not counted twice. */
+  if (node->synced &&
+      node->last_doc_id <= query->index->table->fts->cache->synced_doc_id) {
+    return;
+  }
+
   /* Skip nodes whose doc ids are out range. */
   if (query->oper == FTS_EXIST &&
       ((query->upper_doc_id > 0 && node->first_doc_id > query->upper_doc_id) ||
@@ -968,6 +1058,14 @@ static ulint fts_cache_find_wildcard(
 
         node = static_cast<const fts_node_t *>(ib_vector_get_const(nodes, i));
 
+        /* Already on disk through an incremental spill, the
+        auxiliary table scan will supply it. */
+        if (node->synced &&
+            node->last_doc_id <=
+                query->index->table->fts->cache->synced_doc_id) {
+          continue;
+        }
+
         ret = rbt_search(query->word_freqs, &freq_parent, &srch_text);
 
         ut_a(ret == 0);
@@ -1162,6 +1260,10 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t fts_query_intersect(
       query->upper_doc_id = 0;
     }
 
+    /* Start with a freshly positioned doc_ids cursor, the result
+    set may have changed since the last intersection. */
+    fts_query_intersect_cursor_reset(query);
+
     /* Search the cache for a matching word first. */
 
     rw_lock_x_lock(&cache->lock);
@@ -1220,6 +1322,8 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t fts_query_intersect(
       query->doc_ids = query->intersection;
       query->intersection = nullptr;
 
+      fts_query_intersect_cursor_reset(query);
+
       ut_a(!query->multi_exist ||
            (query->multi_exist && rbt_size(query->doc_ids) <= n_doc_ids));
     }
@@ -1437,6 +1541,8 @@ static dberr_t fts_merge_doc_ids(
     fts_query_free_doc_ids(query, query->doc_ids);
     query->doc_ids = query->intersection;
     query->intersection = nullptr;
+
+    fts_query_intersect_cursor_reset(query);
   }
 
   return DB_SUCCESS;
@@ -2768,6 +2874,8 @@ static dberr_t fts_query_visitor(
         fts_query_free_doc_ids(query, query->doc_ids);
         query->doc_ids = query->intersection;
         query->intersection = nullptr;
+
+        fts_query_intersect_cursor_reset(query);
       }
 
       break;
@@ -2846,6 +2954,8 @@ static dberr_t fts_ast_visit_sub_exp(fts_ast_node_t *node,
   will merge this result set with the parent after processing. */
   query->doc_ids = rbt_create(sizeof(fts_ranking_t), fts_ranking_doc_id_cmp);
 
+  fts_query_intersect_cursor_reset(query);
+
   query->total_size += SIZEOF_RBT_CREATE;
 
   multi_exist = query->multi_exist;
@@ -2861,6 +2971,9 @@ static dberr_t fts_ast_visit_sub_exp(fts_ast_node_t *node,
   /* Merge the sub-expression result with the parent result set. */
   subexpr_doc_ids = query->doc_ids;
   query->doc_ids = parent_doc_ids;
+
+  fts_query_intersect_cursor_reset(query);
+
   if (error == DB_SUCCESS) {
     error = fts_merge_doc_ids(query, subexpr_doc_ids);
   }
@@ -3442,6 +3555,8 @@ static fts_result_t *fts_query_prepare_result(
     rbt_free(result->rankings_by_id);
     result->rankings_by_id = query->doc_ids;
     query->doc_ids = nullptr;
+
+    fts_query_intersect_cursor_reset(query);
   }
 
   return result;
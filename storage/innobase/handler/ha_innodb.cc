@@ -86,7 +86,9 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "btr0btr.h"
 #include "btr0bulk.h"
 #include "btr0cur.h"
+#include "btr0defrag.h"
 #include "btr0sea.h"
+#include "buf0buf.h"
 #include "buf0dblwr.h"
 #include "buf0dump.h"
 #include "buf0flu.h"
@@ -611,6 +613,9 @@ static PSI_mutex_info all_innodb_mutexes[] = {
     PSI_MUTEX_KEY(dict_table_mutex, 0, 0, PSI_DOCUMENT_ME),
     PSI_MUTEX_KEY(parser_mutex, 0, 0, PSI_DOCUMENT_ME),
     PSI_MUTEX_KEY(recalc_pool_mutex, 0, 0, PSI_DOCUMENT_ME),
+    PSI_MUTEX_KEY(btr_defrag_pool_mutex, 0, 0, PSI_DOCUMENT_ME),
+    PSI_MUTEX_KEY(dict_table_cache_mutex, 0, 0, PSI_DOCUMENT_ME),
+    PSI_MUTEX_KEY(fil_extend_pool_mutex, 0, 0, PSI_DOCUMENT_ME),
     PSI_MUTEX_KEY(fil_system_mutex, 0, 0, PSI_DOCUMENT_ME),
     PSI_MUTEX_KEY(file_open_mutex, 0, 0, PSI_DOCUMENT_ME),
     PSI_MUTEX_KEY(flush_list_mutex, 0, 0, PSI_DOCUMENT_ME),
@@ -641,9 +646,12 @@ static PSI_mutex_info all_innodb_mutexes[] = {
     PSI_MUTEX_KEY(page_cleaner_mutex, 0, 0, PSI_DOCUMENT_ME),
     PSI_MUTEX_KEY(parallel_read_mutex, 0, 0, PSI_DOCUMENT_ME),
     PSI_MUTEX_KEY(dblwr_mutex, 0, 0, PSI_DOCUMENT_ME),
+    PSI_MUTEX_KEY(mvcc_snapshot_mutex, 0, 0, PSI_DOCUMENT_ME),
     PSI_MUTEX_KEY(purge_sys_pq_mutex, 0, 0, PSI_DOCUMENT_ME),
+    PSI_MUTEX_KEY(purge_sys_stats_mutex, 0, 0, PSI_DOCUMENT_ME),
     PSI_MUTEX_KEY(recv_sys_mutex, 0, 0, PSI_DOCUMENT_ME),
     PSI_MUTEX_KEY(recv_writer_mutex, 0, 0, PSI_DOCUMENT_ME),
+    PSI_MUTEX_KEY(row_merge_dup_mutex, 0, 0, PSI_DOCUMENT_ME),
     PSI_MUTEX_KEY(temp_space_rseg_mutex, 0, 0, PSI_DOCUMENT_ME),
     PSI_MUTEX_KEY(undo_space_rseg_mutex, 0, 0, PSI_DOCUMENT_ME),
     PSI_MUTEX_KEY(trx_sys_rseg_mutex, 0, 0, PSI_DOCUMENT_ME),
@@ -719,6 +727,8 @@ is defined */
 static PSI_thread_info all_innodb_threads[] = {
     PSI_KEY(log_archiver_thread, 0, 0, PSI_DOCUMENT_ME),
     PSI_KEY(page_archiver_thread, 0, 0, PSI_DOCUMENT_ME),
+    PSI_KEY(btr_defrag_thread, 0, 0, PSI_DOCUMENT_ME),
+    PSI_KEY(fil_extend_thread, 0, 0, PSI_DOCUMENT_ME),
     PSI_KEY(buf_dump_thread, 0, 0, PSI_DOCUMENT_ME),
     PSI_KEY(clone_ddl_thread, 0, 0, PSI_DOCUMENT_ME),
     PSI_KEY(clone_gtid_thread, 0, 0, PSI_DOCUMENT_ME),
@@ -751,6 +761,7 @@ static PSI_thread_info all_innodb_threads[] = {
     PSI_KEY(srv_ts_alter_encrypt_thread, 0, 0, PSI_DOCUMENT_ME),
     PSI_KEY(parallel_read_thread, 0, 0, PSI_DOCUMENT_ME),
     PSI_KEY(parallel_read_ahead_thread, 0, 0, PSI_DOCUMENT_ME),
+    PSI_KEY(ddl_index_build_thread, 0, 0, PSI_DOCUMENT_ME),
     PSI_KEY(meb::redo_log_archive_consumer_thread, 0, 0, PSI_DOCUMENT_ME)};
 #endif /* UNIV_PFS_THREAD */
 
@@ -895,6 +906,15 @@ static MYSQL_THDVAR_BOOL(ft_enable_stopword, PLUGIN_VAR_OPCMDARG,
                          "Create FTS index with stopword.", nullptr, nullptr,
                          /* default */ TRUE);
 
+static MYSQL_THDVAR_BOOL(
+    bulk_load, PLUGIN_VAR_OPCMDARG,
+    "Skip the redo log flush when this session's transactions commit. The"
+    " transactions stay crash consistent but up to a second of them can be"
+    " lost on a crash, like innodb_flush_log_at_trx_commit=0. Intended for"
+    " loads of data that can be regenerated.",
+    nullptr, nullptr,
+    /* default */ FALSE);
+
 static MYSQL_THDVAR_ULONG(lock_wait_timeout, PLUGIN_VAR_RQCMDARG,
                           "Timeout in seconds an InnoDB transaction may wait "
                           "for a lock before being rolled back. Values above "
@@ -917,6 +937,14 @@ static MYSQL_THDVAR_ULONG(parallel_read_threads, PLUGIN_VAR_RQCMDARG,
                           Parallel_reader::MAX_THREADS, /* Maxumum. */
                           0);
 
+static MYSQL_THDVAR_ULONG(ddl_build_threads, PLUGIN_VAR_RQCMDARG,
+                          "Number of threads to sort and build indexes during"
+                          " ALTER TABLE.",
+                          nullptr, nullptr, 4, /* Default. */
+                          1,                   /* Minimum. */
+                          64,                  /* Maximum. */
+                          0);
+
 static SHOW_VAR innodb_status_variables[] = {
     {"buffer_pool_dump_status",
      (char *)&export_vars.innodb_buffer_pool_dump_status, SHOW_CHAR,
@@ -1563,6 +1591,14 @@ int thd_trx_priority(THD *thd) {
   return (thd == nullptr ? 0 : thd_tx_priority(thd));
 }
 
+/** Check if the session is doing a bulk load, in which case the redo log
+ flush is skipped when its transactions commit.
+ @return true if innodb_bulk_load is set for the session */
+bool thd_is_bulk_load(THD *thd) /*!< in: thread handle, can be NULL */
+{
+  return (thd != nullptr && THDVAR(thd, bulk_load));
+}
+
 /** Check if the transaction is an auto-commit transaction. TRUE also
  implies that it is a SELECT (read-only) transaction.
  @return true if the transaction is an auto commit read-only transaction. */
@@ -1782,6 +1818,13 @@ ulong thd_parallel_read_threads(THD *thd) {
   return (THDVAR(thd, parallel_read_threads));
 }
 
+/** Return the number of index build threads for this session.
+@param[in]      thd       Session instance, or nullptr to query the global
+                          innodb_ddl_build_threads value. */
+ulong thd_ddl_build_threads(THD *thd) {
+  return (THDVAR(thd, ddl_build_threads));
+}
+
 /** Check if statement is of type INSERT .... SELECT that involves
 use of intrinsic tables.
 @param[in]	user_thd	thread handler
@@ -5263,6 +5306,30 @@ static int innobase_start_trx_and_assign_read_view(
   return 0;
 }
 
+/** Report the buffer pool and read I/O work accumulated by the current
+thread to the statement metrics of the connection, and reset the
+accumulators. Called when a statement or transaction ends in InnoDB;
+reading and resetting is idempotent, so multiple calls for the same
+statement are harmless. Work done on behalf of the statement by other
+threads (read-ahead, parallel read workers) is not included.
+@param[in]	thd	connection whose statement is ending */
+static void innobase_report_statement_io_stats(THD *thd) {
+  buf_stat_per_thread_t &stat = buf_stat_per_thread;
+
+  if (thd == nullptr || !EQ_CURRENT_THD(thd)) {
+    return;
+  }
+
+  if (stat.n_page_gets == 0 && stat.n_pages_dirtied == 0) {
+    return;
+  }
+
+  thd_statement_storage_io_stats(thd, stat.n_page_gets, stat.n_pages_read,
+                                 stat.n_pages_dirtied, stat.n_bytes_read);
+
+  stat = buf_stat_per_thread_t();
+}
+
 /** Commits a transaction in an InnoDB database or marks an SQL statement
  ended.
  @return 0 or deadlock error if the transaction was aborted by another
@@ -5280,6 +5347,8 @@ static int innobase_commit(handlerton *hton, /*!< in: InnoDB handlerton */
   DBUG_PRINT("trans", ("ending transaction"));
   DEBUG_SYNC_C("transaction_commit_start");
 
+  innobase_report_statement_io_stats(thd);
+
   trx_t *trx = check_trx_exists(thd);
 
   /* We are about to check if the transaction is_aborted, and if it is,
@@ -5432,6 +5501,8 @@ static int innobase_rollback(handlerton *hton, /*!< in: InnoDB handlerton */
   DBUG_ASSERT(hton == innodb_hton_ptr);
   DBUG_PRINT("trans", ("aborting transaction"));
 
+  innobase_report_statement_io_stats(thd);
+
   trx_t *trx = check_trx_exists(thd);
 
   TrxInInnoDB trx_in_innodb(trx);
@@ -8152,6 +8223,39 @@ void ha_innobase::build_template(bool whole_row) {
       templ->rec_field_no = templ->clust_rec_field_no;
     }
   }
+
+  /* Compute how many leading fields of the index have to be parsed to
+  evaluate the template, so that row_search_mvcc() can compute partial
+  record offsets when reading a few columns of a wide table. The DB_TRX_ID
+  and DB_ROLL_PTR fields are included for the MVCC visibility check. */
+
+  m_prebuilt->n_rec_fields_hint = 0;
+
+  if (m_prebuilt->template_type == ROW_MYSQL_REC_FIELDS &&
+      index == clust_index) {
+    ulint max_field = dict_index_get_n_unique(index) + 2;
+
+    for (i = 0; i < m_prebuilt->n_template; i++) {
+      const mysql_row_templ_t *templ = &m_prebuilt->mysql_template[i];
+
+      if (templ->is_virtual) {
+        /* Virtual columns are not stored in the clustered
+        index; do not try to limit the offsets. */
+        max_field = ULINT_UNDEFINED;
+        break;
+      }
+
+      max_field = std::max(max_field, templ->rec_field_no + 1);
+
+      if (templ->icp_rec_field_no != ULINT_UNDEFINED) {
+        max_field = std::max(max_field, templ->icp_rec_field_no + 1);
+      }
+    }
+
+    if (max_field < dict_index_get_n_fields(index)) {
+      m_prebuilt->n_rec_fields_hint = max_field;
+    }
+  }
 }
 
 /** This special handling is really to overcome the limitations of MySQL's
@@ -10182,22 +10286,26 @@ int ha_innobase::sample_init(void *&scan_ctx, double sampling_percentage,
     return HA_ERR_OUT_OF_MEM;
   }
 
-  scan_ctx = static_cast<void *>(sampler);
-
   auto index = m_prebuilt->table->first_index();
 
   auto success = sampler->init(trx, index, m_prebuilt);
 
   if (!success) {
+    UT_DELETE(sampler);
     return (HA_ERR_SAMPLING_INIT_FAILED);
   }
 
   dberr_t db_err = sampler->run();
 
   if (db_err != DB_SUCCESS) {
+    UT_DELETE(sampler);
     return (convert_error_code_to_mysql(db_err, 0, ha_thd()));
   }
 
+  /* The caller invokes sample_end() only if we return success, so the
+  sampler must not be handed over on the error paths above. */
+  scan_ctx = static_cast<void *>(sampler);
+
   return (0);
 }
 
@@ -12728,6 +12836,70 @@ static ulint innobase_parse_merge_threshold(THD *thd, const char *str) {
   return (0);
 }
 
+/** Parse BUF_ADMISSION value from the string.
+@param[in]	thd	connection
+@param[in]	str	string which might include 'BUF_ADMISSION='
+@return	buf_admission_t value parsed.
+BUF_ADMISSION_DEFAULT means not found or invalid value. */
+static ulint innobase_parse_buf_admission(THD *thd, const char *str) {
+  static const char *label = "BUF_ADMISSION=";
+  static const size_t label_len = strlen(label);
+  const char *pos = str;
+
+  pos = strstr(str, label);
+
+  if (pos == nullptr) {
+    return (BUF_ADMISSION_DEFAULT);
+  }
+
+  pos += label_len;
+
+  if (strncmp(pos, "HOT", 3) == 0) {
+    return (BUF_ADMISSION_HOT);
+  } else if (strncmp(pos, "COLD", 4) == 0) {
+    return (BUF_ADMISSION_COLD);
+  }
+
+  push_warning_printf(
+      thd, Sql_condition::SL_WARNING, ER_ILLEGAL_HA_CREATE_OPTION,
+      "InnoDB: Invalid value for BUF_ADMISSION in the CREATE TABLE"
+      " statement. The value is ignored.");
+
+  return (BUF_ADMISSION_DEFAULT);
+}
+
+/** Parse CHANGE_BUFFERING value from the string.
+@param[in]	thd	connection
+@param[in]	str	string which might include 'CHANGE_BUFFERING='
+@return	dict_ibuf_policy_t value parsed.
+IBUF_POLICY_DEFAULT means not found or invalid value. */
+static ulint innobase_parse_ibuf_policy(THD *thd, const char *str) {
+  static const char *label = "CHANGE_BUFFERING=";
+  static const size_t label_len = strlen(label);
+  const char *pos = str;
+
+  pos = strstr(str, label);
+
+  if (pos == nullptr) {
+    return (IBUF_POLICY_DEFAULT);
+  }
+
+  pos += label_len;
+
+  if (strncmp(pos, "NONE", 4) == 0) {
+    return (IBUF_POLICY_NONE);
+  } else if (strncmp(pos, "ALL", 3) == 0) {
+    return (IBUF_POLICY_ALL);
+  }
+
+  push_warning_printf(
+      thd, Sql_condition::SL_WARNING, ER_ILLEGAL_HA_CREATE_OPTION,
+      "InnoDB: Invalid value for CHANGE_BUFFERING in the CREATE TABLE"
+      " statement. The value is ignored.");
+
+  return (IBUF_POLICY_DEFAULT);
+}
+
 /** Parse hint for table and its indexes, and update the information
 in dictionary.
 @param[in]	thd		connection
@@ -12737,13 +12909,23 @@ void innobase_parse_hint_from_comment(THD *thd, dict_table_t *table,
                                       const TABLE_SHARE *table_share) {
   ulint merge_threshold_table;
   ulint merge_threshold_index[MAX_KEY];
+  ulint admission_table;
+  ulint admission_index[MAX_KEY];
+  ulint ibuf_policy_table;
+  ulint ibuf_policy_index[MAX_KEY];
   bool is_found[MAX_KEY];
 
   if (table_share->comment.str != nullptr) {
     merge_threshold_table =
         innobase_parse_merge_threshold(thd, table_share->comment.str);
+    admission_table =
+        innobase_parse_buf_admission(thd, table_share->comment.str);
+    ibuf_policy_table =
+        innobase_parse_ibuf_policy(thd, table_share->comment.str);
   } else {
     merge_threshold_table = DICT_INDEX_MERGE_THRESHOLD_DEFAULT;
+    admission_table = BUF_ADMISSION_DEFAULT;
+    ibuf_policy_table = IBUF_POLICY_DEFAULT;
   }
 
   if (merge_threshold_table == 0) {
@@ -12758,13 +12940,27 @@ void innobase_parse_hint_from_comment(THD *thd, dict_table_t *table,
     if (key_info->flags & HA_USES_COMMENT && key_info->comment.str != nullptr) {
       merge_threshold_index[i] =
           innobase_parse_merge_threshold(thd, key_info->comment.str);
+      admission_index[i] =
+          innobase_parse_buf_admission(thd, key_info->comment.str);
+      ibuf_policy_index[i] =
+          innobase_parse_ibuf_policy(thd, key_info->comment.str);
     } else {
       merge_threshold_index[i] = merge_threshold_table;
+      admission_index[i] = admission_table;
+      ibuf_policy_index[i] = ibuf_policy_table;
     }
 
     if (merge_threshold_index[i] == 0) {
       merge_threshold_index[i] = merge_threshold_table;
     }
+
+    if (admission_index[i] == BUF_ADMISSION_DEFAULT) {
+      admission_index[i] = admission_table;
+    }
+
+    if (ibuf_policy_index[i] == IBUF_POLICY_DEFAULT) {
+      ibuf_policy_index[i] = ibuf_policy_table;
+    }
   }
 
   for (uint i = 0; i < table_share->keys; i++) {
@@ -12781,6 +12977,8 @@ void innobase_parse_hint_from_comment(THD *thd, dict_table_t *table,
       pessimistic tree operations */
       rw_lock_x_lock(dict_index_get_lock(index));
       index->merge_threshold = merge_threshold_table;
+      index->admission = admission_table;
+      index->ibuf_policy = ibuf_policy_table;
       rw_lock_x_unlock(dict_index_get_lock(index));
 
       continue;
@@ -12798,6 +12996,8 @@ void innobase_parse_hint_from_comment(THD *thd, dict_table_t *table,
         pessimistic tree operations */
         rw_lock_x_lock(dict_index_get_lock(index));
         index->merge_threshold = merge_threshold_index[i];
+        index->admission = admission_index[i];
+        index->ibuf_policy = ibuf_policy_index[i];
         rw_lock_x_unlock(dict_index_get_lock(index));
         is_found[i] = true;
 
@@ -15802,6 +16002,31 @@ int ha_innobase::records(ha_rows *num_rows) /*!< out: number of rows */
 
   ut_ad(index->is_clustered());
 
+  /* Counting can be done over any index that stores exactly one entry per
+  row. Prefer the index with the fewest leaf pages, which is typically a
+  narrow secondary index rather than the clustered index carrying the full
+  rows; this reduces the number of pages the scan has to touch. Fulltext,
+  spatial, multi-value and virtual-column indexes do not map one entry to
+  one row (or cannot be scanned by the parallel reader), so they are
+  skipped, as are uncommitted and unusable indexes. */
+  for (dict_index_t *candidate = index->next(); candidate != nullptr;
+       candidate = candidate->next()) {
+    if (!candidate->is_committed() || candidate->is_corrupted() ||
+        dict_index_is_online_ddl(candidate) ||
+        dict_index_is_spatial(candidate) || candidate->is_multi_value() ||
+        dict_index_has_virtual(candidate) ||
+        (candidate->type & DICT_FTS) != 0 ||
+        !candidate->is_usable(m_prebuilt->trx)) {
+      continue;
+    }
+
+    if (candidate->stat_n_leaf_pages > 0 &&
+        (index->stat_n_leaf_pages == 0 ||
+         candidate->stat_n_leaf_pages < index->stat_n_leaf_pages)) {
+      index = candidate;
+    }
+  }
+
   m_prebuilt->index_usable = index->is_usable(m_prebuilt->trx);
 
   if (!m_prebuilt->index_usable) {
@@ -15810,7 +16035,7 @@ int ha_innobase::records(ha_rows *num_rows) /*!< out: number of rows */
   }
 
   /* (Re)Build the m_prebuilt->mysql_template if it is null to use
-  the clustered index and just the key, no off-record data. */
+  the chosen index and just the key, no off-record data. */
   m_prebuilt->index = index;
   m_prebuilt->clear_search_tuples();
   m_prebuilt->read_just_key = 1;
@@ -15818,7 +16043,7 @@ int ha_innobase::records(ha_rows *num_rows) /*!< out: number of rows */
 
   size_t n_threads = thd_parallel_read_threads(m_prebuilt->trx->mysql_thd);
 
-  /* Count the records in the clustered index */
+  /* Count the records in the chosen index */
   ret = row_scan_index_for_mysql(m_prebuilt, index, n_threads, false, &n_rows);
   reset_template();
   switch (ret) {
@@ -21063,6 +21288,13 @@ static MYSQL_SYSVAR_BOOL(
     "Stores each InnoDB table to an .ibd file in the database dir.", nullptr,
     nullptr, TRUE);
 
+static MYSQL_SYSVAR_ULONG(
+    fil_shards, srv_fil_shards, PLUGIN_VAR_OPCMDARG | PLUGIN_VAR_READONLY,
+    "Number of shards that partition the tablespace memory cache. More shards"
+    " reduce mutex contention on instances with very many tablespaces. The"
+    " undo and redo tablespaces get their own shards on top of this count.",
+    nullptr, nullptr, 58, 1, 256, 0);
+
 static MYSQL_SYSVAR_STR(ft_server_stopword_table,
                         innobase_server_stopword_table,
                         PLUGIN_VAR_OPCMDARG | PLUGIN_VAR_MEMALLOC,
@@ -21186,6 +21418,14 @@ static MYSQL_SYSVAR_BOOL(
     " new statistics)",
     nullptr, nullptr, TRUE);
 
+static MYSQL_SYSVAR_BOOL(
+    stats_incremental, srv_stats_incremental, PLUGIN_VAR_OPCMDARG,
+    "Refresh persistent statistics incrementally during automatic"
+    " recalculation, scaling the existing estimates by the growth of the"
+    " index instead of re-sampling it. A full re-sampling still happens"
+    " periodically and on ANALYZE TABLE",
+    nullptr, nullptr, FALSE);
+
 static MYSQL_SYSVAR_ULONGLONG(
     stats_persistent_sample_pages, srv_stats_persistent_sample_pages,
     PLUGIN_VAR_RQCMDARG,
@@ -21235,6 +21475,21 @@ static MYSQL_SYSVAR_ULONG(autoextend_increment,
                           "Data file autoextend increment in megabytes",
                           nullptr, nullptr, 64L, 1L, 1000L, 0);
 
+static MYSQL_SYSVAR_BOOL(
+    background_extend, srv_background_extend, PLUGIN_VAR_OPCMDARG,
+    "Preallocate physical space for tablespaces in the background when"
+    " they run low on free extents, so that foreground threads do not"
+    " stall on synchronous file growth at autoextend.",
+    nullptr, nullptr, FALSE);
+
+static MYSQL_SYSVAR_ULONG(
+    background_extend_extents, srv_background_extend_extents,
+    PLUGIN_VAR_RQCMDARG,
+    "Number of extents the background extend thread preallocates per"
+    " tablespace; also the free extent watermark below which a tablespace"
+    " is queued for preallocation",
+    nullptr, nullptr, 4, 1, 256, 0);
+
 static MYSQL_SYSVAR_BOOL(
     dedicated_server, srv_dedicated_server,
     PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_NOPERSIST | PLUGIN_VAR_READONLY,
@@ -21351,6 +21606,16 @@ static MYSQL_SYSVAR_BOOL(
     "logic will not be affected. ",
     nullptr, innodb_srv_buffer_pool_in_core_file_update, TRUE);
 
+static MYSQL_SYSVAR_BOOL(
+    buffer_pool_madvise_huge, srv_buf_pool_madvise_huge,
+    PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+    "Advise the OS with MADV_HUGEPAGE that buffer pool chunks should be "
+    "backed by transparent huge pages. Unlike innodb_use_large_pages this "
+    "needs no pre-reserved hugetlbfs pool and falls back to regular pages "
+    "for chunks the kernel cannot back with huge pages. Ignored when "
+    "innodb_use_large_pages is in effect.",
+    nullptr, nullptr, FALSE);
+
 static MYSQL_SYSVAR_ULONG(
     buffer_pool_dump_pct, srv_buf_pool_dump_pct, PLUGIN_VAR_RQCMDARG,
     "Dump only the hottest N% of each buffer pool, defaults to 25", nullptr,
@@ -21386,6 +21651,12 @@ static MYSQL_SYSVAR_BOOL(
     "Load the buffer pool from a file named @@innodb_buffer_pool_filename",
     nullptr, nullptr, TRUE);
 
+static MYSQL_SYSVAR_ULONG(
+    buffer_pool_load_threads, srv_buf_pool_load_threads, PLUGIN_VAR_RQCMDARG,
+    "Number of worker threads used to load the buffer pool from a file "
+    "named @@innodb_buffer_pool_filename",
+    nullptr, nullptr, 4, 1, 64, 0);
+
 static MYSQL_SYSVAR_ULONG(lru_scan_depth, srv_LRU_scan_depth,
                           PLUGIN_VAR_RQCMDARG,
                           "How deep to scan LRU to keep it clean", nullptr,
@@ -21418,6 +21689,18 @@ static MYSQL_SYSVAR_BOOL(
     " and we rely on innodb_lock_wait_timeout in case of deadlock.",
     nullptr, innobase_deadlock_detect_update, TRUE);
 
+static MYSQL_SYSVAR_BOOL(
+    defragment, srv_btr_defrag_enabled, PLUGIN_VAR_OPCMDARG,
+    "Enable background defragmentation, which merges under-filled"
+    " index leaf pages into their siblings after delete churn.",
+    nullptr, nullptr, FALSE);
+
+static MYSQL_SYSVAR_ULONG(defragment_pages_per_second,
+                          srv_btr_defrag_pages_per_sec, PLUGIN_VAR_RQCMDARG,
+                          "Number of index leaf pages the background "
+                          "defragmenter may process per second",
+                          nullptr, nullptr, 64, 1, 1000, 0);
+
 static MYSQL_SYSVAR_LONG(fill_factor, innobase_fill_factor, PLUGIN_VAR_RQCMDARG,
                          "Percentage of B-tree page filled during bulk insert",
                          nullptr, nullptr, 100, 10, 100, 0);
@@ -21427,6 +21710,13 @@ static MYSQL_SYSVAR_BOOL(
     "Whether to enable additional FTS diagnostic printout ", nullptr, nullptr,
     FALSE);
 
+static MYSQL_SYSVAR_BOOL(
+    ft_enable_incremental_sync, fts_enable_incremental_sync,
+    PLUGIN_VAR_OPCMDARG,
+    "Whether to spill the FTS cache to the auxiliary index tables "
+    "incrementally in the background instead of only syncing it wholesale",
+    nullptr, nullptr, FALSE);
+
 static MYSQL_SYSVAR_BOOL(disable_sort_file_cache, srv_disable_sort_file_cache,
                          PLUGIN_VAR_OPCMDARG,
                          "Whether to disable OS system file cache for sort I/O",
@@ -21673,6 +21963,15 @@ static MYSQL_SYSVAR_ULONG(log_flusher_timeout, srv_log_flusher_timeout,
                           NULL, NULL, INNODB_LOG_FLUSHER_TIMEOUT_DEFAULT, 0,
                           ULONG_MAX, 0);
 
+static MYSQL_SYSVAR_ULONG(
+    log_flush_coalesce_max_time, srv_log_flush_coalesce_max_time,
+    PLUGIN_VAR_RQCMDARG,
+    "Maximum time for which the log flusher thread may hold a pending fsync"
+    " to coalesce more commits into it (microseconds). The effective window"
+    " is additionally capped by the average fsync time. 0 disables the"
+    " coalescing.",
+    NULL, NULL, 0, 0, 100000, 0);
+
 static MYSQL_SYSVAR_ULONG(
     log_write_notifier_spin_delay, srv_log_write_notifier_spin_delay,
     PLUGIN_VAR_RQCMDARG,
@@ -21719,6 +22018,12 @@ static MYSQL_SYSVAR_UINT(
     "Percentage of the buffer pool to reserve for 'old' blocks.", nullptr,
     innodb_old_blocks_pct_update, 100 * 3 / 8, 5, 95, 0);
 
+static MYSQL_SYSVAR_BOOL(
+    adaptive_old_blocks, srv_adaptive_old_blocks, PLUGIN_VAR_NOCMDARG,
+    "Automatically shrink the 'old' blocks sublist while a scan phase is"
+    " detected, treating innodb_old_blocks_pct as the upper bound.",
+    nullptr, nullptr, FALSE);
+
 static MYSQL_SYSVAR_UINT(
     old_blocks_time, buf_LRU_old_threshold_ms, PLUGIN_VAR_RQCMDARG,
     "Move blocks to the 'new' end of the buffer pool if the first access"
@@ -21865,12 +22170,41 @@ static MYSQL_SYSVAR_BOOL(use_native_aio, srv_use_native_aio,
                          "Use native AIO if supported on this platform.",
                          nullptr, nullptr, TRUE);
 
+static MYSQL_SYSVAR_BOOL(
+    use_io_uring, srv_use_io_uring, PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+    "Submit native AIO requests through io_uring instead of io_submit()."
+    " Requires a server built with liburing, a kernel with io_uring support"
+    " and innodb_use_native_aio enabled.",
+    nullptr, nullptr, FALSE);
+
+static MYSQL_SYSVAR_BOOL(
+    io_uring_sqpoll, srv_io_uring_sqpoll,
+    PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+    "Create the io_uring instances with kernel side submission queue"
+    " polling (IORING_SETUP_SQPOLL), removing the submission syscall from"
+    " the IO path. Ignored unless innodb_use_io_uring is enabled.",
+    nullptr, nullptr, FALSE);
+
+static MYSQL_SYSVAR_BOOL(
+    punch_hole_writes, srv_punch_hole_writes, PLUGIN_VAR_NOCMDARG,
+    "Punch a hole for the unused tail of transparently compressed page"
+    " writes. Disable to skip the extra syscall per write and trade disk"
+    " space savings for lower write latency.",
+    nullptr, nullptr, TRUE);
+
 #ifdef HAVE_LIBNUMA
 static MYSQL_SYSVAR_BOOL(
     numa_interleave, srv_numa_interleave,
     PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
     "Use NUMA interleave memory policy to allocate InnoDB buffer pool.",
     nullptr, nullptr, FALSE);
+
+static MYSQL_SYSVAR_BOOL(
+    numa_node_bind, srv_numa_node_bind,
+    PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+    "Bind each InnoDB buffer pool instance to a single NUMA node,"
+    " distributing the instances round-robin over the configured nodes.",
+    nullptr, nullptr, FALSE);
 #endif /* HAVE_LIBNUMA */
 
 static MYSQL_SYSVAR_BOOL(
@@ -22118,6 +22452,8 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(api_trx_level),
     MYSQL_SYSVAR(api_bk_commit_interval),
     MYSQL_SYSVAR(autoextend_increment),
+    MYSQL_SYSVAR(background_extend),
+    MYSQL_SYSVAR(background_extend_extents),
     MYSQL_SYSVAR(dedicated_server),
     MYSQL_SYSVAR(buffer_pool_size),
     MYSQL_SYSVAR(buffer_pool_chunk_size),
@@ -22126,6 +22462,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(buffer_pool_dump_now),
     MYSQL_SYSVAR(buffer_pool_dump_at_shutdown),
     MYSQL_SYSVAR(buffer_pool_in_core_file),
+    MYSQL_SYSVAR(buffer_pool_madvise_huge),
     MYSQL_SYSVAR(buffer_pool_dump_pct),
 #ifdef UNIV_DEBUG
     MYSQL_SYSVAR(buffer_pool_evict),
@@ -22133,6 +22470,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(buffer_pool_load_now),
     MYSQL_SYSVAR(buffer_pool_load_abort),
     MYSQL_SYSVAR(buffer_pool_load_at_startup),
+    MYSQL_SYSVAR(buffer_pool_load_threads),
     MYSQL_SYSVAR(lru_scan_depth),
     MYSQL_SYSVAR(flush_neighbors),
     MYSQL_SYSVAR(checksum_algorithm),
@@ -22152,10 +22490,12 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(api_enable_binlog),
     MYSQL_SYSVAR(api_enable_mdl),
     MYSQL_SYSVAR(api_disable_rowlock),
+    MYSQL_SYSVAR(bulk_load),
     MYSQL_SYSVAR(fast_shutdown),
     MYSQL_SYSVAR(read_io_threads),
     MYSQL_SYSVAR(write_io_threads),
     MYSQL_SYSVAR(file_per_table),
+    MYSQL_SYSVAR(fil_shards),
     MYSQL_SYSVAR(flush_log_at_timeout),
     MYSQL_SYSVAR(flush_log_at_trx_commit),
     MYSQL_SYSVAR(flush_method),
@@ -22175,6 +22515,8 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(force_load_corrupted),
     MYSQL_SYSVAR(lock_wait_timeout),
     MYSQL_SYSVAR(deadlock_detect),
+    MYSQL_SYSVAR(defragment),
+    MYSQL_SYSVAR(defragment_pages_per_second),
     MYSQL_SYSVAR(page_size),
     MYSQL_SYSVAR(log_buffer_size),
     MYSQL_SYSVAR(log_file_size),
@@ -22202,6 +22544,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(log_checkpoint_every),
     MYSQL_SYSVAR(log_flusher_spin_delay),
     MYSQL_SYSVAR(log_flusher_timeout),
+    MYSQL_SYSVAR(log_flush_coalesce_max_time),
     MYSQL_SYSVAR(log_write_notifier_spin_delay),
     MYSQL_SYSVAR(log_write_notifier_timeout),
     MYSQL_SYSVAR(log_flush_notifier_spin_delay),
@@ -22218,6 +22561,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(flushing_avg_loops),
     MYSQL_SYSVAR(max_purge_lag),
     MYSQL_SYSVAR(max_purge_lag_delay),
+    MYSQL_SYSVAR(adaptive_old_blocks),
     MYSQL_SYSVAR(old_blocks_pct),
     MYSQL_SYSVAR(old_blocks_time),
     MYSQL_SYSVAR(open_files),
@@ -22225,6 +22569,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(rollback_on_timeout),
     MYSQL_SYSVAR(ft_aux_table),
     MYSQL_SYSVAR(ft_enable_diag_print),
+    MYSQL_SYSVAR(ft_enable_incremental_sync),
     MYSQL_SYSVAR(ft_server_stopword_table),
     MYSQL_SYSVAR(ft_user_stopword_table),
     MYSQL_SYSVAR(disable_sort_file_cache),
@@ -22233,6 +22578,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(stats_persistent),
     MYSQL_SYSVAR(stats_persistent_sample_pages),
     MYSQL_SYSVAR(stats_auto_recalc),
+    MYSQL_SYSVAR(stats_incremental),
     MYSQL_SYSVAR(adaptive_hash_index),
     MYSQL_SYSVAR(adaptive_hash_index_parts),
     MYSQL_SYSVAR(stats_method),
@@ -22254,8 +22600,12 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(autoinc_lock_mode),
     MYSQL_SYSVAR(version),
     MYSQL_SYSVAR(use_native_aio),
+    MYSQL_SYSVAR(use_io_uring),
+    MYSQL_SYSVAR(io_uring_sqpoll),
+    MYSQL_SYSVAR(punch_hole_writes),
 #ifdef HAVE_LIBNUMA
     MYSQL_SYSVAR(numa_interleave),
+    MYSQL_SYSVAR(numa_node_bind),
 #endif /* HAVE_LIBNUMA */
     MYSQL_SYSVAR(change_buffering),
     MYSQL_SYSVAR(change_buffer_max_size),
@@ -22327,6 +22677,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(ddl_log_crash_reset_debug),
 #endif /* UNIV_DEBUG */
     MYSQL_SYSVAR(parallel_read_threads),
+    MYSQL_SYSVAR(ddl_build_threads),
     nullptr};
 
 mysql_declare_plugin(innobase){
@@ -22355,7 +22706,7 @@ mysql_declare_plugin(innobase){
     i_s_innodb_ft_index_cache, i_s_innodb_ft_index_table, i_s_innodb_tables,
     i_s_innodb_tablestats, i_s_innodb_indexes, i_s_innodb_tablespaces,
     i_s_innodb_columns, i_s_innodb_virtual, i_s_innodb_cached_indexes,
-    i_s_innodb_session_temp_tablespaces
+    i_s_innodb_purge_backlog, i_s_innodb_session_temp_tablespaces
 
     mysql_declare_plugin_end;
 
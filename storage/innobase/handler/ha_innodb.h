@@ -681,6 +681,11 @@ extern const struct _ft_vft ft_vft_result;
                           innodb_parallel_read_threads value. */
 ulong thd_parallel_read_threads(THD *thd);
 
+/** Return the number of index build threads for this session.
+@param[in]      thd       Session instance, or nullptr to query the global
+                          innodb_ddl_build_threads value. */
+ulong thd_ddl_build_threads(THD *thd);
+
 /** Structure Returned by ha_innobase::ft_init_ext() */
 typedef struct new_ft_info {
   struct _ft_vft *please;
@@ -2055,8 +2055,6 @@ int ha_innopart::sample_init(void *&scan_ctx, double sampling_percentage,
     return HA_ERR_OUT_OF_MEM;
   }
 
-  scan_ctx = sampler;
-
   const auto first_used_partition = m_part_info->get_first_used_partition();
 
   for (auto i = first_used_partition; i < m_tot_parts;
@@ -2067,6 +2065,7 @@ int ha_innopart::sample_init(void *&scan_ctx, double sampling_percentage,
       ib_senderrf(ha_thd(), IB_LOG_LEVEL_ERROR, ER_TABLESPACE_DISCARDED,
                   m_prebuilt->table->name.m_name);
 
+      UT_DELETE(sampler);
       return (HA_ERR_NO_SUCH_TABLE);
     }
 
@@ -2077,6 +2076,7 @@ int ha_innopart::sample_init(void *&scan_ctx, double sampling_percentage,
     auto success = sampler->init(trx, index, m_prebuilt);
 
     if (!success) {
+      UT_DELETE(sampler);
       return (HA_ERR_SAMPLING_INIT_FAILED);
     }
   }
@@ -2084,9 +2084,14 @@ int ha_innopart::sample_init(void *&scan_ctx, double sampling_percentage,
   dberr_t db_err = sampler->run();
 
   if (db_err != DB_SUCCESS) {
+    UT_DELETE(sampler);
     return (convert_error_code_to_mysql(db_err, 0, ha_thd()));
   }
 
+  /* The caller invokes sample_end() only if we return success, so the
+  sampler must not be handed over on the error paths above. */
+  scan_ctx = sampler;
+
   return (0);
 }
 
@@ -613,7 +613,16 @@ static inline Instant_Type innobase_support_instant(
   /* If it's an ADD COLUMN without changing existing stored column orders
   (change trailing virtual column orders is fine, especially for supporting
   adding stored columns to a table with functional indexes), or including
-  ADD VIRTUAL COLUMN */
+  ADD VIRTUAL COLUMN.
+
+  Note: only trailing ADD can be instant in this record format. Physical
+  records carry just an instant flag plus a field count (see
+  rec_get_instant_flag_new() and dict_index_t::get_instant_fields()),
+  with absent trailing columns materialized from
+  dict_col_t::instant_default on read. Instant DROP, rename combined
+  with ADD, or reorder would need per-record row-version metadata
+  mapping physical fields to logical columns, which this format does
+  not store; such ALTERs fall through to the rebuild path. */
   if ((alter_inplace_flags == Alter_inplace_info::ADD_STORED_BASE_COLUMN) ||
       (alter_inplace_flags == (Alter_inplace_info::ADD_STORED_BASE_COLUMN |
                                Alter_inplace_info::ADD_VIRTUAL_COLUMN)) ||
@@ -9775,6 +9784,7 @@ int ha_innopart::parallel_scan_init(void *&scan_ctx, size_t &num_threads) {
     ib::error(ER_INNODB_UNABLE_TO_ACQUIRE_DD_OBJECT)
         << "InnoDB can't get table object for table"
         << table_share->table_name.str;
+    UT_DELETE(adapter);
     return HA_ERR_INTERNAL_ERROR;
   }
 
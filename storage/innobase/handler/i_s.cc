@@ -67,6 +67,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "srv0start.h"
 #include "srv0tmp.h"
 #include "trx0i_s.h"
+#include "trx0purge.h"
 #include "trx0trx.h"
 #include "ut0new.h"
 
@@ -7116,6 +7117,153 @@ struct st_mysql_plugin i_s_innodb_cached_indexes = {
     STRUCT_FLD(flags, 0UL),
 };
 
+/** INFORMATION_SCHEMA.INNODB_PURGE_BACKLOG */
+
+/* Fields of the dynamic table INFORMATION_SCHEMA.INNODB_PURGE_BACKLOG
+Every time any column gets changed, added or removed, please remember
+to change i_s_innodb_plugin_version_postfix accordingly, so that
+the change can be propagated to server */
+static ST_FIELD_INFO innodb_purge_backlog_fields_info[] = {
+#define PURGE_BACKLOG_TABLE_ID 0
+    {STRUCT_FLD(field_name, "TABLE_ID"),
+     STRUCT_FLD(field_length, MY_INT64_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONGLONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+#define PURGE_BACKLOG_PENDING_RECORDS 1
+    {STRUCT_FLD(field_name, "PENDING_RECORDS"),
+     STRUCT_FLD(field_length, MY_INT64_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONGLONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+#define PURGE_BACKLOG_DISPATCHED_RECORDS 2
+    {STRUCT_FLD(field_name, "DISPATCHED_RECORDS"),
+     STRUCT_FLD(field_length, MY_INT64_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONGLONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+    END_OF_ST_FIELD_INFO};
+
+/** Fill INFORMATION_SCHEMA.INNODB_PURGE_BACKLOG from the per-table
+statistics maintained by the purge coordinator: how many undo records of
+each table are part of the purge batch being worked on right now, and how
+many have been dispatched to purge workers in total. Tables with no
+pending records in the current batch are reported too, until their entry
+is evicted to bound memory use.
+@param[in]	thd	thread
+@param[in,out]	tables	tables to fill
+@return 0 on success */
+static int i_s_innodb_purge_backlog_fill_table(THD *thd, TABLE_LIST *tables,
+                                               Item * /* not used */) {
+  DBUG_TRACE;
+
+  /* deny access to user without PROCESS_ACL privilege */
+  if (check_global_access(thd, PROCESS_ACL)) {
+    return 0;
+  }
+
+  if (purge_sys == nullptr) {
+    return 0;
+  }
+
+  /* Copy the statistics out, so that the rows can be stored without
+  holding the mutex the purge coordinator uses. */
+  mutex_enter(&purge_sys->stats_mutex);
+  const trx_purge_t::Table_stats stats_copy{purge_sys->table_stats};
+  mutex_exit(&purge_sys->stats_mutex);
+
+  Field **fields = tables->table->field;
+
+  for (const auto &stat : stats_copy) {
+    OK(fields[PURGE_BACKLOG_TABLE_ID]->store(stat.first, true));
+
+    OK(fields[PURGE_BACKLOG_PENDING_RECORDS]->store(stat.second.pending_recs,
+                                                    true));
+
+    OK(fields[PURGE_BACKLOG_DISPATCHED_RECORDS]->store(
+        stat.second.dispatched_recs, true));
+
+    OK(schema_table_store_record(thd, tables->table));
+  }
+
+  return 0;
+}
+
+/** Bind the dynamic table INFORMATION_SCHEMA.INNODB_PURGE_BACKLOG.
+@param[in,out]	p	table schema object
+@return 0 on success */
+static int innodb_purge_backlog_init(void *p) {
+  ST_SCHEMA_TABLE *schema;
+
+  DBUG_TRACE;
+
+  schema = static_cast<ST_SCHEMA_TABLE *>(p);
+
+  schema->fields_info = innodb_purge_backlog_fields_info;
+  schema->fill_table = i_s_innodb_purge_backlog_fill_table;
+
+  return 0;
+}
+
+struct st_mysql_plugin i_s_innodb_purge_backlog = {
+    /* the plugin type (a MYSQL_XXX_PLUGIN value) */
+    /* int */
+    STRUCT_FLD(type, MYSQL_INFORMATION_SCHEMA_PLUGIN),
+
+    /* pointer to type-specific plugin descriptor */
+    /* void* */
+    STRUCT_FLD(info, &i_s_info),
+
+    /* plugin name */
+    /* const char* */
+    STRUCT_FLD(name, "INNODB_PURGE_BACKLOG"),
+
+    /* plugin author (for SHOW PLUGINS) */
+    /* const char* */
+    STRUCT_FLD(author, plugin_author),
+
+    /* general descriptive text (for SHOW PLUGINS) */
+    /* const char* */
+    STRUCT_FLD(descr, "InnoDB per-table purge backlog"),
+
+    /* the plugin license (PLUGIN_LICENSE_XXX) */
+    /* int */
+    STRUCT_FLD(license, PLUGIN_LICENSE_GPL),
+
+    /* the function to invoke when plugin is loaded */
+    /* int (*)(void*); */
+    STRUCT_FLD(init, innodb_purge_backlog_init),
+
+    /* the function to invoke when plugin is un installed */
+    /* int (*)(void*); */
+    nullptr,
+
+    /* the function to invoke when plugin is unloaded */
+    /* int (*)(void*); */
+    STRUCT_FLD(deinit, i_s_common_deinit),
+
+    /* plugin version (for SHOW PLUGINS) */
+    /* unsigned int */
+    STRUCT_FLD(version, i_s_innodb_plugin_version),
+
+    /* SHOW_VAR* */
+    STRUCT_FLD(status_vars, nullptr),
+
+    /* SYS_VAR** */
+    STRUCT_FLD(system_vars, nullptr),
+
+    /* reserved for dependency checking */
+    /* void* */
+    STRUCT_FLD(__reserved1, nullptr),
+
+    /* Plugin flags */
+    /* unsigned long */
+    STRUCT_FLD(flags, 0UL),
+};
+
 /**  INNODB_SESSION_TEMPORARY TABLESPACES   ***********************/
 /* Fields of the dynamic table
 INFORMATION_SCHEMA.INNODB_SESSION_TEMPORARY_TABLESPACES */
@@ -3386,6 +3386,16 @@ ibool ibuf_insert(ibuf_op_t op, const dtuple_t *entry, dict_index_t *index,
 
   ut_a(!index->is_clustered());
 
+  /* Indexes with a CHANGE_BUFFERING=NONE policy are rejected already
+  by ibuf_should_try(). */
+  ut_ad(index->ibuf_policy != IBUF_POLICY_NONE);
+
+  if (index->ibuf_policy == IBUF_POLICY_ALL && use != IBUF_USE_NONE) {
+    /* The index opted in to buffering of every operation type,
+    as long as buffering is enabled at all. */
+    use = IBUF_USE_ALL;
+  }
+
   no_counter = use <= IBUF_USE_INSERT;
 
   switch (op) {
@@ -0,0 +1,79 @@
+/*****************************************************************************
+
+Copyright (c) 2020, Oracle and/or its affiliates. All Rights Reserved.
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU General Public License, version 2.0, as published by the
+Free Software Foundation.
+
+This program is also distributed with certain software (including but not
+limited to OpenSSL) that is licensed under separate terms, as designated in a
+particular file or component or in included license documentation. The authors
+of MySQL hereby grant you an additional permission to link the program and
+your derivative works with the separately licensed software that they have
+included with MySQL.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU General Public License, version 2.0,
+for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
+
+*****************************************************************************/
+
+/** @file include/btr0defrag.h
+ Background B-tree defragmentation
+
+ Merges under-filled sibling leaf pages of indexes that have suffered
+ delete churn, using btr_compress(), without rebuilding the table the
+ way OPTIMIZE TABLE does. */
+
+#ifndef btr0defrag_h
+#define btr0defrag_h
+
+#include "univ.i"
+
+#include "dict0types.h"
+#include "os0event.h"
+
+/** Whether the background defragmenter is enabled;
+corresponds to innodb_defragment */
+extern bool srv_btr_defrag_enabled;
+
+/** Number of leaf pages the defragmenter may process per second;
+corresponds to innodb_defragment_pages_per_second */
+extern ulong srv_btr_defrag_pages_per_sec;
+
+/** Event to wake up btr_defrag_thread() */
+extern os_event_t btr_defrag_event;
+
+/** Initialize global variables needed for the operation of
+btr_defrag_thread(). Must be called before btr_defrag_thread() is
+started. */
+void btr_defrag_thread_init();
+
+/** Free resources allocated by btr_defrag_thread_init(), must be called
+after btr_defrag_thread() has exited. */
+void btr_defrag_thread_deinit();
+
+/** Add a table to the defragmentation pool, to have the under-filled
+leaf pages of its indexes merged in the background. Does nothing if the
+table is already in the pool or if the pool is full.
+@param[in]	table	table whose indexes to defragment */
+void btr_defrag_pool_add(const dict_table_t *table);
+
+/** Remove a table from the defragmentation pool, called when the table
+is dropped.
+@param[in]	id	table id */
+void btr_defrag_pool_del(table_id_t id);
+
+/** The background B-tree defragmentation thread. */
+void btr_defrag_thread();
+
+/** Shutdown the B-tree defragmentation thread. */
+void btr_defrag_shutdown();
+
+#endif /* btr0defrag_h */
@@ -59,6 +59,11 @@ enum btr_pcur_pos_t {
   BTR_PCUR_AFTER_LAST_IN_TREE = 5    /* in an empty tree */
 };
 
+/** Number of leaf pages a persistent cursor must cross through sibling
+pointers before its traversal is considered logically sequential and
+move_to_next_page() starts prefetching the sibling one page ahead. */
+constexpr ulint BTR_PCUR_SIBLING_PREFETCH_THRESHOLD = 4;
+
 #define btr_pcur_create_for_mysql() btr_pcur_t::create_for_mysql()
 #define btr_pcur_free_for_mysql(p) btr_pcur_t::free_for_mysql(p)
 
@@ -591,6 +596,14 @@ struct btr_pcur_t {
   /** Read level where the cursor would be positioned or re-positioned. */
   ulint m_read_level{0};
 
+  /** Number of leaf pages this cursor has crossed through sibling
+  pointers since it was (re)positioned by a search. Once the count
+  reaches BTR_PCUR_SIBLING_PREFETCH_THRESHOLD the traversal is treated
+  as a logically sequential scan and move_to_next_page() prefetches one
+  sibling ahead; physical read-ahead cannot detect such scans when the
+  leaf pages are not in physical page order within an extent. */
+  ulint m_leaf_pages_crossed{0};
+
   /* NOTE that the following field is initialized only during import
   tablespace, otherwise undefined */
   import_ctx_t *import_ctx{nullptr};
@@ -604,6 +617,7 @@ inline void btr_pcur_t::init(size_t read_level) {
   m_old_rec = nullptr;
   m_btr_cur.rtr_info = nullptr;
   m_read_level = read_level;
+  m_leaf_pages_crossed = 0;
   import_ctx = nullptr;
 }
 
@@ -1009,6 +1023,7 @@ inline void btr_pcur_t::reset() {
   m_old_rec = nullptr;
   m_old_n_fields = 0;
   m_old_stored = false;
+  m_leaf_pages_crossed = 0;
 
   m_latch_mode = BTR_NO_LATCHES;
   m_pos_state = BTR_PCUR_NOT_POSITIONED;
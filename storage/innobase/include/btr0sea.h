@@ -215,6 +215,13 @@ bool btr_search_own_any(ulint mode);
 UNIV_INLINE
 void btr_search_s_unlock_all();
 
+/** Get the adaptive hash index partition number for an index.
+A partition is selected from the pair of index-id, space-id.
+@param[in]	index	index handler
+@return partition number, less than btr_ahi_parts */
+UNIV_INLINE
+ulint btr_get_search_part(const dict_index_t *index);
+
 /** Get the latch based on index attributes.
 A latch is selected from an array of latches using pair of index-id, space-id.
 @param[in]	index	index handler
@@ -271,6 +278,26 @@ struct btr_search_t {
                    the same prefix should be indexed in the
                    hash index */
                    /*---------------------- @} */
+  /* @{ The following fields implement the automatic per-index
+  controller of the adaptive hash index. Like the fields above they
+  are not protected by any latch, so the counts are approximate. */
+  ulint n_hash_succ_window;
+  /*!< number of successful hash searches in the
+  current evaluation window */
+  ulint n_hash_fail_window;
+  /*!< number of failed hash searches in the
+  current evaluation window */
+  ibool hash_disabled_auto;
+  /*!< TRUE if the use and building of the hash
+  index has been suspended for this index,
+  because failed hash searches dominated an
+  evaluation window */
+  ulint n_hash_auto_skipped;
+  /*!< number of searches since the suspension;
+  when it reaches BTR_SEARCH_AUTO_RETRY the
+  suspension is lifted and the index gets
+  another chance */
+  /* @} */
 #ifdef UNIV_SEARCH_PERF_STAT
   ulint n_hash_succ; /*!< number of successful hash searches thus
                      far */
@@ -293,6 +320,19 @@ struct btr_search_sys_t {
                               to rec_t pointers on index pages */
 };
 
+/** Statistics of one adaptive hash index partition. The counters are
+incremented without synchronization, so they are approximate. */
+struct btr_search_part_stat_t {
+  uint64_t n_hits;   /*!< number of successful hash searches */
+  uint64_t n_misses; /*!< number of failed hash searches */
+};
+
+/** Per-partition statistics of the adaptive hash index, an array of
+btr_ahi_parts elements. Printed in SHOW ENGINE INNODB STATUS; the latch
+waits of each partition are visible through the performance schema
+instrumentation of btr_search_latches. */
+extern btr_search_part_stat_t *btr_search_part_stats;
+
 /** Latches protecting access to adaptive hash index. */
 extern rw_lock_t **btr_search_latches;
 
@@ -319,6 +359,19 @@ pattern */
 the hash index */
 #define BTR_SEARCH_ON_HASH_LIMIT 3
 
+/** Number of hash searches after which the automatic controller
+evaluates the hit ratio of an index */
+#define BTR_SEARCH_AUTO_WINDOW 10000
+
+/** When the failed hash searches in an evaluation window exceed the
+successful ones by this factor, the use of the hash index is suspended
+for the index */
+#define BTR_SEARCH_AUTO_FAIL_FACTOR 3
+
+/** Number of searches for which a suspended index stays suspended
+before the hash index is given another chance */
+#define BTR_SEARCH_AUTO_RETRY 100000
+
 #include "btr0sea.ic"
 
 #endif
@@ -47,6 +47,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 
 #include "buf/buf.h"
 
+#include <atomic>
 #include <ostream>
 
 // Forward declaration
@@ -992,6 +993,22 @@ UNIV_INLINE
 buf_page_t *buf_page_hash_get_low(buf_pool_t *buf_pool,
                                   const page_id_t &page_id);
 
+/** Marks the start of a modification of the page_hash shard covering
+fold. The shard's rw-lock must be held in X mode. The shard version
+becomes odd, which makes concurrent latch-free lookups fall back to the
+latched path until buf_page_hash_modify_exit() is called.
+@param[in,out]	buf_pool	buffer pool instance
+@param[in]	fold		page id fold covered by the shard */
+UNIV_INLINE
+void buf_page_hash_modify_enter(buf_pool_t *buf_pool, ulint fold);
+
+/** Marks the end of a modification of the page_hash shard covering
+fold, making the shard version even again.
+@param[in,out]	buf_pool	buffer pool instance
+@param[in]	fold		page id fold covered by the shard */
+UNIV_INLINE
+void buf_page_hash_modify_exit(buf_pool_t *buf_pool, ulint fold);
+
 /** Returns the control block of a file page, NULL if not found.
 If the block is found and lock is not NULL then the appropriate
 page_hash lock is acquired in the specified lock mode. Otherwise,
@@ -1304,6 +1321,12 @@ class buf_page_t {
   buffer pool. Protected by block mutex */
   unsigned access_time;
 
+  /** Buffer pool admission priority inherited from the index this page
+  belongs to; stamped by the B-tree layer once the page has been looked
+  up, BUF_ADMISSION_DEFAULT until then. Read without synchronization for
+  heuristic purposes only. */
+  buf_admission_t admission;
+
 #ifdef UNIV_DEBUG
   /** This is set to TRUE when fsp frees a page in buffer pool;
   protected by buf_pool->zip_mutex or buf_block_t::mutex. */
@@ -1669,6 +1692,30 @@ struct buf_buddy_free_t {
 };
 
 /** @brief The buffer pool statistics structure. */
+/** Per-thread accumulators for the buffer pool and read I/O work done on
+behalf of the current statement. The counters are incremented on the buffer
+pool hot paths without any synchronization, and are read and reset by the
+handler at statement boundaries to feed the statement metrics exposed in
+performance_schema. Work done by background threads (read-ahead, page
+cleaners, parallel read workers) is not attributed to any statement. */
+struct buf_stat_per_thread_t {
+  /** Number of page get requests (buffer pool read requests). */
+  uint64_t n_page_gets;
+
+  /** Number of synchronous page reads from disk (buffer pool misses). */
+  uint64_t n_pages_read;
+
+  /** Number of pages added to the flush list (pages first dirtied). */
+  uint64_t n_pages_dirtied;
+
+  /** Number of bytes read synchronously from disk. */
+  uint64_t n_bytes_read;
+};
+
+/** Buffer pool and read I/O work done by the current thread, see
+buf_stat_per_thread_t. */
+extern thread_local buf_stat_per_thread_t buf_stat_per_thread;
+
 struct buf_pool_stat_t {
   using Shards = Counter::Shards<64>;
 
@@ -1815,8 +1862,17 @@ struct buf_pool_t {
                                indexed by (space_id, offset).
                                page_hash is protected by an
                                array of mutexes. */
-  hash_table_t *page_hash_old; /*!< old pointer to page_hash to be
-                               freed after resizing buffer pool */
+  hash_table_t *page_hash_old; /*!< old pointer to page_hash, kept
+                               around after a resize so that late
+                               latch-free lookups never dereference
+                               freed cells; freed by the next resize
+                               or at shutdown */
+  std::atomic<uint64_t> *page_hash_versions;
+  /*!< modification counters for the
+  page_hash shards, one per page_hash
+  rw-lock; odd while the shard is being
+  modified (seqlock protocol). Used to
+  validate latch-free lookups. */
   hash_table_t *zip_hash;      /*!< hash table of buf_block_t blocks
                                whose frames are allocated to the
                                zip buddy system,
@@ -76,6 +76,19 @@ class buf_stat_per_index_t {
     m_store->dec(id.conv_to_int());
   }
 
+  /** Forget the counter of a given index altogether. To be called when
+  the index tree is freed, so that a dropped index does not leave a stale
+  entry behind: the pages it still owns in the buffer pool are removed
+  with their content ignored and are thus never decremented one by one.
+  @param[in]	id	id of the index whose counter to remove */
+  void drop(const index_id_t &id) {
+    if (should_skip(id)) {
+      return;
+    }
+
+    m_store->del(id.conv_to_int());
+  }
+
   /** Get the number of pages in the buffer pool for a given index.
   @param[in]	id	id of the index whose pages to peek
   @return number of pages */
@@ -71,6 +71,18 @@ enum buf_flush_t {
   BUF_FLUSH_N_TYPES      /*!< index of last element + 1  */
 };
 
+/** Buffer pool admission priority of a page, inherited from the index
+the page belongs to. See buf_page_make_young_if_needed() and
+buf_LRU_add_block(). */
+enum buf_admission_t {
+  BUF_ADMISSION_DEFAULT = 0, /*!< normal midpoint insertion and
+                             promotion rules */
+  BUF_ADMISSION_HOT,         /*!< skip the midpoint probation; make
+                             the page young on first access */
+  BUF_ADMISSION_COLD         /*!< never promote the page out of the
+                             old sublist */
+};
+
 /** Algorithm to remove the pages for a tablespace from the buffer pool.
 See buf_LRU_flush_or_remove_pages(). */
 enum buf_remove_t {
@@ -42,6 +42,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #endif /* UNIV_HOTBACKUP */
 #include "btr0types.h"
 #include "data0type.h"
+#include "data0types.h"
 #include "dict0types.h"
 #include "mem0mem.h"
 #include "rem0types.h"
@@ -874,6 +875,33 @@ namespace dd {
 class Spatial_reference_system;
 }
 
+/** Function which compares a data tuple to a physical record on a leading
+prefix of the index fields that is known to be binary comparable. Behaves
+like cmp_dtuple_rec_with_match() restricted to that prefix: returns a
+negative number, 0 or a positive number, and updates the matched field
+count. See cmp_dtuple_rec_binary_prefix().
+@param[in]	dtuple		data tuple to compare
+@param[in]	rec		B-tree record
+@param[in]	offsets		rec_get_offsets(rec)
+@param[in]	n_cmp		number of fields to compare, at most
+                                dict_index_t::n_binary_cmp_fields
+@param[in,out]	matched_fields	number of already completely matched
+                                fields; when the function returns, the
+                                value is the number of fields compared
+                                and found equal */
+typedef int (*index_cmp_func_t)(const dtuple_t *dtuple, const rec_t *rec,
+                                const ulint *offsets, ulint n_cmp,
+                                ulint *matched_fields);
+
+/** Per-index change buffering policy, set from the CHANGE_BUFFERING
+hint in the index or table comment. See ibuf_should_try(). */
+enum dict_ibuf_policy_t {
+  IBUF_POLICY_DEFAULT = 0, /*!< follow innodb_change_buffering */
+  IBUF_POLICY_NONE,        /*!< never buffer changes to this index */
+  IBUF_POLICY_ALL          /*!< buffer changes whenever the global
+                           setting allows any buffering at all */
+};
+
 /** Data structure for an index.  Most fields will be
 initialized to 0, NULL or FALSE in dict_mem_index_create(). */
 struct dict_index_t {
@@ -890,6 +918,16 @@ struct dict_index_t {
   data size drops below this limit in percent,
   merging it to a neighbor is tried */
 #define DICT_INDEX_MERGE_THRESHOLD_DEFAULT 50
+  unsigned admission : 2;
+  /*!< buffer pool admission priority for the
+  pages of this index; one of buf_admission_t,
+  set from the BUF_ADMISSION hint in the index
+  or table comment */
+  unsigned ibuf_policy : 2;
+  /*!< change buffering policy for this index;
+  one of dict_ibuf_policy_t, set from the
+  CHANGE_BUFFERING hint in the index or table
+  comment */
   unsigned type : DICT_IT_BITS;
   /*!< index type (DICT_CLUSTERED, DICT_UNIQUE,
   DICT_IBUF, DICT_CORRUPT) */
@@ -961,6 +999,18 @@ struct dict_index_t {
 #define DICT_INDEX_MAGIC_N 76789786
 #endif
   dict_field_t *fields; /*!< array of field descriptions */
+  index_cmp_func_t cmp_binary_prefix;
+  /*!< comparison function used for the first
+  n_binary_cmp_fields fields of the index, all of
+  which are fixed-length, NOT NULL, ascending and
+  compared bytewise (integers, system columns and
+  binary strings); selected when the index is
+  added to the dictionary cache, or NULL if no
+  leading prefix qualifies */
+  unsigned n_binary_cmp_fields : 10;
+  /*!< number of leading index fields that
+  cmp_binary_prefix can compare; 0 if
+  cmp_binary_prefix == NULL */
 #ifndef UNIV_HOTBACKUP
   st_mysql_ftparser *parser; /*!< fulltext parser plugin */
   bool is_ngram;
@@ -1534,6 +1584,14 @@ struct dict_table_t {
   is in memory and later the stats information would be initialized */
   inline void acquire_with_lock();
 
+  /** Acquire the table handle without holding the dict_sys mutex,
+  but only if the table is already referenced. Because the reference
+  count can only be raised from zero under the dict_sys mutex, a
+  successful call guarantees that no concurrent DDL can free the
+  table object before the handle is released.
+  @return true if a handle was acquired */
+  inline bool acquire_if_referenced();
+
   /** Release the table handle. */
   inline void release();
 
@@ -1861,6 +1919,13 @@ regardless of the value of the global srv_stats_persistent_auto_recalc
   any latch, because this is only used for heuristics. */
   ib_uint64_t stat_modified_counter;
 
+  /** Number of consecutive incremental persistent statistics
+  recalculations since the last full one. Used to force a full
+  re-sampling periodically so that the scaling errors of the
+  incremental updates cannot accumulate. Protected by
+  dict_table_stats_lock(). */
+  unsigned stat_incremental_recalcs;
+
 /** Background stats thread is not working on this table. */
 #define BG_STAT_NONE 0
 
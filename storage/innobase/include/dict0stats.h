@@ -46,6 +46,14 @@ enum dict_stats_upd_option_t {
                            storage, if the persistent storage is
                            not present then emit a warning and
                            fall back to transient stats */
+  DICT_STATS_RECALC_PERSISTENT_INCREMENTAL, /* refresh the persistent
+                          statistics from the current index sizes and
+                          the row count delta without re-sampling the
+                          indexes, and save them to the persistent
+                          storage; falls back to
+                          DICT_STATS_RECALC_PERSISTENT when no usable
+                          statistics exist in memory or when too many
+                          incremental refreshes have accumulated */
   DICT_STATS_RECALC_TRANSIENT,  /* (re) calculate the statistics
                             using an imprecise quick algo
                             without saving the results
@@ -41,6 +41,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "page0size.h"
 #ifndef UNIV_HOTBACKUP
 #include "ibuf0types.h"
+#include "os0event.h"
 #endif /* !UNIV_HOTBACKUP */
 #include "ut0new.h"
 
@@ -295,6 +296,11 @@ struct fil_space_t {
   /** true if this space is currently in unflushed_spaces */
   bool is_in_unflushed_spaces;
 
+  /** true while the tablespace is queued for, or undergoing, background
+  preallocation; prevents duplicate entries in the extend pool.
+  Protected by the extend pool mutex. */
+  bool prealloc_queued;
+
   /** Compression algorithm */
   Compression::Type compression_type;
 
@@ -1495,6 +1501,41 @@ void fil_extend_tablespaces_to_stored_len();
 bool fil_space_extend(fil_space_t *space, page_no_t size)
     MY_ATTRIBUTE((warn_unused_result));
 
+#ifndef UNIV_HOTBACKUP
+/** Whether the background tablespace extend thread preallocates
+physical space for tablespaces running low on free extents */
+extern bool srv_background_extend;
+
+/** Number of extents the background extend thread preallocates per
+tablespace; also the free extent watermark below which a tablespace
+is queued for preallocation */
+extern ulong srv_background_extend_extents;
+
+/** Event to wake up the background tablespace extend thread */
+extern os_event_t fil_extend_event;
+
+/** Allocate and initialize the pool used by the background tablespace
+extend thread. Must be called before the thread is started. */
+void fil_extend_thread_init();
+
+/** Free the resources allocated by fil_extend_thread_init(). */
+void fil_extend_thread_deinit();
+
+/** Queue a tablespace for background preallocation. Called when the
+number of free extents in the tablespace has fallen below the
+watermark. A no-op if the tablespace is already queued.
+@param[in,out]	space		tablespace running low on free extents */
+void fil_extend_pool_add(fil_space_t *space);
+
+/** Background thread that preallocates physical space for the
+tablespaces queued by fil_extend_pool_add(), so that foreground
+threads do not stall on file growth at autoextend. */
+void fil_extend_thread();
+
+/** Shut down the background tablespace extend thread. */
+void fil_extend_shutdown();
+#endif /* !UNIV_HOTBACKUP */
+
 /** Tries to reserve free extents in a file space.
 @param[in]	space_id	Tablespace ID
 @param[in]	n_free_now	Number of free extents now
@@ -427,6 +427,10 @@ extern ulong fts_min_token_size;
 need a sync to free some memory */
 extern bool fts_need_sync;
 
+/** Whether to checkpoint the cache to the auxiliary index tables
+incrementally in the background instead of only syncing it wholesale */
+extern bool fts_enable_incremental_sync;
+
 /** Variable specifying the table that has Fulltext index to display its
 content through information schema table */
 extern char *fts_internal_tbl_name;
@@ -752,6 +756,14 @@ FTS auxiliary INDEX table and clear the cache at the end.
 dberr_t fts_sync_table(dict_table_t *table, bool unlock_cache, bool wait,
                        bool has_dict);
 
+/** Incrementally spill the cache of the table to the FTS auxiliary INDEX
+table. Unlike a full sync the cache is left in place, only nodes below the
+current max doc id are written out and marked as synced, so that the next
+full sync has little left to write.
+@param[in,out]	table		fts table
+@return DB_SUCCESS on success, error code on failure. */
+dberr_t fts_sync_spill(dict_table_t *table);
+
 /** Create an FTS index cache. */
 CHARSET_INFO *fts_index_get_charset(dict_index_t *index); /*!< in: FTS index */
 
@@ -134,6 +134,13 @@ struct fts_sync_t {
   bool in_progress;  /*!< flag whether sync is in progress.*/
   bool unlock_cache; /*!< flag whether unlock cache when
                      write fts node */
+  bool spill;        /*!< flag whether this is an incremental
+                     spill that checkpoints synced nodes to
+                     disk without clearing the cache */
+  doc_id_t spill_doc_id;
+  /*!< highest doc id covered by the
+  current spill, only nodes whose doc ids
+  are all below it are written out */
   os_event_t event;  /*!< sync finish event */
 };
 
@@ -238,6 +238,11 @@ THD *thd_trx_arbitrate(THD *requestor, THD *holder);
 
 int thd_trx_priority(THD *thd);
 
+/** Check if the session is doing a bulk load, in which case the redo log
+ flush is skipped when its transactions commit.
+ @return true if innodb_bulk_load is set for the session */
+bool thd_is_bulk_load(THD *thd); /*!< in: thread handle, or NULL */
+
 /** Check if the transaction is an auto-commit transaction. TRUE also
  implies that it is a SELECT (read-only) transaction.
  @return true if the transaction is an auto commit read-only transaction. */
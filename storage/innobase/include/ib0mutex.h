@@ -494,7 +494,8 @@ struct TTASEventMutex {
 
   TTASEventMutex() UNIV_NOTHROW : m_lock_word(MUTEX_STATE_UNLOCKED),
                                   m_waiters(),
-                                  m_event() {
+                                  m_event(),
+                                  m_spin_budget() {
     /* Check that lock_word is aligned. */
     ut_ad(!((ulint)&m_lock_word % sizeof(ulint)));
   }
@@ -632,10 +633,25 @@ struct TTASEventMutex {
     uint32_t n_waits = 0;
     const uint32_t step = max_spins;
 
+    /* Start from the adaptive budget of this mutex instead of the full
+    configured round count. The budget is high while spinning tends to
+    acquire the mutex without a sync array wait, and decays towards a
+    quarter of the configured rounds while acquisitions keep ending up
+    in the sync array anyway, in which case most of the spinning is
+    wasted cycles. The floor keeps every contended acquisition probing,
+    so the budget recovers as soon as spinning pays off again. */
+    const uint32_t floor_spins = max_spins / 4 + 1;
+    const uint32_t budget = m_spin_budget.load(std::memory_order_relaxed);
+    uint32_t curr_max_spins = max_spins;
+
+    if (budget >= floor_spins && budget < max_spins) {
+      curr_max_spins = budget;
+    }
+
     for (;;) {
       /* If the lock was free then try and acquire it. */
 
-      if (is_free(max_spins, max_delay, n_spins)) {
+      if (is_free(curr_max_spins, max_delay, n_spins)) {
         if (try_lock()) {
           break;
         } else {
@@ -643,7 +659,7 @@ struct TTASEventMutex {
         }
 
       } else {
-        max_spins = n_spins + step;
+        curr_max_spins = n_spins + step;
       }
 
       ++n_waits;
@@ -670,6 +686,18 @@ struct TTASEventMutex {
     mutex design */
 
     m_policy.add(n_spins, n_waits);
+
+    /* Exponentially weighted update of the spin budget: move towards
+    the full configured rounds when spinning acquired the mutex, and
+    towards the floor when we had to wait in the sync array. Races on
+    the budget only lose an update, which is harmless. */
+    const uint32_t target = (n_waits == 0) ? max_spins : floor_spins;
+
+    m_spin_budget.store(
+        budget > 0
+            ? static_cast<uint32_t>((uint64_t{budget} * 3 + target) / 4)
+            : target,
+        std::memory_order_relaxed);
   }
 
   /** @return the value of the m_waiters flag */
@@ -708,6 +736,13 @@ struct TTASEventMutex {
   /** Used by sync0arr.cc for the wait queue */
   os_event_t m_event;
 
+  /** Adaptive spin budget for contended acquisitions, in rounds; 0
+  until the first contended acquisition, then kept between a quarter of
+  the configured rounds and the full configured rounds by
+  spin_and_try_lock(). Updated with relaxed atomics only; it is a
+  heuristic, not a correctness property. */
+  std::atomic<uint32_t> m_spin_budget;
+
   /** Policy data */
   MutexPolicy m_policy;
 };
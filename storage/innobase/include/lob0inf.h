@@ -59,7 +59,12 @@ dberr_t insert(InsertContext *ctx, trx_t *trx, ref_t &ref,
 dberr_t z_insert(InsertContext *ctx, trx_t *trx, ref_t &ref,
                  big_rec_field_t *field, ulint field_j);
 
-/** Fetch a large object (LOB) from the system.
+/** Fetch a large object (LOB) from the system. The LOB can be read in
+chunks by calling this repeatedly with an increasing offset and a buffer
+of the chunk size, so that it is never materialized in memory as a
+whole; only the data pages of the requested chunk are accessed. A
+non-zero offset is supported only for the new LOB format, not for pages
+of type FIL_PAGE_TYPE_BLOB.
 @param[in]  ctx    the read context information.
 @param[in]  ref    the LOB reference identifying the LOB.
 @param[in]  offset read the LOB from the given offset.
@@ -1626,6 +1626,16 @@ void os_aio_wait_until_no_pending_writes();
 /** Wakes up simulated aio i/o-handler threads if they have something to do. */
 void os_aio_simulated_wake_handler_threads();
 
+/** Starts deferring native AIO submissions on the calling thread, so
+that a burst of asynchronous requests (e.g. a read-ahead batch) can be
+handed to the kernel with a single io_submit() call per io context by
+os_aio_batch_end(). Has no effect unless Linux native AIO is used. */
+void os_aio_batch_begin();
+
+/** Submits all native AIO requests deferred on the calling thread
+since os_aio_batch_begin(). */
+void os_aio_batch_end();
+
 /** This function can be called if one wants to post a batch of reads and
 prefers an i/o-handler thread to handle them all at once later. You must
 call os_aio_simulated_wake_handler_threads later to ensure the threads
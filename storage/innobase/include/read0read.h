@@ -38,6 +38,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 
 #include "read0types.h"
 #include "univ.i"
+#include "ut0mutex.h"
 
 /** The MVCC read view manager */
 class MVCC {
@@ -112,6 +113,12 @@ class MVCC {
   inline ReadView *get_oldest_view() const;
   ReadView *get_view_created_by_trx_id(trx_id_t trx_id) const;
 
+  /** Try to refresh a stale view from the cached snapshot, without
+  acquiring trx_sys_t::mutex.
+  @param[in,out]	view	view to refresh, must be marked closed
+  @return true if the view was refreshed from the cache */
+  bool try_copy_snapshot(ReadView *view);
+
  private:
   // Prevent copying
   MVCC(const MVCC &);
@@ -126,6 +133,20 @@ class MVCC {
   /** Active and closed views, the closed views will have the
   creator trx id set to TRX_ID_MAX */
   view_list_t m_views;
+
+  /** Cache of the snapshot most recently built by view_open() for a
+  transaction without an assigned id. Other connections whose view has
+  gone stale can copy it under m_snapshot_mutex instead of rebuilding
+  the snapshot under the much more contended trx_sys_t::mutex.
+  Protected by m_snapshot_mutex. */
+  ReadView m_snapshot;
+
+  /** true if m_snapshot holds a usable snapshot. Protected by
+  m_snapshot_mutex. */
+  bool m_snapshot_valid{false};
+
+  /** Mutex protecting m_snapshot and m_snapshot_valid */
+  ib_mutex_t m_snapshot_mutex;
 };
 
 #endif /* read0read_h */
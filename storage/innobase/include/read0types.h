@@ -310,6 +310,12 @@ class ReadView {
   trx_id_t m_view_low_limit_no;
 #endif /* UNIV_DEBUG */
 
+  /** Value of trx_sys_t::rw_trx_version at the time the snapshot was
+  taken. If it still matches when the view is reopened, the snapshot
+  state cannot have changed and the view can be reused without taking
+  trx_sys_t::mutex. */
+  uint64_t m_version;
+
   /** AC-NL-RO transaction view that has been "closed". */
   bool m_closed;
 
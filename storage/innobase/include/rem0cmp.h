@@ -118,6 +118,27 @@ int cmp_dtuple_rec_with_gis_internal(const dtuple_t *dtuple, const rec_t *rec,
                                      const ulint *offsets,
                                      const dd::Spatial_reference_system *srs);
 
+/** Compare a data tuple to a physical record on a leading prefix of the
+index fields that consists of fixed-length, NOT NULL, ascending columns
+whose canonical comparison is a plain byte comparison (integers, system
+columns and binary strings). The fields are compared with memcmp(), which
+the compiler and libc vectorize, skipping the per-field type dispatch of
+cmp_data(). The caller must have checked the REC_INFO_MIN_REC_FLAG.
+@see dict_index_t::cmp_binary_prefix
+@param[in]	dtuple		data tuple
+@param[in]	rec		B-tree record
+@param[in]	offsets		rec_get_offsets(rec)
+@param[in]	n_cmp		number of fields to compare, at most
+                                dict_index_t::n_binary_cmp_fields
+@param[in,out]	matched_fields	number of completely matched fields
+@return the comparison result of dtuple and rec
+@retval 0 if dtuple is equal to rec
+@retval negative if dtuple is less than rec
+@retval positive if dtuple is greater than rec */
+int cmp_dtuple_rec_binary_prefix(const dtuple_t *dtuple, const rec_t *rec,
+                                 const ulint *offsets, ulint n_cmp,
+                                 ulint *matched_fields);
+
 /** Compare a data tuple to a physical record.
 @param[in]	dtuple		data tuple
 @param[in]	rec		record
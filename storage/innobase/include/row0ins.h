@@ -33,6 +33,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #ifndef row0ins_h
 #define row0ins_h
 
+#include "buf0types.h"
 #include "data0data.h"
 #include "dict0types.h"
 #include "que0types.h"
@@ -195,6 +196,27 @@ struct ins_node_t {
   the multi-value field, before which the values have been inserted */
   uint32_t ins_multi_val_pos;
 
+  /** Leaf block which received the last successful optimistic insert
+  into the clustered index, or NULL; used as a guess for the next row
+  of a multi-row insert, to avoid descending the index tree from the
+  root for every row. The guess is validated with the modify clock and
+  the withdraw clock before use, so it needs no explicit invalidation
+  when the block is evicted or the page is reorganized. */
+  buf_block_t *ins_clust_block;
+
+  /** Value of ins_clust_block->modify_clock when the position above
+  was cached */
+  uint64_t ins_clust_modify_clock;
+
+  /** Value of buf_withdraw_clock when the position above was cached;
+  if the buffer pool has been resized since, ins_clust_block may have
+  been withdrawn and must not be dereferenced */
+  ulint ins_clust_withdraw_clock;
+
+  /** Index which ins_clust_block belongs to; only compared against the
+  index being inserted into, never dereferenced */
+  const dict_index_t *ins_clust_index;
+
   ulint magic_n;
 };
 
@@ -133,6 +133,11 @@ struct row_merge_dup_t {
                         (index->table), or NULL if not
                         rebuilding table */
   ulint n_dup;          /*!< number of duplicates */
+  ib_mutex_t *mutex;    /*!< NULL, or a mutex serializing the
+                        conversion of the duplicate entry to
+                        MySQL format; needed when several
+                        index build threads share the same
+                        MySQL table object */
 };
 
 /** Report a duplicate key. */
@@ -611,6 +611,32 @@ struct row_prebuilt_t {
   memory for this template is not allocated from 'heap' */
   mysql_row_templ_t *mysql_template;
 
+  /** if nonzero, number of leading fields of the index whose offsets are
+  enough to evaluate the template and the MVCC visibility check when
+  row_search_mvcc() does a non-locking read on a clustered index; set by
+  ha_innobase::build_template(). Lets wide-table scans that fetch only a
+  few columns skip parsing the lengths of the trailing columns of every
+  record. 0 means that the offsets of all fields must be computed. */
+  ulint n_rec_fields_hint;
+
+  /** leaf block on which the previous row_search_mvcc() call in this
+  handle positioned its cursor, or NULL; a guess for the next search,
+  used by batched key lookups (BKA, MRR) whose sorted keys tend to land
+  on the same leaf page. Validated with the modify clock and the
+  withdraw clock before use, so no explicit invalidation is needed. */
+  buf_block_t *m_search_block;
+
+  /** value of the modify clock of m_search_block at the time the guess
+  was cached */
+  uint64_t m_search_modify_clock;
+
+  /** value of buf_withdraw_clock at the time the guess was cached */
+  ulint m_search_withdraw_clock;
+
+  /** the index m_search_block belonged to; only compared against,
+  never dereferenced */
+  const dict_index_t *m_search_index;
+
   /** memory heap from which these auxiliary structures are allocated when
   needed */
   mem_heap_t *heap;
@@ -121,6 +121,12 @@ class Parallel_reader {
   /** Callback to process the rows. */
   using F = std::function<dberr_t(const Ctx *)>;
 
+  /** Filter pushed down into the worker threads. Called for every record
+  that passed the visibility checks; if it returns false the record is
+  skipped without invoking the row callback. */
+  using Filter = std::function<bool(const rec_t *rec, const ulint *offsets,
+                                    const dict_index_t *index)>;
+
   /** Specifies the range from where to start the scan and where to end it. */
   struct Scan_range {
     /** Default constructor. */
@@ -177,7 +183,8 @@ class Parallel_reader {
           m_page_size(config.m_page_size),
           m_read_level(config.m_read_level),
           m_partition_id(config.m_partition_id),
-          m_read_ahead(config.m_read_ahead) {}
+          m_read_ahead(config.m_read_ahead),
+          m_filter(config.m_filter) {}
 
     /** Range to scan. */
     const Scan_range m_scan_range;
@@ -200,6 +207,11 @@ class Parallel_reader {
 
     /** if true then enable separate read ahead threads. */
     bool m_read_ahead{false};
+
+    /** Optional filter evaluated in the worker threads for every
+    visible leaf level record; records for which it returns false are
+    skipped without being passed to the row callback. */
+    Filter m_filter{};
   };
 
   /** Thread related context information. */
@@ -643,6 +655,20 @@ class Parallel_reader::Scan_ctx {
   bool check_visibility(const rec_t *&rec, ulint *&offsets, mem_heap_t *&heap,
                         mtr_t *mtr) MY_ATTRIBUTE((warn_unused_result));
 
+  /** Check the visibility of a secondary index record on a page that was
+  modified by a transaction which the read view may not see. The visible
+  version of the row is fetched from the clustered index, as
+  row_search_mvcc() does in the same situation.
+  @param[in]      rec       Secondary index record.
+  @param[in]      offsets   Column offsets of rec.
+  @param[in,out]  heap      Heap for building row versions.
+  @param[in,out]  mtr       Covering mini-transaction; the clustered index
+                            page latch is added to it.
+  @return true if the record is visible to the transaction. */
+  bool check_visibility_sec(const rec_t *rec, const ulint *offsets,
+                            mem_heap_t *&heap, mtr_t *mtr)
+      MY_ATTRIBUTE((warn_unused_result));
+
   /** Read ahead from this page number.
   @param[in]  page_no           Start read ahead page number. */
   void submit_read_ahead(page_no_t page_no) {
@@ -195,6 +195,7 @@ enum monitor_id_t {
   MONITOR_FLUSH_N_TO_FLUSH_BY_DIRTY_PAGE,
 
   MONITOR_FLUSH_N_TO_FLUSH_BY_AGE,
+  MONITOR_FLUSH_N_TO_FLUSH_BY_REDO_RATE,
   MONITOR_FLUSH_ADAPTIVE_AVG_TIME_SLOT,
   MONITOR_LRU_BATCH_FLUSH_AVG_TIME_SLOT,
 
@@ -213,6 +214,7 @@ enum monitor_id_t {
 
   MONITOR_FLUSH_AVG_PAGE_RATE,
   MONITOR_FLUSH_LSN_AVG_RATE,
+  MONITOR_FLUSH_LSN_ITER_RATE,
   MONITOR_FLUSH_PCT_FOR_DIRTY,
   MONITOR_FLUSH_PCT_FOR_LSN,
   MONITOR_FLUSH_SYNC_WAITS,
@@ -355,6 +357,8 @@ enum monitor_id_t {
   MONITOR_LOG_FLUSH_MAX_TIME,
   MONITOR_LOG_FLUSH_AVG_TIME,
   MONITOR_LOG_FLUSH_LSN_AVG_RATE,
+  MONITOR_LOG_FLUSH_COALESCE_WAITS,
+  MONITOR_LOG_FLUSH_COALESCE_TOTAL_TIME,
 
   MONITOR_LOG_FULL_BLOCK_WRITES,
   MONITOR_LOG_PARTIAL_BLOCK_WRITES,
@@ -414,6 +418,8 @@ enum monitor_id_t {
   MONITOR_INDEX_REORG_ATTEMPTS,
   MONITOR_INDEX_REORG_SUCCESSFUL,
   MONITOR_INDEX_DISCARD,
+  MONITOR_INDEX_DEFRAG_PAGES_SCANNED,
+  MONITOR_INDEX_DEFRAG_MERGE_SUCCESSFUL,
 
   /* Adaptive Hash Index related counters */
   MONITOR_MODULE_ADAPTIVE_HASH,
@@ -520,6 +526,13 @@ enum monitor_id_t {
   MONITOR_DBLWR_FLUSH_REQUESTS,
   MONITOR_DBLWR_FLUSH_WAIT_EVENTS,
 
+  /* Fulltext index cache sync counters */
+  MONITOR_MODULE_FTS,
+  MONITOR_FTS_SYNC_TOTAL,
+  MONITOR_FTS_SPILL_TOTAL,
+  MONITOR_FTS_SYNC_WRITE_MICROSECOND,
+  MONITOR_FTS_SYNC_COMMIT_MICROSECOND,
+
   /* This is used only for control system to turn
   on/off and reset all monitor counters */
   MONITOR_ALL_COUNTER,
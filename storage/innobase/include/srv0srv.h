@@ -195,9 +195,15 @@ struct Srv_threads {
   /** Buffer pool resize thread. */
   IB_thread m_buf_resize;
 
+  /** B-tree defragmentation background thread. */
+  IB_thread m_btr_defrag;
+
   /** Dict stats background thread. */
   IB_thread m_dict_stats;
 
+  /** Background tablespace extend thread. */
+  IB_thread m_fil_extend;
+
   /** Thread detecting lock wait timeouts. */
   IB_thread m_lock_wait_timeout;
 
@@ -323,6 +329,12 @@ and/or load it during startup. */
 extern bool srv_buffer_pool_dump_at_shutdown;
 extern bool srv_buffer_pool_load_at_startup;
 
+/** Number of worker threads used for buffer pool load. */
+extern ulong srv_buf_pool_load_threads;
+
+/** Enable automatic adaptation of the LRU old sublist length. */
+extern bool srv_adaptive_old_blocks;
+
 /* Whether to disable file system cache if it is defined */
 extern bool srv_disable_sort_file_cache;
 
@@ -362,6 +374,9 @@ extern bool high_level_read_only;
 /** store to its own file each table created by an user; data
 dictionary tables are in the system tablespace 0 */
 extern bool srv_file_per_table;
+/** Number of fil_system shards for tablespaces other than the undo and
+redo logs; the undo and redo shards come on top of this count */
+extern ulong srv_fil_shards;
 /** Sleep delay for threads waiting to enter InnoDB. In micro-seconds. */
 extern ulong srv_thread_sleep_delay;
 /** Maximum sleep delay (in micro-seconds), value of 0 disables it.*/
@@ -381,7 +396,26 @@ OS (provided we compiled Innobase with it in), otherwise we will
 use simulated aio we build below with threads.
 Currently we support native aio on windows and linux */
 extern bool srv_use_native_aio;
+
+/* If this flag is TRUE and the server was built with liburing, native
+AIO requests on Linux are submitted through io_uring instead of
+io_submit() */
+extern bool srv_use_io_uring;
+
+/* If this flag is TRUE, the io_uring instances use kernel side
+submission queue polling (IORING_SETUP_SQPOLL) */
+extern bool srv_io_uring_sqpoll;
+
+/* If this flag is FALSE, writes of transparently compressed pages skip
+the trailing punch hole syscall. */
+extern bool srv_punch_hole_writes;
 extern bool srv_numa_interleave;
+extern bool srv_numa_node_bind;
+
+/* If this flag is TRUE, buffer pool chunks are advised with MADV_HUGEPAGE
+so that transparent huge pages can back them without a pre-reserved
+hugetlbfs pool. Ignored when innodb_use_large_pages is in effect. */
+extern bool srv_buf_pool_madvise_huge;
 
 /* The innodb_directories variable value. This a list of directories
 deliminated by ';', i.e the FIL_PATH_SEPARATOR. */
@@ -517,6 +551,11 @@ extern ulong srv_log_flusher_spin_delay;
 /** Initial timeout used to wait on flusher_event. */
 extern ulong srv_log_flusher_timeout;
 
+/** Maximum time for which the log flusher thread may hold a pending
+fsync to coalesce more commits into it (microseconds). 0 disables the
+coalescing. */
+extern ulong srv_log_flush_coalesce_max_time;
+
 /** Number of spin iterations, for which log write notifier thread is waiting
 for advanced writeed_to_disk_lsn without sleeping. */
 extern ulong srv_log_write_notifier_spin_delay;
@@ -673,6 +712,7 @@ extern unsigned long long srv_stats_transient_sample_pages;
 extern bool srv_stats_persistent;
 extern unsigned long long srv_stats_persistent_sample_pages;
 extern bool srv_stats_auto_recalc;
+extern bool srv_stats_incremental;
 extern bool srv_stats_include_delete_marked;
 
 extern ulong srv_checksum_algorithm;
@@ -756,10 +796,12 @@ extern srv_stats_t srv_stats;
 extern mysql_pfs_key_t log_archiver_thread_key;
 extern mysql_pfs_key_t page_archiver_thread_key;
 extern mysql_pfs_key_t buf_dump_thread_key;
+extern mysql_pfs_key_t btr_defrag_thread_key;
 extern mysql_pfs_key_t buf_resize_thread_key;
 extern mysql_pfs_key_t clone_ddl_thread_key;
 extern mysql_pfs_key_t clone_gtid_thread_key;
 extern mysql_pfs_key_t dict_stats_thread_key;
+extern mysql_pfs_key_t fil_extend_thread_key;
 extern mysql_pfs_key_t fts_optimize_thread_key;
 extern mysql_pfs_key_t fts_parallel_merge_thread_key;
 extern mysql_pfs_key_t fts_parallel_tokenization_thread_key;
@@ -787,6 +829,7 @@ extern mysql_pfs_key_t trx_recovery_rollback_thread_key;
 extern mysql_pfs_key_t srv_ts_alter_encrypt_thread_key;
 extern mysql_pfs_key_t parallel_read_thread_key;
 extern mysql_pfs_key_t parallel_read_ahead_thread_key;
+extern mysql_pfs_key_t ddl_index_build_thread_key;
 #endif /* UNIV_PFS_THREAD */
 #endif /* !UNIV_HOTBACKUP */
 
@@ -352,6 +352,7 @@ alphabetical ordering seems useful */
 enum latch_id_t {
   LATCH_ID_NONE = 0,
   LATCH_ID_AUTOINC,
+  LATCH_ID_BTR_DEFRAG_POOL,
   LATCH_ID_BUF_BLOCK_MUTEX,
   LATCH_ID_BUF_POOL_CHUNKS,
   LATCH_ID_BUF_POOL_ZIP,
@@ -365,6 +366,8 @@ enum latch_id_t {
   LATCH_ID_DICT_FOREIGN_ERR,
   LATCH_ID_DICT_SYS,
   LATCH_ID_DICT_TABLE,
+  LATCH_ID_DICT_TABLE_CACHE,
+  LATCH_ID_FIL_EXTEND_POOL,
   LATCH_ID_FIL_SHARD,
   LATCH_ID_FLUSH_LIST,
   LATCH_ID_FTS_BG_THREADS,
@@ -399,10 +402,13 @@ enum latch_id_t {
   LATCH_ID_PERSIST_AUTOINC,
   LATCH_ID_DICT_PERSIST_CHECKPOINT,
   LATCH_ID_PAGE_CLEANER,
+  LATCH_ID_MVCC_SNAPSHOT,
   LATCH_ID_PURGE_SYS_PQ,
+  LATCH_ID_PURGE_SYS_STATS,
   LATCH_ID_RECALC_POOL,
   LATCH_ID_RECV_SYS,
   LATCH_ID_RECV_WRITER,
+  LATCH_ID_ROW_MERGE_DUP,
   LATCH_ID_TEMP_SPACE_RSEG,
   LATCH_ID_UNDO_SPACE_RSEG,
   LATCH_ID_TRX_SYS_RSEG,
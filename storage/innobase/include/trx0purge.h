@@ -33,6 +33,9 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #ifndef trx0purge_h
 #define trx0purge_h
 
+#include <map>
+
+#include "dict0types.h"
 #include "fil0fil.h"
 #include "mtr0mtr.h"
 #include "page0page.h"
@@ -1040,9 +1043,39 @@ struct trx_purge_t {
   /** Mutex protecting purge_queue */
   PQMutex pq_mutex;
 
+  /** Per-table statistics about the work done by the purge system. */
+  struct table_stats_t {
+    /** Number of undo records of the table which are part of the batch
+    currently being worked on */
+    uint64_t pending_recs;
+
+    /** Total number of undo records of the table dispatched to the purge
+    workers since server start */
+    uint64_t dispatched_recs;
+  };
+
+  /** Map from table id to the purge statistics of the table */
+  typedef std::map<table_id_t, table_stats_t, std::less<table_id_t>,
+                   ut_allocator<std::pair<const table_id_t, table_stats_t>>>
+      Table_stats;
+
+  /** Per-table purge statistics, refreshed by the purge coordinator for
+  every batch and exposed through
+  INFORMATION_SCHEMA.INNODB_PURGE_BACKLOG. Protected by stats_mutex. */
+  Table_stats table_stats;
+
+  /** Mutex protecting table_stats */
+  ib_mutex_t stats_mutex;
+
   /** Track UNDO tablespace marked for truncate. */
   undo::Truncate undo_trunc;
 
+  /** true if the last history truncation pass ran out of its work
+  budget. The coordinator then continues the truncation right after the
+  next purge batch, instead of waiting for the regular truncation
+  interval. Only accessed by the purge coordinator. */
+  bool truncate_more;
+
   /** Heap for reading the undo log records */
   mem_heap_t *heap;
 };
@@ -201,6 +201,13 @@ fetching the purge record */
 the undo log (which is the after image for an update) */
 #define TRX_UNDO_GET_OLD_V_VALUE 0x2
 
+/** This tells trx_undo_prev_version_build() to start a background read
+of the undo page holding the undo record of the next older version, so
+that the read overlaps with building the requested version. Used when
+walking a long version chain, which otherwise pays one synchronous
+dependent undo page read per version. */
+#define TRX_UNDO_PREFETCH_OLDER 0x4
+
 /** Build a previous version of a clustered index record. The caller must hold
 a latch on the index page of the clustered index record.
 If the vrow passed to this function is not null, then this function will store
@@ -487,6 +487,14 @@ struct trx_sys_t {
                         to ensure right order of removal and
                         consistent snapshot. */
 
+  std::atomic<uint64_t> rw_trx_version;
+  /*!< Incremented, under the mutex, whenever
+  the state that a ReadView snapshots changes:
+  max_trx_id allocation, rw_trx_ids and
+  serialisation_list modifications. A view
+  whose recorded version still matches can be
+  reopened as-is without taking the mutex. */
+
   char pad3[64]; /*!< To avoid false sharing */
 
   Rsegs rsegs; /*!< Vector of pointers to rollback
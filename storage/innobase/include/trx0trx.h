@@ -34,7 +34,9 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #define trx0trx_h
 
 #include <atomic>
+#include <map>
 #include <set>
+#include <vector>
 
 #include "ha_prototypes.h"
 
@@ -742,6 +744,30 @@ typedef std::set<dict_table_t *, std::less<dict_table_t *>,
                  ut_allocator<dict_table_t *>>
     trx_mod_tables_t;
 
+/** Referenced-index key that a foreign key check of this transaction has
+already verified to exist. The shared lock taken on the matching record by
+that check is held at least until the current statement ends, so within the
+statement the key cannot disappear as long as the transaction itself does
+not modify the referenced table (tracked in trx_t::mod_tables). The cache
+is cleared at statement end, at rollback to a savepoint and at transaction
+end, when such locks may be released. */
+struct trx_fk_checked_key_t {
+  /** id of the referenced table */
+  table_id_t ref_table_id;
+  /** id of the referenced index the key was found in */
+  space_index_t ref_index_id;
+  /** the key value, serialized as (2-byte length, data) per field */
+  std::vector<byte, ut_allocator<byte>> ref_key;
+};
+
+/** Cache of foreign key checks that have succeeded in a transaction,
+keyed by constraint. */
+typedef std::map<
+    const dict_foreign_t *, trx_fk_checked_key_t,
+    std::less<const dict_foreign_t *>,
+    ut_allocator<std::pair<const dict_foreign_t *const, trx_fk_checked_key_t>>>
+    trx_fk_checked_keys_t;
+
 /** The transaction handle
 
 Normally, there is a 1:1 relationship between a transaction handle
@@ -1217,7 +1243,11 @@ struct trx_t {
                                transaction branch */
   trx_mod_tables_t mod_tables; /*!< List of tables that were modified
                                by this transaction */
-#endif                         /* !UNIV_HOTBACKUP */
+  trx_fk_checked_keys_t fk_checked_keys;
+  /*!< Referenced-index keys already
+  verified (and shared-locked) by foreign
+  key checks of this transaction */
+#endif /* !UNIV_HOTBACKUP */
                                /*------------------------------*/
   bool api_trx;                /*!< trx started by InnoDB API */
   bool api_auto_commit;        /*!< automatic commit */
@@ -1080,7 +1080,6 @@ dberr_t insert(InsertContext *ctx, trx_t *trx, ref_t &ref,
 @return the amount of data (in bytes) that was actually read. */
 ulint read(ReadContext *ctx, ref_t ref, ulint offset, ulint len, byte *buf) {
   DBUG_TRACE;
-  ut_ad(offset == 0);
   const uint32_t lob_version = ref.version();
 
   ref_mem_t ref_mem;
@@ -1100,7 +1099,7 @@ ulint read(ReadContext *ctx, ref_t ref, ulint offset, ulint len, byte *buf) {
   /* Obtain length of LOB available in clustered index.*/
   const ulint avail_lob = ref.length();
 
-  if (avail_lob == 0) {
+  if (avail_lob == 0 || offset >= avail_lob) {
     return 0;
   }
 
@@ -1126,6 +1125,9 @@ ulint read(ReadContext *ctx, ref_t ref, ulint offset, ulint len, byte *buf) {
   page_type_t page_type = first_page.get_page_type();
 
   if (page_type == FIL_PAGE_TYPE_BLOB || page_type == FIL_PAGE_SDI_BLOB) {
+    /* The old-style BLOB pages do not have an index of their data
+    pages, so they can only be fetched from the beginning. */
+    ut_ad(offset == 0);
     mtr_commit(&mtr);
     Reader reader(*ctx);
     ulint fetch_len = reader.fetch();
@@ -1153,9 +1155,7 @@ ulint read(ReadContext *ctx, ref_t ref, ulint offset, ulint len, byte *buf) {
   index_entry_t old_version(&mtr, ctx->m_index);
   index_entry_mem_t entry_mem;
 
-  ut_ad(offset >= skipped);
-
-  ulint page_offset = offset - skipped;
+  ulint page_offset = 0;
   ulint want = len;
   byte *ptr = buf;
 
@@ -1200,6 +1200,21 @@ ulint read(ReadContext *ctx, ref_t ref, ulint offset, ulint len, byte *buf) {
       }
     }
 
+    /* At this point entry_mem holds the version of the entry that is
+    visible at the requested lob_version. Entries that lie wholly
+    before the requested offset are skipped without latching their
+    data pages, so a caller reading the LOB in chunks pays only for
+    the pages of the chunk it asks for. */
+    const ulint entry_data_len = entry_mem.m_data_len;
+
+    if (skipped + entry_data_len <= offset) {
+      skipped += entry_data_len;
+      node_loc = cur_entry.get_next();
+      continue;
+    }
+
+    page_offset = offset > skipped ? offset - skipped : 0;
+
     page_no_t read_from_page_no = FIL_NULL;
 
     if (old_version.is_null()) {
@@ -1236,14 +1251,14 @@ ulint read(ReadContext *ctx, ref_t ref, ulint offset, ulint len, byte *buf) {
     }
 
     total_read += actual_read;
-    page_offset = 0;
+    skipped += entry_data_len;
     node_loc = cur_entry.get_next();
   }
 
   /* Assert that we have read what has been requested or what is
-  available. */
-  ut_ad(total_read == len || total_read == avail_lob);
-  ut_ad(total_read <= avail_lob);
+  available after the requested offset. */
+  ut_ad(total_read == len || offset + total_read == avail_lob);
+  ut_ad(offset + total_read <= avail_lob);
 
   mtr_commit(&mtr);
   mtr_commit(&data_mtr);
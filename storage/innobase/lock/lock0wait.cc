@@ -549,6 +549,38 @@ static void lock_wait_check_slots_for_timeouts() {
   lock_wait_mutex_exit();
 }
 
+/** Number of slots we copy while holding the lock_wait_mutex before releasing
+it for a moment, so that threads which need to reserve or free a slot do not
+have to wait for the whole snapshot to be taken. */
+static constexpr size_t SNAPSHOT_CHUNK_SIZE = 64;
+
+/** Removes duplicated entries for the same trx from the snapshot, keeping for
+each trx only the entry with the highest reservation_no, that is the freshest
+one. Duplicates can appear if a trx freed its slot and reserved another one
+while the snapshot loop had the lock_wait_mutex released between two chunks.
+The entries which were kept are sorted by trx address afterwards, which
+lock_wait_build_wait_for_graph() relies upon anyway.
+@param[in,out]  infos   the snapshot to remove stale duplicates from */
+static void lock_wait_remove_stale_duplicates(
+    ut::vector<waiting_trx_info_t> &infos) {
+  std::sort(infos.begin(), infos.end(),
+            [](const waiting_trx_info_t &a, const waiting_trx_info_t &b) {
+              if (a.trx != b.trx) {
+                return std::less<trx_t *>{}(a.trx, b.trx);
+              }
+              return a.reservation_no < b.reservation_no;
+            });
+  size_t kept = 0;
+  for (size_t i = 0; i < infos.size(); ++i) {
+    if (i + 1 < infos.size() && infos[i].trx == infos[i + 1].trx) {
+      /* A fresher entry for this trx follows. */
+      continue;
+    }
+    infos[kept++] = infos[i];
+  }
+  infos.resize(kept);
+}
+
 /** Takes a snapshot of the content of slots which are in use
 @param[out]   infos   Will contain the information about slots which are in use
 @return value of lock_wait_table_reservations before taking the snapshot
@@ -565,19 +597,28 @@ static uint64_t lock_wait_snapshot_waiting_threads(
   keep the lock_wait_mutex too long.
   Anything more fancy than push_back seems to impact performance.
 
-  Note: one should be able to prove that we don't really need a "consistent"
-  snapshot - the algorithm should still work if we split the loop into several
-  smaller "chunks" snapshotted independently and stitch them together. Care must
-  be taken to "merge" duplicates keeping the freshest version (reservation_no)
-  of slot for each trx.
-  So, if (in future) this loop turns out to be a bottleneck (say, by increasing
-  congestion on lock_wait_mutex), one can try to release and require the lock
-  every X iterations and modify the lock_wait_build_wait_for_graph() to handle
-  duplicates in a smart way.
+  We don't need a "consistent" snapshot: the algorithm still works if the loop
+  is split into several smaller chunks snapshotted independently and stitched
+  together, because every decision based on the snapshot is later re-validated
+  by comparing the current slot->reservation_no against the snapshotted one
+  (see lock_wait_get_slot_if_still_reserved()). Thus we release and reacquire
+  the mutex every SNAPSHOT_CHUNK_SIZE slots, so that sessions which need to
+  reserve or free a slot never wait for the whole scan. The only care needed is
+  to merge duplicates, keeping the freshest version (highest reservation_no) of
+  slot for each trx, which lock_wait_remove_stale_duplicates() does.
   */
   const auto table_reservations = lock_wait_table_reservations;
+  bool released_mutex = false;
+  size_t chunk = 0;
   for (auto slot = lock_sys->waiting_threads; slot < lock_sys->last_slot;
        ++slot) {
+    if (SNAPSHOT_CHUNK_SIZE <= chunk) {
+      lock_wait_mutex_exit();
+      released_mutex = true;
+      chunk = 0;
+      lock_wait_mutex_enter();
+    }
+    ++chunk;
     if (slot->in_use) {
       auto from = thr_get_trx(slot->thr);
       auto to = from->lock.blocking_trx.load();
@@ -587,6 +628,9 @@ static uint64_t lock_wait_snapshot_waiting_threads(
     }
   }
   lock_wait_mutex_exit();
+  if (released_mutex) {
+    lock_wait_remove_stale_duplicates(infos);
+  }
   return table_reservations;
 }
 
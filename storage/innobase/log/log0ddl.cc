@@ -63,6 +63,12 @@ Log_DDL *log_ddl = nullptr;
 Note: we should not write DDL log when replaying DDL log. */
 thread_local bool thread_local_ddl_log_replay = false;
 
+/** Whether this thread has inserted any DDL log record since its last
+successful post-DDL replay. Lets post_ddl() skip searching the DDL log
+table for statements which wrote no log records. Records which survive
+a crash are handled by recover() at startup independently of this. */
+static thread_local bool thread_local_ddl_log_written = false;
+
 /** Whether in recover(replay) DDL log in startup. */
 bool Log_DDL::s_in_recovery = false;
 
@@ -458,6 +464,10 @@ void DDL_Log_Table::create_tuple(ulint id, const dict_index_t *index) {
 dberr_t DDL_Log_Table::insert(const DDL_Record &record) {
   dberr_t error;
   dict_index_t *index = m_table->first_index();
+
+  /* Set before attempting the insert, so that a partial failure can
+  never cause the post-DDL replay to be skipped. */
+  thread_local_ddl_log_written = true;
   dtuple_t *entry;
   uint32_t flags = BTR_NO_LOCKING_FLAG;
   mem_heap_t *offsets_heap = mem_heap_create(1000);
@@ -1811,6 +1821,13 @@ dberr_t Log_DDL::post_ddl(THD *thd) {
   /* If srv_force_recovery > 0, DROP TABLE is allowed, and here only
   DELETE and DROP log can be replayed. */
 
+  /* Fast path: if this thread has inserted no DDL log record since its
+  last successful replay, there is nothing to look for and the search
+  of the log table can be skipped entirely. */
+  if (!thread_local_ddl_log_written) {
+    return (DB_SUCCESS);
+  }
+
   ulint thread_id = thd_get_thread_id(thd);
 
   if (srv_print_ddl_logs) {
@@ -1824,6 +1841,12 @@ dberr_t Log_DDL::post_ddl(THD *thd) {
 
   thread_local_ddl_log_replay = false;
 
+  /* On failure keep the flag set, so that the next statement in this
+  thread retries the replay. */
+  if (err == DB_SUCCESS) {
+    thread_local_ddl_log_written = false;
+  }
+
   if (srv_print_ddl_logs) {
     ib::info(ER_IB_MSG_661)
         << "DDL log post ddl : end for thread id : " << thread_id;
@@ -37,10 +37,12 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <sys/types.h>
 
 #include <array>
+#include <atomic>
 #include <iomanip>
 #include <map>
 #include <new>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "arch0arch.h"
@@ -1246,6 +1248,16 @@ void recv_apply_hashed_log_recs(log_t &log, bool allow_ibuf) {
 
   auto start_time = ut_time_monotonic();
 
+  /* Collect the pages to apply. The tablespace state is resolved up
+  front, single-threaded: fil_tablespace_open_for_recovery() opens the
+  tablespace as a side effect. File-level records are not part of this
+  hash - they have already been applied during the scan - so the pages
+  collected below are mutually independent. */
+
+  std::vector<recv_addr_t *> recv_addrs;
+
+  recv_addrs.reserve(batch_size);
+
   for (const auto &space : *recv_sys->spaces) {
     bool dropped;
 
@@ -1270,27 +1282,93 @@ void recv_apply_hashed_log_recs(log_t &log, bool allow_ibuf) {
         pages.second->state = RECV_DISCARDED;
       }
 
-      recv_apply_log_rec(pages.second);
-
-      ++applied;
+      recv_addrs.push_back(pages.second);
+    }
+  }
 
-      if (unit == 0 || (applied % unit) == 0) {
-        ib::info(ER_IB_MSG_708) << pct << "%";
+  mutex_exit(&recv_sys->mutex);
 
-        pct += PCT;
+  /* Apply the pages in parallel. Workers pull pages from the shared
+  list; all state transitions in recv_apply_log_rec() and in
+  recv_recover_page() are made under recv_sys->mutex, which already
+  serializes them against the IO threads that apply records at read
+  completion, so concurrent workers are safe. */
 
-        start_time = ut_time_monotonic();
+  std::atomic<size_t> next_rec{0};
 
-      } else if (ut_time_monotonic() - start_time >= PRINT_INTERVAL_SECS) {
-        start_time = ut_time_monotonic();
+  auto apply_worker = [&recv_addrs, &next_rec]() {
+    for (;;) {
+      const auto i = next_rec.fetch_add(1);
 
-        ib::info(ER_IB_MSG_709)
-            << std::setprecision(2)
-            << ((double)applied * 100) / (double)batch_size << "%";
+      if (i >= recv_addrs.size()) {
+        break;
       }
+
+      mutex_enter(&recv_sys->mutex);
+
+      recv_apply_log_rec(recv_addrs[i]);
+
+      mutex_exit(&recv_sys->mutex);
+    }
+  };
+
+  /* One additional worker per that many pages, bounded by the number
+  of concurrent threads supported by the host machine. 0 means that the
+  main thread does all the work itself. */
+  constexpr size_t RECV_APPLY_PAGES_PER_THREAD = 1024;
+
+  size_t n_threads = recv_addrs.size() / RECV_APPLY_PAGES_PER_THREAD;
+
+  const size_t max_threads = std::max<size_t>(
+      std::thread::hardware_concurrency(), 1);
+
+  n_threads = std::min(n_threads, max_threads);
+
+  std::vector<std::thread> workers;
+
+  for (size_t i = 0; i < n_threads; ++i) {
+    workers.emplace_back(apply_worker);
+  }
+
+  /* The main thread participates too and reports the progress. */
+
+  for (;;) {
+    const auto i = next_rec.fetch_add(1);
+
+    if (i >= recv_addrs.size()) {
+      break;
     }
+
+    mutex_enter(&recv_sys->mutex);
+
+    recv_apply_log_rec(recv_addrs[i]);
+
+    mutex_exit(&recv_sys->mutex);
+
+    applied = i + 1;
+
+    if (unit == 0 || (applied % unit) == 0) {
+      ib::info(ER_IB_MSG_708) << pct << "%";
+
+      pct += PCT;
+
+      start_time = ut_time_monotonic();
+
+    } else if (ut_time_monotonic() - start_time >= PRINT_INTERVAL_SECS) {
+      start_time = ut_time_monotonic();
+
+      ib::info(ER_IB_MSG_709)
+          << std::setprecision(2)
+          << ((double)applied * 100) / (double)batch_size << "%";
+    }
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
   }
 
+  mutex_enter(&recv_sys->mutex);
+
   /* Wait until all the pages have been processed */
 
   while (recv_sys->n_addrs != 0) {
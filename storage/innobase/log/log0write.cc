@@ -104,6 +104,29 @@ the file COPYING.Google.
  It copies data to system buffers. It is the log flusher thread, which is
  responsible for doing fsync().
 
+ @note The log files form one logical circular buffer: consecutive lsn
+ ranges map to consecutive file offsets, written by this single thread.
+ Striping lsn ranges across multiple files/devices with independent
+ writers has been considered and rejected for this format: the lsn is
+ the physical file offset (minus headers), recovery scans blocks
+ sequentially by lsn, each block header carries a single hdr_no derived
+ from the lsn sequence and checkpoint headers live in the first file.
+ Interleaving would change the on-disk format and the recovery scan.
+ Deployments that need more redo device bandwidth can stripe at the
+ block layer (e.g. LVM/md across NVMe namespaces), which preserves the
+ sequential format while spreading the queue depth, and can tune
+ innodb_log_write_max_size / innodb_log_write_ahead_size to issue
+ larger sequential writes.
+
+ For the same reason, transparently compressing log blocks before they
+ are written would not work either: a block that shrinks on disk would
+ shift the offsets of all blocks behind it, and a partially overwritten
+ last block (the common case - the newest block is rewritten with more
+ data appended on every write) could grow or shrink between writes,
+ corrupting its successors in place. Compression of the redo stream is
+ only sound at a layer that owns its own framing, such as the redo
+ archiver or a filesystem with transparent compression.
+
  There are following points that need to be addressed by the log writer thread:
 
  -# %Find out how much data is ready in the log buffer, which is concurrently
@@ -2303,6 +2326,45 @@ void log_flusher(log_t *log_ptr) {
 
         log_flusher_mutex_enter(log);
       }
+
+    } else {
+      const uint64_t coalesce_max_us = srv_log_flush_coalesce_max_time;
+
+      if (coalesce_max_us > 0 && !log.should_stop_threads.load() &&
+          log.flushed_to_disk_lsn.load() < log.write_lsn.load()) {
+        /* Hold the pending fsync for a short while, so that more
+        commits are coalesced into it. The window is capped by the
+        average fsync time - the device cannot complete fsyncs more
+        often than that anyway, so up to this cap the holding does not
+        reduce the achievable flush rate. */
+        const auto window_us = std::min(
+            coalesce_max_us, static_cast<uint64_t>(log.flush_avg_time));
+
+        const auto current_time = Log_clock::now();
+
+        uint64_t elapsed_us = 0;
+
+        if (current_time > log.last_flush_end_time) {
+          using us = std::chrono::microseconds;
+
+          elapsed_us = std::chrono::duration_cast<us>(
+                           current_time - log.last_flush_end_time)
+                           .count();
+        }
+
+        if (elapsed_us < window_us) {
+          log_flusher_mutex_exit(log);
+
+          os_thread_sleep(window_us - elapsed_us);
+
+          MONITOR_INC(MONITOR_LOG_FLUSH_COALESCE_WAITS);
+
+          MONITOR_INC_VALUE(MONITOR_LOG_FLUSH_COALESCE_TOTAL_TIME,
+                            window_us - elapsed_us);
+
+          log_flusher_mutex_enter(log);
+        }
+      }
     }
 
     const auto wait_stats = waiting.wait(stop_condition);
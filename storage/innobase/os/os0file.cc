@@ -76,6 +76,14 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
 #endif /* !UNIV_HOTBACKUP */
 #endif /* LINUX_NATIVE_AIO */
 
+#ifdef HAVE_LIBURING
+#ifdef LINUX_NATIVE_AIO
+#include <liburing.h>
+#else /* LINUX_NATIVE_AIO */
+#undef HAVE_LIBURING
+#endif /* LINUX_NATIVE_AIO */
+#endif /* HAVE_LIBURING */
+
 #ifdef HAVE_FALLOC_PUNCH_HOLE_AND_KEEP_SIZE
 #include <fcntl.h>
 #include <linux/falloc.h>
@@ -518,6 +526,33 @@ class AIO {
   @return true if supported, false otherwise. */
   static bool is_linux_native_aio_supported()
       MY_ATTRIBUTE((warn_unused_result));
+
+#ifdef HAVE_LIBURING
+  /** Dispatch an AIO request to the kernel through io_uring.
+  @param[in,out]	slot	an already reserved slot
+  @return true on success. */
+  bool uring_dispatch(Slot *slot) MY_ATTRIBUTE((warn_unused_result));
+
+  /** Same as uring_dispatch(), for callers that already own the
+  array mutex.
+  @param[in,out]	slot	an already reserved slot
+  @return true on success. */
+  bool uring_dispatch_locked(Slot *slot) MY_ATTRIBUTE((warn_unused_result));
+
+  /** Accessor for the io_uring instance of a segment.
+  @param[in]	segment	Segment for which to get the ring
+  @return the ring used by the segment */
+  io_uring *ring(ulint segment) MY_ATTRIBUTE((warn_unused_result)) {
+    ut_ad(segment < get_n_segments());
+
+    return (&m_rings[segment]);
+  }
+
+  /** Checks if io_uring is usable on this system. Clears
+  srv_io_uring_sqpoll if only the polling mode is unavailable.
+  @return true if supported, false otherwise. */
+  static bool is_io_uring_supported() MY_ATTRIBUTE((warn_unused_result));
+#endif /* HAVE_LIBURING */
 #endif /* LINUX_NATIVE_AIO */
 
 #ifdef WIN_ASYNC_IO
@@ -681,6 +716,12 @@ class AIO {
   /** Initialise the Linux native AIO data structures
   @return DB_SUCCESS or error code */
   dberr_t init_linux_native_aio() MY_ATTRIBUTE((warn_unused_result));
+
+#ifdef HAVE_LIBURING
+  /** Initialise the io_uring instances, one ring per segment
+  @return DB_SUCCESS or error code */
+  dberr_t init_io_uring() MY_ATTRIBUTE((warn_unused_result));
+#endif /* HAVE_LIBURING */
 #endif /* LINUX_NATIVE_AIO */
 
  private:
@@ -725,6 +766,14 @@ class AIO {
   segment. Each thread will work on one ctx exclusively. */
   io_context_t *m_aio_ctx;
 
+#ifdef HAVE_LIBURING
+  /** io_uring instances, one per segment, used instead of m_aio_ctx
+  when innodb_use_io_uring is enabled. The submission queues are
+  serialized on m_mutex; the completion queue of each segment is
+  consumed only by the IO handler thread of that segment. */
+  io_uring *m_rings{nullptr};
+#endif /* HAVE_LIBURING */
+
   /** The array to collect completed IOs. There is one such
   event for each possible pending IO. The size of the array
   is equal to m_slots.size(). */
@@ -1686,6 +1735,12 @@ static dberr_t os_file_io_complete(const IORequest &type, os_file_t fh,
       return (DB_SUCCESS);
     }
 
+    /* The compressed payload has been written; optionally skip the
+    punch hole and leave the page fully allocated on disk. */
+    if (!srv_punch_hole_writes) {
+      return (DB_SUCCESS);
+    }
+
 #ifdef UNIV_DEBUG
     const ulint block_size = type.block_size();
 #endif /* UNIV_DEBUG */
@@ -2150,6 +2205,12 @@ class LinuxAIOHandler {
   each wakeup and that is why we use timed wait in io_getevents(). */
   void collect();
 
+#ifdef HAVE_LIBURING
+  /** The io_uring flavour of collect(): reaps completions from the
+  segment's completion queue instead of calling io_getevents(). */
+  void collect_uring();
+#endif /* HAVE_LIBURING */
+
  private:
   /** Slot array */
   AIO *m_array;
@@ -2190,6 +2251,16 @@ dberr_t LinuxAIOHandler::resubmit(Slot *slot) {
 
   /* make sure that slot->offset fits in off_t */
   ut_ad(sizeof(off_t) >= sizeof(os_offset_t));
+
+#ifdef HAVE_LIBURING
+  if (srv_use_io_uring) {
+    /* We already own the array mutex here, so use the variant
+    that does not try to acquire it again. */
+    return (m_array->uring_dispatch_locked(slot) ? DB_SUCCESS
+                                                 : DB_IO_PARTIAL_FAILED);
+  }
+#endif /* HAVE_LIBURING */
+
   struct iocb *iocb = &slot->control;
   if (slot->type.is_read()) {
     io_prep_pread(iocb, slot->file.m_file, slot->ptr, slot->len, slot->offset);
@@ -2294,6 +2365,14 @@ void LinuxAIOHandler::collect() {
   ut_ad(m_n_slots > 0);
   ut_ad(m_segment < m_array->get_n_segments());
 
+#ifdef HAVE_LIBURING
+  if (srv_use_io_uring) {
+    collect_uring();
+
+    return;
+  }
+#endif /* HAVE_LIBURING */
+
   /* Which io_context we are going to use. */
   io_context *io_ctx = m_array->io_ctx(m_segment);
 
@@ -2405,6 +2484,126 @@ void LinuxAIOHandler::collect() {
   }
 }
 
+#ifdef HAVE_LIBURING
+/** The io_uring flavour of collect(): reaps completions from the
+segment's completion queue instead of calling io_getevents(). The
+completion queue needs no locking because it is consumed only by this
+segment's IO handler thread; the slot bookkeeping is still done under
+the array mutex, exactly as in collect(). */
+void LinuxAIOHandler::collect_uring() {
+  ut_ad(m_n_slots > 0);
+  ut_ad(m_segment < m_array->get_n_segments());
+
+  io_uring *ring = m_array->ring(m_segment);
+
+  /* Starting point of the m_segment we will be working on. */
+  ulint start_pos = m_segment * m_n_slots;
+
+  /* End point. */
+  ulint end_pos = start_pos + m_n_slots;
+
+  for (;;) {
+    io_uring_cqe *cqe = nullptr;
+
+    /* The timeout value matches the io_getevents() one used in
+    collect(); we wake up regularly to check the server status. */
+    struct __kernel_timespec timeout;
+
+    timeout.tv_sec = 0;
+    timeout.tv_nsec = OS_AIO_REAP_TIMEOUT;
+
+    int ret = io_uring_wait_cqe_timeout(ring, &cqe, &timeout);
+
+    ulint n_completed = 0;
+
+    while (ret == 0 && cqe != nullptr) {
+      auto slot = reinterpret_cast<Slot *>(io_uring_cqe_get_data(cqe));
+
+      /* Some sanity checks. */
+      ut_a(slot != nullptr);
+      ut_a(slot->is_reserved);
+
+      /* We are not scribbling previous segment. */
+      ut_a(slot->pos >= start_pos);
+
+      /* We have not overstepped to next segment. */
+      ut_a(slot->pos < end_pos);
+
+      /* cqe->res is the number of bytes transferred, or a
+      negated errno value on failure. */
+      int res = cqe->res;
+
+      io_uring_cqe_seen(ring, cqe);
+
+      ++n_completed;
+
+      if (slot->offset > 0 && !slot->skip_punch_hole &&
+          slot->type.is_compression_enabled() && !slot->type.is_log() &&
+          slot->type.is_write() && slot->type.is_compressed() &&
+          slot->type.punch_hole() && !slot->type.is_dblwr()) {
+        slot->err = AIOHandler::io_complete(slot);
+      } else {
+        slot->err = DB_SUCCESS;
+      }
+
+      /* Mark this request as completed. The error handling
+      will be done in the calling function. */
+      m_array->acquire();
+
+      slot->io_already_done = true;
+
+      if (res < 0 || static_cast<ulint>(res) > slot->len) {
+        /* failure */
+        slot->n_bytes = 0;
+        slot->ret = res;
+      } else {
+        /* success */
+        slot->n_bytes = res;
+        slot->ret = 0;
+      }
+
+      m_array->release();
+
+      cqe = nullptr;
+      ret = io_uring_peek_cqe(ring, &cqe);
+    }
+
+    if (srv_shutdown_state.load() == SRV_SHUTDOWN_EXIT_THREADS ||
+        !buf_flush_page_cleaner_is_active() || n_completed > 0) {
+      break;
+    }
+
+    /* This error handling is for any error in collecting the
+    IO requests. The errors, if any, for any particular IO
+    request are simply passed on to the calling routine. */
+
+    switch (ret) {
+      case -ETIME:
+        /* The wait timed out with nothing completed. */
+
+      case -EAGAIN:
+        /* Not enough resources! Try again. */
+
+      case -EINTR:
+        /* Interrupted! If we have some completed IOs available
+        then they were processed above; we get here only if
+        there were none. */
+
+      case 0:
+        /* No pending request! Go back and check again. */
+
+        continue;
+    }
+
+    /* All other errors should cause a trap for now. */
+    ib::fatal(ER_IB_MSG_755)
+        << "Unexpected ret_code[" << ret << "] from io_uring_wait_cqe()!";
+
+    break;
+  }
+}
+#endif /* HAVE_LIBURING */
+
 /** Process a Linux AIO request
 @param[out]	m1		the messages passed with the
 @param[out]	m2		AIO request; note that in case the
@@ -2521,6 +2720,55 @@ static dberr_t os_aio_linux_handler(ulint global_segment, fil_node_t **m1,
   return (err);
 }
 
+/** Native AIO requests deferred by os_aio_batch_begin() on this thread,
+to be flushed with as few io_submit() calls as possible by
+os_aio_batch_end(). The entries are (io_context, iocb) pairs; requests
+belonging to the same io_context are submitted together. */
+struct os_aio_batch_t {
+  /** true between os_aio_batch_begin() and os_aio_batch_end() */
+  bool m_active{false};
+
+  /** io_context of each deferred request, parallel to m_iocbs */
+  std::vector<io_context_t> m_ctxs;
+
+  /** deferred control blocks */
+  std::vector<struct iocb *> m_iocbs;
+};
+
+static thread_local os_aio_batch_t os_aio_batch;
+
+/** Submit a group of deferred requests that share an io_context,
+retrying partial submissions and transient errors.
+@param[in]	io_ctx	io_context to submit to
+@param[in,out]	iocbs	control blocks to submit
+@param[in]	n	number of control blocks */
+static void os_aio_batch_submit(io_context_t io_ctx, struct iocb **iocbs,
+                                ulint n) {
+  while (n > 0) {
+    int ret = io_submit(io_ctx, n, iocbs);
+
+    /* io_submit() returns the number of successfully queued
+    requests or -errno. */
+
+    if (ret > 0) {
+      iocbs += ret;
+      n -= ret;
+
+    } else if (ret == -EAGAIN || ret == -EINTR) {
+      /* The kernel event queue is momentarily full; give the
+      handler threads a chance to reap completions. */
+      os_thread_sleep(1000);
+
+    } else {
+      errno = -ret;
+
+      ib::fatal(ER_IB_MSG_755) << "io_submit() of a read-ahead batch"
+                                  " failed with error "
+                               << -ret << ".";
+    }
+  }
+}
+
 /** Dispatch an AIO request to the kernel.
 @param[in,out]	slot		an already reserved slot
 @return true on success. */
@@ -2528,6 +2776,15 @@ bool AIO::linux_dispatch(Slot *slot) {
   ut_a(slot->is_reserved);
   ut_ad(slot->type.validate());
 
+#ifdef HAVE_LIBURING
+  if (srv_use_io_uring) {
+    /* io_uring submission is a single syscall (or none at all with
+    SQ polling), so the read-ahead batching machinery above would
+    not save anything; bypass it. */
+    return (uring_dispatch(slot));
+  }
+#endif /* HAVE_LIBURING */
+
   /* Find out what we are going to work with.
   The iocb struct is directly in the slot.
   The io_context is one per segment. */
@@ -2537,6 +2794,15 @@ bool AIO::linux_dispatch(Slot *slot) {
 
   io_ctx_index = (slot->pos * m_n_segments) / m_slots.size();
 
+  if (os_aio_batch.m_active) {
+    /* Defer the submission; os_aio_batch_end() will hand the
+    whole batch to the kernel in one io_submit() per context. */
+    os_aio_batch.m_ctxs.push_back(m_aio_ctx[io_ctx_index]);
+    os_aio_batch.m_iocbs.push_back(iocb);
+
+    return (true);
+  }
+
   int ret = io_submit(m_aio_ctx[io_ctx_index], 1, &iocb);
 
   /* io_submit() returns number of successfully queued requests
@@ -2549,6 +2815,113 @@ bool AIO::linux_dispatch(Slot *slot) {
   return (ret == 1);
 }
 
+#ifdef HAVE_LIBURING
+/** Dispatch an AIO request through io_uring. Acquires the array mutex
+because, unlike io_submit(), an io_uring submission queue must not be
+filled by concurrent producers.
+@param[in,out]	slot		an already reserved slot
+@return true on success. */
+bool AIO::uring_dispatch(Slot *slot) {
+  acquire();
+
+  bool success = uring_dispatch_locked(slot);
+
+  release();
+
+  return (success);
+}
+
+/** Dispatch an AIO request through io_uring. The caller must already
+own the array mutex; this variant exists for resubmission of partial
+I/Os, which happens with the mutex held.
+@param[in,out]	slot		an already reserved slot
+@return true on success. */
+bool AIO::uring_dispatch_locked(Slot *slot) {
+  ut_a(slot->is_reserved);
+  ut_ad(slot->type.validate());
+  ut_ad(is_mutex_owned());
+
+  ulint segment = (slot->pos * m_n_segments) / m_slots.size();
+
+  io_uring *io_ring = ring(segment);
+
+  io_uring_sqe *sqe = io_uring_get_sqe(io_ring);
+
+  if (sqe == nullptr) {
+    /* The submission queue is full; the caller will fall back to
+    synchronous I/O, like on an io_submit() EAGAIN. */
+    errno = EAGAIN;
+
+    return (false);
+  }
+
+  if (slot->type.is_read()) {
+    io_uring_prep_read(sqe, slot->file.m_file, slot->ptr, slot->len,
+                       slot->offset);
+  } else {
+    ut_ad(slot->type.is_write());
+
+    io_uring_prep_write(sqe, slot->file.m_file, slot->ptr, slot->len,
+                        slot->offset);
+  }
+
+  io_uring_sqe_set_data(sqe, slot);
+
+  int ret = io_uring_submit(io_ring);
+
+  /* io_uring_submit() returns the number of submitted SQEs or -errno.
+  With SQ polling the kernel may already have consumed earlier entries,
+  so any non-negative value means our SQE was handed over. */
+
+  if (ret < 0) {
+    errno = -ret;
+
+    return (false);
+  }
+
+  return (true);
+}
+
+/** Check if io_uring is supported by the kernel by creating and
+destroying a small probe ring. If only the SQ polling feature is
+unavailable, clears srv_io_uring_sqpoll and reports success.
+@return true if supported. */
+bool AIO::is_io_uring_supported() {
+  io_uring probe_ring;
+
+  unsigned flags = srv_io_uring_sqpoll ? IORING_SETUP_SQPOLL : 0;
+
+  int ret = io_uring_queue_init(4, &probe_ring, flags);
+
+  if (ret == 0) {
+    io_uring_queue_exit(&probe_ring);
+
+    return (true);
+  }
+
+  if (flags != 0) {
+    /* SQ polling needs a recent kernel and, on older ones,
+    CAP_SYS_ADMIN. Try again without it. */
+
+    ret = io_uring_queue_init(4, &probe_ring, 0);
+
+    if (ret == 0) {
+      io_uring_queue_exit(&probe_ring);
+
+      ib::warn() << "io_uring SQ polling is not available on this"
+                    " system; continuing with innodb_io_uring_sqpoll"
+                    " disabled.";
+
+      srv_io_uring_sqpoll = false;
+
+      return (true);
+    }
+  }
+
+  return (false);
+}
+#endif /* HAVE_LIBURING */
+
 /** Creates an io_context for native linux AIO.
 @param[in]	max_events	number of events
 @param[out]	io_ctx		io_ctx to initialize.
@@ -6132,8 +6505,48 @@ dberr_t AIO::init_slots() {
 }
 
 #ifdef LINUX_NATIVE_AIO
+#ifdef HAVE_LIBURING
+/** Initialise the io_uring instances, one ring per segment */
+dberr_t AIO::init_io_uring() {
+  ut_a(m_rings == nullptr);
+
+  m_rings =
+      static_cast<io_uring *>(ut_zalloc_nokey(m_n_segments * sizeof(*m_rings)));
+
+  if (m_rings == nullptr) {
+    return (DB_OUT_OF_MEMORY);
+  }
+
+  unsigned flags = 0;
+
+  if (srv_io_uring_sqpoll) {
+    flags |= IORING_SETUP_SQPOLL;
+  }
+
+  for (ulint i = 0; i < m_n_segments; ++i) {
+    int ret = io_uring_queue_init(slots_per_segment(), &m_rings[i], flags);
+
+    if (ret != 0) {
+      ib::error() << "io_uring_queue_init() returned error [" << ret
+                  << "]. You can disable io_uring by setting"
+                     " innodb_use_io_uring = 0 in my.cnf";
+
+      return (DB_IO_ERROR);
+    }
+  }
+
+  return (DB_SUCCESS);
+}
+#endif /* HAVE_LIBURING */
+
 /** Initialise the Linux Native AIO interface */
 dberr_t AIO::init_linux_native_aio() {
+#ifdef HAVE_LIBURING
+  if (srv_use_io_uring) {
+    return (init_io_uring());
+  }
+#endif /* HAVE_LIBURING */
+
   /* Initialize the io_context array. One io_context
   per segment in the array. */
 
@@ -6239,6 +6652,16 @@ AIO::~AIO() {
   if (srv_use_native_aio) {
     m_events.clear();
     ut_free(m_aio_ctx);
+
+#ifdef HAVE_LIBURING
+    if (m_rings != nullptr) {
+      for (ulint i = 0; i < m_n_segments; ++i) {
+        io_uring_queue_exit(&m_rings[i]);
+      }
+
+      ut_free(m_rings);
+    }
+#endif /* HAVE_LIBURING */
   }
 #endif /* LINUX_NATIVE_AIO */
 
@@ -6266,6 +6689,17 @@ bool AIO::start(ulint n_per_seg, ulint n_readers, ulint n_writers,
 
     srv_use_native_aio = FALSE;
   }
+
+#ifdef HAVE_LIBURING
+  /* io_uring rides on the native AIO handler threads, so it needs
+  srv_use_native_aio; check that the kernel supports it too. */
+  if (srv_use_io_uring && (!srv_use_native_aio || !is_io_uring_supported())) {
+    ib::warn() << "io_uring disabled: either innodb_use_native_aio is"
+                  " turned off or the kernel does not support io_uring.";
+
+    srv_use_io_uring = false;
+  }
+#endif /* HAVE_LIBURING */
 #endif /* LINUX_NATIVE_AIO */
 
   srv_reset_io_thread_op_info();
@@ -6901,6 +7335,53 @@ void AIO::wake_simulated_handler_thread(ulint global_segment, ulint segment) {
   release();
 }
 
+/** Starts deferring native AIO submissions on the calling thread, so
+that a burst of asynchronous requests (e.g. a read-ahead batch) can be
+handed to the kernel with a single io_submit() call per io context by
+os_aio_batch_end(). Has no effect unless Linux native AIO is used. */
+void os_aio_batch_begin() {
+#if defined(LINUX_NATIVE_AIO)
+  if (srv_use_native_aio) {
+    ut_ad(!os_aio_batch.m_active);
+
+    os_aio_batch.m_active = true;
+  }
+#endif /* LINUX_NATIVE_AIO */
+}
+
+/** Submits all native AIO requests deferred on the calling thread
+since os_aio_batch_begin(). */
+void os_aio_batch_end() {
+#if defined(LINUX_NATIVE_AIO)
+  if (!os_aio_batch.m_active) {
+    return;
+  }
+
+  os_aio_batch.m_active = false;
+
+  auto &ctxs = os_aio_batch.m_ctxs;
+  auto &iocbs = os_aio_batch.m_iocbs;
+
+  /* Submit each run of requests sharing an io_context together. The
+  deferred requests of one batch mostly target the same segment, so
+  this usually degenerates into a single io_submit() call. */
+  for (ulint i = 0; i < iocbs.size();) {
+    ulint j = i + 1;
+
+    while (j < iocbs.size() && ctxs[j] == ctxs[i]) {
+      ++j;
+    }
+
+    os_aio_batch_submit(ctxs[i], &iocbs[i], j - i);
+
+    i = j;
+  }
+
+  ctxs.clear();
+  iocbs.clear();
+#endif /* LINUX_NATIVE_AIO */
+}
+
 /** Wakes up simulated aio i/o-handler threads if they have something to do. */
 void os_aio_simulated_wake_handler_threads() {
   if (srv_use_native_aio) {
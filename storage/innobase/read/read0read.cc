@@ -317,7 +317,8 @@ ReadView::ReadView()
       m_up_limit_id(),
       m_creator_trx_id(),
       m_ids(),
-      m_low_limit_no() {
+      m_low_limit_no(),
+      m_version() {
   ut_d(::memset(&m_view_list, 0x0, sizeof(m_view_list)));
   ut_d(m_view_low_limit_no = 0);
 }
@@ -339,6 +340,8 @@ MVCC::MVCC(ulint size) {
 
     UT_LIST_ADD_FIRST(m_free, view);
   }
+
+  mutex_create(LATCH_ID_MVCC_SNAPSHOT, &m_snapshot_mutex);
 }
 
 MVCC::~MVCC() {
@@ -350,6 +353,8 @@ MVCC::~MVCC() {
   }
 
   ut_a(UT_LIST_GET_LEN(m_views) == 0);
+
+  mutex_free(&m_snapshot_mutex);
 }
 
 /**
@@ -450,6 +455,8 @@ void ReadView::prepare(trx_id_t id) {
     }
   }
 
+  m_version = trx_sys->rw_trx_version.load(std::memory_order_acquire);
+
   ut_d(m_view_low_limit_no = m_low_limit_no);
   m_closed = false;
 }
@@ -523,20 +530,49 @@ void MVCC::view_open(ReadView *&view, trx_t *trx) {
 
     ut_ad(view->m_closed);
 
-    /* NOTE: This can be optimised further, for now we only
-    resuse the view iff there are no active RW transactions.
-
-    There is an inherent race here between purge and this
+    /* There is an inherent race here between purge and this
     thread. Purge will skip views that are marked as closed.
     Therefore we must set the low limit id after we reset the
     closed status after the check. */
 
-    if (trx_is_autocommit_non_locking(trx) && view->empty()) {
+    if (trx_is_autocommit_non_locking(trx)) {
       view->m_closed = false;
 
-      if (view->m_low_limit_id == trx_sys_get_max_trx_id()) {
+      if (view->empty() &&
+          view->m_low_limit_id == trx_sys_get_max_trx_id()) {
         return;
-      } else {
+      }
+
+      /* The snapshot state is versioned: rw_trx_version is
+      incremented under trx_sys->mutex whenever max_trx_id is
+      allocated or the RW transaction lists change. If the version
+      still matches, the view this thread would build now is
+      identical to the one it already holds, even if there are
+      active RW transactions. */
+      if (view->m_version ==
+          trx_sys->rw_trx_version.load(std::memory_order_acquire)) {
+        return;
+      }
+
+      view->m_closed = true;
+
+      /* The view is stale. Before rebuilding it under the trx_sys
+      mutex, try to copy the snapshot another connection has already
+      built for the current version. The copy is done while the view
+      is still marked closed: purge never reads the fields of closed
+      views, so they can be modified without the trx_sys mutex and
+      the view stays on the m_views list the whole time. */
+      if (try_copy_snapshot(view)) {
+        /* Reopen the view, and then re-check that the snapshot is
+        still current; a version bump after the copy could mean that
+        purge no longer takes this snapshot into account. */
+        view->m_closed = false;
+
+        if (view->m_version ==
+            trx_sys->rw_trx_version.load(std::memory_order_acquire)) {
+          return;
+        }
+
         view->m_closed = true;
       }
     }
@@ -559,11 +595,56 @@ void MVCC::view_open(ReadView *&view, trx_t *trx) {
     ut_ad(!view->is_closed());
 
     ut_ad(validate());
+
+    /* Make the snapshot available to other connections, so that they
+    can refresh their stale views without the trx_sys mutex. Views of
+    transactions with an assigned id are specific to their creator
+    and are not shared. */
+    if (trx->id == 0) {
+      mutex_enter(&m_snapshot_mutex);
+
+      m_snapshot.copy_prepare(*view);
+
+      m_snapshot_valid = true;
+
+      mutex_exit(&m_snapshot_mutex);
+    }
   }
 
   trx_sys_mutex_exit();
 }
 
+/** Try to refresh a stale view from the cached snapshot, without
+acquiring trx_sys_t::mutex.
+@param[in,out]	view	view to refresh, must be marked closed
+@return true if the view was refreshed from the cache */
+bool MVCC::try_copy_snapshot(ReadView *view) {
+  ut_ad(view->m_closed);
+
+  const uint64_t version =
+      trx_sys->rw_trx_version.load(std::memory_order_acquire);
+
+  bool copied = false;
+
+  mutex_enter(&m_snapshot_mutex);
+
+  if (m_snapshot_valid && m_snapshot.m_version == version) {
+    view->copy_prepare(m_snapshot);
+
+    copied = true;
+  }
+
+  mutex_exit(&m_snapshot_mutex);
+
+  if (copied) {
+    /* The cached snapshot was created by a transaction without an
+    assigned id, so completing the copy only re-checks the limits. */
+    view->copy_complete();
+  }
+
+  return (copied);
+}
+
 ReadView *MVCC::get_view_created_by_trx_id(trx_id_t trx_id) const {
   ReadView *view;
 
@@ -626,6 +707,8 @@ void ReadView::copy_prepare(const ReadView &other) {
   m_low_limit_id = other.m_low_limit_id;
 
   m_creator_trx_id = other.m_creator_trx_id;
+
+  m_version = other.m_version;
 }
 
 /**
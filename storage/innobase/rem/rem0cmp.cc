@@ -596,6 +596,63 @@ int cmp_data_data(ulint mtype, ulint prtype, bool is_asc, const byte *data1,
   return (cmp_data(mtype, prtype, is_asc, data1, len1, data2, len2));
 }
 
+int cmp_dtuple_rec_binary_prefix(const dtuple_t *dtuple, const rec_t *rec,
+                                 const ulint *offsets, ulint n_cmp,
+                                 ulint *matched_fields) {
+  ut_ad(n_cmp > 0);
+  ut_ad(*matched_fields <= n_cmp);
+  ut_ad(n_cmp <= dtuple_get_n_fields(dtuple));
+
+  for (auto i = *matched_fields; i < n_cmp; ++i) {
+    const auto dtuple_field = dtuple_get_nth_field(dtuple, i);
+
+    const auto dtuple_b_ptr =
+        static_cast<const byte *>(dfield_get_data(dtuple_field));
+
+    const auto dtuple_f_len = dfield_get_len(dtuple_field);
+
+    ut_ad(!rec_offs_nth_extern(offsets, i));
+    ut_ad(!rec_offs_nth_default(offsets, i));
+    ut_ad(!dfield_is_ext(dtuple_field));
+
+    ulint rec_f_len;
+
+    const auto rec_b_ptr = rec_get_nth_field(rec, offsets, i, &rec_f_len);
+
+    /* The column is NOT NULL, so the record field cannot be NULL;
+    the tuple field could be, in a search tuple. */
+    ut_ad(rec_f_len != UNIV_SQL_NULL);
+
+    int ret;
+
+    if (dtuple_f_len == UNIV_SQL_NULL) {
+      /* SQL NULL is smaller than any non-NULL value. */
+      ret = -1;
+    } else {
+      /* The fields are fixed-length, so normally
+      dtuple_f_len == rec_f_len; if not, compare the common
+      prefix and let the longer value win, like cmp_data()
+      does for types without a padding character. */
+      ret = memcmp(dtuple_b_ptr, rec_b_ptr, std::min(dtuple_f_len, rec_f_len));
+
+      if (ret != 0) {
+        ret = ret < 0 ? -1 : 1;
+      } else if (dtuple_f_len != rec_f_len) {
+        ret = dtuple_f_len < rec_f_len ? -1 : 1;
+      }
+    }
+
+    if (ret != 0) {
+      *matched_fields = i;
+      return (ret);
+    }
+  }
+
+  *matched_fields = n_cmp;
+
+  return (0);
+}
+
 int cmp_dtuple_rec_with_match_low(const dtuple_t *dtuple, const rec_t *rec,
                                   const dict_index_t *index,
                                   const ulint *offsets, ulint n_cmp,
@@ -627,8 +684,25 @@ int cmp_dtuple_rec_with_match_low(const dtuple_t *dtuple, const rec_t *rec,
     *matched_fields = 0;
   }
 
+  auto i = *matched_fields;
+
+  if (index->cmp_binary_prefix != nullptr && i < index->n_binary_cmp_fields) {
+    /* Compare the leading fields that were determined to be
+    byte-comparable when the index was added to the cache. */
+    const auto n_binary = std::min<ulint>(n_cmp, index->n_binary_cmp_fields);
+
+    const auto ret = index->cmp_binary_prefix(dtuple, rec, offsets, n_binary,
+                                              matched_fields);
+
+    if (ret != 0 || n_binary == n_cmp) {
+      return (ret);
+    }
+
+    i = *matched_fields;
+  }
+
   /* Compare fields in a loop. */
-  for (auto i = *matched_fields; i < n_cmp; ++i) {
+  for (; i < n_cmp; ++i) {
     const auto dtuple_field = dtuple_get_nth_field(dtuple, i);
 
     const auto dtuple_b_ptr =
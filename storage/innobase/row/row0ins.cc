@@ -103,6 +103,11 @@ ins_node_t *ins_node_create(
 
   node->ins_multi_val_pos = 0;
 
+  node->ins_clust_block = nullptr;
+  node->ins_clust_modify_clock = 0;
+  node->ins_clust_withdraw_clock = 0;
+  node->ins_clust_index = nullptr;
+
   return (node);
 }
 
@@ -1341,6 +1346,102 @@ class ib_dec_in_dtor {
   ulint &counter;
 };
 
+/** Checks if an earlier foreign key check of this transaction has already
+verified that the referenced key of an entry exists. The earlier check took
+a shared lock on the matching record which is held at least until the
+current statement ends (the cache is cleared at statement boundaries), so
+the key is guaranteed to still exist unless this transaction has itself
+modified the referenced table since then; bulk loads that repeat the same
+parent id thousands of times then skip the B-tree probe entirely.
+@param[in]	trx		transaction doing the check
+@param[in]	foreign		foreign constraint being checked
+@param[in]	check_table	referenced table
+@param[in]	check_index	referenced index
+@param[in]	entry		index entry for the foreign index
+@return true if the key has been verified earlier in this transaction */
+static bool row_ins_foreign_check_cached(trx_t *trx,
+                                         const dict_foreign_t *foreign,
+                                         dict_table_t *check_table,
+                                         const dict_index_t *check_index,
+                                         const dtuple_t *entry) {
+  if (trx->mod_tables.count(check_table) > 0) {
+    /* The transaction has modified the referenced table; it may have
+    deleted the very row an earlier check locked. */
+    return (false);
+  }
+
+  trx_fk_checked_keys_t::const_iterator it = trx->fk_checked_keys.find(foreign);
+
+  if (it == trx->fk_checked_keys.end() ||
+      it->second.ref_table_id != check_table->id ||
+      it->second.ref_index_id != check_index->id) {
+    return (false);
+  }
+
+  const auto &key = it->second.ref_key;
+  ulint offset = 0;
+
+  for (ulint i = 0; i < foreign->n_fields; i++) {
+    const dfield_t *field = dtuple_get_nth_field(entry, i);
+    const ulint len = dfield_get_len(field);
+
+    ut_ad(len != UNIV_SQL_NULL);
+
+    if (offset + 2 > key.size() || mach_read_from_2(&key[offset]) != len) {
+      return (false);
+    }
+
+    offset += 2;
+
+    if (offset + len > key.size() ||
+        memcmp(&key[offset], dfield_get_data(field), len) != 0) {
+      return (false);
+    }
+
+    offset += len;
+  }
+
+  return (offset == key.size());
+}
+
+/** Remembers that a foreign key check found and shared-locked a matching
+record in the referenced index, so that later checks of the same key in
+this transaction can skip the lookup.
+@param[in,out]	trx		transaction doing the check
+@param[in]	foreign		foreign constraint being checked
+@param[in]	check_table	referenced table
+@param[in]	check_index	referenced index
+@param[in]	entry		index entry for the foreign index */
+static void row_ins_foreign_check_remember(trx_t *trx,
+                                           const dict_foreign_t *foreign,
+                                           const dict_table_t *check_table,
+                                           const dict_index_t *check_index,
+                                           const dtuple_t *entry) {
+  trx_fk_checked_key_t &cached = trx->fk_checked_keys[foreign];
+
+  cached.ref_table_id = check_table->id;
+  cached.ref_index_id = check_index->id;
+  cached.ref_key.clear();
+
+  for (ulint i = 0; i < foreign->n_fields; i++) {
+    const dfield_t *field = dtuple_get_nth_field(entry, i);
+    const ulint len = dfield_get_len(field);
+
+    if (len == UNIV_SQL_NULL || len > 0xFFFF) {
+      /* Cannot be serialized; do not cache. */
+      trx->fk_checked_keys.erase(foreign);
+      return;
+    }
+
+    byte len_buf[2];
+    mach_write_to_2(len_buf, len);
+    cached.ref_key.insert(cached.ref_key.end(), len_buf, len_buf + 2);
+
+    const byte *data = static_cast<const byte *>(dfield_get_data(field));
+    cached.ref_key.insert(cached.ref_key.end(), data, data + len);
+  }
+}
+
 /** Checks if foreign key constraint fails for an index entry. Sets shared locks
  which lock either the success or the failure of the constraint. NOTE that
  the caller must have a shared latch on dict_operation_lock.
@@ -1505,6 +1606,15 @@ dberr_t row_ins_check_foreign_constraint(
     goto exit_func;
   }
 
+  if (check_ref && !tmp_open &&
+      row_ins_foreign_check_cached(trx, foreign, check_table, check_index,
+                                   entry)) {
+    /* An earlier check in this transaction found and shared-locked a
+    matching record, and the transaction has not modified the referenced
+    table since, so the record is still there. */
+    goto exit_func;
+  }
+
   if (check_table != table) {
     /* We already have a LOCK_IX on table, but not necessarily
     on check_table */
@@ -1674,6 +1784,13 @@ end_scan:
   /* Restore old value */
   dtuple_set_n_fields_cmp(entry, n_fields_cmp);
 
+  if (err == DB_SUCCESS && check_ref && !tmp_open) {
+    /* The matching record is shared-locked until the transaction ends;
+    later checks of the same key can skip the lookup. */
+    row_ins_foreign_check_remember(trx, foreign, check_table, check_index,
+                                   entry);
+  }
+
 do_possible_lock_wait:
   if (err == DB_LOCK_WAIT) {
     /* An object that will correctly decrement the FK check counter
@@ -2323,6 +2440,104 @@ static void row_ins_temp_prebuilt_tree_modified(dict_table_t *table) {
   }
 }
 
+/** Tries to restore the clustered index insert position cached in the
+insert node, instead of descending the index tree from the root. The cached
+block is latched with buf_page_optimistic_get() and the position found on it
+is verified the same way an adaptive hash index guess is verified: the
+position is accepted only if the records around it bound the entry within
+the whole tree, not merely within the page. On success the persistent
+cursor is positioned with genuine low_match and up_match values, exactly as
+if btr_pcur_open() had been called with PAGE_CUR_LE and BTR_MODIFY_LEAF.
+During a multi-row insert into an increasing primary key the entry keeps
+landing on the rightmost leaf page, so the guess keeps succeeding and each
+row after the first skips the full descent.
+@param[in,out]	node	insert node holding the cached position
+@param[in]	index	clustered index
+@param[in]	entry	index entry to insert
+@param[in,out]	pcur	persistent cursor to position
+@param[in,out]	mtr	mini-transaction
+@return true if the cursor was positioned from the cached block */
+static bool row_ins_clust_restore_pos_from_cache(ins_node_t *node,
+                                                 dict_index_t *index,
+                                                 const dtuple_t *entry,
+                                                 btr_pcur_t *pcur, mtr_t *mtr) {
+  buf_block_t *block = node->ins_clust_block;
+
+  if (block == nullptr || node->ins_clust_index != index) {
+    return (false);
+  }
+
+  if (buf_pool_is_obsolete(node->ins_clust_withdraw_clock)) {
+    /* The buffer pool has been resized; the block may have been
+    withdrawn and may not even be dereferenced. */
+    node->ins_clust_block = nullptr;
+
+    return (false);
+  }
+
+  if (!buf_page_optimistic_get(RW_X_LATCH, block, node->ins_clust_modify_clock,
+                               Page_fetch::NORMAL, __FILE__, __LINE__, mtr)) {
+    node->ins_clust_block = nullptr;
+
+    return (false);
+  }
+
+  /* An unchanged modify clock guarantees that the block still contains
+  the same leaf page of this index and that no record has been deleted
+  from it; records may only have been inserted since the position was
+  cached. */
+  ut_ad(btr_page_get_index_id(buf_block_get_frame(block)) == index->id);
+  ut_ad(page_is_leaf(buf_block_get_frame(block)));
+
+  pcur->init();
+
+  page_cur_t *page_cursor = btr_pcur_get_page_cur(pcur);
+  ulint up_match = 0;
+  ulint low_match = 0;
+
+  page_cur_search_with_match(block, index, entry, PAGE_CUR_LE, &up_match,
+                             &low_match, page_cursor, nullptr);
+
+  /* The position is correct within the page; check that it is also
+  correct within the whole tree. If the cursor sits on the page infimum,
+  a preceding page could contain records above the entry, and if it sits
+  on the last user record, a following page could begin with a record
+  that should precede the entry. */
+
+  const rec_t *rec = page_cur_get_rec(page_cursor);
+  bool success;
+
+  if (page_rec_is_infimum(rec)) {
+    success = btr_page_get_prev(buf_block_get_frame(block), mtr) == FIL_NULL;
+  } else if (page_rec_is_supremum(page_rec_get_next_const(rec))) {
+    success = btr_page_get_next(buf_block_get_frame(block), mtr) == FIL_NULL;
+  } else {
+    success = true;
+  }
+
+  if (!success) {
+    btr_leaf_page_release(block, BTR_MODIFY_LEAF, mtr);
+
+    node->ins_clust_block = nullptr;
+
+    return (false);
+  }
+
+  btr_cur_t *cursor = btr_pcur_get_btr_cur(pcur);
+
+  cursor->index = index;
+  cursor->low_match = low_match;
+  cursor->up_match = up_match;
+  cursor->flag = BTR_CUR_BINARY;
+
+  pcur->m_latch_mode = BTR_MODIFY_LEAF;
+  pcur->m_search_mode = PAGE_CUR_LE;
+  pcur->m_pos_state = BTR_PCUR_IS_POSITIONED;
+  pcur->m_trx_if_known = nullptr;
+
+  return (true);
+}
+
 /** Tries to insert an entry into a clustered index, ignoring foreign key
  constraints. If a record with the same unique key is found, the other
  record is necessarily marked deleted by a committed transaction, or a
@@ -2353,6 +2568,7 @@ and return. don't execute actual insert. */
   btr_cur_t *cursor;
   dberr_t err = DB_SUCCESS;
   big_rec_t *big_rec = nullptr;
+  ins_node_t *ins_node = nullptr;
   mtr_t mtr;
   mem_heap_t *offsets_heap = nullptr;
   ulint offsets_[REC_OFFS_NORMAL_SIZE];
@@ -2404,10 +2620,25 @@ and return. don't execute actual insert. */
     mtr_s_lock(dict_index_get_lock(index), &mtr);
   }
 
+  /* For an optimistic insert executed on behalf of an insert node, try
+  to reuse the leaf page position cached by the previous row instead of
+  descending the tree from the root. The online DDL and intrinsic table
+  paths are excluded: the former holds the index S-latch across the
+  search, the latter has its own cached-cursor machinery. */
+  if (mode == BTR_MODIFY_LEAF && thr != nullptr && thr->run_node != nullptr &&
+      que_node_get_type(thr->run_node) == QUE_NODE_INSERT &&
+      !index->table->is_intrinsic()) {
+    ins_node = static_cast<ins_node_t *>(thr->run_node);
+  }
+
   /* Note that we use PAGE_CUR_LE as the search mode, because then
   the function will return in both low_match and up_match of the
   cursor sensible values */
-  btr_pcur_open(index, entry, PAGE_CUR_LE, mode, &pcur, &mtr);
+  if (ins_node == nullptr ||
+      !row_ins_clust_restore_pos_from_cache(ins_node, index, entry, &pcur,
+                                            &mtr)) {
+    btr_pcur_open(index, entry, PAGE_CUR_LE, mode, &pcur, &mtr);
+  }
   cursor = btr_pcur_get_btr_cur(&pcur);
   cursor->thr = thr;
 
@@ -2541,6 +2772,22 @@ and return. don't execute actual insert. */
       }
     }
 
+    if (ins_node != nullptr) {
+      if (err == DB_SUCCESS && big_rec == nullptr) {
+        /* Cache the position for the next row of the statement; the
+        modify clock must be read while the page X-latch is still
+        held, that is, before the mtr commits. */
+        buf_block_t *block = btr_cur_get_block(cursor);
+
+        ins_node->ins_clust_block = block;
+        ins_node->ins_clust_modify_clock = buf_block_get_modify_clock(block);
+        ins_node->ins_clust_withdraw_clock = buf_withdraw_clock;
+        ins_node->ins_clust_index = index;
+      } else {
+        ins_node->ins_clust_block = nullptr;
+      }
+    }
+
     if (big_rec != nullptr) {
       mtr.commit();
 
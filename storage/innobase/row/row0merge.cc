@@ -35,16 +35,22 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <math.h>
 #include <sys/types.h>
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 #include <sql_class.h>
 #include "btr0bulk.h"
 #include "dict0crea.h"
 #include "dict0dd.h"
 #include "fsp0sysspace.h"
+#include "ha_innodb.h"
 #include "ha_prototypes.h"
 #include "handler0alter.h"
 #include "lob0lob.h"
 #include "lock0lock.h"
 #include "my_psi_config.h"
+#include "os0thread-create.h"
 #include "pars0pars.h"
 #include "row0ext.h"
 #include "row0ftsort.h"
@@ -69,6 +75,10 @@ this program; if not, write to the Free Software Foundation, Inc.,
 /* Whether to disable file system cache */
 bool srv_disable_sort_file_cache;
 
+#ifdef UNIV_PFS_THREAD
+mysql_pfs_key_t ddl_index_build_thread_key;
+#endif /* UNIV_PFS_THREAD */
+
 /** Class that caches index row tuples made from a single cluster
 index page scan, and then insert into corresponding index tree */
 class index_tuple_info_t {
@@ -245,7 +255,102 @@ class index_tuple_info_t {
   mem_heap_t *m_heap;
 };
 
-void index_tuple_info_t::iter_init() { m_iter = m_dtuple_vec->begin(); }
+/** Interleave the low 16 bits of a value with zero bits, so that two
+such values can be combined into a Morton code.
+@param[in]	v	value to spread
+@return the low 16 bits of v spread over 32 bits */
+static inline uint64_t row_merge_spread_bits(uint64_t v) {
+  v &= 0xFFFF;
+  v = (v | (v << 8)) & 0x00FF00FF;
+  v = (v | (v << 4)) & 0x0F0F0F0F;
+  v = (v | (v << 2)) & 0x33333333;
+  v = (v | (v << 1)) & 0x55555555;
+  return (v);
+}
+
+void index_tuple_info_t::iter_init() {
+  /* The tuples were cached in clustered index order, which is random in
+  space. Insert them in space filling curve order instead: consecutive
+  inserts then descend to the same or neighbouring leaf pages, which
+  yields a better packed tree and avoids re-searching it from the root
+  across distant leaves for every row. The curve is approximated by a
+  Morton code of the MBR centre, quantized to the bounding box of the
+  batch. */
+  if (m_dtuple_vec->size() > 1) {
+    struct keyed_tuple_t {
+      double x;
+      double y;
+      uint64_t key;
+      dtuple_t *tuple;
+    };
+    std::vector<keyed_tuple_t, ut_allocator<keyed_tuple_t>> keyed_tuples;
+    keyed_tuples.reserve(m_dtuple_vec->size());
+
+    double x_min = 0.0;
+    double x_max = 0.0;
+    double y_min = 0.0;
+    double y_max = 0.0;
+
+    for (dtuple_t *dtuple : *m_dtuple_vec) {
+      rtr_mbr_t mbr;
+
+      rtr_read_mbr(static_cast<const byte *>(
+                       dfield_get_data(dtuple_get_nth_field(dtuple, 0))),
+                   &mbr);
+
+      keyed_tuple_t keyed;
+      keyed.x = (mbr.xmin + mbr.xmax) / 2;
+      keyed.y = (mbr.ymin + mbr.ymax) / 2;
+      keyed.key = 0;
+      keyed.tuple = dtuple;
+
+      if (keyed_tuples.empty()) {
+        x_min = x_max = keyed.x;
+        y_min = y_max = keyed.y;
+      } else {
+        x_min = std::min(x_min, keyed.x);
+        x_max = std::max(x_max, keyed.x);
+        y_min = std::min(y_min, keyed.y);
+        y_max = std::max(y_max, keyed.y);
+      }
+
+      keyed_tuples.push_back(keyed);
+    }
+
+    const double x_range = x_max - x_min;
+    const double y_range = y_max - y_min;
+
+    /* Skip degenerate batches, including any with non-finite
+    coordinates, for which the ranges do not compare greater than
+    zero. */
+    if (x_range > 0 || y_range > 0) {
+      for (auto &keyed : keyed_tuples) {
+        const auto qx =
+            x_range > 0
+                ? static_cast<uint64_t>((keyed.x - x_min) / x_range * 0xFFFF)
+                : 0;
+        const auto qy =
+            y_range > 0
+                ? static_cast<uint64_t>((keyed.y - y_min) / y_range * 0xFFFF)
+                : 0;
+
+        keyed.key =
+            (row_merge_spread_bits(qx) << 1) | row_merge_spread_bits(qy);
+      }
+
+      std::sort(keyed_tuples.begin(), keyed_tuples.end(),
+                [](const keyed_tuple_t &a, const keyed_tuple_t &b) {
+                  return (a.key < b.key);
+                });
+
+      for (ulint i = 0; i < keyed_tuples.size(); i++) {
+        (*m_dtuple_vec)[i] = keyed_tuples[i].tuple;
+      }
+    }
+  }
+
+  m_iter = m_dtuple_vec->begin();
+}
 
 void index_tuple_info_t::cache_tuples() {
   /* Since the data of the tuple pk fields are pointers of cluster rows.
@@ -887,7 +992,15 @@ void row_merge_dup_report(
   if (!dup->n_dup++) {
     /* Only report the first duplicate record,
     but count all duplicate records. */
-    innobase_fields_to_mysql(dup->table, dup->index, entry);
+    if (dup->mutex != nullptr) {
+      /* Several index build threads share the MySQL table
+      object; let only one of them convert a record at a time. */
+      mutex_enter(dup->mutex);
+      innobase_fields_to_mysql(dup->table, dup->index, entry);
+      mutex_exit(dup->mutex);
+    } else {
+      innobase_fields_to_mysql(dup->table, dup->index, entry);
+    }
   }
 }
 
@@ -3637,6 +3750,124 @@ this function and it will be passed to other functions for further accounting.
 @param[in]	eval_table	mysql table used to evaluate virtual column
                                 value, see innobase_get_computed_value().
 @return DB_SUCCESS or error code */
+/** Work description shared by the index build worker threads of one
+ALTER TABLE: the indexes whose sort and B-tree load can run independently
+of each other, and everything needed to process one of them. */
+struct row_merge_build_ctx_t {
+  /** Transaction performing the ALTER TABLE */
+  trx_t *trx;
+
+  /** Table that is being scanned */
+  dict_table_t *old_table;
+
+  /** MySQL table object, shared by all threads and only accessed
+  under dup_mutex when a duplicate key is reported */
+  struct TABLE *table;
+
+  /** Mapping of column numbers in table to the rebuilt table, or
+  NULL if not rebuilding the table */
+  const ulint *col_map;
+
+  /** All indexes being built by this ALTER TABLE */
+  dict_index_t **indexes;
+
+  /** Merge files, one per element of indexes[] */
+  merge_file_t *merge_files;
+
+  /** Flush observer for the bulk loads, or NULL; its counters are
+  maintained per buffer pool instance and may be updated
+  concurrently */
+  FlushObserver *flush_observer;
+
+  /** Directory for the temporary merge files, or NULL for the
+  default temporary directory */
+  const char *tmpdir;
+
+  /** Serializes duplicate key reporting into the shared table */
+  ib_mutex_t dup_mutex;
+
+  /** Positions in indexes[] that the workers should build */
+  ulint *build_ids;
+
+  /** Number of elements in build_ids */
+  ulint n_build;
+
+  /** Next unclaimed element of build_ids */
+  std::atomic<ulint> next_build;
+
+  /** Build result, one per element of indexes[]; only the slots
+  named by build_ids are written */
+  dberr_t *errors;
+};
+
+/** Worker thread routine for building indexes during ALTER TABLE.
+Claims one index at a time from the shared work description and runs the
+merge sort and the B-tree load for it, with a sort buffer and a temporary
+file of its own, until no unclaimed indexes remain. Progress reporting
+(ut_stage_alter_t) is not thread safe and is skipped on this path.
+@param[in,out]	ctx	work shared by the worker threads */
+static void row_merge_index_build_worker(row_merge_build_ctx_t *ctx) {
+  ut_allocator<row_merge_block_t> alloc(mem_key_row_merge_sort);
+
+  for (;;) {
+    ulint task = ctx->next_build.fetch_add(1);
+
+    if (task >= ctx->n_build) {
+      break;
+    }
+
+    ulint i = ctx->build_ids[task];
+    dict_index_t *sort_idx = ctx->indexes[i];
+    dberr_t error;
+
+    ut_ad(!(sort_idx->type & DICT_FTS));
+    ut_ad(!dict_index_is_spatial(sort_idx));
+    ut_ad(ctx->merge_files[i].fd >= 0);
+
+    ut_new_pfx_t block_pfx;
+    row_merge_block_t *block =
+        alloc.allocate_large(3 * srv_sort_buf_size, &block_pfx);
+
+    if (block == nullptr) {
+      ctx->errors[i] = DB_OUT_OF_MEMORY;
+      continue;
+    }
+
+    int tmpfd = row_merge_file_create_low(ctx->tmpdir);
+
+    if (tmpfd < 0) {
+      error = DB_OUT_OF_MEMORY;
+    } else {
+      row_merge_dup_t dup = {sort_idx, ctx->table, ctx->col_map, 0,
+                             &ctx->dup_mutex};
+
+      error = row_merge_sort(ctx->trx, &dup, &ctx->merge_files[i], block,
+                             &tmpfd, nullptr);
+
+      if (error == DB_SUCCESS) {
+        BtrBulk btr_bulk(sort_idx, ctx->trx->id, ctx->flush_observer);
+        error = btr_bulk.init();
+        if (error == DB_SUCCESS) {
+          error = row_merge_insert_index_tuples(ctx->trx, sort_idx,
+                                                ctx->old_table,
+                                                ctx->merge_files[i].fd, block,
+                                                nullptr, &btr_bulk, nullptr);
+
+          error = btr_bulk.finish(error);
+        }
+      }
+
+      /* row_merge() swaps the sorted output into merge_files[i],
+      so the descriptor left here is always safe to close. */
+      row_merge_file_destroy_low(tmpfd);
+    }
+
+    ctx->errors[i] = error;
+
+    alloc.deallocate_large(block, &block_pfx);
+  }
+}
+
 dberr_t row_merge_build_indexes(
     trx_t *trx, dict_table_t *old_table, dict_table_t *new_table, bool online,
     dict_index_t **indexes, const ulint *key_numbers, ulint n_indexes,
@@ -3656,8 +3887,15 @@ dberr_t row_merge_build_indexes(
   fts_psort_t *merge_info = nullptr;
   int64_t sig_count = 0;
   bool fts_psort_initiated = false;
+  ulint n_build = 0;
+  ulint n_build_threads = 1;
+  bool built_in_parallel = false;
+  row_merge_build_ctx_t build_ctx;
   DBUG_TRACE;
 
+  build_ctx.build_ids = nullptr;
+  build_ctx.errors = nullptr;
+
   ut_ad(!srv_read_only_mode);
   ut_ad((old_table == new_table) == !col_map);
   ut_ad(!add_cols || col_map);
@@ -3733,6 +3971,7 @@ dberr_t row_merge_build_indexes(
       dup->table = table;
       dup->col_map = col_map;
       dup->n_dup = 0;
+      dup->mutex = nullptr;
 
       row_fts_psort_info_init(trx, dup, old_table, new_table, opt_doc_id_size,
                               &psort_info, &merge_info);
@@ -3768,6 +4007,74 @@ dberr_t row_merge_build_indexes(
   /* Now we have files containing index entries ready for
   sorting and inserting. */
 
+  /* The merge sort and B-tree load of each index is independent of
+  the others. When several indexes are to be built, hand them to a
+  group of worker threads that claim and build whole indexes, each
+  with a sort buffer and a temporary file of its own. FTS indexes
+  keep the serial path below, which has parallel machinery of its
+  own, and spatial indexes are not built from merge files at all. */
+
+  for (i = 0; i < n_indexes; i++) {
+    if (!(indexes[i]->type & DICT_FTS) && !dict_index_is_spatial(indexes[i]) &&
+        merge_files[i].fd >= 0) {
+      n_build++;
+    }
+  }
+
+  if (n_build > 1) {
+    n_build_threads = std::min(
+        n_build, static_cast<ulint>(thd_ddl_build_threads(trx->mysql_thd)));
+  }
+
+  if (n_build_threads > 1) {
+    build_ctx.trx = trx;
+    build_ctx.old_table = old_table;
+    build_ctx.table = table;
+    build_ctx.col_map = col_map;
+    build_ctx.indexes = indexes;
+    build_ctx.merge_files = merge_files;
+    build_ctx.flush_observer = flush_observer;
+    build_ctx.tmpdir = thd_innodb_tmpdir(trx->mysql_thd);
+    build_ctx.build_ids =
+        static_cast<ulint *>(ut_malloc_nokey(n_build * sizeof(ulint)));
+    build_ctx.n_build = 0;
+    build_ctx.next_build = 0;
+    build_ctx.errors =
+        static_cast<dberr_t *>(ut_malloc_nokey(n_indexes * sizeof(dberr_t)));
+
+    for (i = 0; i < n_indexes; i++) {
+      build_ctx.errors[i] = DB_SUCCESS;
+
+      if (!(indexes[i]->type & DICT_FTS) &&
+          !dict_index_is_spatial(indexes[i]) && merge_files[i].fd >= 0) {
+        build_ctx.build_ids[build_ctx.n_build++] = i;
+      }
+    }
+
+    ut_ad(build_ctx.n_build == n_build);
+
+    mutex_create(LATCH_ID_ROW_MERGE_DUP, &build_ctx.dup_mutex);
+
+    {
+      std::vector<IB_thread> build_threads;
+
+      for (ulint t = 0; t < n_build_threads; t++) {
+        build_threads.emplace_back(
+            os_thread_create(ddl_index_build_thread_key,
+                             row_merge_index_build_worker, &build_ctx));
+        build_threads.back().start();
+      }
+
+      for (auto &build_thread : build_threads) {
+        build_thread.wait();
+      }
+    }
+
+    mutex_free(&build_ctx.dup_mutex);
+
+    built_in_parallel = true;
+  }
+
   for (i = 0; i < n_indexes; i++) {
     dict_index_t *sort_idx = indexes[i];
 
@@ -3831,19 +4138,28 @@ dberr_t row_merge_build_indexes(
       DEBUG_FTS_SORT_PRINT("FTS_SORT: Complete Insert\n");
 #endif
     } else if (merge_files[i].fd >= 0) {
-      row_merge_dup_t dup = {sort_idx, table, col_map, 0};
+      if (built_in_parallel) {
+        /* The index has already been sorted and loaded by the
+        worker threads above; pick up the result here so that the
+        error handling and the online log apply below stay common
+        with the serial path. */
+        error = build_ctx.errors[i];
+      } else {
+        row_merge_dup_t dup = {sort_idx, table, col_map, 0};
 
-      error = row_merge_sort(trx, &dup, &merge_files[i], block, &tmpfd, stage);
+        error =
+            row_merge_sort(trx, &dup, &merge_files[i], block, &tmpfd, stage);
 
-      if (error == DB_SUCCESS) {
-        BtrBulk btr_bulk(sort_idx, trx->id, flush_observer);
-        error = btr_bulk.init();
         if (error == DB_SUCCESS) {
-          error = row_merge_insert_index_tuples(trx, sort_idx, old_table,
-                                                merge_files[i].fd, block,
-                                                nullptr, &btr_bulk, stage);
-
-          error = btr_bulk.finish(error);
+          BtrBulk btr_bulk(sort_idx, trx->id, flush_observer);
+          error = btr_bulk.init();
+          if (error == DB_SUCCESS) {
+            error = row_merge_insert_index_tuples(trx, sort_idx, old_table,
+                                                  merge_files[i].fd, block,
+                                                  nullptr, &btr_bulk, stage);
+
+            error = btr_bulk.finish(error);
+          }
         }
       }
     }
@@ -3904,6 +4220,9 @@ func_exit:
 
   ut_free(merge_files);
 
+  ut_free(build_ctx.build_ids);
+  ut_free(build_ctx.errors);
+
   alloc.deallocate_large(block, &block_pfx);
 
   DICT_TF2_FLAG_UNSET(new_table, DICT_TF2_FTS_ADD_DOC_ID);
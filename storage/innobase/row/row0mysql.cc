@@ -42,6 +42,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <new>
 #include <vector>
 
+#include "btr0defrag.h"
 #include "btr0sea.h"
 #include "dict0boot.h"
 #include "dict0crea.h"
@@ -3922,6 +3923,10 @@ dberr_t row_drop_table_for_mysql(const char *name, trx_t *trx, bool nonatomic,
       dict_stats_recalc_pool_del(table);
     }
 
+    if (srv_thread_is_active(srv_threads.m_btr_defrag)) {
+      btr_defrag_pool_del(table->id);
+    }
+
     /* Remove stats for this table and all of its indexes from the
     persistent storage if it exists and if there are stats for this
     table in there. This function creates its own trx and commits
@@ -4664,10 +4669,21 @@ dberr_t row_scan_index_for_mysql(row_prebuilt_t *prebuilt, dict_index_t *index,
     return (DB_SUCCESS);
   }
 
+  /* Counting (!check_keys) may also run in parallel on secondary indexes;
+  the Parallel_reader falls back to a clustered index lookup when a
+  secondary index record cannot be trusted on its own (see
+  Parallel_reader::Scan_ctx::check_visibility()). Indexes on virtual
+  columns cannot be scanned by the reader, and CHECK TABLE keeps its
+  parallel path restricted to the clustered index. */
+  const bool parallel_capable_index =
+      index->is_clustered() ||
+      (!check_keys && !dict_index_has_virtual(index) &&
+       !dict_index_is_spatial(index) && (index->type & DICT_FTS) == 0);
+
   DBUG_EXECUTE_IF("ib_disable_parallel_read", goto skip_parallel_read;);
 
   if (prebuilt->trx->isolation_level > TRX_ISO_READ_UNCOMMITTED &&
-      prebuilt->select_lock_type == LOCK_NONE && index->is_clustered() &&
+      prebuilt->select_lock_type == LOCK_NONE && parallel_capable_index &&
       (check_keys || prebuilt->trx->mysql_n_tables_locked == 0) &&
       !prebuilt->ins_sel_stmt) {
 
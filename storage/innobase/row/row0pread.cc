@@ -369,17 +369,17 @@ bool Parallel_reader::Scan_ctx::check_visibility(const rec_t *&rec,
         }
       }
     } else {
-      /* Secondary index scan not supported yet. */
-      ut_error;
-
       auto max_trx_id = page_get_max_trx_id(page_align(rec));
 
       ut_ad(max_trx_id > 0);
 
-      if (!view->sees(max_trx_id)) {
-        /* FIXME: This is not sufficient. We may need to read in the cluster
-        index record to be 100% sure. */
-        return (false);
+      if (m_trx->isolation_level > TRX_ISO_READ_UNCOMMITTED &&
+          !view->sees(max_trx_id)) {
+        /* The page was modified by a transaction that the view may
+        not see. The secondary index record cannot be trusted on its
+        own and the visible version of the row has to be fetched from
+        the clustered index. */
+        return (check_visibility_sec(rec, offsets, heap, mtr));
       }
     }
   }
@@ -396,6 +396,82 @@ bool Parallel_reader::Scan_ctx::check_visibility(const rec_t *&rec,
   return (true);
 }
 
+bool Parallel_reader::Scan_ctx::check_visibility_sec(const rec_t *rec,
+                                                     const ulint *offsets,
+                                                     mem_heap_t *&heap,
+                                                     mtr_t *mtr) {
+  auto view = m_trx->read_view;
+  auto sec_index = m_config.m_index;
+  auto clust_index = sec_index->table->first_index();
+
+  ut_ad(!sec_index->is_clustered());
+  ut_ad(!dict_index_has_virtual(sec_index));
+  ut_ad(MVCC::is_view_active(view));
+
+  /* Look up the clustered index record that the secondary index
+  record points to. The clustered index leaf page is S-latched after
+  the secondary index leaf page, which is the latching order that
+  row_search_mvcc() uses as well. */
+
+  auto ref = row_build_row_ref(ROW_COPY_POINTERS, sec_index, rec, heap);
+
+  btr_pcur_t pcur;
+
+  pcur.open_no_init(clust_index, ref, PAGE_CUR_LE, BTR_SEARCH_LEAF, 0, mtr,
+                    __FILE__, __LINE__);
+
+  const rec_t *clust_rec = btr_pcur_get_rec(&pcur);
+
+  if (!page_rec_is_user_rec(clust_rec) ||
+      btr_pcur_get_low_match(&pcur) < dict_index_get_n_unique(clust_index)) {
+    /* The clustered index record was removed and the secondary index
+    record is an orphan waiting for purge: not visible. */
+    return (false);
+  }
+
+  ulint *clust_offsets =
+      rec_get_offsets(clust_rec, clust_index, nullptr, ULINT_UNDEFINED, &heap);
+
+  auto rec_trx_id = row_get_rec_trx_id(clust_rec, clust_index, clust_offsets);
+
+  const rec_t *version = clust_rec;
+
+  if (!view->changes_visible(rec_trx_id, sec_index->table->name)) {
+    rec_t *old_vers;
+
+    row_vers_build_for_consistent_read(clust_rec, mtr, clust_index,
+                                       &clust_offsets, view, &heap, heap,
+                                       &old_vers, nullptr, nullptr);
+
+    version = old_vers;
+
+    if (version == nullptr) {
+      return (false);
+    }
+  }
+
+  if (rec_get_deleted_flag(version, m_config.m_is_compact)) {
+    return (false);
+  }
+
+  /* The visible version of the row must produce exactly this
+  secondary index entry; otherwise the row is represented by a
+  different entry in this index and would be seen twice or not at
+  all. This mirrors what row_vers_old_has_index_entry() checks for
+  purge. */
+
+  auto ientry = row_rec_to_index_entry(rec, sec_index, offsets, heap);
+
+  row_ext_t *ext;
+
+  auto row = row_build(ROW_COPY_POINTERS, clust_index, version, clust_offsets,
+                       nullptr, nullptr, nullptr, &ext, heap);
+
+  auto entry = row_build_index_entry(row, ext, sec_index, heap);
+
+  return (entry != nullptr && dtuple_coll_eq(entry, ientry));
+}
+
 void Parallel_reader::Scan_ctx::copy_row(const rec_t *rec, Iter *iter) const {
   iter->m_offsets = rec_get_offsets(rec, m_config.m_index, nullptr,
                                     ULINT_UNDEFINED, &iter->m_heap);
@@ -576,6 +652,13 @@ dberr_t Parallel_reader::Ctx::traverse_recs(PCursor *pcursor, mtr_t *mtr) {
       }
     }
 
+    if (!skip && m_scan_ctx->m_config.m_filter &&
+        page_is_leaf(cur->block->frame)) {
+      /* Evaluate the pushed down filter in the worker thread so that
+      filtered out records never reach the row callback. */
+      skip = !m_scan_ctx->m_config.m_filter(rec, offsets, index);
+    }
+
     if (!skip) {
       m_rec = rec;
       m_block = cur->block;
@@ -1215,6 +1298,14 @@ dberr_t Parallel_reader::run() {
 dberr_t Parallel_reader::add_scan(trx_t *trx,
                                   const Parallel_reader::Config &config,
                                   Parallel_reader::F &&f) {
+  /* Secondary index scans rebuild the index entry from the visible
+  clustered index version when a page cannot be trusted, which is not
+  possible for indexes on virtual columns, and spatial indexes are not
+  organized for key range partitioning at all. */
+  ut_ad(config.m_index->is_clustered() ||
+        (!dict_index_has_virtual(config.m_index) &&
+         !dict_index_is_spatial(config.m_index)));
+
   // clang-format off
 
   auto scan_ctx = std::shared_ptr<Scan_ctx>(
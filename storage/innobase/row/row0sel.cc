@@ -4404,6 +4404,128 @@ static row_to_range_relation_t row_compare_row_to_range(
   return (row_to_range_relation);
 }
 
+/** Tries to open the search cursor on the leaf page that the previous
+search in the same table handle landed on, instead of descending the whole
+B-tree. Used for batched key lookups (BKA, MRR), where the keys arrive in
+sorted order and consecutive keys usually belong to the same leaf page. The
+cached block is validated with the buffer pool withdraw clock and the page
+modify clock, so a stale guess is simply rejected.
+@param[in,out]	prebuilt	prebuilt struct holding the cached position
+@param[in]	index		index to search
+@param[in]	tuple		search tuple
+@param[in]	mode		search mode, PAGE_CUR_L, ..., PAGE_CUR_GE
+@param[in,out]	pcur		persistent cursor to position
+@param[in,out]	mtr		mini-transaction
+@return true if pcur was positioned exactly as a full search would have
+positioned it, holding an S-latch on the leaf page */
+static bool row_sel_open_pcur_from_cache(row_prebuilt_t *prebuilt,
+                                         dict_index_t *index,
+                                         const dtuple_t *tuple,
+                                         page_cur_mode_t mode, btr_pcur_t *pcur,
+                                         mtr_t *mtr) {
+  buf_block_t *block = prebuilt->m_search_block;
+
+  if (block == nullptr || prebuilt->m_search_index != index ||
+      pcur->m_read_level != 0) {
+    return (false);
+  }
+
+  if (buf_pool_is_obsolete(prebuilt->m_search_withdraw_clock)) {
+    /* The buffer pool has been resized; the block may have been
+    withdrawn and may not even be dereferenced. */
+    prebuilt->m_search_block = nullptr;
+
+    return (false);
+  }
+
+  if (!buf_page_optimistic_get(RW_S_LATCH, block,
+                               prebuilt->m_search_modify_clock,
+                               Page_fetch::NORMAL, __FILE__, __LINE__, mtr)) {
+    prebuilt->m_search_block = nullptr;
+
+    return (false);
+  }
+
+  /* An unchanged modify clock guarantees that the block still contains
+  the same leaf page of this index, with the same records. */
+  ut_ad(btr_page_get_index_id(buf_block_get_frame(block)) == index->id);
+  ut_ad(page_is_leaf(buf_block_get_frame(block)));
+
+  page_cur_t *page_cursor = btr_pcur_get_page_cur(pcur);
+  ulint up_match = 0;
+  ulint low_match = 0;
+
+  page_cur_search_with_match(block, index, tuple, mode, &up_match, &low_match,
+                             page_cursor, nullptr);
+
+  /* The position is correct within the page; check that it is also
+  correct within the whole tree, the same way btr_search_check_guess()
+  does for the adaptive hash index. If the cursor sits on the page
+  boundary, the right position could be on a neighboring page. */
+
+  const rec_t *rec = page_cur_get_rec(page_cursor);
+  const page_t *page = buf_block_get_frame(block);
+  bool success;
+
+  if (mode == PAGE_CUR_L || mode == PAGE_CUR_LE) {
+    if (page_rec_is_infimum(rec)) {
+      success = btr_page_get_prev(page, mtr) == FIL_NULL;
+    } else if (page_rec_is_supremum(page_rec_get_next_const(rec))) {
+      success = btr_page_get_next(page, mtr) == FIL_NULL;
+    } else {
+      success = true;
+    }
+  } else {
+    if (page_rec_is_supremum(rec)) {
+      success = btr_page_get_next(page, mtr) == FIL_NULL;
+    } else if (page_rec_is_infimum(page_rec_get_prev_const(rec))) {
+      success = btr_page_get_prev(page, mtr) == FIL_NULL;
+    } else {
+      success = true;
+    }
+  }
+
+  if (!success) {
+    btr_leaf_page_release(block, BTR_SEARCH_LEAF, mtr);
+
+    prebuilt->m_search_block = nullptr;
+
+    return (false);
+  }
+
+  btr_cur_t *cursor = btr_pcur_get_btr_cur(pcur);
+
+  cursor->index = index;
+  cursor->low_match = low_match;
+  cursor->up_match = up_match;
+  cursor->flag = BTR_CUR_BINARY;
+
+  pcur->m_latch_mode = BTR_SEARCH_LEAF;
+  pcur->m_search_mode = mode;
+  pcur->m_pos_state = BTR_PCUR_IS_POSITIONED;
+  pcur->m_old_stored = false;
+  pcur->m_trx_if_known = nullptr;
+
+  return (true);
+}
+
+/** Caches the leaf page that a search positioned its cursor on, as a
+guess for the next search in the same table handle. Must be called while
+the page is still latched.
+@param[in,out]	prebuilt	prebuilt struct to store the position in
+@param[in]	index		index that was searched
+@param[in]	pcur		positioned persistent cursor */
+static void row_sel_cache_pcur_position(row_prebuilt_t *prebuilt,
+                                        const dict_index_t *index,
+                                        btr_pcur_t *pcur) {
+  buf_block_t *block = btr_pcur_get_block(pcur);
+
+  prebuilt->m_search_block = block;
+  prebuilt->m_search_modify_clock = buf_block_get_modify_clock(block);
+  prebuilt->m_search_withdraw_clock = buf_withdraw_clock;
+  prebuilt->m_search_index = index;
+}
+
 /** Searches for rows in the database using cursor.
 Function is mainly used for tables that are shared accorss connection and
 so it employs technique that can help re-construct the rows that
@@ -4891,11 +5013,19 @@ dberr_t row_search_mvcc(byte *buf, page_cur_mode_t mode,
       }
     }
 
-    btr_pcur_open_with_no_init(index, search_tuple, mode, BTR_SEARCH_LEAF, pcur,
-                               0, &mtr);
+    if (dict_index_is_spatial(index) ||
+        !row_sel_open_pcur_from_cache(prebuilt, index, search_tuple, mode, pcur,
+                                      &mtr)) {
+      btr_pcur_open_with_no_init(index, search_tuple, mode, BTR_SEARCH_LEAF,
+                                 pcur, 0, &mtr);
+    }
 
     pcur->m_trx_if_known = trx;
 
+    if (!dict_index_is_spatial(index)) {
+      row_sel_cache_pcur_position(prebuilt, index, pcur);
+    }
+
     rec = btr_pcur_get_rec(pcur);
 
     if (!moves_up && !page_rec_is_supremum(rec) && set_also_gap_locks &&
@@ -5097,7 +5227,21 @@ rec_loop:
   ut_ad(fil_page_index_page_check(btr_pcur_get_page(pcur)));
   ut_ad(btr_page_get_index_id(btr_pcur_get_page(pcur)) == index->id);
 
-  offsets = rec_get_offsets(rec, index, offsets, ULINT_UNDEFINED, &heap);
+  {
+    ulint n_offs_fields = ULINT_UNDEFINED;
+
+    if (prebuilt->n_rec_fields_hint > 0 && index == clust_index &&
+        prebuilt->select_lock_type == LOCK_NONE && !prebuilt->idx_cond &&
+        !prebuilt->innodb_api && srv_force_recovery == 0) {
+      /* A non-locking read which only needs the leading
+      fields of the record: skip parsing the lengths of the
+      rest. If an old version of the record must be built,
+      the offsets of all fields are recomputed below. */
+      n_offs_fields = prebuilt->n_rec_fields_hint;
+    }
+
+    offsets = rec_get_offsets(rec, index, offsets, n_offs_fields, &heap);
+  }
 
   if (UNIV_UNLIKELY(srv_force_recovery > 0)) {
     if (!rec_validate(rec, offsets) ||
@@ -5327,6 +5471,15 @@ rec_loop:
           !lock_clust_rec_cons_read_sees(rec, index, offsets,
                                          trx_get_read_view(trx))) {
         rec_t *old_vers;
+
+        if (rec_offs_n_fields(offsets) < dict_index_get_n_fields(index)) {
+          /* The offsets were computed for a prefix of the
+          fields only; building the old version needs them
+          all. */
+          offsets =
+              rec_get_offsets(rec, index, offsets, ULINT_UNDEFINED, &heap);
+        }
+
         /* The following call returns 'offsets' associated with 'old_vers' */
         err = row_sel_build_prev_vers_for_mysql(
             trx->read_view, clust_index, prebuilt, rec, &offsets, &heap,
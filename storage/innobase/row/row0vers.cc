@@ -1301,9 +1301,16 @@ dberr_t row_vers_build_for_consistent_read(
     /* If purge can't see the record then we can't rely on
     the UNDO log record. */
 
-    bool purge_sees =
-        trx_undo_prev_version_build(rec, mtr, version, index, *offsets, heap,
-                                    &prev_version, nullptr, vrow, 0, lob_undo);
+    /* Once the walk has gone past the newest version, the chain is
+    likely long (an old view reading a hot row), so ask for the undo
+    page of each next older version to be read in the background while
+    the current one is built. Not done for the first step: most builds
+    stop after one version, and the prefetched page would go unused. */
+    ulint v_status = (version == rec) ? 0 : TRX_UNDO_PREFETCH_OLDER;
+
+    bool purge_sees = trx_undo_prev_version_build(
+        rec, mtr, version, index, *offsets, heap, &prev_version, nullptr, vrow,
+        v_status, lob_undo);
 
     err = (purge_sees) ? DB_SUCCESS : DB_MISSING_HISTORY;
 
@@ -374,6 +374,10 @@ static monitor_info_t innodb_counter_info[] = {
      "Number of pages targeted by LSN Age for flushing.", MONITOR_NONE,
      MONITOR_DEFAULT_START, MONITOR_FLUSH_N_TO_FLUSH_BY_AGE},
 
+    {"buffer_flush_n_to_flush_by_redo_rate", "buffer",
+     "Number of pages targeted after adjusting for redo rate change.",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_FLUSH_N_TO_FLUSH_BY_REDO_RATE},
+
     {"buffer_flush_adaptive_avg_time_slot", "buffer",
      "Avg time (ms) spent for adaptive flushing recently per slot.",
      MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_FLUSH_ADAPTIVE_AVG_TIME_SLOT},
@@ -431,6 +435,10 @@ static monitor_info_t innodb_counter_info[] = {
     {"buffer_flush_lsn_avg_rate", "buffer", "Average redo generation rate",
      MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_FLUSH_LSN_AVG_RATE},
 
+    {"buffer_flush_lsn_iter_rate", "buffer",
+     "Redo generation rate in the last page cleaner iteration", MONITOR_NONE,
+     MONITOR_DEFAULT_START, MONITOR_FLUSH_LSN_ITER_RATE},
+
     {"buffer_flush_pct_for_dirty", "buffer",
      "Percent of IO capacity used to avoid max dirty page limit", MONITOR_NONE,
      MONITOR_DEFAULT_START, MONITOR_FLUSH_PCT_FOR_DIRTY},
@@ -934,6 +942,17 @@ static monitor_info_t innodb_counter_info[] = {
      "Average redo flushing rate (during last innodb_flushing_avg_loops)",
      MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_LOG_FLUSH_LSN_AVG_RATE},
 
+    {"log_flush_coalesce_waits", "log",
+     "Number of times the log flusher held a pending fsync to coalesce "
+     "more commits into it (innodb_log_flush_coalesce_max_time)",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_LOG_FLUSH_COALESCE_WAITS},
+
+    {"log_flush_coalesce_total_time", "log",
+     "Total time the log flusher spent holding pending fsyncs to coalesce "
+     "commits (microseconds)",
+     MONITOR_NONE, MONITOR_DEFAULT_START,
+     MONITOR_LOG_FLUSH_COALESCE_TOTAL_TIME},
+
     {"log_full_block_writes", "log",
      "Number of log writes for full (completed) log blocks", MONITOR_NONE,
      MONITOR_DEFAULT_START, MONITOR_LOG_FULL_BLOCK_WRITES},
@@ -1070,6 +1089,15 @@ static monitor_info_t innodb_counter_info[] = {
     {"index_page_discards", "index", "Number of index pages discarded",
      MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_INDEX_DISCARD},
 
+    {"index_defrag_pages_scanned", "index",
+     "Number of leaf pages inspected by the background defragmenter",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_INDEX_DEFRAG_PAGES_SCANNED},
+
+    {"index_defrag_merge_successful", "index",
+     "Number of page merges performed by the background defragmenter",
+     MONITOR_NONE, MONITOR_DEFAULT_START,
+     MONITOR_INDEX_DEFRAG_MERGE_SUCCESSFUL},
+
     /* ========== Counters for Adaptive Hash Index ========== */
     {"module_adaptive_hash", "adaptive_hash_index", "Adpative Hash Index",
      MONITOR_MODULE, MONITOR_DEFAULT_START, MONITOR_MODULE_ADAPTIVE_HASH},
@@ -1423,6 +1451,24 @@ static monitor_info_t innodb_counter_info[] = {
     {"dblwr_flush_wait_events", "dblwr", "Total flush wait events",
      MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_DBLWR_FLUSH_WAIT_EVENTS},
 
+    /* ========== Counters for Fulltext index cache sync ========== */
+    {"module_fts", "fts", "Fulltext index cache sync counters", MONITOR_NONE,
+     MONITOR_DEFAULT_START, MONITOR_MODULE_FTS},
+
+    {"fts_sync_total", "fts", "Number of full cache syncs completed",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_FTS_SYNC_TOTAL},
+
+    {"fts_spill_total", "fts", "Number of incremental cache spills completed",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_FTS_SPILL_TOTAL},
+
+    {"fts_sync_write_usec", "fts",
+     "Time (in microseconds) spent writing cache nodes during sync",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_FTS_SYNC_WRITE_MICROSECOND},
+
+    {"fts_sync_commit_usec", "fts",
+     "Time (in microseconds) spent committing a sync or spill", MONITOR_NONE,
+     MONITOR_DEFAULT_START, MONITOR_FTS_SYNC_COMMIT_MICROSECOND},
+
     /* ========== To turn on/off reset all counters ========== */
     {"all", "All Counters", "Turn on/off and reset all counters",
      MONITOR_MODULE, MONITOR_DEFAULT_START, MONITOR_ALL_COUNTER},
@@ -190,6 +190,10 @@ bool srv_read_only_mode;
 dictionary tables are in the system tablespace 0 */
 bool srv_file_per_table;
 
+/** Number of fil_system shards for tablespaces other than the undo and
+redo logs; the undo and redo shards come on top of this count */
+ulong srv_fil_shards = 58;
+
 /** Sort buffer size in index creation */
 ulong srv_sort_buf_size = 1048576;
 /** Maximum modification log file size for online index creation */
@@ -206,8 +210,35 @@ OS (provided we compiled Innobase with it in), otherwise we will
 use simulated aio we build below with threads. */
 bool srv_use_native_aio = false;
 
+/** If this flag is true and the server was built with liburing, native
+AIO requests on Linux are submitted through io_uring instead of
+io_submit(). */
+bool srv_use_io_uring = false;
+
+/** If this flag is true, the io_uring instances are created with kernel
+side submission queue polling (IORING_SETUP_SQPOLL), removing the
+submission syscall from the IO path. Ignored unless srv_use_io_uring is
+set; cleared at startup if the kernel does not support it. */
+bool srv_io_uring_sqpoll = false;
+
+/** If this flag is false, writes of transparently compressed pages skip
+the trailing punch hole syscall; the compressed payload is still written
+but the page keeps its full on-disk allocation. */
+bool srv_punch_hole_writes = true;
+
 bool srv_numa_interleave = false;
 
+/** If this flag is true, each buffer pool instance is bound to its own
+NUMA node, distributing the instances round-robin over the configured
+nodes, instead of interleaving every chunk over all nodes. */
+bool srv_numa_node_bind = false;
+
+/** If this flag is true, buffer pool chunks are advised with
+MADV_HUGEPAGE at allocation so the kernel can back them with transparent
+huge pages. Chunks the kernel cannot back stay on regular pages. Ignored
+when innodb_use_large_pages reserves explicit hugetlbfs pages. */
+bool srv_buf_pool_madvise_huge = false;
+
 #ifdef UNIV_DEBUG
 /** Force all user tables to use page compression. */
 ulong srv_debug_compress;
@@ -323,6 +354,13 @@ ulong srv_log_flusher_spin_delay = INNODB_LOG_FLUSHER_SPIN_DELAY_DEFAULT;
 /** Initial timeout used to wait on flusher_event. */
 ulong srv_log_flusher_timeout = INNODB_LOG_FLUSHER_TIMEOUT_DEFAULT;
 
+/** Maximum time for which the log flusher thread may hold a pending
+fsync to coalesce more commits into it (microseconds). The effective
+window is additionally capped by the average fsync time, so the flush
+rate is never throttled below what the device can sustain. 0 disables
+the coalescing. */
+ulong srv_log_flush_coalesce_max_time = 0;
+
 /** Number of spin iterations, for which log write notifier thread is waiting
 for advanced flushed_to_disk_lsn without sleeping. */
 ulong srv_log_write_notifier_spin_delay =
@@ -547,6 +585,12 @@ bool srv_stats_include_delete_marked = FALSE;
 unsigned long long srv_stats_persistent_sample_pages = 20;
 bool srv_stats_auto_recalc = TRUE;
 
+/* if TRUE, the automatic recalculation of persistent statistics
+refreshes them incrementally from the current index sizes instead of
+re-sampling the whole index; a full re-sampling is still forced
+periodically and by ANALYZE TABLE */
+bool srv_stats_incremental = FALSE;
+
 ulong srv_replication_delay = 0;
 
 /*-------------------------------------------*/
@@ -757,6 +801,14 @@ and/or load it during startup. */
 bool srv_buffer_pool_dump_at_shutdown = true;
 bool srv_buffer_pool_load_at_startup = true;
 
+/** Enable automatic adaptation of the LRU old sublist length to the
+workload, shrinking it during scan phases; see buf_LRU_adapt_old_ratio(). */
+bool srv_adaptive_old_blocks = false;
+
+/** Number of worker threads used to load the buffer pool from the dump
+file, each driving background reads for its own range of the dump. */
+ulong srv_buf_pool_load_threads = 4;
+
 /** Slot index in the srv_sys->sys_threads array for the purge thread. */
 static const ulint SRV_PURGE_SLOT = 1;
 
@@ -1397,6 +1449,11 @@ bool srv_printf_innodb_monitor(FILE *file, bool nowait, ulint *trx_start_pos,
     rw_lock_s_lock(btr_search_latches[i]);
     ha_print_info(file, btr_search_sys->hash_tables[i]);
     rw_lock_s_unlock(btr_search_latches[i]);
+
+    fprintf(file,
+            "Hash partition %lu: " UINT64PF " hits, " UINT64PF " misses\n",
+            (ulong)i, btr_search_part_stats[i].n_hits,
+            btr_search_part_stats[i].n_misses);
   }
 
   fprintf(file, "%.2f hash searches/s, %.2f non-hash searches/s\n",
@@ -55,6 +55,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 
 #include "btr0btr.h"
 #include "btr0cur.h"
+#include "btr0defrag.h"
 #include "buf0buf.h"
 #include "buf0dump.h"
 #include "current_thd.h"
@@ -1719,6 +1720,14 @@ void srv_shutdown_exit_threads() {
       os_event_set(dict_stats_event);
     }
 
+    if (srv_thread_is_active(srv_threads.m_btr_defrag)) {
+      os_event_set(btr_defrag_event);
+    }
+
+    if (srv_thread_is_active(srv_threads.m_fil_extend)) {
+      os_event_set(fil_extend_event);
+    }
+
     /* Try to stop archiver threads. */
     arch_wake_threads();
 
@@ -3015,6 +3024,22 @@ void srv_start_threads(bool bootstrap) {
 
   srv_threads.m_dict_stats.start();
 
+  /* Create the B-tree defragmentation thread */
+  srv_threads.m_btr_defrag =
+      os_thread_create(btr_defrag_thread_key, btr_defrag_thread);
+
+  btr_defrag_thread_init();
+
+  srv_threads.m_btr_defrag.start();
+
+  /* Create the background tablespace extend thread */
+  srv_threads.m_fil_extend =
+      os_thread_create(fil_extend_thread_key, fil_extend_thread);
+
+  fil_extend_thread_init();
+
+  srv_threads.m_fil_extend.start();
+
   /* Create the thread that will optimize the FTS sub-system. */
   fts_optimize_init();
 
@@ -3149,6 +3174,8 @@ void srv_pre_dd_shutdown() {
     /* Check the goal of SRV_SHUTDOWN_PRE_DD_AND_SYSTEM_TRANSACTIONS,
     the following threads should not be started in read-only mode: */
     ut_a(!srv_thread_is_active(srv_threads.m_dict_stats));
+    ut_a(!srv_thread_is_active(srv_threads.m_btr_defrag));
+    ut_a(!srv_thread_is_active(srv_threads.m_fil_extend));
     ut_a(!srv_thread_is_active(srv_threads.m_fts_optimize));
     ut_a(!srv_thread_is_active(srv_threads.m_ts_alter_encrypt));
 
@@ -3196,10 +3223,16 @@ void srv_pre_dd_shutdown() {
   if (srv_start_state_is_set(SRV_START_STATE_STAT)) {
     fts_optimize_shutdown();
     dict_stats_shutdown();
+    btr_defrag_shutdown();
+    fil_extend_shutdown();
     dict_stats_thread_deinit();
+    btr_defrag_thread_deinit();
+    fil_extend_thread_deinit();
   }
   ut_a(!srv_thread_is_active(srv_threads.m_fts_optimize));
   ut_a(!srv_thread_is_active(srv_threads.m_dict_stats));
+  ut_a(!srv_thread_is_active(srv_threads.m_btr_defrag));
+  ut_a(!srv_thread_is_active(srv_threads.m_fil_extend));
 
   for (uint32_t count = 1; srv_thread_is_active(srv_threads.m_ts_alter_encrypt);
        ++count) {
@@ -3531,7 +3564,9 @@ void srv_shutdown() {
       std::cref(srv_threads.m_ts_alter_encrypt),
       std::cref(srv_threads.m_fts_optimize),
       std::cref(srv_threads.m_recv_writer),
-      std::cref(srv_threads.m_dict_stats)};
+      std::cref(srv_threads.m_dict_stats),
+      std::cref(srv_threads.m_btr_defrag),
+      std::cref(srv_threads.m_fil_extend)};
 
   for (const auto &thread : threads_stopped_before_shutdown) {
     ut_a(!srv_thread_is_active(thread));
@@ -1220,6 +1220,9 @@ static void sync_latch_meta_init() UNIV_NOTHROW {
 
   LATCH_ADD_MUTEX(AUTOINC, SYNC_DICT_AUTOINC_MUTEX, autoinc_mutex_key);
 
+  LATCH_ADD_MUTEX(BTR_DEFRAG_POOL, SYNC_NO_ORDER_CHECK,
+                  btr_defrag_pool_mutex_key);
+
 #ifdef PFS_SKIP_BUFFER_MUTEX_RWLOCK
   LATCH_ADD_MUTEX(BUF_BLOCK_MUTEX, SYNC_BUF_BLOCK, PFS_NOT_INSTRUMENTED);
 #else
@@ -1260,8 +1263,14 @@ static void sync_latch_meta_init() UNIV_NOTHROW {
 
   LATCH_ADD_MUTEX(DICT_TABLE, SYNC_TABLE, dict_table_mutex_key);
 
+  LATCH_ADD_MUTEX(DICT_TABLE_CACHE, SYNC_NO_ORDER_CHECK,
+                  dict_table_cache_mutex_key);
+
   LATCH_ADD_MUTEX(PARSER, SYNC_PARSER, parser_mutex_key);
 
+  LATCH_ADD_MUTEX(FIL_EXTEND_POOL, SYNC_NO_ORDER_CHECK,
+                  fil_extend_pool_mutex_key);
+
   LATCH_ADD_MUTEX(FIL_SHARD, SYNC_FIL_SHARD, fil_system_mutex_key);
 
   LATCH_ADD_MUTEX(FLUSH_LIST, SYNC_BUF_FLUSH_LIST, flush_list_mutex_key);
@@ -1318,14 +1327,22 @@ static void sync_latch_meta_init() UNIV_NOTHROW {
 
   LATCH_ADD_MUTEX(PAGE_CLEANER, SYNC_PAGE_CLEANER, page_cleaner_mutex_key);
 
+  LATCH_ADD_MUTEX(MVCC_SNAPSHOT, SYNC_NO_ORDER_CHECK,
+                  mvcc_snapshot_mutex_key);
+
   LATCH_ADD_MUTEX(PURGE_SYS_PQ, SYNC_PURGE_QUEUE, purge_sys_pq_mutex_key);
 
+  LATCH_ADD_MUTEX(PURGE_SYS_STATS, SYNC_NO_ORDER_CHECK,
+                  purge_sys_stats_mutex_key);
+
   LATCH_ADD_MUTEX(RECALC_POOL, SYNC_STATS_AUTO_RECALC, recalc_pool_mutex_key);
 
   LATCH_ADD_MUTEX(RECV_SYS, SYNC_RECV, recv_sys_mutex_key);
 
   LATCH_ADD_MUTEX(RECV_WRITER, SYNC_RECV_WRITER, recv_writer_mutex_key);
 
+  LATCH_ADD_MUTEX(ROW_MERGE_DUP, SYNC_NO_ORDER_CHECK, row_merge_dup_mutex_key);
+
   LATCH_ADD_MUTEX(TEMP_SPACE_RSEG, SYNC_TEMP_SPACE_RSEG,
                   temp_space_rseg_mutex_key);
 
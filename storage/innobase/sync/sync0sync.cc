@@ -66,7 +66,9 @@ mysql_pfs_key_t dict_foreign_err_mutex_key;
 mysql_pfs_key_t dict_persist_dirty_tables_mutex_key;
 mysql_pfs_key_t dict_sys_mutex_key;
 mysql_pfs_key_t dict_table_mutex_key;
+mysql_pfs_key_t dict_table_cache_mutex_key;
 mysql_pfs_key_t parser_mutex_key;
+mysql_pfs_key_t fil_extend_pool_mutex_key;
 mysql_pfs_key_t fil_system_mutex_key;
 mysql_pfs_key_t flush_list_mutex_key;
 mysql_pfs_key_t fts_bg_threads_mutex_key;
@@ -93,11 +95,15 @@ mysql_pfs_key_t page_sys_arch_mutex_key;
 mysql_pfs_key_t page_sys_arch_oper_mutex_key;
 mysql_pfs_key_t page_sys_arch_client_mutex_key;
 mysql_pfs_key_t mutex_list_mutex_key;
+mysql_pfs_key_t btr_defrag_pool_mutex_key;
 mysql_pfs_key_t recalc_pool_mutex_key;
 mysql_pfs_key_t page_cleaner_mutex_key;
+mysql_pfs_key_t mvcc_snapshot_mutex_key;
 mysql_pfs_key_t purge_sys_pq_mutex_key;
+mysql_pfs_key_t purge_sys_stats_mutex_key;
 mysql_pfs_key_t recv_sys_mutex_key;
 mysql_pfs_key_t recv_writer_mutex_key;
+mysql_pfs_key_t row_merge_dup_mutex_key;
 mysql_pfs_key_t temp_space_rseg_mutex_key;
 mysql_pfs_key_t undo_space_rseg_mutex_key;
 mysql_pfs_key_t trx_sys_rseg_mutex_key;
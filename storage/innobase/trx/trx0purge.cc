@@ -74,6 +74,18 @@ trx_purge_t *purge_sys = nullptr;
 /** Wait for a short delay between checks. */
 static constexpr int64_t PURGE_CHECK_UNDO_TRUNCATE_DELAY_IN_MS = 1000;
 
+/** Maximum number of tables for which the purge system keeps per-table
+statistics. When exceeded, the entries of tables with no records in the
+current batch are evicted. */
+static constexpr size_t TRX_PURGE_TABLE_STATS_MAX = 10000;
+
+/** Maximum number of history logs removed in one invocation of
+trx_purge_truncate_history(). Bounding the work keeps the purge
+coordinator responsive when the history list is long; if the budget is
+exhausted, the truncation continues right after the next purge batch
+instead of waiting for the regular truncation interval. */
+static constexpr ulint TRX_PURGE_TRUNCATE_BUDGET = 4096;
+
 #ifdef UNIV_DEBUG
 bool srv_purge_view_update_only_debug;
 #endif /* UNIV_DEBUG */
@@ -223,6 +235,10 @@ void trx_purge_sys_create(ulint n_purge_threads, purge_pq_t *purge_queue) {
 
   mutex_create(LATCH_ID_PURGE_SYS_PQ, &purge_sys->pq_mutex);
 
+  new (&purge_sys->table_stats) trx_purge_t::Table_stats();
+
+  mutex_create(LATCH_ID_PURGE_SYS_STATS, &purge_sys->stats_mutex);
+
   ut_a(n_purge_threads > 0);
 
   purge_sys->sess = sess_open();
@@ -270,6 +286,9 @@ void trx_purge_sys_close() {
 
   rw_lock_free(&purge_sys->latch);
   mutex_free(&purge_sys->pq_mutex);
+  mutex_free(&purge_sys->stats_mutex);
+
+  call_destructor(&purge_sys->table_stats);
 
   if (purge_sys->purge_queue != nullptr) {
     UT_DELETE(purge_sys->purge_queue);
@@ -482,10 +501,18 @@ static void trx_purge_free_segment(trx_rseg_t *rseg, fil_addr_t hdr_addr,
   mtr_commit(&mtr);
 }
 
-/** Removes unnecessary history data from a rollback segment. */
-static void trx_purge_truncate_rseg_history(
+/** Removes unnecessary history data from a rollback segment. The work is
+bounded by the budget, so that a long history list does not stall purge
+batches; the caller re-invokes the truncation on the following batches
+until it is complete.
+@return true if the history was truncated up to the limit, false if the
+budget was exhausted and there is more history to remove */
+static bool trx_purge_truncate_rseg_history(
     trx_rseg_t *rseg,          /*!< in: rollback segment */
-    const purge_iter_t *limit) /*!< in: truncate offset */
+    const purge_iter_t *limit, /*!< in: truncate offset */
+    ulint *budget)             /*!< in/out: maximum number of history
+                               logs to remove; decremented for each
+                               log removed */
 {
   fil_addr_t hdr_addr;
   fil_addr_t prev_hdr_addr;
@@ -515,7 +542,16 @@ loop:
     rseg->unlatch();
     mtr_commit(&mtr);
 
-    return;
+    return (true);
+  }
+
+  if (*budget == 0) {
+    /* The budget for this invocation is used up. Stop here and
+    continue from the history list end on the next invocation. */
+    rseg->unlatch();
+    mtr_commit(&mtr);
+
+    return (false);
   }
 
   undo_page = trx_undo_page_get(page_id_t(rseg->space_id, hdr_addr.page),
@@ -538,7 +574,7 @@ loop:
     rseg->unlatch();
     mtr_commit(&mtr);
 
-    return;
+    return (true);
   }
 
   prev_hdr_addr = trx_purge_get_log_from_hist(
@@ -566,6 +602,8 @@ loop:
     mtr_commit(&mtr);
   }
 
+  --*budget;
+
   mtr_start(&mtr);
 
   if (is_temp) {
@@ -1604,6 +1642,13 @@ static void trx_purge_truncate_history(
   some time and we do not want an undo DDL to attempt an x_lock during
   this time.  If it did, all other transactions seeking a short s_lock()
   would line up behind it.  So get the ddl_mutex before this s_lock(). */
+  /* Bound the history logs removed in this invocation, so that purge
+  batches keep getting dispatched while a long history list is being
+  truncated. If the budget runs out, truncate_more makes the coordinator
+  continue the truncation right after the next batch. */
+  ulint budget = TRX_PURGE_TRUNCATE_BUDGET;
+  bool all_done = true;
+
   mutex_enter(&undo::ddl_mutex);
   undo::spaces->s_lock();
   for (auto undo_space : undo::spaces->m_spaces) {
@@ -1619,7 +1664,8 @@ static void trx_purge_truncate_history(
     undo_space->rsegs()->s_lock();
 
     for (auto rseg : *undo_space->rsegs()) {
-      trx_purge_truncate_rseg_history(rseg, limit);
+      all_done =
+          trx_purge_truncate_rseg_history(rseg, limit, &budget) && all_done;
     }
     undo_space->rsegs()->s_unlock();
   }
@@ -1632,17 +1678,21 @@ static void trx_purge_truncate_history(
   may be sorted when added to. */
   trx_sys->rsegs.s_lock();
   for (auto rseg : trx_sys->rsegs) {
-    trx_purge_truncate_rseg_history(rseg, limit);
+    all_done =
+        trx_purge_truncate_rseg_history(rseg, limit, &budget) && all_done;
   }
   trx_sys->rsegs.s_unlock();
 
   /* Purge rollback segments in the temporary tablespace. */
   trx_sys->tmp_rsegs.s_lock();
   for (auto rseg : trx_sys->tmp_rsegs) {
-    trx_purge_truncate_rseg_history(rseg, limit);
+    all_done =
+        trx_purge_truncate_rseg_history(rseg, limit, &budget) && all_done;
   }
   trx_sys->tmp_rsegs.s_unlock();
 
+  purge_sys->truncate_more = !all_done;
+
   auto &undo_trunc = purge_sys->undo_trunc;
 
   MONITOR_INC_TIME_IN_MICRO_SECS(MONITOR_PURGE_TRUNCATE_HISTORY_MICROSECOND,
@@ -2137,6 +2187,41 @@ static ulint trx_purge_attach_undo_recs(const ulint n_purge_threads,
     }
   }
 
+  /* Refresh the per-table statistics exposed through
+  INFORMATION_SCHEMA.INNODB_PURGE_BACKLOG. The records of the previous
+  batch have all been handled by the time a new batch is formed, so the
+  pending counts of tables absent from this batch drop to zero. */
+  mutex_enter(&purge_sys->stats_mutex);
+
+  for (auto &stat : purge_sys->table_stats) {
+    stat.second.pending_recs = 0;
+  }
+
+  for (GroupBy::const_iterator it = group_by.cbegin(); it != group_by.cend();
+       ++it) {
+    const uint64_t n_recs = it->second->size();
+
+    trx_purge_t::table_stats_t &stats = purge_sys->table_stats[it->first];
+
+    stats.pending_recs = n_recs;
+    stats.dispatched_recs += n_recs;
+  }
+
+  /* Bound the memory used for tables which have been dropped or have
+  gone idle; their cumulative counts are forgotten. */
+  if (purge_sys->table_stats.size() > TRX_PURGE_TABLE_STATS_MAX) {
+    for (auto it = purge_sys->table_stats.begin();
+         it != purge_sys->table_stats.end();) {
+      if (it->second.pending_recs == 0) {
+        it = purge_sys->table_stats.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  mutex_exit(&purge_sys->stats_mutex);
+
   /* Objective is to ensure that all the table entries in one
   batch are handled by the same thread. Ths is to avoid contention
   on the dict_index_t::lock */
@@ -2350,7 +2435,7 @@ ulint trx_purge(ulint n_purge_threads, /*!< in: number of purge tasks
   we rely on purge history length. So truncate the
   undo logs during upgrade to update purge history
   length. */
-  if (truncate || srv_upgrade_old_undo_found) {
+  if (truncate || purge_sys->truncate_more || srv_upgrade_old_undo_found) {
     trx_purge_truncate();
   }
 
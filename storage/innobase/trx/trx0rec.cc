@@ -39,6 +39,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "mtr0log.h"
 #include "trx0undo.h"
 #ifndef UNIV_HOTBACKUP
+#include "buf0rea.h"
 #include "dict0dict.h"
 #include "fsp0sysspace.h"
 #include "lob0index.h"
@@ -2455,6 +2456,42 @@ static MY_ATTRIBUTE((warn_unused_result)) bool trx_undo_get_undo_rec(
 #define ATTRIB_USED_ONLY_IN_DEBUG MY_ATTRIBUTE((unused))
 #endif /* UNIV_DEBUG */
 
+/** Starts a background read of the undo page holding the undo record of
+the next older version of a record. Called as soon as the roll pointer to
+the older version is known, while the current version is still being
+built, so that a version chain walk does not pay a full synchronous page
+read per version.
+@param[in]	roll_ptr	roll pointer to the older undo record
+@param[in]	is_temp		true if temporary, no-redo rseg. */
+static void trx_undo_prefetch_older_version(roll_ptr_t roll_ptr,
+                                            bool is_temp) {
+  ulint rseg_id;
+  space_id_t space_id;
+  page_no_t page_no;
+  ulint offset;
+  ibool is_insert;
+
+  if (trx_undo_roll_ptr_is_insert(roll_ptr)) {
+    /* The older version is the first inserted version: it has no
+    undo record to fetch. */
+    return;
+  }
+
+  trx_undo_decode_roll_ptr(roll_ptr, &is_insert, &rseg_id, &page_no, &offset);
+  space_id = trx_rseg_id_to_space_id(rseg_id, is_temp);
+
+  bool found;
+  const page_size_t &page_size = fil_space_get_page_size(space_id, &found);
+  if (!found) {
+    return;
+  }
+
+  if (buf_read_page_background(page_id_t(space_id, page_no), page_size,
+                               false)) {
+    os_aio_simulated_wake_handler_threads();
+  }
+}
+
 bool trx_undo_prev_version_build(
     const rec_t *index_rec ATTRIB_USED_ONLY_IN_DEBUG,
     mtr_t *index_mtr ATTRIB_USED_ONLY_IN_DEBUG, const rec_t *rec,
@@ -2526,6 +2563,13 @@ bool trx_undo_prev_version_build(
 
   ptr = trx_undo_update_rec_get_sys_cols(ptr, &trx_id, &roll_ptr, &info_bits);
 
+  if (v_status & TRX_UNDO_PREFETCH_OLDER) {
+    /* The roll pointer to the next older version is now known; read its
+    undo page in the background while the rest of this version is being
+    built, in case the caller has to walk further back. */
+    trx_undo_prefetch_older_version(roll_ptr, is_temp);
+  }
+
   /* (a) If a clustered index record version is such that the
   trx id stamp in it is bigger than purge_sys->view, then the
   BLOBs in that version are known to exist (the purge has not
@@ -121,6 +121,10 @@ static void trx_rollback_to_savepoint_low(
     trx_rollback_finish(trx);
     MONITOR_INC(MONITOR_TRX_ROLLBACK);
   } else {
+    /* A partial rollback may have released record locks taken by
+    foreign key checks after the savepoint; forget the verified keys. */
+    trx->fk_checked_keys.clear();
+
     trx->lock.que_state = TRX_QUE_RUNNING;
     MONITOR_INC(MONITOR_TRX_ROLLBACK_SAVEPOINT);
   }
@@ -811,8 +815,19 @@ static const page_t *trx_roll_pop_top_rec(trx_t *trx, trx_undo_t *undo,
                                           mtr_t *mtr, uint32_t *undo_offset) {
   ut_ad(mutex_own(&trx->undo_mutex));
 
-  const page_t *undo_page = trx_undo_page_get_s_latched(
-      page_id_t(undo->space, undo->top_page_no), undo->page_size, mtr);
+  /* Successive pops during a rollback nearly always hit the same undo
+  page, so re-fix it through the guess block remembered from the
+  previous pop, like the undo report path does when appending records.
+  The guess is validated by buf_page_get_gen() and discarded if the
+  buffer pool has been resized since it was stored. */
+  buf_block_t *undo_block = buf_page_get_gen(
+      page_id_t(undo->space, undo->top_page_no), undo->page_size, RW_S_LATCH,
+      buf_pool_is_obsolete(undo->withdraw_clock) ? nullptr : undo->guess_block,
+      Page_fetch::NORMAL, __FILE__, __LINE__, mtr);
+
+  buf_block_dbg_add_level(undo_block, SYNC_TRX_UNDO_PAGE);
+
+  const page_t *undo_page = buf_block_get_frame(undo_block);
 
   *undo_offset = static_cast<uint32_t>(undo->top_offset);
 
@@ -827,6 +842,12 @@ static const page_t *trx_roll_pop_top_rec(trx_t *trx, trx_undo_t *undo,
 
     if (prev_rec_page != undo_page) {
       trx->pages_undone++;
+      /* The next pop fetches the previous page, for which we have no
+      block pointer at hand; fall back to a page hash lookup there. */
+      undo->guess_block = nullptr;
+    } else {
+      undo->guess_block = undo_block;
+      undo->withdraw_clock = buf_withdraw_clock;
     }
 
     undo->top_page_no = page_get_page_no(prev_rec_page);
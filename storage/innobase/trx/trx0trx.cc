@@ -496,6 +496,7 @@ static void trx_free(trx_t *&trx) {
   }
 
   trx->mod_tables.clear();
+  trx->fk_checked_keys.clear();
 
   ut_ad(trx->read_view == nullptr);
   ut_ad(trx->is_dd_trx == false);
@@ -1025,6 +1026,8 @@ void trx_lists_init_at_db_start(void) {
 
     UT_LIST_ADD_FIRST(trx_sys->rw_trx_list, it->m_trx);
   }
+
+  trx_sys->rw_trx_version.fetch_add(1, std::memory_order_release);
 }
 
 /** Get next redo rollback segment in round-robin fashion.
@@ -1660,6 +1663,10 @@ static void trx_flush_log_if_needed(lsn_t lsn, /*!< in: lsn up to which logs are
 
   if (trx->ddl_operation || trx->ddl_must_flush) {
     log_write_up_to(*log_sys, lsn, true);
+  } else if (thd_is_bulk_load(trx->mysql_thd)) {
+    /* A bulk load session regenerates its data on failure; leave
+    the redo to the background log flush, as when
+    innodb_flush_log_at_trx_commit=0. */
   } else {
     trx_flush_log_if_needed_low(lsn);
   }
@@ -1727,6 +1734,8 @@ static void trx_erase_lists(trx_t *trx, bool serialised, Gtid_desc &gtid_desc) {
   ut_ad(*it == trx->id);
   trx_sys->rw_trx_ids.erase(it);
 
+  trx_sys->rw_trx_version.fetch_add(1, std::memory_order_release);
+
   if (trx->read_only || trx->rsegs.m_redo.rseg == nullptr) {
     ut_ad(!trx->in_rw_trx_list);
   } else {
@@ -1874,6 +1883,10 @@ written */
     }
   }
 
+  /* All record locks are released now, so keys verified by earlier
+  foreign key checks are no longer pinned. */
+  trx->fk_checked_keys.clear();
+
   if (trx->rsegs.m_redo.rseg != nullptr) {
     trx_rseg_t *rseg = trx->rsegs.m_redo.rseg;
     ut_ad(rseg->trx_ref_count > 0);
@@ -2345,6 +2358,11 @@ void trx_mark_sql_stat_end(trx_t *trx) /*!< in: trx handle */
 
   lock_on_statement_end(trx);
 
+  /* Locks taken with AT_LEAST_STATEMENT duration may be released now,
+  so keys verified by foreign key checks of the finished statement are
+  no longer pinned. */
+  trx->fk_checked_keys.clear();
+
   switch (trx->state) {
     case TRX_STATE_PREPARED:
     case TRX_STATE_COMMITTED_IN_MEMORY:
@@ -90,7 +90,8 @@
 */
 
 static_assert((PFS_DD_VERSION <= MYSQL_VERSION_ID) ||
-                  ((PFS_DD_VERSION == 800172) && (MYSQL_VERSION_ID == 80017)),
+                  ((PFS_DD_VERSION == 800172) && (MYSQL_VERSION_ID == 80017)) ||
+                  ((PFS_DD_VERSION == 800211) && (MYSQL_VERSION_ID == 80021)),
               "This release can not use a version number from the future");
 
 class KEY;
@@ -1459,6 +1460,8 @@ static SHOW_VAR pfs_status_vars[] = {
      SHOW_LONG, SHOW_SCOPE_GLOBAL},
     {"Performance_schema_digest_lost", (char *)&digest_lost, SHOW_LONG,
      SHOW_SCOPE_GLOBAL},
+    {"Performance_schema_digest_evicted", (char *)&digest_evicted, SHOW_LONG,
+     SHOW_SCOPE_GLOBAL},
     {"Performance_schema_session_connect_attrs_lost",
      (char *)&session_connect_attrs_lost, SHOW_LONG, SHOW_SCOPE_GLOBAL},
     {"Performance_schema_session_connect_attrs_longest_seen",
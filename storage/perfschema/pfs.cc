@@ -111,6 +111,7 @@
 #include "storage/perfschema/pfs_host.h"
 #include "storage/perfschema/pfs_instr.h"
 #include "storage/perfschema/pfs_instr_class.h"
+#include "storage/perfschema/pfs_memory_samples.h"
 #include "storage/perfschema/pfs_plugin_table.h"
 #include "storage/perfschema/pfs_prepared_stmt.h"
 #include "storage/perfschema/pfs_program.h"
@@ -4822,6 +4823,18 @@ void pfs_end_mutex_wait_v1(PSI_mutex_locker *locker, int rc) {
   if (flags & STATE_FLAG_TIMED) {
     timer_end = get_wait_timer();
     wait_time = timer_end - state->m_timer_start;
+    /*
+      For short, uncontended waits, most of the measured interval
+      is the cost of the two timer reads themselves.
+      Compensate with the timer overhead calibrated at startup,
+      so that such waits are not over-reported.
+      Raw timer values in the wait event record are not adjusted.
+    */
+    if (likely(wait_time > wait_timer_overhead)) {
+      wait_time -= wait_timer_overhead;
+    } else {
+      wait_time = 0;
+    }
     /* Aggregate to EVENTS_WAITS_SUMMARY_BY_INSTANCE (timed) */
     mutex->m_mutex_stat.m_wait_stat.aggregate_value(wait_time);
   } else {
@@ -5879,6 +5892,10 @@ PSI_statement_locker *pfs_get_thread_statement_locker_v2(
       pfs->m_sort_scan = 0;
       pfs->m_no_index_used = 0;
       pfs->m_no_good_index_used = 0;
+      pfs->m_buf_read_requests = 0;
+      pfs->m_buf_reads = 0;
+      pfs->m_buf_pages_dirtied = 0;
+      pfs->m_data_read_bytes = 0;
       pfs->m_digest_storage.reset();
 
       /* New stages will have this statement as parent */
@@ -5974,6 +5991,10 @@ PSI_statement_locker *pfs_get_thread_statement_locker_v2(
   state->m_sort_scan = 0;
   state->m_no_index_used = 0;
   state->m_no_good_index_used = 0;
+  state->m_buf_read_requests = 0;
+  state->m_buf_reads = 0;
+  state->m_buf_pages_dirtied = 0;
+  state->m_data_read_bytes = 0;
 
   state->m_digest = nullptr;
   state->m_cs_number = static_cast<const CHARSET_INFO *>(charset)->number;
@@ -6237,6 +6258,34 @@ void pfs_inc_statement_sort_scan_v2(PSI_statement_locker *locker, ulong count) {
   INC_STATEMENT_ATTR_BODY(locker, m_sort_scan, count);
 }
 
+void pfs_inc_statement_storage_io_stats_v2(PSI_statement_locker *locker,
+                                           ulonglong read_requests,
+                                           ulonglong reads,
+                                           ulonglong pages_dirtied,
+                                           ulonglong bytes_read) {
+  PSI_statement_locker_state *state;
+  state = reinterpret_cast<PSI_statement_locker_state *>(locker);
+  if (unlikely(state == nullptr)) {
+    return;
+  }
+  if (state->m_discarded) {
+    return;
+  }
+  state->m_buf_read_requests += read_requests;
+  state->m_buf_reads += reads;
+  state->m_buf_pages_dirtied += pages_dirtied;
+  state->m_data_read_bytes += bytes_read;
+  if (state->m_flags & STATE_FLAG_EVENT) {
+    PFS_events_statements *pfs;
+    pfs = reinterpret_cast<PFS_events_statements *>(state->m_statement);
+    DBUG_ASSERT(pfs != nullptr);
+    pfs->m_buf_read_requests += read_requests;
+    pfs->m_buf_reads += reads;
+    pfs->m_buf_pages_dirtied += pages_dirtied;
+    pfs->m_data_read_bytes += bytes_read;
+  }
+}
+
 void pfs_set_statement_no_index_used_v2(PSI_statement_locker *locker) {
   SET_STATEMENT_ATTR_BODY(locker, m_no_index_used, 1);
 }
@@ -6398,6 +6447,10 @@ void pfs_end_statement_v2(PSI_statement_locker *locker, void *stmt_da) {
   stat->m_sort_scan += state->m_sort_scan;
   stat->m_no_index_used += state->m_no_index_used;
   stat->m_no_good_index_used += state->m_no_good_index_used;
+  stat->m_buf_read_requests += state->m_buf_read_requests;
+  stat->m_buf_reads += state->m_buf_reads;
+  stat->m_buf_pages_dirtied += state->m_buf_pages_dirtied;
+  stat->m_data_read_bytes += state->m_data_read_bytes;
 
   if (digest_stat != nullptr) {
     bool new_max_wait = false;
@@ -6415,6 +6468,16 @@ void pfs_end_statement_v2(PSI_statement_locker *locker, void *stmt_da) {
       /* Update digest histogram. */
       digest_stat->m_histogram.increment_bucket(bucket_index);
 
+      /* Update account histogram. */
+      if (flags & STATE_FLAG_THREAD) {
+        PFS_thread *pfs_thread =
+            reinterpret_cast<PFS_thread *>(state->m_thread);
+        PFS_account *account = sanitize_account(pfs_thread->m_account);
+        if (account != nullptr) {
+          account->m_statements_histogram.increment_bucket(bucket_index);
+        }
+      }
+
       /* Update global histogram. */
       global_statements_histogram.increment_bucket(bucket_index);
     } else {
@@ -6478,11 +6541,25 @@ void pfs_end_statement_v2(PSI_statement_locker *locker, void *stmt_da) {
     digest_stat->m_stat.m_sort_scan += state->m_sort_scan;
     digest_stat->m_stat.m_no_index_used += state->m_no_index_used;
     digest_stat->m_stat.m_no_good_index_used += state->m_no_good_index_used;
+    digest_stat->m_stat.m_buf_read_requests += state->m_buf_read_requests;
+    digest_stat->m_stat.m_buf_reads += state->m_buf_reads;
+    digest_stat->m_stat.m_buf_pages_dirtied += state->m_buf_pages_dirtied;
+    digest_stat->m_stat.m_data_read_bytes += state->m_data_read_bytes;
   } else {
     if (flags & STATE_FLAG_TIMED) {
       time_normalizer *normalizer = time_normalizer::get_statement();
       ulong bucket_index = normalizer->bucket_index(wait_time);
 
+      /* Update account histogram. */
+      if (flags & STATE_FLAG_THREAD) {
+        PFS_thread *pfs_thread =
+            reinterpret_cast<PFS_thread *>(state->m_thread);
+        PFS_account *account = sanitize_account(pfs_thread->m_account);
+        if (account != nullptr) {
+          account->m_statements_histogram.increment_bucket(bucket_index);
+        }
+      }
+
       /* Update global histogram. */
       global_statements_histogram.increment_bucket(bucket_index);
     }
@@ -6516,6 +6593,10 @@ void pfs_end_statement_v2(PSI_statement_locker *locker, void *stmt_da) {
       sub_stmt_stat->m_sort_scan += state->m_sort_scan;
       sub_stmt_stat->m_no_index_used += state->m_no_index_used;
       sub_stmt_stat->m_no_good_index_used += state->m_no_good_index_used;
+      sub_stmt_stat->m_buf_read_requests += state->m_buf_read_requests;
+      sub_stmt_stat->m_buf_reads += state->m_buf_reads;
+      sub_stmt_stat->m_buf_pages_dirtied += state->m_buf_pages_dirtied;
+      sub_stmt_stat->m_data_read_bytes += state->m_data_read_bytes;
     }
   }
 
@@ -6558,6 +6639,10 @@ void pfs_end_statement_v2(PSI_statement_locker *locker, void *stmt_da) {
         prepared_stmt_stat->m_sort_scan += state->m_sort_scan;
         prepared_stmt_stat->m_no_index_used += state->m_no_index_used;
         prepared_stmt_stat->m_no_good_index_used += state->m_no_good_index_used;
+        prepared_stmt_stat->m_buf_read_requests += state->m_buf_read_requests;
+        prepared_stmt_stat->m_buf_reads += state->m_buf_reads;
+        prepared_stmt_stat->m_buf_pages_dirtied += state->m_buf_pages_dirtied;
+        prepared_stmt_stat->m_data_read_bytes += state->m_data_read_bytes;
       }
     }
   }
@@ -7472,6 +7557,9 @@ PSI_memory_key pfs_memory_alloc_v1(PSI_memory_key key, size_t size,
 
   uint index = klass->m_event_name_index;
 
+  /* Sampled call stack attribution, see pfs_memory_samples.h. */
+  sample_memory_alloc(klass, size);
+
   if (flag_thread_instrumentation && !klass->is_global()) {
     PFS_thread *pfs_thread = my_thread_get_THR_PFS();
     if (unlikely(pfs_thread == nullptr)) {
@@ -8263,7 +8351,8 @@ PSI_statement_service_v2 pfs_statement_service_v2 = {
     pfs_release_sp_share_v2,
     pfs_start_sp_v2,
     pfs_end_sp_v2,
-    pfs_drop_sp_v2};
+    pfs_drop_sp_v2,
+    pfs_inc_statement_storage_io_stats_v2};
 
 SERVICE_TYPE(psi_statement_v1)
 SERVICE_IMPLEMENTATION(performance_schema, psi_statement_v1) = {
@@ -185,6 +185,7 @@ search:
     pfs->init_refcount();
     pfs->reset_stats();
     pfs->m_disconnected_count = 0;
+    pfs->m_statements_histogram.reset();
 
     if (username_length > 0 && hostname_length > 0) {
       lookup_setup_actor(thread, username, username_length, hostname,
@@ -732,4 +733,18 @@ void update_accounts_derived_flags(PFS_thread *thread) {
   global_account_container.apply(proc);
 }
 
+class Proc_reset_histogram_by_account
+    : public PFS_buffer_processor<PFS_account> {
+ public:
+  virtual void operator()(PFS_account *pfs) {
+    pfs->m_statements_histogram.reset();
+  }
+};
+
+/** Reset the statement histogram of every account. */
+void reset_histogram_by_account() {
+  Proc_reset_histogram_by_account proc;
+  global_account_container.apply(proc);
+}
+
 /** @} */
@@ -38,6 +38,7 @@
 #include "mysql_com.h" /* USERNAME_LENGTH */
 #include "storage/perfschema/pfs_con_slice.h"
 #include "storage/perfschema/pfs_global.h"
+#include "storage/perfschema/pfs_histogram.h"
 #include "storage/perfschema/pfs_lock.h"
 
 struct PFS_global_param;
@@ -127,6 +128,13 @@ struct PFS_ALIGNED PFS_account : PFS_connection_slice {
 
   ulonglong m_disconnected_count;
 
+  /**
+    Per account statement latency histogram.
+    This member holds the data for the table
+    PERFORMANCE_SCHEMA.EVENTS_STATEMENTS_HISTOGRAM_BY_ACCOUNT.
+  */
+  PFS_histogram m_statements_histogram;
+
  private:
   std::atomic<int> m_refcount;
 
@@ -153,6 +161,8 @@ void purge_all_account(void);
 
 void update_accounts_derived_flags(PFS_thread *thread);
 
+void reset_histogram_by_account();
+
 /* For show status. */
 
 extern LF_HASH account_hash;
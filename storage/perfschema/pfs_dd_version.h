@@ -150,8 +150,33 @@
 
   performance_schema tables changed in MySQL 8.0.21
   - tls_channel_status (created)
+
+  800211:
+
+  Number 80021 was already published, so the second space
+  (@see ha_perfschema.cc) is used for a change within the same release:
+  - replication_applier_status_by_worker, added column
+  PARTITIONS_STOLEN_COUNT
+
+  800212:
+
+  Another change within the same release:
+  - events_statements_histogram_by_account (created)
+
+  800213:
+
+  Another change within the same release:
+  - memory_allocation_samples (created)
+
+  800214:
+
+  Another change within the same release:
+  - events_statements_current (changed)
+  - events_statements_history (changed)
+  - events_statements_history_long (changed)
+  - events_statements_summary_by_digest (changed)
 */
 
-static const uint PFS_DD_VERSION = 80021;
+static const uint PFS_DD_VERSION = 800214;
 
 #endif /* PFS_DD_VERSION_H */
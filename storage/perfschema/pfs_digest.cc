@@ -47,6 +47,7 @@
 
 size_t digest_max = 0;
 ulong digest_lost = 0;
+ulong digest_evicted = 0;
 
 /** EVENTS_STATEMENTS_SUMMARY_BY_DIGEST buffer. */
 PFS_statements_digest_stat *statements_digest_stat_array = nullptr;
@@ -59,8 +60,13 @@ bool flag_statements_digest = true;
   index 0 is reserved for "all else" case when entire array is full.
 */
 static PFS_cacheline_atomic_uint32 digest_monotonic_index;
+/** Scan cursor for evict_cold_digest(), advanced on each eviction probe. */
+static PFS_cacheline_atomic_uint32 digest_eviction_index;
 bool digest_full = false;
 
+/** Number of records inspected when looking for a cold digest to evict. */
+static const uint DIGEST_EVICTION_SAMPLE_SIZE = 128;
+
 LF_HASH digest_hash;
 static bool digest_hash_inited = false;
 
@@ -75,7 +81,9 @@ int init_digest(const PFS_global_param *param) {
   */
   digest_max = param->m_digest_sizing;
   digest_lost = 0;
+  digest_evicted = 0;
   digest_monotonic_index.m_u32.store(1);
+  digest_eviction_index.m_u32.store(1);
   digest_full = false;
 
   if (digest_max == 0) {
@@ -195,6 +203,71 @@ static LF_PINS *get_digest_hash_pins(PFS_thread *thread) {
   return thread->m_digest_hash_pins;
 }
 
+/**
+  Evict a cold digest record so that its slot can be reused.
+
+  The digest array is full. Inspect a bounded window of records, pick the
+  coldest one as measured by @c m_last_seen, and try to acquire it. The old
+  digest is removed from the hash index and its statistics are reset; the
+  record is returned in DIRTY state for the caller to fill and re-insert.
+
+  @param pins        the digest hash pins of the calling thread
+  @param dirty_state lock state of the acquired record
+  @return the acquired record, or nullptr if no record could be acquired
+*/
+static PFS_statements_digest_stat *evict_cold_digest(
+    LF_PINS *pins, pfs_dirty_state *dirty_state) {
+  PFS_statements_digest_stat *victim = nullptr;
+  uint sample = DIGEST_EVICTION_SAMPLE_SIZE;
+  if (sample > digest_max - 1) {
+    sample = digest_max - 1;
+  }
+
+  for (uint i = 0; i < sample; i++) {
+    size_t index = digest_eviction_index.m_u32++ % digest_max;
+    if (index == 0) {
+      /* Record [0] is reserved. */
+      continue;
+    }
+    PFS_statements_digest_stat *pfs = &statements_digest_stat_array[index];
+    if (!pfs->m_lock.is_populated()) {
+      continue;
+    }
+    if (pfs->m_query_sample_refs.load() != 0) {
+      /* The query sample text is being written, leave the record alone. */
+      continue;
+    }
+    if (victim == nullptr || pfs->m_last_seen < victim->m_last_seen) {
+      victim = pfs;
+    }
+  }
+
+  if (victim == nullptr) {
+    return nullptr;
+  }
+
+  if (!victim->m_lock.try_allocated_to_dirty(dirty_state)) {
+    /* Lost a race against another writer, give up for this statement. */
+    return nullptr;
+  }
+
+  /* Remove the old digest from the hash index. */
+  if (victim->m_digest_storage.m_byte_count > 0) {
+    lf_hash_delete(&digest_hash, pins, &victim->m_digest_key,
+                   sizeof(PFS_digest_key));
+  }
+
+  /* Reset the statistics, as in reset_data(), keeping the lock DIRTY. */
+  victim->m_stat.reset();
+  victim->m_query_sample_length = 0;
+  victim->m_query_sample_truncated = false;
+  victim->m_query_sample_seen = 0;
+  victim->m_query_sample_timer_wait = 0;
+  victim->m_query_sample_cs_number = system_charset_info->number;
+
+  return victim;
+}
+
 PFS_statements_digest_stat *find_or_create_digest(
     PFS_thread *thread, const sql_digest_storage *digest_storage,
     const char *schema_name, uint schema_name_length) {
@@ -233,6 +306,7 @@ PFS_statements_digest_stat *find_or_create_digest(
   const uint retry_max = 3;
   size_t safe_index;
   size_t attempts = 0;
+  bool evicted = false;
   PFS_statements_digest_stat **entry;
   PFS_statements_digest_stat *pfs = nullptr;
   pfs_dirty_state dirty_state;
@@ -256,15 +330,27 @@ search:
   lf_hash_search_unpin(pins);
 
   if (digest_full) {
-    /* digest_stat array is full. Add stat at index 0 and return. */
-    pfs = &statements_digest_stat_array[0];
-    digest_lost++;
-
-    if (pfs->m_first_seen == 0) {
-      pfs->m_first_seen = now;
+    /*
+      The digest_stat array is full. Evict the coldest digest seen recently
+      and reuse its slot, so that new digests stay visible on workloads with
+      more distinct digests than the array can hold.
+    */
+    pfs = evict_cold_digest(pins, &dirty_state);
+    if (pfs == nullptr) {
+      /* Nothing could be evicted. Add stat at index 0 and return. */
+      pfs = &statements_digest_stat_array[0];
+      digest_lost++;
+
+      if (pfs->m_first_seen == 0) {
+        pfs->m_first_seen = now;
+      }
+      pfs->m_last_seen = now;
+      return pfs;
     }
-    pfs->m_last_seen = now;
-    return pfs;
+
+    digest_evicted++;
+    evicted = true;
+    goto fill;
   }
 
   while (++attempts <= digest_max) {
@@ -280,6 +366,8 @@ search:
 
     if (pfs->m_lock.is_free()) {
       if (pfs->m_lock.free_to_dirty(&dirty_state)) {
+        evicted = false;
+      fill:
         /* Copy digest hash/LF Hash search key. */
         memcpy(&pfs->m_digest_key, &hash_key, sizeof(PFS_digest_key));
 
@@ -304,6 +392,11 @@ search:
 
         pfs->m_lock.dirty_to_free(&dirty_state);
 
+        if (evicted) {
+          /* The evicted slot is free again; the array is no longer full. */
+          digest_full = false;
+        }
+
         if (res > 0) {
           /* Duplicate insert by another thread */
           if (++retry_count > retry_max) {
@@ -43,6 +43,7 @@
 extern bool flag_statements_digest;
 extern size_t digest_max;
 extern ulong digest_lost;
+extern ulong digest_evicted;
 struct PFS_thread;
 
 /**
@@ -66,6 +66,7 @@
 #include "storage/perfschema/table_esgs_by_thread_by_event_name.h"
 #include "storage/perfschema/table_esgs_by_user_by_event_name.h"
 #include "storage/perfschema/table_esgs_global_by_event_name.h"
+#include "storage/perfschema/table_esmh_by_account.h"
 #include "storage/perfschema/table_esmh_by_digest.h"
 #include "storage/perfschema/table_esmh_global.h"
 #include "storage/perfschema/table_esms_by_account_by_event_name.h"
@@ -103,6 +104,7 @@
 #include "storage/perfschema/table_mems_by_host_by_event_name.h"
 #include "storage/perfschema/table_mems_by_thread_by_event_name.h"
 #include "storage/perfschema/table_mems_by_user_by_event_name.h"
+#include "storage/perfschema/table_memory_samples.h"
 #include "storage/perfschema/table_mems_global_by_event_name.h"
 #include "storage/perfschema/table_os_global_by_type.h"
 #include "storage/perfschema/table_performance_timers.h"
@@ -604,6 +606,7 @@ static PFS_engine_table_share *all_shares[] = {
     &table_esms_by_program::m_share,
     &table_esmh_global::m_share,
     &table_esmh_by_digest::m_share,
+    &table_esmh_by_account::m_share,
 
     &table_events_transactions_current::m_share,
     &table_events_transactions_history::m_share,
@@ -638,6 +641,7 @@ static PFS_engine_table_share *all_shares[] = {
     &table_mems_by_host_by_event_name::m_share,
     &table_mems_by_thread_by_event_name::m_share,
     &table_mems_by_user_by_event_name::m_share,
+    &table_memory_samples::m_share,
     &table_table_handles::m_share,
     &table_metadata_locks::m_share,
     &table_data_locks::m_share,
@@ -109,6 +109,14 @@ struct PFS_events_statements : public PFS_events {
   ulonglong m_no_index_used;
   /** Optimizer metric, number of 'no good index used'. */
   ulonglong m_no_good_index_used;
+  /** Storage metric, buffer pool read requests (pages touched). */
+  ulonglong m_buf_read_requests;
+  /** Storage metric, buffer pool misses (pages read from storage). */
+  ulonglong m_buf_reads;
+  /** Storage metric, buffer pool pages first dirtied. */
+  ulonglong m_buf_pages_dirtied;
+  /** Storage metric, bytes read from storage. */
+  ulonglong m_data_read_bytes;
 
   /** True if @c SQL_TEXT was truncated. */
   bool m_sqltext_truncated;
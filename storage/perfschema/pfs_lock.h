@@ -233,6 +233,32 @@ struct pfs_lock {
     copy_ptr->m_version_state = new_val;
   }
 
+  /**
+    Attempt an allocated to dirty transition.
+    Unlike allocated_to_dirty(), this transition is safe to attempt
+    concurrently by multiple writers that do not own the record:
+    only one writer will succeed to acquire the record.
+    @return true if the operation succeed
+  */
+  bool try_allocated_to_dirty(pfs_dirty_state *copy_ptr) {
+    uint32 old_val = m_version_state.load();
+
+    if ((old_val & STATE_MASK) != PFS_LOCK_ALLOCATED) {
+      return false;
+    }
+
+    uint32 new_val = (old_val & VERSION_MASK) + PFS_LOCK_DIRTY;
+
+    bool pass =
+        atomic_compare_exchange_strong(&m_version_state, &old_val, new_val);
+
+    if (pass) {
+      copy_ptr->m_version_state = new_val;
+    }
+
+    return pass;
+  }
+
   /**
     Execute a dirty to allocated transition.
     This transition should be executed by the writer that owns the record,
@@ -0,0 +1,130 @@
+/* Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License, version 2.0,
+  as published by the Free Software Foundation.
+
+  This program is also distributed with certain software (including
+  but not limited to OpenSSL) that is licensed under separate terms,
+  as designated in a particular file or component or in included license
+  documentation.  The authors of MySQL hereby grant you an additional
+  permission to link the program and your derivative works with the
+  separately licensed software that they have included with MySQL.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License, version 2.0, for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+/**
+  @file storage/perfschema/pfs_memory_samples.cc
+  Sampled call stack attribution for memory instrumentation (implementation).
+*/
+
+#include "storage/perfschema/pfs_memory_samples.h"
+
+#include <string.h>
+
+#include "my_config.h"
+
+#ifdef HAVE_BACKTRACE
+#include <execinfo.h>
+#endif
+
+#include "storage/perfschema/pfs_global.h"
+#include "storage/perfschema/pfs_instr_class.h"
+#include "template_utils.h"
+
+PFS_memory_sample_slot memory_sample_array[MEMORY_SAMPLE_SLOTS];
+
+ulong memory_samples_lost = 0;
+
+/** Sampling clock, shared by all threads. */
+static std::atomic<ulong> memory_sample_ticker{0};
+
+/**
+  Number of frames to skip when capturing a stack: this function,
+  sample_memory_alloc() and the psi_memory hook itself are overhead, the
+  caller wants to see the code that performed the allocation.
+*/
+#define MEMORY_SAMPLE_SKIP_FRAMES 3
+
+void sample_memory_alloc(PFS_memory_class *klass, size_t size) {
+#ifdef HAVE_BACKTRACE
+  /* Cheap gate first: sample one in MEMORY_SAMPLE_INTERVAL allocations. */
+  if ((memory_sample_ticker++ % MEMORY_SAMPLE_INTERVAL) != 0) {
+    return;
+  }
+
+  void *raw_frames[MEMORY_SAMPLE_SKIP_FRAMES + MEMORY_SAMPLE_FRAMES];
+  int depth =
+      backtrace(raw_frames, static_cast<int>(array_elements(raw_frames)));
+  if (depth <= MEMORY_SAMPLE_SKIP_FRAMES) {
+    return;
+  }
+
+  void *frames[MEMORY_SAMPLE_FRAMES];
+  memset(frames, 0, sizeof(frames));
+  memcpy(frames, raw_frames + MEMORY_SAMPLE_SKIP_FRAMES,
+         (depth - MEMORY_SAMPLE_SKIP_FRAMES) * sizeof(void *));
+
+  /* Bucket on (instrument class, frames). */
+  uintptr_t hash = reinterpret_cast<uintptr_t>(klass);
+  for (int i = 0; i < MEMORY_SAMPLE_FRAMES; i++) {
+    hash = hash * 31 + reinterpret_cast<uintptr_t>(frames[i]);
+  }
+
+  PFS_memory_sample_slot *slot =
+      &memory_sample_array[hash % MEMORY_SAMPLE_SLOTS];
+
+  if (slot->m_lock.is_populated()) {
+    if (slot->m_class == klass &&
+        memcmp(slot->m_frames, frames, sizeof(frames)) == 0) {
+      slot->m_count++;
+      slot->m_bytes += size;
+    } else {
+      /* Occupied by another stack. The array is bounded, drop the sample. */
+      memory_samples_lost++;
+    }
+    return;
+  }
+
+  pfs_dirty_state dirty_state;
+  if (!slot->m_lock.free_to_dirty(&dirty_state)) {
+    memory_samples_lost++;
+    return;
+  }
+
+  slot->m_class = klass;
+  memcpy(slot->m_frames, frames, sizeof(frames));
+  slot->m_count.store(1);
+  slot->m_bytes.store(size);
+  slot->m_lock.dirty_to_allocated(&dirty_state);
+#else
+  (void)klass;
+  (void)size;
+#endif /* HAVE_BACKTRACE */
+}
+
+void reset_memory_samples() {
+  for (uint i = 0; i < MEMORY_SAMPLE_SLOTS; i++) {
+    PFS_memory_sample_slot *slot = &memory_sample_array[i];
+
+    pfs_dirty_state dirty_state;
+    if (!slot->m_lock.try_allocated_to_dirty(&dirty_state)) {
+      continue;
+    }
+
+    slot->m_class = nullptr;
+    memset(slot->m_frames, 0, sizeof(slot->m_frames));
+    slot->m_count.store(0);
+    slot->m_bytes.store(0);
+    slot->m_lock.dirty_to_free(&dirty_state);
+  }
+
+  memory_samples_lost = 0;
+}
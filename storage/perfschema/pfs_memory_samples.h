@@ -0,0 +1,86 @@
+/* Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License, version 2.0,
+  as published by the Free Software Foundation.
+
+  This program is also distributed with certain software (including
+  but not limited to OpenSSL) that is licensed under separate terms,
+  as designated in a particular file or component or in included license
+  documentation.  The authors of MySQL hereby grant you an additional
+  permission to link the program and your derivative works with the
+  separately licensed software that they have included with MySQL.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License, version 2.0, for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+#ifndef PFS_MEMORY_SAMPLES_H
+#define PFS_MEMORY_SAMPLES_H
+
+/**
+  @file storage/perfschema/pfs_memory_samples.h
+  Sampled call stack attribution for memory instrumentation (declarations).
+
+  The memory summary tables aggregate bytes per instrument class, which
+  tells what leaks but not from where. This module samples one in
+  @c MEMORY_SAMPLE_INTERVAL instrumented allocations, captures a short
+  native call stack and accumulates (count, bytes) per distinct stack in a
+  bounded array, exposed by table
+  PERFORMANCE_SCHEMA.MEMORY_ALLOCATION_SAMPLES.
+*/
+
+#include <stddef.h>
+#include <atomic>
+
+#include "my_inttypes.h"
+#include "storage/perfschema/pfs_lock.h"
+
+struct PFS_memory_class;
+
+/** Number of native frames captured per sampled allocation. */
+#define MEMORY_SAMPLE_FRAMES 4
+
+/** Size of the sample array. Samples for new stacks are lost when full. */
+#define MEMORY_SAMPLE_SLOTS 1024
+
+/** Sampling rate: one in this many instrumented allocations is sampled. */
+#define MEMORY_SAMPLE_INTERVAL 64
+
+/** One sampled allocation call stack, and its accumulated statistics. */
+struct PFS_memory_sample_slot {
+  /** Internal lock. */
+  pfs_lock m_lock;
+  /** The instrument class of the sampled allocations. */
+  PFS_memory_class *m_class;
+  /** Return addresses, innermost first. */
+  void *m_frames[MEMORY_SAMPLE_FRAMES];
+  /** Number of sampled allocations with this stack. */
+  std::atomic<ulonglong> m_count;
+  /** Total bytes of the sampled allocations with this stack. */
+  std::atomic<ulonglong> m_bytes;
+};
+
+extern PFS_memory_sample_slot memory_sample_array[MEMORY_SAMPLE_SLOTS];
+
+/** Samples lost to slot collisions in the bounded array. */
+extern ulong memory_samples_lost;
+
+/**
+  Account one instrumented allocation, sampling one in
+  @c MEMORY_SAMPLE_INTERVAL calls.
+
+  @param klass the memory instrument class
+  @param size  the allocation size, in bytes
+*/
+void sample_memory_alloc(PFS_memory_class *klass, size_t size);
+
+/** Reset the sample array, for TRUNCATE. */
+void reset_memory_samples();
+
+#endif
@@ -393,6 +393,10 @@ struct PFS_statement_stat {
   ulonglong m_sort_scan{0};
   ulonglong m_no_index_used{0};
   ulonglong m_no_good_index_used{0};
+  ulonglong m_buf_read_requests{0};
+  ulonglong m_buf_reads{0};
+  ulonglong m_buf_pages_dirtied{0};
+  ulonglong m_data_read_bytes{0};
 
   void reset() { new (this) PFS_statement_stat(); }
 
@@ -425,6 +429,10 @@ struct PFS_statement_stat {
       m_sort_scan += stat->m_sort_scan;
       m_no_index_used += stat->m_no_index_used;
       m_no_good_index_used += stat->m_no_good_index_used;
+      m_buf_read_requests += stat->m_buf_read_requests;
+      m_buf_reads += stat->m_buf_reads;
+      m_buf_pages_dirtied += stat->m_buf_pages_dirtied;
+      m_data_read_bytes += stat->m_data_read_bytes;
     }
   }
 };
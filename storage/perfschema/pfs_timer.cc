@@ -38,6 +38,8 @@
 
 MY_TIMER_INFO pfs_timer_info;
 
+ulonglong wait_timer_overhead = 0;
+
 static ulonglong cycle_v0;
 static ulonglong nanosec_v0;
 static ulonglong microsec_v0;
@@ -96,6 +98,13 @@ void init_timers(void) {
     millisec_to_pico = 0;
   }
 
+  /*
+    The timer overhead is calibrated by my_timer_init(),
+    as the minimum observed cost of back to back timer reads.
+    @see get_wait_timer()
+  */
+  wait_timer_overhead = pfs_timer_info.cycles.overhead;
+
   to_pico_data[TIMER_NAME_CYCLE].m_v0 = cycle_v0;
   to_pico_data[TIMER_NAME_CYCLE].m_factor = cycle_to_pico;
 
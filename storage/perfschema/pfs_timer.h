@@ -95,7 +95,45 @@
 
 ulonglong inline get_idle_timer() { return USED_TIMER(); }
 
-ulonglong inline get_wait_timer() { return my_timer_cycles(); }
+/*
+  Wait events are timed with the CYCLE timer, and the timer is read
+  twice per instrumented wait, so the cost of reading it dominates the
+  instrumentation overhead for short (uncontended) waits.
+  On platforms with an invariant TSC, read the counter inline here
+  instead of making an out of line call into mysys.
+  The inline read must return the same counter as my_timer_cycles(),
+  because the frequency calibrated by my_timer_init() for that counter
+  is used to normalize wait timer values (@see init_timers()).
+*/
+#if defined(__GNUC__) && defined(__x86_64__)
+#define HAVE_INLINE_CYCLE_TIMER
+ulonglong inline inline_timer_cycles() {
+  /* Same counter as my_timer_cycles(), see mysys/my_rdtsc.cc. */
+  ulonglong result;
+  __asm__ __volatile__(
+      "rdtsc\n\t"
+      "shlq $32,%%rdx\n\t"
+      "orq %%rdx,%%rax"
+      : "=a"(result)::"%edx");
+  return result;
+}
+#elif defined(__GNUC__) && defined(__aarch64__)
+#define HAVE_INLINE_CYCLE_TIMER
+ulonglong inline inline_timer_cycles() {
+  /* Same counter as my_timer_cycles(), see mysys/my_rdtsc.cc. */
+  ulonglong result;
+  __asm __volatile__("mrs %[rt],cntvct_el0" : [ rt ] "=r"(result));
+  return result;
+}
+#endif
+
+ulonglong inline get_wait_timer() {
+#ifdef HAVE_INLINE_CYCLE_TIMER
+  return inline_timer_cycles();
+#else
+  return my_timer_cycles();
+#endif
+}
 
 ulonglong inline get_stage_timer() { return USED_TIMER(); }
 
@@ -163,6 +201,14 @@ struct time_normalizer {
 */
 extern MY_TIMER_INFO pfs_timer_info;
 
+/**
+  Overhead of reading the wait timer itself, in timer units,
+  as calibrated by my_timer_init() at server startup.
+  Subtracted from measured waits, so that very short waits are
+  not over-reported by the cost of the timer reads themselves.
+*/
+extern ulonglong wait_timer_overhead;
+
 /** Initialize the timer component. */
 void init_timers();
 
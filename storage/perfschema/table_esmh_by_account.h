@@ -0,0 +1,173 @@
+/* Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License, version 2.0,
+  as published by the Free Software Foundation.
+
+  This program is also distributed with certain software (including
+  but not limited to OpenSSL) that is licensed under separate terms,
+  as designated in a particular file or component or in included license
+  documentation.  The authors of MySQL hereby grant you an additional
+  permission to link the program and your derivative works with the
+  separately licensed software that they have included with MySQL.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License, version 2.0, for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
+  */
+
+#ifndef TABLE_ESMH_BY_ACCOUNT_H
+#define TABLE_ESMH_BY_ACCOUNT_H
+
+/**
+  @file storage/perfschema/table_esmh_by_account.h
+  Table EVENTS_STATEMENTS_HISTOGRAM_BY_ACCOUNT (declarations).
+*/
+
+#include "storage/perfschema/pfs_account.h"
+#include "storage/perfschema/table_helper.h"
+
+/**
+  @addtogroup performance_schema_tables
+  @{
+*/
+
+/**
+  Position of a cursor on
+  PERFORMANCE_SCHEMA.EVENTS_STATEMENTS_HISTOGRAM_BY_ACCOUNT.
+  Index 1 on account (0 based).
+  Index 2 on buckets (0 based).
+*/
+struct pos_esmh_by_account : public PFS_double_index {
+  pos_esmh_by_account() : PFS_double_index(0, 0) {}
+
+  inline void reset(void) {
+    m_index_1 = 0;
+    m_index_2 = 0;
+  }
+
+  inline void next_account(void) {
+    m_index_1++;
+    m_index_2 = 0;
+  }
+
+  inline bool has_more_buckets(void) { return (m_index_2 < NUMBER_OF_BUCKETS); }
+
+  inline void next_bucket(void) { m_index_2++; }
+};
+
+class PFS_index_esmh_by_account : public PFS_engine_index {
+ public:
+  PFS_index_esmh_by_account()
+      : PFS_engine_index(&m_key_1, &m_key_2, &m_key_3),
+        m_key_1("USER"),
+        m_key_2("HOST"),
+        m_key_3("BUCKET_NUMBER") {}
+
+  ~PFS_index_esmh_by_account() {}
+
+  bool match_account(PFS_account *pfs);
+  bool match_bucket(ulong bucket_index);
+
+ private:
+  PFS_key_user m_key_1;
+  PFS_key_host m_key_2;
+  PFS_key_bucket_number m_key_3;
+};
+
+/**
+  A row of table
+  PERFORMANCE_SCHEMA.EVENTS_STATEMENTS_HISTOGRAM_BY_ACCOUNT.
+*/
+
+struct PFS_esmh_by_account_bucket {
+  /** Column COUNT_BUCKET. */
+  ulonglong m_count_bucket;
+  /** Column COUNT_BUCKET_AND_LOWER. */
+  ulonglong m_count_bucket_and_lower;
+};
+
+struct PFS_esmh_by_account_histogram {
+  /** Columns USER, HOST. */
+  PFS_account_row m_account;
+
+  /** Statistics for all buckets. */
+  PFS_esmh_by_account_bucket m_buckets[NUMBER_OF_BUCKETS];
+};
+
+struct row_esmh_by_account {
+  /*
+    No need to repeat USER, HOST here,
+    only materialize the parts of the row that changes per bucket.
+  */
+  /** Column BUCKET_NUMBER. */
+  ulong m_bucket_number;
+  /** Column BUCKET_TIMER_LOW. */
+  ulonglong m_bucket_timer_low;
+  /** Column BUCKET_TIMER_HIGH. */
+  ulonglong m_bucket_timer_high;
+  /** Column COUNT_BUCKET. */
+  ulonglong m_count_bucket;
+  /** Column COUNT_BUCKET_AND_LOWER. */
+  ulonglong m_count_bucket_and_lower;
+  /** Column BUCKET_QUANTILE. */
+  double m_percentile;
+};
+
+/** Table PERFORMANCE_SCHEMA.EVENTS_STATEMENTS_HISTOGRAM_BY_ACCOUNT. */
+class table_esmh_by_account : public PFS_engine_table {
+  typedef pos_esmh_by_account pos_t;
+
+ public:
+  /** Table share */
+  static PFS_engine_table_share m_share;
+  static PFS_engine_table *create(PFS_engine_table_share *);
+  static int delete_all_rows();
+  static ha_rows get_row_count();
+
+  virtual void reset_position(void);
+
+  virtual int rnd_next();
+  virtual int rnd_pos(const void *pos);
+
+  virtual int index_init(uint idx, bool sorted);
+  virtual int index_next();
+
+ protected:
+  virtual int read_row_values(TABLE *table, unsigned char *buf, Field **fields,
+                              bool read_all);
+
+  table_esmh_by_account();
+
+ public:
+  ~table_esmh_by_account() {}
+
+ protected:
+  int materialize(PFS_account *account);
+  int make_row(PFS_account *account, ulong bucket_index);
+
+ private:
+  /** Table share lock. */
+  static THR_LOCK m_table_lock;
+  /** Table definition. */
+  static Plugin_table m_table_def;
+
+  /** Current row. */
+  PFS_account *m_materialized_account;
+  PFS_esmh_by_account_histogram m_materialized_histogram;
+  row_esmh_by_account m_row;
+  /** Current position. */
+  pos_t m_pos;
+  /** Next position. */
+  pos_t m_next_pos;
+
+  PFS_index_esmh_by_account *m_opened_index;
+};
+
+/** @} */
+#endif
@@ -87,6 +87,10 @@ Plugin_table table_esms_by_digest::m_table_def(
     "  QUERY_SAMPLE_TEXT LONGTEXT,\n"
     "  QUERY_SAMPLE_SEEN TIMESTAMP(6) NOT NULL default 0,\n"
     "  QUERY_SAMPLE_TIMER_WAIT BIGINT unsigned NOT NULL,\n"
+    "  SUM_BUFFER_POOL_READ_REQUESTS BIGINT unsigned not null,\n"
+    "  SUM_BUFFER_POOL_READS BIGINT unsigned not null,\n"
+    "  SUM_BUFFER_POOL_PAGES_DIRTIED BIGINT unsigned not null,\n"
+    "  SUM_DATA_READ_BYTES BIGINT unsigned not null,\n"
     "  UNIQUE KEY (SCHEMA_NAME, DIGEST) USING HASH\n",
     /* Options */
     " ENGINE=PERFORMANCE_SCHEMA",
@@ -340,6 +344,18 @@ int table_esms_by_digest::read_row_values(TABLE *table, unsigned char *buf,
         case 34: /* QUERY_SAMPLE_TIMER_WAIT */
           set_field_ulonglong(f, m_row.m_query_sample_timer_wait);
           break;
+        case 35: /* SUM_BUFFER_POOL_READ_REQUESTS */
+          set_field_ulonglong(f, m_row.m_stat.m_buf_read_requests);
+          break;
+        case 36: /* SUM_BUFFER_POOL_READS */
+          set_field_ulonglong(f, m_row.m_stat.m_buf_reads);
+          break;
+        case 37: /* SUM_BUFFER_POOL_PAGES_DIRTIED */
+          set_field_ulonglong(f, m_row.m_stat.m_buf_pages_dirtied);
+          break;
+        case 38: /* SUM_DATA_READ_BYTES */
+          set_field_ulonglong(f, m_row.m_stat.m_data_read_bytes);
+          break;
         default: /* 3, ... COUNT/SUM/MIN/AVG/MAX */
           m_row.m_stat.set_field(f->field_index() - 3, f);
           break;
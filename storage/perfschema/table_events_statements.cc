@@ -92,6 +92,10 @@ Plugin_table table_events_statements_current::m_table_def(
     "  NESTING_EVENT_TYPE ENUM('TRANSACTION', 'STATEMENT', 'STAGE', 'WAIT'),\n"
     "  NESTING_EVENT_LEVEL INTEGER,\n"
     "  STATEMENT_ID BIGINT unsigned,\n"
+    "  BUFFER_POOL_READ_REQUESTS BIGINT unsigned not null,\n"
+    "  BUFFER_POOL_READS BIGINT unsigned not null,\n"
+    "  BUFFER_POOL_PAGES_DIRTIED BIGINT unsigned not null,\n"
+    "  DATA_READ_BYTES BIGINT unsigned not null,\n"
     "  PRIMARY KEY (THREAD_ID, EVENT_ID) USING HASH\n",
     /* Options */
     " ENGINE=PERFORMANCE_SCHEMA",
@@ -163,6 +167,10 @@ Plugin_table table_events_statements_history::m_table_def(
     "  NESTING_EVENT_TYPE ENUM('TRANSACTION', 'STATEMENT', 'STAGE', 'WAIT'),\n"
     "  NESTING_EVENT_LEVEL INTEGER,\n"
     "  STATEMENT_ID BIGINT unsigned,\n"
+    "  BUFFER_POOL_READ_REQUESTS BIGINT unsigned not null,\n"
+    "  BUFFER_POOL_READS BIGINT unsigned not null,\n"
+    "  BUFFER_POOL_PAGES_DIRTIED BIGINT unsigned not null,\n"
+    "  DATA_READ_BYTES BIGINT unsigned not null,\n"
     "  PRIMARY KEY (THREAD_ID, EVENT_ID) USING HASH\n",
     /* Options */
     " ENGINE=PERFORMANCE_SCHEMA",
@@ -233,7 +241,11 @@ Plugin_table table_events_statements_history_long::m_table_def(
     "  NESTING_EVENT_ID BIGINT unsigned,\n"
     "  NESTING_EVENT_TYPE ENUM('TRANSACTION', 'STATEMENT', 'STAGE', 'WAIT'),\n"
     "  NESTING_EVENT_LEVEL INTEGER,\n"
-    "  STATEMENT_ID BIGINT unsigned\n",
+    "  STATEMENT_ID BIGINT unsigned,\n"
+    "  BUFFER_POOL_READ_REQUESTS BIGINT unsigned not null,\n"
+    "  BUFFER_POOL_READS BIGINT unsigned not null,\n"
+    "  BUFFER_POOL_PAGES_DIRTIED BIGINT unsigned not null,\n"
+    "  DATA_READ_BYTES BIGINT unsigned not null\n",
     /* Options */
     " ENGINE=PERFORMANCE_SCHEMA",
     /* Tablespace */
@@ -363,6 +375,10 @@ int table_events_statements_common::make_row_part_1(
   m_row.m_sort_scan = statement->m_sort_scan;
   m_row.m_no_index_used = statement->m_no_index_used;
   m_row.m_no_good_index_used = statement->m_no_good_index_used;
+  m_row.m_buf_read_requests = statement->m_buf_read_requests;
+  m_row.m_buf_reads = statement->m_buf_reads;
+  m_row.m_buf_pages_dirtied = statement->m_buf_pages_dirtied;
+  m_row.m_data_read_bytes = statement->m_data_read_bytes;
 
   /* Copy the digest storage. */
   digest->copy(&statement->m_digest_storage);
@@ -626,6 +642,18 @@ int table_events_statements_common::read_row_values(TABLE *table,
             f->set_null();
           }
           break;
+        case 42: /* BUFFER_POOL_READ_REQUESTS */
+          set_field_ulonglong(f, m_row.m_buf_read_requests);
+          break;
+        case 43: /* BUFFER_POOL_READS */
+          set_field_ulonglong(f, m_row.m_buf_reads);
+          break;
+        case 44: /* BUFFER_POOL_PAGES_DIRTIED */
+          set_field_ulonglong(f, m_row.m_buf_pages_dirtied);
+          break;
+        case 45: /* DATA_READ_BYTES */
+          set_field_ulonglong(f, m_row.m_data_read_bytes);
+          break;
         default:
           DBUG_ASSERT(false);
       }
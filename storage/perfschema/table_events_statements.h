@@ -164,6 +164,14 @@ struct row_events_statements {
 
   /** Column STATEMENT_ID. */
   ulonglong m_statement_id;
+  /** Column BUFFER_POOL_READ_REQUESTS. */
+  ulonglong m_buf_read_requests;
+  /** Column BUFFER_POOL_READS. */
+  ulonglong m_buf_reads;
+  /** Column BUFFER_POOL_PAGES_DIRTIED. */
+  ulonglong m_buf_pages_dirtied;
+  /** Column DATA_READ_BYTES. */
+  ulonglong m_data_read_bytes;
 };
 
 /** Position of a cursor on PERFORMANCE_SCHEMA.EVENTS_STATEMENTS_CURRENT. */
@@ -875,6 +875,10 @@ struct PFS_statement_stat_row {
   ulonglong m_sort_scan;
   ulonglong m_no_index_used;
   ulonglong m_no_good_index_used;
+  ulonglong m_buf_read_requests;
+  ulonglong m_buf_reads;
+  ulonglong m_buf_pages_dirtied;
+  ulonglong m_data_read_bytes;
 
   /** Build a row from a memory buffer. */
   inline void set(time_normalizer *normalizer, const PFS_statement_stat *stat) {
@@ -900,6 +904,10 @@ struct PFS_statement_stat_row {
       m_sort_scan = stat->m_sort_scan;
       m_no_index_used = stat->m_no_index_used;
       m_no_good_index_used = stat->m_no_good_index_used;
+      m_buf_read_requests = stat->m_buf_read_requests;
+      m_buf_reads = stat->m_buf_reads;
+      m_buf_pages_dirtied = stat->m_buf_pages_dirtied;
+      m_data_read_bytes = stat->m_data_read_bytes;
     } else {
       m_timer1_row.reset();
 
@@ -922,6 +930,10 @@ struct PFS_statement_stat_row {
       m_sort_scan = 0;
       m_no_index_used = 0;
       m_no_good_index_used = 0;
+      m_buf_read_requests = 0;
+      m_buf_reads = 0;
+      m_buf_pages_dirtied = 0;
+      m_data_read_bytes = 0;
     }
   }
 
@@ -0,0 +1,188 @@
+/* Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License, version 2.0,
+  as published by the Free Software Foundation.
+
+  This program is also distributed with certain software (including
+  but not limited to OpenSSL) that is licensed under separate terms,
+  as designated in a particular file or component or in included license
+  documentation.  The authors of MySQL hereby grant you an additional
+  permission to link the program and your derivative works with the
+  separately licensed software that they have included with MySQL.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License, version 2.0, for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
+  */
+
+/**
+  @file storage/perfschema/table_memory_samples.cc
+  Table MEMORY_ALLOCATION_SAMPLES (implementation).
+*/
+
+#include "storage/perfschema/table_memory_samples.h"
+
+#include "my_thread.h"
+#include "sql/field.h"
+#include "sql/plugin_table.h"
+#include "sql/table.h"
+#include "storage/perfschema/pfs_column_types.h"
+#include "storage/perfschema/pfs_column_values.h"
+#include "storage/perfschema/pfs_global.h"
+#include "storage/perfschema/pfs_instr_class.h"
+
+THR_LOCK table_memory_samples::m_table_lock;
+
+Plugin_table table_memory_samples::m_table_def(
+    /* Schema name */
+    "performance_schema",
+    /* Name */
+    "memory_allocation_samples",
+    /* Definition */
+    "  EVENT_NAME VARCHAR(128) not null,\n"
+    "  FRAME_0 BIGINT unsigned not null,\n"
+    "  FRAME_1 BIGINT unsigned not null,\n"
+    "  FRAME_2 BIGINT unsigned not null,\n"
+    "  FRAME_3 BIGINT unsigned not null,\n"
+    "  COUNT_SAMPLED BIGINT unsigned not null,\n"
+    "  SUM_SAMPLED_BYTES BIGINT unsigned not null\n",
+    /* Options */
+    " ENGINE=PERFORMANCE_SCHEMA",
+    /* Tablespace */
+    nullptr);
+
+PFS_engine_table_share table_memory_samples::m_share = {
+    &pfs_truncatable_acl,
+    table_memory_samples::create,
+    nullptr, /* write_row */
+    table_memory_samples::delete_all_rows,
+    table_memory_samples::get_row_count,
+    sizeof(pos_t),
+    &m_table_lock,
+    &m_table_def,
+    false, /* perpetual */
+    PFS_engine_table_proxy(),
+    {0},
+    false /* m_in_purgatory */
+};
+
+PFS_engine_table *table_memory_samples::create(PFS_engine_table_share *) {
+  return new table_memory_samples();
+}
+
+int table_memory_samples::delete_all_rows() {
+  reset_memory_samples();
+  return 0;
+}
+
+ha_rows table_memory_samples::get_row_count(void) {
+  return MEMORY_SAMPLE_SLOTS;
+}
+
+table_memory_samples::table_memory_samples()
+    : PFS_engine_table(&m_share, &m_pos), m_pos(0), m_next_pos(0) {}
+
+void table_memory_samples::reset_position(void) {
+  m_pos.m_index = 0;
+  m_next_pos.m_index = 0;
+}
+
+int table_memory_samples::rnd_next(void) {
+  PFS_memory_sample_slot *slot;
+
+  for (m_pos.set_at(&m_next_pos); m_pos.m_index < MEMORY_SAMPLE_SLOTS;
+       m_pos.next()) {
+    slot = &memory_sample_array[m_pos.m_index];
+    if (slot->m_lock.is_populated()) {
+      if (!make_row(slot)) {
+        m_next_pos.set_after(&m_pos);
+        return 0;
+      }
+    }
+  }
+
+  return HA_ERR_END_OF_FILE;
+}
+
+int table_memory_samples::rnd_pos(const void *pos) {
+  PFS_memory_sample_slot *slot;
+
+  set_position(pos);
+  DBUG_ASSERT(m_pos.m_index < MEMORY_SAMPLE_SLOTS);
+  slot = &memory_sample_array[m_pos.m_index];
+
+  if (slot->m_lock.is_populated()) {
+    return make_row(slot);
+  }
+
+  return HA_ERR_RECORD_DELETED;
+}
+
+int table_memory_samples::make_row(PFS_memory_sample_slot *slot) {
+  pfs_optimistic_state lock;
+
+  slot->m_lock.begin_optimistic_lock(&lock);
+
+  PFS_memory_class *klass = slot->m_class;
+  if (klass == nullptr) {
+    return HA_ERR_RECORD_DELETED;
+  }
+
+  m_row.m_event_name.make_row(klass);
+
+  for (uint i = 0; i < MEMORY_SAMPLE_FRAMES; i++) {
+    m_row.m_frames[i] =
+        static_cast<ulonglong>(reinterpret_cast<uintptr_t>(slot->m_frames[i]));
+  }
+
+  m_row.m_count = slot->m_count.load();
+  m_row.m_bytes = slot->m_bytes.load();
+
+  if (!slot->m_lock.end_optimistic_lock(&lock)) {
+    return HA_ERR_RECORD_DELETED;
+  }
+
+  return 0;
+}
+
+int table_memory_samples::read_row_values(TABLE *table, unsigned char *buf,
+                                          Field **fields, bool read_all) {
+  Field *f;
+
+  /* Set the null bits */
+  DBUG_ASSERT(table->s->null_bytes == 1);
+  buf[0] = 0;
+
+  for (; (f = *fields); fields++) {
+    if (read_all || bitmap_is_set(table->read_set, f->field_index())) {
+      switch (f->field_index()) {
+        case 0: /* EVENT_NAME */
+          m_row.m_event_name.set_field(f);
+          break;
+        case 1: /* FRAME_0 */
+        case 2: /* FRAME_1 */
+        case 3: /* FRAME_2 */
+        case 4: /* FRAME_3 */
+          set_field_ulonglong(f, m_row.m_frames[f->field_index() - 1]);
+          break;
+        case 5: /* COUNT_SAMPLED */
+          set_field_ulonglong(f, m_row.m_count);
+          break;
+        case 6: /* SUM_SAMPLED_BYTES */
+          set_field_ulonglong(f, m_row.m_bytes);
+          break;
+        default:
+          DBUG_ASSERT(false);
+          break;
+      }
+    }
+  }
+
+  return 0;
+}
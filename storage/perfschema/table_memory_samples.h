@@ -0,0 +1,98 @@
+/* Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License, version 2.0,
+  as published by the Free Software Foundation.
+
+  This program is also distributed with certain software (including
+  but not limited to OpenSSL) that is licensed under separate terms,
+  as designated in a particular file or component or in included license
+  documentation.  The authors of MySQL hereby grant you an additional
+  permission to link the program and your derivative works with the
+  separately licensed software that they have included with MySQL.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License, version 2.0, for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
+  */
+
+#ifndef TABLE_MEMORY_SAMPLES_H
+#define TABLE_MEMORY_SAMPLES_H
+
+/**
+  @file storage/perfschema/table_memory_samples.h
+  Table MEMORY_ALLOCATION_SAMPLES (declarations).
+*/
+
+#include "storage/perfschema/pfs_memory_samples.h"
+#include "storage/perfschema/table_helper.h"
+
+/**
+  @addtogroup performance_schema_tables
+  @{
+*/
+
+/**
+  A row of table
+  PERFORMANCE_SCHEMA.MEMORY_ALLOCATION_SAMPLES.
+*/
+struct row_memory_samples {
+  /** Column EVENT_NAME. */
+  PFS_event_name_row m_event_name;
+  /** Columns FRAME_0 .. FRAME_3. */
+  ulonglong m_frames[MEMORY_SAMPLE_FRAMES];
+  /** Column COUNT_SAMPLED. */
+  ulonglong m_count;
+  /** Column SUM_SAMPLED_BYTES. */
+  ulonglong m_bytes;
+};
+
+/** Table PERFORMANCE_SCHEMA.MEMORY_ALLOCATION_SAMPLES. */
+class table_memory_samples : public PFS_engine_table {
+  typedef PFS_simple_index pos_t;
+
+ public:
+  /** Table share */
+  static PFS_engine_table_share m_share;
+  static PFS_engine_table *create(PFS_engine_table_share *);
+  static int delete_all_rows();
+  static ha_rows get_row_count();
+
+  virtual void reset_position(void);
+
+  virtual int rnd_next();
+  virtual int rnd_pos(const void *pos);
+
+ protected:
+  virtual int read_row_values(TABLE *table, unsigned char *buf, Field **fields,
+                              bool read_all);
+
+  table_memory_samples();
+
+ public:
+  ~table_memory_samples() {}
+
+ protected:
+  int make_row(PFS_memory_sample_slot *slot);
+
+ private:
+  /** Table share lock. */
+  static THR_LOCK m_table_lock;
+  /** Table definition. */
+  static Plugin_table m_table_def;
+
+  /** Current row. */
+  row_memory_samples m_row;
+  /** Current position. */
+  pos_t m_pos;
+  /** Next position. */
+  pos_t m_next_pos;
+};
+
+/** @} */
+#endif
@@ -88,7 +88,8 @@ Plugin_table table_replication_applier_status_by_worker::m_table_def(
     "  APPLYING_TRANSACTION_LAST_TRANSIENT_ERROR_NUMBER INTEGER not null,\n"
     "  APPLYING_TRANSACTION_LAST_TRANSIENT_ERROR_MESSAGE VARCHAR(1024),\n"
     "  APPLYING_TRANSACTION_LAST_TRANSIENT_ERROR_TIMESTAMP TIMESTAMP(6)\n"
-    "                                                        not null\n",
+    "                                                        not null,\n"
+    "  PARTITIONS_STOLEN_COUNT BIGINT UNSIGNED not null\n",
     /* Options */
     " ENGINE=PERFORMANCE_SCHEMA",
     /* Tablespace */
@@ -423,6 +424,8 @@ int table_replication_applier_status_by_worker::make_row(Master_info *mi) {
 
   m_row.thread_id = 0;
   m_row.thread_id_is_null = true;
+  /* A single threaded slave has no partitions to steal. */
+  m_row.partitions_stolen_count = 0;
 
   DBUG_ASSERT(mi != nullptr);
   DBUG_ASSERT(mi->rli != nullptr);
@@ -478,6 +481,7 @@ int table_replication_applier_status_by_worker::make_row(Slave_worker *w) {
 
   m_row.thread_id = 0;
   m_row.thread_id_is_null = true;
+  m_row.partitions_stolen_count = w->partitions_stolen;
 
   m_row.channel_name_length = strlen(w->get_channel());
   memcpy(m_row.channel_name, (char *)w->get_channel(),
@@ -654,6 +658,9 @@ int table_replication_applier_status_by_worker::read_row_values(
         case 23: /*applying_trx_last_retry_timestamp*/
           set_field_timestamp(f, m_row.applying_trx_last_retry_timestamp);
           break;
+        case 24: /*partitions_stolen_count*/
+          set_field_ulonglong(f, m_row.partitions_stolen_count);
+          break;
         default:
           DBUG_ASSERT(false);
       }
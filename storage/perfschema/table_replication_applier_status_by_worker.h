@@ -102,6 +102,7 @@ struct st_row_worker {
   char applying_trx_last_retry_err_msg[MAX_SLAVE_ERRMSG];
   uint applying_trx_last_retry_err_msg_length;
   ulonglong applying_trx_last_retry_timestamp;
+  ulonglong partitions_stolen_count;
 };
 
 /**
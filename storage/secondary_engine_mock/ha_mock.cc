@@ -23,13 +23,17 @@
 #include "storage/secondary_engine_mock/ha_mock.h"
 
 #include <stddef.h>
+#include <stdint.h>
 #include <algorithm>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "lex_string.h"
 #include "my_alloc.h"
@@ -40,12 +44,14 @@
 #include "mysql/plugin.h"
 #include "mysqld_error.h"
 #include "sql/debug_sync.h"
+#include "sql/field.h"
 #include "sql/handler.h"
 #include "sql/sql_class.h"
 #include "sql/sql_const.h"
 #include "sql/sql_lex.h"
 #include "sql/sql_optimizer.h"
 #include "sql/table.h"
+#include "sql_string.h"
 #include "template_utils.h"
 #include "thr_lock.h"
 
@@ -53,19 +59,54 @@ namespace dd {
 class Table;
 }
 
-namespace {
+namespace mock {
+
+/// Code used in MockColumn::rows for SQL NULL values.
+constexpr uint32_t NULL_CODE = std::numeric_limits<uint32_t>::max();
+
+/**
+  Dictionary-encoded copy of one column. Each distinct value is stored
+  once in the dictionary, and the rows are a vector of codes into it, so
+  low-cardinality columns (the typical GROUP BY columns) take a few
+  bytes per row regardless of their width in the row store.
+*/
+struct MockColumn {
+  /// The distinct values of the column, indexed by code.
+  std::vector<std::string> dictionary;
+  /// Value-to-code lookup, used only while the table is being loaded.
+  std::unordered_map<std::string, uint32_t> codes;
+  /// One code per row; NULL_CODE for SQL NULL.
+  std::vector<uint32_t> rows;
+};
 
 struct MockShare {
   THR_LOCK lock;
   MockShare() { thr_lock_init(&lock); }
   ~MockShare() { thr_lock_delete(&lock); }
 
+  /// The columnar copy of the table, one entry per column in the
+  /// TABLE_SHARE. Built by load_table(), immutable afterwards, and
+  /// destroyed with the share on SECONDARY_UNLOAD or DROP TABLE.
+  std::vector<MockColumn> columns;
+
+  /// Number of rows in the columnar copy.
+  size_t row_count{0};
+
+  /// Whether load_table() has completed for this table.
+  bool loaded{false};
+
   // Not copyable. The THR_LOCK object must stay where it is in memory
   // after it has been initialized.
   MockShare(const MockShare &) = delete;
   MockShare &operator=(const MockShare &) = delete;
 };
 
+}  // namespace mock
+
+namespace {
+
+using mock::MockShare;
+
 // Map from (db_name, table_name) to the MockShare with table state.
 class LoadedTables {
   std::map<std::pair<std::string, std::string>, MockShare> m_tables;
@@ -143,16 +184,55 @@ int ha_mock::open(const char *, int, unsigned int, const dd::Table *) {
     my_error(ER_SECONDARY_ENGINE_PLUGIN, MYF(0), "Table has not been loaded");
     return HA_ERR_GENERIC;
   }
+  m_share = share;
   thr_lock_data_init(&share->lock, &m_lock, nullptr);
   return 0;
 }
 
+int ha_mock::rnd_init(bool) {
+  m_current_row = 0;
+  return 0;
+}
+
+int ha_mock::rnd_next(unsigned char *) {
+  if (m_share == nullptr || !m_share->loaded ||
+      m_current_row >= m_share->row_count) {
+    return HA_ERR_END_OF_FILE;
+  }
+
+  // The scan writes all columns, not only the ones the query reads.
+  my_bitmap_map *old_map = dbug_tmp_use_all_columns(table, table->write_set);
+
+  for (unsigned int i = 0; i < table->s->fields; ++i) {
+    Field *field = table->field[i];
+    const mock::MockColumn &column = m_share->columns[i];
+    const uint32_t code = column.rows[m_current_row];
+
+    if (code == mock::NULL_CODE) {
+      field->set_null();
+      continue;
+    }
+
+    field->set_notnull();
+    const std::string &value = column.dictionary[code];
+    field->store(value.data(), value.length(), field->charset());
+  }
+
+  dbug_tmp_restore_column_map(table->write_set, old_map);
+
+  ++m_current_row;
+  return 0;
+}
+
 int ha_mock::info(unsigned int flags) {
   // Get the cardinality statistics from the primary storage engine.
   handler *primary = ha_get_primary_handler();
   int ret = primary->info(flags);
   if (ret == 0) {
-    stats.records = primary->stats.records;
+    // The columnar copy knows its exact row count.
+    stats.records = m_share != nullptr && m_share->loaded
+                        ? m_share->row_count
+                        : primary->stats.records;
   }
   return ret;
 }
@@ -202,12 +282,79 @@ int ha_mock::prepare_load_table(const TABLE &table_arg) {
 
 int ha_mock::load_table(const TABLE &table_arg) {
   DBUG_ASSERT(table_arg.file != nullptr);
-  if (loaded_tables->get(table_arg.s->db.str, table_arg.s->table_name.str) ==
-      nullptr) {
+  MockShare *share =
+      loaded_tables->get(table_arg.s->db.str, table_arg.s->table_name.str);
+  if (share == nullptr) {
     my_error(ER_NO_SUCH_TABLE, MYF(0), table_arg.s->db.str,
              table_arg.s->table_name.str);
     return HA_ERR_KEY_NOT_FOUND;
   }
+
+  // Build the columnar copy by scanning the table in the primary
+  // storage engine and dictionary-encoding each column. SECONDARY_LOAD
+  // holds an MDL that keeps readers out until the copy is complete.
+  TABLE *table = const_cast<TABLE *>(&table_arg);
+  handler *primary = table->file;
+
+  share->loaded = false;
+  share->row_count = 0;
+  share->columns.clear();
+  share->columns.resize(table->s->fields);
+
+  // The conversion reads all columns, regardless of the read set the
+  // statement arrived with.
+  my_bitmap_map *old_map = tmp_use_all_columns(table, table->read_set);
+
+  int err = primary->ha_rnd_init(true);
+  if (err != 0) {
+    tmp_restore_column_map(table->read_set, old_map);
+    return err;
+  }
+
+  for (;;) {
+    err = primary->ha_rnd_next(table->record[0]);
+    if (err != 0) break;
+
+    for (unsigned int i = 0; i < table->s->fields; ++i) {
+      Field *field = table->field[i];
+      mock::MockColumn &column = share->columns[i];
+
+      if (field->is_null()) {
+        column.rows.push_back(mock::NULL_CODE);
+        continue;
+      }
+
+      StringBuffer<MAX_FIELD_WIDTH> buffer;
+      String *value = field->val_str(&buffer);
+
+      auto insert = column.codes.emplace(
+          std::string(value->ptr(), value->length()),
+          static_cast<uint32_t>(column.dictionary.size()));
+      if (insert.second) {
+        column.dictionary.push_back(insert.first->first);
+      }
+      column.rows.push_back(insert.first->second);
+    }
+
+    ++share->row_count;
+  }
+
+  primary->ha_rnd_end();
+
+  tmp_restore_column_map(table->read_set, old_map);
+
+  if (err != HA_ERR_END_OF_FILE) {
+    share->columns.clear();
+    share->row_count = 0;
+    return err;
+  }
+
+  // The value-to-code maps were only needed during the conversion.
+  for (auto &column : share->columns) {
+    column.codes.clear();
+  }
+
+  share->loaded = true;
   return 0;
 }
 
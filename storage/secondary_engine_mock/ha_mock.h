@@ -23,6 +23,8 @@
 #ifndef PLUGIN_SECONDARY_ENGINE_MOCK_HA_MOCK_H_
 #define PLUGIN_SECONDARY_ENGINE_MOCK_HA_MOCK_H_
 
+#include <stddef.h>
+
 #include "my_base.h"
 #include "sql/handler.h"
 #include "thr_lock.h"
@@ -37,6 +39,8 @@ class Table;
 
 namespace mock {
 
+struct MockShare;
+
 /**
  * The MOCK storage engine is used for testing MySQL server functionality
  * related to secondary storage engines.
@@ -48,6 +52,12 @@ namespace mock {
  * to facilitate pushing MySQL server code changes to mysql-trunk with test
  * coverage without depending on ongoing work of other storage engines.
  *
+ * In addition to the plumbing needed for the offload hooks, the engine
+ * keeps an in-memory, dictionary-encoded columnar copy of each loaded
+ * table, built from the primary engine at SECONDARY_LOAD time, and
+ * answers table scans from it, so that offloaded queries return real
+ * results instead of an empty set.
+ *
  * @note This mock storage engine does not support being set as a primary
  * storage engine.
  */
@@ -65,9 +75,9 @@ class ha_mock : public handler {
 
   int close() override { return 0; }
 
-  int rnd_init(bool) override { return 0; }
+  int rnd_init(bool) override;
 
-  int rnd_next(unsigned char *) override { return HA_ERR_END_OF_FILE; }
+  int rnd_next(unsigned char *) override;
 
   int rnd_pos(unsigned char *, unsigned char *) override {
     return HA_ERR_WRONG_COMMAND;
@@ -97,6 +107,12 @@ class ha_mock : public handler {
                    bool error_if_not_loaded) override;
 
   THR_LOCK_DATA m_lock;
+
+  /// The shared state of the table, with its columnar copy.
+  MockShare *m_share{nullptr};
+
+  /// The next row to return from the columnar copy during a table scan.
+  size_t m_current_row{0};
 };
 
 }  // namespace mock
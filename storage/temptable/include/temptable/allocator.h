@@ -27,6 +27,7 @@ TempTable custom allocator. */
 #define TEMPTABLE_ALLOCATOR_H
 
 #include <algorithm>  // std::max
+#include <array>      // std::array
 #include <cstddef>    // size_t
 #include <limits>     // std::numeric_limits
 #include <memory>     // std::shared_ptr
@@ -122,6 +123,98 @@ struct Exponential {
 };
 }  // namespace AllocationScheme
 
+/** Small per-thread cache of fully-freed RAM blocks.
+ *
+ * Without the cache, every block that becomes fully free is returned to the
+ * OS at once and a new one is requested shortly after, with every such
+ * crossing bouncing the shared MemoryMonitor atomic counter between all
+ * sessions. The cache keeps the last few fully-freed blocks aside, per
+ * thread, so the common create-table/insert/drop-table churn is fed from
+ * here instead.
+ *
+ * Since the cached blocks were faulted in by this very thread (allocations
+ * are NUMA-local, see Memory<Source::RAM>), reusing them keeps the memory
+ * on the local node.
+ *
+ * The cache also batches the MemoryMonitor accounting: bytes held here stay
+ * accounted as RAM consumption, so neither caching nor reusing a block
+ * touches the shared counter; it is only updated when a block is actually
+ * taken from or returned to the OS. The blocks a thread still holds at exit
+ * are released by the thread-local destructor.
+ *
+ * Only blocks of at most ALLOCATOR_BLOCK_CACHE_MAX_BLOCK_BYTES are cached,
+ * and nothing is cached while RAM consumption is at the threshold, so that
+ * idle threads cannot pin memory which the rest of the server needs.
+ */
+class Block_cache : private MemoryMonitor {
+ public:
+  Block_cache() noexcept : m_n_blocks(0) {}
+
+  /** Destructor. Returns all still-cached blocks to the OS. */
+  ~Block_cache() {
+    for (size_t i = 0; i < m_n_blocks; ++i) {
+      MemoryMonitor::ram_decrease(m_blocks[i].size());
+      m_blocks[i].destroy();
+    }
+  }
+
+  Block_cache(const Block_cache &) = delete;
+  void operator=(const Block_cache &) = delete;
+
+  /** Get the cache of the current thread. */
+  static Block_cache &instance() {
+    static thread_local Block_cache block_cache;
+    return block_cache;
+  }
+
+  /** Try to take over a fully-freed RAM block. On success the block stays
+   * accounted in MemoryMonitor and the caller must neither destroy it nor
+   * decrease the RAM consumption.
+   *
+   * [in] Block to cache, must be a fully-freed RAM block.
+   * @return true if the block was cached. */
+  bool put(const Block &block) {
+    DBUG_ASSERT(!block.is_empty());
+    DBUG_ASSERT(block.type() == Source::RAM);
+    if (m_n_blocks == m_blocks.size() ||
+        block.size() > ALLOCATOR_BLOCK_CACHE_MAX_BLOCK_BYTES ||
+        MemoryMonitor::ram_consumption() >= MemoryMonitor::ram_threshold()) {
+      return false;
+    }
+    m_blocks[m_n_blocks++] = block;
+    return true;
+  }
+
+  /** Try to find a cached block of at least the given size. The best
+   * (smallest) fit is returned so that large blocks are not burned on small
+   * requests.
+   *
+   * [in] Minimum block size in bytes.
+   * @return A cached block, or an empty block on cache miss. */
+  Block get(size_t block_size) {
+    size_t best = m_n_blocks;
+    for (size_t i = 0; i < m_n_blocks; ++i) {
+      if (m_blocks[i].size() >= block_size &&
+          (best == m_n_blocks || m_blocks[i].size() < m_blocks[best].size())) {
+        best = i;
+      }
+    }
+    if (best == m_n_blocks) {
+      return Block();
+    }
+    Block block = m_blocks[best];
+    m_blocks[best] = m_blocks[--m_n_blocks];
+    return block;
+  }
+
+ private:
+  /** Cached blocks. Slots at index >= m_n_blocks are unused. */
+  std::array<Block, ALLOCATOR_BLOCK_CACHE_MAX_BLOCKS> m_blocks;
+
+  /** Number of blocks currently cached. */
+  size_t m_n_blocks;
+};
+
 /**
   Shared state between all instances of a given allocator.
 
@@ -150,6 +243,16 @@ struct AllocatorState {
    * new block needs to be created.
    */
   size_t number_of_blocks = 0;
+
+  /**
+   * True if this allocator may use RAM up to the full temptable_max_ram
+   * threshold. Allocators without RAM priority leave a headroom of
+   * temptable_max_ram / ALLOCATOR_RAM_PRIORITY_HEADROOM_DIVISOR untouched
+   * and spill to MMAP-backed blocks earlier, so that RAM-priority users
+   * (the index structures, whose access pattern is random) can stay
+   * memory-resident while bulk row data overflows to disk.
+   */
+  bool ram_priority = false;
 };
 
 /** Custom memory allocator. All dynamic memory used by the TempTable engine
@@ -188,7 +291,9 @@ struct AllocatorState {
  * Allocator will also keep track of RAM-consumption and in case it reaches the
  * threshold defined by temptable_max_ram, it will switch to MMAP-backed block
  * allocations. It will switch back once RAM consumption is again below the
- * threshold. */
+ * threshold. Allocators without RAM priority switch a bit earlier (see
+ * AllocatorState::ram_priority), so that a table whose rows have overflowed
+ * to disk can still keep its index structures in RAM. */
 template <class T, class AllocationScheme = AllocationScheme::Exponential>
 class Allocator : private MemoryMonitor {
   static_assert(alignof(T) <= Block::ALIGN_TO,
@@ -211,7 +316,13 @@ class Allocator : private MemoryMonitor {
   };
 
   /** Constructor. */
-  explicit Allocator(Block *shared_block);
+  explicit Allocator(
+      /** [in] Block of memory which may be shared with other instances, or
+       * nullptr. */
+      Block *shared_block,
+      /** [in] True if this allocator may consume RAM up to the full
+       * temptable_max_ram threshold, see AllocatorState::ram_priority. */
+      bool ram_priority = false);
 
   /** Constructor from allocator of another type. The state is copied into the
    * new object. */
@@ -302,9 +413,12 @@ class Allocator : private MemoryMonitor {
 /* Implementation of inlined methods. */
 
 template <class T, class AllocationScheme>
-inline Allocator<T, AllocationScheme>::Allocator(Block *shared_block)
+inline Allocator<T, AllocationScheme>::Allocator(Block *shared_block,
+                                                 bool ram_priority)
     : m_state(std::make_shared<AllocatorState>()),
-      m_shared_block(shared_block) {}
+      m_shared_block(shared_block) {
+  m_state->ram_priority = ram_priority;
+}
 
 template <class T, class AllocationScheme>
 template <class U>
@@ -360,13 +474,33 @@ inline T *Allocator<T, AllocationScheme>::allocate(size_t n_elements) {
              !m_state->current_block.can_accommodate(n_bytes_requested)) {
     const size_t block_size = AllocationScheme::block_size(
         m_state->number_of_blocks, n_bytes_requested);
-    const Source block_source = [block_size]() {
+
+    /* Prefer a NUMA-local block cached by this thread; it is already
+     * accounted in the MemoryMonitor. */
+    Block cached_block = Block_cache::instance().get(block_size);
+    if (!cached_block.is_empty()) {
+      m_state->current_block = cached_block;
+      block = &m_state->current_block;
+      ++m_state->number_of_blocks;
+      T *chunk_data =
+          reinterpret_cast<T *>(block->allocate(n_bytes_requested).data());
+      DBUG_ASSERT(reinterpret_cast<uintptr_t>(chunk_data) % alignof(T) == 0);
+      return chunk_data;
+    }
+    const bool ram_priority = m_state->ram_priority;
+    const Source block_source = [block_size, ram_priority]() {
       // Decide whether to switch between RAM and MMAP-backed allocations.
-      if (MemoryMonitor::ram_consumption() >= MemoryMonitor::ram_threshold()) {
+      // Allocators without RAM priority spill to MMAP slightly earlier,
+      // leaving a headroom so that RAM-priority allocators (the index
+      // structures) can keep growing in RAM.
+      size_t threshold = MemoryMonitor::ram_threshold();
+      if (!ram_priority) {
+        threshold -= threshold / ALLOCATOR_RAM_PRIORITY_HEADROOM_DIVISOR;
+      }
+      if (MemoryMonitor::ram_consumption() >= threshold) {
         return Source::MMAP_FILE;
       } else {
-        if (MemoryMonitor::ram_increase(block_size) <=
-            MemoryMonitor::ram_threshold()) {
+        if (MemoryMonitor::ram_increase(block_size) <= threshold) {
           return Source::RAM;
         } else {
           MemoryMonitor::ram_decrease(block_size);
@@ -406,12 +540,22 @@ inline void Allocator<T, AllocationScheme>::deallocate(T *chunk_data,
       // Do nothing. Keep the last block alive.
     } else {
       DBUG_ASSERT(m_state->number_of_blocks > 0);
+      bool cached = false;
       if (block.type() == Source::RAM) {
-        MemoryMonitor::ram_decrease(block.size());
+        cached = Block_cache::instance().put(block);
+        if (!cached) {
+          MemoryMonitor::ram_decrease(block.size());
+        }
       }
       if (block == m_state->current_block) {
-        m_state->current_block.destroy();
-      } else {
+        if (cached) {
+          /* The cache owns the block now; forget it without returning
+           * it to the OS. */
+          m_state->current_block = Block();
+        } else {
+          m_state->current_block.destroy();
+        }
+      } else if (!cached) {
         block.destroy();
       }
       --m_state->number_of_blocks;
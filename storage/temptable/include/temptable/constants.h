@@ -80,6 +80,23 @@ constexpr bool DEBUG_BUILD = false;
 /** Store L1-dcache size information into the constexpr expression. */
 constexpr size_t L1_DCACHE_SIZE = CPU_LEVEL1_DCACHE_LINESIZE;
 
+/** Maximum number of fully-freed RAM blocks a thread may keep aside for
+ * reuse (see `Block_cache`). */
+constexpr size_t ALLOCATOR_BLOCK_CACHE_MAX_BLOCKS = 4;
+
+/** Largest block (in bytes) eligible for per-thread caching. Blocks larger
+ * than this are always returned to the OS immediately so that a thread
+ * cannot hoard an excessive amount of memory. */
+constexpr size_t ALLOCATOR_BLOCK_CACHE_MAX_BLOCK_BYTES = 4_MiB;
+
+/** Denominator of the fraction of `temptable_max_ram` which is kept in
+ * reserve for RAM-priority allocators (see `AllocatorState::ram_priority`).
+ * Allocators without RAM priority switch to MMAP-backed blocks once RAM
+ * consumption reaches `temptable_max_ram - temptable_max_ram / divisor`, so
+ * that index structures can keep growing in RAM after row data has started
+ * to spill to disk. */
+constexpr size_t ALLOCATOR_RAM_PRIORITY_HEADROOM_DIVISOR = 16;
+
 /** Number of shards in key-value store. */
 constexpr size_t KV_STORE_SHARDS_COUNT = 16 * 1024;
 
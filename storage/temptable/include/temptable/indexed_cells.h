@@ -276,7 +276,11 @@ inline void Indexed_cells::export_row_to_mysql(const Columns &columns,
     memcpy(mysql_row, m_mysql_buf, mysql_row_length);
     return;
   } else if (m_data_location == Data_location::ROW) {
-    m_row->copy_to_mysql_row(columns, mysql_row, mysql_row_length);
+    /* Rows fetched through an index may be read back and compared by the
+     * server (eg for duplicate elimination), so all cells are converted
+     * here, regardless of the current read set. */
+    m_row->copy_to_mysql_row(columns, mysql_row, mysql_row_length,
+                             /*read_set=*/nullptr);
     return;
   }
 
@@ -384,6 +384,7 @@ f7  | .   | from above (8/8)
 
 #include <algorithm>
 
+#include "my_bitmap.h"
 #include "my_dbug.h"
 #include "sql/field.h"
 #include "storage/temptable/include/temptable/allocator.h"
@@ -441,7 +442,12 @@ class Row {
       /** [out] Destination buffer to copy the row to. */
       unsigned char *mysql_row,
       /** [in] Presumed length of the mysql row in bytes. */
-      size_t mysql_row_length) const;
+      size_t mysql_row_length,
+      /** [in] Set of the columns the server is going to look at, or
+       * nullptr to convert all columns. Cells of columns whose bit is not
+       * set are skipped and the corresponding bytes in `mysql_row` are
+       * left untouched. */
+      const MY_BITMAP *read_set) const;
 
   /** Swaps contents of two rows. */
   static void swap(
@@ -75,7 +75,11 @@ class Table {
 
   const Storage &rows() const;
 
-  void row(const Storage::Iterator &pos, unsigned char *mysql_row) const;
+  /** Copy a row into a MySQL buffer. `read_set` designates the columns the
+   * server is going to look at (nullptr meaning all of them); for rows that
+   * are stored cell by cell, cells outside of it are not converted. */
+  void row(const Storage::Iterator &pos, unsigned char *mysql_row,
+           const MY_BITMAP *read_set) const;
 
   /** Insert a new row in the table. If something else than Result::OK is
    * returned, then the state of the table and its indexes is unchanged by the
@@ -149,6 +153,13 @@ class Table {
   /** Allocator for all members that need dynamic memory allocation. */
   Allocator<uint8_t> m_allocator;
 
+  /** Allocator for the index structures. Kept separate from `m_allocator`
+   * and created with RAM priority, so that when the table overflows
+   * temptable_max_ram it is the sequentially scanned row data that moves to
+   * MMAP-backed blocks while the randomly probed index buckets stay in RAM
+   * for as long as the threshold permits. */
+  Allocator<uint8_t> m_index_allocator;
+
   /** Rows of the table. */
   Storage m_rows;
 
@@ -196,8 +207,8 @@ inline const Column &Table::column(size_t i) const {
 
 inline const Storage &Table::rows() const { return m_rows; }
 
-inline void Table::row(const Storage::Iterator &pos,
-                       unsigned char *mysql_row) const {
+inline void Table::row(const Storage::Iterator &pos, unsigned char *mysql_row,
+                       const MY_BITMAP *read_set) const {
   DBUG_ASSERT(m_mysql_row_length == m_mysql_table_share->rec_buff_length);
 
   const Storage::Element *storage_element = *pos;
@@ -205,12 +216,14 @@ inline void Table::row(const Storage::Iterator &pos,
   if (m_all_columns_are_fixed_size) {
     DBUG_ASSERT(m_rows.element_size() == m_mysql_row_length);
 
+    /* The row is stored as one verbatim copy of the MySQL buffer; a plain
+     * memcpy beats per-column copying, so `read_set` is ignored here. */
     memcpy(mysql_row, storage_element, m_mysql_row_length);
   } else {
     DBUG_ASSERT(m_rows.element_size() == sizeof(Row));
 
     const Row *row = static_cast<const Row *>(storage_element);
-    row->copy_to_mysql_row(m_columns, mysql_row, m_mysql_row_length);
+    row->copy_to_mysql_row(m_columns, mysql_row, m_mysql_row_length, read_set);
   }
 }
 
@@ -258,7 +271,7 @@ inline void Table::append_new_index(const KEY &mysql_index) {
 
   auto mem_ptr = m_allocator.allocate(entry.m_alloc_size);
   try {
-    entry.m_index = new (mem_ptr) T(*this, mysql_index, m_allocator);
+    entry.m_index = new (mem_ptr) T(*this, mysql_index, m_index_allocator);
 
     m_index_entries.push_back(entry);
   } catch (...) {
@@ -261,7 +261,7 @@ int Handler::rnd_next(uchar *mysql_row) {
     m_rnd_iterator = rows.begin();
     if (m_rnd_iterator != rows.end()) {
       m_rnd_iterator_is_positioned = true;
-      m_opened_table->row(m_rnd_iterator, mysql_row);
+      m_opened_table->row(m_rnd_iterator, mysql_row, table->read_set);
       ret = Result::OK;
     } else {
       ret = Result::END_OF_FILE;
@@ -271,7 +271,7 @@ int Handler::rnd_next(uchar *mysql_row) {
     Storage::Element *previous = *m_rnd_iterator;
     ++m_rnd_iterator;
     if (m_rnd_iterator != rows.end()) {
-      m_opened_table->row(m_rnd_iterator, mysql_row);
+      m_opened_table->row(m_rnd_iterator, mysql_row, table->read_set);
       ret = Result::OK;
     } else {
       /* Undo the ++ operation above. The expectation of the users of the
@@ -313,7 +313,7 @@ int Handler::rnd_pos(uchar *mysql_row, uchar *position) {
 
   m_rnd_iterator_is_positioned = true;
 
-  m_opened_table->row(m_rnd_iterator, mysql_row);
+  m_opened_table->row(m_rnd_iterator, mysql_row, table->read_set);
 
   /* Marked unused - temporary fix for GCC 8 bug 82728. */
   const Result ret TEMPTABLE_UNUSED = Result::OK;
@@ -26,6 +26,7 @@ TempTable Row implementation. */
 #include <cstring>
 #include <utility>
 
+#include "my_bitmap.h"
 #include "my_dbug.h"
 #include "sql/field.h"
 #include "sql/table.h"
@@ -109,10 +110,18 @@ Result Row::copy_to_own_memory(const Columns &columns,
 }
 
 void Row::copy_to_mysql_row(const Columns &columns, unsigned char *mysql_row,
-                            size_t mysql_row_length) const {
+                            size_t mysql_row_length,
+                            const MY_BITMAP *read_set) const {
   DBUG_ASSERT(!m_data_is_in_mysql_memory);
 
   for (size_t i = 0; i < columns.size(); ++i) {
+    /* The server will not look at columns outside of its read set, so
+     * their cells need not be converted. Cells are stored per column, so
+     * skipping a cell skips its user data entirely. */
+    if (read_set != nullptr && !bitmap_is_set(read_set, i)) {
+      continue;
+    }
+
     const Column &column = columns[i];
     const Cell &cell = cells()[i];
 
@@ -49,6 +49,7 @@ namespace temptable {
 Table::Table(TABLE *mysql_table, Block *shared_block,
              bool all_columns_are_fixed_size)
     : m_allocator(shared_block),
+      m_index_allocator(nullptr, /* ram_priority */ true),
       m_rows(&m_allocator),
       m_all_columns_are_fixed_size(all_columns_are_fixed_size),
       m_indexes_are_enabled(true),
@@ -4883,9 +4883,68 @@ static size_t my_strnxfrm_any_uca(const CHARSET_INFO *cs, uchar *dst,
                          flags);
 }
 
+/**
+  Skip the longest common prefix of the two strings that consists only
+  of ASCII characters, comparing eight bytes at a time.
+
+  A byte-identical prefix produces identical weight sequences on every
+  level in both strings, so removing it from both sides does not change
+  the outcome of the comparison. Most comparisons that reach the weight
+  scanners are between strings sharing a long prefix (sorting and index
+  navigation compare near neighbors), so this skips the per-character
+  weight lookup for the bulk of the data when it is ASCII.
+
+  Only applied for collations without tailoring or reordering, the same
+  condition as the ASCII fast path in for_each_weight(). If the
+  collation has contractions or context-sensitive weights, the cut is
+  moved back so that no character that can participate in one is
+  separated from its potential continuation; a contraction or context
+  pair spanning the cut could otherwise give the remaining characters
+  different weights than a full scan.
+
+  @param         cs    the collation
+  @param[in,out] s     pointer to the first string, moved past the prefix
+  @param[in,out] slen  length of the first string, reduced accordingly
+  @param[in,out] t     pointer to the second string, moved past the prefix
+  @param[in,out] tlen  length of the second string, reduced accordingly
+*/
+static void skip_common_ascii_prefix(const CHARSET_INFO *cs, const uchar **s,
+                                     size_t *slen, const uchar **t,
+                                     size_t *tlen) {
+  if (cs->tailoring != nullptr || cs->coll_param != nullptr ||
+      cs->mbminlen != 1)
+    return;
+
+  const uchar *s0 = *s;
+  const uchar *t0 = *t;
+  const size_t len = std::min(*slen, *tlen);
+  size_t i = 0;
+
+  while (i + sizeof(uint64) <= len) {
+    uint64 s_chunk, t_chunk;
+    memcpy(&s_chunk, s0 + i, sizeof(s_chunk));
+    memcpy(&t_chunk, t0 + i, sizeof(t_chunk));
+    if (s_chunk != t_chunk || (s_chunk & 0x8080808080808080ULL) != 0) break;
+    i += sizeof(uint64);
+  }
+  while (i < len && s0[i] == t0[i] && s0[i] < 0x80) ++i;
+
+  if (my_uca_have_contractions(cs->uca)) {
+    const char *flags = cs->uca->contraction_flags;
+    while (i > 0 && flags[s0[i - 1] & MY_UCA_CNT_FLAG_MASK] != 0) --i;
+  }
+
+  *s = s0 + i;
+  *slen -= i;
+  *t = t0 + i;
+  *tlen -= i;
+}
+
 static int my_strnncoll_uca_900(const CHARSET_INFO *cs, const uchar *s,
                                 size_t slen, const uchar *t, size_t tlen,
                                 bool t_is_prefix) {
+  skip_common_ascii_prefix(cs, &s, &slen, &t, &tlen);
+
   if (cs->cset->mb_wc == my_mb_wc_utf8mb4_thunk) {
     switch (cs->levels_for_compare) {
       case 1:
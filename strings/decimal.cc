@@ -1189,6 +1189,118 @@ int decimal2longlong(const decimal_t *from, longlong *to) {
   return E_DEC_OK;
 }
 
+#ifdef __SIZEOF_INT128__
+
+/**
+  Convert a decimal to a 128-bit integer scaled by a power of ten.
+
+  The result is from * 10^scale, i.e. the decimal value with the decimal
+  point shifted scale digits to the right. No rounding is performed, so
+  the value must not have more than scale fractional digits, and it must
+  not have more than DECIMAL_INT128_DIGITS digits in total after scaling,
+  which guarantees that the result fits in the 127 bits of magnitude
+  available.
+
+  @param       from   the decimal value to convert
+  @param       scale  number of fractional digits in the fixed-point result
+  @param [out] to     the scaled integer value
+
+  @retval E_DEC_OK        on success
+  @retval E_DEC_OVERFLOW  if the scaled value might not fit in 128 bits
+  @retval E_DEC_TRUNCATED if the value has more than scale fractional digits
+*/
+int decimal2int128(const decimal_t *from, int scale, __int128 *to) {
+  DBUG_ASSERT(scale >= 0);
+  if (from->frac > scale) return E_DEC_TRUNCATED;
+  if (from->intg + scale > DECIMAL_INT128_DIGITS) return E_DEC_OVERFLOW;
+
+  const dec1 *buf = from->buf;
+  unsigned __int128 x = 0;
+  for (int intg = from->intg; intg > 0; intg -= DIG_PER_DEC1)
+    x = x * DIG_BASE + *buf++;
+  int frac = from->frac;
+  for (; frac >= DIG_PER_DEC1; frac -= DIG_PER_DEC1)
+    x = x * DIG_BASE + *buf++;
+  /* A partial word holds its digits in the most significant positions. */
+  if (frac > 0) x = x * powers10[frac] + *buf / powers10[DIG_PER_DEC1 - frac];
+  for (int shift = scale - from->frac; shift > 0; shift -= DIG_PER_DEC1)
+    x *= powers10[std::min(shift, DIG_PER_DEC1)];
+
+  *to = from->sign ? -static_cast<__int128>(x) : static_cast<__int128>(x);
+  return E_DEC_OK;
+}
+
+/**
+  Convert a 128-bit integer scaled by a power of ten to a decimal.
+
+  Inverse of decimal2int128(): from is interpreted as a fixed-point value
+  with scale fractional digits. Unlike decimal2int128(), the full 128-bit
+  range is accepted; only the capacity of to limits the conversion.
+
+  @param       from   the scaled integer value to convert
+  @param       scale  number of fractional digits in from
+  @param [out] to     decimal where the result will be stored
+                      to->buf and to->len must be set.
+
+  @retval E_DEC_OK/E_DEC_OVERFLOW
+*/
+int int128todecimal(__int128 from, int scale, decimal_t *to) {
+  DBUG_ASSERT(scale >= 0);
+  sanity(to);
+
+  unsigned __int128 x;
+  if ((to->sign = from < 0))
+    x = -static_cast<unsigned __int128>(from);
+  else
+    x = from;
+
+  /* Split off the fractional digits. */
+  unsigned __int128 divisor = 1;
+  for (int i = scale; i > 0; i -= DIG_PER_DEC1)
+    divisor *= powers10[std::min(i, DIG_PER_DEC1)];
+  unsigned __int128 ip = x / divisor;
+  unsigned __int128 fp = x % divisor;
+
+  int intg1;
+  if (ip == 0)
+    intg1 = 1;
+  else {
+    /* Count the number of decimal_digit_t's we need. */
+    unsigned __int128 y = ip;
+    for (intg1 = 0; y != 0; intg1++, y /= DIG_BASE)
+      ;
+  }
+  const int intg_words = intg1;
+  const int frac1 = ROUND_UP(scale);
+  if (unlikely(intg1 + frac1 > to->len)) {
+    decimal_make_zero(to);
+    return E_DEC_OVERFLOW;
+  }
+  to->intg = intg1 * DIG_PER_DEC1;
+  to->frac = scale;
+
+  dec1 *buf;
+  for (buf = to->buf + intg1; intg1; intg1--) {
+    unsigned __int128 y = ip / DIG_BASE;
+    *--buf = (dec1)(ip - y * DIG_BASE);
+    ip = y;
+  }
+
+  const int rem = scale % DIG_PER_DEC1;
+  buf = to->buf + intg_words + frac1;
+  if (rem) {
+    /* A partial word holds its digits in the most significant positions. */
+    *--buf = (dec1)(fp % powers10[rem]) * powers10[DIG_PER_DEC1 - rem];
+    fp /= powers10[rem];
+  }
+  for (; fp != 0; fp /= DIG_BASE) *--buf = (dec1)(fp % DIG_BASE);
+  while (buf > to->buf + ROUND_UP(to->intg)) *--buf = 0;
+
+  return E_DEC_OK;
+}
+
+#endif /* __SIZEOF_INT128__ */
+
 #define LLDIV_MIN -1000000000000000000LL
 #define LLDIV_MAX 1000000000000000000LL
 
@@ -631,6 +631,38 @@ TEST_F(DecimalTest, Decimal2Longlong) {
   test_d2ll("9223372036854775808", "9223372036854775807", 2);
 }
 
+#ifdef __SIZEOF_INT128__
+static void test_d2i128(const char *s, int scale, const char *result_s,
+                        int expected_res) {
+  const char *end = strend(s);
+  EXPECT_EQ(0, string2decimal(s, &a, &end));
+  __int128 x;
+  EXPECT_EQ(expected_res, decimal2int128(&a, scale, &x));
+  if (expected_res != E_DEC_OK) return;
+  EXPECT_EQ(0, int128todecimal(x, scale, &b));
+  char buf[100];
+  int len = sizeof(buf);
+  EXPECT_EQ(0, decimal2string(&b, buf, &len));
+  EXPECT_STREQ(result_s, buf);
+}
+
+TEST_F(DecimalTest, Int128RoundTrip) {
+  test_d2i128("12345.67", 2, "12345.67", 0);
+  test_d2i128("12345.67", 4, "12345.6700", 0);
+  test_d2i128("-123.456", 3, "-123.456", 0);
+  test_d2i128("0", 3, "0.000", 0);
+  /* The largest accepted magnitude: DECIMAL_INT128_DIGITS = 38 digits. */
+  test_d2i128("99999999999999999999999999999999999999", 0,
+              "99999999999999999999999999999999999999", 0);
+  test_d2i128("-9999999999999999999999999999.9999999999", 10,
+              "-9999999999999999999999999999.9999999999", 0);
+  /* 30 integer digits with scale 10 exceed 38 digits in total. */
+  test_d2i128("999999999999999999999999999999", 10, "", E_DEC_OVERFLOW);
+  /* More fractional digits than the requested scale: no rounding is done. */
+  test_d2i128("1.23", 1, "", E_DEC_TRUNCATED);
+}
+#endif /* __SIZEOF_INT128__ */
+
 TEST_F(DecimalTest, DoAdd) {
   test_da(".00012345000098765", "123.45", "123.45012345000098765", 0);
   test_da(".1", ".45", "0.55", 0);
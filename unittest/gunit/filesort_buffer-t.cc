@@ -22,12 +22,14 @@
 
 #include <gtest/gtest.h>
 #include <stddef.h>
+#include <string.h>
 #include <sys/types.h>
 #include <utility>
 
 #include "my_inttypes.h"
 #include "my_pointer_arithmetic.h"
 #include "sql/filesort_utils.h"
+#include "sql/sort_param.h"
 #include "sql/table.h"
 
 namespace filesort_buffer_unittest {
@@ -150,6 +152,43 @@ TEST_F(FileSortBufferTest, RecordPointersGetReclaimed) {
   }
 }
 
+TEST_F(FileSortBufferTest, RadixSortKeys) {
+  constexpr uint num_records = 512;  // Enough to take the radix sort path.
+  constexpr uint key_length = 8;
+
+  fs_info.set_max_size(32768, key_length);
+  for (uint ix = 0; ix < num_records; ++ix) {
+    Bounds_checked_array<uchar> buf =
+        fs_info.get_next_record_pointer(key_length);
+    ASSERT_GE(buf.size(), key_length);
+    // A mem-comparable (big-endian) key, written in descending order. The
+    // first two bytes are the same for all keys, so their radix passes are
+    // skipped; the multiplier scrambles the remaining bytes.
+    const uint32 value = (num_records - 1 - ix) * 2654435761U;
+    uchar *key = buf.array();
+    key[0] = 0;
+    key[1] = 42;
+    key[2] = ix & 1;
+    key[3] = ix & 3;
+    key[4] = value >> 24;
+    key[5] = (value >> 16) & 0xFF;
+    key[6] = (value >> 8) & 0xFF;
+    key[7] = value & 0xFF;
+    fs_info.commit_used_memory(key_length);
+  }
+
+  Sort_param param;
+  param.set_max_compare_length(key_length);
+  EXPECT_EQ(num_records, fs_info.sort_buffer(&param, num_records));
+  EXPECT_EQ(Sort_param::FILESORT_ALG_RADIX, param.m_sort_algorithm);
+
+  uchar **data = fs_info.get_sort_keys();
+  for (uint ix = 1; ix < num_records; ++ix) {
+    EXPECT_LE(memcmp(data[ix - 1], data[ix], key_length), 0)
+        << "index:" << ix;
+  }
+}
+
 TEST_F(FileSortBufferTest, PreallocateRecords) {
   fs_info.set_max_size(32768, sizeof(char));
   fs_info.preallocate_records(10);
@@ -26,6 +26,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "sql/item.h"
 #include "sql/item_cmpfunc.h"
@@ -72,6 +73,34 @@ TEST_F(ItemLikeTest, TestOne) {
   EXPECT_EQ(1, item_BM->val_int());
 }
 
+// Patterns with at most a leading and a trailing '%' are precompiled into
+// specialized byte-wise matchers for binary collations; make sure all the
+// shapes agree with the generic wildcard matching.
+TEST_F(ItemLikeTest, PrecompiledShapes) {
+  auto match = [this](const char *pattern) {
+    Item_string *it_text =
+        new Item_string(haystack, sizeof(haystack) - 1, &my_charset_bin);
+    Item_string *it_pattern =
+        new Item_string(pattern, strlen(pattern), &my_charset_bin);
+    Item_func_like *item =
+        new Item_func_like(it_text, it_pattern, it_escape, false);
+    EXPECT_FALSE(item->fix_fields(thd(), nullptr));
+    return item->val_int();
+  };
+
+  EXPECT_EQ(1, match("CAAAACCACT%"));      // Prefix, hit.
+  EXPECT_EQ(0, match("AAGTCAGG%"));        // Prefix, miss.
+  EXPECT_EQ(1, match("%AGGAACAC"));        // Suffix, hit.
+  EXPECT_EQ(0, match("%CAAAACCA"));        // Suffix, miss.
+  EXPECT_EQ(1, match("%%GGTGCTGGAG%%"));   // Contains, hit.
+  EXPECT_EQ(0, match("%TTTTTTT%"));        // Contains, miss.
+  EXPECT_EQ(1, match(haystack));           // Equality, hit.
+  EXPECT_EQ(0, match("CAAAACCACT"));       // Equality, miss.
+  EXPECT_EQ(1, match("%"));                // Matches anything.
+  EXPECT_EQ(0, match(""));                 // Matches the empty string only.
+  EXPECT_EQ(1, match("%AATGGCAATC_TTA%"));  // '_' keeps the generic path.
+}
+
 // Increase number when doing performance comparisons.
 // Run with ./unittest/gunit/item_like-t --disable-tap-output
 //   to get timings from googletest.
@@ -279,6 +279,13 @@ TEST_F(JsonBinaryTest, BasicTest) {
     Value val_lookup = val14.lookup(expected_keys[i]);
     EXPECT_EQ(Value::INT, val_lookup.type());
     EXPECT_EQ(expected_values[i], val_lookup.get_int64());
+
+    // Hinted lookup: a correct hint, a wrong hint and an out-of-bounds
+    // hint must all find the same element.
+    EXPECT_EQ(i, val14.lookup_index(expected_keys[i], i));
+    EXPECT_EQ(i, val14.lookup_index(expected_keys[i],
+                                    (i + 1) % val14.element_count()));
+    EXPECT_EQ(i, val14.lookup_index(expected_keys[i], val14.element_count()));
   }
 
   // Store a decimal.
@@ -601,6 +601,18 @@ TEST_F(StringsUTF8mb4_900Test, MyUCA900Collate) {
     LATIN SMALL LETTER AV.
   */
   EXPECT_TRUE(equals(u8"\ua73b", u8"\ua739"));
+
+  /*
+    Strings sharing a long ASCII prefix go through the common-prefix
+    skip in the comparison functions. Cover prefixes around the
+    eight-byte chunk size, with the difference both in ASCII and in a
+    multi-byte character.
+  */
+  EXPECT_TRUE(equals("abcdefghijklmnop", "ABCDEFGHIJKLMNOP"));
+  EXPECT_FALSE(equals("abcdefghijklmnoq", "abcdefghijklmnop"));
+  EXPECT_FALSE(equals("abcdefgh1", "abcdefgh2"));
+  EXPECT_TRUE(equals(u8"abcdefghijklmn\u00c6", u8"abcdefghijklmn\u00e6"));
+  EXPECT_FALSE(equals(u8"abcdefghijklmn\u00c6", u8"abcdefghijklmnB"));
 }
 
 class StringsUTF8mb4_900_AS_CS_NoPad_Test : public ::testing::Test {
@@ -21,6 +21,7 @@
    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
 
 #include <gtest/gtest.h>
+#include <stdio.h>
 #include <sys/types.h>
 
 #include "lex_string.h"
@@ -233,14 +234,28 @@ TEST_F(TableCacheBasicDeathTest, ManagerCreateAndDestroy) {
   // All caches are empty after creation
   EXPECT_EQ(0U, table_cache_manager.cached_tables());
 
-  // There should be two different caches in the manager
-  Table_cache *cache_1, *cache_2, *cache_3;
-  cache_1 = table_cache_manager.get_cache(get_thd(0));
-  cache_2 = table_cache_manager.get_cache(get_thd(1));
-  cache_3 = table_cache_manager.get_cache(get_thd(2));
-  EXPECT_TRUE(cache_1 != cache_2);
-  // And not three !
-  EXPECT_TRUE(cache_3 == cache_1);
+  // Tables are assigned to caches by hashing their keys, so the same
+  // key should always be mapped to the same cache.
+  const char *key_1 = "share_1";
+  Table_cache *cache_1 = table_cache_manager.get_cache(key_1, strlen(key_1));
+  EXPECT_TRUE(cache_1 == table_cache_manager.get_cache(key_1, strlen(key_1)));
+
+  // Both instances should be reachable through hashing, so scanning
+  // over a handful of keys should discover a second cache.
+  Table_cache *cache_2 = nullptr;
+  for (uint i = 0; i < 100 && cache_2 == nullptr; ++i) {
+    char key_buf[32];
+    size_t key_len =
+        static_cast<size_t>(snprintf(key_buf, sizeof(key_buf), "share_%u", i));
+    Table_cache *cache = table_cache_manager.get_cache(key_buf, key_len);
+    if (cache != cache_1) cache_2 = cache;
+  }
+  EXPECT_TRUE(cache_2 != nullptr);
+  // And hashing should not produce caches beyond the two requested ones.
+  EXPECT_TRUE(cache_1 == table_cache_manager.get_cache_by_index(0) ||
+              cache_1 == table_cache_manager.get_cache_by_index(1));
+  EXPECT_TRUE(cache_2 == table_cache_manager.get_cache_by_index(0) ||
+              cache_2 == table_cache_manager.get_cache_by_index(1));
 
   // Both caches should be empty
   EXPECT_EQ(0U, cache_1->cached_tables());
@@ -274,7 +289,7 @@ TEST_F(TableCacheSingleCacheTest, CacheAddAndRemove) {
   Mock_share share_1("share_1");
   TABLE *table_1 = share_1.create_table(thd);
 
-  Table_cache *table_cache = table_cache_manager.get_cache(thd);
+  Table_cache *table_cache = table_cache_manager.get_cache_by_index(0);
   table_cache->lock();
   add_used_table(table_cache, thd, table_1);
 
@@ -353,7 +368,7 @@ TEST_F(TableCacheSingleCacheTest, CacheOverflow) {
   TABLE *table_2 = share_1.create_table(thd);
   TABLE *table_3 = share_2.create_table(thd);
 
-  Table_cache *table_cache = table_cache_manager.get_cache(thd);
+  Table_cache *table_cache = table_cache_manager.get_cache_by_index(0);
 
   table_cache->lock();
   add_used_table(table_cache, thd, table_1);
@@ -395,6 +410,9 @@ TEST_F(TableCacheSingleCacheTest, CacheOverflow) {
   // The first table that gets released is expelled.
   EXPECT_EQ(2U, table_cache->cached_tables());
 
+  // All three expelled TABLE objects should have been counted as evictions.
+  EXPECT_EQ(3U, table_cache->evictions());
+
   table_cache->remove_table(table_1);
   table_cache->remove_table(table_3);
 
@@ -410,7 +428,7 @@ TEST_F(TableCacheSingleCacheTest, CacheOverflow) {
 TEST_F(TableCacheSingleCacheTest, CacheGetAndRelease) {
   THD *thd = get_thd(0);
 
-  Table_cache *table_cache = table_cache_manager.get_cache(thd);
+  Table_cache *table_cache = table_cache_manager.get_cache_by_index(0);
 
   table_cache->lock();
 
@@ -490,6 +508,11 @@ TEST_F(TableCacheSingleCacheTest, CacheGetAndRelease) {
   EXPECT_TRUE(table_3 == nullptr);
   EXPECT_TRUE(share_2 == &share_1);
 
+  // Lookups which returned an unused TABLE object should have been
+  // counted as hits, all the other lookups as misses.
+  EXPECT_EQ(3U, table_cache->hits());
+  EXPECT_EQ(7U, table_cache->misses());
+
   // Clean-up
   table_cache->remove_table(table_1);
   table_cache->remove_table(table_2);
@@ -508,8 +531,8 @@ TEST_F(TableCacheDoubleCacheTest, ManagerFreeAllUnused) {
   THD *thd_1 = get_thd(0);
   THD *thd_2 = get_thd(1);
 
-  Table_cache *table_cache_1 = table_cache_manager.get_cache(thd_1);
-  Table_cache *table_cache_2 = table_cache_manager.get_cache(thd_2);
+  Table_cache *table_cache_1 = table_cache_manager.get_cache_by_index(0);
+  Table_cache *table_cache_2 = table_cache_manager.get_cache_by_index(1);
 
   // There should be no TABLE instances in all cachea.
   EXPECT_EQ(0U, table_cache_manager.cached_tables());
@@ -594,8 +617,8 @@ TEST_F(TableCacheDoubleCacheTest, ManagerCachedTables) {
   THD *thd_1 = get_thd(0);
   THD *thd_2 = get_thd(1);
 
-  Table_cache *table_cache_1 = table_cache_manager.get_cache(thd_1);
-  Table_cache *table_cache_2 = table_cache_manager.get_cache(thd_2);
+  Table_cache *table_cache_1 = table_cache_manager.get_cache_by_index(0);
+  Table_cache *table_cache_2 = table_cache_manager.get_cache_by_index(1);
 
   // There should be no TABLE instances in all cachea.
   EXPECT_EQ(0U, table_cache_1->cached_tables());
@@ -689,8 +712,8 @@ TEST_F(TableCacheDoubleCacheDeathTest, ManagerLockAndUnlock) {
 
   // In addition to Table_cache_manager method we check this by
   // calling Table_cache methods and asserting state of LOCK_open.
-  Table_cache *cache_1 = table_cache_manager.get_cache(get_thd(0));
-  Table_cache *cache_2 = table_cache_manager.get_cache(get_thd(1));
+  Table_cache *cache_1 = table_cache_manager.get_cache_by_index(0);
+  Table_cache *cache_2 = table_cache_manager.get_cache_by_index(1);
 
   cache_1->assert_owner();
   cache_2->assert_owner();
@@ -715,8 +738,8 @@ TEST_F(TableCacheDoubleCacheDeathTest, ManagerFreeTable) {
   THD *thd_1 = get_thd(0);
   THD *thd_2 = get_thd(1);
 
-  Table_cache *table_cache_1 = table_cache_manager.get_cache(thd_1);
-  Table_cache *table_cache_2 = table_cache_manager.get_cache(thd_2);
+  Table_cache *table_cache_1 = table_cache_manager.get_cache_by_index(0);
+  Table_cache *table_cache_2 = table_cache_manager.get_cache_by_index(1);
 
   Mock_share share_1("share_1");
   Mock_share share_2("share_2");
@@ -860,8 +883,8 @@ TEST_F(TableCacheDoubleCacheTest, Iterator) {
   // Attempt to iterate behind the end should not give anything.
   EXPECT_TRUE(it++ == nullptr);
 
-  Table_cache *table_cache_1 = table_cache_manager.get_cache(thd_1);
-  Table_cache *table_cache_2 = table_cache_manager.get_cache(thd_2);
+  Table_cache *table_cache_1 = table_cache_manager.get_cache_by_index(0);
+  Table_cache *table_cache_2 = table_cache_manager.get_cache_by_index(1);
   TABLE *table_1 = share_1.create_table(thd_1);
   TABLE *table_2 = share_1.create_table(thd_1);
   TABLE *table_3 = share_2.create_table(thd_1);
@@ -60,6 +60,8 @@
 #endif
 #ifndef _WIN32
 #include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
 #endif
 #ifdef HAVE_POLL_H
 #include <poll.h>
@@ -242,6 +244,95 @@ size_t vio_write(Vio *vio, const uchar *buf, size_t size) {
   return ret;
 }
 
+#ifndef _WIN32
+
+/** sendmsg(2) with the same instrumentation as mysql_socket_send(). */
+static ssize_t socket_sendmsg(MYSQL_SOCKET mysql_socket,
+                              const struct msghdr *msg, int flags) {
+#ifdef HAVE_PSI_SOCKET_INTERFACE
+  if (mysql_socket.m_psi != nullptr) {
+    size_t bytes = 0;
+    for (size_t i = 0; i < (size_t)msg->msg_iovlen; i++)
+      bytes += msg->msg_iov[i].iov_len;
+
+    /* Instrumentation start */
+    PSI_socket_locker_state state;
+    PSI_socket_locker *locker = PSI_SOCKET_CALL(start_socket_wait)(
+        &state, mysql_socket.m_psi, PSI_SOCKET_SEND, bytes, __FILE__, __LINE__);
+
+    /* Instrumented code */
+    ssize_t result = sendmsg(mysql_socket.fd, msg, flags);
+
+    /* Instrumentation end */
+    if (locker != nullptr)
+      PSI_SOCKET_CALL(end_socket_wait)(locker, result > -1 ? result : 0);
+
+    return result;
+  }
+#endif
+
+  /* Non instrumented code */
+  return sendmsg(mysql_socket.fd, msg, flags);
+}
+
+/**
+  Write towards a connected peer with a single gathering write.
+
+  Plain TCP/IP and Unix socket transports gather the buffers with
+  sendmsg(2). Other transports, TLS in particular, cannot, and write
+  the first buffer through the regular write method instead; since the
+  caller advances the vector by whatever amount was written, the
+  fallback simply degenerates into one write per buffer.
+
+  @param vio    Vio object.
+  @param vec    Buffers to write.
+  @param count  Number of buffers.
+
+  @return Number of bytes written, possibly covering only a prefix of
+  the vector, or VIO_SOCKET_ERROR.
+*/
+
+size_t vio_writev(Vio *vio, struct iovec *vec, int count) {
+  ssize_t ret;
+  int flags = 0;
+  DBUG_TRACE;
+
+  if (vio->type != VIO_TYPE_TCPIP && vio->type != VIO_TYPE_SOCKET)
+    return vio_write(vio, static_cast<const uchar *>(vec[0].iov_base),
+                     vec[0].iov_len);
+
+  struct msghdr msg = {};
+  msg.msg_iov = vec;
+  msg.msg_iovlen = count;
+
+  /* If timeout is enabled, do not block. */
+  if (vio->write_timeout >= 0) flags = VIO_DONTWAIT;
+
+  while ((ret = socket_sendmsg(vio->mysql_socket, &msg, flags)) == -1) {
+    int error = socket_errno;
+
+    /* The operation would block? */
+#if SOCKET_EAGAIN == SOCKET_EWOULDBLOCK
+    if (error != SOCKET_EAGAIN)
+#else
+    if (error != SOCKET_EAGAIN && error != SOCKET_EWOULDBLOCK)
+#endif
+      break;
+
+    if (!vio_is_blocking(vio)) {
+      DBUG_PRINT("info", ("vio_writev on nonblocking socket written no bytes"));
+      return -1;
+    }
+
+    /* Wait for the output buffer to become writable.*/
+    if ((ret = vio_socket_io_wait(vio, VIO_IO_EVENT_WRITE))) break;
+  }
+
+  return ret;
+}
+
+#endif /* !_WIN32 */
+
 // WL#4896: Not covered
 int vio_set_blocking(Vio *vio, bool status) {
   DBUG_TRACE;
@@ -26,6 +26,7 @@
    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
 
 #include <string>
+#include <unordered_map>
 
 #include "m_ctype.h"
 #include "my_dbug.h"
@@ -436,8 +437,163 @@ static void deinit_lock_callback_functions() {
 
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
 
+/*
+  Server-side cache of TLS sessions used for session resumption.
+
+  OpenSSL's internal session cache is a single hash table protected by
+  one lock, which becomes a contention point when many short-lived
+  connections perform handshakes concurrently. The acceptor contexts
+  disable internal lookup and store sessions here instead: the cache is
+  sharded on the first byte of the session id, so concurrent handshakes
+  rarely touch the same lock. All acceptor contexts share the cache;
+  OpenSSL verifies the session id context on resumption, so a session
+  can only be reused with the context that created it.
+*/
+
+static const unsigned int SSL_SESSION_CACHE_SHARDS = 16;
+/* Per-shard cap, i.e. the whole cache holds at most 16 * 1024 sessions. */
+static const size_t SSL_SESSION_CACHE_SHARD_MAX_SIZE = 1024;
+
+#ifdef HAVE_PSI_INTERFACE
+static PSI_rwlock_key key_rwlock_ssl_session_cache;
+
+static PSI_rwlock_info ssl_session_cache_rwlocks[] = {
+    {&key_rwlock_ssl_session_cache, "st_ssl_session_cache_shard::lock", 0, 0,
+     nullptr}};
+#endif
+
+struct st_ssl_session_cache_shard {
+  mysql_rwlock_t lock;
+  std::unordered_map<std::string, SSL_SESSION *> *sessions;
+};
+
+static st_ssl_session_cache_shard
+    ssl_session_cache[SSL_SESSION_CACHE_SHARDS];
+static bool ssl_session_cache_initialized = false;
+
+static void init_ssl_session_cache() {
+#ifdef HAVE_PSI_INTERFACE
+  const char *category = "sql";
+  int count = static_cast<int>(array_elements(ssl_session_cache_rwlocks));
+  mysql_rwlock_register(category, ssl_session_cache_rwlocks, count);
+#endif
+
+  for (unsigned int i = 0; i < SSL_SESSION_CACHE_SHARDS; ++i) {
+#ifdef HAVE_PSI_INTERFACE
+    mysql_rwlock_init(key_rwlock_ssl_session_cache,
+                      &ssl_session_cache[i].lock);
+#else
+    mysql_rwlock_init(0, &ssl_session_cache[i].lock);
+#endif
+    ssl_session_cache[i].sessions =
+        new std::unordered_map<std::string, SSL_SESSION *>();
+  }
+  ssl_session_cache_initialized = true;
+}
+
+static void deinit_ssl_session_cache() {
+  if (!ssl_session_cache_initialized) return;
+  for (unsigned int i = 0; i < SSL_SESSION_CACHE_SHARDS; ++i) {
+    for (const auto &key_and_session : *ssl_session_cache[i].sessions)
+      SSL_SESSION_free(key_and_session.second);
+    delete ssl_session_cache[i].sessions;
+    ssl_session_cache[i].sessions = nullptr;
+    mysql_rwlock_destroy(&ssl_session_cache[i].lock);
+  }
+  ssl_session_cache_initialized = false;
+}
+
+static st_ssl_session_cache_shard *ssl_session_cache_get_shard(
+    const unsigned char *id, unsigned int id_len) {
+  return &ssl_session_cache[(id_len > 0 ? id[0] : 0) %
+                            SSL_SESSION_CACHE_SHARDS];
+}
+
+static int ssl_session_new_cb(SSL *, SSL_SESSION *session) {
+  unsigned int id_len;
+  const unsigned char *id = SSL_SESSION_get_id(session, &id_len);
+  if (id_len == 0) return 0;
+
+  st_ssl_session_cache_shard *shard = ssl_session_cache_get_shard(id, id_len);
+  std::string key((const char *)id, id_len);
+
+  mysql_rwlock_wrlock(&shard->lock);
+  auto it = shard->sessions->find(key);
+  if (it != shard->sessions->end()) {
+    SSL_SESSION_free(it->second);
+    it->second = session;
+  } else {
+    if (shard->sessions->size() >= SSL_SESSION_CACHE_SHARD_MAX_SIZE) {
+      /* Evict an arbitrary session; entries also age out via the
+         remove callback when OpenSSL rejects them as expired. */
+      SSL_SESSION_free(shard->sessions->begin()->second);
+      shard->sessions->erase(shard->sessions->begin());
+    }
+    shard->sessions->emplace(std::move(key), session);
+  }
+  mysql_rwlock_unlock(&shard->lock);
+
+  /* The cache keeps the reference OpenSSL handed to us. */
+  return 1;
+}
+
+static void ssl_session_remove_cb(SSL_CTX *, SSL_SESSION *session) {
+  unsigned int id_len;
+  const unsigned char *id = SSL_SESSION_get_id(session, &id_len);
+  if (id_len == 0) return;
+
+  st_ssl_session_cache_shard *shard = ssl_session_cache_get_shard(id, id_len);
+  std::string key((const char *)id, id_len);
+
+  mysql_rwlock_wrlock(&shard->lock);
+  auto it = shard->sessions->find(key);
+  if (it != shard->sessions->end() && it->second == session) {
+    SSL_SESSION_free(it->second);
+    shard->sessions->erase(it);
+  }
+  mysql_rwlock_unlock(&shard->lock);
+}
+
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+static SSL_SESSION *ssl_session_get_cb(SSL *, unsigned char *id, int id_len,
+                                       int *copy)
+#else
+static SSL_SESSION *ssl_session_get_cb(SSL *, const unsigned char *id,
+                                       int id_len, int *copy)
+#endif
+{
+  if (id_len <= 0) return nullptr;
+
+  st_ssl_session_cache_shard *shard =
+      ssl_session_cache_get_shard(id, (unsigned int)id_len);
+  std::string key((const char *)id, id_len);
+  SSL_SESSION *session = nullptr;
+
+  mysql_rwlock_rdlock(&shard->lock);
+  auto it = shard->sessions->find(key);
+  if (it != shard->sessions->end()) {
+    session = it->second;
+    /*
+      Take the caller's reference while still holding the shard lock, so
+      that a concurrent removal cannot free the session before OpenSSL
+      gets hold of it. *copy = 0 tells OpenSSL the reference is already
+      taken on its behalf.
+    */
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+    CRYPTO_add(&session->references, 1, CRYPTO_LOCK_SSL_SESSION);
+#else
+    SSL_SESSION_up_ref(session);
+#endif
+  }
+  mysql_rwlock_unlock(&shard->lock);
+
+  *copy = 0;
+  return session;
+}
+
 void vio_ssl_end() {
   if (ssl_initialized) {
+    deinit_ssl_session_cache();
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
     ERR_remove_thread_state(0);
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
@@ -466,6 +622,8 @@ void ssl_start() {
     OpenSSL_add_all_algorithms();
     SSL_load_error_strings();
 
+    init_ssl_session_cache();
+
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
     init_ssl_locks();
     init_lock_callback_functions();
@@ -831,8 +989,22 @@ struct st_VioSSLFd *new_VioSSLAcceptorFd(
   }
   /* Init the the VioSSLFd as a "acceptor" ie. the server side */
 
+  /*
+    Cache sessions for resumption in the sharded vio session cache
+    rather than in OpenSSL's internal one, whose single lock serializes
+    concurrent handshakes. Internal lookup is disabled; all stores and
+    lookups go through the callbacks.
+  */
+  SSL_CTX_set_session_cache_mode(
+      ssl_fd->ssl_context, SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL);
+  SSL_CTX_sess_set_new_cb(ssl_fd->ssl_context, ssl_session_new_cb);
+  SSL_CTX_sess_set_remove_cb(ssl_fd->ssl_context, ssl_session_remove_cb);
+  SSL_CTX_sess_set_get_cb(ssl_fd->ssl_context, ssl_session_get_cb);
+
   /* Set max number of cached sessions, returns the previous size */
-  SSL_CTX_sess_set_cache_size(ssl_fd->ssl_context, 128);
+  SSL_CTX_sess_set_cache_size(
+      ssl_fd->ssl_context,
+      SSL_SESSION_CACHE_SHARDS * SSL_SESSION_CACHE_SHARD_MAX_SIZE);
 
   SSL_CTX_set_verify(ssl_fd->ssl_context, verify, nullptr);
 